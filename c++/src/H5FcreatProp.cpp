@@ -312,6 +312,7 @@ unsigned FileCreatPropList::getIstorek() const
 ///		\li \c H5F_FILE_SPACE_ALL_PERSIST
 ///		\li \c H5F_FILE_SPACE_AGGR_VFD
 ///		\li \c H5F_FILE_SPACE_VFD
+///		\li \c H5F_FILE_SPACE_PAGE
 ///		For information, please see the C layer Reference Manual at:
 /// https://support.hdfgroup.org/HDF5/doc/RM/RM_H5P.html#Property-SetFileSpace
 // Programmer	Binh-Minh Ribler - Feb, 2017
@@ -152,6 +152,28 @@ if (NOT WINDOWS)
   endif ()
 endif ()
 
+#-----------------------------------------------------------------------------
+#  Check if the io_uring driver can be built
+#-----------------------------------------------------------------------------
+if (NOT WINDOWS)
+  option (HDF5_ENABLE_IOURING_VFD "Build the Linux io_uring Virtual File Driver" OFF)
+  if (HDF5_ENABLE_IOURING_VFD)
+    CHECK_INCLUDE_FILE ("linux/io_uring.h" HAVE_LINUX_IO_URING_H)
+    CHECK_SYMBOL_EXISTS (__NR_io_uring_setup "sys/syscall.h" HAVE_IO_URING_SYSCALLS)
+    # O_DIRECT is only declared by fcntl.h with _GNU_SOURCE
+    set (CMAKE_REQUIRED_DEFINITIONS_SAVE ${CMAKE_REQUIRED_DEFINITIONS})
+    set (CMAKE_REQUIRED_DEFINITIONS ${CMAKE_REQUIRED_DEFINITIONS} -D_GNU_SOURCE)
+    CHECK_SYMBOL_EXISTS (O_DIRECT "fcntl.h" HAVE_O_DIRECT)
+    set (CMAKE_REQUIRED_DEFINITIONS ${CMAKE_REQUIRED_DEFINITIONS_SAVE})
+    CHECK_FUNCTION_EXISTS (posix_memalign HAVE_POSIX_MEMALIGN)
+    if (HAVE_LINUX_IO_URING_H AND HAVE_IO_URING_SYSCALLS AND HAVE_O_DIRECT AND HAVE_POSIX_MEMALIGN)
+      set (${HDF_PREFIX}_HAVE_IOURING 1)
+    else ()
+      message (FATAL_ERROR "The io_uring VFD was requested but cannot be built: linux/io_uring.h, the io_uring system calls, O_DIRECT or posix_memalign() were not found")
+    endif ()
+  endif ()
+endif ()
+
 #-----------------------------------------------------------------------------
 # Check if C has __float128 extension
 #-----------------------------------------------------------------------------
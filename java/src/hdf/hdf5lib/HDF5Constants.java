@@ -224,6 +224,7 @@ public class HDF5Constants {
     public static final int H5F_FILE_SPACE_ALL = H5F_FILE_SPACE_ALL();
     public static final int H5F_FILE_SPACE_AGGR_VFD = H5F_FILE_SPACE_AGGR_VFD();
     public static final int H5F_FILE_SPACE_VFD = H5F_FILE_SPACE_VFD();
+    public static final int H5F_FILE_SPACE_PAGE = H5F_FILE_SPACE_PAGE();
     public static final int H5F_FILE_SPACE_NTYPES = H5F_FILE_SPACE_NTYPES();
 
     public static final long H5FD_CORE = H5FD_CORE();
@@ -1034,6 +1035,8 @@ public class HDF5Constants {
 
     private static native final int H5F_FILE_SPACE_VFD();
 
+    private static native final int H5F_FILE_SPACE_PAGE();
+
     private static native final int H5F_FILE_SPACE_NTYPES();
 
     private static native final long H5FD_CORE();
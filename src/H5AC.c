@@ -500,7 +500,9 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
 
     /* Turn on metadata cache logging, if being used */
     if(H5F_USE_MDC_LOGGING(f)) {
-        if(H5C_set_up_logging(f->shared->cache, H5F_MDC_LOG_LOCATION(f), H5F_START_MDC_LOG_ON_ACCESS(f)) < 0)
+        if(H5C_set_up_logging(f->shared->cache, H5F_MDC_LOG_LOCATION(f),
+                (H5C_log_format_t)H5F_MDC_LOG_FORMAT(f),
+                H5F_MDC_LOG_SAMPLE_INTERVAL(f), H5F_START_MDC_LOG_ON_ACCESS(f)) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "mdc logging setup failed")
 
         /* Write the log header regardless of current logging status */
@@ -522,6 +524,7 @@ H5AC_create(const H5F_t *f, H5AC_cache_config_t *config_ptr, H5AC_cache_image_co
     int_ci_config.generate_image     = image_config_ptr->generate_image;
     int_ci_config.save_resize_status = image_config_ptr->save_resize_status;
     int_ci_config.entry_ageout       = image_config_ptr->entry_ageout;
+    int_ci_config.compress_image     = image_config_ptr->compress_image;
 
     if(H5C_set_cache_image_config(f, f->shared->cache, &int_ci_config) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "auto resize configuration failed")
@@ -748,6 +751,40 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_expunge_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_prefetch_entries
+ *
+ * Purpose:	Speculatively read entries into the metadata cache, so
+ *		that protecting them later doesn't need a read.  Entries
+ *		that are close together in the file are read together.
+ *		See H5C_prefetch_entries() for details.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_prefetch_entries(H5F_t *f, hid_t dxpl_id, size_t nentries,
+    H5AC_prefetch_t *entries)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->cache);
+    HDassert(entries || 0 == nentries);
+
+    if(H5C_prefetch_entries(f, dxpl_id, nentries, entries) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "H5C_prefetch_entries() failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_prefetch_entries() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5AC_flush
@@ -1691,7 +1728,7 @@ done:
     if(curr_logging) {
         herr_t fake_ret_value = (NULL == ret_value) ? FAIL : SUCCEED;
 
-        if(H5AC__write_protect_entry_log_msg(f->shared->cache, (H5AC_info_t *)thing, flags, fake_ret_value) < 0)
+        if(H5AC__write_protect_entry_log_msg(f->shared->cache, (H5AC_info_t *)thing, addr, type->id, flags, fake_ret_value) < 0)
             HDONE_ERROR(H5E_CACHE, H5E_LOGFAIL, NULL, "unable to emit log message")
     } /* end if */
 
@@ -2039,7 +2076,7 @@ done:
 
     /* If currently logging, generate a message */
     if(curr_logging)
-        if(H5AC__write_unprotect_entry_log_msg(f->shared->cache, (H5AC_info_t *)thing, type->id, flags, ret_value) < 0)
+        if(H5AC__write_unprotect_entry_log_msg(f->shared->cache, addr, type->id, flags, ret_value) < 0)
             HDONE_ERROR(H5E_CACHE, H5E_LOGFAIL, FAIL, "unable to emit log message")
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2196,6 +2233,53 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_get_cache_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5AC_get_cache_type_stats
+ *
+ * Purpose:     Copy the per entry type statistics of the metadata cache
+ *		into the first nstats elements of the supplied array, in
+ *		order of entry type id.  The stats parameter may be NULL
+ *		if nstats is zero.
+ *
+ * Return:      Success:        Number of metadata cache entry types
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5AC_get_cache_type_stats(const H5AC_t *cache_ptr, size_t nstats,
+    H5AC_cache_type_stats_t *stats)
+{
+    size_t u;                           /* Local index variable */
+    ssize_t ret_value = H5AC_NTYPES;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(stats || nstats == 0);
+
+    for(u = 0; u < nstats && u < H5AC_NTYPES; u++) {
+        H5C_type_stats_t type_stats;
+
+        if(H5C_get_cache_type_stats((const H5C_t *)cache_ptr, (int)u, &type_stats) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_get_cache_type_stats() failed")
+
+        stats[u].name = H5AC_class_s[u]->name;
+        stats[u].hits = (unsigned long long)type_stats.hits;
+        stats[u].misses = (unsigned long long)type_stats.misses;
+        stats[u].loads = (unsigned long long)type_stats.loads;
+        stats[u].evictions = (unsigned long long)type_stats.evictions;
+        stats[u].flushes = (unsigned long long)type_stats.flushes;
+        stats[u].bytes_read = (unsigned long long)type_stats.bytes_read;
+        stats[u].bytes_written = (unsigned long long)type_stats.bytes_written;
+        stats[u].deserialize_time = type_stats.deserialize_time;
+        stats[u].serialize_time = type_stats.serialize_time;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_get_cache_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -2223,6 +2307,31 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5AC_reset_cache_hit_rate_stats() */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5AC_reset_cache_type_stats()
+ *
+ * Purpose:     Wrapper function for H5C_reset_cache_type_stats().
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5AC_reset_cache_type_stats(H5AC_t * cache_ptr)
+{
+    herr_t      ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5C_reset_cache_type_stats((H5C_t *)cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C_reset_cache_type_stats() failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5AC_reset_cache_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5AC_set_cache_auto_resize_config
@@ -2497,6 +2606,7 @@ H5AC_validate_cache_image_config(H5AC_cache_image_config_t *config_ptr)
     internal_config.generate_image     = config_ptr->generate_image;
     internal_config.save_resize_status = config_ptr->save_resize_status;
     internal_config.entry_ageout       = config_ptr->entry_ageout;
+    internal_config.compress_image     = config_ptr->compress_image;
 
     if(H5C_validate_cache_image_config(&internal_config) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "error(s) in new cache image config")
@@ -17,7 +17,8 @@
  *
  * Created:             H5AClog.c
  *
- * Purpose:             Functions for metadata cache logging in JSON format
+ * Purpose:             Functions for metadata cache logging in JSON or
+ *                      binary trace format
  *
  *-------------------------------------------------------------------------
  */
@@ -42,6 +43,23 @@
 
 #define MSG_SIZE 128
 
+/* Record an operation in a binary trace instead of formatting a JSON
+ * message.  Failed operations left the cache unchanged, so they are
+ * not recorded.
+ */
+#define H5AC__TRACE_RECORD(cache, fxn_ret_value, op, type_id, flags, addr, new_addr, size) \
+    if(H5C_LOG_FORMAT_BINARY == H5C_get_log_format(cache)) {                  \
+        if((fxn_ret_value) >= 0 && H5C_write_log_record((cache), (op),        \
+                (type_id), (flags), (addr), (new_addr), (size)) < 0)           \
+            HGOTO_ERROR(H5E_CACHE, H5E_LOGFAIL, FAIL, "unable to emit trace record") \
+        HGOTO_DONE(SUCCEED)                                                    \
+    } /* end if */
+
+/* Binary traces only hold the operations needed to replay them */
+#define H5AC__TRACE_SKIP(cache)                                                \
+    if(H5C_LOG_FORMAT_BINARY == H5C_get_log_format(cache))                     \
+        HGOTO_DONE(SUCCEED)
+
 
 /******************/
 /* Local Typedefs */
@@ -100,6 +118,8 @@ H5AC__write_create_cache_log_msg(H5AC_t *cache)
     /* Sanity checks */
     HDassert(cache);
 
+    H5AC__TRACE_SKIP(cache)
+
     /* Check if log messages are being emitted */
     if(H5C_get_logging_status(cache, &log_enabled, &curr_logging) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "unable to get logging status")
@@ -166,6 +186,8 @@ H5AC__write_destroy_cache_log_msg(H5AC_t *cache)
     /* Sanity checks */
     HDassert(cache);
 
+    H5AC__TRACE_SKIP(cache)
+
     /* Check if log messages are being emitted */
     if(H5C_get_logging_status(cache, &log_enabled, &curr_logging) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "unable to get logging status")
@@ -230,6 +252,8 @@ H5AC__write_evict_cache_log_msg(const H5AC_t *cache,
     /* Sanity checks */
     HDassert(cache);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_EVICT, 0, 0, HADDR_UNDEF, HADDR_UNDEF, 0)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -277,6 +301,8 @@ H5AC__write_expunge_entry_log_msg(const H5AC_t *cache,
     /* Sanity checks */
     HDassert(cache);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_EXPUNGE, type_id, 0, address, HADDR_UNDEF, 0)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -325,6 +351,8 @@ H5AC__write_flush_cache_log_msg(const H5AC_t *cache,
     /* Sanity checks */
     HDassert(cache);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_FLUSH, 0, 0, HADDR_UNDEF, HADDR_UNDEF, 0)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -375,6 +403,8 @@ H5AC__write_insert_entry_log_msg(const H5AC_t *cache,
     HDassert(cache);
 
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_INSERT, type_id, flags, address, HADDR_UNDEF, size)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -427,6 +457,8 @@ H5AC__write_mark_dirty_entry_log_msg(const H5AC_t *cache,
     HDassert(cache);
     HDassert(entry);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_MARK_DIRTY, entry->type->id, 0, entry->addr, HADDR_UNDEF, entry->size)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -474,6 +506,8 @@ H5AC__write_mark_clean_entry_log_msg(const H5AC_t *cache, const H5AC_info_t *ent
     HDassert(cache);
     HDassert(entry);
 
+    H5AC__TRACE_SKIP(cache)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -522,6 +556,8 @@ H5AC__write_mark_unserialized_entry_log_msg(const H5AC_t *cache,
     HDassert(cache);
     HDassert(entry);
 
+    H5AC__TRACE_SKIP(cache)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -569,6 +605,8 @@ H5AC__write_mark_serialized_entry_log_msg(const H5AC_t *cache, const H5AC_info_t
     HDassert(cache);
     HDassert(entry);
 
+    H5AC__TRACE_SKIP(cache)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -618,6 +656,8 @@ H5AC__write_move_entry_log_msg(const H5AC_t *cache,
     /* Sanity checks */
     HDassert(cache);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_MOVE, type_id, 0, old_addr, new_addr, 0)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -669,6 +709,8 @@ H5AC__write_pin_entry_log_msg(const H5AC_t *cache,
     HDassert(cache);
     HDassert(entry);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_PIN, entry->type->id, 0, entry->addr, HADDR_UNDEF, entry->size)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -721,6 +763,8 @@ H5AC__write_create_fd_log_msg(const H5AC_t *cache,
     HDassert(parent);
     HDassert(child);
 
+    H5AC__TRACE_SKIP(cache)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -760,6 +804,8 @@ done:
 herr_t
 H5AC__write_protect_entry_log_msg(const H5AC_t *cache,
                                   const H5AC_info_t *entry,
+                                  haddr_t address,
+                                  int type_id,
                                   unsigned flags,
                                   herr_t fxn_ret_value)
 {
@@ -771,7 +817,9 @@ H5AC__write_protect_entry_log_msg(const H5AC_t *cache,
 
     /* Sanity checks */
     HDassert(cache);
-    HDassert(entry);
+    HDassert(entry || fxn_ret_value < 0);
+
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_PROTECT, type_id, flags, address, HADDR_UNDEF, entry->size)
 
     if(H5AC__READ_ONLY_FLAG == flags)
         HDstrcpy(rw_s, "READ");
@@ -790,8 +838,8 @@ H5AC__write_protect_entry_log_msg(const H5AC_t *cache,
 \"returned\":%d\
 },\n\
 "
-    , (long long)HDtime(NULL), (unsigned long)entry->addr, 
-      rw_s, (int)entry->size, (int)fxn_ret_value);
+    , (long long)HDtime(NULL), (unsigned long)address, 
+      rw_s, (int)(entry ? entry->size : 0), (int)fxn_ret_value);
 
     /* Write the log message to the file */
     if(H5C_write_log_message(cache, msg) < 0)
@@ -830,6 +878,8 @@ H5AC__write_resize_entry_log_msg(const H5AC_t *cache,
     HDassert(cache);
     HDassert(entry);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_RESIZE, entry->type->id, 0, entry->addr, HADDR_UNDEF, new_size)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -880,6 +930,8 @@ H5AC__write_unpin_entry_log_msg(const H5AC_t *cache,
     HDassert(cache);
     HDassert(entry);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_UNPIN, entry->type->id, 0, entry->addr, HADDR_UNDEF, entry->size)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -932,6 +984,8 @@ H5AC__write_destroy_fd_log_msg(const H5AC_t *cache,
     HDassert(parent);
     HDassert(child);
 
+    H5AC__TRACE_SKIP(cache)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -970,7 +1024,7 @@ done:
  */
 herr_t
 H5AC__write_unprotect_entry_log_msg(const H5AC_t *cache,
-                                    const H5AC_info_t *entry,
+                                    haddr_t address,
                                     int type_id,
                                     unsigned flags,
                                     herr_t fxn_ret_value)
@@ -982,7 +1036,8 @@ H5AC__write_unprotect_entry_log_msg(const H5AC_t *cache,
 
     /* Sanity checks */
     HDassert(cache);
-    HDassert(entry);
+
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_UNPROTECT, type_id, flags, address, HADDR_UNDEF, 0)
 
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
@@ -996,7 +1051,7 @@ H5AC__write_unprotect_entry_log_msg(const H5AC_t *cache,
 \"returned\":%d\
 },\n\
 "
-    , (long long)HDtime(NULL), (unsigned long)entry->addr, 
+    , (long long)HDtime(NULL), (unsigned long)address, 
       type_id, flags, (int)fxn_ret_value);
 
     HDsnprintf(msg, MSG_SIZE, " ");
@@ -1037,6 +1092,8 @@ H5AC__write_set_cache_config_log_msg(const H5AC_t *cache,
     HDassert(cache);
     HDassert(config);
 
+    H5AC__TRACE_SKIP(cache)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -1084,6 +1141,8 @@ H5AC__write_remove_entry_log_msg(const H5AC_t *cache, const H5AC_info_t *entry,
     HDassert(cache);
     HDassert(entry);
 
+    H5AC__TRACE_RECORD(cache, fxn_ret_value, H5C__TRACE_OP_REMOVE, entry->type->id, 0, entry->addr, HADDR_UNDEF, entry->size)
+
     /* Create the log message string */
     HDsnprintf(msg, MSG_SIZE, 
 "\
@@ -479,6 +479,8 @@ H5_DLL herr_t H5AC__write_create_fd_log_msg(const H5AC_t *cache,
                                             herr_t fxn_ret_value);
 H5_DLL herr_t H5AC__write_protect_entry_log_msg(const H5AC_t *cache,
                                                 const H5AC_info_t *entry,
+                                                haddr_t address,
+                                                int type_id,
                                                 unsigned flags,
                                                 herr_t fxn_ret_value);
 H5_DLL herr_t H5AC__write_resize_entry_log_msg(const H5AC_t *cache,
@@ -493,7 +495,7 @@ H5_DLL herr_t H5AC__write_destroy_fd_log_msg(const H5AC_t *cache,
                                              const H5AC_info_t *child,
                                              herr_t fxn_ret_value);
 H5_DLL herr_t H5AC__write_unprotect_entry_log_msg(const H5AC_t *cache,
-                                                  const H5AC_info_t *entry,
+                                                  haddr_t address,
                                                   int type_id,
                                                   unsigned flags,
                                                   herr_t fxn_ret_value);
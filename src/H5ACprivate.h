@@ -183,6 +183,7 @@ typedef H5C_notify_action_t     H5AC_notify_action_t;
 
 #define H5AC__CLASS_NO_FLAGS_SET 	H5C__CLASS_NO_FLAGS_SET
 #define H5AC__CLASS_SPECULATIVE_LOAD_FLAG H5C__CLASS_SPECULATIVE_LOAD_FLAG
+#define H5AC__CLASS_MODIFIES_IMAGE_FLAG H5C__CLASS_MODIFIES_IMAGE_FLAG
 
 /* The following flags should only appear in test code */
 #define H5AC__CLASS_SKIP_READS              H5C__CLASS_SKIP_READS
@@ -205,6 +206,7 @@ typedef H5C_free_icr_func_t		H5AC_free_icr_func_t;
 typedef H5C_get_fsf_size_t		H5AC_get_fsf_size_t;
 
 typedef H5C_class_t			H5AC_class_t;
+typedef H5C_prefetch_t			H5AC_prefetch_t;
 
 /* Cache entry info */
 typedef H5C_cache_entry_t		H5AC_info_t;
@@ -332,7 +334,8 @@ H5_DLLVAR hid_t H5AC_rawdata_dxpl_id;
    /* int32_t version            = */ H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION, \
    /* hbool_t generate_image     = */ FALSE,                                 \
    /* hbool_t save_resize_status = */ FALSE,                                 \
-   /* int32_t entry_ageout       = */ H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE  \
+   /* int32_t entry_ageout       = */ H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE, \
+   /* hbool_t compress_image     = */ FALSE                                  \
 }
 /*
  * Library prototypes.
@@ -436,13 +439,18 @@ H5_DLL herr_t H5AC_dest(H5F_t *f, hid_t dxpl_id);
 H5_DLL herr_t H5AC_evict(H5F_t *f, hid_t dxpl_id);
 H5_DLL herr_t H5AC_expunge_entry(H5F_t *f, hid_t dxpl_id,
     const H5AC_class_t *type, haddr_t addr, unsigned flags);
+H5_DLL herr_t H5AC_prefetch_entries(H5F_t *f, hid_t dxpl_id,
+    size_t nentries, H5AC_prefetch_t *entries);
 H5_DLL herr_t H5AC_remove_entry(void *entry);
 H5_DLL herr_t H5AC_get_cache_auto_resize_config(const H5AC_t * cache_ptr,
     H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t H5AC_get_cache_size(H5AC_t *cache_ptr, size_t *max_size_ptr,
     size_t *min_clean_size_ptr, size_t *cur_size_ptr, uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5AC_get_cache_hit_rate(H5AC_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL ssize_t H5AC_get_cache_type_stats(const H5AC_t *cache_ptr,
+    size_t nstats, H5AC_cache_type_stats_t *stats);
 H5_DLL herr_t H5AC_reset_cache_hit_rate_stats(H5AC_t *cache_ptr);
+H5_DLL herr_t H5AC_reset_cache_type_stats(H5AC_t *cache_ptr);
 H5_DLL herr_t H5AC_set_cache_auto_resize_config(H5AC_t *cache_ptr,
     H5AC_cache_config_t *config_ptr);
 H5_DLL herr_t H5AC_validate_config(H5AC_cache_config_t *config_ptr);
@@ -555,9 +555,17 @@ typedef struct H5AC_cache_config_t
  *	current value, any value in excess of 255 will be the functional 
  *	equivalent of H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE.
  *
+ * compress_image: Boolean flag indicating whether the entry images in the
+ *	cache image should be compressed.  If TRUE, and the library is 
+ *	built with the deflate filter, the cache image is written in a 
+ *	format that earlier versions of the library can't read.  The
+ *	cache image is then dropped when the file is opened by a library
+ *	built without the deflate filter.  This field was added in version
+ *	2 of the structure.
+ *
  ****************************************************************************/
 
-#define H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION 	1
+#define H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION 	2
 
 #define H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE	-1
 #define H5AC__CACHE_IMAGE__ENTRY_AGEOUT__MAX	100
@@ -567,8 +575,90 @@ typedef struct H5AC_cache_image_config_t {
     hbool_t                             generate_image;
     hbool_t                             save_resize_status;
     int32_t                             entry_ageout;
+    hbool_t                             compress_image;
 } H5AC_cache_image_config_t;
 
+/****************************************************************************
+ *
+ * structure H5AC_cache_type_stats_t
+ *
+ * H5AC_cache_type_stats_t is a public structure intended for use in public 
+ * APIs.  Instances of it are used to report the activity of the metadata 
+ * cache for a single type of metadata cache entry.  These statistics are 
+ * always collected, and are retrieved and reset by the 
+ * H5Fget_mdc_stats() and H5Freset_mdc_stats() calls.
+ *
+ * The fields of the structure are discussed individually below:
+ *
+ * name: Pointer to a string containing the name of the entry type.  This
+ *      string belongs to the library, and must not be modified or freed.
+ *
+ * hits: Number of times an entry of this type was found in the metadata
+ *      cache when it was accessed.
+ *
+ * misses: Number of times an entry of this type was not in the metadata
+ *      cache when it was accessed.
+ *
+ * loads: Number of entries of this type that have been loaded into the
+ *      metadata cache, either from the file or from a metadata cache 
+ *      image.
+ *
+ * evictions: Number of entries of this type that have been evicted from
+ *      the metadata cache.
+ *
+ * flushes: Number of entries of this type that have been written to the
+ *      file.
+ *
+ * bytes_read: Number of bytes read from the file to load entries of 
+ *      this type.
+ *
+ * bytes_written: Number of bytes written to the file when flushing 
+ *      entries of this type.
+ *
+ * deserialize_time: Time in seconds spent converting entries of this
+ *      type from their on disk to their in memory form.
+ *
+ * serialize_time: Time in seconds spent converting entries of this
+ *      type from their in memory to their on disk form.
+ *
+ ****************************************************************************/
+
+typedef struct H5AC_cache_type_stats_t {
+    const char *                        name;
+    unsigned long long                  hits;
+    unsigned long long                  misses;
+    unsigned long long                  loads;
+    unsigned long long                  evictions;
+    unsigned long long                  flushes;
+    unsigned long long                  bytes_read;
+    unsigned long long                  bytes_written;
+    double                              deserialize_time;
+    double                              serialize_time;
+} H5AC_cache_type_stats_t;
+
+/****************************************************************************
+ *
+ * enum H5AC_log_format_t
+ *
+ * Format of the metadata cache log set up with H5Pset_mdc_log_options().
+ *
+ * H5AC_LOG_FORMAT_JSON: Every cache operation is written to the log as 
+ *      a JSON text message.  This is useful for debugging, but too slow 
+ *      to leave on in production.
+ *
+ * H5AC_LOG_FORMAT_BINARY: Cache operations are recorded as fixed size 
+ *      binary records, buffered in memory and written to the log in 
+ *      large blocks.  Optionally, only the operations on a sample of 
+ *      the entries are recorded.  Binary traces can be replayed against 
+ *      different cache configurations after the fact.
+ *
+ ****************************************************************************/
+
+typedef enum H5AC_log_format_t {
+    H5AC_LOG_FORMAT_JSON = 0,
+    H5AC_LOG_FORMAT_BINARY
+} H5AC_log_format_t;
+
 #ifdef __cplusplus
 }
 #endif
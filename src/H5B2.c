@@ -403,6 +403,33 @@ H5B2_get_addr(const H5B2_t *bt2, haddr_t *addr_p)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5B2_get_addr() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5B2_get_hdr_size
+ *
+ * Purpose:	Get the size of a v2 B-tree header in a file
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5B2_get_hdr_size(const H5F_t *f, size_t *size_p)
+{
+    FUNC_ENTER_NOAPI_NOERR
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(size_p);
+
+    /* Compute the size of the header, which doesn't depend on the B-tree */
+    *size_p = (size_t)H5B2_HEADER_SIZE_FILE(f);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5B2_get_hdr_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5B2_iterate
@@ -51,10 +51,6 @@
  *	 - Also in H5C__make_space_in_cache(), use high and low water marks
  *	   to reduce the number of I/O calls.
  *
- *	 - When flushing, attempt to combine contiguous entries to reduce
- *	   I/O overhead.  Can't do this just yet as some entries are not
- *	   contiguous.  Do this in parallel only or in serial as well?
- *
  *	 - Create MPI type for dirty objects when flushing in parallel.
  *
  *	 - Now that TBBT routines aren't used, fix nodes in memory to
@@ -90,6 +86,7 @@
 #include "H5MFprivate.h"	/* File memory management		*/
 #include "H5MMprivate.h"	/* Memory management			*/
 #include "H5Pprivate.h"         /* Property lists                       */
+#include "H5VMprivate.h"        /* Vectors and arrays                   */
 
 
 /****************/
@@ -146,6 +143,17 @@ static herr_t H5C_flush_invalidate_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring
 static herr_t H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,
     unsigned flags);
 
+static hbool_t H5C__start_flush_stage(H5F_t *f);
+
+static herr_t H5C__stage_entry_write(H5F_t *f, hid_t dxpl_id,
+    H5FD_mem_t mem_type, haddr_t addr, size_t size, const void *image);
+
+static int H5C__flush_stage_cmp_addr(const void *_s1, const void *_s2);
+
+static int H5C__flush_stage_cmp_seq(const void *_s1, const void *_s2);
+
+static herr_t H5C__write_flush_stage(H5F_t *f, hid_t dxpl_id);
+
 static void * H5C_load_entry(H5F_t *             f,
                              hid_t               dxpl_id,
 #ifdef H5_HAVE_PARALLEL
@@ -162,6 +170,10 @@ static herr_t H5C__mark_flush_dep_clean(H5C_cache_entry_t * entry);
 static herr_t H5C__verify_len_eoa(H5F_t *f, const H5C_class_t * type,
     haddr_t addr, size_t *len, hbool_t actual);
 
+static herr_t H5C__map_entry_image(H5F_t *f, hid_t dxpl_id,
+    const H5C_class_t * type, haddr_t addr, size_t *len, void *udata,
+    const void **mapped_image, uint8_t **image);
+
 #if H5C_DO_SLIST_SANITY_CHECKS
 static hbool_t H5C_entry_in_skip_list(H5C_t * cache_ptr, 
                                       H5C_cache_entry_t *target_ptr);
@@ -263,9 +275,6 @@ H5C_create(size_t		      max_cache_size,
     if(NULL == (cache_ptr = H5FL_CALLOC(H5C_t)))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
 
-    if(NULL == (cache_ptr->slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
-        HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, NULL, "can't create skip list")
-
     if(NULL == (cache_ptr->tag_list = H5SL_create(H5SL_TYPE_HADDR, NULL)))
         HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, NULL, "can't create skip list for tagged entry addresses")
 
@@ -283,6 +292,10 @@ H5C_create(size_t		      max_cache_size,
 
     cache_ptr->log_file_ptr			= NULL;
 
+    cache_ptr->log_format			= H5C_LOG_FORMAT_JSON;
+
+    cache_ptr->log_trace_ptr			= NULL;
+
     cache_ptr->trace_file_ptr			= NULL;
 
     cache_ptr->aux_ptr				= aux_ptr;
@@ -317,26 +330,43 @@ H5C_create(size_t		      max_cache_size,
 	cache_ptr->slist_ring_size[i]		= (size_t)0;
     } /* end for */
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++)
-        (cache_ptr->index)[i] = NULL;
-
     cache_ptr->il_len				= 0;
     cache_ptr->il_size				= (size_t)0;
     cache_ptr->il_head				= NULL;
     cache_ptr->il_tail				= NULL;
 
+    cache_ptr->index_len_slots			= 0;
+    cache_ptr->index_shift			= 0;
+    cache_ptr->index				= NULL;
+    if(H5C__resize_index(cache_ptr, (size_t)H5C__INDEX_MIN_LEN) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "can't allocate cache index")
+
     /* Tagging Field Initializations */
     cache_ptr->ignore_tags                      = FALSE;
 
     cache_ptr->slist_changed			= FALSE;
     cache_ptr->slist_len			= 0;
     cache_ptr->slist_size			= (size_t)0;
+    cache_ptr->slist_head			= NULL;
+    cache_ptr->slist_tail			= NULL;
+    cache_ptr->slist_sorted			= TRUE;
 
 #if H5C_DO_SANITY_CHECKS
     cache_ptr->slist_len_increase		= 0;
     cache_ptr->slist_size_increase		= 0;
 #endif /* H5C_DO_SANITY_CHECKS */
 
+    cache_ptr->coalesce_flush_writes		= TRUE;
+    cache_ptr->flush_stage_active		= FALSE;
+    cache_ptr->flush_stage_len			= 0;
+    cache_ptr->flush_stage_alloc		= 0;
+    cache_ptr->flush_stage			= NULL;
+    cache_ptr->flush_stage_buf_len		= 0;
+    cache_ptr->flush_stage_buf_alloc		= 0;
+    cache_ptr->flush_stage_buf			= NULL;
+    cache_ptr->flush_stage_images		= 0;
+    cache_ptr->flush_stage_writes		= 0;
+
     cache_ptr->entries_removed_counter		= 0;
     cache_ptr->last_entry_removed_ptr		= NULL;
     cache_ptr->entry_watched_for_removal        = NULL;
@@ -438,6 +468,7 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->image_ctl.generate_image     = FALSE;
     cache_ptr->image_ctl.save_resize_status = FALSE;
     cache_ptr->image_ctl.entry_ageout       = -1;
+    cache_ptr->image_ctl.compress_image     = FALSE;
     cache_ptr->image_ctl.flags              = H5C_CI__ALL_FLAGS;
 
     cache_ptr->serialization_in_progress= FALSE;
@@ -456,6 +487,11 @@ H5C_create(size_t		      max_cache_size,
     cache_ptr->num_entries_in_image	= 0;
     cache_ptr->image_entries		= NULL;
     cache_ptr->image_buffer		= NULL;
+    cache_ptr->pf_num_blocks		= 0;
+    cache_ptr->pf_blocks		= NULL;
+    cache_ptr->pf_block_buf		= NULL;
+    cache_ptr->pf_block_loaded		= -1;
+    cache_ptr->pf_pending		= 0;
 
     /* initialize free space manager related fields: */
     cache_ptr->rdfsm_settled		= FALSE;
@@ -479,12 +515,11 @@ H5C_create(size_t		      max_cache_size,
 done:
     if(NULL == ret_value) {
         if(cache_ptr != NULL) {
-            if(cache_ptr->slist_ptr != NULL)
-                H5SL_close(cache_ptr->slist_ptr);
-
             if(cache_ptr->tag_list != NULL)
                 H5SL_close(cache_ptr->tag_list);
 
+            cache_ptr->index = (H5C_index_slot_t *)H5MM_xfree(cache_ptr->index);
+
             cache_ptr->magic = 0;
             cache_ptr = H5FL_FREE(H5C_t, cache_ptr);
         } /* end if */
@@ -821,16 +856,27 @@ H5C_dest(H5F_t * f, hid_t dxpl_id)
         if(H5C__generate_cache_image(f, dxpl_id, cache_ptr) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "Can't generate metadata cache image")
 
-    if(cache_ptr->slist_ptr != NULL) {
-        H5SL_close(cache_ptr->slist_ptr);
-        cache_ptr->slist_ptr = NULL;
-    } /* end if */
+    HDassert(cache_ptr->slist_head == NULL);
 
     if(cache_ptr->tag_list != NULL) {
         H5SL_destroy(cache_ptr->tag_list, H5C_free_tag_list_cb, NULL);
         cache_ptr->tag_list = NULL;
     } /* end if */
 
+    HDassert(0 == cache_ptr->flush_stage_len);
+    cache_ptr->flush_stage = (H5C_flush_stage_t *)H5MM_xfree(cache_ptr->flush_stage);
+    cache_ptr->flush_stage_buf = (uint8_t *)H5MM_xfree(cache_ptr->flush_stage_buf);
+
+    HDassert(0 == cache_ptr->index_len);
+    cache_ptr->index = (H5C_index_slot_t *)H5MM_xfree(cache_ptr->index);
+
+    /* All prefetched entries are gone, so the retained cache image (if 
+     * any) should have been released with the last of them.
+     */
+    HDassert(0 == cache_ptr->pf_pending);
+    if(H5C__discard_cache_image(cache_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTFREE, FAIL, "can't discard retained cache image")
+
 #ifndef NDEBUG
 #if H5C_DO_SANITY_CHECKS
     if(cache_ptr->get_entry_ptr_from_addr_counter > 0)
@@ -1034,7 +1080,6 @@ H5C_flush_cache(H5F_t *f, hid_t dxpl_id, unsigned flags)
     cache_ptr = f->shared->cache;
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->slist_ptr);
 
 #if H5C_DO_SANITY_CHECKS
     HDassert(cache_ptr->index_ring_len[H5C_RING_UNDEFINED] == 0);
@@ -1459,11 +1504,12 @@ H5C_insert_entry(H5F_t *             f,
     entry_ptr->flush_dep_ndirty_children    = 0;
     entry_ptr->flush_dep_nunser_children    = 0;
 
-    entry_ptr->ht_next = NULL;
-    entry_ptr->ht_prev = NULL;
     entry_ptr->il_next = NULL;
     entry_ptr->il_prev = NULL;
 
+    entry_ptr->slist_next = NULL;
+    entry_ptr->slist_prev = NULL;
+
     entry_ptr->next = NULL;
     entry_ptr->prev = NULL;
 
@@ -1482,6 +1528,7 @@ H5C_insert_entry(H5F_t *             f,
     entry_ptr->prefetched			= FALSE;
     entry_ptr->prefetch_type_id			= 0;
     entry_ptr->age				= 0;
+    entry_ptr->pf_image_pending			= FALSE;
 #ifndef NDEBUG  /* debugging field */
     entry_ptr->serialization_count		= 0;
 #endif /* NDEBUG */
@@ -2000,7 +2047,6 @@ H5C_move_entry(H5C_t *	     cache_ptr,
         H5C__DELETE_FROM_INDEX(cache_ptr, entry_ptr, FAIL)
 
         if(entry_ptr->in_slist) {
-            HDassert(cache_ptr->slist_ptr);
             H5C__REMOVE_ENTRY_FROM_SLIST(cache_ptr, entry_ptr, FALSE)
         } /* end if */
     } /* end if */
@@ -2701,6 +2747,8 @@ H5C_protect(H5F_t *		f,
 
     H5C__UPDATE_CACHE_HIT_RATE_STATS(cache_ptr, hit)
 
+    H5C__UPDATE_TYPE_STATS_FOR_PROTECT(cache_ptr, type->id, hit)
+
     H5C__UPDATE_STATS_FOR_PROTECT(cache_ptr, entry_ptr, hit)
 
     ret_value = thing;
@@ -2838,6 +2886,33 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_reset_cache_hit_rate_stats() */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C_reset_cache_type_stats()
+ *
+ * Purpose:     Reset the per entry type statistics.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_reset_cache_type_stats(H5C_t * cache_ptr)
+{
+    herr_t	ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "bad cache_ptr on entry")
+
+    HDmemset(cache_ptr->type_stats, 0, sizeof(cache_ptr->type_stats));
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_reset_cache_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_set_cache_auto_resize_config
@@ -5193,7 +5268,6 @@ H5C_flush_invalidate_cache(H5F_t *f, hid_t dxpl_id, unsigned flags)
     cache_ptr = f->shared->cache;
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->slist_ptr);
 
 #if H5C_DO_SANITY_CHECKS
 {
@@ -5336,7 +5410,7 @@ H5C_flush_invalidate_ring(H5F_t * f, hid_t dxpl_id, H5C_ring_t ring,
     int32_t             old_ring_pel_len;
     unsigned            cooked_flags;
     unsigned            evict_flags;
-    H5SL_node_t        *node_ptr = NULL;
+    hbool_t             stage_writes;
     H5C_cache_entry_t  *entry_ptr = NULL;
     H5C_cache_entry_t  *next_entry_ptr = NULL;
 #if H5C_DO_SANITY_CHECKS
@@ -5352,12 +5426,14 @@ H5C_flush_invalidate_ring(H5F_t * f, hid_t dxpl_id, H5C_ring_t ring,
     cache_ptr = f->shared->cache;
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->slist_ptr);
     HDassert(ring > H5C_RING_UNDEFINED);
     HDassert(ring < H5C_RING_NTYPES);
 
     HDassert(cache_ptr->epoch_markers_active == 0);
 
+    /* Stage the entry writes, so adjacent entries are written together */
+    stage_writes = H5C__start_flush_stage(f);
+
     /* Filter out the flags that are not relevant to the flush/invalidate.
      */
     cooked_flags = flags & H5C__FLUSH_CLEAR_ONLY_FLAG;
@@ -5448,21 +5524,16 @@ H5C_flush_invalidate_ring(H5F_t * f, hid_t dxpl_id, H5C_ring_t ring,
 
         /* this done, start the scan of the slist */
         restart_slist_scan = TRUE;
-        while(restart_slist_scan || (node_ptr != NULL)) {
+        while(restart_slist_scan || (next_entry_ptr != NULL)) {
             if(restart_slist_scan) {
                 restart_slist_scan = FALSE;
 
-                /* Start at beginning of skip list */
-                node_ptr = H5SL_first(cache_ptr->slist_ptr);
-                if(node_ptr == NULL)
+                /* Start at beginning of the slist, sorting it first */
+                next_entry_ptr = H5C__slist_first(cache_ptr);
+                if(next_entry_ptr == NULL)
                     /* the slist is empty -- break out of inner loop */
                     break;
 
-                /* Get cache entry for this node */
-                next_entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
-                if(NULL == next_entry_ptr)
-                    HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "next_entry_ptr == NULL ?!?!")
-
                 HDassert(next_entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
                 HDassert(next_entry_ptr->is_dirty);
                 HDassert(next_entry_ptr->in_slist);
@@ -5488,22 +5559,17 @@ H5C_flush_invalidate_ring(H5F_t * f, hid_t dxpl_id, H5C_ring_t ring,
             HDassert(entry_ptr->is_dirty);
             HDassert(entry_ptr->ring >= ring);
 
-            /* increment node pointer now, before we delete its target
-             * from the slist.
+            /* advance to the next entry now, before we delete the
+             * current one from the slist.
              */
-            node_ptr = H5SL_next(node_ptr);
-            if(node_ptr != NULL) {
-                next_entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
-                if(NULL == next_entry_ptr)
-                    HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "next_entry_ptr == NULL ?!?!")
+            next_entry_ptr = entry_ptr->slist_next;
+            if(next_entry_ptr != NULL) {
                 HDassert(next_entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
                 HDassert(next_entry_ptr->is_dirty);
                 HDassert(next_entry_ptr->in_slist);
                 HDassert(next_entry_ptr->ring >= ring);
                 HDassert(entry_ptr != next_entry_ptr);
             } /* end if */
-            else
-                next_entry_ptr = NULL;
 
             /* Note that we now remove nodes from the slist as we flush
              * the associated entries, instead of leaving them there
@@ -5568,12 +5634,12 @@ H5C_flush_invalidate_ring(H5F_t * f, hid_t dxpl_id, H5C_ring_t ring,
          * the scan, either before or after scan pointer.  The following
          * asserts take this into account.
          *
-         * Don't bother with the sanity checks if node_ptr != NULL, as
-         * in this case we broke out of the loop because it got changed
+         * Don't bother with the sanity checks if next_entry_ptr != NULL,
+         * as in this case we broke out of the loop because it got changed
          * out from under us.
          */
 
-        if(node_ptr == NULL) {
+        if(next_entry_ptr == NULL) {
             HDassert(cache_ptr->slist_len == (initial_slist_len + cache_ptr->slist_len_increase));
             HDassert((int64_t)cache_ptr->slist_size == ((int64_t)initial_slist_size + cache_ptr->slist_size_increase));
         } /* end if */
@@ -5735,6 +5801,12 @@ H5C_flush_invalidate_ring(H5F_t * f, hid_t dxpl_id, H5C_ring_t ring,
         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't unpin all pinned entries in ring")
 
 done:
+    if(stage_writes) {
+        cache_ptr->flush_stage_active = FALSE;
+        if(H5C__write_flush_stage(f, dxpl_id) < 0)
+            HDONE_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write staged entry images")
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_flush_invalidate_ring() */
 
@@ -5772,8 +5844,8 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
     hbool_t		ignore_protected;
     hbool_t		tried_to_flush_protected_entry = FALSE;
     hbool_t		restart_slist_scan;
+    hbool_t		stage_writes = FALSE;
     uint32_t		protected_entries = 0;
-    H5SL_node_t * 	node_ptr = NULL;
     H5C_cache_entry_t *	entry_ptr = NULL;
     H5C_cache_entry_t *	next_entry_ptr = NULL;
 #if H5C_DO_SANITY_CHECKS
@@ -5787,7 +5859,6 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
 
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->slist_ptr);
     HDassert((flags & H5C__FLUSH_INVALIDATE_FLAG) == 0);
     HDassert(ring > H5C_RING_UNDEFINED);
     HDassert(ring < H5C_RING_NTYPES);
@@ -5808,6 +5879,9 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
 
     HDassert(cache_ptr->flush_in_progress);
 
+    /* Stage the entry writes, so adjacent entries are written together */
+    stage_writes = H5C__start_flush_stage(f);
+
     /* When we are only flushing marked entries, the slist will usually
      * still contain entries when we have flushed everything we should.
      * Thus we track whether we have flushed any entries in the last
@@ -5871,23 +5945,17 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
 
         restart_slist_scan = TRUE;
 
-        while((restart_slist_scan ) || (node_ptr != NULL)) {
+        while((restart_slist_scan ) || (next_entry_ptr != NULL)) {
             if(restart_slist_scan) {
                 restart_slist_scan = FALSE;
 
-                /* Start at beginning of skip list */
-                node_ptr = H5SL_first(cache_ptr->slist_ptr);
+                /* Start at beginning of the slist, sorting it first */
+                next_entry_ptr = H5C__slist_first(cache_ptr);
 
-                if(node_ptr == NULL)
+                if(next_entry_ptr == NULL)
                     /* the slist is empty -- break out of inner loop */
                     break;
 
-                /* Get cache entry for this node */
-                next_entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
-
-                if(NULL == next_entry_ptr)
-                    HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "next_entry_ptr == NULL ?!?!")
-
                 HDassert(next_entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
                 HDassert(next_entry_ptr->is_dirty);
                 HDassert(next_entry_ptr->in_slist);
@@ -5918,15 +5986,11 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
             if(!flush_marked_entries || entry_ptr->flush_marker)
                 HDassert(entry_ptr->ring >= ring);
 
-            /* Advance node pointer now, before we delete its target
-             * from the slist.
+            /* Advance to the next entry now, before we delete the
+             * current one from the slist.
              */
-            node_ptr = H5SL_next(node_ptr);
-            if(node_ptr != NULL) {
-                next_entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
-                if(NULL == next_entry_ptr)
-                    HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "next_entry_ptr == NULL ?!?!")
-
+            next_entry_ptr = entry_ptr->slist_next;
+            if(next_entry_ptr != NULL) {
                 HDassert(next_entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
                 HDassert(next_entry_ptr->is_dirty);
                 HDassert(next_entry_ptr->in_slist);
@@ -5936,8 +6000,6 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
 
                 HDassert(entry_ptr != next_entry_ptr);
             } /* end if */
-            else
-                next_entry_ptr = NULL;
 
             if((!flush_marked_entries || entry_ptr->flush_marker) 
                     && (!entry_ptr->flush_me_last ||
@@ -5978,7 +6040,7 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
                     flushed_entries_last_pass = TRUE;
                 } /* end else */
             } /* end if */
-        } /* while ( ( restart_slist_scan ) || ( node_ptr != NULL ) ) */
+        } /* while ( ( restart_slist_scan ) || ( next_entry_ptr != NULL ) ) */
 
 #if H5C_DO_SANITY_CHECKS
         /* Verify that the slist size and length are as expected. */
@@ -6000,9 +6062,334 @@ H5C_flush_ring(H5F_t *f, hid_t dxpl_id, H5C_ring_t ring,  unsigned flags)
 #endif /* H5C_DO_SANITY_CHECKS */
 
 done:
+    if(stage_writes) {
+        cache_ptr->flush_stage_active = FALSE;
+        if(H5C__write_flush_stage(f, dxpl_id) < 0)
+            HDONE_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write staged entry images")
+    } /* end if */
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_flush_ring() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__start_flush_stage
+ *
+ * Purpose:     Start staging the entry writes of a flush, if the cache
+ *		is set to coalesce flush writes and no other flush is
+ *		staging them already.
+ *
+ *		Writes are not staged on files opened with an MPI driver,
+ *		which order their metadata writes themselves, or on files
+ *		open for SWMR writing, whose entries must reach the file in
+ *		the order the flush dependencies between them dictate.
+ *
+ * Return:      TRUE if the caller started staging, and must write the
+ *		staged images with H5C__write_flush_stage() when done.
+ *		FALSE otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5C__start_flush_stage(H5F_t *f)
+{
+    H5C_t *     cache_ptr = f->shared->cache;
+    hbool_t     ret_value = FALSE;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if(cache_ptr->coalesce_flush_writes && !cache_ptr->flush_stage_active
+            && !(H5F_INTENT(f) & H5F_ACC_SWMR_WRITE)
+#ifdef H5_HAVE_PARALLEL
+            && !H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)
+#endif /* H5_HAVE_PARALLEL */
+            ) {
+        HDassert(0 == cache_ptr->flush_stage_len);
+        cache_ptr->flush_stage_active = TRUE;
+        ret_value = TRUE;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__start_flush_stage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__stage_entry_write
+ *
+ * Purpose:     Copy the image of an entry being flushed into the flush
+ *		staging area of the cache, to be written along with the
+ *		images adjacent to it by H5C__write_flush_stage().
+ *
+ *		The staged images are written first if the new image
+ *		would take the staging area over H5C__FLUSH_STAGE_MAX_SIZE.
+ *		Images at least that large are written immediately.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__stage_entry_write(H5F_t *f, hid_t dxpl_id, H5FD_mem_t mem_type,
+    haddr_t addr, size_t size, const void *image)
+{
+    H5C_t *             cache_ptr = f->shared->cache;
+    H5C_flush_stage_t * stage_ptr;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->flush_stage_active);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(size > 0);
+    HDassert(image);
+
+    /* Make room in the staging buffer */
+    if(cache_ptr->flush_stage_buf_len + size > H5C__FLUSH_STAGE_MAX_SIZE)
+        if(H5C__write_flush_stage(f, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write staged entry images")
+
+    /* Images too large to share the staging buffer are written directly */
+    if(size >= H5C__FLUSH_STAGE_MAX_SIZE) {
+        if(H5F_block_write(f, mem_type, addr, size, dxpl_id, image) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write image to file")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Extend the staging arrays as needed */
+    if(cache_ptr->flush_stage_len >= cache_ptr->flush_stage_alloc) {
+        size_t new_alloc = MAX(2 * cache_ptr->flush_stage_alloc, H5C__FLUSH_STAGE_INIT_LEN);
+        H5C_flush_stage_t *new_stage;
+
+        if(NULL == (new_stage = (H5C_flush_stage_t *)H5MM_realloc(cache_ptr->flush_stage, new_alloc * sizeof(H5C_flush_stage_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for flush staging array")
+        cache_ptr->flush_stage = new_stage;
+        cache_ptr->flush_stage_alloc = new_alloc;
+    } /* end if */
+    if(cache_ptr->flush_stage_buf_len + size > cache_ptr->flush_stage_buf_alloc) {
+        size_t new_alloc = MAX(cache_ptr->flush_stage_buf_alloc, 4096);
+        uint8_t *new_buf;
+
+        while(new_alloc < cache_ptr->flush_stage_buf_len + size)
+            new_alloc *= 2;
+        new_alloc = MIN(new_alloc, H5C__FLUSH_STAGE_MAX_SIZE);
+        if(NULL == (new_buf = (uint8_t *)H5MM_realloc(cache_ptr->flush_stage_buf, new_alloc)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for flush staging buffer")
+        cache_ptr->flush_stage_buf = new_buf;
+        cache_ptr->flush_stage_buf_alloc = new_alloc;
+    } /* end if */
+
+    /* Stage the image */
+    stage_ptr = &cache_ptr->flush_stage[cache_ptr->flush_stage_len];
+    stage_ptr->addr = addr;
+    stage_ptr->size = size;
+    stage_ptr->offset = cache_ptr->flush_stage_buf_len;
+    stage_ptr->mem_type = mem_type;
+    stage_ptr->seq = cache_ptr->flush_stage_len;
+    HDmemcpy(cache_ptr->flush_stage_buf + stage_ptr->offset, image, size);
+
+    cache_ptr->flush_stage_len++;
+    cache_ptr->flush_stage_buf_len += size;
+    cache_ptr->flush_stage_images++;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__stage_entry_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__flush_stage_cmp_addr
+ *
+ * Purpose:     Compare two staged entry images by address, then by the
+ *		order they were staged in, for HDqsort().
+ *
+ * Return:      -1, 0, or 1 as S1 sorts before, with, or after S2.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__flush_stage_cmp_addr(const void *_s1, const void *_s2)
+{
+    const H5C_flush_stage_t *s1 = (const H5C_flush_stage_t *)_s1;
+    const H5C_flush_stage_t *s2 = (const H5C_flush_stage_t *)_s2;
+
+    if(H5F_addr_lt(s1->addr, s2->addr))
+        return -1;
+    if(H5F_addr_gt(s1->addr, s2->addr))
+        return 1;
+    if(s1->seq < s2->seq)
+        return -1;
+    if(s1->seq > s2->seq)
+        return 1;
+    return 0;
+} /* H5C__flush_stage_cmp_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__flush_stage_cmp_seq
+ *
+ * Purpose:     Compare two staged entry images by the order they were
+ *		staged in, for HDqsort().
+ *
+ * Return:      -1, 0, or 1 as S1 sorts before, with, or after S2.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__flush_stage_cmp_seq(const void *_s1, const void *_s2)
+{
+    const H5C_flush_stage_t *s1 = (const H5C_flush_stage_t *)_s1;
+    const H5C_flush_stage_t *s2 = (const H5C_flush_stage_t *)_s2;
+
+    if(s1->seq < s2->seq)
+        return -1;
+    if(s1->seq > s2->seq)
+        return 1;
+    return 0;
+} /* H5C__flush_stage_cmp_seq() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__write_flush_stage
+ *
+ * Purpose:     Write the entry images in the flush staging area of the
+ *		cache to the file, and empty the staging area.
+ *
+ *		The images are sorted by address, and each run of images
+ *		with the same memory type that are adjacent in the file
+ *		is gathered into one buffer.  The runs are then written
+ *		with a single call to H5F_block_write_vector(), so that
+ *		drivers with a vector write callback get them all at
+ *		once.  Global heap runs, which are written as raw data,
+ *		are written with H5F_block_write() instead.
+ *
+ *		If any staged images overlap -- an entry flushed twice, or
+ *		file space freed and reused during the flush -- the images
+ *		are written one at a time in the order they were staged
+ *		instead, so that the last image of each byte wins.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__write_flush_stage(H5F_t *f, hid_t dxpl_id)
+{
+    H5C_t *             cache_ptr = f->shared->cache;
+    H5C_flush_stage_t * stage;
+    uint8_t *           gather_buf = NULL;
+    size_t              gather_len = 0;
+    H5FD_mem_t *        types = NULL;
+    haddr_t *           addrs = NULL;
+    size_t *            sizes = NULL;
+    const void **       bufs = NULL;
+    uint32_t            nruns = 0;
+    size_t              nstaged;
+    size_t              u, v;
+    hbool_t             overlap = FALSE;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    stage = cache_ptr->flush_stage;
+    nstaged = cache_ptr->flush_stage_len;
+    if(0 == nstaged)
+        HGOTO_DONE(SUCCEED)
+
+    HDqsort(stage, nstaged, sizeof(H5C_flush_stage_t), H5C__flush_stage_cmp_addr);
+    for(u = 1; u < nstaged && !overlap; u++)
+        if(H5F_addr_lt(stage[u].addr, stage[u - 1].addr + stage[u - 1].size))
+            overlap = TRUE;
+
+    if(overlap) {
+        HDqsort(stage, nstaged, sizeof(H5C_flush_stage_t), H5C__flush_stage_cmp_seq);
+        for(u = 0; u < nstaged; u++) {
+            if(H5F_block_write(f, stage[u].mem_type, stage[u].addr, stage[u].size, dxpl_id, cache_ptr->flush_stage_buf + stage[u].offset) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write image to file")
+            cache_ptr->flush_stage_writes++;
+        } /* end for */
+    } /* end if */
+    else {
+        /* Allocate the I/O vector, with room for a run per image */
+        if(NULL == (types = (H5FD_mem_t *)H5MM_malloc(nstaged * sizeof(H5FD_mem_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for I/O vector")
+        if(NULL == (addrs = (haddr_t *)H5MM_malloc(nstaged * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for I/O vector")
+        if(NULL == (sizes = (size_t *)H5MM_malloc(nstaged * sizeof(size_t))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for I/O vector")
+        if(NULL == (bufs = (const void **)H5MM_malloc(nstaged * sizeof(void *))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for I/O vector")
+
+        for(u = 0; u < nstaged; u = v) {
+            const uint8_t *run_buf;
+            size_t run_size = stage[u].size;
+
+            /* Find the images adjacent to this one */
+            for(v = u + 1; v < nstaged; v++) {
+                if(stage[v].mem_type != stage[u].mem_type ||
+                        H5F_addr_ne(stage[v].addr, stage[u].addr + run_size))
+                    break;
+                run_size += stage[v].size;
+            } /* end for */
+
+            if(v == u + 1)
+                run_buf = cache_ptr->flush_stage_buf + stage[u].offset;
+            else {
+                size_t w;
+
+                /* Gather the run */
+                if(NULL == gather_buf)
+                    if(NULL == (gather_buf = (uint8_t *)H5MM_malloc(cache_ptr->flush_stage_buf_alloc)))
+                        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for gather buffer")
+                run_buf = gather_buf + gather_len;
+                for(w = u; w < v; w++) {
+                    HDmemcpy(gather_buf + gather_len, cache_ptr->flush_stage_buf + stage[w].offset, stage[w].size);
+                    gather_len += stage[w].size;
+                } /* end for */
+            } /* end else */
+
+            if(H5FD_MEM_GHEAP == stage[u].mem_type) {
+                if(H5F_block_write(f, stage[u].mem_type, stage[u].addr, run_size, dxpl_id, run_buf) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write images to file")
+            } /* end if */
+            else {
+                types[nruns] = stage[u].mem_type;
+                addrs[nruns] = stage[u].addr;
+                sizes[nruns] = run_size;
+                bufs[nruns] = run_buf;
+                nruns++;
+            } /* end else */
+            cache_ptr->flush_stage_writes++;
+        } /* end for */
+
+        /* Write the runs */
+        if(nruns > 0)
+            if(H5F_block_write_vector(f, dxpl_id, nruns, types, addrs, sizes, bufs) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, FAIL, "can't write images to file")
+    } /* end else */
+
+done:
+    /* The staging area is emptied even on failure, so that stale images
+     * are never written later.
+     */
+    cache_ptr->flush_stage_len = 0;
+    cache_ptr->flush_stage_buf_len = 0;
+    gather_buf = (uint8_t *)H5MM_xfree(gather_buf);
+    types = (H5FD_mem_t *)H5MM_xfree(types);
+    addrs = (haddr_t *)H5MM_xfree(addrs);
+    sizes = (size_t *)H5MM_xfree(sizes);
+    bufs = (const void **)H5MM_xfree(bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__write_flush_stage() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -6220,8 +6607,14 @@ H5C__flush_single_entry(H5F_t *f, hid_t dxpl_id, H5C_cache_entry_t *entry_ptr,
             else
                 mem_type = entry_ptr->type->mem_type;
 
-            if(H5F_block_write(f, mem_type, entry_ptr->addr, entry_ptr->size, dxpl_id, entry_ptr->image_ptr) < 0)
+            if(cache_ptr->flush_stage_active) {
+                if(H5C__stage_entry_write(f, dxpl_id, mem_type, entry_ptr->addr, entry_ptr->size, entry_ptr->image_ptr) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't stage image for write")
+            } /* end if */
+            else if(H5F_block_write(f, mem_type, entry_ptr->addr, entry_ptr->size, dxpl_id, entry_ptr->image_ptr) < 0)
                 HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't write image to file")
+
+            H5C__UPDATE_TYPE_STATS_FOR_WRITE(cache_ptr, entry_ptr)
         } /* end if */
 
         /* if the entry has a notify callback, notify it that we have 
@@ -6269,6 +6662,7 @@ H5C__flush_single_entry(H5F_t *f, hid_t dxpl_id, H5C_cache_entry_t *entry_ptr,
 
         /* Update stats, while entry is still in the cache */
         H5C__UPDATE_STATS_FOR_EVICTION(cache_ptr, entry_ptr, take_ownership)
+        H5C__UPDATE_TYPE_STATS_FOR_EVICTION(cache_ptr, entry_ptr)
 
         /* If the entry's type has a 'notify' callback and the entry is about
          * to be removed from the cache, send a 'before eviction' notice while
@@ -6377,6 +6771,14 @@ H5C__flush_single_entry(H5F_t *f, hid_t dxpl_id, H5C_cache_entry_t *entry_ptr,
         else if(entry_ptr->image_ptr != NULL)
             entry_ptr->image_ptr = H5MM_xfree(entry_ptr->image_ptr);
 
+        /* If the entry is a prefetched entry whose image was never 
+         * extracted from the retained cache image, it no longer needs 
+         * that image.
+         */
+        if(entry_ptr->pf_image_pending)
+            if(H5C__release_prefetched_entry_image(cache_ptr, entry_ptr) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTRELEASE, FAIL, "can't release retained cache image")
+
         /* If the entry is not a prefetched entry, verify that the flush 
          * dependency parents addresses array has been transfered.
          *
@@ -6561,6 +6963,123 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__verify_len_eoa() */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__map_entry_image
+ *
+ * Purpose:     Try to use the on disk image of an entry in place, when
+ *              the file driver exposes the file in memory (see
+ *              H5F_block_map()).
+ *
+ *              On entry, *len is the initial load size of the entry.  If
+ *              the image can be mapped, its final size is resolved for
+ *              speculatively loaded entries, its checksum is verified,
+ *              and *mapped_image is set to point to it, with *len set to
+ *              the final size.
+ *
+ *              If a speculatively loaded entry grows past the mapped
+ *              region, the whole image is read into a buffer instead,
+ *              which is returned in *image.  (The final load size
+ *              callback can only be made once, as it may decode parts
+ *              of the entry into the user data.)
+ *
+ *              If the image can't be mapped at all, both *mapped_image
+ *              and *image are NULL and the caller should read it as
+ *              usual.
+ *
+ *              Files are only mapped when they can't be changing under
+ *              the library, so, unlike the read path, a bad checksum is
+ *              not retried.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__map_entry_image(H5F_t *f, hid_t dxpl_id, const H5C_class_t *type,
+    haddr_t addr, size_t *len, void *udata, const void **mapped_image,
+    uint8_t **image)
+{
+    const void *mapped = NULL;          /* Mapped image of the entry */
+    const void *final_image;            /* Image to verify */
+    uint8_t *buf = NULL;                /* Image read into a buffer */
+    size_t map_len = *len;              /* Length of the image */
+    herr_t ret_value = SUCCEED;      	/* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(type);
+    HDassert(0 == (type->flags & (H5C__CLASS_SKIP_READS | H5C__CLASS_MODIFIES_IMAGE_FLAG)));
+    HDassert(len);
+    HDassert(*len > 0);
+    HDassert(mapped_image);
+    HDassert(image);
+
+    *mapped_image = NULL;
+    *image = NULL;
+
+    /* Map the image, if the file allows it */
+    if(H5F_block_map(f, type->mem_type, addr, map_len, &mapped) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't map image")
+    if(NULL == mapped)
+        HGOTO_DONE(SUCCEED)
+
+    /* Resolve the actual length of speculatively loaded entries */
+    if(type->flags & H5C__CLASS_SPECULATIVE_LOAD_FLAG) {
+        size_t actual_len = map_len;    /* The actual length of the entry */
+
+        if(type->get_final_load_size(mapped, map_len, udata, &actual_len) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't retrieve final image size")
+
+        if(actual_len != map_len) {
+            /* Verify that the length isn't past the EOA for the file */
+            if(H5C__verify_len_eoa(f, type, addr, &actual_len, TRUE) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "actual_len exceeds EOA")
+
+            map_len = actual_len;
+            if(H5F_block_map(f, type->mem_type, addr, map_len, &mapped) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "can't map image")
+
+            /* Read the image, if it no longer fits in the mapped region */
+            if(NULL == mapped) {
+                if(NULL == (buf = (uint8_t *)H5MM_malloc(map_len + H5C_IMAGE_EXTRA_SPACE)))
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
+#if H5C_DO_MEMORY_SANITY_CHECKS
+                HDmemcpy(buf + map_len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+                if(H5F_block_read(f, type->mem_type, addr, map_len, dxpl_id, buf) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "Can't read image")
+            } /* end if */
+        } /* end if */
+    } /* end if */
+    final_image = mapped ? mapped : (const void *)buf;
+
+    /* Verify the checksum for the metadata image */
+    if(type->verify_chksum) {
+        htri_t chk_ret;                 /* return from verify_chksum callback */
+
+        if((chk_ret = type->verify_chksum(final_image, map_len, udata)) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "failure from verify_chksum callback")
+        if(chk_ret == FALSE)
+            HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "incorrect metadata checksum")
+    } /* end if */
+
+    /* Set the image */
+    *mapped_image = mapped;
+    *image = buf;
+    buf = NULL;
+    *len = map_len;
+
+done:
+    if(buf)
+        buf = (uint8_t *)H5MM_xfree(buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__map_entry_image() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -6592,9 +7111,12 @@ H5C_load_entry(H5F_t *              f,
 {
     hbool_t     dirty = FALSE;          /* Flag indicating whether thing was dirtied during deserialize */
     uint8_t *   image = NULL;           /* Buffer for disk image                    */
+    const void *mapped_image = NULL;    /* Disk image used in place, if any         */
+    hbool_t     image_loaded;           /* Whether the image was mapped or read     */
     void *      thing = NULL;           /* Pointer to thing loaded                  */
     H5C_cache_entry_t *entry = NULL;    /* Alias for thing loaded, as cache entry   */
     size_t      len;                    /* Size of image in file                    */
+    double      start_time;             /* Time the deserialize callback was made   */
 #ifdef H5_HAVE_PARALLEL
     int         mpi_rank = 0;           /* MPI process rank                         */
     MPI_Comm    comm = MPI_COMM_NULL;   /* File MPI Communicator                    */
@@ -6633,12 +7155,27 @@ H5C_load_entry(H5F_t *              f,
         if(H5C__verify_len_eoa(f, type, addr, &len, FALSE) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid len with respect to EOA")
 
+    /* Entry images staged by a flush in progress must be in the file
+     * before it is read, as this entry may be one of them.
+     */
+    if(f->shared->cache->flush_stage_len > 0)
+        if(H5C__write_flush_stage(f, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_WRITEERROR, NULL, "can't write staged entry images")
+
+    /* Use the on-disk entry image in place, if the file allows it */
+    if(0 == (type->flags & (H5C__CLASS_SKIP_READS | H5C__CLASS_MODIFIES_IMAGE_FLAG)))
+        if(H5C__map_entry_image(f, dxpl_id, type, addr, &len, udata, &mapped_image, &image) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, NULL, "can't map image")
+    image_loaded = (mapped_image != NULL || image != NULL);
+
     /* Allocate the buffer for reading the on-disk entry image */
-    if(NULL == (image = (uint8_t *)H5MM_malloc(len + H5C_IMAGE_EXTRA_SPACE)))
-        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
+    if(!image_loaded) {
+        if(NULL == (image = (uint8_t *)H5MM_malloc(len + H5C_IMAGE_EXTRA_SPACE)))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
 #if H5C_DO_MEMORY_SANITY_CHECKS
-    HDmemcpy(image + len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+        HDmemcpy(image + len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+    } /* end if */
 
 #ifdef H5_HAVE_PARALLEL
     if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI)) {
@@ -6650,7 +7187,7 @@ H5C_load_entry(H5F_t *              f,
 #endif /* H5_HAVE_PARALLEL */
 
     /* Get the on-disk entry image */
-    if(0 == (type->flags & H5C__CLASS_SKIP_READS)) {
+    if(!image_loaded && 0 == (type->flags & H5C__CLASS_SKIP_READS)) {
         unsigned tries, max_tries;      /* The # of read attempts               */
         unsigned retries;               /* The # of retries                     */
         htri_t chk_ret;                 /* return from verify_chksum callback   */
@@ -6787,8 +7324,11 @@ H5C_load_entry(H5F_t *              f,
     } /* end if !H5C__CLASS_SKIP_READS */
 
     /* Deserialize the on-disk image into the native memory form */
-    if(NULL == (thing = type->deserialize(image, len, udata, &dirty)))
+    start_time = H5_get_time();
+    if(NULL == (thing = type->deserialize(mapped_image ? mapped_image : image, len, udata, &dirty)))
         HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, NULL, "Can't deserialize image")
+    H5C__UPDATE_TYPE_STATS_FOR_LOAD(f->shared->cache, type->id, 
+        (type->flags & H5C__CLASS_SKIP_READS) ? 0 : len, H5_get_time() - start_time)
 
     entry = (H5C_cache_entry_t *)thing;
 
@@ -6818,6 +7358,10 @@ H5C_load_entry(H5F_t *              f,
     entry->addr                         = addr;
     entry->size                         = len;
     HDassert(entry->size < H5C_MAX_ENTRY_SIZE);
+    /* A mapped image isn't kept, leaving image_ptr NULL.  That's safe, as
+     * the image is only used to write the entry, once it has been dirtied
+     * and (re)serialized.
+     */
     entry->image_ptr                    = image;
     entry->image_up_to_date             = !dirty;
     entry->type                         = type;
@@ -6846,10 +7390,10 @@ H5C_load_entry(H5F_t *              f,
     entry->flush_dep_nchildren          = 0;
     entry->flush_dep_ndirty_children    = 0;
     entry->flush_dep_nunser_children    = 0;
-    entry->ht_next                      = NULL;
-    entry->ht_prev                      = NULL;
     entry->il_next                      = NULL;
     entry->il_prev             	        = NULL;
+    entry->slist_next                   = NULL;
+    entry->slist_prev                   = NULL;
 
     entry->next                         = NULL;
     entry->prev                         = NULL;
@@ -6874,6 +7418,7 @@ H5C_load_entry(H5F_t *              f,
     entry->prefetched                   = FALSE;
     entry->prefetch_type_id             = 0;
     entry->age                          = 0;
+    entry->pf_image_pending             = FALSE;
 #ifndef NDEBUG  /* debugging field */
     entry->serialization_count          = 0;
 #endif /* NDEBUG */
@@ -7667,20 +8212,15 @@ static hbool_t
 H5C_entry_in_skip_list(H5C_t * cache_ptr, H5C_cache_entry_t *target_ptr)
 {
     hbool_t in_slist              = FALSE;
-    H5SL_node_t *       node_ptr  = NULL;
     H5C_cache_entry_t *	entry_ptr = NULL;
 
     HDassert( cache_ptr );
     HDassert( cache_ptr->magic == H5C__H5C_T_MAGIC );
-    HDassert( cache_ptr->slist_ptr );
 
-    node_ptr = H5SL_first(cache_ptr->slist_ptr);
+    entry_ptr = cache_ptr->slist_head;
 
-    while ( ( node_ptr != NULL ) && ( ! in_slist ) )
+    while ( ( entry_ptr != NULL ) && ( ! in_slist ) )
     {
-        entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
-
-	HDassert( entry_ptr );
 	HDassert( entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC );
         HDassert( entry_ptr->is_dirty );
         HDassert( entry_ptr->in_slist );
@@ -7691,7 +8231,7 @@ H5C_entry_in_skip_list(H5C_t * cache_ptr, H5C_cache_entry_t *target_ptr)
 
 	} else {
 
-	    node_ptr = H5SL_next(node_ptr);
+	    entry_ptr = entry_ptr->slist_next;
 	}
     }
 
@@ -8092,6 +8632,7 @@ H5C__generate_image(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr,
     haddr_t		old_addr = HADDR_UNDEF;
     size_t		new_len = 0;
     unsigned            serialize_flags = H5C__SERIALIZE_NO_FLAGS_SET;
+    double              start_time;
     herr_t              ret_value = SUCCEED;
 
     FUNC_ENTER_PACKAGE
@@ -8217,8 +8758,10 @@ H5C__generate_image(H5F_t *f, H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr,
     } /* end if(serialize_flags != H5C__SERIALIZE_NO_FLAGS_SET) */
 
     /* Serialize object into buffer */
+    start_time = H5_get_time();
     if(entry_ptr->type->serialize(f, entry_ptr->image_ptr, entry_ptr->size, (void *)entry_ptr) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "unable to serialize entry")
+    H5C__UPDATE_TYPE_STATS_FOR_SERIALIZE(cache_ptr, entry_ptr, H5_get_time() - start_time)
 #if H5C_DO_MEMORY_SANITY_CHECKS
     HDassert(0 == HDmemcmp(((uint8_t *)entry_ptr->image_ptr) + entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE));
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
@@ -8294,6 +8837,7 @@ H5C_remove_entry(void *_entry)
 
     /* Update stats, as if we are "destroying" and taking ownership of the entry */
     H5C__UPDATE_STATS_FOR_EVICTION(cache, entry, TRUE)
+    H5C__UPDATE_TYPE_STATS_FOR_EVICTION(cache, entry)
 
     /* If the entry's type has a 'notify' callback, send a 'before eviction'
      * notice while the entry is still fully integrated in the cache.
@@ -8356,3 +8900,162 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__remove_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__resize_index
+ *
+ * Purpose:     Replace the hash table that indexes the entries of the
+ *              cache with one of new_len_slots slots, and re-insert all
+ *              entries currently in the index into it.
+ *
+ *              The entries are found by walking the index list, so this
+ *              function must be called only when the index list and the
+ *              hash table contain the same entries.  It is also used by
+ *              H5C_create() to allocate the initial, empty table.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__resize_index(H5C_t *cache_ptr, size_t new_len_slots)
+{
+    H5C_index_slot_t *new_index;        /* New hash table */
+    H5C_cache_entry_t *entry_ptr;       /* Entry being re-inserted */
+    size_t u, k;                        /* Local index variables */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(POWER_OF_TWO(new_len_slots));
+    HDassert(new_len_slots >= H5C__INDEX_MIN_LEN);
+    HDassert((size_t)cache_ptr->il_len * 4 < new_len_slots * 3);
+
+    /* Allocate and clear the new table */
+    if(NULL == (new_index = (H5C_index_slot_t *)H5MM_malloc(new_len_slots * sizeof(H5C_index_slot_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for cache index")
+    for(u = 0; u < new_len_slots; u++) {
+        new_index[u].addr = HADDR_UNDEF;
+        new_index[u].ent_ptr = NULL;
+    } /* end for */
+
+    /* Switch to the new table */
+    H5MM_xfree(cache_ptr->index);
+    cache_ptr->index = new_index;
+    cache_ptr->index_len_slots = new_len_slots;
+    cache_ptr->index_shift = 64 - H5VM_log2_gen((uint64_t)new_len_slots);
+
+    /* Re-insert the entries */
+    for(entry_ptr = cache_ptr->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next) {
+        k = H5C__HASH_FCN(cache_ptr, entry_ptr->addr);
+        while(new_index[k].ent_ptr != NULL)
+            k = H5C__INDEX_NEXT_SLOT(cache_ptr, k);
+        new_index[k].addr = entry_ptr->addr;
+        new_index[k].ent_ptr = entry_ptr;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__resize_index() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__slist_first
+ *
+ * Purpose:     Return the first entry on the slist, after sorting the
+ *              slist in increasing address order if entries have been
+ *              appended to it out of order since it was last sorted.
+ *
+ *              The sort is a bottom up natural merge sort: each pass
+ *              merges adjacent ascending runs pairwise, so a list that
+ *              is already sorted costs a single pass, and a sorted list
+ *              with a few entries appended costs few more.
+ *
+ * Return:      Pointer to the entry at the lowest address in the slist,
+ *              or NULL if the slist is empty.
+ *
+ *-------------------------------------------------------------------------
+ */
+H5C_cache_entry_t *
+H5C__slist_first(H5C_t *cache_ptr)
+{
+    H5C_cache_entry_t *ret_value = NULL;        /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if(!cache_ptr->slist_sorted) {
+        H5C_cache_entry_t *head = cache_ptr->slist_head; /* Head of list being sorted */
+        H5C_cache_entry_t *prev_ptr;    /* Previous entry, when linking back */
+        H5C_cache_entry_t *entry_ptr;   /* Current entry */
+        unsigned nruns;                 /* # of runs found in a pass */
+
+        do {
+            H5C_cache_entry_t *merged = NULL;           /* Head of the merged list */
+            H5C_cache_entry_t **tail_pp = &merged;      /* Where to link the next entry */
+            H5C_cache_entry_t *a, *b;                   /* Heads of the runs to merge */
+
+            nruns = 0;
+            entry_ptr = head;
+            while(entry_ptr != NULL) {
+                /* Detach the next run */
+                a = entry_ptr;
+                while(entry_ptr->slist_next && H5F_addr_lt(entry_ptr->addr, entry_ptr->slist_next->addr))
+                    entry_ptr = entry_ptr->slist_next;
+                b = entry_ptr->slist_next;
+                entry_ptr->slist_next = NULL;
+                nruns++;
+
+                /* Detach the run after it, if there is one */
+                if(b != NULL) {
+                    entry_ptr = b;
+                    while(entry_ptr->slist_next && H5F_addr_lt(entry_ptr->addr, entry_ptr->slist_next->addr))
+                        entry_ptr = entry_ptr->slist_next;
+                    prev_ptr = entry_ptr->slist_next;
+                    entry_ptr->slist_next = NULL;
+                    entry_ptr = prev_ptr;
+                    nruns++;
+                } /* end if */
+                else
+                    entry_ptr = NULL;
+
+                /* Merge the two runs onto the end of the merged list */
+                while(a != NULL && b != NULL) {
+                    if(H5F_addr_lt(a->addr, b->addr)) {
+                        *tail_pp = a;
+                        a = a->slist_next;
+                    } /* end if */
+                    else {
+                        *tail_pp = b;
+                        b = b->slist_next;
+                    } /* end else */
+                    tail_pp = &((*tail_pp)->slist_next);
+                } /* end while */
+                *tail_pp = (a != NULL) ? a : b;
+                while(*tail_pp != NULL)
+                    tail_pp = &((*tail_pp)->slist_next);
+            } /* end while */
+
+            head = merged;
+        } while(nruns > 1);
+
+        /* Restore the prev pointers and the tail */
+        prev_ptr = NULL;
+        for(entry_ptr = head; entry_ptr != NULL; entry_ptr = entry_ptr->slist_next) {
+            entry_ptr->slist_prev = prev_ptr;
+            prev_ptr = entry_ptr;
+        } /* end for */
+        cache_ptr->slist_head = head;
+        cache_ptr->slist_tail = prev_ptr;
+        cache_ptr->slist_sorted = TRUE;
+    } /* end if */
+
+    ret_value = cache_ptr->slist_head;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__slist_first() */
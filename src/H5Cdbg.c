@@ -107,21 +107,18 @@ H5C_dump_cache(H5C_t * cache_ptr, const char *  cache_name)
     if(NULL == (slist_ptr = H5SL_create(H5SL_TYPE_HADDR, NULL)))
         HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "can't create skip list")
 
-    /* Next, scan the index, and insert all entries in the skip list.
+    /* Next, scan the index list, and insert all entries in the skip list.
      * Do this, as we want to display cache entries in increasing address
      * order.
      */
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        entry_ptr = cache_ptr->index[i];
-
-        while(entry_ptr != NULL) {
-            HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
-            if(H5SL_insert(slist_ptr, entry_ptr, &(entry_ptr->addr)) < 0)
-                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "can't insert entry in skip list")
+    entry_ptr = cache_ptr->il_head;
+    while(entry_ptr != NULL) {
+        HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+        if(H5SL_insert(slist_ptr, entry_ptr, &(entry_ptr->addr)) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "can't insert entry in skip list")
 
-            entry_ptr = entry_ptr->ht_next;
-        } /* end while */
-    } /* end for */
+        entry_ptr = entry_ptr->il_next;
+    } /* end while */
 
     /* If we get this far, all entries in the cache are listed in the
      * skip list -- scan the skip list generating the desired output.
@@ -202,7 +199,6 @@ H5C_dump_cache_skip_list(H5C_t * cache_ptr, char * calling_fcn)
     herr_t              ret_value = SUCCEED;   /* Return value */
     int                 i;
     H5C_cache_entry_t * entry_ptr = NULL;
-    H5SL_node_t *       node_ptr = NULL;
 
     FUNC_ENTER_NOAPI(FAIL)
 
@@ -222,11 +218,7 @@ H5C_dump_cache_skip_list(H5C_t * cache_ptr, char * calling_fcn)
                   "Num:    Addr:               Len: Prot/Pind: Dirty: Type:\n");
 
         i = 0;
-        node_ptr = H5SL_first(cache_ptr->slist_ptr);
-        if(node_ptr != NULL)
-            entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
-        else
-            entry_ptr = NULL;
+        entry_ptr = H5C__slist_first(cache_ptr);
 
         while(entry_ptr != NULL) {
             HDassert( entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC );
@@ -241,16 +233,7 @@ H5C_dump_cache_skip_list(H5C_t * cache_ptr, char * calling_fcn)
                (int)(entry_ptr->is_dirty),
                entry_ptr->type->name);
 
-            HDfprintf(stdout, "		node_ptr = 0x%llx, item = %p\n",
-                      (unsigned long long)node_ptr,
-                      H5SL_item(node_ptr));
-
-            /* increment node_ptr before we delete its target */
-            node_ptr = H5SL_next(node_ptr);
-            if(node_ptr != NULL)
-                entry_ptr = (H5C_cache_entry_t *)H5SL_item(node_ptr);
-            else
-                entry_ptr = NULL;
+            entry_ptr = entry_ptr->slist_next;
 
             i++;
         } /* end while */
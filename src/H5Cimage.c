@@ -49,6 +49,15 @@
 #include "H5MFprivate.h"	/* File memory management		*/
 #include "H5MMprivate.h"	/* Memory management			*/
 
+#ifdef H5_HAVE_FILTER_DEFLATE
+#if defined(H5_HAVE_ZLIB_H) && !defined(H5_ZLIB_HEADER)
+# define H5_ZLIB_HEADER "zlib.h"
+#endif
+#if defined(H5_ZLIB_HEADER)
+# include H5_ZLIB_HEADER /* "zlib.h" */
+#endif
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
 
 /****************/
 /* Local Macros */
@@ -64,6 +73,29 @@
 #define H5C__MDCI_BLOCK_SIGNATURE	"MDCI"
 #define H5C__MDCI_BLOCK_SIGNATURE_LEN	4
 #define H5C__MDCI_BLOCK_VERSION_0	0
+#define H5C__MDCI_BLOCK_VERSION_1	1
+
+/* Version 1 cache images store the entry images apart from the entry
+ * descriptors, packed in image order into blocks of at most this many
+ * bytes (an entry image larger than this gets a block of its own).  Each
+ * block is compressed independently, so that the image of a single entry 
+ * can be recovered without decoding the rest of the cache image.
+ *
+ * The layout of a version 1 cache image is:
+ *
+ *	header | block directory | entry descriptors | blocks | checksum
+ *
+ * where the block directory holds the decompressed and stored length of
+ * each block, as 32-bit values.  A block whose stored length equals its
+ * decompressed length is stored uncompressed.
+ */
+#define H5C__MDCI_IMAGE_BLOCK_SIZE	(64 * 1024)
+#define H5C__MDCI_BLOCK_DIR_ENTRY_SIZE	8
+
+/* Compression level for cache image blocks -- favor speed, since the
+ * image is generated on file close.
+ */
+#define H5C__MDCI_DEFLATE_LEVEL		1
 
 /* Metadata cache image header flags -- max 8 bits */
 #define H5C__MDCI_HEADER_HAVE_RESIZE_STATUS	0x01
@@ -97,9 +129,12 @@
 
 /* Helper routines */
 static size_t H5C__cache_image_block_entry_header_size(const H5F_t *f);
-static size_t H5C__cache_image_block_header_size(const H5F_t *f);
+static size_t H5C__cache_image_block_header_size(const H5F_t *f,
+    unsigned version);
 static herr_t H5C__decode_cache_image_header(const H5F_t *f,
-    H5C_t *cache_ptr, const uint8_t **buf);
+    H5C_t *cache_ptr, const uint8_t **buf, unsigned *version);
+static herr_t H5C__decode_cache_image_block(const uint8_t *stored,
+    size_t stored_len, uint8_t *raw, size_t raw_len);
 #ifndef NDEBUG	/* only used in assertions */
 static herr_t H5C__decode_cache_image_entry(const H5F_t *f,
     const H5C_t *cache_ptr, const uint8_t **buf, unsigned entry_num);
@@ -107,9 +142,15 @@ static herr_t H5C__decode_cache_image_entry(const H5F_t *f,
 static herr_t H5C__destroy_pf_entry_child_flush_deps(H5C_t *cache_ptr, 
     H5C_cache_entry_t *pf_entry_ptr, H5C_cache_entry_t **fd_children);
 static herr_t H5C__encode_cache_image_header(const H5F_t *f,
-    const H5C_t *cache_ptr, uint8_t **buf);
+    const H5C_t *cache_ptr, unsigned version, uint32_t num_blocks,
+    uint8_t **buf);
 static herr_t H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, 
     uint8_t **buf, unsigned entry_num);
+static size_t H5C__encode_cache_image_block(const uint8_t *raw,
+    size_t raw_len, uint8_t *buf);
+static int H5C__prefetched_entry_cmp(const void *_entry1, const void *_entry2);
+static herr_t H5C__load_prefetched_entry_images(H5C_t *cache_ptr,
+    hbool_t dirty_only);
 static herr_t H5C__prep_for_file_close__compute_fd_heights(const H5C_t *cache_ptr);
 static void H5C__prep_for_file_close__compute_fd_heights_real(
     H5C_cache_entry_t  *entry_ptr, uint32_t fd_height);
@@ -119,7 +160,7 @@ static herr_t H5C__prep_for_file_close__scan_entries(const H5F_t *f,
 static herr_t H5C__reconstruct_cache_contents(H5F_t *f, hid_t dxpl_id, 
     H5C_t *cache_ptr);
 static H5C_cache_entry_t *H5C__reconstruct_cache_entry(const H5F_t *f,
-    H5C_t *cache_ptr, const uint8_t **buf);
+    H5C_t *cache_ptr, const uint8_t **buf, hbool_t image_inline);
 static herr_t H5C__serialize_cache(H5F_t *f, hid_t dxpl_id);
 static herr_t H5C__serialize_ring(H5F_t *f, hid_t dxpl_id, 
     H5C_ring_t ring);
@@ -199,11 +240,24 @@ H5C_cache_image_status(H5F_t * f, hbool_t *load_ci_ptr, hbool_t *write_ci_ptr)
 /*-------------------------------------------------------------------------
  * Function:    H5C__construct_cache_image_buffer()
  *
- * Purpose:     Allocate a buffer of size cache_ptr->image_len, and 
- *		load it with an image of the metadata cache image block.
- *
- *		Note that by the time this function is called, the cache
- *		should have removed all entries from its data structures.
+ * Purpose:     Allocate a buffer large enough for the metadata cache
+ *		image block, and load it with an image of the entries in
+ *		cache_ptr->image_entries.
+ *
+ *		By default, a version 0 image is constructed, with each
+ *		entry image stored right after the entry descriptor.  If
+ *		compression of the image was requested, and the library
+ *		is built with the deflate filter, a version 1 image is 
+ *		constructed instead: the entry images are packed into 
+ *		blocks of up to H5C__MDCI_IMAGE_BLOCK_SIZE bytes, and each
+ *		block is compressed if that makes it smaller.  On return,
+ *		cache_ptr->image_data_len is set to the actual length of
+ *		the image.
+ *
+ *		Note that this function is called before the cache is 
+ *		flushed on file close, so that file space can be allocated
+ *		for the image once its length is known.  The images of all
+ *		entries in the cache image must be up to date.
  *
  * Return:      SUCCEED on success, and FAIL on failure.
  *
@@ -215,9 +269,16 @@ H5C_cache_image_status(H5F_t * f, hbool_t *load_ci_ptr, hbool_t *write_ci_ptr)
 static herr_t
 H5C__construct_cache_image_buffer(H5F_t * f, H5C_t *cache_ptr)
 {
+    H5C_image_block_t * blocks = NULL;  /* Description of each block */
+    uint32_t    num_blocks = 0;         /* Number of entry image blocks */
+    uint8_t *   block_buf = NULL;       /* Buffer to assemble blocks in */
+    size_t      max_block_len = 0;      /* Size of the largest block */
+    size_t      header_len;             /* Size of header & block directory */
+    size_t      buf_len;                /* Size of the image buffer */
+    unsigned    version = H5C__MDCI_BLOCK_VERSION_0; /* Version of the image */
     uint8_t *	p;                      /* Pointer into image buffer */
     uint32_t    chksum;
-    unsigned	u;                      /* Local index variable */
+    unsigned	u, v;                   /* Local index variables */
     herr_t 	ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_STATIC
@@ -231,57 +292,161 @@ H5C__construct_cache_image_buffer(H5F_t * f, H5C_t *cache_ptr)
     HDassert(cache_ptr->close_warning_received);
     HDassert(cache_ptr->image_ctl.generate_image);
     HDassert(cache_ptr->num_entries_in_image > 0);
-    HDassert(cache_ptr->index_len == 0);
+    HDassert(cache_ptr->image_entries);
     HDassert(cache_ptr->image_data_len > 0);
-    HDassert(cache_ptr->image_data_len <= cache_ptr->image_len);
+    HDassert(cache_ptr->image_buffer == NULL);
 
-    /* Allocate the buffer in which to construct the cache image block */
-    if(NULL == (cache_ptr->image_buffer = H5MM_malloc(cache_ptr->image_len + 1)))
-	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
+#ifdef H5_HAVE_FILTER_DEFLATE
+    /* Only write a version 1 image if compression was requested -- and
+     * can be done, as version 1 images can't be read by older versions
+     * of the library.
+     */
+    if(cache_ptr->image_ctl.compress_image)
+        version = H5C__MDCI_BLOCK_VERSION_1;
+#endif /* H5_HAVE_FILTER_DEFLATE */
 
-    /* Construct the cache image block header image */
-    p = (uint8_t *)cache_ptr->image_buffer;
-    if(H5C__encode_cache_image_header(f, cache_ptr, &p) < 0)
-        HGOTO_ERROR(H5E_CACHE, H5E_CANTENCODE, FAIL, "header image construction failed")
-    HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) < cache_ptr->image_data_len);
+    /* Partition the entry images of a version 1 image into blocks.  
+     * Images are packed in image order, and a new block is started 
+     * whenever the next image would overflow the current block.
+     */
+    if(version >= H5C__MDCI_BLOCK_VERSION_1) {
+        if(NULL == (blocks = (H5C_image_block_t *)H5MM_malloc(sizeof(H5C_image_block_t) * (size_t)cache_ptr->num_entries_in_image)))
+	    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image block array")
+        for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
+            size_t size = (size_t)(cache_ptr->image_entries)[u].size;
+
+            HDassert(size > 0 && size < H5C_MAX_ENTRY_SIZE);
+            if(num_blocks == 0 || blocks[num_blocks - 1].raw_len + size > H5C__MDCI_IMAGE_BLOCK_SIZE) {
+                blocks[num_blocks].offset = 0;
+                blocks[num_blocks].raw_len = 0;
+                blocks[num_blocks].stored_len = 0;
+                blocks[num_blocks].image = NULL;
+                blocks[num_blocks].pending = 0;
+                num_blocks++;
+            } /* end if */
+            blocks[num_blocks - 1].raw_len += size;
+        } /* end for */
+        for(v = 0; v < num_blocks; v++)
+            if(blocks[v].raw_len > max_block_len)
+                max_block_len = blocks[v].raw_len;
+
+        if(NULL == (block_buf = (uint8_t *)H5MM_malloc(max_block_len)))
+	    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image block buffer")
+    } /* end if */
+
+    /* Allocate the buffer in which to construct the cache image block.
+     * The length computed when the cache was scanned is that of a 
+     * version 0 image.  Stored blocks are never larger than the images 
+     * they contain, so that length, plus the larger header and the block
+     * directory of a version 1 image, bounds the length of the image.
+     */
+    header_len = H5C__cache_image_block_header_size(f, version) + 
+            (size_t)num_blocks * H5C__MDCI_BLOCK_DIR_ENTRY_SIZE;
+    buf_len = (size_t)cache_ptr->image_data_len + 
+            (header_len - H5C__cache_image_block_header_size(f, H5C__MDCI_BLOCK_VERSION_0));
+    if(NULL == (cache_ptr->image_buffer = H5MM_malloc(buf_len + 1)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image buffer")
 
-    /* Construct the cache entry images */
-    for(u = 0; u < cache_ptr->num_entries_in_image; u++)
+    /* Construct the entry descriptors -- each followed by the entry 
+     * image in a version 0 image.  The header and the block directory 
+     * in front of them are constructed last, once the stored length of
+     * each block is known.
+     */
+    p = (uint8_t *)cache_ptr->image_buffer + header_len;
+    for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
 	if(H5C__encode_cache_image_entry(f, cache_ptr, &p, u) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_CANTENCODE, FAIL, "entry image construction failed")
-    HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) < cache_ptr->image_data_len);
+
+        if(version == H5C__MDCI_BLOCK_VERSION_0) {
+            const H5C_image_entry_t *ie_ptr = &((cache_ptr->image_entries)[u]);
+
+            HDassert(ie_ptr->image_ptr);
+            HDmemcpy(p, ie_ptr->image_ptr, (size_t)ie_ptr->size);
+            p += ie_ptr->size;
+        } /* end if */
+    } /* end for */
+
+    /* Assemble, compress, and append the blocks of entry images of a 
+     * version 1 image.
+     */
+    if(version >= H5C__MDCI_BLOCK_VERSION_1) {
+        u = 0;
+        for(v = 0; v < num_blocks; v++) {
+            size_t raw_len = 0;
+
+            while(raw_len < blocks[v].raw_len) {
+                const H5C_image_entry_t *ie_ptr = &((cache_ptr->image_entries)[u++]);
+
+                HDassert(ie_ptr->image_ptr);
+                HDmemcpy(block_buf + raw_len, ie_ptr->image_ptr, (size_t)ie_ptr->size);
+                raw_len += (size_t)ie_ptr->size;
+            } /* end while */
+            HDassert(raw_len == blocks[v].raw_len);
+
+            blocks[v].offset = (size_t)(p - (uint8_t *)cache_ptr->image_buffer);
+            blocks[v].stored_len = H5C__encode_cache_image_block(block_buf, raw_len, p);
+            HDassert(blocks[v].stored_len <= blocks[v].raw_len);
+            p += blocks[v].stored_len;
+        } /* end for */
+        HDassert(u == cache_ptr->num_entries_in_image);
+    } /* end if */
+
+    /* Set the actual length of the image */
+    cache_ptr->image_data_len = (hsize_t)((size_t)(p - (uint8_t *)cache_ptr->image_buffer) + H5F_SIZEOF_CHKSUM);
+    HDassert(cache_ptr->image_data_len <= buf_len);
+
+    /* Construct the cache image block header image and block directory */
+    p = (uint8_t *)cache_ptr->image_buffer;
+    if(H5C__encode_cache_image_header(f, cache_ptr, version, num_blocks, &p) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTENCODE, FAIL, "header image construction failed")
+    for(v = 0; v < num_blocks; v++) {
+        UINT32ENCODE(p, blocks[v].raw_len);
+        UINT32ENCODE(p, blocks[v].stored_len);
+    } /* end for */
+    HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) == header_len);
 
     /* Construct the adaptive resize status image -- not yet */
 
     /* Compute the checksum and encode */
+    p = (uint8_t *)cache_ptr->image_buffer + (cache_ptr->image_data_len - H5F_SIZEOF_CHKSUM);
     chksum = H5_checksum_metadata(cache_ptr->image_buffer, (size_t)(cache_ptr->image_data_len - H5F_SIZEOF_CHKSUM), 0);
     UINT32ENCODE(p, chksum);
     HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) == cache_ptr->image_data_len);
-    HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) <= cache_ptr->image_len);
 
 #ifndef NDEBUG
     /* validate the metadata cache image we just constructed by decoding it
      * and comparing the result with the original data.
      */
     {
-        uint32_t        old_chksum;
         const uint8_t *	q;
         H5C_t *	        fake_cache_ptr = NULL;
-        unsigned        v;
+        unsigned        decoded_version;
+        size_t          block_off = 0;
         herr_t          status;      /* Status from decoding */
 
 	fake_cache_ptr = (H5C_t *)H5MM_malloc(sizeof(H5C_t));
         HDassert(fake_cache_ptr);
         fake_cache_ptr->magic = H5C__H5C_T_MAGIC;
+        fake_cache_ptr->pf_num_blocks = 0;
 
 	/* needed for sanity checks */
-	fake_cache_ptr->image_len = cache_ptr->image_len;
+	fake_cache_ptr->image_len = cache_ptr->image_data_len;
         q = (const uint8_t *)cache_ptr->image_buffer;
-        status = H5C__decode_cache_image_header(f, fake_cache_ptr, &q);
+        status = H5C__decode_cache_image_header(f, fake_cache_ptr, &q, &decoded_version);
         HDassert(status >= 0);
+        HDassert(decoded_version == version);
 
-        HDassert(NULL != p);
         HDassert(fake_cache_ptr->num_entries_in_image == cache_ptr->num_entries_in_image);
+        HDassert(fake_cache_ptr->pf_num_blocks == num_blocks);
+
+        for(v = 0; v < num_blocks; v++) {
+            uint32_t raw_len, stored_len;
+
+            UINT32DECODE(q, raw_len);
+            UINT32DECODE(q, stored_len);
+            HDassert(raw_len == blocks[v].raw_len);
+            HDassert(stored_len == blocks[v].stored_len);
+        } /* end for */
 
 	fake_cache_ptr->image_entries = (H5C_image_entry_t *)H5MM_malloc(sizeof(H5C_image_entry_t) *
                 (size_t)(fake_cache_ptr->num_entries_in_image + 1));
@@ -324,21 +489,45 @@ H5C__construct_cache_image_buffer(H5F_t * f, H5C_t *cache_ptr)
             else 
 		HDassert((fake_cache_ptr->image_entries)[u].fd_parent_count == 0);
 
-	    HDassert((cache_ptr->image_entries)[u].image_ptr);
-            HDassert((fake_cache_ptr->image_entries)[u].image_ptr);
-            HDassert(!HDmemcmp((cache_ptr->image_entries)[u].image_ptr,
-                               (fake_cache_ptr->image_entries)[u].image_ptr,
-                               (cache_ptr->image_entries)[u].size));
-
-	    (fake_cache_ptr->image_entries)[u].image_ptr = H5MM_xfree((fake_cache_ptr->image_entries)[u].image_ptr);
+            /* compare the image of a version 0 image entry */
+            if(version == H5C__MDCI_BLOCK_VERSION_0) {
+	        HDassert((cache_ptr->image_entries)[u].image_ptr);
+                HDassert(!HDmemcmp((cache_ptr->image_entries)[u].image_ptr, q,
+                                   (size_t)(cache_ptr->image_entries)[u].size));
+                q += (cache_ptr->image_entries)[u].size;
+            } /* end if */
 	} /* end for */
 
+        /* Decode each block of a version 1 image, and compare it with 
+         * the images of the entries it contains.
+         */
+        if(version >= H5C__MDCI_BLOCK_VERSION_1) {
+            HDassert((size_t)(q - (const uint8_t *)cache_ptr->image_buffer) == blocks[0].offset);
+            u = 0;
+            for(v = 0; v < num_blocks; v++) {
+                HDassert(blocks[v].offset == (size_t)(q - (const uint8_t *)cache_ptr->image_buffer));
+                status = H5C__decode_cache_image_block(q, blocks[v].stored_len, block_buf, blocks[v].raw_len);
+                HDassert(status >= 0);
+                q += blocks[v].stored_len;
+
+                block_off = 0;
+                while(block_off < blocks[v].raw_len) {
+	            HDassert((cache_ptr->image_entries)[u].image_ptr);
+                    HDassert(!HDmemcmp((cache_ptr->image_entries)[u].image_ptr,
+                                       block_buf + block_off,
+                                       (size_t)(cache_ptr->image_entries)[u].size));
+                    block_off += (size_t)(cache_ptr->image_entries)[u].size;
+                    u++;
+                } /* end while */
+                HDassert(block_off == blocks[v].raw_len);
+            } /* end for */
+            HDassert(u == cache_ptr->num_entries_in_image);
+        } /* end if */
+
         HDassert((size_t)(q - (const uint8_t *)cache_ptr->image_buffer) == cache_ptr->image_data_len - H5F_SIZEOF_CHKSUM);
 
-        /* compute the checksum  */
-        old_chksum = chksum;
-        chksum = H5_checksum_metadata(cache_ptr->image_buffer, (size_t)(cache_ptr->image_data_len - H5F_SIZEOF_CHKSUM), 0);
-	HDassert(chksum == old_chksum);
+        /* verify the checksum */
+	HDassert(chksum == H5_checksum_metadata(cache_ptr->image_buffer, (size_t)(cache_ptr->image_data_len - H5F_SIZEOF_CHKSUM), 0));
 
 	fake_cache_ptr->image_entries = (H5C_image_entry_t *)H5MM_xfree(fake_cache_ptr->image_entries);
 	fake_cache_ptr = (H5C_t *)H5MM_xfree(fake_cache_ptr);
@@ -346,6 +535,13 @@ H5C__construct_cache_image_buffer(H5F_t * f, H5C_t *cache_ptr)
 #endif /* NDEBUG */
 
 done:
+    if(blocks)
+        blocks = (H5C_image_block_t *)H5MM_xfree(blocks);
+    if(block_buf)
+        block_buf = (uint8_t *)H5MM_xfree(block_buf);
+    if(ret_value < 0 && cache_ptr->image_buffer)
+        cache_ptr->image_buffer = H5MM_xfree(cache_ptr->image_buffer);
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__construct_cache_image_buffer() */
 
@@ -353,8 +549,9 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5C__generate_cache_image()
  *
- * Purpose:	Generate the cache image and write it to the file, if
- *		directed.
+ * Purpose:	Write the cache image constructed by 
+ *		H5C__prep_image_for_file_close() to the file, if directed,
+ *		and discard it.
  *
  * Return:      SUCCEED on success, and FAIL on failure.
  *
@@ -376,10 +573,7 @@ H5C__generate_cache_image(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr)
     HDassert(cache_ptr == f->shared->cache);
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-
-    /* Construct cache image */
-    if(H5C__construct_cache_image_buffer(f, cache_ptr) < 0)
-        HGOTO_ERROR(H5E_CACHE, H5E_CANTFLUSH, FAIL, "Can't create metadata cache image")
+    HDassert(cache_ptr->image_buffer);
 
     /* Free image entries array */
     if(H5C__free_image_entries_array(cache_ptr) < 0)
@@ -447,6 +641,7 @@ H5C__deserialize_prefetched_entry(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr,
                                          * dirtied during deserialize 
                                          */
     size_t              len;            /* Size of image in file */
+    double              start_time;     /* Time deserialize callback was made */
     void *		thing = NULL;   /* Pointer to thing loaded */
     H5C_cache_entry_t * pf_entry_ptr;   /* pointer to the prefetched entry   */
                                         /* supplied in *entry_ptr_ptr.       */
@@ -479,7 +674,7 @@ H5C__deserialize_prefetched_entry(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr,
     HDassert(pf_entry_ptr->type->id == H5AC_PREFETCHED_ENTRY_ID);
     HDassert(pf_entry_ptr->prefetched);
     HDassert(pf_entry_ptr->image_up_to_date);
-    HDassert(pf_entry_ptr->image_ptr);
+    HDassert(pf_entry_ptr->image_ptr || pf_entry_ptr->pf_image_pending);
     HDassert(pf_entry_ptr->size > 0);
     HDassert(pf_entry_ptr->addr == addr);
     HDassert(type);
@@ -544,11 +739,21 @@ H5C__deserialize_prefetched_entry(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr,
      */
     len = pf_entry_ptr->size;
 
+    /* Extract the image of the entry from the retained cache image, if
+     * that hasn't been done yet.
+     */
+    if(pf_entry_ptr->pf_image_pending)
+        if(H5C__load_prefetched_entry_image(cache_ptr, pf_entry_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "can't load prefetched entry image")
+    HDassert(pf_entry_ptr->image_ptr);
+
     /* Deserialize the prefetched on-disk image of the entry into the 
      * native memory form 
      */
+    start_time = H5_get_time();
     if(NULL == (thing = type->deserialize(pf_entry_ptr->image_ptr, len, udata, &dirty)))
         HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "Can't deserialize image")
+    H5C__UPDATE_TYPE_STATS_FOR_LOAD(cache_ptr, type->id, 0, H5_get_time() - start_time)
 
     ds_entry_ptr = (H5C_cache_entry_t *)thing;
 
@@ -616,10 +821,10 @@ H5C__deserialize_prefetched_entry(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr,
     ds_entry_ptr->flush_dep_nunser_children 	= 0;
 
     /* Initialize fields supporting the hash table: */
-    ds_entry_ptr->ht_next                   	= NULL;
-    ds_entry_ptr->ht_prev                   	= NULL;
     ds_entry_ptr->il_next                   	= NULL;
     ds_entry_ptr->il_prev                   	= NULL;
+    ds_entry_ptr->slist_next                	= NULL;
+    ds_entry_ptr->slist_prev                	= NULL;
 
     /* Initialize fields supporting replacement policies: */
     ds_entry_ptr->next                      	= NULL;
@@ -643,6 +848,7 @@ H5C__deserialize_prefetched_entry(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr,
     ds_entry_ptr->prefetched	            	= FALSE;
     ds_entry_ptr->prefetch_type_id          	= 0;
     ds_entry_ptr->age		          	= 0;
+    ds_entry_ptr->pf_image_pending          	= FALSE;
 
     H5C__RESET_CACHE_ENTRY_STATS(ds_entry_ptr);
 
@@ -1084,6 +1290,168 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__load_cache_image() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__load_prefetched_entry_image
+ *
+ * Purpose:     Extract the image of a prefetched entry loaded from a 
+ *		version 1 cache image from its retained cache image block,
+ *		and attach it to the entry.
+ *
+ *		The block containing the image is decompressed into 
+ *		cache_ptr->pf_block_buf, unless it is already there or is
+ *		stored uncompressed.  Once the last pending image in the
+ *		block has been extracted, the block is discarded.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__load_prefetched_entry_image(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr)
+{
+    const H5C_image_block_t *block;     /* Block containing the image */
+    const uint8_t *     block_ptr;      /* Decompressed block */
+    void *              image_ptr = NULL; /* Image of the entry */
+    herr_t		ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->pf_blocks);
+    HDassert(cache_ptr->pf_pending > 0);
+    HDassert(entry_ptr);
+    HDassert(entry_ptr->prefetched);
+    HDassert(entry_ptr->pf_image_pending);
+    HDassert(entry_ptr->image_ptr == NULL);
+    HDassert(entry_ptr->pf_block < cache_ptr->pf_num_blocks);
+
+    block = &(cache_ptr->pf_blocks[entry_ptr->pf_block]);
+    HDassert(block->image);
+    HDassert(block->pending > 0);
+    HDassert(entry_ptr->pf_block_offset + entry_ptr->size <= block->raw_len);
+
+    /* Locate the decompressed block */
+    if(block->stored_len == block->raw_len)
+        block_ptr = block->image;
+    else {
+        if(cache_ptr->pf_block_loaded != (int64_t)entry_ptr->pf_block) {
+            HDassert(cache_ptr->pf_block_buf);
+
+            cache_ptr->pf_block_loaded = -1;
+            if(H5C__decode_cache_image_block(block->image, block->stored_len, cache_ptr->pf_block_buf, block->raw_len) < 0)
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "can't decode cache image block")
+            cache_ptr->pf_block_loaded = (int64_t)entry_ptr->pf_block;
+        } /* end if */
+        block_ptr = cache_ptr->pf_block_buf;
+    } /* end else */
+
+    /* Allocate buffer for entry image */
+    if(NULL == (image_ptr = H5MM_malloc(entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
+#if H5C_DO_MEMORY_SANITY_CHECKS
+    HDmemcpy(((uint8_t *)image_ptr) + entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+
+    /* Copy the entry image from the block */
+    HDmemcpy(image_ptr, block_ptr + entry_ptr->pf_block_offset, entry_ptr->size);
+    entry_ptr->image_ptr = image_ptr;
+    image_ptr = NULL;
+
+    /* The entry no longer needs the retained cache image block */
+    if(H5C__release_prefetched_entry_image(cache_ptr, entry_ptr) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTRELEASE, FAIL, "can't release retained cache image")
+
+done:
+    if(image_ptr)
+        image_ptr = H5MM_xfree(image_ptr);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__load_prefetched_entry_image() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__release_prefetched_entry_image
+ *
+ * Purpose:     Note that a prefetched entry no longer needs its image 
+ *		from the retained cache image block -- either because the
+ *		image has been extracted, or because the entry is being 
+ *		evicted.  Discard the block when no other prefetched entry
+ *		needs it, and the rest of the retained cache image once no
+ *		prefetched entry at all is waiting for its image.
+ *
+ * Return:      SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__release_prefetched_entry_image(H5C_t *cache_ptr, H5C_cache_entry_t *entry_ptr)
+{
+    H5C_image_block_t *block;           /* Block containing the image */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->pf_pending > 0);
+    HDassert(entry_ptr);
+    HDassert(entry_ptr->pf_image_pending);
+    HDassert(entry_ptr->pf_block < cache_ptr->pf_num_blocks);
+
+    block = &(cache_ptr->pf_blocks[entry_ptr->pf_block]);
+    HDassert(block->pending > 0);
+
+    if(--block->pending == 0) {
+        block->image = (uint8_t *)H5MM_xfree(block->image);
+        if(cache_ptr->pf_block_loaded == (int64_t)entry_ptr->pf_block)
+            cache_ptr->pf_block_loaded = -1;
+    } /* end if */
+
+    entry_ptr->pf_image_pending = FALSE;
+    cache_ptr->pf_pending--;
+
+    if(cache_ptr->pf_pending == 0)
+        H5C__discard_cache_image(cache_ptr);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__release_prefetched_entry_image() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__discard_cache_image
+ *
+ * Purpose:     Free the retained cache image and the buffers used to 
+ *		extract entry images from it, if they exist.
+ *
+ * Return:      SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__discard_cache_image(H5C_t *cache_ptr)
+{
+    unsigned u;                         /* Local index variable */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    if(cache_ptr->pf_blocks)
+        for(u = 0; u < cache_ptr->pf_num_blocks; u++)
+            cache_ptr->pf_blocks[u].image = (uint8_t *)H5MM_xfree(cache_ptr->pf_blocks[u].image);
+    cache_ptr->pf_blocks = (H5C_image_block_t *)H5MM_xfree(cache_ptr->pf_blocks);
+    cache_ptr->pf_block_buf = (uint8_t *)H5MM_xfree(cache_ptr->pf_block_buf);
+    cache_ptr->pf_num_blocks = 0;
+    cache_ptr->pf_block_loaded = -1;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__discard_cache_image() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C_load_cache_image_on_next_protect()
@@ -1191,6 +1559,45 @@ H5C__image_entry_cmp(const void *_entry1, const void *_entry2)
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__image_entry_cmp() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prefetched_entry_cmp
+ *
+ * Purpose:     Comparison callback for qsort(3) on pointers to prefetched
+ *		entries waiting for their images.  Entries are sorted by
+ *		the location of their image in the retained cache image.
+ *
+ * Return:      An integer less than, equal to, or greater than zero if the
+ *		first entry is considered to be respectively less than,
+ *		equal to, or greater than the second.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__prefetched_entry_cmp(const void *_entry1, const void *_entry2)
+{
+    const H5C_cache_entry_t *entry1 = *(H5C_cache_entry_t * const *)_entry1;  /* Pointer to first entry to compare */
+    const H5C_cache_entry_t *entry2 = *(H5C_cache_entry_t * const *)_entry2;  /* Pointer to second entry to compare */
+    int ret_value = 0;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(entry1 && entry1->pf_image_pending);
+    HDassert(entry2 && entry2->pf_image_pending);
+
+    if(entry1->pf_block < entry2->pf_block)
+        ret_value = -1;
+    else if(entry1->pf_block > entry2->pf_block)
+        ret_value = 1;
+    else if(entry1->pf_block_offset < entry2->pf_block_offset)
+        ret_value = -1;
+    else if(entry1->pf_block_offset > entry2->pf_block_offset)
+        ret_value = 1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prefetched_entry_cmp() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__prep_image_for_file_close
@@ -1275,6 +1682,12 @@ H5C__prep_image_for_file_close(H5F_t *f, hid_t dxpl_id)
         if(H5C__write_cache_image_superblock_msg(f, dxpl_id, TRUE) < 0)
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "creation of cache image SB mesg failed.")
 
+    /* Prefetched entries that are carried over into the new image need
+     * their images.  Extract any still held in the retained cache image.
+     */
+    if(H5C__load_prefetched_entry_images(cache_ptr, FALSE) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "can't load prefetched entry images")
+
     /* Serialize the cache */
     if(H5C__serialize_cache(f, dxpl_id) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "serialization of the cache failed")
@@ -1299,6 +1712,27 @@ H5C__prep_image_for_file_close(H5F_t *f, hid_t dxpl_id)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5C__prep_for_file_close__scan_entries failed")
     HDassert(HADDR_UNDEF == cache_ptr->image_addr);
 
+    /* If there are any entries to be included in the metadata cache
+     * image, allocate, populate, and sort the image_entries array, and
+     * construct the image.  The length of the compressed image is only
+     * known once it is constructed, and is needed to allocate file 
+     * space for it.  This is safe, as the images of all entries in the
+     * cache image are up to date, and remain so until the cache is 
+     * flushed on file close.
+     */
+    if(cache_ptr->num_entries_in_image > 0) {
+        if(H5C__prep_for_file_close__setup_image_entries_array(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't setup image entries array.")
+
+        /* Sort the entries */
+        HDqsort(cache_ptr->image_entries, (size_t)cache_ptr->num_entries_in_image,
+                sizeof(H5C_image_entry_t), H5C__image_entry_cmp);
+
+        /* Construct the cache image */
+        if(H5C__construct_cache_image_buffer(f, cache_ptr) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "Can't create metadata cache image")
+    } /* end if */
+
 #ifdef H5_HAVE_PARALLEL
     /* In the parallel case, overwrite the image_len with the 
      * value computed by process 0.
@@ -1406,8 +1840,9 @@ H5C__prep_image_for_file_close(H5F_t *f, hid_t dxpl_id)
      *   5) Flush dependency heights are calculated for all 
      *      entries that will be included in the cache image.
      *
-     * If there are any entries to be included in the metadata cache
-     * image, allocate, populate, and sort the image_entries array.  
+     *   6) If there are any entries to be included in the metadata
+     *      cache image, the sorted image_entries array exists, and 
+     *      the image is constructed in cache_ptr->image_buffer.
      *
      * If the metadata cache image will be empty, delete the 
      * metadata cache image superblock extension message, set 
@@ -1415,15 +1850,7 @@ H5C__prep_image_for_file_close(H5F_t *f, hid_t dxpl_id)
      * allow the file close to continue normally without the 
      * unecessary generation of the metadata cache image.
      */
-    if(cache_ptr->num_entries_in_image > 0) {
-        if(H5C__prep_for_file_close__setup_image_entries_array(cache_ptr) < 0)
-            HGOTO_ERROR(H5E_CACHE, H5E_CANTINIT, FAIL, "can't setup image entries array.")
-
-        /* Sort the entries */
-        HDqsort(cache_ptr->image_entries, (size_t)cache_ptr->num_entries_in_image,
-                sizeof(H5C_image_entry_t), H5C__image_entry_cmp);
-    } /* end if */
-    else { /* cancel creation of metadata cache iamge */
+    if(cache_ptr->num_entries_in_image == 0) { /* cancel creation of metadata cache iamge */
         HDassert(cache_ptr->image_entries == NULL);
 
         /* To avoid breaking the control flow tests, only delete 
@@ -1436,7 +1863,7 @@ H5C__prep_image_for_file_close(H5F_t *f, hid_t dxpl_id)
                 HGOTO_ERROR(H5E_CACHE, H5E_CANTREMOVE, FAIL, "can't remove MDC image msg from superblock ext.")
 
         cache_ptr->image_ctl.generate_image = FALSE;
-    } /* end else */
+    } /* end if */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1607,7 +2034,9 @@ H5C__cache_image_block_entry_header_size(const H5F_t * f)
  * Function:    H5C__cache_image_block_header_size
  *
  * Purpose:     Compute the size of the header of the metadata cache
- *		image block, and return the value.
+ *		image block in the specified format version, and return 
+ *		the value.  For version 1, this doesn't include the block
+ *		directory that follows the header.
  *
  * Return:      Size of the header section of the metadata cache image 
  *		block in bytes.
@@ -1618,7 +2047,7 @@ H5C__cache_image_block_entry_header_size(const H5F_t * f)
  *-------------------------------------------------------------------------
  */
 static size_t
-H5C__cache_image_block_header_size(const H5F_t * f)
+H5C__cache_image_block_header_size(const H5F_t * f, unsigned version)
 {
     size_t ret_value = 0;       /* Return value */
 
@@ -1630,6 +2059,8 @@ H5C__cache_image_block_header_size(const H5F_t * f)
 			  1 +			/* flags               */
 			  H5F_SIZEOF_SIZE(f) +	/* image data length   */
 			  4 );			/* num_entries         */
+    if(version >= H5C__MDCI_BLOCK_VERSION_1)
+        ret_value += 4;                         /* num_blocks          */
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__cache_image_block_header_size() */
@@ -1643,6 +2074,10 @@ H5C__cache_image_block_header_size(const H5F_t * f)
  *		of H5C_t.  Advances the buffer pointer to the first byte 
  *		after the header image, or unchanged on failure.
  *
+ *		Both version 0 and version 1 headers are accepted, and the
+ *		version is returned in *version.  For version 1, the number
+ *		of blocks is stored in cache_ptr->pf_num_blocks.
+ *
  * Return:      Non-negative on success/Negative on failure
  *
  * Programmer:  John Mainzer
@@ -1652,9 +2087,9 @@ H5C__cache_image_block_header_size(const H5F_t * f)
  */
 static herr_t
 H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr,
-    const uint8_t **buf)
+    const uint8_t **buf, unsigned *version)
 {
-    uint8_t		version;
+    uint8_t		vers;
     uint8_t		flags;
     hbool_t		have_resize_status = FALSE;
     size_t 		actual_header_len;
@@ -1669,6 +2104,7 @@ H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr,
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
     HDassert(buf);
     HDassert(*buf);
+    HDassert(version);
 
     /* Point to buffer to decode */
     p = *buf;
@@ -1679,8 +2115,8 @@ H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr,
     p += H5C__MDCI_BLOCK_SIGNATURE_LEN;
 
     /* Check version */
-    version = *p++;
-    if(version != (uint8_t)H5C__MDCI_BLOCK_VERSION_0)
+    vers = *p++;
+    if(vers != (uint8_t)H5C__MDCI_BLOCK_VERSION_0 && vers != (uint8_t)H5C__MDCI_BLOCK_VERSION_1)
 	HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image version")
 
     /* Decode flags */
@@ -1702,29 +2138,82 @@ H5C__decode_cache_image_header(const H5F_t *f, H5C_t *cache_ptr,
     if(cache_ptr->num_entries_in_image == 0) 
 	HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache entry count")
 
+    /* Read num blocks */
+    if(vers >= (uint8_t)H5C__MDCI_BLOCK_VERSION_1) {
+        UINT32DECODE(p, cache_ptr->pf_num_blocks);
+        if(cache_ptr->pf_num_blocks == 0 || cache_ptr->pf_num_blocks > cache_ptr->num_entries_in_image)
+	    HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image block count")
+    } /* end if */
+
     /* Verify expected length of header */
     actual_header_len = (size_t)(p - *buf);
-    expected_header_len = H5C__cache_image_block_header_size(f);
+    expected_header_len = H5C__cache_image_block_header_size(f, (unsigned)vers);
     if(actual_header_len != expected_header_len)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad header image len.")
 
     /* Update buffer pointer */
     *buf = p;
+    *version = (unsigned)vers;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__decode_cache_image_header() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__decode_cache_image_block()
+ *
+ * Purpose:     Decode a block of entry images from a version 1 metadata
+ *		cache image into the supplied buffer of raw_len bytes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__decode_cache_image_block(const uint8_t *stored, size_t stored_len,
+    uint8_t *raw, size_t raw_len)
+{
+    herr_t		ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(stored);
+    HDassert(raw);
+    HDassert(stored_len > 0);
+    HDassert(stored_len <= raw_len);
+
+    /* Blocks that didn't shrink when compressed are stored as is */
+    if(stored_len == raw_len)
+        HDmemcpy(raw, stored, raw_len);
+    else {
+#ifdef H5_HAVE_FILTER_DEFLATE
+        uLongf z_len = (uLongf)raw_len;
+
+        if(Z_OK != uncompress((Bytef *)raw, &z_len, (const Bytef *)stored, (uLong)stored_len))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "can't inflate cache image block")
+        if((size_t)z_len != raw_len)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADSIZE, FAIL, "bad inflated cache image block length")
+#else /* H5_HAVE_FILTER_DEFLATE */
+        HGOTO_ERROR(H5E_CACHE, H5E_UNSUPPORTED, FAIL, "cache image block is compressed, but deflate is not available")
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__decode_cache_image_block() */
+
 #ifndef NDEBUG
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__decode_cache_image_entry()
  *
- * Purpose:     Decode the metadata cache image entry from the supplied 
- *		buffer into the supplied instance of H5C_image_entry_t.
- *		This includes allocating a buffer for the entry image,
- *		loading it, and seting ie_ptr->image_ptr to point to 
- *		the buffer.
+ * Purpose:     Decode the descriptor of a metadata cache image entry 
+ *		in a version 1 cache image from the supplied buffer into
+ *		the supplied instance of H5C_image_entry_t.  The entry 
+ *		image itself is stored in a block after the descriptors,
+ *		and is not decoded -- ie_ptr->image_ptr is left untouched.
  *
  *		Advances the buffer pointer to the first byte 
  *		after the entry, or unchanged on failure.
@@ -1746,7 +2235,6 @@ H5C__decode_cache_image_entry(const H5F_t *f, const H5C_t *cache_ptr,
     hbool_t		is_fd_child = FALSE;    /* Only used in assertions */
     haddr_t 		addr;
     hsize_t		size = 0;
-    void *		image_ptr;
     uint8_t             flags = 0;
     uint8_t		type_id;
     uint8_t		ring;
@@ -1847,18 +2335,6 @@ H5C__decode_cache_image_entry(const H5F_t *f, const H5C_t *cache_ptr,
         } /* end for */
     } /* end if */
 
-    /* Allocate buffer for entry image */
-    if(NULL == (image_ptr = H5MM_malloc(size + H5C_IMAGE_EXTRA_SPACE)))
-	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
-
-#if H5C_DO_MEMORY_SANITY_CHECKS
-    HDmemcpy(((uint8_t *)image_ptr) + size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
-#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
-
-    /* Copy the entry image from the cache image block */
-    HDmemcpy(image_ptr, p, size);
-    p += size;
-
     /* Copy data into target */
     ie_ptr->addr                 = addr;
     ie_ptr->size                 = size;
@@ -1871,7 +2347,6 @@ H5C__decode_cache_image_entry(const H5F_t *f, const H5C_t *cache_ptr,
     ie_ptr->fd_dirty_child_count = (uint64_t)fd_dirty_child_count;
     ie_ptr->fd_parent_count      = (uint64_t)fd_parent_count;
     ie_ptr->fd_parent_addrs      = fd_parent_addrs;
-    ie_ptr->image_ptr            = image_ptr;
 
     /* Update buffer pointer */
     *buf = p;
@@ -2014,8 +2489,10 @@ done:
  * Function:    H5C__encode_cache_image_header()
  *
  * Purpose:     Encode the metadata cache image buffer header in the 
- *		supplied buffer.  Updates buffer pointer to the first byte 
- *		after the header image in the buffer, or unchanged on failure.
+ *		supplied buffer, in the specified format version.  The
+ *		number of blocks is only encoded in version 1 headers.
+ *		Updates buffer pointer to the first byte after the header
+ *		image in the buffer, or unchanged on failure.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -2026,7 +2503,7 @@ done:
  */
 static herr_t
 H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr,
-    uint8_t **buf)
+    unsigned version, uint32_t num_blocks, uint8_t **buf)
 {
     size_t 	actual_header_len;
     size_t	expected_header_len;
@@ -2041,9 +2518,9 @@ H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr,
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
     HDassert(cache_ptr->close_warning_received);
     HDassert(cache_ptr->image_ctl.generate_image);
-    HDassert(cache_ptr->index_len == 0);
     HDassert(cache_ptr->image_data_len > 0);
-    HDassert(cache_ptr->image_data_len <= cache_ptr->image_len);
+    HDassert(version == H5C__MDCI_BLOCK_VERSION_0 || version == H5C__MDCI_BLOCK_VERSION_1);
+    HDassert((version == H5C__MDCI_BLOCK_VERSION_0) == (num_blocks == 0));
     HDassert(buf);
     HDassert(*buf);
 
@@ -2055,7 +2532,7 @@ H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr,
     p += H5C__MDCI_BLOCK_SIGNATURE_LEN;
 
     /* write version */
-    *p++ = (uint8_t)H5C__MDCI_BLOCK_VERSION_0;
+    *p++ = (uint8_t)version;
 
     /* setup and write flags */
 
@@ -2067,16 +2544,18 @@ H5C__encode_cache_image_header(const H5F_t *f, const H5C_t *cache_ptr,
     *p++ = flags;
 
     /* Encode image data length */
-    /* this must be true at present */
-    HDassert(cache_ptr->image_len == cache_ptr->image_data_len);
     H5F_ENCODE_LENGTH(f, p, cache_ptr->image_data_len);
 
     /* write num entries */
     UINT32ENCODE(p, cache_ptr->num_entries_in_image);
 
+    /* write num blocks */
+    if(version >= H5C__MDCI_BLOCK_VERSION_1)
+        UINT32ENCODE(p, num_blocks);
+
     /* verify expected length of header */
     actual_header_len = (size_t)(p - *buf);
-    expected_header_len = H5C__cache_image_block_header_size(f);
+    expected_header_len = H5C__cache_image_block_header_size(f, version);
     if(actual_header_len != expected_header_len)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad header image len")
 
@@ -2091,9 +2570,11 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5C__encode_cache_image_entry()
  *
- * Purpose:     Encode the metadata cache image buffer header in the 
- *		supplied buffer.  Updates buffer pointer to the first byte 
- *		after the entry in the buffer, or unchanged on failure.
+ * Purpose:     Encode the descriptor of a metadata cache image entry in 
+ *		the supplied buffer.  The entry image itself is stored in 
+ *		a block after the descriptors.  Updates buffer pointer to 
+ *		the first byte after the descriptor in the buffer, or 
+ *		unchanged on failure.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -2122,7 +2603,6 @@ H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, uint8_t **buf,
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
     HDassert(cache_ptr->close_warning_received);
     HDassert(cache_ptr->image_ctl.generate_image);
-    HDassert(cache_ptr->index_len == 0);
     HDassert(buf);
     HDassert(*buf);
     HDassert(entry_num < cache_ptr->num_entries_in_image);
@@ -2186,10 +2666,6 @@ H5C__encode_cache_image_entry(H5F_t *f, H5C_t *cache_ptr, uint8_t **buf,
     for(u = 0; u < ie_ptr->fd_parent_count; u++)
 	H5F_addr_encode(f, &p, ie_ptr->fd_parent_addrs[u]);
 
-    /* Copy entry image */
-    HDmemcpy(p, ie_ptr->image_ptr, ie_ptr->size);
-    p += ie_ptr->size;
-
     /* Update buffer pointer */
     *buf = p;
 
@@ -2197,6 +2673,116 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C__encode_cache_image_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__encode_cache_image_block()
+ *
+ * Purpose:     Encode a block of raw_len bytes of entry images in the 
+ *		supplied buffer, which must have room for raw_len bytes.
+ *		The block is deflated if the library is built with deflate
+ *		support and that makes the block smaller.  Otherwise it is
+ *		stored as is.
+ *
+ * Return:      Length of the encoded block.  The block is compressed 
+ *		iff this is less than raw_len.
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5C__encode_cache_image_block(const uint8_t *raw, size_t raw_len, uint8_t *buf)
+{
+    size_t      ret_value = raw_len;    /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(raw);
+    HDassert(raw_len > 0);
+    HDassert(buf);
+
+#ifdef H5_HAVE_FILTER_DEFLATE
+    {
+        uLongf z_len = (uLongf)(raw_len - 1);
+
+        /* Limiting the output to one byte less than the input makes 
+         * compress2() fail if compression doesn't pay off.
+         */
+        if(z_len > 0 && Z_OK == compress2((Bytef *)buf, &z_len, (const Bytef *)raw, (uLong)raw_len, H5C__MDCI_DEFLATE_LEVEL))
+            ret_value = (size_t)z_len;
+    } /* end block */
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+    if(ret_value == raw_len)
+        HDmemcpy(buf, raw, raw_len);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__encode_cache_image_block() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__load_prefetched_entry_images
+ *
+ * Purpose:     Extract the images of all prefetched entries waiting for
+ *		them from the retained cache image -- or only those of 
+ *		the dirty entries, if dirty_only is TRUE.
+ *
+ *		The entries are processed in the order of their images in
+ *		the cache image, so that each block is decompressed once.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__load_prefetched_entry_images(H5C_t *cache_ptr, hbool_t dirty_only)
+{
+    H5C_cache_entry_t **entries = NULL; /* Entries to load */
+    H5C_cache_entry_t * entry_ptr;
+    size_t              nentries = 0;   /* Number of entries to load */
+    size_t              u;              /* Local index variable */
+    herr_t		ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    /* Check for entries waiting for their images */
+    if(cache_ptr->pf_pending == 0)
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (entries = (H5C_cache_entry_t **)H5MM_malloc(sizeof(H5C_cache_entry_t *) * (size_t)cache_ptr->pf_pending)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetched entry array")
+
+    /* Collect the entries to load */
+    entry_ptr = cache_ptr->il_head;
+    while(entry_ptr != NULL) {
+	HDassert(entry_ptr->magic == H5C__H5C_CACHE_ENTRY_T_MAGIC);
+
+        if(entry_ptr->pf_image_pending && (!dirty_only || entry_ptr->is_dirty)) {
+            HDassert(nentries < cache_ptr->pf_pending);
+            entries[nentries++] = entry_ptr;
+        } /* end if */
+
+        entry_ptr = entry_ptr->il_next;
+    } /* end while */
+    HDassert(dirty_only || nentries == cache_ptr->pf_pending);
+
+    /* Load the images, in cache image order */
+    if(nentries > 1)
+        HDqsort(entries, nentries, sizeof(H5C_cache_entry_t *), H5C__prefetched_entry_cmp);
+    for(u = 0; u < nentries; u++)
+        if(H5C__load_prefetched_entry_image(cache_ptr, entries[u]) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "can't load prefetched entry image")
+
+done:
+    if(entries)
+        entries = (H5C_cache_entry_t **)H5MM_xfree(entries);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__load_prefetched_entry_images() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5C__prep_for_file_close__compute_fd_heights
@@ -2717,7 +3303,7 @@ H5C__prep_for_file_close__scan_entries(const H5F_t *f, H5C_t *cache_ptr)
     /* Initialize image len to the size of the metadata cache image block
      * header.
      */
-    image_len        = H5C__cache_image_block_header_size(f);
+    image_len        = H5C__cache_image_block_header_size(f, H5C__MDCI_BLOCK_VERSION_0);
     entry_header_len = H5C__cache_image_block_entry_header_size(f);
 
     /* Scan each entry on the index list */
@@ -2905,6 +3491,9 @@ H5C__prep_for_file_close__scan_entries(const H5F_t *f, H5C_t *cache_ptr)
     } /* end while */
     HDassert(entries_visited == cache_ptr->LRU_list_len);
 
+    /* Note that this is the length of a version 0 image.  The actual 
+     * length is set when the image is constructed.
+     */
     image_len += H5F_SIZEOF_CHKSUM;
     cache_ptr->image_data_len = image_len;
 
@@ -2922,6 +3511,16 @@ done:
  *		reconstruct any flush dependencies.  Order the entries 
  *		in the LRU as indicated by the stored lru_ranks.
  *
+ *		For a version 1 image, only the stored blocks of entry
+ *		images are copied out of the image buffer, and the image
+ *		of each clean prefetched entry is only extracted from its
+ *		block when the entry is first protected.  The images of 
+ *		dirty entries are extracted right away, as they may have
+ *		to be written before that.  If the image has compressed
+ *		blocks, but the library is built without the deflate 
+ *		filter, the image is dropped, and no prefetched entries
+ *		are created.
+ *
  * Return:      SUCCEED on success, and FAIL on failure.
  *
  * Programmer:  John Mainzer
@@ -2935,6 +3534,9 @@ H5C__reconstruct_cache_contents(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr)
     H5C_cache_entry_t *	pf_entry_ptr;   /* Pointer to prefetched entry */
     H5C_cache_entry_t *	parent_ptr;     /* Pointer to parent of prefetched entry */
     const uint8_t *	p;              /* Pointer into image buffer */
+    unsigned            version;        /* Version of the cache image */
+    uint32_t            block = 0;      /* Block holding the current entry image */
+    size_t              block_offset = 0; /* Offset of the image in its block */
     unsigned		u, v;           /* Local index variable */
     herr_t 		ret_value = SUCCEED;      /* Return value */
 
@@ -2949,9 +3551,12 @@ H5C__reconstruct_cache_contents(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr)
     HDassert(cache_ptr->image_buffer);
     HDassert(cache_ptr->image_len > 0);
 
+    HDassert(cache_ptr->pf_blocks == NULL);
+    HDassert(cache_ptr->pf_pending == 0);
+
     /* Decode metadata cache image header */
     p = (uint8_t *)cache_ptr->image_buffer;
-    if(H5C__decode_cache_image_header(f, cache_ptr, &p) < 0)
+    if(H5C__decode_cache_image_header(f, cache_ptr, &p, &version) < 0)
         HGOTO_ERROR(H5E_CACHE, H5E_CANTDECODE, FAIL, "cache image header decode failed")
     HDassert((size_t)(p - (uint8_t *)cache_ptr->image_buffer) < cache_ptr->image_len);
 
@@ -2960,14 +3565,71 @@ H5C__reconstruct_cache_contents(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr)
     HDassert(cache_ptr->image_data_len <= cache_ptr->image_len);
     HDassert(cache_ptr->num_entries_in_image > 0);
 
+    /* Decode the block directory of a version 1 image */
+    if(version >= H5C__MDCI_BLOCK_VERSION_1) {
+        HDassert(cache_ptr->pf_num_blocks > 0);
+        if((size_t)(p - (uint8_t *)cache_ptr->image_buffer) + (size_t)cache_ptr->pf_num_blocks * H5C__MDCI_BLOCK_DIR_ENTRY_SIZE > cache_ptr->image_data_len)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image block count")
+        if(NULL == (cache_ptr->pf_blocks = (H5C_image_block_t *)H5MM_malloc(sizeof(H5C_image_block_t) * (size_t)cache_ptr->pf_num_blocks)))
+	    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image block array")
+        for(v = 0; v < cache_ptr->pf_num_blocks; v++) {
+            H5C_image_block_t *blk = &(cache_ptr->pf_blocks[v]);
+            uint32_t raw_len, stored_len;
+
+            UINT32DECODE(p, raw_len);
+            UINT32DECODE(p, stored_len);
+            if(raw_len == 0 || stored_len == 0 || stored_len > raw_len)
+                HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image block length")
+            blk->offset = 0;
+            blk->raw_len = (size_t)raw_len;
+            blk->stored_len = (size_t)stored_len;
+            blk->image = NULL;
+            blk->pending = 0;
+        } /* end for */
+
+#ifndef H5_HAVE_FILTER_DEFLATE
+        /* The entry images in compressed blocks can't be recovered.  
+         * Drop the cache image -- the entries will simply be loaded 
+         * from file when needed.
+         */
+        for(v = 0; v < cache_ptr->pf_num_blocks; v++)
+            if(cache_ptr->pf_blocks[v].stored_len < cache_ptr->pf_blocks[v].raw_len) {
+                H5C__discard_cache_image(cache_ptr);
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+#endif /* H5_HAVE_FILTER_DEFLATE */
+    } /* end if */
+
     /* Reconstruct entries in image */
     for(u = 0; u < cache_ptr->num_entries_in_image; u++) {
 	/* Create the prefetched entry described by the ith
          * entry in cache_ptr->image_entrise.
          */
-	if(NULL == (pf_entry_ptr = H5C__reconstruct_cache_entry(f, cache_ptr, &p)))
+	if(NULL == (pf_entry_ptr = H5C__reconstruct_cache_entry(f, cache_ptr, &p, (version == H5C__MDCI_BLOCK_VERSION_0))))
             HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "reconstruction of cache entry failed")
 
+        /* Locate the image of the entry in the blocks of a version 1 
+         * image.  Images are packed in image order, and don't straddle
+         * blocks.
+         */
+        if(version >= H5C__MDCI_BLOCK_VERSION_1) {
+            if(block_offset + pf_entry_ptr->size > cache_ptr->pf_blocks[block].raw_len) {
+                if(block_offset != cache_ptr->pf_blocks[block].raw_len || block + 1 >= cache_ptr->pf_num_blocks)
+                    HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "entry image doesn't fit in metadata cache image blocks")
+                block++;
+                block_offset = 0;
+                if(pf_entry_ptr->size > cache_ptr->pf_blocks[block].raw_len)
+                    HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "entry image doesn't fit in metadata cache image blocks")
+            } /* end if */
+
+            pf_entry_ptr->pf_image_pending = TRUE;
+            pf_entry_ptr->pf_block = block;
+            pf_entry_ptr->pf_block_offset = block_offset;
+            block_offset += pf_entry_ptr->size;
+            cache_ptr->pf_blocks[block].pending++;
+            cache_ptr->pf_pending++;
+        } /* end if */
+
 	/* Note that we make no checks on available cache space before 
          * inserting the reconstructed entry into the metadata cache.
          *
@@ -3023,6 +3685,51 @@ H5C__reconstruct_cache_contents(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr)
         } /* end for */
     } /* end for */
 
+    /* Locate the blocks of a version 1 image, which follow the entry
+     * descriptors, and retain a copy of each, so that the entry images 
+     * can be extracted on demand.  Copying the blocks lets each be freed
+     * as soon as the images in it have been extracted.
+     */
+    if(version >= H5C__MDCI_BLOCK_VERSION_1) {
+        size_t offset = (size_t)(p - (uint8_t *)cache_ptr->image_buffer);
+        size_t max_block_len = 0;
+
+        if(block + 1 != cache_ptr->pf_num_blocks || block_offset != cache_ptr->pf_blocks[block].raw_len)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "entry images don't match metadata cache image blocks")
+
+        for(v = 0; v < cache_ptr->pf_num_blocks; v++) {
+            cache_ptr->pf_blocks[v].offset = offset;
+            offset += cache_ptr->pf_blocks[v].stored_len;
+            if(cache_ptr->pf_blocks[v].stored_len < cache_ptr->pf_blocks[v].raw_len && cache_ptr->pf_blocks[v].raw_len > max_block_len)
+                max_block_len = cache_ptr->pf_blocks[v].raw_len;
+        } /* end for */
+        if(offset + H5F_SIZEOF_CHKSUM != cache_ptr->image_data_len)
+            HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "Bad metadata cache image data length")
+
+        for(v = 0; v < cache_ptr->pf_num_blocks; v++) {
+            H5C_image_block_t *blk = &(cache_ptr->pf_blocks[v]);
+
+            HDassert(blk->pending > 0);
+            if(NULL == (blk->image = (uint8_t *)H5MM_malloc(blk->stored_len)))
+	        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image block")
+            HDmemcpy(blk->image, (const uint8_t *)cache_ptr->image_buffer + blk->offset, blk->stored_len);
+        } /* end for */
+
+        /* Allocate the buffer for decompressed blocks, if any block
+         * is compressed.
+         */
+        if(max_block_len > 0)
+            if(NULL == (cache_ptr->pf_block_buf = (uint8_t *)H5MM_malloc(max_block_len)))
+	        HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for cache image block buffer")
+        cache_ptr->pf_block_loaded = -1;
+
+        /* Dirty entries may be written before they are protected, so
+         * their images must be available now.
+         */
+        if(H5C__load_prefetched_entry_images(cache_ptr, TRUE) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "can't load dirty prefetched entry images")
+    } /* end if */
+
 #ifndef NDEBUG
     /* Scan the cache entries, and verify that each entry has
      * the expected flush dependency status.
@@ -3119,7 +3826,10 @@ done:
  * Function:    H5C__reconstruct_cache_entry()
  *
  * Purpose:     Allocate a prefetched metadata cache entry and initialize
- *		it from image buffer.
+ *		it from image buffer.  If image_inline is TRUE (version 0
+ *		images), the entry image follows the entry descriptor,
+ *		and is copied into the entry.  Otherwise, the image is 
+ *		located and extracted later.
  *
  *		Return a pointer to the newly allocated cache entry,
  *		or NULL on failure.
@@ -3134,7 +3844,7 @@ done:
  */
 static H5C_cache_entry_t *
 H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
-    const uint8_t **buf)
+    const uint8_t **buf, hbool_t image_inline)
 {
     H5C_cache_entry_t *pf_entry_ptr = NULL;     /* Reconstructed cache entry */
     uint8_t             flags = 0;
@@ -3203,6 +3913,10 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
     if(pf_entry_ptr->fd_dirty_child_count > pf_entry_ptr->fd_child_count)
         HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, NULL, "invalid dirty flush dependency child count")
 
+    /* As above, all children are clean if the file is read only */
+    if(!cache_ptr->delete_image)
+        pf_entry_ptr->fd_dirty_child_count = 0;
+
     /* Decode dependency parent count */
     UINT16DECODE(p, pf_entry_ptr->fd_parent_count);
     HDassert((is_fd_child && pf_entry_ptr->fd_parent_count > 0) || (!is_fd_child && pf_entry_ptr->fd_parent_count == 0));
@@ -3241,16 +3955,18 @@ H5C__reconstruct_cache_entry(const H5F_t *f, H5C_t *cache_ptr,
         } /* end for */
     } /* end if */
 
-    /* Allocate buffer for entry image */
-    if(NULL == (pf_entry_ptr->image_ptr = H5MM_malloc(pf_entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
-	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
+    if(image_inline) {
+        /* Allocate buffer for entry image */
+        if(NULL == (pf_entry_ptr->image_ptr = H5MM_malloc(pf_entry_ptr->size + H5C_IMAGE_EXTRA_SPACE)))
+	    HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, NULL, "memory allocation failed for on disk image buffer")
 #if H5C_DO_MEMORY_SANITY_CHECKS
-    HDmemcpy(((uint8_t *)pf_entry_ptr->image_ptr) + size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+        HDmemcpy(((uint8_t *)pf_entry_ptr->image_ptr) + pf_entry_ptr->size, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
 #endif /* H5C_DO_MEMORY_SANITY_CHECKS */
 
-    /* Copy the entry image from the cache image block */
-    HDmemcpy(pf_entry_ptr->image_ptr, p, pf_entry_ptr->size);
-    p += pf_entry_ptr->size;
+        /* Copy the entry image from the cache image block */
+        HDmemcpy(pf_entry_ptr->image_ptr, p, pf_entry_ptr->size);
+        p += pf_entry_ptr->size;
+    } /* end if */
 
 
     /* Initialize the rest of the fields in the prefetched entry */
@@ -3339,7 +4055,6 @@ H5C__serialize_cache(H5F_t *f, hid_t dxpl_id)
     cache_ptr = f->shared->cache;
     HDassert(cache_ptr);
     HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
-    HDassert(cache_ptr->slist_ptr);
 
 #if H5C_DO_SANITY_CHECKS
     HDassert(cache_ptr->index_ring_len[H5C_RING_UNDEFINED] == 0);
@@ -19,7 +19,8 @@
  *                      May 30 2016
  *                      Quincey Koziol
  *
- * Purpose:             Functions for generic cache logging in JSON format
+ * Purpose:             Functions for generic cache logging in JSON or
+ *                      binary trace format
  *
  *-------------------------------------------------------------------------
  */
@@ -60,6 +61,10 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5C__flush_log_trace(const H5C_t *cache_ptr);
+static hbool_t H5C__log_trace_sampled(const H5C_log_trace_t *trace_ptr,
+    haddr_t addr);
+static herr_t H5C__free_moved_addr(void *item, void *key, void *op_data);
 
 
 /*********************/
@@ -93,7 +98,12 @@
  *              The log functionality is split between the H5C and H5AC
  *              packages. Log state and direct log manipulation resides in
  *              H5C. Log messages are generated in H5AC and sent to
- *              the H5C_write_log_message function.
+ *              the H5C_write_log_message function, or to the
+ *              H5C_write_log_record function for binary traces.
+ *
+ *              For a binary trace, the trace header is written here, and
+ *              sample_interval selects the fraction of entries whose
+ *              operations are recorded (1 records all of them).
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -104,7 +114,7 @@
  */
 herr_t
 H5C_set_up_logging(H5C_t *cache_ptr, const char log_location[],
-    hbool_t start_immediately)
+    H5C_log_format_t format, unsigned sample_interval, hbool_t start_immediately)
 {
 #ifdef H5_HAVE_PARALLEL
     H5AC_aux_t *aux_ptr = NULL;
@@ -124,6 +134,10 @@ H5C_set_up_logging(H5C_t *cache_ptr, const char log_location[],
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "logging already set up")
     if(NULL == log_location)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "NULL log location not allowed")
+    if(format != H5C_LOG_FORMAT_JSON && format != H5C_LOG_FORMAT_BINARY)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown log format")
+    if(0 == sample_interval)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "sample interval must be positive")
 
     /* Possibly fix up the log file name.
      * The extra 39 characters are for adding the rank to the file name
@@ -152,14 +166,50 @@ H5C_set_up_logging(H5C_t *cache_ptr, const char log_location[],
 #endif /* H5_HAVE_PARALLEL */
 
     /* Open log file */
-    if(NULL == (cache_ptr->log_file_ptr = HDfopen(file_name, "w")))
+    if(NULL == (cache_ptr->log_file_ptr = HDfopen(file_name, (format == H5C_LOG_FORMAT_BINARY ? "wb" : "w"))))
         HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, FAIL, "can't create mdc log file")
 
+    /* Set up the binary trace buffer and write the trace header */
+    if(format == H5C_LOG_FORMAT_BINARY) {
+        uint8_t header[H5C__TRACE_HEADER_SIZE];
+        uint8_t *p = header;
+
+        if(NULL == (cache_ptr->log_trace_ptr = (H5C_log_trace_t *)H5MM_malloc(sizeof(H5C_log_trace_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate mdc trace buffer")
+        cache_ptr->log_trace_ptr->sample_interval = sample_interval;
+        cache_ptr->log_trace_ptr->moved = NULL;
+        cache_ptr->log_trace_ptr->nrecords = 0;
+        if(sample_interval > 1)
+            if(NULL == (cache_ptr->log_trace_ptr->moved = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTCREATE, FAIL, "can't create list of moved entries")
+
+        HDmemcpy(p, H5C__TRACE_SIGNATURE, (size_t)H5C__TRACE_SIGNATURE_LEN);
+        p += H5C__TRACE_SIGNATURE_LEN;
+        UINT32ENCODE(p, H5C__TRACE_VERSION);
+        UINT32ENCODE(p, sample_interval);
+        HDassert((size_t)(p - header) == H5C__TRACE_HEADER_SIZE);
+
+        if(1 != HDfwrite(header, (size_t)H5C__TRACE_HEADER_SIZE, (size_t)1, cache_ptr->log_file_ptr))
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't write mdc trace header")
+    } /* end if */
+
     /* Set logging flags */
+    cache_ptr->log_format = format;
     cache_ptr->logging_enabled = TRUE;
     cache_ptr->currently_logging = start_immediately;
 
  done:
+    if(ret_value < 0) {
+        if(cache_ptr && cache_ptr->log_file_ptr && !cache_ptr->logging_enabled) {
+            HDfclose(cache_ptr->log_file_ptr);
+            cache_ptr->log_file_ptr = NULL;
+        } /* end if */
+        if(cache_ptr && cache_ptr->log_trace_ptr && !cache_ptr->logging_enabled) {
+            if(cache_ptr->log_trace_ptr->moved)
+                H5SL_close(cache_ptr->log_trace_ptr->moved);
+            cache_ptr->log_trace_ptr = (H5C_log_trace_t *)H5MM_xfree(cache_ptr->log_trace_ptr);
+        } /* end if */
+    } /* end if */
     if(file_name)
         file_name = (char *)H5MM_xfree(file_name);
 
@@ -194,6 +244,16 @@ H5C_tear_down_logging(H5C_t *cache_ptr)
     if(FALSE == cache_ptr->logging_enabled)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "logging not enabled")
 
+    /* Write out any buffered trace records */
+    if(cache_ptr->log_trace_ptr) {
+        if(H5C__flush_log_trace(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't write mdc trace records")
+        if(cache_ptr->log_trace_ptr->moved && H5SL_destroy(cache_ptr->log_trace_ptr->moved, H5C__free_moved_addr, NULL) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTCLOSEOBJ, FAIL, "can't destroy list of moved entries")
+        cache_ptr->log_trace_ptr = (H5C_log_trace_t *)H5MM_xfree(cache_ptr->log_trace_ptr);
+    } /* end if */
+    cache_ptr->log_format = H5C_LOG_FORMAT_JSON;
+
     /* Unset logging flags */
     cache_ptr->logging_enabled = FALSE;
     cache_ptr->currently_logging = FALSE;
@@ -279,6 +339,14 @@ H5C_stop_logging(H5C_t *cache_ptr)
     if(FALSE == cache_ptr->currently_logging)
         HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "logging not in progress")
 
+    /* Make the binary trace recorded so far visible in the log file */
+    if(cache_ptr->log_trace_ptr) {
+        if(H5C__flush_log_trace(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't write mdc trace records")
+        if(EOF == HDfflush(cache_ptr->log_file_ptr))
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "error flushing mdc trace")
+    } /* end if */
+
     /* Set logging flags */
     cache_ptr->currently_logging = FALSE;
 
@@ -368,3 +436,208 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_write_log_message() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_log_format
+ *
+ * Purpose:     Get the format of the metadata cache log.
+ *
+ * Return:      Format of the log.  H5C_LOG_FORMAT_JSON if logging is
+ *              not set up.
+ *
+ *-------------------------------------------------------------------------
+ */
+H5C_log_format_t
+H5C_get_log_format(const H5C_t *cache_ptr)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+
+    FUNC_LEAVE_NOAPI(cache_ptr->log_format)
+} /* H5C_get_log_format() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_write_log_record
+ *
+ * Purpose:     Append a record to the binary metadata cache trace.
+ *
+ *              Records are encoded into the trace buffer, which is
+ *              written to the log file only when it is full.  If the
+ *              trace is sampled, operations on entries that are not in
+ *              the sample are dropped here.  Operations that do not
+ *              refer to an entry (flush and evict) are always recorded.
+ *
+ *              Moves are recorded when either address is in the sample.
+ *              When a sampled entry moves to an address outside of the
+ *              sample, that address is added to the sample, so that the
+ *              rest of the history of the entry is recorded too.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_write_log_record(const H5C_t *cache_ptr, unsigned op, int type_id,
+    unsigned flags, haddr_t addr, haddr_t new_addr, size_t size)
+{
+    H5C_log_trace_t *trace_ptr;
+    uint8_t *p;
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(op >= H5C__TRACE_OP_INSERT && op <= H5C__TRACE_OP_EVICT);
+    HDassert(type_id >= 0 && type_id < H5C__MAX_NUM_TYPE_IDS);
+
+    if(FALSE == cache_ptr->currently_logging)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "not currently logging")
+    if(NULL == (trace_ptr = cache_ptr->log_trace_ptr))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "not recording a binary trace")
+
+    /* Drop operations on entries outside of the sample */
+    if(trace_ptr->sample_interval > 1 && H5F_addr_defined(addr)) {
+        hbool_t sampled = H5C__log_trace_sampled(trace_ptr, addr);
+
+        if(H5C__TRACE_OP_MOVE == op) {
+            hbool_t new_sampled = H5C__log_trace_sampled(trace_ptr, new_addr);
+            haddr_t *moved_addr;
+
+            if(!sampled && !new_sampled)
+                HGOTO_DONE(SUCCEED)
+
+            /* The entry leaves its old address, and takes its place in
+             * the sample to the new one.
+             */
+            if(NULL != (moved_addr = (haddr_t *)H5SL_remove(trace_ptr->moved, &addr)))
+                moved_addr = (haddr_t *)H5MM_xfree(moved_addr);
+            if(sampled && !new_sampled) {
+                if(NULL == (moved_addr = (haddr_t *)H5MM_malloc(sizeof(haddr_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate moved entry address")
+                *moved_addr = new_addr;
+                if(H5SL_insert(trace_ptr->moved, moved_addr, moved_addr) < 0) {
+                    moved_addr = (haddr_t *)H5MM_xfree(moved_addr);
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTINSERT, FAIL, "can't add moved entry to the sample")
+                } /* end if */
+            } /* end if */
+        } /* end if */
+        else if(!sampled)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Encode the record */
+    HDassert(trace_ptr->nrecords < H5C__TRACE_BUF_NRECORDS);
+    p = trace_ptr->buf + (trace_ptr->nrecords * H5C__TRACE_RECORD_SIZE);
+    *p++ = (uint8_t)op;
+    *p++ = (uint8_t)type_id;
+    UINT16ENCODE(p, (flags & 0xffff));
+    UINT32ENCODE(p, (size > (size_t)0xffffffff ? (size_t)0xffffffff : size));
+    UINT64ENCODE(p, addr);
+    UINT64ENCODE(p, new_addr);
+
+    /* Write out the buffer once it is full */
+    if(++trace_ptr->nrecords == H5C__TRACE_BUF_NRECORDS)
+        if(H5C__flush_log_trace(cache_ptr) < 0)
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't write mdc trace records")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_write_log_record() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__flush_log_trace
+ *
+ * Purpose:     Write the records held in the binary trace buffer to the
+ *              log file and empty the buffer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__flush_log_trace(const H5C_t *cache_ptr)
+{
+    H5C_log_trace_t *trace_ptr = cache_ptr->log_trace_ptr;
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(trace_ptr);
+    HDassert(cache_ptr->log_file_ptr);
+
+    if(trace_ptr->nrecords > 0) {
+        if(trace_ptr->nrecords != HDfwrite(trace_ptr->buf, (size_t)H5C__TRACE_RECORD_SIZE, trace_ptr->nrecords, cache_ptr->log_file_ptr))
+            HGOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "error writing mdc trace records")
+        trace_ptr->nrecords = 0;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__flush_log_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__log_trace_sampled
+ *
+ * Purpose:     Determine whether operations at address ADDR are in the
+ *              sample of a sampled binary trace: the address hashes to
+ *              0 modulo the sample interval, or a sampled entry was
+ *              moved there.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5C__log_trace_sampled(const H5C_log_trace_t *trace_ptr, haddr_t addr)
+{
+    uint8_t addr_buf[8];
+    uint8_t *p = addr_buf;
+    hbool_t ret_value = FALSE;       /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(trace_ptr);
+    HDassert(trace_ptr->sample_interval > 1);
+    HDassert(trace_ptr->moved);
+
+    UINT64ENCODE(p, addr);
+    if(0 == (H5_checksum_lookup3(addr_buf, sizeof(addr_buf), 0) % trace_ptr->sample_interval))
+        ret_value = TRUE;
+    else if(NULL != H5SL_search(trace_ptr->moved, &addr))
+        ret_value = TRUE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__log_trace_sampled() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__free_moved_addr
+ *
+ * Purpose:     Skip list callback to free the addresses in the list of
+ *              moved entries of a sampled binary trace.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__free_moved_addr(void *item, void H5_ATTR_UNUSED *key, void H5_ATTR_UNUSED *op_data)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(item);
+
+    H5MM_xfree(item);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* H5C__free_moved_addr() */
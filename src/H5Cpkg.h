@@ -49,12 +49,18 @@
 #define H5C__MAX_EPOCH_MARKERS                  10
 
 /* Cache configuration settings */
-#define H5C__HASH_TABLE_LEN     (64 * 1024) /* must be a power of 2 */
+#define H5C__INDEX_MIN_LEN      (4 * 1024)  /* must be a power of 2 */
 #define H5C__H5C_T_MAGIC	0x005CAC0E
 
 /* Initial allocated size of the "flush_dep_parent" array */
 #define H5C_FLUSH_DEP_PARENT_INIT 8
 
+/* Bytes of entry images staged during a flush before they are written */
+#define H5C__FLUSH_STAGE_MAX_SIZE       (8 * 1024 * 1024)
+
+/* Initial number of entry images the flush staging area tracks */
+#define H5C__FLUSH_STAGE_INIT_LEN       256
+
 /****************************************************************************
  *
  * We maintain doubly linked lists of instances of H5C_cache_entry_t for a
@@ -592,9 +598,10 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
  * The following macros must handle stats collection when this collection
  * is enabled, and evaluate to the empty string when it is not.
  *
- * The sole exception to this rule is
- * H5C__UPDATE_CACHE_HIT_RATE_STATS(), which is always active as
- * the cache hit rate stats are always collected and available.
+ * The exceptions to this rule are H5C__UPDATE_CACHE_HIT_RATE_STATS()
+ * and the H5C__UPDATE_TYPE_STATS_FOR_*() macros, which are always 
+ * active as the cache hit rate and per entry type stats are always 
+ * collected and available.
  *
  ***********************************************************************/
 
@@ -604,6 +611,29 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
             (cache_ptr->cache_hits)++;                   \
         }                                                \
 
+#define H5C__UPDATE_TYPE_STATS_FOR_PROTECT(cache_ptr, type_id, hit) \
+        if ( hit ) {                                                \
+            ((cache_ptr)->type_stats[(type_id)].hits)++;           \
+        } else {                                                    \
+            ((cache_ptr)->type_stats[(type_id)].misses)++;         \
+        }
+
+#define H5C__UPDATE_TYPE_STATS_FOR_LOAD(cache_ptr, type_id, len, time) \
+        ((cache_ptr)->type_stats[(type_id)].loads)++;                  \
+        (cache_ptr)->type_stats[(type_id)].bytes_read += (int64_t)(len); \
+        (cache_ptr)->type_stats[(type_id)].deserialize_time += (time);
+
+#define H5C__UPDATE_TYPE_STATS_FOR_SERIALIZE(cache_ptr, entry_ptr, time) \
+        (cache_ptr)->type_stats[(entry_ptr)->type->id].serialize_time += (time);
+
+#define H5C__UPDATE_TYPE_STATS_FOR_WRITE(cache_ptr, entry_ptr)         \
+        ((cache_ptr)->type_stats[(entry_ptr)->type->id].flushes)++;    \
+        (cache_ptr)->type_stats[(entry_ptr)->type->id].bytes_written += \
+            (int64_t)((entry_ptr)->size);
+
+#define H5C__UPDATE_TYPE_STATS_FOR_EVICTION(cache_ptr, entry_ptr) \
+        ((cache_ptr)->type_stats[(entry_ptr)->type->id].evictions)++;
+
 #if H5C_COLLECT_CACHE_STATS
 
 #define H5C__UPDATE_MAX_INDEX_SIZE_STATS(cache_ptr)                        \
@@ -971,13 +1001,33 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
  *
  *                                              JRM -- 10/15/15
  *
+ *   - Replaced the fixed size, chained hash table with an open
+ *     addressing table of (address, entry pointer) slots that is
+ *     probed linearly and resized as the number of entries in the
+ *     index changes.  Lookups compare the addresses stored in the
+ *     slots, and so touch no entry other than the one found.
+ *
  ***********************************************************************/
 
-/* H5C__HASH_TABLE_LEN is defined in H5Cpkg.h.  It mut be a power of two. */
+/* The index length is always a power of two, no smaller than
+ * H5C__INDEX_MIN_LEN.  H5C__HASH_FCN() maps an address to its home slot
+ * by taking the high order bits of a multiplicative (Fibonacci) hash of
+ * the address, which spreads the regularly spaced addresses HDF5 tends
+ * to allocate across the whole table.
+ */
+
+#define H5C__HASH_MULT                                                      (((uint64_t)0x9E3779B9 << 32) | (uint64_t)0x7F4A7C15)
 
-#define H5C__HASH_MASK		((size_t)(H5C__HASH_TABLE_LEN - 1) << 3)
+#define H5C__HASH_FCN(cache_ptr, x)                                         ((size_t)(((uint64_t)(x) * H5C__HASH_MULT) >> (cache_ptr)->index_shift))
 
-#define H5C__HASH_FCN(x)	(int)((unsigned)((x) & H5C__HASH_MASK) >> 3)
+#define H5C__INDEX_NEXT_SLOT(cache_ptr, k)                                  (((k) + 1) & ((cache_ptr)->index_len_slots - 1))
+
+/* The index is grown when an insertion would leave it more than 3/4
+ * full, and shrunk when it is less than 1/8 full.
+ */
+#define H5C__INDEX_FULL(cache_ptr)                                          (((size_t)(cache_ptr)->index_len + 1) * 4 >                              (cache_ptr)->index_len_slots * 3)
+
+#define H5C__INDEX_SPARSE(cache_ptr)                                        ( ( (cache_ptr)->index_len_slots > H5C__INDEX_MIN_LEN ) &&                ( (size_t)(cache_ptr)->index_len * 8 < (cache_ptr)->index_len_slots ) )
 
 #if H5C_DO_SANITY_CHECKS
 
@@ -986,11 +1036,8 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (cache_ptr)->magic != H5C__H5C_T_MAGIC ) ||                      \
      ( (entry_ptr) == NULL ) ||                                         \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                       \
-     ( (entry_ptr)->ht_next != NULL ) ||                                \
-     ( (entry_ptr)->ht_prev != NULL ) ||                                \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
+     ( (cache_ptr)->index == NULL ) ||                                  \
      ( (cache_ptr)->index_size !=                                       \
        ((cache_ptr)->clean_index_size +                                 \
 	(cache_ptr)->dirty_index_size) ) ||                             \
@@ -1041,16 +1088,7 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (cache_ptr)->index_size < (entry_ptr)->size ) ||                 \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                       \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
-     ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]         \
-       == NULL ) ||                                                     \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]       \
-       != (entry_ptr) ) &&                                              \
-       ( (entry_ptr)->ht_prev == NULL ) ) ||                            \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))] ==    \
-         (entry_ptr) ) &&                                               \
-       ( (entry_ptr)->ht_prev != NULL ) ) ||                            \
+     ( (cache_ptr)->index == NULL ) ||                                  \
      ( (cache_ptr)->index_size !=                                       \
        ((cache_ptr)->clean_index_size +                                 \
 	(cache_ptr)->dirty_index_size) ) ||                             \
@@ -1080,8 +1118,6 @@ if ( ( (cache_ptr) == NULL ) ||                                          \
      ( (entry_ptr) == NULL ) ||                                          \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                        \
      ( (entry_ptr)->size <= 0 ) ||                                       \
-     ( (entry_ptr)->ht_prev != NULL ) ||                                 \
-     ( (entry_ptr)->ht_prev != NULL ) ||                                 \
      ( (cache_ptr)->index_size !=                                        \
        ((cache_ptr)->clean_index_size +                                  \
 	(cache_ptr)->dirty_index_size) ) ||                              \
@@ -1107,8 +1143,7 @@ if ( ( (cache_ptr) == NULL ) ||                                             \
      ( (cache_ptr)->index_size !=                                           \
        ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ) || \
      ( ! H5F_addr_defined(Addr) ) ||                                        \
-     ( H5C__HASH_FCN(Addr) < 0 ) ||                                         \
-     ( H5C__HASH_FCN(Addr) >= H5C__HASH_TABLE_LEN ) ) {                     \
+     ( (cache_ptr)->index == NULL ) ) {                                     \
     HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "pre HT search SC failed") \
 }
 
@@ -1122,26 +1157,11 @@ if ( ( (cache_ptr) == NULL ) ||                                             \
      ( (cache_ptr)->index_size !=                                           \
        ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ) || \
      ( (entry_ptr)->size <= 0 ) ||                                          \
-     ( ((cache_ptr)->index)[k] == NULL ) ||                                 \
-     ( ( ((cache_ptr)->index)[k] != (entry_ptr) ) &&                        \
-       ( (entry_ptr)->ht_prev == NULL ) ) ||                                \
-     ( ( ((cache_ptr)->index)[k] == (entry_ptr) ) &&                        \
-       ( (entry_ptr)->ht_prev != NULL ) ) ||                                \
-     ( ( (entry_ptr)->ht_prev != NULL ) &&                                  \
-       ( (entry_ptr)->ht_prev->ht_next != (entry_ptr) ) ) ||                \
-     ( ( (entry_ptr)->ht_next != NULL ) &&                                  \
-       ( (entry_ptr)->ht_next->ht_prev != (entry_ptr) ) ) ) {               \
+     ( ((cache_ptr)->index)[k].ent_ptr != (entry_ptr) ) ||                \
+     ( ! H5F_addr_eq(((cache_ptr)->index)[k].addr, (entry_ptr)->addr) ) ) { \
     HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "post successful HT search SC failed") \
 }
 
-/* (Keep in sync w/H5C_TEST__POST_HT_SHIFT_TO_FRONT macro in test/cache_common.h -QAK) */
-#define H5C__POST_HT_SHIFT_TO_FRONT(cache_ptr, entry_ptr, k, fail_val) \
-if ( ( (cache_ptr) == NULL ) ||                                        \
-     ( ((cache_ptr)->index)[k] != (entry_ptr) ) ||                     \
-     ( (entry_ptr)->ht_prev != NULL ) ) {                              \
-    HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "post HT shift to front SC failed") \
-}
-
 #define H5C__PRE_HT_ENTRY_SIZE_CHANGE_SC(cache_ptr, old_size, new_size, \
 		                         entry_ptr, was_clean)          \
 if ( ( (cache_ptr) == NULL ) ||                                         \
@@ -1301,7 +1321,6 @@ if ( ( (cache_ptr)->index_size !=                                           \
 #define H5C__POST_HT_REMOVE_SC(cache_ptr, entry_ptr)
 #define H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)
 #define H5C__POST_SUC_HT_SEARCH_SC(cache_ptr, entry_ptr, k, fail_val)
-#define H5C__POST_HT_SHIFT_TO_FRONT(cache_ptr, entry_ptr, k, fail_val)
 #define H5C__PRE_HT_UPDATE_FOR_ENTRY_CLEAN_SC(cache_ptr, entry_ptr)
 #define H5C__PRE_HT_UPDATE_FOR_ENTRY_DIRTY_SC(cache_ptr, entry_ptr)
 #define H5C__PRE_HT_ENTRY_SIZE_CHANGE_SC(cache_ptr, old_size, new_size, \
@@ -1316,14 +1335,18 @@ if ( ( (cache_ptr)->index_size !=                                           \
 
 #define H5C__INSERT_IN_INDEX(cache_ptr, entry_ptr, fail_val)                 \
 {                                                                            \
-    int k;                                                                   \
+    size_t k;                                                                \
     H5C__PRE_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                    \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
-    if(((cache_ptr)->index)[k] != NULL) {                                    \
-        (entry_ptr)->ht_next = ((cache_ptr)->index)[k];                      \
-        (entry_ptr)->ht_next->ht_prev = (entry_ptr);                         \
-    }                                                                        \
-    ((cache_ptr)->index)[k] = (entry_ptr);                                   \
+    if(H5C__INDEX_FULL(cache_ptr))                                           \
+        if(H5C__resize_index((cache_ptr),                                    \
+                             (cache_ptr)->index_len_slots * 2) < 0)          \
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTRESIZE, fail_val,                 \
+                        "can't grow cache index")                            \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
+    while(((cache_ptr)->index)[k].ent_ptr != NULL)                         \
+        k = H5C__INDEX_NEXT_SLOT(cache_ptr, k);                              \
+    ((cache_ptr)->index)[k].addr = (entry_ptr)->addr;                        \
+    ((cache_ptr)->index)[k].ent_ptr = (entry_ptr);                         \
     (cache_ptr)->index_len++;                                                \
     (cache_ptr)->index_size += (entry_ptr)->size;                            \
     ((cache_ptr)->index_ring_len[entry_ptr->ring])++;                        \
@@ -1351,17 +1374,30 @@ if ( ( (cache_ptr)->index_size !=                                           \
 
 #define H5C__DELETE_FROM_INDEX(cache_ptr, entry_ptr, fail_val)               \
 {                                                                            \
-    int k;                                                                   \
+    size_t k, hole, home;                                                    \
     H5C__PRE_HT_REMOVE_SC(cache_ptr, entry_ptr)                              \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
-    if((entry_ptr)->ht_next)                                                 \
-        (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;                \
-    if((entry_ptr)->ht_prev)                                                 \
-        (entry_ptr)->ht_prev->ht_next = (entry_ptr)->ht_next;                \
-    if(((cache_ptr)->index)[k] == (entry_ptr))                               \
-        ((cache_ptr)->index)[k] = (entry_ptr)->ht_next;                      \
-    (entry_ptr)->ht_next = NULL;                                             \
-    (entry_ptr)->ht_prev = NULL;                                             \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
+    while(((cache_ptr)->index)[k].ent_ptr != (entry_ptr)) {                \
+        if(((cache_ptr)->index)[k].ent_ptr == NULL)                        \
+            HGOTO_ERROR(H5E_CACHE, H5E_NOTFOUND, fail_val,                   \
+                        "entry not in cache index")                          \
+        k = H5C__INDEX_NEXT_SLOT(cache_ptr, k);                              \
+    }                                                                        \
+    /* Close the hole by shifting back later slots of the probe run,      */ \
+    /* except those that would then precede their home slot.              */ \
+    hole = k;                                                                \
+    k = H5C__INDEX_NEXT_SLOT(cache_ptr, k);                                  \
+    while(((cache_ptr)->index)[k].ent_ptr != NULL) {                       \
+        home = H5C__HASH_FCN(cache_ptr, ((cache_ptr)->index)[k].addr);       \
+        if(((k - home) & ((cache_ptr)->index_len_slots - 1)) >=              \
+                ((k - hole) & ((cache_ptr)->index_len_slots - 1))) {         \
+            ((cache_ptr)->index)[hole] = ((cache_ptr)->index)[k];            \
+            hole = k;                                                        \
+        }                                                                    \
+        k = H5C__INDEX_NEXT_SLOT(cache_ptr, k);                              \
+    }                                                                        \
+    ((cache_ptr)->index)[hole].addr = HADDR_UNDEF;                           \
+    ((cache_ptr)->index)[hole].ent_ptr = NULL;                             \
     (cache_ptr)->index_len--;                                                \
     (cache_ptr)->index_size -= (entry_ptr)->size;                            \
     ((cache_ptr)->index_ring_len[entry_ptr->ring])--;                        \
@@ -1383,34 +1419,29 @@ if ( ( (cache_ptr)->index_size !=                                           \
     H5C__IL_DLL_REMOVE((entry_ptr), (cache_ptr)->il_head,                    \
                        (cache_ptr)->il_tail, (cache_ptr)->il_len,            \
                        (cache_ptr)->il_size, fail_val)                       \
+    if(H5C__INDEX_SPARSE(cache_ptr))                                         \
+        if(H5C__resize_index((cache_ptr),                                    \
+                             (cache_ptr)->index_len_slots / 2) < 0)          \
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTRESIZE, fail_val,                 \
+                        "can't shrink cache index")                          \
     H5C__UPDATE_STATS_FOR_HT_DELETION(cache_ptr)                             \
     H5C__POST_HT_REMOVE_SC(cache_ptr, entry_ptr)                             \
 }
 
 #define H5C__SEARCH_INDEX(cache_ptr, Addr, entry_ptr, fail_val)             \
 {                                                                           \
-    int k;                                                                  \
+    size_t k;                                                               \
     int depth = 0;                                                          \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
-    entry_ptr = ((cache_ptr)->index)[k];                                    \
-    while(entry_ptr) {                                                      \
-        if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
+    entry_ptr = NULL;                                                       \
+    while(((cache_ptr)->index)[k].ent_ptr != NULL) {                      \
+        if(H5F_addr_eq(Addr, ((cache_ptr)->index)[k].addr)) {               \
+            (entry_ptr) = ((cache_ptr)->index)[k].ent_ptr;                \
             H5C__POST_SUC_HT_SEARCH_SC(cache_ptr, entry_ptr, k, fail_val)   \
-            if(entry_ptr != ((cache_ptr)->index)[k]) {                      \
-                if((entry_ptr)->ht_next)                                    \
-                    (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;   \
-                HDassert((entry_ptr)->ht_prev != NULL);                     \
-                (entry_ptr)->ht_prev->ht_next = (entry_ptr)->ht_next;       \
-                ((cache_ptr)->index)[k]->ht_prev = (entry_ptr);             \
-                (entry_ptr)->ht_next = ((cache_ptr)->index)[k];             \
-                (entry_ptr)->ht_prev = NULL;                                \
-                ((cache_ptr)->index)[k] = (entry_ptr);                      \
-                H5C__POST_HT_SHIFT_TO_FRONT(cache_ptr, entry_ptr, k, fail_val) \
-            }                                                               \
             break;                                                          \
         }                                                                   \
-        (entry_ptr) = (entry_ptr)->ht_next;                                 \
+        k = H5C__INDEX_NEXT_SLOT(cache_ptr, k);                             \
         (depth)++;                                                          \
     }                                                                       \
     H5C__UPDATE_STATS_FOR_HT_SEARCH(cache_ptr, (entry_ptr != NULL), depth)  \
@@ -1418,27 +1449,17 @@ if ( ( (cache_ptr)->index_size !=                                           \
 
 #define H5C__SEARCH_INDEX_NO_STATS(cache_ptr, Addr, entry_ptr, fail_val)    \
 {                                                                           \
-    int k;                                                                  \
+    size_t k;                                                               \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
-    entry_ptr = ((cache_ptr)->index)[k];                                    \
-    while(entry_ptr) {                                                      \
-        if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
+    entry_ptr = NULL;                                                       \
+    while(((cache_ptr)->index)[k].ent_ptr != NULL) {                      \
+        if(H5F_addr_eq(Addr, ((cache_ptr)->index)[k].addr)) {               \
+            (entry_ptr) = ((cache_ptr)->index)[k].ent_ptr;                \
             H5C__POST_SUC_HT_SEARCH_SC(cache_ptr, entry_ptr, k, fail_val)   \
-            if(entry_ptr != ((cache_ptr)->index)[k]) {                      \
-                if((entry_ptr)->ht_next)                                    \
-                    (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;   \
-                HDassert((entry_ptr)->ht_prev != NULL);                     \
-                (entry_ptr)->ht_prev->ht_next = (entry_ptr)->ht_next;       \
-                ((cache_ptr)->index)[k]->ht_prev = (entry_ptr);             \
-                (entry_ptr)->ht_next = ((cache_ptr)->index)[k];             \
-                (entry_ptr)->ht_prev = NULL;                                \
-                ((cache_ptr)->index)[k] = (entry_ptr);                      \
-                H5C__POST_HT_SHIFT_TO_FRONT(cache_ptr, entry_ptr, k, fail_val) \
-            }                                                               \
             break;                                                          \
         }                                                                   \
-        (entry_ptr) = (entry_ptr)->ht_next;                                 \
+        k = H5C__INDEX_NEXT_SLOT(cache_ptr, k);                             \
     }                                                                       \
 }
 
@@ -1511,7 +1532,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
  * Macro:	H5C__INSERT_ENTRY_IN_SLIST
  *
  * Purpose:     Insert the specified instance of H5C_cache_entry_t into
- *		the skip list in the specified instance of H5C_t.  Update
+ *		the slist in the specified instance of H5C_t.  Update
  *		the associated length and size fields.
  *
  * Return:      N/A
@@ -1535,7 +1556,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
  *		wringing a little more speed out of the cache.
  *
  *		Note that we don't bother to check if the entry is already
- *		in the tree -- if it is, H5SL_insert() will fail.
+ *		in the tree.
  *
  *		QAK -- 11/27/04
  *		Switched over to using skip list routines.
@@ -1562,6 +1583,10 @@ if ( ( (cache_ptr)->index_size !=                                           \
  *		Added code to maintain the cache_ptr->slist_ring_len
  *		and cache_ptr->slist_ring_size arrays.
  *
+ *		Replaced the skip list insertion with an append to the
+ *		tail of the slist, which clears cache_ptr->slist_sorted
+ *		if the entry is not above the current tail in address.
+ *
  *-------------------------------------------------------------------------
  */
 
@@ -1572,6 +1597,40 @@ if ( ( (cache_ptr)->index_size !=                                           \
 #define ENTRY_IN_SLIST(cache_ptr, entry_ptr) FALSE
 #endif /* H5C_DO_SLIST_SANITY_CHECKS */
 
+/* Link an entry onto the tail of the slist, or unlink it from the slist.
+ * These maintain the list pointers and the sorted flag only -- the
+ * callers maintain the length and size fields.
+ */
+#define H5C__SLIST_APPEND(cache_ptr, entry_ptr)                                \
+{                                                                              \
+    (entry_ptr)->slist_next = NULL;                                            \
+    (entry_ptr)->slist_prev = (cache_ptr)->slist_tail;                         \
+    if((cache_ptr)->slist_tail == NULL)                                        \
+        (cache_ptr)->slist_head = (entry_ptr);                                 \
+    else {                                                                     \
+        if(H5F_addr_gt((cache_ptr)->slist_tail->addr, (entry_ptr)->addr))      \
+            (cache_ptr)->slist_sorted = FALSE;                                 \
+        (cache_ptr)->slist_tail->slist_next = (entry_ptr);                     \
+    }                                                                          \
+    (cache_ptr)->slist_tail = (entry_ptr);                                     \
+}
+
+#define H5C__SLIST_UNLINK(cache_ptr, entry_ptr)                                \
+{                                                                              \
+    if((entry_ptr)->slist_prev == NULL)                                        \
+        (cache_ptr)->slist_head = (entry_ptr)->slist_next;                     \
+    else                                                                       \
+        (entry_ptr)->slist_prev->slist_next = (entry_ptr)->slist_next;         \
+    if((entry_ptr)->slist_next == NULL)                                        \
+        (cache_ptr)->slist_tail = (entry_ptr)->slist_prev;                     \
+    else                                                                       \
+        (entry_ptr)->slist_next->slist_prev = (entry_ptr)->slist_prev;         \
+    (entry_ptr)->slist_next = NULL;                                            \
+    (entry_ptr)->slist_prev = NULL;                                            \
+    if((cache_ptr)->slist_head == NULL)                                        \
+        (cache_ptr)->slist_sorted = TRUE;                                      \
+}
+
 #if H5C_DO_SANITY_CHECKS
 
 #define H5C__INSERT_ENTRY_IN_SLIST(cache_ptr, entry_ptr, fail_val)             \
@@ -1590,8 +1649,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
     HDassert( (cache_ptr)->slist_ring_size[(entry_ptr)->ring] <=               \
               (cache_ptr)->slist_size );                                       \
                                                                                \
-    if(H5SL_insert((cache_ptr)->slist_ptr, entry_ptr, &(entry_ptr)->addr) < 0) \
-        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, (fail_val), "Can't insert entry in skip list") \
+    H5C__SLIST_APPEND(cache_ptr, entry_ptr)                                    \
                                                                                \
     (entry_ptr)->in_slist = TRUE;                                              \
     (cache_ptr)->slist_changed = TRUE;                                         \
@@ -1625,9 +1683,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
     HDassert( (cache_ptr)->slist_ring_size[(entry_ptr)->ring] <=               \
               (cache_ptr)->slist_size );                                       \
                                                                                \
-    if(H5SL_insert((cache_ptr)->slist_ptr, entry_ptr, &(entry_ptr)->addr) < 0) \
-        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, (fail_val),                       \
-                    "Can't insert entry in skip list")                         \
+    H5C__SLIST_APPEND(cache_ptr, entry_ptr)                                    \
                                                                                \
     (entry_ptr)->in_slist = TRUE;                                              \
     (cache_ptr)->slist_changed = TRUE;                                         \
@@ -1649,8 +1705,8 @@ if ( ( (cache_ptr)->index_size !=                                           \
  * Function:    H5C__REMOVE_ENTRY_FROM_SLIST
  *
  * Purpose:     Remove the specified instance of H5C_cache_entry_t from the
- *		index skip list in the specified instance of H5C_t.  Update
- *		the associated length and size fields.
+ *		slist in the specified instance of H5C_t.  Update the
+ *		associated length and size fields.
  *
  * Return:      N/A
  *
@@ -1669,7 +1725,8 @@ if ( ( (cache_ptr)->index_size !=                                           \
     HDassert( ((entry_ptr)->ro_ref_count) == 0 );                           \
     HDassert( (entry_ptr)->size > 0 );                                      \
     HDassert( (entry_ptr)->in_slist );                                      \
-    HDassert( (cache_ptr)->slist_ptr );                                     \
+    HDassert( ((cache_ptr)->slist_head != NULL) &&                          \
+              ((cache_ptr)->slist_tail != NULL) );                          \
     HDassert( (entry_ptr)->ring > H5C_RING_UNDEFINED );                     \
     HDassert( (entry_ptr)->ring < H5C_RING_NTYPES );                        \
     HDassert( (cache_ptr)->slist_ring_len[(entry_ptr)->ring] <=             \
@@ -1677,9 +1734,12 @@ if ( ( (cache_ptr)->index_size !=                                           \
     HDassert( (cache_ptr)->slist_ring_size[(entry_ptr)->ring] <=            \
               (cache_ptr)->slist_size );                                    \
                                                                             \
-    if ( H5SL_remove((cache_ptr)->slist_ptr, &(entry_ptr)->addr)            \
-             != (entry_ptr) )                                               \
-        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "can't delete entry from skip list") \
+    if ( ( ( (entry_ptr)->slist_prev == NULL ) &&                           \
+           ( (cache_ptr)->slist_head != (entry_ptr) ) ) ||                  \
+         ( ( (entry_ptr)->slist_next == NULL ) &&                           \
+           ( (cache_ptr)->slist_tail != (entry_ptr) ) ) )                   \
+        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL, "can't delete entry from slist") \
+    H5C__SLIST_UNLINK(cache_ptr, entry_ptr)                                 \
                                                                             \
     HDassert( (cache_ptr)->slist_len > 0 );                                 \
     if(!(during_flush))                                                     \
@@ -1706,7 +1766,8 @@ if ( ( (cache_ptr)->index_size !=                                           \
     HDassert( !((entry_ptr)->is_read_only) );                               \
     HDassert( ((entry_ptr)->ro_ref_count) == 0 );                           \
     HDassert( (entry_ptr)->in_slist );                                      \
-    HDassert( (cache_ptr)->slist_ptr );                                     \
+    HDassert( ((cache_ptr)->slist_head != NULL) &&                          \
+              ((cache_ptr)->slist_tail != NULL) );                          \
     HDassert( (entry_ptr)->ring > H5C_RING_UNDEFINED );                     \
     HDassert( (entry_ptr)->ring < H5C_RING_NTYPES );                        \
     HDassert( (cache_ptr)->slist_ring_len[(entry_ptr)->ring] <=             \
@@ -1714,10 +1775,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
     HDassert( (cache_ptr)->slist_ring_size[(entry_ptr)->ring] <=            \
               (cache_ptr)->slist_size );                                    \
                                                                             \
-    if ( H5SL_remove((cache_ptr)->slist_ptr, &(entry_ptr)->addr)            \
-             != (entry_ptr) )                                               \
-        HGOTO_ERROR(H5E_CACHE, H5E_BADVALUE, FAIL,                          \
-                    "Can't delete entry from skip list.")                   \
+    H5C__SLIST_UNLINK(cache_ptr, entry_ptr)                                 \
                                                                             \
     HDassert( (cache_ptr)->slist_len > 0 );                                 \
     if(!(during_flush))                                                     \
@@ -3449,6 +3507,133 @@ typedef struct H5C_tag_info_t {
     hbool_t corked;             /* Whether this object is corked */
 } H5C_tag_info_t;
 
+/****************************************************************************
+ *
+ * structure H5C_flush_stage_t
+ *
+ * Structure describing an entry image copied into the flush staging area
+ * of the cache, to be written with its neighbors once the flush of a ring
+ * is done.  See the flush_stage fields of H5C_t below.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * addr: Base address of the entry image in the file.
+ *
+ * size: Length of the entry image in bytes.
+ *
+ * offset: Offset of the copy of the image in the staging buffer.
+ *
+ * mem_type: Memory type the entry image is written with.  Only images
+ *		with the same memory type are merged into one write.
+ *
+ * seq: Order in which the image was staged.  An entry that is flushed
+ *		twice during a flush is staged twice, and the later image
+ *		must be the one that ends up in the file.
+ *
+ ****************************************************************************/
+typedef struct H5C_flush_stage_t {
+    haddr_t addr;               /* Address of the image in the file */
+    size_t size;                /* Size of the image */
+    size_t offset;              /* Offset of the image in the staging buffer */
+    H5FD_mem_t mem_type;        /* Memory type of the write */
+    size_t seq;                 /* Order in which the image was staged */
+} H5C_flush_stage_t;
+
+/****************************************************************************
+ *
+ * structure H5C_index_slot_t
+ *
+ * Structure of a slot in the open addressing hash table that indexes the
+ * entries of the cache.  See the index fields of H5C_t below.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * addr: Base address of the entry in the slot, or HADDR_UNDEF if the slot
+ *		is empty.  This is a copy of ent_ptr->addr, kept in the
+ *		slot so that probing the table doesn't touch the entries.
+ *
+ * ent_ptr: Pointer to the entry in the slot, or NULL if the slot is
+ *		empty.
+ *
+ ****************************************************************************/
+typedef struct H5C_index_slot_t {
+    haddr_t addr;                       /* Address of the entry */
+    H5C_cache_entry_t *ent_ptr;         /* Entry, or NULL if slot is empty */
+} H5C_index_slot_t;
+
+/****************************************************************************
+ *
+ * structure H5C_image_block_t
+ *
+ * Structure describing one block of entry images in a version 1 metadata
+ * cache image.  Entry images are packed, in image order, into blocks that
+ * are compressed independently, so that an entry image can be recovered
+ * without decoding the whole cache image.  See the pf_* fields of H5C_t
+ * below.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * offset: Offset of the stored block in the cache image.
+ *
+ * raw_len: Length of the block in bytes once decompressed.
+ *
+ * stored_len: Length of the block in bytes as stored in the cache image.
+ *		If stored_len equals raw_len, the block is stored
+ *		uncompressed.
+ *
+ * image: Pointer to a dynamically allocated copy of the stored block, or
+ *		NULL if no prefetched entry is waiting for an image from
+ *		the block.
+ *
+ * pending: Number of prefetched entries waiting for an image from the
+ *		block.  The image of the block is freed when this count 
+ *		drops to zero.
+ *
+ ****************************************************************************/
+typedef struct H5C_image_block_t {
+    size_t offset;              /* Offset of the block in the image */
+    size_t raw_len;             /* Decompressed length of the block */
+    size_t stored_len;          /* Stored length of the block */
+    uint8_t *image;             /* Retained copy of the stored block */
+    uint32_t pending;           /* # of entries waiting for the block */
+} H5C_image_block_t;
+
+/****************************************************************************
+ *
+ * structure H5C_log_trace_t
+ *
+ * Structure holding the state of a binary metadata cache trace.  Trace
+ * records are encoded into buf, and the buffer is written to the log
+ * file once it holds H5C__TRACE_BUF_NRECORDS records, so that recording
+ * an operation costs a few stores in the common case.  See the
+ * H5C__TRACE_* definitions in H5Cprivate.h for the record layout.
+ *
+ * The fields of this structure are discussed individually below:
+ *
+ * sample_interval: Sampling interval of the trace.  When greater than 1,
+ *		only operations on entries whose address hashes to 0 modulo
+ *		sample_interval are recorded.  Sampling by address keeps the
+ *		complete history of every sampled entry, so that a replay
+ *		with the cache size divided by sample_interval approximates
+ *		the behavior of the full trace.
+ *
+ * moved:	Pointer to a skip list of the addresses outside of the sample
+ *		that sampled entries were moved to, or NULL when the trace
+ *		isn't sampled.  Operations at these addresses are recorded
+ *		too, so that an entry stays in the sample when it moves.
+ *
+ * nrecords:	Number of records currently held in buf.
+ *
+ * buf:		Buffer of encoded trace records.
+ *
+ ****************************************************************************/
+typedef struct H5C_log_trace_t {
+    unsigned sample_interval;   /* Record 1 entry in this many */
+    H5SL_t *moved;              /* Addresses sampled entries moved to */
+    size_t nrecords;            /* Number of records in buf */
+    uint8_t buf[H5C__TRACE_BUF_NRECORDS * H5C__TRACE_RECORD_SIZE]; /* Records */
+} H5C_log_trace_t;
+
 
 /****************************************************************************
  *
@@ -3530,6 +3715,15 @@ typedef struct H5C_tag_info_t {
  *              in stdio.h are used to write to the log file regardless of
  *              the VFD selected.
  *
+ * log_format:  Format of the log file.  With H5C_LOG_FORMAT_JSON, each
+ *              operation is written to the log file as a JSON text
+ *              message.  With H5C_LOG_FORMAT_BINARY, operations are
+ *              recorded as binary trace records, buffered in the
+ *              structure pointed to by log_trace_ptr (below).
+ *
+ * log_trace_ptr: Pointer to the state of the binary trace, or NULL if
+ *              log_format is not H5C_LOG_FORMAT_BINARY.
+ *
  * aux_ptr:	Pointer to void used to allow wrapper code to associate
  *		its data with an instance of H5C_t.  The H5C cache code
  *		sets this field to NULL, and otherwise leaves it alone.
@@ -3675,20 +3869,26 @@ typedef struct H5C_tag_info_t {
  *		index by ring.  Note that the sum of all cells in this array 
  *		must equal the value stored in dirty_index_size above.
  *
- * index:	Array of pointer to H5C_cache_entry_t of size
- *		H5C__HASH_TABLE_LEN.  At present, this value is a power
- *		of two, not the usual prime number.
+ * index_len_slots: Number of slots in the index array.  This is always a
+ *		power of two no smaller than H5C__INDEX_MIN_LEN.  The index
+ *		is doubled in size by H5C__resize_index() when an insertion
+ *		would leave it more than 3/4 full, and halved when a deletion
+ *		leaves it less than 1/8 full, so the expected length of a
+ *		probe sequence doesn't grow with the number of entries in
+ *		the cache.
+ *
+ * index_shift: Number of bits the 64 bit multiplicative hash of an
+ *		address is shifted right by H5C__HASH_FCN() to obtain a slot
+ *		number, i.e. 64 - log2(index_len_slots).
  *
- *		I hope that the variable size of cache elements, the large
- *		hash table size, and the way in which HDF5 allocates space
- *		will combine to avoid problems with periodicity.  If so, we
- *		can use a trivial hash function (a bit-and and a 3 bit left
- *		shift) with some small savings.
+ * index:	Dynamically allocated array of H5C_index_slot_t of length
+ *		index_len_slots, used as an open addressing hash table with
+ *		linear probing.  Entries are removed with backward shift
+ *		deletion, so no tombstones are ever left in the table.
  *
- *		If not, it will become evident in the statistics. Changing
- *		to the usual prime number length hash table will require
- *		changing the H5C__HASH_FCN macro and the deletion of the
- *		H5C__HASH_MASK #define.  No other changes should be required.
+ *		Since the slots hold the entry addresses, a search compares
+ *		addresses in consecutive slots of a single array, and
+ *		dereferences only the entry that is found.
  *
  * il_len:	Number of entries on the index list.  
  *
@@ -3769,6 +3969,16 @@ typedef struct H5C_tag_info_t {
  * are flushed. (this has been changed -- dirty entries are now removed from
  * the skip list as they are flushed.  JRM - 10/25/05)
  *
+ * Marking entries dirty is much more frequent than flushing them, and
+ * the allocation and level selection of a skip list insertion showed up
+ * in profiles of metadata heavy writes.  The skip list has therefore been
+ * replaced with a doubly linked list threaded through the slist_next and
+ * slist_prev fields of the dirty entries.  Entries are appended to the
+ * list as they are dirtied, and the list is sorted by address (with a
+ * natural merge sort, which is cheap when most of the list is already in
+ * order) only when H5C__slist_first() is called to start a scan.  The
+ * list is still referred to as the slist.
+ *
  * slist_changed: Boolean flag used to indicate whether the contents of 
  *		the slist has changed since the last time this flag was
  *		reset.  This is used in the cache flush code to detect 
@@ -3794,9 +4004,18 @@ typedef struct H5C_tag_info_t {
  *		slist by ring.  Note that the sum of all cells in this 
  *		array must equal the value stored in slist_size above.
  *
- * slist_ptr:   pointer to the instance of H5SL_t used maintain a sorted
- *              list of dirty entries in the cache.  This sorted list has
- *              two uses:
+ * slist_head:  Pointer to the first entry on the slist, or NULL if the
+ *		slist is empty.
+ *
+ * slist_tail:  Pointer to the last entry on the slist, or NULL if the
+ *		slist is empty.
+ *
+ * slist_sorted: Boolean flag indicating whether the entries on the slist
+ *		are known to be in increasing address order.  It is reset
+ *		when an entry is appended at a lower address than the
+ *		tail of the list, and set again by H5C__slist_first().
+ *
+ *              Keeping the dirty entries in address order has two uses:
  *
  *              a) It allows us to flush dirty entries in increasing address
  *                 order, which results in significant savings.
@@ -3835,6 +4054,46 @@ typedef struct H5C_tag_info_t {
  * 		to the slist since the last time this field was set to
  * 		zero.  Note that this value can be negative.
  *
+ *
+ * Flushing a ring writes its dirty entries in increasing address order,
+ * and the entries are often adjacent in the file.  Rather than issuing
+ * one small write per entry, H5C_flush_ring() and
+ * H5C_flush_invalidate_ring() have H5C__flush_single_entry() copy the
+ * entry images into a staging area.  When the ring has been flushed, or
+ * the staging area is full, or an entry must be read from the file, the
+ * staged images are sorted by address and adjacent images are merged into
+ * a single write.
+ *
+ * coalesce_flush_writes: Boolean flag indicating whether flushes stage
+ *		and merge entry writes as described above.  This field is
+ *		TRUE by default.
+ *
+ * flush_stage_active: Boolean flag indicating whether writes of entry
+ *		images are currently being staged.
+ *
+ * flush_stage_len: Number of entry images currently staged.
+ *
+ * flush_stage_alloc: Number of elements allocated in flush_stage.
+ *
+ * flush_stage: Pointer to the dynamically allocated array of
+ *		H5C_flush_stage_t describing the staged entry images, or
+ *		NULL if it has not been allocated yet.
+ *
+ * flush_stage_buf_len: Number of bytes of entry images currently held in
+ *		flush_stage_buf.
+ *
+ * flush_stage_buf_alloc: Size of the buffer pointed to by flush_stage_buf.
+ *
+ * flush_stage_buf: Pointer to the dynamically allocated buffer holding
+ *		copies of the staged entry images, or NULL if it has not
+ *		been allocated yet.
+ *
+ * flush_stage_images: Number of entry images staged since the cache was
+ *		created.
+ *
+ * flush_stage_writes: Number of writes issued for staged entry images
+ *		since the cache was created.
+ *
  * Cache entries belonging to a particular object are "tagged" with that
  * object's base object header address.
  *
@@ -4183,6 +4442,21 @@ typedef struct H5C_tag_info_t {
  *	this field will be reset every automatic resize epoch.
  *
  *
+ * Per entry type statistics fields:
+ *
+ * As with the cache hit rate, a small set of statistics on each entry 
+ * type is maintained regardless of whether statistics collection is 
+ * enabled, so that cache behavior can be examined in production builds.
+ *
+ * type_stats: Array of H5C_type_stats_t of length 
+ *	H5C__MAX_NUM_TYPE_IDS + 1.  The cells are used to record the hits,
+ *	misses, loads, evictions, flushes, bytes read and written, and 
+ *	time spent in the serialize and deserialize callbacks for each 
+ *	entry type since the cache was created, or since the last call to
+ *	H5C_reset_cache_type_stats().  Unlike the cache hit rate fields,
+ *	these fields are not reset by the automatic cache resize code.
+ *
+ *
  * Metadata cache image management related fields.
  *
  * image_ctl:	Instance of H5C_cache_image_ctl_t containing configuration
@@ -4285,6 +4559,32 @@ typedef struct H5C_tag_info_t {
  *		image_len in which the metadata cache image is assembled, 
  *		or NULL if that	buffer does not exist.
  *
+ * Version 1 metadata cache images store the entry images in independently
+ * compressed blocks.  When such an image is loaded, the prefetched entries
+ * are created without their images, and the image of each entry is only
+ * extracted from its block when the entry is first protected (or must be
+ * written).  The following fields retain the stored blocks, each until
+ * all prefetched entries with an image in it have been loaded or evicted.
+ *
+ * pf_num_blocks: Number of entry image blocks in the cache image.
+ *
+ * pf_blocks: Pointer to a dynamically allocated array of pf_num_blocks
+ *		instances of H5C_image_block_t describing the blocks of
+ *		the cache image, or NULL if no prefetched entry is waiting
+ *		for its image.
+ *
+ * pf_block_buf: Buffer holding the most recently decompressed block, so
+ *		that entries loaded from the same block in succession only
+ *		decompress it once.  The buffer is large enough for the 
+ *		largest block in the image.
+ *
+ * pf_block_loaded: Index of the block in pf_block_buf, or -1 if 
+ *		pf_block_buf holds no valid block.
+ *
+ * pf_pending: Number of prefetched entries in the cache whose image has
+ *		not been extracted yet.  pf_blocks and the associated 
+ *		buffers are freed when this count drops to zero.
+ *
  *
  * Free Space Manager Related fields:
  *
@@ -4639,6 +4939,8 @@ struct H5C_t {
     hbool_t                     logging_enabled;
     hbool_t                     currently_logging;
     FILE *			log_file_ptr;
+    H5C_log_format_t		log_format;
+    H5C_log_trace_t *		log_trace_ptr;
     void *			aux_ptr;
     int32_t			max_type_id;
     const H5C_class_t * const   *class_table_ptr;
@@ -4659,7 +4961,9 @@ struct H5C_t {
     size_t			clean_index_ring_size[H5C_RING_NTYPES];
     size_t			dirty_index_size;
     size_t			dirty_index_ring_size[H5C_RING_NTYPES];
-    H5C_cache_entry_t *	        index[H5C__HASH_TABLE_LEN];
+    size_t                      index_len_slots;
+    unsigned                    index_shift;
+    H5C_index_slot_t *          index;
     uint32_t                    il_len;
     size_t                      il_size;
     H5C_cache_entry_t *	        il_head;
@@ -4676,13 +4980,27 @@ struct H5C_t {
     size_t                      slist_size;
     uint32_t			slist_ring_len[H5C_RING_NTYPES];
     size_t			slist_ring_size[H5C_RING_NTYPES];
-    H5SL_t *                    slist_ptr;
+    H5C_cache_entry_t *         slist_head;
+    H5C_cache_entry_t *         slist_tail;
+    hbool_t                     slist_sorted;
     uint32_t                    num_last_entries;
 #if H5C_DO_SANITY_CHECKS
     int64_t			slist_len_increase;
     int64_t			slist_size_increase;
 #endif /* H5C_DO_SANITY_CHECKS */
 
+    /* Fields for staging and merging entry writes during a flush */
+    hbool_t                     coalesce_flush_writes;
+    hbool_t                     flush_stage_active;
+    size_t                      flush_stage_len;
+    size_t                      flush_stage_alloc;
+    H5C_flush_stage_t *         flush_stage;
+    size_t                      flush_stage_buf_len;
+    size_t                      flush_stage_buf_alloc;
+    uint8_t *                   flush_stage_buf;
+    int64_t                     flush_stage_images;
+    int64_t                     flush_stage_writes;
+
     /* Fields for maintaining list of tagged entries */
     H5SL_t *                    tag_list;
     hbool_t                     ignore_tags;
@@ -4752,6 +5070,9 @@ struct H5C_t {
     int64_t			cache_hits;
     int64_t			cache_accesses;
 
+    /* Fields for per entry type statistics */
+    H5C_type_stats_t		type_stats[H5C__MAX_NUM_TYPE_IDS + 1];
+
     /* fields supporting generation of a cache image on file close */
     H5C_cache_image_ctl_t	image_ctl;
     hbool_t			serialization_in_progress;
@@ -4768,6 +5089,11 @@ struct H5C_t {
     uint32_t			num_entries_in_image;
     H5C_image_entry_t *		image_entries;
     void *                      image_buffer;
+    uint32_t                    pf_num_blocks;
+    H5C_image_block_t *         pf_blocks;
+    uint8_t *                   pf_block_buf;
+    int64_t                     pf_block_loaded;
+    uint32_t                    pf_pending;
 
     /* Free Space Manager Related fields */
     hbool_t 			rdfsm_settled;
@@ -4885,6 +5211,11 @@ H5_DLL herr_t H5C__flush_single_entry(H5F_t *f, hid_t dxpl_id,
     H5C_cache_entry_t *entry_ptr, unsigned flags);
 H5_DLL herr_t H5C__generate_cache_image(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr);
 H5_DLL herr_t H5C__load_cache_image(H5F_t *f, hid_t dxpl_id);
+H5_DLL herr_t H5C__load_prefetched_entry_image(H5C_t *cache_ptr,
+    H5C_cache_entry_t *entry_ptr);
+H5_DLL herr_t H5C__release_prefetched_entry_image(H5C_t *cache_ptr,
+    H5C_cache_entry_t *entry_ptr);
+H5_DLL herr_t H5C__discard_cache_image(H5C_t *cache_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_serialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_unserialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__make_space_in_cache(H5F_t * f, hid_t   dxpl_id,
@@ -4894,6 +5225,8 @@ H5_DLL herr_t H5C__generate_image(H5F_t *f, H5C_t *cache_ptr,
     H5C_cache_entry_t *entry_ptr, hid_t dxpl_id);
 H5_DLL herr_t H5C__iter_tagged_entries(H5C_t *cache, haddr_t tag, hbool_t match_global,
     H5C_tag_iter_cb_t cb, void *cb_ctx);
+H5_DLL herr_t H5C__resize_index(H5C_t *cache_ptr, size_t new_len_slots);
+H5_DLL H5C_cache_entry_t *H5C__slist_first(H5C_t *cache_ptr);
 
 /* Routines for operating on entry tags */
 H5_DLL herr_t H5C__tag_entry(H5C_t * cache_ptr, H5C_cache_entry_t * entry_ptr,
@@ -19,24 +19,49 @@
  *              December 28 2016
  *              Quincey Koziol
  *
- * Purpose:     Metadata cache prefetched entry callbacks.
+ * Purpose:     Metadata cache prefetched entry callbacks, and routines
+ *		for speculatively loading entries into the cache as
+ *		prefetched entries.
  *
  *-------------------------------------------------------------------------
  */
 
+/****************/
+/* Module Setup */
+/****************/
+
+#include "H5Cmodule.h"          /* This source code file is part of the H5C module */
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+
 
 /***********/
 /* Headers */
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
 #include "H5ACprivate.h"        /* Metadata cache                       */
+#include "H5Cpkg.h"		/* Cache				*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"		/* Files				*/
 #include "H5FLprivate.h"        /* Free Lists                           */
+#include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5MMprivate.h"	/* Memory management			*/
+#include "H5Pprivate.h"		/* Property lists			*/
 
 
 /****************/
 /* Local Macros */
 /****************/
+#if H5C_DO_MEMORY_SANITY_CHECKS
+#define H5C_IMAGE_EXTRA_SPACE 8
+#define H5C_IMAGE_SANITY_VALUE "DeadBeef"
+#else /* H5C_DO_MEMORY_SANITY_CHECKS */
+#define H5C_IMAGE_EXTRA_SPACE 0
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+
+/* Largest gap between two entries to be prefetched that is read along
+ * with them, rather than starting a new read.
+ */
+#define H5C__PREFETCH_MAX_GAP   4096
 
 
 /******************/
@@ -48,6 +73,10 @@
 /* Local Prototypes */
 /********************/
 
+static int H5C__prefetch_cmp_addr(const void *_p1, const void *_p2);
+static herr_t H5C__prefetch_entry(H5C_t *cache_ptr, hid_t dxpl_id,
+    const H5C_prefetch_t *pf, const uint8_t *image, H5C_ring_t ring);
+
 /****************************************************************************
  *
  * Declarations for prefetched cache entry callbacks.
@@ -350,3 +379,266 @@ H5C__prefetched_entry_fsf_size(const void H5_ATTR_UNUSED *thing,
     FUNC_LEAVE_NOAPI(FAIL)
 } /* end H5C__prefetched_entry_fsf_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_prefetch_entries
+ *
+ * Purpose:     Speculatively load the described entries into the cache
+ *		as prefetched entries, so that a later protect of each of
+ *		them is satisfied without a read.
+ *
+ *		The entries are sorted by address, and each run of entries
+ *		of the same memory type separated by no more than
+ *		H5C__PREFETCH_MAX_GAP bytes is read with a single call to
+ *		H5F_block_read().  Optional entries are only loaded if
+ *		they fall in the same run as a required entry.  Entries
+ *		that are already in the cache, that would push the cache
+ *		over its maximum size, or whose images fail their checksum
+ *		are skipped -- they will be loaded (or the error reported)
+ *		by the protect call in the usual way.
+ *
+ *		The array of entries is sorted and compacted in place.
+ *		Each entry is tagged with the tag in the dxpl, and placed
+ *		in its ring.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_prefetch_entries(H5F_t *f, hid_t dxpl_id, size_t nentries,
+    H5C_prefetch_t *entries)
+{
+    H5C_t *             cache_ptr;
+    H5P_genplist_t *    dxpl;                   /* Data transfer property list */
+    H5C_ring_t          ring = H5C_RING_UNDEFINED; /* Ring of the entries */
+    size_t              npf;                    /* # of entries to prefetch */
+    size_t              total_len = 0;          /* Total size of entries to prefetch */
+    uint8_t *           read_buf = NULL;        /* Buffer for reads */
+    size_t              read_buf_len = 0;       /* Size of read buffer */
+    haddr_t             bound;                  /* End/start of the nearest kept entry */
+    size_t              u, v, w;                /* Local index variables */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    cache_ptr = f->shared->cache;
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(entries || 0 == nentries);
+
+#ifdef H5_HAVE_PARALLEL
+    /* Metadata reads are coordinated between the processes in parallel --
+     * don't read behind the back of the cache.
+     */
+    if(H5F_HAS_FEATURE(f, H5FD_FEAT_HAS_MPI))
+        HGOTO_DONE(SUCCEED)
+#endif /* H5_HAVE_PARALLEL */
+
+    /* Drop the entries that can't be prefetched, or are already cached */
+    for(u = 0, npf = 0; u < nentries; u++) {
+        H5C_cache_entry_t *entry_ptr;   /* Entry in the cache at the address */
+
+        HDassert(entries[u].type);
+        HDassert(entries[u].type->mem_type == cache_ptr->class_table_ptr[entries[u].type->id]->mem_type);
+        HDassert(!(entries[u].type->flags & (H5C__CLASS_SPECULATIVE_LOAD_FLAG | H5C__CLASS_SKIP_READS)));
+
+        if(!H5F_addr_defined(entries[u].addr) || 0 == entries[u].len || entries[u].len >= H5C_MAX_ENTRY_SIZE)
+            continue;
+
+        H5C__SEARCH_INDEX(cache_ptr, entries[u].addr, entry_ptr, FAIL)
+        if(entry_ptr != NULL)
+            continue;
+
+        entries[npf++] = entries[u];
+    } /* end for */
+    if(npf > 1)
+        HDqsort(entries, npf, sizeof(H5C_prefetch_t), H5C__prefetch_cmp_addr);
+
+    /* Keep the optional entries that are near a kept entry before or
+     * after them, then drop the rest while the entries fit in the cache.
+     */
+    for(u = 0, bound = HADDR_UNDEF; u < npf; u++) {
+        if(entries[u].optional && H5F_addr_defined(bound) && H5F_addr_le(entries[u].addr, bound + H5C__PREFETCH_MAX_GAP))
+            entries[u].optional = FALSE;
+        if(!entries[u].optional)
+            bound = entries[u].addr + entries[u].len;
+    } /* end for */
+    for(u = npf, bound = HADDR_UNDEF; u > 0; u--) {
+        if(entries[u - 1].optional && H5F_addr_defined(bound) && H5F_addr_ge(entries[u - 1].addr + entries[u - 1].len + H5C__PREFETCH_MAX_GAP, bound))
+            entries[u - 1].optional = FALSE;
+        if(!entries[u - 1].optional)
+            bound = entries[u - 1].addr;
+    } /* end for */
+    for(u = 0, v = 0; u < npf; u++)
+        if(!entries[u].optional && cache_ptr->index_size + total_len + entries[u].len <= cache_ptr->max_cache_size) {
+            total_len += entries[u].len;
+            entries[v++] = entries[u];
+        } /* end if */
+    npf = v;
+    if(0 == npf)
+        HGOTO_DONE(SUCCEED)
+
+    /* Get the ring type from the DXPL */
+    if(NULL == (dxpl = (H5P_genplist_t *)H5I_object_verify(dxpl_id, H5I_GENPROP_LST)))
+        HGOTO_ERROR(H5E_CACHE, H5E_BADTYPE, FAIL, "not a property list")
+    if((H5P_get(dxpl, H5AC_RING_NAME, &ring)) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTGET, FAIL, "unable to query ring value")
+
+    for(u = 0; u < npf; u = v) {
+        haddr_t run_end = entries[u].addr + entries[u].len;    /* End of the current run */
+        size_t run_len;                                         /* Length of the current run */
+
+        /* Find the entries close enough to this one to read with it,
+         * dropping any that overlap the entries before them.
+         */
+        for(v = u + 1; v < npf; v++) {
+            if(H5F_addr_lt(entries[v].addr, run_end))
+                entries[v].len = 0;
+            else if(H5F_addr_gt(entries[v].addr, run_end + H5C__PREFETCH_MAX_GAP)
+                    || entries[v].type->mem_type != entries[u].type->mem_type)
+                break;
+            else
+                run_end = entries[v].addr + entries[v].len;
+        } /* end for */
+        run_len = (size_t)(run_end - entries[u].addr);
+
+        /* Read the run */
+        if(run_len > read_buf_len) {
+            uint8_t *new_buf;
+
+            if(NULL == (new_buf = (uint8_t *)H5MM_realloc(read_buf, run_len)))
+                HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetch buffer")
+            read_buf = new_buf;
+            read_buf_len = run_len;
+        } /* end if */
+        if(H5F_block_read(f, entries[u].type->mem_type, entries[u].addr, run_len, dxpl_id, read_buf) < 0)
+            HGOTO_ERROR(H5E_CACHE, H5E_READERROR, FAIL, "can't read entries to prefetch")
+
+        /* Load the entries in the run into the cache */
+        for(w = u; w < v; w++)
+            if(entries[w].len > 0)
+                if(H5C__prefetch_entry(cache_ptr, dxpl_id, &entries[w], read_buf + (entries[w].addr - entries[u].addr), ring) < 0)
+                    HGOTO_ERROR(H5E_CACHE, H5E_CANTLOAD, FAIL, "can't prefetch entry")
+    } /* end for */
+
+done:
+    if(read_buf)
+        read_buf = (uint8_t *)H5MM_xfree(read_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_prefetch_entries() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prefetch_cmp_addr
+ *
+ * Purpose:     Compare two entries to be prefetched by address, for
+ *		HDqsort().
+ *
+ * Return:      -1, 0, or 1 as P1 sorts before, with, or after P2.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5C__prefetch_cmp_addr(const void *_p1, const void *_p2)
+{
+    const H5C_prefetch_t *p1 = (const H5C_prefetch_t *)_p1;
+    const H5C_prefetch_t *p2 = (const H5C_prefetch_t *)_p2;
+
+    if(H5F_addr_lt(p1->addr, p2->addr))
+        return -1;
+    if(H5F_addr_gt(p1->addr, p2->addr))
+        return 1;
+    return 0;
+} /* H5C__prefetch_cmp_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C__prefetch_entry
+ *
+ * Purpose:     Create a prefetched entry for the described entry from a
+ *		copy of the supplied image, and insert it in the cache.  If the
+ *		image fails its checksum, do nothing.
+ *
+ *		The entry is appended to the LRU, so that prefetched
+ *		entries that are never used are the first to be evicted.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5C__prefetch_entry(H5C_t *cache_ptr, hid_t dxpl_id, const H5C_prefetch_t *pf,
+    const uint8_t *image, H5C_ring_t ring)
+{
+    const H5C_class_t *type = pf->type;         /* Class of the entry */
+    haddr_t addr = pf->addr;                    /* Address of the entry */
+    size_t len = pf->len;                       /* Size of the entry */
+    H5C_cache_entry_t *pf_entry_ptr = NULL;     /* Prefetched entry */
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(type);
+    HDassert(H5F_addr_defined(addr));
+    HDassert(len > 0 && len < H5C_MAX_ENTRY_SIZE);
+    HDassert(image);
+
+    /* Skip entries with a bad checksum, the protect will retry the read */
+    if(type->verify_chksum && !type->verify_chksum(image, len, pf->udata))
+        HGOTO_DONE(SUCCEED)
+
+    /* Allocate space for the prefetched cache entry */
+    if(NULL == (pf_entry_ptr = H5FL_CALLOC(H5C_cache_entry_t)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for prefetched cache entry")
+
+    /* Allocate buffer for entry image, and copy the image into it */
+    if(NULL == (pf_entry_ptr->image_ptr = H5MM_malloc(len + H5C_IMAGE_EXTRA_SPACE)))
+	HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "memory allocation failed for on disk image buffer")
+#if H5C_DO_MEMORY_SANITY_CHECKS
+    HDmemcpy(((uint8_t *)pf_entry_ptr->image_ptr) + len, H5C_IMAGE_SANITY_VALUE, H5C_IMAGE_EXTRA_SPACE);
+#endif /* H5C_DO_MEMORY_SANITY_CHECKS */
+    HDmemcpy(pf_entry_ptr->image_ptr, image, len);
+
+    /* Initialize the fields of the prefetched entry */
+    /* (Only need to set non-zero/NULL/FALSE fields, due to calloc() above) */
+    pf_entry_ptr->magic                 = H5C__H5C_CACHE_ENTRY_T_MAGIC;
+    pf_entry_ptr->cache_ptr             = cache_ptr;
+    pf_entry_ptr->addr                  = addr;
+    pf_entry_ptr->size                  = len;
+    pf_entry_ptr->image_up_to_date      = TRUE;
+    pf_entry_ptr->type                  = H5AC_PREFETCHED_ENTRY;
+    pf_entry_ptr->ring                  = ring;
+    pf_entry_ptr->prefetched            = TRUE;
+    pf_entry_ptr->prefetch_type_id      = type->id;
+    H5C__RESET_CACHE_ENTRY_STATS(pf_entry_ptr);
+
+    /* Tag the entry, so it goes with the object it belongs to */
+    if(H5C__tag_entry(cache_ptr, pf_entry_ptr, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_CANTTAG, FAIL, "Cannot tag metadata entry")
+
+    /* Insert the entry in the cache */
+    H5C__INSERT_IN_INDEX(cache_ptr, pf_entry_ptr, FAIL)
+    H5C__UPDATE_RP_FOR_INSERT_APPEND(cache_ptr, pf_entry_ptr, FAIL)
+    H5C__UPDATE_STATS_FOR_PREFETCH(cache_ptr, FALSE)
+
+    pf_entry_ptr = NULL;
+
+done:
+    if(pf_entry_ptr) {
+        if(pf_entry_ptr->tag_info && H5C__untag_entry(cache_ptr, pf_entry_ptr) < 0)
+            HDONE_ERROR(H5E_CACHE, H5E_CANTREMOVE, FAIL, "can't remove entry from tag list")
+        if(pf_entry_ptr->image_ptr)
+            pf_entry_ptr->image_ptr = H5MM_xfree(pf_entry_ptr->image_ptr);
+        pf_entry_ptr = H5FL_FREE(H5C_cache_entry_t, pf_entry_ptr);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__prefetch_entry() */
@@ -68,6 +68,10 @@
 /* Flags for cache client class behavior */
 #define H5C__CLASS_NO_FLAGS_SET             ((unsigned)0x0)
 #define H5C__CLASS_SPECULATIVE_LOAD_FLAG    ((unsigned)0x1)
+/* The client's load callbacks write to the image (even if they restore it),
+ * so it can't be loaded from read-only mapped file memory.
+ */
+#define H5C__CLASS_MODIFIES_IMAGE_FLAG      ((unsigned)0x8)
 /* The following flags may only appear in test code */
 #define H5C__CLASS_SKIP_READS               ((unsigned)0x2)
 #define H5C__CLASS_SKIP_WRITES              ((unsigned)0x4)
@@ -80,10 +84,9 @@
 /* Upper and lower limits on cache size.  These limits are picked
  * out of a hat -- you should be able to change them as necessary.
  *
- * However, if you need a very big cache, you should also increase the
- * size of the hash table (H5C__HASH_TABLE_LEN in H5Cpkg.h).  The current
- * upper bound on cache size is rather large for the current hash table
- * size.
+ * The hash table that indexes the cache grows and shrinks with the number
+ * of entries in the cache, so its size need not be considered when
+ * changing these limits.
  */
 #define H5C__MAX_MAX_CACHE_SIZE		((size_t)(128 * 1024 * 1024))
 #define H5C__MIN_MAX_CACHE_SIZE		((size_t)(1024))
@@ -114,7 +117,7 @@
 /* Cache configuration versions */
 #define H5C__CURR_AUTO_SIZE_CTL_VER		1
 #define H5C__CURR_AUTO_RESIZE_RPT_FCN_VER	1
-#define H5C__CURR_CACHE_IMAGE_CTL_VER		1
+#define H5C__CURR_CACHE_IMAGE_CTL_VER		2
 
 /* Default configuration settings */
 #define H5C__DEF_AR_UPPER_THRESHHOLD		0.9999f
@@ -222,6 +225,48 @@
 #define H5C_DO_EXTREME_SANITY_CHECKS	0
 #endif /* NDEBUG */
 
+/* Binary metadata cache trace format.
+ *
+ * A binary trace starts with a header of H5C__TRACE_HEADER_SIZE bytes:
+ *
+ *      signature       8 bytes ("HDF5MDCT")
+ *      version         4 bytes
+ *      sample interval 4 bytes
+ *
+ * followed by records of H5C__TRACE_RECORD_SIZE bytes each:
+ *
+ *      operation       1 byte  (H5C__TRACE_OP_*)
+ *      type id         1 byte
+ *      flags           2 bytes (low bits of the H5C__*_FLAG flags)
+ *      size            4 bytes
+ *      address         8 bytes
+ *      new address     8 bytes (moves only, undefined otherwise)
+ *
+ * All values are encoded little-endian.  Records are collected in a
+ * buffer of H5C__TRACE_BUF_NRECORDS records that is written to the log
+ * file when it fills, and when logging is stopped or torn down.
+ */
+#define H5C__TRACE_SIGNATURE            "HDF5MDCT"
+#define H5C__TRACE_SIGNATURE_LEN        8
+#define H5C__TRACE_VERSION              1
+#define H5C__TRACE_HEADER_SIZE          16
+#define H5C__TRACE_RECORD_SIZE          24
+#define H5C__TRACE_BUF_NRECORDS         4096
+
+/* Operations recorded in a binary metadata cache trace */
+#define H5C__TRACE_OP_INSERT            1
+#define H5C__TRACE_OP_PROTECT           2
+#define H5C__TRACE_OP_UNPROTECT         3
+#define H5C__TRACE_OP_MARK_DIRTY        4
+#define H5C__TRACE_OP_PIN               5
+#define H5C__TRACE_OP_UNPIN             6
+#define H5C__TRACE_OP_RESIZE            7
+#define H5C__TRACE_OP_MOVE              8
+#define H5C__TRACE_OP_EXPUNGE           9
+#define H5C__TRACE_OP_REMOVE            10
+#define H5C__TRACE_OP_FLUSH             11
+#define H5C__TRACE_OP_EVICT             12
+
 /* Cork actions: cork/uncork/get cork status of an object */
 #define H5C__SET_CORK                  0x1
 #define H5C__UNCORK                    0x2
@@ -908,6 +953,19 @@ typedef struct H5C_class_t {
     H5C_get_fsf_size_t		fsf_size;
 } H5C_class_t;
 
+/* Description of an entry to load with H5C_prefetch_entries().  An
+ * optional entry is only read if it is close enough in the file to a
+ * required one to be read along with it.  The udata pointer is passed
+ * to the verify_chksum callback of the class only.
+ */
+typedef struct H5C_prefetch_t {
+    const H5C_class_t *		type;
+    haddr_t			addr;
+    size_t			len;
+    void *			udata;
+    hbool_t			optional;
+} H5C_prefetch_t;
+
 /* Type defintions of callback functions used by the cache as a whole */
 typedef herr_t (*H5C_write_permitted_func_t)(const H5F_t *f,
     hbool_t *write_permitted_ptr);
@@ -976,8 +1034,8 @@ typedef int H5C_ring_t;
  * structure H5C_cache_entry_t
  *
  * Instances of the H5C_cache_entry_t structure are used to store cache
- * entries in a hash table and sometimes in a skip list.
- * See H5SL.c for the particulars of the skip list.
+ * entries in a hash table and, when dirty, on the slist -- a list of
+ * dirty entries sorted by address when a flush needs it.
  *
  * In typical application, this structure is the first field in a
  * structure to be cached.  For historical reasons, the external module
@@ -1119,6 +1177,11 @@ typedef int H5C_ring_t;
  *              Update: Dirty entries are now removed from the skip list
  *			when they are flushed.
  *
+ *		Update: The skip list has been replaced with a linked list
+ *			of dirty entries that is sorted only when it is
+ *			scanned.  See the slist_next and slist_prev fields
+ *			below.
+ *
  * flush_marker:  Boolean flag indicating that the entry is to be flushed
  *		the next time H5C_flush_cache() is called with the
  *		H5C__FLUSH_MARKED_ENTRIES_FLAG.  The flag is reset when
@@ -1233,9 +1296,9 @@ typedef int H5C_ring_t;
  *
  * Fields supporting the hash table:
  *
- * Entries in the cache are indexed by a more or less conventional hash table.
- * If there are multiple entries in any hash bin, they are stored in a doubly
- * linked list.
+ * Entries in the cache are indexed by an open addressing hash table, whose
+ * slots hold the address of each entry along with a pointer to it.  See
+ * the discussion of the index field of H5C_t in H5Cpkg.h.
  *
  * Addendum:  JRM -- 10/14/15
  *
@@ -1246,16 +1309,6 @@ typedef int H5C_ring_t;
  * The il_next and il_prev fields discussed below were added to support
  * the index list.
  *
- * ht_next:	Next pointer used by the hash table to store multiple
- *		entries in a single hash bin.  This field points to the
- *		next entry in the doubly linked list of entries in the
- *		hash bin, or NULL if there is no next entry.
- *
- * ht_prev:     Prev pointer used by the hash table to store multiple
- *              entries in a single hash bin.  This field points to the
- *              previous entry in the doubly linked list of entries in
- *		the hash bin, or NULL if there is no previuos entry.
- *
  * il_next:	Next pointer used by the index to maintain a doubly linked
  *		list of all entries in the index (and thus in the cache).
  *		This field contains a pointer to the next entry in the 
@@ -1267,6 +1320,20 @@ typedef int H5C_ring_t;
  *		index list, or NULL if there is no previous entry.
  *
  *
+ * Fields supporting the slist:
+ *
+ * Dirty entries are kept on a doubly linked list (the slist), which is
+ * sorted in increasing address order before the flush code scans it.
+ *
+ * slist_next:	Next pointer used to maintain the slist.  This field
+ *		points to the next entry in the slist, or NULL if there
+ *		is no next entry.
+ *
+ * slist_prev:	Prev pointer used to maintain the slist.  This field
+ *		points to the previous entry in the slist, or NULL if
+ *		there is no previous entry.
+ *
+ *
  * Fields supporting replacement policies:
  *
  * The cache must have a replacement policy, and it will usually be
@@ -1511,6 +1578,21 @@ typedef int H5C_ring_t;
  *
  *		This field must be zero if prefetched is FALSE.  
  *
+ * pf_image_pending: Boolean flag indicating that the entry is a prefetched
+ *		entry loaded from a version 1 cache image, whose image has
+ *		not been extracted from its retained cache image block yet.  In
+ *		this case image_ptr is NULL, and the image is located by
+ *		the pf_block and pf_block_offset fields below.
+ *
+ *		This field must be FALSE if prefetched is FALSE.
+ *
+ * pf_block:	Index of the cache image block holding the image of the
+ *		entry.  Undefined if pf_image_pending is FALSE.
+ *
+ * pf_block_offset: Offset of the image of the entry in its cache image
+ *		block, once the block is decompressed.  Undefined if 
+ *		pf_image_pending is FALSE.
+ *
  * serialization_count:  Integer field used to maintain a count of the 
  *		number of times each entry is serialized during cache 
  *		serialization.  While no entry should be serialized more than
@@ -1600,11 +1682,13 @@ typedef struct H5C_cache_entry_t {
     hbool_t			pinned_from_cache;
 
     /* fields supporting the hash table: */
-    struct H5C_cache_entry_t   *ht_next;
-    struct H5C_cache_entry_t   *ht_prev;
     struct H5C_cache_entry_t   *il_next;
     struct H5C_cache_entry_t   *il_prev;
 
+    /* fields supporting the slist: */
+    struct H5C_cache_entry_t   *slist_next;
+    struct H5C_cache_entry_t   *slist_prev;
+
     /* fields supporting replacement policies: */
     struct H5C_cache_entry_t   *next;
     struct H5C_cache_entry_t   *prev;
@@ -1627,6 +1711,9 @@ typedef struct H5C_cache_entry_t {
     hbool_t                     prefetched;
     int                         prefetch_type_id;
     int32_t                     age;
+    hbool_t                     pf_image_pending;
+    uint32_t                    pf_block;
+    size_t                      pf_block_offset;
 
 #ifndef NDEBUG	/* debugging field */
     int                         serialization_count;
@@ -2146,6 +2233,10 @@ typedef struct H5C_auto_size_ctl_t {
  *      current value, any value in excess of 255 will be the functional 
  *      equivalent of H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE.
  *
+ * compress_image: Boolean flag indicating whether the entry images in the
+ *      cache image should be compressed.  If FALSE, a version 0 cache
+ *      image is written.
+ *
  * flags: Unsigned integer containing flags controling which aspects of the
  *	cache image functinality is actually executed.  The primary impetus 
  *	behind this field is to allow developement of tests for partial 
@@ -2172,6 +2263,7 @@ typedef struct H5C_auto_size_ctl_t {
     /* generate_image     = */ FALSE,                                 \
     /* save_resize_status = */ FALSE,                                 \
     /* entry_ageout       = */ H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE, \
+    /* compress_image     = */ FALSE,                                 \
     /* flags              = */ H5C_CI__ALL_FLAGS                      \
 }
 
@@ -2180,9 +2272,73 @@ typedef struct H5C_cache_image_ctl_t {
     hbool_t				generate_image;
     hbool_t                             save_resize_status;
     int32_t                             entry_ageout;
+    hbool_t                             compress_image;
     unsigned				flags;
 } H5C_cache_image_ctl_t;
 
+
+/* Formats for the metadata cache log */
+typedef enum H5C_log_format_t {
+    H5C_LOG_FORMAT_JSON = 0,    /* One JSON text message per operation */
+    H5C_LOG_FORMAT_BINARY       /* Buffered, fixed size binary records */
+} H5C_log_format_t;
+
+
+/****************************************************************************
+ *
+ * structure H5C_type_stats_t
+ *
+ * Instances of H5C_type_stats_t are used to accumulate statistics on 
+ * the activity of the cache for a single entry type.  Unlike the 
+ * statistics maintained when H5C_COLLECT_CACHE_STATS is TRUE, these 
+ * statistics are always collected, and are cheap enough to maintain in 
+ * production builds.  They are reset only on request.
+ *
+ * The fields of the structure are discussed individually below:
+ *
+ * hits:	Number of times an entry of the type was protected while 
+ *		it was resident in the cache.
+ *
+ * misses:	Number of times an entry of the type was protected while 
+ *		it was not resident in the cache.
+ *
+ * loads:	Number of entries of the type that have been deserialized,
+ *		either after being read from file, or from their images
+ *		in a metadata cache image.
+ *
+ * evictions:	Number of entries of the type that have been evicted or 
+ *		otherwise removed from the cache.
+ *
+ * flushes:	Number of entries of the type that have been written to 
+ *		file.
+ *
+ * bytes_read:	Number of bytes read from file to load entries of the 
+ *		type.  Entries loaded from a metadata cache image do not 
+ *		contribute to this count.
+ *
+ * bytes_written: Number of bytes written to file when flushing entries 
+ *		of the type.
+ *
+ * deserialize_time: Total time in seconds spent in the deserialize 
+ *		callback of the type.
+ *
+ * serialize_time: Total time in seconds spent in the serialize callback 
+ *		of the type.
+ *
+ ****************************************************************************/
+
+typedef struct H5C_type_stats_t {
+    int64_t				hits;
+    int64_t				misses;
+    int64_t				loads;
+    int64_t				evictions;
+    int64_t				flushes;
+    int64_t				bytes_read;
+    int64_t				bytes_written;
+    double				deserialize_time;
+    double				serialize_time;
+} H5C_type_stats_t;
+
 /***************************************/
 /* Library-private Function Prototypes */
 /***************************************/
@@ -2191,13 +2347,17 @@ H5_DLL H5C_t *H5C_create(size_t max_cache_size, size_t min_clean_size,
     int max_type_id, const H5C_class_t * const *class_table_ptr,
     H5C_write_permitted_func_t check_write_permitted, hbool_t write_permitted,
     H5C_log_flush_func_t log_flush, void *aux_ptr);
-H5_DLL herr_t H5C_set_up_logging(H5C_t *cache_ptr, const char log_location[], hbool_t start_immediately);
+H5_DLL herr_t H5C_set_up_logging(H5C_t *cache_ptr, const char log_location[],
+    H5C_log_format_t format, unsigned sample_interval, hbool_t start_immediately);
 H5_DLL herr_t H5C_tear_down_logging(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_start_logging(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_stop_logging(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_get_logging_status(const H5C_t *cache_ptr, /*OUT*/ hbool_t *is_enabled,
     /*OUT*/ hbool_t *is_currently_logging);
 H5_DLL herr_t H5C_write_log_message(const H5C_t *cache_ptr, const char message[]);
+H5_DLL H5C_log_format_t H5C_get_log_format(const H5C_t *cache_ptr);
+H5_DLL herr_t H5C_write_log_record(const H5C_t *cache_ptr, unsigned op,
+    int type_id, unsigned flags, haddr_t addr, haddr_t new_addr, size_t size);
 H5_DLL void H5C_def_auto_resize_rpt_fcn(H5C_t *cache_ptr, int32_t version,
     double hit_rate, enum H5C_resize_status status,
     size_t old_max_cache_size, size_t new_max_cache_size,
@@ -2206,6 +2366,8 @@ H5_DLL herr_t H5C_dest(H5F_t *f, hid_t dxpl_id);
 H5_DLL herr_t H5C_evict(H5F_t *f, hid_t dxpl_id);
 H5_DLL herr_t H5C_expunge_entry(H5F_t *f, hid_t dxpl_id,
     const H5C_class_t *type, haddr_t addr, unsigned flags);
+H5_DLL herr_t H5C_prefetch_entries(H5F_t *f, hid_t dxpl_id,
+    size_t nentries, H5C_prefetch_t *entries);
 H5_DLL herr_t H5C_flush_cache(H5F_t *f, hid_t dxpl_id, unsigned flags);
 H5_DLL herr_t H5C_flush_tagged_entries(H5F_t * f, hid_t dxpl_id, haddr_t tag); 
 H5_DLL herr_t H5C_evict_tagged_entries(H5F_t * f, hid_t dxpl_id, haddr_t tag, hbool_t match_global);
@@ -2223,6 +2385,8 @@ H5_DLL herr_t H5C_get_cache_size(H5C_t *cache_ptr, size_t *max_size_ptr,
     size_t *min_clean_size_ptr, size_t *cur_size_ptr,
     uint32_t *cur_num_entries_ptr);
 H5_DLL herr_t H5C_get_cache_hit_rate(H5C_t *cache_ptr, double *hit_rate_ptr);
+H5_DLL herr_t H5C_get_cache_type_stats(const H5C_t *cache_ptr, int type_id,
+    H5C_type_stats_t *stats_ptr);
 H5_DLL herr_t H5C_get_entry_status(const H5F_t *f, haddr_t addr,
     size_t *size_ptr, hbool_t *in_cache_ptr, hbool_t *is_dirty_ptr,
     hbool_t *is_protected_ptr, hbool_t *is_pinned_ptr, hbool_t *is_corked_ptr,
@@ -2249,6 +2413,7 @@ H5_DLL herr_t H5C_create_flush_dependency(void *parent_thing, void *child_thing)
 H5_DLL void * H5C_protect(H5F_t *f, hid_t dxpl_id, const H5C_class_t *type,
     haddr_t addr, void *udata, unsigned flags);
 H5_DLL herr_t H5C_reset_cache_hit_rate_stats(H5C_t *cache_ptr);
+H5_DLL herr_t H5C_reset_cache_type_stats(H5C_t *cache_ptr);
 H5_DLL herr_t H5C_resize_entry(void *thing, size_t new_size);
 H5_DLL herr_t H5C_set_cache_auto_resize_config(H5C_t *cache_ptr, H5C_auto_size_ctl_t *config_ptr);
 H5_DLL herr_t H5C_set_cache_image_config(const H5F_t *f, H5C_t *cache_ptr,
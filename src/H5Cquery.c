@@ -198,6 +198,39 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5C_get_cache_hit_rate() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5C_get_cache_type_stats
+ *
+ * Purpose:	Return the per entry type statistics for the entry type
+ *		with the supplied type id in *stats_ptr.  On error,
+ *		*stats_ptr is undefined.
+ *
+ * Return:      SUCCEED on success, and FAIL on failure.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C_get_cache_type_stats(const H5C_t * cache_ptr, int type_id,
+    H5C_type_stats_t * stats_ptr)
+{
+    herr_t ret_value = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if((cache_ptr == NULL) || (cache_ptr->magic != H5C__H5C_T_MAGIC))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad cache_ptr on entry.")
+    if((type_id < 0) || (type_id > cache_ptr->max_type_id))
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad type_id on entry.")
+    if(stats_ptr == NULL)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "Bad stats_ptr on entry.")
+
+    *stats_ptr = cache_ptr->type_stats[type_id];
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C_get_cache_type_stats() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -55,7 +55,9 @@
 #include "H5ACprivate.h"	/* Metadata cache			*/
 #endif /* H5_HAVE_PARALLEL */
 #include "H5Dpkg.h"		/* Dataset functions			*/
+#include "H5EAprivate.h"	/* Extensible arrays		  	*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5FAprivate.h"	/* Fixed arrays		  		*/
 #include "H5Fprivate.h"		/* File functions			*/
 #include "H5FLprivate.h"	/* Free Lists                           */
 #include "H5Iprivate.h"		/* IDs			  		*/
@@ -2448,6 +2450,69 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D_chunk_idx_reset() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D_chunk_idx_hdr_info
+ *
+ * Purpose:	Retrieve the metadata cache class and the size of the
+ *		header of a chunk index, at the index address, so that
+ *		it can be prefetched along with the dataset's object
+ *		header.  Indices with no such header (or whose header
+ *		size depends on more than the file) get a NULL class.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D_chunk_idx_hdr_info(const H5F_t *f, const H5O_storage_chunk_t *storage,
+    const H5AC_class_t **type, size_t *size)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(storage);
+    HDassert(type);
+    HDassert(size);
+
+    *type = NULL;
+    *size = 0;
+    switch(storage->idx_type) {
+        case H5D_CHUNK_IDX_EARRAY:
+            *type = H5AC_EARRAY_HDR;
+            if(H5EA_get_hdr_size(f, size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get extensible array header size")
+            break;
+
+        case H5D_CHUNK_IDX_FARRAY:
+            *type = H5AC_FARRAY_HDR;
+            if(H5FA_get_hdr_size(f, size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get fixed array header size")
+            break;
+
+        case H5D_CHUNK_IDX_BT2:
+            *type = H5AC_BT2_HDR;
+            if(H5B2_get_hdr_size(f, size) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get v2 B-tree header size")
+            break;
+
+        case H5D_CHUNK_IDX_BTREE:
+        case H5D_CHUNK_IDX_SINGLE:
+        case H5D_CHUNK_IDX_NONE:
+            break;
+
+        case H5D_CHUNK_IDX_NTYPES:
+        default:
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "unknown chunk index type")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D_chunk_idx_hdr_info() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_cinfo_cache_reset
@@ -912,6 +912,7 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     size_t dset_max_nseq, size_t *dset_curr_seq, size_t dset_len_arr[], hsize_t dset_off_arr[],
     size_t mem_max_nseq, size_t *mem_curr_seq, size_t mem_len_arr[], hsize_t mem_off_arr[])
 {
+    const void *mapped = NULL;  /* Dataset storage, used in place */
     ssize_t ret_value = -1;     /* Return value */
 
     FUNC_ENTER_STATIC
@@ -925,8 +926,21 @@ H5D__contig_readvv(const H5D_io_info_t *io_info,
     HDassert(mem_len_arr);
     HDassert(mem_off_arr);
 
+    /* Check if the file driver exposes the dataset's storage in memory */
+    if(H5F_addr_defined(io_info->store->contig.dset_addr) && io_info->store->contig.dset_size > 0
+            && io_info->store->contig.dset_size == (hsize_t)((size_t)io_info->store->contig.dset_size))
+        if(H5F_block_map(io_info->dset->oloc.file, H5FD_MEM_DRAW, io_info->store->contig.dset_addr,
+                (size_t)io_info->store->contig.dset_size, &mapped) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't map dataset storage")
+
+    /* Copy directly from the mapped storage */
+    if(mapped) {
+        if((ret_value = H5VM_memcpyvv(io_info->u.rbuf, mem_max_nseq, mem_curr_seq, mem_len_arr, mem_off_arr,
+                mapped, dset_max_nseq, dset_curr_seq, dset_len_arr, dset_off_arr)) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "vectorized memcpy failed")
+    } /* end if */
     /* Check if data sieving is enabled */
-    if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
+    else if(H5F_HAS_FEATURE(io_info->dset->oloc.file, H5FD_FEAT_DATA_SIEVE)) {
         H5D_contig_readvv_sieve_ud_t udata;     /* User data for H5VM_opvv() operator */
 
         /* Set up user data for H5VM_opvv() */
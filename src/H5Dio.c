@@ -1057,6 +1057,20 @@ H5D__typeinfo_init(const H5D_t *dset, const H5D_dxpl_cache_t *dxpl_cache,
          * same size over and over.
          */
         if(NULL == (type_info->tconv_buf = (uint8_t *)dxpl_cache->tconv_buf)) {
+#ifdef H5_HAVE_DIRECT
+            size_t mem_align = H5F_MEM_ALIGN(dset->oloc.file);
+
+            /* Align the buffer as the file driver asks, so that the data
+             * can be transferred without copying it again.  (Only the
+             * direct driver asks for aligned memory)
+             */
+            if(mem_align > 0) {
+                if(HDposix_memalign((void **)&type_info->tconv_buf, mem_align, target_size) != 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+                type_info->tconv_buf_aligned = TRUE;
+            } /* end if */
+            else
+#endif /* H5_HAVE_DIRECT */
             /* Allocate temporary buffer */
             if(NULL == (type_info->tconv_buf = H5FL_BLK_MALLOC(type_conv, target_size)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
@@ -1253,7 +1267,12 @@ H5D__typeinfo_term(const H5D_type_info_t *type_info)
     /* Check for releasing datatype conversion & background buffers */
     if(type_info->tconv_buf_allocated) {
         HDassert(type_info->tconv_buf);
-        (void)H5FL_BLK_FREE(type_conv, type_info->tconv_buf);
+
+        /* Free with HDfree if it came from posix_memalign */
+        if(type_info->tconv_buf_aligned)
+            HDfree(type_info->tconv_buf);
+        else
+            (void)H5FL_BLK_FREE(type_conv, type_info->tconv_buf);
     } /* end if */
     if(type_info->bkg_buf_allocated) {
         HDassert(type_info->bkg_buf);
@@ -114,6 +114,7 @@ typedef struct H5D_type_info_t {
     size_t request_nelmts;		/* Requested strip mine	*/
     uint8_t *tconv_buf;	                /* Datatype conv buffer	*/
     hbool_t tconv_buf_allocated;        /* Whether the type conversion buffer was allocated */
+    hbool_t tconv_buf_aligned;          /* Whether the type conversion buffer was allocated aligned for the file driver */
     uint8_t *bkg_buf;	                /* Background buffer	*/
     hbool_t bkg_buf_allocated;          /* Whether the background buffer was allocated */
 } H5D_type_info_t;
@@ -83,6 +83,10 @@
 #define H5D_XFER_FILTER_CB_NAME         "filter_cb"     /* Filter callback function */
 #define H5D_XFER_CONV_CB_NAME           "type_conv_cb"  /* Type conversion callback function */
 #define H5D_XFER_XFORM_NAME             "data_transform" /* Data transform */
+#define H5D_XFER_CONV_NTHREADS_NAME     "type_conv_nthreads" /* Number of datatype conversion threads */
+#define H5D_XFER_CONV_MIN_ELMTS_NAME    "type_conv_min_elmts" /* Minimum # of elements per conversion thread */
+#define H5D_XFER_MEMB_IO_NTHREADS_NAME  "memb_io_nthreads" /* Number of threads for member file I/O */
+#define H5D_XFER_MEMB_IO_MIN_SIZE_NAME  "memb_io_min_size" /* Minimum # of bytes per member file I/O thread */
 #ifdef H5_HAVE_INSTRUMENTED_LIBRARY
 /* Collective chunk instrumentation properties */
 #define H5D_XFER_COLL_CHUNK_LINK_HARD_NAME "coll_chunk_link_hard"
@@ -104,6 +108,14 @@
 /* Default I/O vector size */
 #define H5D_IO_VECTOR_SIZE      1024
 
+/* Default datatype conversion threading (single-threaded) */
+#define H5D_CONV_NTHREADS       1
+#define H5D_CONV_MIN_ELMTS      (64 * 1024)
+
+/* Default member file I/O threading (single-threaded) */
+#define H5D_MEMB_IO_NTHREADS    1
+#define H5D_MEMB_IO_MIN_SIZE    (1024 * 1024)
+
 /* Default VL allocation & free info */
 #define H5D_VLEN_ALLOC          NULL
 #define H5D_VLEN_ALLOC_INFO     NULL
@@ -190,6 +202,8 @@ H5_DLL herr_t H5D_vlen_reclaim(hid_t type_id, H5S_t *space, hid_t plist_id,
 
 /* Functions that operate on chunked storage */
 H5_DLL herr_t H5D_chunk_idx_reset(H5O_storage_chunk_t *storage, hbool_t reset_addr);
+H5_DLL herr_t H5D_chunk_idx_hdr_info(const H5F_t *f,
+    const H5O_storage_chunk_t *storage, const H5AC_class_t **type, size_t *size);
 
 /* Functions that operate on virtual storage */
 H5_DLL herr_t H5D_virtual_check_mapping_pre(const H5S_t *vspace,
@@ -339,6 +339,33 @@ H5EA_get_addr(const H5EA_t *ea, haddr_t *addr))
 
 END_FUNC(PRIV)  /* end H5EA_get_addr() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5EA_get_hdr_size
+ *
+ * Purpose:	Query the size of an extensible array header in a file
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PRIV, NOERR,
+herr_t, SUCCEED, -,
+H5EA_get_hdr_size(const H5F_t *f, size_t *size))
+
+    /* Local variables */
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(size);
+
+    /* Compute the size of the header, which doesn't depend on the array */
+    *size = (size_t)H5EA_HEADER_SIZE_FILE(f);
+
+END_FUNC(PRIV)  /* end H5EA_get_hdr_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5EA__lookup_elmt
@@ -936,6 +936,53 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5E_clear_stack() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5E_get_innermost_error
+ *
+ * Purpose:	Retrieves the major and minor error IDs and the description
+ *		of the innermost error (the first one pushed) on the
+ *		current error stack.  Up to DESC_SIZE characters of the
+ *		description are copied into DESC, which is always null
+ *		terminated.
+ *
+ *		This lets a thread hand the cause of a failure over to
+ *		another thread, whose error stack is separate.
+ *
+ * Return:	Non-negative on success/Negative on failure, or when the
+ *		error stack is empty
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_get_innermost_error(hid_t *maj_id, hid_t *min_id, char *desc,
+    size_t desc_size)
+{
+    H5E_t *estack;              /* Current error stack */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    /* Don't push errors here: this examines the error stack */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(maj_id);
+    HDassert(min_id);
+    HDassert(desc && desc_size > 0);
+
+    if(NULL == (estack = H5E_get_my_stack())) /*lint !e506 !e774 Make lint 'constant value Boolean' in non-threaded case */
+        HGOTO_DONE(FAIL)
+    if(0 == estack->nused)
+        HGOTO_DONE(FAIL)
+
+    *maj_id = estack->slot[0].maj_num;
+    *min_id = estack->slot[0].min_num;
+    HDstrncpy(desc, estack->slot[0].desc, desc_size);
+    desc[desc_size - 1] = '\0';
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_get_innermost_error() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5E_pop
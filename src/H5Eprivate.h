@@ -188,6 +188,8 @@ H5_DLL herr_t H5E_push_stack(H5E_t *estack, const char *file, const char *func,
 H5_DLL herr_t H5E_printf_stack(H5E_t *estack, const char *file, const char *func,
     unsigned line, hid_t cls_id, hid_t maj_id, hid_t min_id, const char *fmt, ...)H5_ATTR_FORMAT(printf, 8, 9);
 H5_DLL herr_t H5E_clear_stack(H5E_t *estack);
+H5_DLL herr_t H5E_get_innermost_error(hid_t *maj_id, hid_t *min_id,
+    char *desc, size_t desc_size);
 H5_DLL herr_t H5E_dump_api_stack(hbool_t is_api);
 
 #endif /* _H5Eprivate_H */
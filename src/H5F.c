@@ -1257,6 +1257,166 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* H5Freset_mdc_hit_rate_stats() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_mdc_stats
+ *
+ * Purpose:     Retrieves the per entry type statistics maintained by the
+ *		metadata cache associated with the specified file.  The
+ *		statistics for up to NSTATS entry types are copied into
+ *		STATS, in order of entry type.  If STATS is NULL, only
+ *		the number of entry types is returned.
+ *
+ *		Unlike the statistics collected when the library is built
+ *		with H5C_COLLECT_CACHE_STATS, these statistics are always
+ *		collected.  They accumulate from the time the file is
+ *		opened until the next call to H5Freset_mdc_stats().
+ *
+ * Return:      Success:        non-negative, the number of metadata 
+ *				cache entry types
+ *              Failure:        negative
+ *
+ *-------------------------------------------------------------------------
+ */
+ssize_t
+H5Fget_mdc_stats(hid_t file_id, size_t nstats, H5AC_cache_type_stats_t *stats/*out*/)
+{
+    H5F_t      *file;                   /* File object for file ID */
+    ssize_t    ret_value;               /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("Zs", "izx", file_id, nstats, stats);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == stats)
+        nstats = 0;
+
+    /* Go get the statistics */
+    if((ret_value = H5AC_get_cache_type_stats(file->shared->cache, nstats, stats)) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "H5AC_get_cache_type_stats() failed.")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_mdc_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_mdc_stats
+ *
+ * Purpose:     Reset the per entry type statistics that can be obtained
+ *		via the H5Fget_mdc_stats() call.  Unlike the hit rate
+ *		statistic, these statistics are never reset automatically.
+ *
+ * Return:      Success:        SUCCEED
+ *              Failure:        FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_mdc_stats(hid_t file_id)
+{
+    H5F_t      *file;                   /* File object for file ID */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+
+    /* Reset the statistics */
+    if(H5AC_reset_cache_type_stats(file->shared->cache) < 0)
+        HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, FAIL, "can't reset cache statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Freset_mdc_stats() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Fget_page_buffering_stats
+ *
+ * Purpose:     Retrieves the statistics of the file's page buffer.  Each
+ *		array holds the count for metadata at index 0 and for raw
+ *		data at index 1:
+ *
+ *		accesses:  page accesses
+ *		hits:      accesses served from a page already held
+ *		misses:    accesses that loaded a page
+ *		evictions: pages evicted to make room for another
+ *		bypasses:  accesses that went straight to the file, either
+ *		           because they cover a page or more, or because
+ *		           no page could be evicted
+ *
+ *		Any of the arrays may be NULL.  The statistics accumulate
+ *		until the next call to H5Freset_page_buffering_stats().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2], unsigned hits[2],
+    unsigned misses[2], unsigned evictions[2], unsigned bypasses[2])
+{
+    H5F_t      *file;                   /* File object for file ID */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE6("e", "i*Iu*Iu*Iu*Iu*Iu", file_id, accesses, hits, misses, evictions,
+             bypasses);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == file->shared->page_buf)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "page buffering not enabled on file")
+
+    /* Go get the statistics */
+    if(H5PB_get_stats(file->shared->page_buf, accesses, hits, misses, evictions, bypasses) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't retrieve page buffer statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Fget_page_buffering_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Freset_page_buffering_stats
+ *
+ * Purpose:     Reset the statistics of the file's page buffer.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Freset_page_buffering_stats(hid_t file_id)
+{
+    H5F_t      *file;                   /* File object for file ID */
+    herr_t     ret_value = SUCCEED;     /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE1("e", "i", file_id);
+
+    /* Check args */
+    if(NULL == (file = (H5F_t *)H5I_object_verify(file_id, H5I_FILE)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a file ID")
+    if(NULL == file->shared->page_buf)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "page buffering not enabled on file")
+
+    /* Reset the statistics */
+    if(H5PB_reset_stats(file->shared->page_buf) < 0)
+        HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset page buffer statistics")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* H5Freset_page_buffering_stats() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Fget_name
@@ -1643,6 +1803,10 @@ H5Fstart_swmr_write(hid_t file_id)
 
     HDassert(file->shared->sblock->status_flags & H5F_SUPER_WRITE_ACCESS);
 
+    /* Page buffering doesn't support SWMR */
+    if(file->shared->page_buf)
+        HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, FAIL, "can't have both SWMR and page buffering")
+
     /* Check to see if cache image is enabled.  Fail if so */
     if(H5C_cache_image_status(file, &ci_load, &ci_write) < 0)
         HGOTO_ERROR(H5E_FILE, H5E_CANTGET, FAIL, "can't get MDC cache image status")
@@ -1986,6 +2150,8 @@ H5Fformat_convert(hid_t fid)
             /* Set non-persistent freespace manager */
             f->shared->fs_strategy = H5F_FILE_SPACE_STRATEGY_DEF;
             f->shared->fs_threshold = H5F_FREE_SPACE_THRESHOLD_DEF;
+            if(H5FD_set_paged_aggr(f->shared->lf, FALSE) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "can't reset paged aggregation for file driver")
 
             /* Indicate that the superblock should be marked dirty */
             mark_dirty = TRUE;
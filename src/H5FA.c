@@ -322,6 +322,33 @@ H5FA_get_addr(const H5FA_t *fa, haddr_t *addr))
 
 END_FUNC(PRIV)  /* end H5FA_get_addr() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FA_get_hdr_size
+ *
+ * Purpose:     Query the size of a fixed array header in a file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+BEGIN_FUNC(PRIV, NOERR,
+herr_t, SUCCEED, -,
+H5FA_get_hdr_size(const H5F_t *f, size_t *size))
+
+    /* Local variables */
+
+    /*
+     * Check arguments.
+     */
+    HDassert(f);
+    HDassert(size);
+
+    /* Compute the size of the header, which doesn't depend on the array */
+    *size = (size_t)H5FA_HEADER_SIZE_FILE(f);
+
+END_FUNC(PRIV)  /* end H5FA_get_hdr_size() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FA_set
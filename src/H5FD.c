@@ -562,7 +562,8 @@ H5FD_sb_load(H5FD_t *file, const char *name, const uint8_t *buf)
     /* Check if driver matches driver information saved. Unfortunately, we can't push this
      * function to each specific driver because we're checking if the driver is correct.
      */
-    if(!HDstrncmp(name, "NCSAfami", (size_t)8) && HDstrcmp(file->cls->name, "family"))
+    if((!HDstrncmp(name, "NCSAfami", (size_t)8) || !HDstrncmp(name, "NCSAfstr", (size_t)8))
+            && HDstrcmp(file->cls->name, "family"))
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "family driver should be used")
     if(!HDstrncmp(name, "NCSAmult", (size_t)8) && HDstrcmp(file->cls->name, "multi"))
         HGOTO_ERROR(H5E_VFL, H5E_BADVALUE, FAIL, "multi driver should be used")
@@ -826,11 +827,16 @@ H5FD_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment threshold")
     if(H5P_get(plist, H5F_ACS_ALIGN_NAME, &(file->alignment)) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get alignment")
+    file->paged_aggr = FALSE;
 
     /* Retrieve the VFL driver feature flags */
     if(H5FD_query(file, &(file->feature_flags)) < 0)
         HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to query file driver")
 
+    /* Only trust the buffer alignment from drivers that advertise it */
+    if(!(file->feature_flags & H5FD_FEAT_ALIGNED_MEM))
+        file->mem_align = 0;
+
     /* Increment the global serial number & assign it to this H5FD_t object */
     if(++H5FD_file_serial_no_g == 0) {
         /* (Just error out if we wrap around for now...) */
@@ -1615,6 +1621,190 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5FDwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FDread_vector
+ *
+ * Purpose:	Reads COUNT extents from FILE according to the data
+ *		transfer property list DXPL_ID (which may be the constant
+ *		H5P_DEFAULT).  Extent I is SIZES[I] bytes of memory type
+ *		TYPES[I] beginning at address ADDRS[I], and is read into
+ *		the buffer BUFS[I].
+ *
+ *		Drivers with a read_vector callback may service the
+ *		extents with fewer I/O requests than one per extent.
+ *
+ * Return:	Success:	Non-negative. The read results are written
+ *				into the BUFS buffers which should be
+ *				allocated by the caller.
+ *
+ *		Failure:	Negative. The contents of BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDread_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/)
+{
+    H5P_genplist_t *dxpl;               /* DXPL object */
+    haddr_t    *rel_addrs = NULL;       /* Addresses relative to the base address */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*xiIu*Mt*a*zx", file, dxpl_id, count, types, addrs, sizes, bufs);
+
+    /* Check args */
+    if(!file || !file->cls)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file pointer")
+    if(count > 0 && (!types || !addrs || !sizes || !bufs))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null vector array")
+    for(u = 0; u < count; u++)
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null result buffer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Get the DXPL plist object for DXPL ID */
+    if(NULL == (dxpl = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
+
+    /* Compensate for the base address addition in the internal routine */
+    if(count > 0) {
+        if(NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for addresses")
+        for(u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+    } /* end if */
+
+    /* Do the real work */
+    if(H5FD_read_vector(file, dxpl, count, types, rel_addrs, sizes, bufs) < 0)
+	HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "file vector read request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDread_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FDwrite_vector
+ *
+ * Purpose:	Writes COUNT extents to FILE according to the data
+ *		transfer property list DXPL_ID (which may be the constant
+ *		H5P_DEFAULT).  Extent I is SIZES[I] bytes of memory type
+ *		TYPES[I] beginning at address ADDRS[I], and the bytes to
+ *		be written come from the buffer BUFS[I].
+ *
+ *		Drivers with a write_vector callback may service the
+ *		extents with fewer I/O requests than one per extent.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    H5P_genplist_t *dxpl;               /* DXPL object */
+    haddr_t    *rel_addrs = NULL;       /* Addresses relative to the base address */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "*xiIu*Mt*a*z**x", file, dxpl_id, count, types, addrs, sizes, bufs);
+
+    /* Check args */
+    if(!file || !file->cls)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file pointer")
+    if(count > 0 && (!types || !addrs || !sizes || !bufs))
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null vector array")
+    for(u = 0; u < count; u++)
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null buffer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+    /* Get the DXPL plist object for DXPL ID */
+    if(NULL == (dxpl = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
+
+    /* Compensate for the base address addition in the internal routine */
+    if(count > 0) {
+        if(NULL == (rel_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for addresses")
+        for(u = 0; u < count; u++)
+            rel_addrs[u] = addrs[u] - file->base_addr;
+    } /* end if */
+
+    /* The real work */
+    if(H5FD_write_vector(file, dxpl, count, types, rel_addrs, sizes, bufs) < 0)
+	HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "file vector write request failed")
+
+done:
+    H5MM_xfree(rel_addrs);
+
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDwrite_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FDmap
+ *
+ * Purpose:	Sets *PTR to the address of SIZE bytes of memory type TYPE
+ *		at address ADDR of FILE, when the driver can expose that
+ *		part of the file in memory (e.g. the mmap driver).  The
+ *		memory is read-only, and may only be used until the next
+ *		read or map call on the file, as the driver may release
+ *		it then.
+ *
+ *		When the driver has no map callback, or can't expose that
+ *		part of the file, *PTR is set to NULL and the caller should
+ *		read the data with H5FDread() instead.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FDmap(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size,
+    const void **ptr/*out*/)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "*xMtazx", file, type, addr, size, ptr);
+
+    /* Check args */
+    if(!file || !file->cls)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "invalid file pointer")
+    if(!ptr)
+	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "null pointer to result")
+
+    /* Do the real work (compensating for the base address addition in the internal routine) */
+    if(H5FD_map(file, type, addr - file->base_addr, size, ptr) < 0)
+	HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "file map request failed")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5FDmap() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FDflush
@@ -2032,3 +2222,40 @@ H5FD_get_base_addr(const H5FD_t *file)
     FUNC_LEAVE_NOAPI(file->base_addr)
 } /* end H5FD_get_base_addr() */
 
+
+/*--------------------------------------------------------------------------
+ * Function:    H5FD_set_paged_aggr
+ *
+ * Purpose:     Set whether the file allocates its space in pages.  The
+ *              allocation alignment from the file access property list
+ *              is not applied to files that do, as the file's free space
+ *              routines align the space they allocate to its pages.
+ *
+ *              The multi and split drivers place each member's space at
+ *              an arbitrary base address, which can't be divided into
+ *              pages, so files using them can't allocate in pages.
+ *
+ * Return:      Non-negative if succeed; negative if fails.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5FD_set_paged_aggr(H5FD_t *file, hbool_t paged)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file);
+    HDassert(file->cls);
+
+    if(paged && !HDstrcmp(file->cls->name, "multi"))
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "paged aggregation is not supported for multi file driver")
+
+    /* Indicate whether space is allocated in pages */
+    file->paged_aggr = paged;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_set_paged_aggr() */
+
@@ -20,6 +20,11 @@
  * Purpose:     A driver which stores the HDF5 data in main memory  using
  *              only the HDF5 public API. This driver is useful for fast
  *              access to small, temporary hdf5 files.
+ *
+ *              Existing files can also be mapped into memory instead of
+ *              being read in whole when they are opened (see
+ *              H5Pset_core_mmap()), so that large files are paged in as
+ *              they are used.
  */
 
 #include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
@@ -35,6 +40,17 @@
 #include "H5Pprivate.h"     /* Property lists               */
 #include "H5SLprivate.h"    /* Skip lists                   */
 
+#ifdef H5_HAVE_MMAP
+#include <sys/mman.h>
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif /* !defined(MAP_ANONYMOUS) && defined(MAP_ANON) */
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif /* MAP_NORESERVE */
+#endif /* H5_HAVE_MMAP */
+
 /* The driver identification number, initialized at runtime */
 static hid_t H5FD_CORE_g = 0;
 
@@ -89,6 +105,10 @@ typedef struct H5FD_core_t {
     hbool_t dirty;                              /* changes not saved?       */
     H5FD_file_image_callbacks_t fi_callbacks;   /* file image callbacks     */
     H5SL_t *dirty_list;                         /* dirty parts of the file  */
+    hbool_t mapped;                             /* mem is a mapping of the file */
+    hbool_t write_back;                         /* mapping is shared with the file */
+    size_t  map_size;                           /* size of the mapped range */
+    size_t  map_file_size;                      /* bytes of the file mapped */
 } H5FD_core_t;
 
 /* Driver-specific file access properties */
@@ -100,6 +120,16 @@ typedef struct H5FD_core_fapl_t {
 /* Allocate memory in multiples of this size by default */
 #define H5FD_CORE_INCREMENT 8192
 
+/* Dirty regions closer than this are written back to the backing store
+ * together, as one write
+ */
+#define H5FD_CORE_WRITE_BACK_GAP (64 * 1024)
+
+/* Address space reserved past the end of a mapped file (or the size of the
+ * file, if larger), so the file can grow without moving the mapping
+ */
+#define H5FD_CORE_MMAP_RESERVE ((size_t)256 * 1024 * 1024)
+
 /* These macros check for overflow of various quantities.  These macros
  * assume that file_offset_t is signed and haddr_t and size_t are unsigned.
  *
@@ -124,6 +154,12 @@ typedef struct H5FD_core_fapl_t {
 static herr_t H5FD__core_add_dirty_region(H5FD_core_t *file, haddr_t start, haddr_t end);
 static herr_t H5FD__core_destroy_dirty_list(H5FD_core_t *file);
 static herr_t H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size);
+static herr_t H5FD__core_write_back(H5FD_core_t *file, haddr_t addr, size_t size);
+#ifdef H5_HAVE_MMAP
+static herr_t H5FD__core_map(H5FD_core_t *file, size_t size, hbool_t write_back);
+static herr_t H5FD__core_grow_map(H5FD_core_t *file, size_t new_eof);
+static herr_t H5FD__core_sync_map(H5FD_core_t *file, haddr_t addr, size_t size);
+#endif /* H5_HAVE_MMAP */
 static herr_t H5FD__core_term(void);
 static void *H5FD__core_fapl_get(H5FD_t *_file);
 static H5FD_t *H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -176,7 +212,10 @@ static const H5FD_class_t H5FD_core_g = {
     H5FD__core_truncate,        /* truncate             */
     H5FD_core_lock,             /* lock                 */
     H5FD_core_unlock,           /* unlock               */
-    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    NULL,                       /* read_vector          */
+    NULL,                       /* write_vector         */
+    NULL                        /* map                  */
 };
 
 /* Define a free list to manage the region type */
@@ -345,9 +384,11 @@ H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
 
     HDassert(file);
 
+#ifndef H5_HAVE_PREADWRITE
     /* Write to backing store */
     if((off_t)addr != HDlseek(file->fd, (off_t)addr, SEEK_SET))
         HGOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "error seeking in backing store")
+#endif /* H5_HAVE_PREADWRITE */
 
     while (size > 0) {
 
@@ -363,13 +404,17 @@ H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
             bytes_in = (h5_posix_io_t)size;
 
         do {
+#ifdef H5_HAVE_PREADWRITE
+            bytes_wrote = HDpwrite(file->fd, ptr, bytes_in, (HDoff_t)addr);
+#else /* H5_HAVE_PREADWRITE */
             bytes_wrote = HDwrite(file->fd, ptr, bytes_in);
+#endif /* H5_HAVE_PREADWRITE */
         } while(-1 == bytes_wrote && EINTR == errno);
 
         if(-1 == bytes_wrote) { /* error */
             int myerrno = errno;
             time_t mytime = HDtime(NULL);
-            HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
+            HDoff_t myoffset = (HDoff_t)addr;
 
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write to backing store failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', ptr = %p, total write size = %llu, bytes this sub-write = %llu, bytes actually written = %llu, offset = %llu", HDctime(&mytime), file->name, file->fd, myerrno, HDstrerror(myerrno), ptr, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_wrote, (unsigned long long)myoffset);
         } /* end if */
@@ -378,6 +423,7 @@ H5FD__core_write_to_bstore(H5FD_core_t *file, haddr_t addr, size_t size)
         HDassert((size_t)bytes_wrote <= size);
 
         size -= (size_t)bytes_wrote;
+        addr += (haddr_t)bytes_wrote;
         ptr = (unsigned char *)ptr + bytes_wrote;
 
     } /* end while */
@@ -386,6 +432,210 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD__core_write_to_bstore() */
 
+#ifdef H5_HAVE_MMAP
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_map
+ *
+ * Purpose:     Maps the first SIZE bytes of the backing store file into
+ *              memory, in place of reading them in.  The mapping starts
+ *              a reserved range of address space, so that the file can
+ *              grow in place.
+ *
+ *              A WRITE_BACK mapping is shared with the file, so changes
+ *              reach the file's pages directly.  Otherwise it is private,
+ *              and changed pages are written back on flush.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_map(H5FD_core_t *file, size_t size, hbool_t write_back)
+{
+    void        *base;                  /* Start of the reserved range */
+    size_t      map_size;               /* Size of the reserved range */
+    long        page_size;              /* System page size */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->fd >= 0);
+    HDassert(size > 0);
+
+    if((page_size = HDsysconf(_SC_PAGESIZE)) <= 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get the page size")
+
+    /* Reserve the file's size again, or the default reserve if larger,
+     * falling back to just the file if the sum overflows
+     */
+    map_size = size + MAX(size, H5FD_CORE_MMAP_RESERVE);
+    if(map_size < size)
+        map_size = size;
+    map_size = ((map_size + (size_t)page_size - 1) / (size_t)page_size) * (size_t)page_size;
+
+    /* Reserve the range with anonymous memory, then map the file over the
+     * start of it
+     */
+    if(MAP_FAILED == (base = HDmmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, (HDoff_t)0)))
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to reserve address space")
+    if(MAP_FAILED == HDmmap(base, size, PROT_READ | PROT_WRITE, (write_back ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED, file->fd, (HDoff_t)0)) {
+        int map_errno = errno;
+
+        HDmunmap(base, map_size);
+        errno = map_errno;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to map file")
+    } /* end if */
+
+    file->mem = (unsigned char *)base;
+    file->mapped = TRUE;
+    file->write_back = write_back;
+    file->map_size = map_size;
+    file->map_file_size = size;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_grow_map
+ *
+ * Purpose:     Makes a mapped file's memory at least NEW_EOF bytes long.
+ *
+ *              A shared mapping follows the file: the file is extended
+ *              and more of it is mapped, in a larger reserved range if
+ *              needed, since its data lives in the file's pages.
+ *
+ *              A private mapping grows into its reserved range.  Past
+ *              that, its changed pages can't be moved, so the file's
+ *              data is copied into allocated memory and the mapping is
+ *              dropped.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_grow_map(H5FD_core_t *file, size_t new_eof)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->mapped);
+
+    if(file->write_back) {
+        if(new_eof > file->map_file_size) {
+            if(-1 == HDftruncate(file->fd, (HDoff_t)new_eof))
+                HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+            /* Move to a larger range if the file outgrew its reserve */
+            if(new_eof > file->map_size) {
+                if(HDmunmap(file->mem, file->map_size) < 0)
+                    HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap file")
+                file->mem = NULL;
+                file->mapped = FALSE;
+                if(H5FD__core_map(file, new_eof, TRUE) < 0)
+                    HGOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to map file")
+            } /* end if */
+            else if(MAP_FAILED == HDmmap(file->mem, new_eof, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, file->fd, (HDoff_t)0))
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTALLOC, FAIL, "unable to map file")
+            file->map_file_size = new_eof;
+        } /* end if */
+    } /* end if */
+    else if(new_eof > file->map_size) {
+        unsigned char *x;
+
+        if(NULL == (x = (unsigned char *)H5MM_malloc(new_eof)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes", (unsigned long long)new_eof)
+        HDmemcpy(x, file->mem, (size_t)file->eof);
+        if(HDmunmap(file->mem, file->map_size) < 0) {
+            H5MM_xfree(x);
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap file")
+        } /* end if */
+        file->mem = x;
+        file->mapped = FALSE;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_grow_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_sync_map
+ *
+ * Purpose:     Schedules the pages of a shared mapping that hold SIZE
+ *              bytes at ADDR to be written back to the file.  This
+ *              doesn't wait for the writes, which the operating system
+ *              does in the background.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_sync_map(H5FD_core_t *file, haddr_t addr, size_t size)
+{
+    long        page_size;              /* System page size */
+    haddr_t     start;                  /* Start of the first page */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+    HDassert(file->mapped && file->write_back);
+
+    if((page_size = HDsysconf(_SC_PAGESIZE)) <= 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "unable to get the page size")
+    start = (addr / (haddr_t)page_size) * (haddr_t)page_size;
+
+    if(HDmsync(file->mem + start, (size_t)(addr - start) + size, MS_ASYNC) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "unable to schedule write-back of mapped file")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_sync_map() */
+#endif /* H5_HAVE_MMAP */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__core_write_back
+ *
+ * Purpose:     Saves SIZE bytes at ADDR of the file's memory in the
+ *              backing store, by writing them out or, for a shared
+ *              mapping, by scheduling their pages to be written.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__core_write_back(H5FD_core_t *file, haddr_t addr, size_t size)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(file);
+
+#ifdef H5_HAVE_MMAP
+    if(file->mapped && file->write_back) {
+        if(H5FD__core_sync_map(file, addr, size) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write back mapped file")
+    } /* end if */
+    else
+#endif /* H5_HAVE_MMAP */
+    if(H5FD__core_write_to_bstore(file, addr, size) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__core_write_back() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD__init_package
@@ -608,6 +858,8 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     h5_stat_t           sb;
     int                 fd = -1;
     H5FD_file_image_info_t  file_image_info;
+    hbool_t             use_mmap = FALSE;       /* map the file instead of reading it? */
+    hbool_t             write_back = FALSE;     /* map it shared? */
     H5FD_t              *ret_value = NULL;      /* Return value */
 
     FUNC_ENTER_STATIC
@@ -635,6 +887,12 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
     if(H5P_peek(plist, H5F_ACS_FILE_IMAGE_INFO_NAME, &file_image_info) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get initial file image info")
 
+    /* Get the mmap settings */
+    if(H5P_get(plist, H5F_ACS_CORE_MMAP_FLAG_NAME, &use_mmap) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get core VFD mmap flag")
+    if(H5P_get(plist, H5F_ACS_CORE_WRITE_BACK_FLAG_NAME, &write_back) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get core VFD write-back flag")
+
     /* If the file image exists and this is an open, make sure the file doesn't exist */
     HDassert(((file_image_info.buffer != NULL) && (file_image_info.size > 0)) ||
              ((file_image_info.buffer == NULL) && (file_image_info.size == 0)));
@@ -712,8 +970,20 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
         else
             size = (size_t)sb.st_size;
 
+#ifdef H5_HAVE_MMAP
+        /* Map an existing file instead of reading it in, if asked to, so its
+         * pages are read as they are used.  Only a file with a backing store
+         * that is open for writing is mapped shared.
+         */
+        if(size && use_mmap && fd >= 0 && NULL == file_image_info.buffer && NULL == file->fi_callbacks.image_malloc) {
+            if(H5FD__core_map(file, size, (hbool_t)(write_back && fa->backing_store && (H5F_ACC_RDWR & flags))) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to map file")
+            file->eof = size;
+        } /* end if */
+#endif /* H5_HAVE_MMAP */
+
         /* Check if we should allocate the memory buffer and read in existing data */
-        if(size) {
+        if(size && !file->mapped) {
             /* Allocate memory for the file's data, using the file image callback if available. */
             if(file->fi_callbacks.image_malloc) {
                 if(NULL == (file->mem = (unsigned char*)file->fi_callbacks.image_malloc(size, H5FD_FILE_IMAGE_OP_FILE_OPEN, file->fi_callbacks.udata)))
@@ -792,6 +1062,20 @@ H5FD__core_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr
         if(H5P_get(plist, H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME, &(file->bstore_page_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get core VFD write tracking page size");
 
+#ifdef H5_HAVE_MMAP
+        /* A mapped file always tracks writes, so that flushes only write
+         * back (and page in) the parts that changed.  Unless asked for
+         * something else, the tracking follows the system pages.
+         */
+        if(file->mapped && !write_tracking_flag) {
+            long page_size = HDsysconf(_SC_PAGESIZE);
+
+            write_tracking_flag = TRUE;
+            if(page_size > 0)
+                file->bstore_page_size = (size_t)page_size;
+        } /* end if */
+#endif /* H5_HAVE_MMAP */
+
         /* default is to have write tracking OFF for create (hence the check to see
          * if the user explicitly set a page size) and ON with the default page size
          * on open (when not read-only).
@@ -817,7 +1101,12 @@ done:
         if(file->fd >= 0)
             HDclose(file->fd);
         H5MM_xfree(file->name);
-        H5MM_xfree(file->mem);
+#ifdef H5_HAVE_MMAP
+        if(file->mapped)
+            HDmunmap(file->mem, file->map_size);
+        else
+#endif /* H5_HAVE_MMAP */
+            H5MM_xfree(file->mem);
         H5MM_xfree(file);
     } /* end if */
 
@@ -860,6 +1149,14 @@ H5FD__core_close(H5FD_t *_file)
     if(file->name)
         H5MM_xfree(file->name);
     if(file->mem) {
+#ifdef H5_HAVE_MMAP
+        /* Unmap a mapped file */
+        if(file->mapped) {
+            if(HDmunmap(file->mem, file->map_size) < 0)
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTFREE, FAIL, "unable to unmap file")
+        } /* end if */
+        else
+#endif /* H5_HAVE_MMAP */
         /* Use image callback if available */
         if(file->fi_callbacks.image_free) {
             if(file->fi_callbacks.image_free(file->mem, H5FD_FILE_IMAGE_OP_FILE_CLOSE, file->fi_callbacks.udata) < 0)
@@ -1245,6 +1542,14 @@ H5FD__core_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
             new_eof += file->increment;
 
         /* (Re)allocate memory for the file buffer, using callbacks if available */
+#ifdef H5_HAVE_MMAP
+        if(file->mapped) {
+            if(H5FD__core_grow_map(file, new_eof) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to grow mapped file to %llu bytes", (unsigned long long)new_eof)
+            x = file->mem;
+        } /* end if */
+        else
+#endif /* H5_HAVE_MMAP */
         if(file->fi_callbacks.image_realloc) {
             if(NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block of %llu bytes with callback", (unsigned long long)new_eof)
@@ -1304,10 +1609,13 @@ H5FD__core_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UN
     /* Write to backing store */
     if (file->dirty && file->fd >= 0 && file->backing_store) {
 
-        /* Use the dirty list, if available */
+        /* Use the dirty list, if available.  The regions come out in address
+         * order, and regions close to each other are written together.
+         */
         if(file->dirty_list) {
             H5FD_core_region_t *item = NULL;
-            size_t size;
+            haddr_t start = HADDR_UNDEF;    /* Start of the pending write */
+            haddr_t end = HADDR_UNDEF;      /* End of the pending write */
 
             while(NULL != (item = (H5FD_core_region_t *)H5SL_remove_first(file->dirty_list))) {
 
@@ -1318,19 +1626,32 @@ H5FD__core_flush(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UN
                     if(item->end >= file->eof)
                         item->end = file->eof - 1;
 
-                    size = (size_t)((item->end - item->start) + 1);
-
-                    if(H5FD__core_write_to_bstore(file, item->start, size) != SUCCEED)
-                        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
+                    /* Add the region to the pending write, or write that out
+                     * and start a new one
+                     */
+                    if(H5F_addr_defined(start) && item->start <= end + 1 + H5FD_CORE_WRITE_BACK_GAP) {
+                        if(item->end > end)
+                            end = item->end;
+                    } /* end if */
+                    else {
+                        if(H5F_addr_defined(start) && H5FD__core_write_back(file, start, (size_t)((end - start) + 1)) < 0) {
+                            item = H5FL_FREE(H5FD_core_region_t, item);
+                            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
+                        } /* end if */
+                        start = item->start;
+                        end = item->end;
+                    } /* end else */
                 } /* end if */
 
                 item = H5FL_FREE(H5FD_core_region_t, item);
-           } /* end while */
+            } /* end while */
 
+            if(H5F_addr_defined(start) && H5FD__core_write_back(file, start, (size_t)((end - start) + 1)) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
         } /* end if */
         /* Otherwise, write the entire file out at once */
         else {
-            if(H5FD__core_write_to_bstore(file, (haddr_t)0, (size_t)file->eof) != SUCCEED)
+            if(H5FD__core_write_back(file, (haddr_t)0, (size_t)file->eof) != SUCCEED)
                 HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "unable to write to backing store")
         } /* end else */
 
@@ -1404,6 +1725,14 @@ H5FD__core_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t closing
             unsigned char *x;       /* Pointer to new buffer for file data */
 
             /* (Re)allocate memory for the file buffer, using callback if available */
+#ifdef H5_HAVE_MMAP
+            if(file->mapped) {
+                if(H5FD__core_grow_map(file, new_eof) < 0)
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to grow mapped file")
+                x = file->mem;
+            } /* end if */
+            else
+#endif /* H5_HAVE_MMAP */
             if(file->fi_callbacks.image_realloc) {
                 if(NULL == (x = (unsigned char *)file->fi_callbacks.image_realloc(file->mem, new_eof, H5FD_FILE_IMAGE_OP_FILE_RESIZE, file->fi_callbacks.udata)))
                   HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "unable to allocate memory block with callback")
@@ -63,7 +63,9 @@ typedef struct H5FD_direct_fapl_t {
  * the current operation is the same as the previous operation.  When opening
  * a file the `eof' will be set to the current file size, `eoa' will be set
  * to zero, `pos' will be set to H5F_ADDR_UNDEF (as it is when an error
- * occurs), and `op' will be set to H5F_OP_UNKNOWN.
+ * occurs), and `op' will be set to H5F_OP_UNKNOWN.  The `copy_buf' is
+ * allocated the first time a request that isn't aligned is copied through
+ * it, and kept for later requests until the file is closed.
  */
 typedef struct H5FD_direct_t {
     H5FD_t  pub;      /*public stuff, must be first  */
@@ -73,6 +75,8 @@ typedef struct H5FD_direct_t {
     haddr_t  pos;      /*current file I/O position  */
     int    op;      /*last operation    */
     H5FD_direct_fapl_t  fa;    /*file access properties  */
+    void   *copy_buf;    /*aligned buffer for copying unaligned data */
+    size_t  copy_buf_size;  /*size of the copy buffer  */
 #ifndef H5_HAVE_WIN32_API
     /*
      * On most systems the combination of device and i-node number uniquely
@@ -139,6 +143,7 @@ static herr_t H5FD_direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, h
 static herr_t H5FD_direct_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_direct_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_direct_unlock(H5FD_t *_file);
+static void *H5FD_direct_get_copy_buf(H5FD_direct_t *file, size_t size);
 
 
 static const H5FD_class_t H5FD_direct_g = {
@@ -173,7 +178,10 @@ static const H5FD_class_t H5FD_direct_g = {
     H5FD_direct_truncate,      	/*truncate    */
     H5FD_direct_lock,          	/*lock                  */
     H5FD_direct_unlock,        	/*unlock                */
-    H5FD_FLMAP_DICHOTOMY       	/*fl_map                */
+    H5FD_FLMAP_DICHOTOMY,      	/*fl_map                */
+    NULL,                     /*read_vector */
+    NULL,                     /*write_vector */
+    NULL                      /*map */
 };
 
 /* Declare a free list to manage the H5FD_direct_t struct */
@@ -567,6 +575,10 @@ H5FD_direct_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxadd
     if(buf2)
         HDfree(buf2);
 
+    /* Let the library know which memory alignment lets its buffers be
+     * transferred without copying */
+    file->pub.mem_align = file->fa.must_align ? file->fa.mboundary : 0;
+
     /* Set return value */
     ret_value=(H5FD_t*)file;
 
@@ -607,6 +619,10 @@ H5FD_direct_close(H5FD_t *_file)
     if (HDclose(file->fd)<0)
         HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
 
+    /* Free with HDfree since it came from posix_memalign */
+    if(file->copy_buf)
+        HDfree(file->copy_buf);
+
     H5FL_FREE(H5FD_direct_t,file);
 
 done:
@@ -689,8 +705,10 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_direct_query(const H5FD_t H5_ATTR_UNUSED * _f, unsigned long *flags /* out */)
+H5FD_direct_query(const H5FD_t *_f, unsigned long *flags /* out */)
 {
+    const H5FD_direct_t *file = (const H5FD_direct_t *)_f;
+
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
     /* Set the VFL feature flags that this driver supports */
@@ -700,6 +718,8 @@ H5FD_direct_query(const H5FD_t H5_ATTR_UNUSED * _f, unsigned long *flags /* out
         *flags |= H5FD_FEAT_ACCUMULATE_METADATA;    /* OK to accumulate metadata for faster writes                      */
         *flags |= H5FD_FEAT_DATA_SIEVE;             /* OK to perform data sieving for faster raw data reads & writes    */
         *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+        if(file && file->fa.must_align)
+            *flags |= H5FD_FEAT_ALIGNED_MEM;        /* I/O buffers aligned to 'mem_align' avoid a copy                  */
     }
 
     FUNC_LEAVE_NOAPI(SUCCEED)
@@ -833,6 +853,55 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:  H5FD_direct_get_copy_buf
+ *
+ * Purpose:  Returns the file's aligned copy buffer, making it at least
+ *    SIZE bytes.  The buffer is kept between requests, so that
+ *    requests that aren't aligned don't allocate a buffer of their
+ *    own each time.
+ *
+ * Return:  Success:  Pointer to the copy buffer
+ *
+ *    Failure:  NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_direct_get_copy_buf(H5FD_direct_t *file, size_t size)
+{
+    void    *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(size > 0 && size <= file->fa.cbsize);
+    HDassert(!(size % file->fa.fbsize));
+
+    /* Replace the buffer if it's too small */
+    if(size > file->copy_buf_size) {
+        /* Free with HDfree since it came from posix_memalign */
+        if(file->copy_buf) {
+            HDfree(file->copy_buf);
+            file->copy_buf = NULL;
+            file->copy_buf_size = 0;
+        } /* end if */
+
+        if(HDposix_memalign(&file->copy_buf, file->fa.mboundary, size) != 0) {
+            file->copy_buf = NULL;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "HDposix_memalign failed")
+        } /* end if */
+        file->copy_buf_size = size;
+    } /* end if */
+
+    /* Set return value */
+    ret_value = file->copy_buf;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_direct_get_copy_buf() */
+
 
 /*-------------------------------------------------------------------------
  * Function:  H5FD_direct_read
@@ -854,7 +923,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+H5FD_direct_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
          size_t size, void *buf/*out*/)
 {
     H5FD_direct_t  *file = (H5FD_direct_t*)_file;
@@ -893,6 +962,26 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     _fbsize = file->fa.fbsize;
     _cbsize = file->fa.cbsize;
 
+    /* If the data isn't aligned, but it covers whole file blocks whose memory
+     * is aligned, read those blocks directly into the buffer and only copy
+     * the partial blocks at either end through the copy buffer.
+     */
+    if(_must_align && !((addr%_fbsize==0) && (size%_fbsize==0) && ((size_t)buf%_boundary==0))) {
+        size_t head = (size_t)((_fbsize - addr % _fbsize) % _fbsize);
+
+        if(size >= head + _fbsize && (((size_t)buf + head) % _boundary) == 0) {
+            size_t body = ((size - head) / _fbsize) * _fbsize;
+
+            if(head > 0 && H5FD_direct_read(_file, type, dxpl_id, addr, head, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read start of data")
+            if(H5FD_direct_read(_file, type, dxpl_id, addr + head, body, (unsigned char *)buf + head) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read aligned data")
+            if(size > head + body && H5FD_direct_read(_file, type, dxpl_id, addr + head + body, size - (head + body), (unsigned char *)buf + head + body) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read end of data")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
     /* if the data is aligned or the system doesn't require data to be aligned,
      * read it directly from the file.  If not, read a bigger
      * and aligned data first, then copy the data into memory buffer.
@@ -917,6 +1006,12 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
     }
     HDassert(nbytes>=0);
     HDassert((size_t)nbytes<=size);
+    if (_must_align && ((size_t)nbytes % _fbsize) != 0) {
+        /* partial block at the end of the file, the rest can't be read
+         * without losing the alignment */
+        HDmemset((char*)buf + nbytes, 0, size - (size_t)nbytes);
+        size = (size_t)nbytes;
+    }
     H5_CHECK_OVERFLOW(nbytes,ssize_t,size_t);
     size -= (size_t)nbytes;
     H5_CHECK_OVERFLOW(nbytes,ssize_t,haddr_t);
@@ -934,8 +1029,8 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
       if(alloc_size > _cbsize)
         alloc_size = _cbsize;
       HDassert(!(alloc_size % _fbsize));
-      if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+      if (NULL == (copy_buf = H5FD_direct_get_copy_buf(file, alloc_size)))
+    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get copy buffer")
 
             /* look for the aligned position for reading the data */
             HDassert(!(((addr / _fbsize) * _fbsize) % _fbsize));
@@ -993,12 +1088,6 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
 
       /*Final step: update address*/
       addr = (haddr_t)(((addr + size - 1) / _fbsize + 1) * _fbsize);
-
-      if(copy_buf) {
-                /* Free with HDfree since it came from posix_memalign */
-                HDfree(copy_buf);
-                copy_buf = NULL;
-            } /* end if */
     }
 
     /* Update current position */
@@ -1007,10 +1096,6 @@ H5FD_direct_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UN
 
 done:
     if(ret_value<0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if(copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
@@ -1039,7 +1124,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id, haddr_t addr,
+H5FD_direct_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     size_t size, const void *buf)
 {
     H5FD_direct_t  *file = (H5FD_direct_t*)_file;
@@ -1081,6 +1166,26 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
     _fbsize = file->fa.fbsize;
     _cbsize = file->fa.cbsize;
 
+    /* If the data isn't aligned, but it covers whole file blocks whose memory
+     * is aligned, write those blocks directly from the buffer and only copy
+     * the partial blocks at either end through the copy buffer.
+     */
+    if(_must_align && !((addr%_fbsize==0) && (size%_fbsize==0) && ((size_t)buf%_boundary==0))) {
+        size_t head = (size_t)((_fbsize - addr % _fbsize) % _fbsize);
+
+        if(size >= head + _fbsize && (((size_t)buf + head) % _boundary) == 0) {
+            size_t body = ((size - head) / _fbsize) * _fbsize;
+
+            if(head > 0 && H5FD_direct_write(_file, type, dxpl_id, addr, head, buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write start of data")
+            if(H5FD_direct_write(_file, type, dxpl_id, addr + head, body, (const unsigned char *)buf + head) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write aligned data")
+            if(size > head + body && H5FD_direct_write(_file, type, dxpl_id, addr + head + body, size - (head + body), (const unsigned char *)buf + head + body) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write end of data")
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+    } /* end if */
+
     /* if the data is aligned or the system doesn't require data to be aligned,
      * write it directly to the file.  If not, read a bigger and aligned data
      * first, update buffer with user data, then write the data out.
@@ -1120,8 +1225,8 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
                 alloc_size = _cbsize;
             HDassert(!(alloc_size % _fbsize));
 
-      if (HDposix_memalign(&copy_buf, _boundary, alloc_size) != 0)
-    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "HDposix_memalign failed")
+      if (NULL == (copy_buf = H5FD_direct_get_copy_buf(file, alloc_size)))
+    HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't get copy buffer")
 
             /* look for the right position for reading or writing the data */
             if(HDlseek(file->fd, (HDoff_t)write_addr, SEEK_SET) < 0)
@@ -1226,12 +1331,6 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
   /*Update the address and size*/
   addr = write_addr;
   buf = (const char*)buf + size;
-
-  if(copy_buf) {
-    /* Free with HDfree since it came from posix_memalign */
-      HDfree(copy_buf);
-      copy_buf = NULL;
-        } /* end if */
     }
 
     /* Update current position and eof */
@@ -1242,10 +1341,6 @@ H5FD_direct_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_U
 
 done:
     if(ret_value<0) {
-        /* Free with HDfree since it came from posix_memalign */
-        if(copy_buf)
-            HDfree(copy_buf);
-
         /* Reset last file I/O information */
         file->pos = HADDR_UNDEF;
         file->op = OP_UNKNOWN;
@@ -32,6 +32,13 @@
  *		can be quite time consuming on file systems that don't
  *		implement holes, like nfs).
  *
+ *		A striped family instead has a fixed number of members, and
+ *		spreads the address space over them round-robin in stripes
+ *		of a fixed size, so that a large request is spread over all
+ *		the members.  With the members on different devices, and
+ *		member I/O threads (see H5Pset_member_io_threads()), this
+ *		gives the aggregate bandwidth of the devices.
+ *
  */
 
 #include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
@@ -64,6 +71,8 @@ typedef struct H5FD_family_t {
     haddr_t	eoa;		/*end of allocated addresses		*/
     char	*name;		/*name generator printf format		*/
     unsigned	flags;		/*flags for opening additional members	*/
+    hsize_t	stripe_size;	/*size of each stripe, or zero if the
+                                 * family isn't striped			*/
 
     /* Information from properties set by 'h5repart' tool */
     hsize_t	mem_newsize;	/*new member size passed in as private
@@ -77,6 +86,8 @@ typedef struct H5FD_family_t {
 typedef struct H5FD_family_fapl_t {
     hsize_t	memb_size;	/*size of each member			*/
     hid_t	memb_fapl_id;	/*file access property list of each memb*/
+    hsize_t	stripe_size;	/*size of each stripe, or zero		*/
+    unsigned	stripe_count;	/*number of striped members		*/
 } H5FD_family_fapl_t;
 
 /* Callback prototypes */
@@ -102,11 +113,22 @@ static herr_t H5FD_family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, ha
 			       size_t size, void *_buf/*out*/);
 static herr_t H5FD_family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
 				size_t size, const void *_buf);
+static herr_t H5FD_family_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/);
+static herr_t H5FD_family_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[]);
 static herr_t H5FD_family_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_family_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_family_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_family_unlock(H5FD_t *_file);
 
+/* Helper routines */
+static void H5FD_family_locate(const H5FD_family_t *file, haddr_t addr,
+    unsigned *memb, haddr_t *memb_addr, hsize_t *avail);
+static herr_t H5FD_family_io(H5FD_family_t *file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[],
+    hbool_t do_write);
+
 /* The class struct */
 static const H5FD_class_t H5FD_family_g = {
     "family",					/*name			*/
@@ -140,7 +162,10 @@ static const H5FD_class_t H5FD_family_g = {
     H5FD_family_truncate,			/*truncate		*/
     H5FD_family_lock,                           /*lock                  */
     H5FD_family_unlock,                         /*unlock                */
-    H5FD_FLMAP_DICHOTOMY                        /*fl_map                */
+    H5FD_FLMAP_DICHOTOMY,                       /*fl_map                */
+    H5FD_family_read_vector,			/*read_vector		*/
+    H5FD_family_write_vector,			/*write_vector		*/
+    NULL					/*map			*/
 };
 
 
@@ -259,7 +284,7 @@ herr_t
 H5Pset_fapl_family(hid_t fapl_id, hsize_t msize, hid_t memb_fapl_id)
 {
     herr_t ret_value;
-    H5FD_family_fapl_t	fa={0, -1};
+    H5FD_family_fapl_t	fa={0, -1, 0, 0};
     H5P_genplist_t *plist;      /* Property list pointer */
 
     FUNC_ENTER_API(FAIL)
@@ -337,6 +362,105 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_fapl_family_striped
+ *
+ * Purpose:	Sets the file access property list FAPL_ID to use the family
+ *		driver with STRIPE_COUNT members, over which the address
+ *		space is spread round-robin in stripes of STRIPE_SIZE bytes.
+ *		MEMB_FAPL_ID is a file access property list to be used for
+ *		each family member.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_family_striped(hid_t fapl_id, hsize_t stripe_size,
+    unsigned stripe_count, hid_t memb_fapl_id)
+{
+    H5FD_family_fapl_t	fa={0, -1, 0, 0};
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ihIui", fapl_id, stripe_size, stripe_count, memb_fapl_id);
+
+    /* Check arguments */
+    if(TRUE != H5P_isa_class(fapl_id, H5P_FILE_ACCESS))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(0 == stripe_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe size must not be zero")
+    if(0 == stripe_count)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "stripe count must not be zero")
+    if(H5P_DEFAULT == memb_fapl_id)
+        memb_fapl_id = H5P_FILE_ACCESS_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(memb_fapl_id, H5P_FILE_ACCESS))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+
+    /* Initialize driver specific information. */
+    fa.memb_fapl_id = memb_fapl_id;
+    fa.stripe_size = stripe_size;
+    fa.stripe_count = stripe_count;
+
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    ret_value = H5P_set_driver(plist, H5FD_FAMILY, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_family_striped() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_fapl_family_striped
+ *
+ * Purpose:	Returns the stripe settings of a family file access
+ *		property list.  The stripe size and count are zero for a
+ *		family that isn't striped.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_family_striped(hid_t fapl_id, hsize_t *stripe_size/*out*/,
+    unsigned *stripe_count/*out*/, hid_t *memb_fapl_id/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    const H5FD_family_fapl_t	*fa;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE4("e", "ixxx", fapl_id, stripe_size, stripe_count, memb_fapl_id);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_FAMILY != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_family_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+    if(stripe_size)
+        *stripe_size = fa->stripe_size;
+    if(stripe_count)
+        *stripe_count = fa->stripe_count;
+    if(memb_fapl_id) {
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(fa->memb_fapl_id)))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+        *memb_fapl_id = H5P_copy_plist(plist, TRUE);
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_family_striped() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_family_fapl_get
@@ -369,6 +493,10 @@ H5FD_family_fapl_get(H5FD_t *_file)
         HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
 
     fa->memb_size = file->memb_size;
+    if(file->stripe_size) {
+        fa->stripe_size = file->stripe_size;
+        fa->stripe_count = file->nmembs;
+    } /* end if */
     if(NULL == (plist = (H5P_genplist_t *)H5I_object(file->memb_fapl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
     fa->memb_fapl_id = H5P_copy_plist(plist, FALSE);
@@ -491,13 +619,22 @@ done:
  *-------------------------------------------------------------------------
  */
 static hsize_t
-H5FD_family_sb_size(H5FD_t H5_ATTR_UNUSED *_file)
+H5FD_family_sb_size(H5FD_t *_file)
 {
+    H5FD_family_t	*file = (H5FD_family_t*)_file;
+    hsize_t		ret_value;
+
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
-    /* 8 bytes field for the size of member file size field should be
+    /* A striped family stores the stripe size and count.  Otherwise 8
+     * bytes field for the size of member file size field should be
      * enough for now. */
-    FUNC_LEAVE_NOAPI(8)
+    if(file->stripe_size)
+        ret_value = 12;
+    else
+        ret_value = 8;
+
+    FUNC_LEAVE_NOAPI(ret_value)
 }
 
 
@@ -509,6 +646,9 @@ H5FD_family_sb_size(H5FD_t H5_ATTR_UNUSED *_file)
  *		an eight-character name/version number and null termination.
  *
  *		The encoding is the member file size and name template.
+ *		A striped family is encoded under a different name, as the
+ *		stripe size and number of members, so that libraries which
+ *		don't know about striping can't open it.
  *
  * Return:	Success:	0
  *
@@ -528,19 +668,27 @@ H5FD_family_sb_encode(H5FD_t *_file, char *name/*out*/, unsigned char *buf/*out*
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
-    /* Name and version number */
-    HDstrncpy(name, "NCSAfami", (size_t)9);
-    name[8] = '\0';
-
-    /* Store member file size.  Use the member file size from the property here.
-     * This is to guarantee backward compatibility.  If a file is created with
-     * v1.6 library and the driver info isn't saved in the superblock.  We open
-     * it with v1.8, the FILE->MEMB_SIZE will be the actual size of the first
-     * member file (see H5FD_family_open).  So it isn't safe to use FILE->MEMB_SIZE.
-     * If the file is created with v1.8, the correctness of FILE->PMEM_SIZE is
-     * checked in H5FD_family_sb_decode. SLU - 2009/3/21
-     */
-    UINT64ENCODE(buf, (uint64_t)file->pmem_size);
+    if(file->stripe_size) {
+        HDstrncpy(name, "NCSAfstr", (size_t)9);
+        name[8] = '\0';
+        UINT64ENCODE(buf, (uint64_t)file->stripe_size);
+        UINT32ENCODE(buf, file->nmembs);
+    } /* end if */
+    else {
+        /* Name and version number */
+        HDstrncpy(name, "NCSAfami", (size_t)9);
+        name[8] = '\0';
+
+        /* Store member file size.  Use the member file size from the property here.
+         * This is to guarantee backward compatibility.  If a file is created with
+         * v1.6 library and the driver info isn't saved in the superblock.  We open
+         * it with v1.8, the FILE->MEMB_SIZE will be the actual size of the first
+         * member file (see H5FD_family_open).  So it isn't safe to use FILE->MEMB_SIZE.
+         * If the file is created with v1.8, the correctness of FILE->PMEM_SIZE is
+         * checked in H5FD_family_sb_decode. SLU - 2009/3/21
+         */
+        UINT64ENCODE(buf, (uint64_t)file->pmem_size);
+    } /* end else */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5FD_family_sb_encode() */
@@ -565,7 +713,7 @@ H5FD_family_sb_encode(H5FD_t *_file, char *name/*out*/, unsigned char *buf/*out*
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5FD_family_sb_decode(H5FD_t *_file, const char H5_ATTR_UNUSED *name, const unsigned char *buf)
+H5FD_family_sb_decode(H5FD_t *_file, const char *name, const unsigned char *buf)
 {
     H5FD_family_t	*file = (H5FD_family_t*)_file;
     uint64_t            msize;
@@ -573,6 +721,22 @@ H5FD_family_sb_decode(H5FD_t *_file, const char H5_ATTR_UNUSED *name, const unsi
 
     FUNC_ENTER_NOAPI_NOINIT
 
+    /* The stripes of a striped family must match the file access property */
+    if(!HDstrncmp(name, "NCSAfstr", (size_t)8)) {
+        uint64_t        stripe_size;
+        unsigned        stripe_count;
+
+        UINT64DECODE(buf, stripe_size);
+        UINT32DECODE(buf, stripe_count);
+        if(0 == file->stripe_size)
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "family file is striped, use H5Pset_fapl_family_striped")
+        if(stripe_size != file->stripe_size || stripe_count != file->nmembs)
+            HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "Family stripe size and count should be %llu and %u.  But they are %llu and %u from the file access property", (unsigned long long)stripe_size, stripe_count, (unsigned long long)file->stripe_size, file->nmembs)
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    if(file->stripe_size)
+        HGOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "family file isn't striped")
+
     /* Read member file size. Skip name template for now although it's saved. */
     UINT64DECODE(buf, msize);
 
@@ -625,6 +789,7 @@ H5FD_family_open(const char *name, unsigned flags, hid_t fapl_id,
     char		*memb_name = NULL, *temp = NULL;
     hsize_t		eof = HADDR_UNDEF;
     unsigned		t_flags = flags & ~H5F_ACC_CREAT;
+    unsigned		stripe_count = 0;
     H5FD_t     		*ret_value = NULL;
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -677,6 +842,8 @@ H5FD_family_open(const char *name, unsigned flags, hid_t fapl_id,
         } /* end else */
         file->memb_size = fa->memb_size; /* Actual member size to be updated later */
         file->pmem_size = fa->memb_size; /* Member size passed in through property */
+        file->stripe_size = fa->stripe_size;
+        stripe_count = fa->stripe_count;
     } /* end else */
     file->name = H5MM_strdup(name);
     file->flags = flags;
@@ -693,45 +860,62 @@ H5FD_family_open(const char *name, unsigned flags, hid_t fapl_id,
     if(!HDstrcmp(memb_name, temp))
         HGOTO_ERROR(H5E_FILE, H5E_FILEEXISTS, NULL, "file names not unique")
 
-    /* Open all the family members */
-    while(1) {
-        HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, name, file->nmembs);
-
-        /* Enlarge member array */
-        if(file->nmembs >= file->amembs) {
-            unsigned n = MAX(64, 2 * file->amembs);
-            H5FD_t **x;
-
-            HDassert(n > 0);
-            if(NULL == (x = (H5FD_t **)H5MM_realloc(file->memb, n * sizeof(H5FD_t *))))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to reallocate members")
-            file->amembs = n;
-            file->memb = x;
-        } /* end if */
-
-        /*
-         * Attempt to open file. If the first file cannot be opened then fail;
-         * otherwise an open failure means that we've reached the last member.
-         * Allow H5F_ACC_CREAT only on the first family member.
-         */
-        H5E_BEGIN_TRY {
-            file->memb[file->nmembs] = H5FDopen(memb_name,
-                (0==file->nmembs ? flags : t_flags), file->memb_fapl_id, HADDR_UNDEF);
-        } H5E_END_TRY;
-        if (!file->memb[file->nmembs]) {
-            if (0==file->nmembs)
+    /* A striped family has all its members from the start */
+    if(file->stripe_size) {
+        if(NULL == (file->memb = (H5FD_t **)H5MM_calloc(stripe_count * sizeof(H5FD_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate members")
+        file->amembs = stripe_count;
+        while(file->nmembs < stripe_count) {
+            HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, name, file->nmembs);
+            H5E_BEGIN_TRY {
+                file->memb[file->nmembs] = H5FDopen(memb_name, flags, file->memb_fapl_id, HADDR_UNDEF);
+            } H5E_END_TRY;
+            if(NULL == file->memb[file->nmembs])
                 HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open member file")
-            H5E_clear_stack(NULL);
-            break;
+            file->nmembs++;
+        } /* end while */
+    } /* end if */
+    else {
+        /* Open all the family members */
+        while(1) {
+            HDsnprintf(memb_name, H5FD_FAM_MEMB_NAME_BUF_SIZE, name, file->nmembs);
+
+            /* Enlarge member array */
+            if(file->nmembs >= file->amembs) {
+                unsigned n = MAX(64, 2 * file->amembs);
+                H5FD_t **x;
+
+                HDassert(n > 0);
+                if(NULL == (x = (H5FD_t **)H5MM_realloc(file->memb, n * sizeof(H5FD_t *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to reallocate members")
+                file->amembs = n;
+                file->memb = x;
+            } /* end if */
+
+            /*
+             * Attempt to open file. If the first file cannot be opened then fail;
+             * otherwise an open failure means that we've reached the last member.
+             * Allow H5F_ACC_CREAT only on the first family member.
+             */
+            H5E_BEGIN_TRY {
+                file->memb[file->nmembs] = H5FDopen(memb_name,
+                    (0==file->nmembs ? flags : t_flags), file->memb_fapl_id, HADDR_UNDEF);
+            } H5E_END_TRY;
+            if (!file->memb[file->nmembs]) {
+                if (0==file->nmembs)
+                    HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open member file")
+                H5E_clear_stack(NULL);
+                break;
+            }
+            file->nmembs++;
         }
-        file->nmembs++;
-    }
+    } /* end else */
 
     /* If the file is reopened and there's only one member file existing, this file maybe
      * smaller than the size specified through H5Pset_fapl_family().  Update the actual
      * member size.
      */
-    if ((eof=H5FDget_eof(file->memb[0], H5FD_MEM_DEFAULT))) file->memb_size = eof;
+    if (!file->stripe_size && (eof=H5FDget_eof(file->memb[0], H5FD_MEM_DEFAULT))) file->memb_size = eof;
 
     ret_value=(H5FD_t *)file;
 
@@ -957,6 +1141,25 @@ H5FD_family_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t abs_eoa)
 
     FUNC_ENTER_NOAPI_NOINIT
 
+    /* Give each member of a striped family its stripes below the EOA */
+    if(file->stripe_size) {
+        hsize_t     row_size = file->stripe_size * file->nmembs;   /* Bytes in one stripe of every member */
+        haddr_t     nrows = abs_eoa / row_size;                     /* Number of complete rows */
+        hsize_t     rest = abs_eoa % row_size;                      /* Bytes in the last, partial row */
+
+        for(u = 0; u < file->nmembs; u++) {
+            haddr_t memb_eoa = nrows * file->stripe_size;
+
+            if(rest > u * file->stripe_size)
+                memb_eoa += MIN(rest - u * file->stripe_size, file->stripe_size);
+            if(H5FD_set_eoa(file->memb[u], type, memb_eoa) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "unable to set file eoa")
+        } /* end for */
+
+        file->eoa = abs_eoa;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
     /* Allocate space for the member name buffer */
     if(NULL == (memb_name = (char *)H5MM_malloc(H5FD_FAM_MEMB_NAME_BUF_SIZE)))
         HGOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "unable to allocate member name")
@@ -1043,27 +1246,48 @@ H5FD_family_get_eof(const H5FD_t *_file, H5FD_mem_t type)
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
-    /*
-     * Find the last member that has a non-zero EOF and break out of the loop
-     * with `i' equal to that member. If all members have zero EOF then exit
-     * loop with i==0.
-     */
     HDassert(file->nmembs > 0);
-    for(i = (int)file->nmembs - 1; i >= 0; --i) {
-        if((eof = H5FD_get_eof(file->memb[i], type)) != 0)
-            break;
-        if(0 == i)
-            break;
-    } /* end for */
-
-    /* Adjust for base address for file */
-    eof += file->pub.base_addr;
 
-    /*
-     * The file size is the number of members before the i'th member plus the
-     * size of the i'th member.
+    /* The EOF of a striped family is just past the last byte of whichever
+     * member's last stripe is furthest into the address space
      */
-    eof += ((unsigned)i)*file->memb_size;
+    if(file->stripe_size) {
+        hsize_t     row_size = file->stripe_size * file->nmembs;   /* Bytes in one stripe of every member */
+        unsigned    u;                                              /* Local index variable */
+
+        for(u = 0; u < file->nmembs; u++) {
+            haddr_t memb_eof = H5FD_get_eof(file->memb[u], type);
+
+            if(memb_eof > 0) {
+                haddr_t last = memb_eof - 1;    /* Last byte in the member */
+
+                last = (last / file->stripe_size) * row_size + u * file->stripe_size + last % file->stripe_size;
+                eof = MAX(eof, last + 1);
+            } /* end if */
+        } /* end for */
+    } /* end if */
+    else {
+        /*
+         * Find the last member that has a non-zero EOF and break out of the loop
+         * with `i' equal to that member. If all members have zero EOF then exit
+         * loop with i==0.
+         */
+        for(i = (int)file->nmembs - 1; i >= 0; --i) {
+            if((eof = H5FD_get_eof(file->memb[i], type)) != 0)
+                break;
+            if(0 == i)
+                break;
+        } /* end for */
+
+        /* Adjust for base address for file */
+        eof += file->pub.base_addr;
+
+        /*
+         * The file size is the number of members before the i'th member plus the
+         * size of the i'th member.
+         */
+        eof += ((unsigned)i)*file->memb_size;
+    } /* end else */
 
     /* Set return value */
     ret_value = eof;
@@ -1092,7 +1316,7 @@ H5FD_family_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
     H5FD_family_t       *file = (H5FD_family_t *)_file;
     H5P_genplist_t      *plist;
     hsize_t             offset;
-    int                 memb;
+    unsigned            memb;
     herr_t              ret_value = FAIL;       /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -1103,9 +1327,17 @@ H5FD_family_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle)
     if(H5P_get(plist, H5F_ACS_FAMILY_OFFSET_NAME, &offset) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get offset for family driver")
 
-    if(offset > (file->memb_size * file->nmembs))
-        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "offset is bigger than file size")
-    memb = (int)(offset/file->memb_size);
+    if(file->stripe_size) {
+        haddr_t memb_addr;      /* Address in the member (unused) */
+        hsize_t avail;          /* Bytes left in the stripe (unused) */
+
+        H5FD_family_locate(file, (haddr_t)offset, &memb, &memb_addr, &avail);
+    } /* end if */
+    else {
+        if(offset > (file->memb_size * file->nmembs))
+            HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "offset is bigger than file size")
+        memb = (unsigned)(offset/file->memb_size);
+    } /* end else */
 
     ret_value = H5FD_get_vfd_handle(file->memb[memb], fapl, file_handle);
 
@@ -1113,13 +1345,180 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_family_locate
+ *
+ * Purpose:	Finds the member of FILE which holds address ADDR, the
+ *		address in that member, and how many bytes from ADDR on are
+ *		contiguous in the member.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_family_locate(const H5FD_family_t *file, haddr_t addr, unsigned *memb,
+    haddr_t *memb_addr, hsize_t *avail)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(file->stripe_size) {
+        hsize_t stripe = addr / file->stripe_size;      /* Stripe holding the address */
+        hsize_t offset = addr % file->stripe_size;      /* Offset in the stripe */
+
+        *memb = (unsigned)(stripe % file->nmembs);
+        *memb_addr = (stripe / file->nmembs) * file->stripe_size + offset;
+        *avail = file->stripe_size - offset;
+    } /* end if */
+    else {
+        H5_CHECKED_ASSIGN(*memb, unsigned, addr / file->memb_size, hsize_t);
+        *memb_addr = addr % file->memb_size;
+        *avail = file->memb_size - *memb_addr;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_family_locate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_family_io
+ *
+ * Purpose:	Reads or writes COUNT extents of FILE, as for the vector
+ *		I/O callbacks.  The extents are split at member boundaries,
+ *		and the pieces are gathered by member, so that each member
+ *		gets a single vector request; the members may then be
+ *		accessed concurrently (see H5FD_read_members()).
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_family_io(H5FD_family_t *file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[],
+    hbool_t do_write)
+{
+    H5FD_memb_io_t      *io = NULL;             /* Pieces in each member */
+    H5FD_mem_t          *piece_types = NULL;    /* Memory types of the pieces */
+    haddr_t             *piece_addrs = NULL;    /* Member addresses of the pieces */
+    size_t              *piece_sizes = NULL;    /* Sizes of the pieces */
+    void                **piece_bufs = NULL;    /* Buffers of the pieces */
+    size_t              npieces = 0;            /* Number of pieces */
+    size_t              offset;                 /* Offset of a member's pieces */
+    uint32_t            u;                      /* Local index variable */
+    unsigned            m;                      /* Local index variable */
+    herr_t              ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(NULL == (io = (H5FD_memb_io_t *)H5MM_calloc(file->nmembs * sizeof(H5FD_memb_io_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for member requests")
+
+    /* Count the pieces in each member, then in each pass over the extents
+     * below place them in the member's part of the piece arrays.
+     */
+    for(u = 0; u < count; u++) {
+        haddr_t     addr = addrs[u];
+        size_t      size = sizes[u];
+
+        while(size > 0) {
+            haddr_t     sub;
+            hsize_t     avail;
+            size_t      req;
+
+            H5FD_family_locate(file, addr, &m, &sub, &avail);
+            HDassert(m < file->nmembs);
+
+            /* This check is for mainly for IA32 architecture whose size_t's
+             * size is 4 bytes, to prevent overflow when user application is
+             * trying to access files bigger than 4GB. */
+            if(avail > SIZET_MAX)
+                avail = SIZET_MAX;
+            req = MIN(size, (size_t)avail);
+
+            io[m].count++;
+            npieces++;
+            addr += req;
+            size -= req;
+        } /* end while */
+    } /* end for */
+
+    if(NULL == (piece_types = (H5FD_mem_t *)H5MM_malloc(npieces * sizeof(H5FD_mem_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for piece types")
+    if(NULL == (piece_addrs = (haddr_t *)H5MM_malloc(npieces * sizeof(haddr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for piece addresses")
+    if(NULL == (piece_sizes = (size_t *)H5MM_malloc(npieces * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for piece sizes")
+    if(NULL == (piece_bufs = (void **)H5MM_malloc(npieces * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for piece buffers")
+
+    for(m = 0, offset = 0; m < file->nmembs; m++) {
+        io[m].file = file->memb[m];
+        io[m].types = piece_types + offset;
+        io[m].addrs = piece_addrs + offset;
+        io[m].sizes = piece_sizes + offset;
+        io[m].bufs = piece_bufs + offset;
+        offset += io[m].count;
+        io[m].count = 0;
+    } /* end for */
+
+    for(u = 0; u < count; u++) {
+        haddr_t     addr = addrs[u];
+        size_t      size = sizes[u];
+        uint8_t     *buf = (uint8_t *)bufs[u];
+
+        while(size > 0) {
+            haddr_t     sub;
+            hsize_t     avail;
+            size_t      req;
+            uint32_t    v;
+
+            H5FD_family_locate(file, addr, &m, &sub, &avail);
+            if(avail > SIZET_MAX)
+                avail = SIZET_MAX;
+            req = MIN(size, (size_t)avail);
+
+            v = io[m].count++;
+            io[m].types[v] = types[u];
+            io[m].addrs[v] = sub;
+            io[m].sizes[v] = req;
+            io[m].bufs[v] = buf;
+
+            addr += req;
+            buf += req;
+            size -= req;
+        } /* end while */
+    } /* end for */
+
+    if(do_write) {
+        if(H5FD_write_members(file->nmembs, io, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+    } /* end if */
+    else
+        if(H5FD_read_members(file->nmembs, io, dxpl_id) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+
+done:
+    H5MM_xfree(io);
+    H5MM_xfree(piece_types);
+    H5MM_xfree(piece_addrs);
+    H5MM_xfree(piece_sizes);
+    H5MM_xfree(piece_bufs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_family_io() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_family_read
  *
  * Purpose:	Reads SIZE bytes of data from FILE beginning at address ADDR
  *		into buffer BUF according to data transfer properties in
- *		DXPL_ID.
+ *		DXPL_ID.  Requests that span members are read with
+ *		H5FD_family_io().
  *
  * Return:	Success:	Zero. Result is stored in caller-supplied
  *				buffer BUF.
@@ -1138,10 +1537,8 @@ H5FD_family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, si
 		 void *_buf/*out*/)
 {
     H5FD_family_t	*file = (H5FD_family_t*)_file;
-    unsigned char	*buf = (unsigned char*)_buf;
     haddr_t		sub;
-    size_t		req;
-    hsize_t             tempreq;
+    hsize_t             avail;
     unsigned		u;              /* Local index variable */
     H5P_genplist_t      *plist;      /* Property list pointer */
     herr_t              ret_value=SUCCEED;       /* Return value */
@@ -1155,29 +1552,17 @@ H5FD_family_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, si
     if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
-    /* Read from each member */
-    while(size > 0) {
-        H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
-
-        sub = addr % file->memb_size;
-
-	/* This check is for mainly for IA32 architecture whose size_t's size
-	 * is 4 bytes, to prevent overflow when user application is trying to
-	 * write files bigger than 4GB. */
-        tempreq = file->memb_size-sub;
-  	if(tempreq > SIZET_MAX)
-	    tempreq = SIZET_MAX;
-        req = MIN(size, (size_t)tempreq);
-
+    /* Read a request in one member directly */
+    H5FD_family_locate(file, addr, &u, &sub, &avail);
+    if(size <= avail) {
         HDassert(u<file->nmembs);
 
-        if (H5FDread(file->memb[u], type, dxpl_id, sub, req, buf)<0)
+        if(H5FD_read(file->memb[u], plist, type, sub, size, _buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+    } /* end if */
+    else
+        if(H5FD_family_io(file, dxpl_id, (uint32_t)1, &type, &addr, &size, &_buf, FALSE) < 0)
             HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
-
-        addr += req;
-        buf += req;
-        size -= req;
-    }
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -1189,7 +1574,8 @@ done:
  *
  * Purpose:	Writes SIZE bytes of data to FILE beginning at address ADDR
  *		from buffer BUF according to data transfer properties in
- *		DXPL_ID.
+ *		DXPL_ID.  Requests that span members are written with
+ *		H5FD_family_io().
  *
  * Return:	Success:	Zero
  *
@@ -1207,10 +1593,8 @@ H5FD_family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, s
 		  const void *_buf)
 {
     H5FD_family_t	*file = (H5FD_family_t*)_file;
-    const unsigned char	*buf = (const unsigned char*)_buf;
     haddr_t		sub;
-    size_t		req;
-    hsize_t             tempreq;
+    hsize_t             avail;
     unsigned		u;      /* Local index variable */
     H5P_genplist_t *plist;      /* Property list pointer */
     herr_t      ret_value = SUCCEED;       /* Return value */
@@ -1224,34 +1608,77 @@ H5FD_family_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, s
     if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
 
-    /* Write to each member */
-    while (size>0) {
-        H5_CHECKED_ASSIGN(u, unsigned, addr / file->memb_size, hsize_t);
-
-        sub = addr % file->memb_size;
-
-        /* This check is for mainly for IA32 architecture whose size_t's size
-         * is 4 bytes, to prevent overflow when user application is trying to
-         * write files bigger than 4GB. */
-        tempreq = file->memb_size-sub;
-	if(tempreq > SIZET_MAX)
-	    tempreq = SIZET_MAX;
-        req = MIN(size, (size_t)tempreq);
-
+    /* Write a request in one member directly */
+    H5FD_family_locate(file, addr, &u, &sub, &avail);
+    if(size <= avail) {
         HDassert(u<file->nmembs);
 
-        if (H5FDwrite(file->memb[u], type, dxpl_id, sub, req, buf)<0)
+        if(H5FD_write(file->memb[u], plist, type, sub, size, _buf) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+    } /* end if */
+    else {
+        void    *buf = (void *)_buf;    /* Unconstified buffer, for the I/O vector */
 
-        addr += req;
-        buf += req;
-        size -= req;
-    }
+        if(H5FD_family_io(file, dxpl_id, (uint32_t)1, &type, &addr, &size, &buf, TRUE) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+    } /* end else */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_family_read_vector
+ *
+ * Purpose:	Reads COUNT extents from FILE into the buffers BUFS, with
+ *		one vector request to each member that holds part of them.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_family_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/)
+{
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_family_io((H5FD_family_t *)_file, dxpl_id, count, types, addrs, sizes, bufs, FALSE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "member file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_family_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_family_write_vector
+ *
+ * Purpose:	Writes COUNT extents to FILE from the buffers BUFS, with
+ *		one vector request to each member that holds part of them.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_family_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_family_io((H5FD_family_t *)_file, dxpl_id, count, types, addrs, sizes, (void **)bufs, TRUE) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "member file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_family_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_family_flush
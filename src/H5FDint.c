@@ -35,21 +35,48 @@
 /* Headers */
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
+#include "H5Dprivate.h"		/* Datasets				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fprivate.h"         /* File access				*/
 #include "H5FDpkg.h"		/* File Drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
+#include "H5MMprivate.h"	/* Memory management			*/
 
 
 /****************/
 /* Local Macros */
 /****************/
 
+/* Number of extents in a vector I/O request whose absolute addresses are
+ * kept on the stack, rather than in allocated memory
+ */
+#define H5FD_VECTOR_LOCAL_NELMTS        32
+
+/* Length of the description of a failure kept from a member I/O thread */
+#define H5FD_MEMB_IO_ERR_DESC_LEN       128
+
 
 /******************/
 /* Local Typedefs */
 /******************/
 
+#ifdef H5_HAVE_THREADSAFE
+/* Member files accessed by one thread in H5FD__members_io_mt() */
+typedef struct H5FD_memb_io_task_t {
+    H5FD_memb_io_t **io;                /* Non-empty member requests */
+    unsigned    nio;                    /* Number of requests in IO */
+    unsigned    first;                  /* First request for this thread */
+    unsigned    stride;                 /* Distance between this thread's requests */
+    H5P_genplist_t *dxpl;               /* Data transfer property list */
+    hbool_t     do_write;               /* Whether the requests are writes */
+    hbool_t     worker;                 /* Whether a worker thread runs the task */
+    herr_t      status;                 /* Result of the requests */
+    hid_t       maj_id;                 /* Major error ID of a failure */
+    hid_t       min_id;                 /* Minor error ID of a failure */
+    char        desc[H5FD_MEMB_IO_ERR_DESC_LEN]; /* Description of a failure */
+} H5FD_memb_io_task_t;
+#endif /* H5_HAVE_THREADSAFE */
+
 
 /********************/
 /* Package Typedefs */
@@ -59,12 +86,32 @@
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5FD__check_vector(H5FD_t *file,
+#ifndef H5_DEBUG_BUILD
+const
+#endif /* H5_DEBUG_BUILD */
+H5P_genplist_t *dxpl, uint32_t count, const H5FD_mem_t types[],
+    const haddr_t addrs[], const size_t sizes[]);
+static herr_t H5FD__members_io(unsigned nmembs, H5FD_memb_io_t io[],
+    hid_t dxpl_id, hbool_t do_write);
+static herr_t H5FD__memb_io(H5FD_memb_io_t *io, H5P_genplist_t *dxpl,
+    hbool_t do_write);
+#ifdef H5_HAVE_THREADSAFE
+static herr_t H5FD__members_io_nthreads(unsigned nmembs,
+    const H5FD_memb_io_t io[], H5P_genplist_t *dxpl, unsigned *nthreads);
+static void *H5FD__memb_io_task(void *_task);
+static herr_t H5FD__members_io_mt(unsigned nmembs, H5FD_memb_io_t io[],
+    H5P_genplist_t *dxpl, hbool_t do_write, unsigned nthreads);
+#endif /* H5_HAVE_THREADSAFE */
 
 
 /*********************/
 /* Package Variables */
 /*********************/
 
+/* Whether member file I/O fails, for testing */
+hbool_t H5FD_memb_io_fail_g = FALSE;
+
 
 /*****************************/
 /* Library Private Variables */
@@ -298,6 +345,615 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_read_vector
+ *
+ * Purpose:	Private version of H5FDread_vector()
+ *
+ *		Reads COUNT extents in one request: extent I is SIZES[I]
+ *		bytes of memory type TYPES[I] at relative address
+ *		ADDRS[I], and is read into BUFS[I].  Drivers with a
+ *		read_vector callback get the whole request at once; for
+ *		all other drivers, the extents are read one by one with
+ *		the read callback.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_vector(H5FD_t *file,
+#ifndef H5_DEBUG_BUILD
+const
+#endif /* H5_DEBUG_BUILD */
+H5P_genplist_t *dxpl, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+    size_t sizes[], void *bufs[]/*out*/)
+{
+    haddr_t     abs_addrs_local[H5FD_VECTOR_LOCAL_NELMTS]; /* Absolute addresses, for small requests */
+    haddr_t    *abs_addrs = NULL;       /* Absolute addresses of the extents */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file && file->cls);
+    HDassert(TRUE == H5P_class_isa(H5P_CLASS(dxpl), H5P_CLS_DATASET_XFER_g));
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    /* Check the extents against the EOA of their memory types */
+    if(H5FD__check_vector(file, dxpl, count, types, addrs, sizes) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "bad extent in I/O vector")
+
+    /* Loop over the extents when the driver has no vector callback */
+    if(NULL == file->cls->read_vector) {
+        for(u = 0; u < count; u++) {
+#ifndef H5_HAVE_PARALLEL
+            /* The no-op case (see H5FD_read()) */
+            if(0 == sizes[u])
+                continue;
+#endif /* H5_HAVE_PARALLEL */
+            if((file->cls->read)(file, types[u], H5P_PLIST_ID(dxpl), addrs[u] + file->base_addr, sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read request failed")
+        } /* end for */
+    } /* end if */
+    /* (MPI drivers are called even with no extents, so that they can take
+     *  part in collective transfers)
+     */
+    else if(count > 0 || (file->feature_flags & H5FD_FEAT_HAS_MPI)) {
+        /* Convert the addresses to absolute ones */
+        if(0 == file->base_addr)
+            abs_addrs = addrs;
+        else {
+            if(count <= H5FD_VECTOR_LOCAL_NELMTS)
+                abs_addrs = abs_addrs_local;
+            else if(NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for absolute addresses")
+            for(u = 0; u < count; u++)
+                abs_addrs[u] = addrs[u] + file->base_addr;
+        } /* end else */
+
+        /* Dispatch to driver */
+        if((file->cls->read_vector)(file, H5P_PLIST_ID(dxpl), count, types, abs_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "driver read vector request failed")
+    } /* end if */
+
+done:
+    if(abs_addrs && abs_addrs != addrs && abs_addrs != abs_addrs_local)
+        H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_write_vector
+ *
+ * Purpose:	Private version of H5FDwrite_vector()
+ *
+ *		Writes COUNT extents in one request: extent I is SIZES[I]
+ *		bytes of memory type TYPES[I] at relative address
+ *		ADDRS[I], and is written from BUFS[I].  Drivers with a
+ *		write_vector callback get the whole request at once; for
+ *		all other drivers, the extents are written one by one with
+ *		the write callback.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_vector(H5FD_t *file,
+#ifndef H5_DEBUG_BUILD
+const
+#endif /* H5_DEBUG_BUILD */
+H5P_genplist_t *dxpl, uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+    size_t sizes[], const void *bufs[])
+{
+    haddr_t     abs_addrs_local[H5FD_VECTOR_LOCAL_NELMTS]; /* Absolute addresses, for small requests */
+    haddr_t    *abs_addrs = NULL;       /* Absolute addresses of the extents */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file && file->cls);
+    HDassert(TRUE == H5P_class_isa(H5P_CLASS(dxpl), H5P_CLS_DATASET_XFER_g));
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    /* Check the extents against the EOA of their memory types */
+    if(H5FD__check_vector(file, dxpl, count, types, addrs, sizes) < 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "bad extent in I/O vector")
+
+    /* Loop over the extents when the driver has no vector callback */
+    if(NULL == file->cls->write_vector) {
+        for(u = 0; u < count; u++) {
+#ifndef H5_HAVE_PARALLEL
+            /* The no-op case (see H5FD_write()) */
+            if(0 == sizes[u])
+                continue;
+#endif /* H5_HAVE_PARALLEL */
+            if((file->cls->write)(file, types[u], H5P_PLIST_ID(dxpl), addrs[u] + file->base_addr, sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write request failed")
+        } /* end for */
+    } /* end if */
+    /* (MPI drivers are called even with no extents, so that they can take
+     *  part in collective transfers)
+     */
+    else if(count > 0 || (file->feature_flags & H5FD_FEAT_HAS_MPI)) {
+        /* Convert the addresses to absolute ones */
+        if(0 == file->base_addr)
+            abs_addrs = addrs;
+        else {
+            if(count <= H5FD_VECTOR_LOCAL_NELMTS)
+                abs_addrs = abs_addrs_local;
+            else if(NULL == (abs_addrs = (haddr_t *)H5MM_malloc(count * sizeof(haddr_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for absolute addresses")
+            for(u = 0; u < count; u++)
+                abs_addrs[u] = addrs[u] + file->base_addr;
+        } /* end else */
+
+        /* Dispatch to driver */
+        if((file->cls->write_vector)(file, H5P_PLIST_ID(dxpl), count, types, abs_addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "driver write vector request failed")
+    } /* end if */
+
+done:
+    if(abs_addrs && abs_addrs != addrs && abs_addrs != abs_addrs_local)
+        H5MM_xfree(abs_addrs);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_read_members
+ *
+ * Purpose:	Reads a request that a driver has split across NMEMBS of
+ *		its member files: IO[I] holds the extents to read from one
+ *		member, with addresses relative to that member.  Each
+ *		member's extents are read with one vector request.
+ *
+ *		When the data transfer properties ask for member I/O
+ *		threads and the request is large enough, the members are
+ *		read concurrently (see H5Pset_member_io_threads()).
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_read_members(unsigned nmembs, H5FD_memb_io_t io[], hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(0 == nmembs || io);
+
+    if(H5FD__members_io(nmembs, io, dxpl_id, FALSE) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "member file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_read_members() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_write_members
+ *
+ * Purpose:	Writes a request that a driver has split across NMEMBS of
+ *		its member files, as for H5FD_read_members().
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_write_members(unsigned nmembs, H5FD_memb_io_t io[], hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(0 == nmembs || io);
+
+    if(H5FD__members_io(nmembs, io, dxpl_id, TRUE) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "member file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_write_members() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__members_io
+ *
+ * Purpose:	Common code for H5FD_read_members() and
+ *		H5FD_write_members().
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__members_io(unsigned nmembs, H5FD_memb_io_t io[], hid_t dxpl_id,
+    hbool_t do_write)
+{
+    H5P_genplist_t *dxpl;               /* Data transfer property list */
+#ifdef H5_HAVE_THREADSAFE
+    unsigned    nthreads = 1;           /* Number of threads to use */
+#endif /* H5_HAVE_THREADSAFE */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    if(NULL == (dxpl = H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a data transfer property list")
+
+#ifdef H5_HAVE_THREADSAFE
+    /* Check if the members should be accessed concurrently */
+    if(nmembs > 1)
+        if(H5FD__members_io_nthreads(nmembs, io, dxpl, &nthreads) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't determine number of member I/O threads")
+    if(nthreads > 1) {
+        if(H5FD__members_io_mt(nmembs, io, dxpl, do_write, nthreads) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_IO, FAIL, "concurrent member file I/O failed")
+    } /* end if */
+    else
+#endif /* H5_HAVE_THREADSAFE */
+    for(u = 0; u < nmembs; u++)
+        if(io[u].count > 0)
+            if(H5FD__memb_io(&io[u], dxpl, do_write) < 0)
+                HGOTO_ERROR(H5E_VFL, H5E_IO, FAIL, "member file I/O failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__members_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__memb_io
+ *
+ * Purpose:	Reads or writes the extents of one member file.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__memb_io(H5FD_memb_io_t *io, H5P_genplist_t *dxpl, hbool_t do_write)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(io && io->file);
+
+    if(H5FD_memb_io_fail_g)
+        HGOTO_ERROR(H5E_VFL, H5E_IO, FAIL, "simulated member file I/O failure")
+
+    if(do_write) {
+        if(H5FD_write_vector(io->file, dxpl, io->count, io->types, io->addrs, io->sizes, (const void **)io->bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_WRITEERROR, FAIL, "member file write failed")
+    } /* end if */
+    else
+        if(H5FD_read_vector(io->file, dxpl, io->count, io->types, io->addrs, io->sizes, io->bufs) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_READERROR, FAIL, "member file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__memb_io() */
+
+#ifdef H5_HAVE_THREADSAFE
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__members_io_nthreads
+ *
+ * Purpose:	Determines how many threads H5FD__members_io() should use
+ *		to access the members in IO, from the thread count and
+ *		minimum number of bytes per thread in the data transfer
+ *		property list.  Members accessed through MPI are always
+ *		accessed by the calling thread.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__members_io_nthreads(unsigned nmembs, const H5FD_memb_io_t io[],
+    H5P_genplist_t *dxpl, unsigned *nthreads)
+{
+    unsigned    max_threads;            /* Thread count from property list */
+    size_t      min_size;               /* Minimum # of bytes per thread */
+    size_t      total = 0;              /* Total # of bytes in the request */
+    unsigned    nbusy = 0;              /* Number of members with extents */
+    unsigned    u, v;                   /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(nthreads);
+
+    *nthreads = 1;
+
+    /* Get the thread settings */
+    if(H5P_get(dxpl, H5D_XFER_MEMB_IO_NTHREADS_NAME, &max_threads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get member I/O thread count")
+    if(max_threads <= 1)
+        HGOTO_DONE(SUCCEED)
+    if(H5P_get(dxpl, H5D_XFER_MEMB_IO_MIN_SIZE_NAME, &min_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get member I/O bytes per thread")
+    HDassert(min_size > 0);
+
+    for(u = 0; u < nmembs; u++)
+        if(io[u].count > 0) {
+            if(io[u].file->feature_flags & H5FD_FEAT_HAS_MPI)
+                HGOTO_DONE(SUCCEED)
+            for(v = 0; v < io[u].count; v++)
+                total += io[u].sizes[v];
+            nbusy++;
+        } /* end if */
+
+    *nthreads = (unsigned)MIN3((size_t)max_threads, (size_t)nbusy, total / min_size);
+    if(*nthreads < 2)
+        *nthreads = 1;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__members_io_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__memb_io_task
+ *
+ * Purpose:	Thread routine which accesses one thread's share of the
+ *		members for H5FD__members_io_mt().
+ *
+ *		A worker thread's errors are pushed on its own error
+ *		stack, which the calling thread can't see.  When the
+ *		task fails in a worker thread, the major and minor error
+ *		IDs and the description of the innermost error are kept
+ *		in the task, and the worker's error stack is cleared.
+ *
+ * Return:	NULL (the result is stored in the task)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD__memb_io_task(void *_task)
+{
+    H5FD_memb_io_task_t *task = (H5FD_memb_io_task_t *)_task;
+    unsigned    u;                      /* Local index variable */
+
+    task->status = SUCCEED;
+    for(u = task->first; u < task->nio; u += task->stride)
+        if(H5FD__memb_io(task->io[u], task->dxpl, task->do_write) < 0) {
+            task->status = FAIL;
+            break;
+        } /* end if */
+
+    if(task->status < 0 && task->worker) {
+        if(H5E_get_innermost_error(&task->maj_id, &task->min_id, task->desc, sizeof(task->desc)) < 0) {
+            task->maj_id = H5E_VFL;
+            task->min_id = H5E_IO;
+            HDstrncpy(task->desc, "member file I/O failed", sizeof(task->desc));
+        } /* end if */
+        H5E_clear_stack(NULL);
+    } /* end if */
+
+    return NULL;
+} /* end H5FD__memb_io_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__members_io_mt
+ *
+ * Purpose:	Accesses the members in IO with NTHREADS threads, which
+ *		take the members with extents in turn.  The calling thread
+ *		does the last thread's share itself, and the share of any
+ *		thread that couldn't be started.
+ *
+ *		Only the library's private routines are called from the
+ *		other threads: the public ones would wait for the global
+ *		lock that the calling thread holds.  The errors of the
+ *		other threads are pushed on the calling thread's error
+ *		stack once they have finished.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__members_io_mt(unsigned nmembs, H5FD_memb_io_t io[],
+    H5P_genplist_t *dxpl, hbool_t do_write, unsigned nthreads)
+{
+    H5FD_memb_io_t **busy = NULL;       /* Members with extents */
+    H5FD_memb_io_task_t *tasks = NULL;  /* Members accessed by each thread */
+    H5TS_thread_t *threads = NULL;      /* Worker threads */
+    unsigned    nbusy = 0;              /* Number of members with extents */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(nthreads > 1);
+
+    if(NULL == (busy = (H5FD_memb_io_t **)H5MM_malloc(nmembs * sizeof(H5FD_memb_io_t *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for member requests")
+    if(NULL == (tasks = (H5FD_memb_io_task_t *)H5MM_malloc(nthreads * sizeof(H5FD_memb_io_task_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for member I/O tasks")
+    if(NULL == (threads = (H5TS_thread_t *)H5MM_malloc(nthreads * sizeof(H5TS_thread_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for member I/O threads")
+
+    for(u = 0; u < nmembs; u++)
+        if(io[u].count > 0)
+            busy[nbusy++] = &io[u];
+    HDassert(nbusy >= nthreads);
+
+    for(u = 0; u < nthreads; u++) {
+        tasks[u].io = busy;
+        tasks[u].nio = nbusy;
+        tasks[u].first = u;
+        tasks[u].stride = nthreads;
+        tasks[u].dxpl = dxpl;
+        tasks[u].do_write = do_write;
+        tasks[u].worker = FALSE;
+        tasks[u].status = SUCCEED;
+    } /* end for */
+
+    /* Start the worker threads, then do the remaining shares here */
+    for(u = 0; u < nthreads - 1; u++) {
+        tasks[u].worker = TRUE;
+        if(H5TS_try_create_thread(&threads[u], H5FD__memb_io_task, NULL, &tasks[u]) < 0)
+            tasks[u].worker = FALSE;
+    } /* end for */
+    for(u = 0; u < nthreads; u++)
+        if(!tasks[u].worker)
+            H5FD__memb_io_task(&tasks[u]);
+
+    /* Wait for the started threads before checking their results */
+    for(u = 0; u < nthreads - 1; u++)
+        if(tasks[u].worker)
+            H5TS_wait_for_thread(threads[u]);
+    for(u = 0; u < nthreads; u++)
+        if(tasks[u].status < 0) {
+            if(tasks[u].worker)
+                HERROR(tasks[u].maj_id, tasks[u].min_id, "%s", tasks[u].desc);
+            ret_value = FAIL;
+        } /* end if */
+    if(ret_value < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_IO, FAIL, "member file I/O failed in thread")
+
+done:
+    H5MM_xfree(busy);
+    H5MM_xfree(tasks);
+    H5MM_xfree(threads);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__members_io_mt() */
+#endif /* H5_HAVE_THREADSAFE */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_map
+ *
+ * Purpose:	Private version of H5FDmap()
+ *
+ *		*PTR is set to NULL when the driver has no map callback,
+ *		or can't expose the region in memory.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5FD_map(H5FD_t *file, H5FD_mem_t type, haddr_t addr, size_t size,
+    const void **ptr/*out*/)
+{
+    haddr_t     eoa = HADDR_UNDEF;
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(file && file->cls);
+    HDassert(ptr);
+
+    *ptr = NULL;
+
+    /* Nothing to do if the driver can't map the file */
+    if(NULL == file->cls->map || 0 == size)
+        HGOTO_DONE(SUCCEED)
+
+    if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, type)))
+	HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+    if((addr + file->base_addr + size) > eoa)
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)(addr + file->base_addr), (unsigned long long)size, (unsigned long long)eoa)
+
+    /* Dispatch to driver */
+    if((file->cls->map)(file, type, addr + file->base_addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "driver map request failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD__check_vector
+ *
+ * Purpose:	Checks the extents of a vector I/O request against the
+ *		end of allocated space for their memory types, as
+ *		H5FD_read() and H5FD_write() do for a single extent.
+ *
+ * Return:	Success:	Non-negative
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__check_vector(H5FD_t *file,
+#ifndef H5_DEBUG_BUILD
+const
+#endif /* H5_DEBUG_BUILD */
+H5P_genplist_t H5_ATTR_UNUSED *dxpl, uint32_t count, const H5FD_mem_t types[],
+    const haddr_t addrs[], const size_t sizes[])
+{
+    H5FD_mem_t  eoa_type = H5FD_MEM_NOLIST; /* Memory type of the cached EOA */
+    haddr_t     eoa = HADDR_UNDEF;      /* EOA for the memory type */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+#ifdef H5_DEBUG_BUILD
+    {
+        H5FD_dxpl_type_t dxpl_type;    /* Property indicating the type of the internal dxpl */
+
+        /* get the dxpl type */
+        if(H5P_get(dxpl, H5FD_DXPL_TYPE_NAME, &dxpl_type) < 0)
+            HGOTO_ERROR(H5E_VFL, H5E_CANTGET, FAIL, "can't retrieve dxpl type")
+
+        /* we shouldn't be here if the dxpl is labeled with NO I/O */
+        HDassert(H5FD_NOIO_DXPL != dxpl_type);
+
+        /* Sanity check the dxpl type against the mem types */
+        for(u = 0; u < count; u++)
+            if(H5FD_MEM_DRAW == types[u])
+                HDassert(H5FD_RAWDATA_DXPL == dxpl_type);
+            else
+                HDassert(H5FD_METADATA_DXPL == dxpl_type);
+    }
+#endif /* H5_DEBUG_BUILD */
+
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+
+        /* Look up the EOA when the memory type changes */
+        if(types[u] != eoa_type) {
+            if(HADDR_UNDEF == (eoa = (file->cls->get_eoa)(file, types[u])))
+                HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "driver get_eoa request failed")
+            eoa_type = types[u];
+        } /* end if */
+
+        /* SWMR readers may read past the EOA (see H5FD_read()) */
+        if(!(file->access_flags & H5F_ACC_SWMR_READ) && ((addrs[u] + file->base_addr + sizes[u]) > eoa))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu, eoa = %llu", (unsigned long long)(addrs[u] + file->base_addr), (unsigned long long)sizes[u], (unsigned long long)eoa)
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD__check_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_set_eoa
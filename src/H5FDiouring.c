@@ -0,0 +1,1552 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The Linux io_uring file driver.  File handling follows the
+ *          sec2 driver, but reads and writes are submitted through an
+ *          io_uring instance owned by the file.  Each extent is split
+ *          into pieces that are queued together, up to the configured
+ *          queue depth, so that a request (and in particular a vector
+ *          request) keeps many I/Os in flight at once instead of one.
+ *
+ *          Optionally, the file is also opened with O_DIRECT (aligned
+ *          pieces use that descriptor, the others a buffered one), and
+ *          I/O is staged through buffers registered with the ring.
+ *
+ *          The driver talks to the kernel through the io_uring system
+ *          calls directly, and needs Linux 5.6 or later.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+#define H5FD_FRIEND         /* Suppress error about including H5FDpkg   */
+#define H5FD_TESTING        /* Suppress warning about H5FD testing funcs */
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDpkg.h"        /* File drivers             */
+#include "H5FDiouring.h"    /* io_uring file driver     */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+
+#ifdef H5_HAVE_IOURING
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_IOURING_g = 0;
+
+/* Submissions left before a simulated io_uring_enter() failure (0 for none)
+ * and the errno it sets, for testing
+ */
+static unsigned H5FD_iouring_fail_submit_g = 0;
+static int H5FD_iouring_fail_errno_g = 0;
+
+/* Largest piece of an extent transferred by a single queue entry.  Larger
+ * extents are split so that their pieces are transferred in parallel.
+ */
+#define H5FD_IOURING_PIECE_SIZE     ((size_t)1024 * 1024)
+
+/* Size of each registered staging buffer (one per queue entry), which is
+ * also the piece size when staging through registered buffers.
+ */
+#define H5FD_IOURING_FIXED_BUF_SIZE ((size_t)64 * 1024)
+
+/* Alignment of file offsets, sizes and memory required for transfers
+ * through the O_DIRECT file descriptor.
+ */
+#define H5FD_IOURING_BLOCK_SIZE     ((size_t)4096)
+
+/* Largest allowed queue depth */
+#define H5FD_IOURING_QUEUE_DEPTH_MAX    4096
+
+/* The io_uring system calls, and the memory ordering needed to share the
+ * ring indices with the kernel.
+ */
+#define H5FD_IOURING_SETUP(E, P)            ((int)syscall(__NR_io_uring_setup, (E), (P)))
+#define H5FD_IOURING_ENTER(F, S, C, G)      ((int)syscall(__NR_io_uring_enter, (F), (S), (C), (G), NULL, 0))
+#define H5FD_IOURING_REGISTER(F, O, A, N)   ((int)syscall(__NR_io_uring_register, (F), (O), (A), (N)))
+#define H5FD_IOURING_LOAD_ACQUIRE(P)        __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define H5FD_IOURING_STORE_RELEASE(P, V)    __atomic_store_n((P), (V), __ATOMIC_RELEASE)
+
+/* Driver-specific file access properties */
+typedef struct H5FD_iouring_fapl_t {
+    unsigned    queue_depth;    /* Number of I/Os kept in flight        */
+    unsigned    flags;          /* H5FD_IOURING_* flags                 */
+} H5FD_iouring_fapl_t;
+
+/* An io_uring instance: the ring file descriptor, plus the submission and
+ * completion rings (and the submission queue entries) that are shared with
+ * the kernel through mmap().
+ */
+typedef struct H5FD_iouring_ring_t {
+    int                 ring_fd;        /* io_uring file descriptor         */
+    unsigned            *sq_head;       /* Submission ring head (kernel)    */
+    unsigned            *sq_tail;       /* Submission ring tail (ours)      */
+    unsigned            sq_mask;        /* Submission ring index mask       */
+    unsigned            *sq_array;      /* Submission ring -> entry index   */
+    struct io_uring_sqe *sqes;          /* Submission queue entries         */
+    unsigned            *cq_head;       /* Completion ring head (ours)      */
+    unsigned            *cq_tail;       /* Completion ring tail (kernel)    */
+    unsigned            cq_mask;        /* Completion ring index mask       */
+    struct io_uring_cqe *cqes;          /* Completion queue entries         */
+    void                *sq_ring;       /* Mapped submission ring           */
+    size_t              sq_ring_size;   /* Size of submission ring mapping  */
+    void                *cq_ring;       /* Mapped completion ring (may be
+                                         * the same mapping as sq_ring)     */
+    size_t              cq_ring_size;   /* Size of completion ring mapping  */
+    size_t              sqes_size;      /* Size of the entries mapping      */
+} H5FD_iouring_ring_t;
+
+/* One piece of an extent, transferred by one queue entry at a time (a
+ * short transfer resubmits the remainder of the piece).
+ */
+typedef struct H5FD_iouring_piece_t {
+    haddr_t     addr;       /* File address of the piece            */
+    size_t      size;       /* Size of the piece                    */
+    size_t      done;       /* Bytes transferred so far             */
+    uint8_t     *buf;       /* Caller's memory for the piece        */
+    int         slot;       /* Staging buffer in use, or -1         */
+} H5FD_iouring_piece_t;
+
+/* The description of a file belonging to this driver. The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the high-water mark
+ * of the file (the current size of the underlying filesystem file).  When
+ * opening a file the 'eof' will be set to the current file size and `eoa'
+ * will be set to zero.  'direct_fd' is a second descriptor for the same file
+ * opened with O_DIRECT, or -1.  'stage' holds the registered staging
+ * buffers, one per queue entry, when staging I/O through them.
+ */
+typedef struct H5FD_iouring_t {
+    H5FD_t              pub;        /* public stuff, must be first      */
+    int                 fd;         /* the filesystem file descriptor   */
+    int                 direct_fd;  /* O_DIRECT file descriptor, or -1  */
+    haddr_t             eoa;        /* end of allocated region          */
+    haddr_t             eof;        /* end of file; current file size   */
+    H5FD_iouring_fapl_t fa;         /* file access properties           */
+    H5FD_iouring_ring_t ring;       /* the file's io_uring instance     */
+    uint8_t             *stage;     /* registered staging buffers       */
+    char                filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
+    dev_t               device;     /* file device number               */
+    ino_t               inode;      /* file i-node number               */
+} H5FD_iouring_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR (((haddr_t)1<<(8*sizeof(HDoff_t)-1))-1)
+#define ADDR_OVERFLOW(A)    (HADDR_UNDEF==(A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z)    ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) ||    \
+                                 HADDR_UNDEF==(A)+(Z) ||                    \
+                                (HDoff_t)((A)+(Z))<(HDoff_t)(A))
+
+/* Prototypes */
+static herr_t H5FD_iouring_term(void);
+static void *H5FD_iouring_fapl_get(H5FD_t *file);
+static void *H5FD_iouring_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD_iouring_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD_iouring_close(H5FD_t *_file);
+static int H5FD_iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_iouring_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_iouring_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_iouring_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_iouring_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_iouring_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_iouring_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD_iouring_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t H5FD_iouring_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[]);
+static herr_t H5FD_iouring_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
+static herr_t H5FD_iouring_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_iouring_unlock(H5FD_t *_file);
+
+static herr_t H5FD_iouring_ring_setup(H5FD_iouring_ring_t *ring, unsigned entries);
+static herr_t H5FD_iouring_ring_teardown(H5FD_iouring_ring_t *ring);
+static void H5FD_iouring_drain(H5FD_iouring_ring_t *ring, unsigned unsubmitted,
+            unsigned inflight);
+static herr_t H5FD_iouring_transfer(H5FD_iouring_t *file, hbool_t do_write,
+            uint32_t count, const haddr_t addrs[], const size_t sizes[],
+            void * const bufs[]);
+
+static const H5FD_class_t H5FD_iouring_g = {
+    "iouring",                  /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD_iouring_term,          /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_iouring_fapl_t), /* fapl_size           */
+    H5FD_iouring_fapl_get,      /* fapl_get             */
+    H5FD_iouring_fapl_copy,     /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD_iouring_open,          /* open                 */
+    H5FD_iouring_close,         /* close                */
+    H5FD_iouring_cmp,           /* cmp                  */
+    H5FD_iouring_query,         /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD_iouring_get_eoa,       /* get_eoa              */
+    H5FD_iouring_set_eoa,       /* set_eoa              */
+    H5FD_iouring_get_eof,       /* get_eof              */
+    H5FD_iouring_get_handle,    /* get_handle           */
+    H5FD_iouring_read,          /* read                 */
+    H5FD_iouring_write,         /* write                */
+    NULL,                       /* flush                */
+    H5FD_iouring_truncate,      /* truncate             */
+    H5FD_iouring_lock,          /* lock                 */
+    H5FD_iouring_unlock,        /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    H5FD_iouring_read_vector,   /* read_vector          */
+    H5FD_iouring_write_vector,  /* write_vector         */
+    NULL                        /* map                  */
+};
+
+/* Declare a free list to manage the H5FD_iouring_t struct */
+H5FL_DEFINE_STATIC(H5FD_iouring_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_iouring_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize io_uring VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the io_uring driver.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_iouring_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;          /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_IOURING_g))
+        H5FD_IOURING_g = H5FD_register(&H5FD_iouring_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_IOURING_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD_iouring_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_IOURING_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_iouring
+ *
+ * Purpose:     Modify the file access property list to use the
+ *              H5FD_IOURING driver defined in this source file.
+ *
+ *              QUEUE_DEPTH is the number of I/Os the driver keeps in
+ *              flight (0 selects H5FD_IOURING_QUEUE_DEPTH_DEF).  FLAGS
+ *              is a combination of H5FD_IOURING_DIRECT_IO and
+ *              H5FD_IOURING_FIXED_BUFFERS.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_iouring(hid_t fapl_id, unsigned queue_depth, unsigned flags)
+{
+    H5P_genplist_t      *plist;         /* Property list pointer */
+    H5FD_iouring_fapl_t fa;             /* io_uring VFD info */
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuIu", fapl_id, queue_depth, flags);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+    if(queue_depth > H5FD_IOURING_QUEUE_DEPTH_MAX)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "queue depth too large")
+    if(flags & ~(H5FD_IOURING_DIRECT_IO | H5FD_IOURING_FIXED_BUFFERS))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown io_uring flags")
+
+    fa.queue_depth = (queue_depth != 0) ? queue_depth : H5FD_IOURING_QUEUE_DEPTH_DEF;
+    fa.flags = flags;
+
+    ret_value = H5P_set_driver(plist, H5FD_IOURING, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_iouring
+ *
+ * Purpose:     Returns information about the io_uring file access
+ *              property list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_iouring(hid_t fapl_id, unsigned *queue_depth/*out*/,
+    unsigned *flags/*out*/)
+{
+    H5P_genplist_t              *plist;     /* Property list pointer */
+    const H5FD_iouring_fapl_t   *fa;        /* io_uring VFD info */
+    herr_t                      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", fapl_id, queue_depth, flags);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_IOURING != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    if(queue_depth)
+        *queue_depth = fa->queue_depth;
+    if(flags)
+        *flags = fa->flags;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_iouring_fapl_get(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    void            *ret_value = NULL;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set return value */
+    ret_value = H5FD_iouring_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fapl_copy
+ *
+ * Purpose:     Copies the io_uring-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_iouring_fapl_copy(const void *_old_fa)
+{
+    const H5FD_iouring_fapl_t   *old_fa = (const H5FD_iouring_fapl_t *)_old_fa;
+    H5FD_iouring_fapl_t         *new_fa = NULL;     /* New io_uring VFD info */
+    void                        *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(old_fa);
+
+    if(NULL == (new_fa = (H5FD_iouring_fapl_t *)H5MM_malloc(sizeof(H5FD_iouring_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    HDmemcpy(new_fa, old_fa, sizeof(H5FD_iouring_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_ring_setup
+ *
+ * Purpose:     Creates an io_uring instance with room for ENTRIES queue
+ *              entries, and maps its rings into memory.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_ring_setup(H5FD_iouring_ring_t *ring, unsigned entries)
+{
+    struct io_uring_params  params;             /* Ring parameters */
+    herr_t                  ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(ring);
+    HDassert(entries > 0);
+
+    HDmemset(ring, 0, sizeof(H5FD_iouring_ring_t));
+    ring->ring_fd = -1;
+
+    /* Create the ring */
+    HDmemset(&params, 0, sizeof(params));
+    if((ring->ring_fd = H5FD_IOURING_SETUP(entries, &params)) < 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to create io_uring instance")
+
+    /* IORING_OP_READ / IORING_OP_WRITE appeared together with this feature */
+    if(0 == (params.features & IORING_FEAT_RW_CUR_POS))
+        HGOTO_ERROR(H5E_VFL, H5E_UNSUPPORTED, FAIL, "kernel io_uring support is too old")
+
+    /* Map the submission and completion rings, which may share a mapping */
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if(params.features & IORING_FEAT_SINGLE_MMAP) {
+        if(ring->cq_ring_size > ring->sq_ring_size)
+            ring->sq_ring_size = ring->cq_ring_size;
+        ring->cq_ring_size = ring->sq_ring_size;
+    } /* end if */
+    if(MAP_FAILED == (ring->sq_ring = HDmmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, (HDoff_t)IORING_OFF_SQ_RING))) {
+        ring->sq_ring = NULL;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission ring")
+    } /* end if */
+    if(params.features & IORING_FEAT_SINGLE_MMAP)
+        ring->cq_ring = ring->sq_ring;
+    else if(MAP_FAILED == (ring->cq_ring = HDmmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, (HDoff_t)IORING_OFF_CQ_RING))) {
+        ring->cq_ring = NULL;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring completion ring")
+    } /* end if */
+
+    /* Map the submission queue entries */
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    if(MAP_FAILED == (ring->sqes = (struct io_uring_sqe *)HDmmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd, (HDoff_t)IORING_OFF_SQES))) {
+        ring->sqes = NULL;
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to map io_uring submission entries")
+    } /* end if */
+
+    /* Locate the ring indices and arrays */
+    ring->sq_head = (unsigned *)((uint8_t *)ring->sq_ring + params.sq_off.head);
+    ring->sq_tail = (unsigned *)((uint8_t *)ring->sq_ring + params.sq_off.tail);
+    ring->sq_mask = *(unsigned *)((uint8_t *)ring->sq_ring + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *)((uint8_t *)ring->sq_ring + params.sq_off.array);
+    ring->cq_head = (unsigned *)((uint8_t *)ring->cq_ring + params.cq_off.head);
+    ring->cq_tail = (unsigned *)((uint8_t *)ring->cq_ring + params.cq_off.tail);
+    ring->cq_mask = *(unsigned *)((uint8_t *)ring->cq_ring + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)((uint8_t *)ring->cq_ring + params.cq_off.cqes);
+
+done:
+    if(ret_value < 0)
+        (void)H5FD_iouring_ring_teardown(ring);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_ring_setup() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_ring_teardown
+ *
+ * Purpose:     Unmaps the rings of an io_uring instance and closes it.
+ *              Works on partially set up rings too.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_ring_teardown(H5FD_iouring_ring_t *ring)
+{
+    herr_t ret_value = SUCCEED;                 /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(ring);
+
+    if(ring->sqes && HDmunmap(ring->sqes, ring->sqes_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to unmap io_uring submission entries")
+    if(ring->cq_ring && ring->cq_ring != ring->sq_ring && HDmunmap(ring->cq_ring, ring->cq_ring_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to unmap io_uring completion ring")
+    if(ring->sq_ring && HDmunmap(ring->sq_ring, ring->sq_ring_size) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to unmap io_uring submission ring")
+    if(ring->ring_fd >= 0 && HDclose(ring->ring_fd) < 0)
+        HSYS_DONE_ERROR(H5E_VFL, H5E_CANTCLOSEOBJ, FAIL, "unable to close io_uring instance")
+
+    HDmemset(ring, 0, sizeof(H5FD_iouring_ring_t));
+    ring->ring_fd = -1;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_ring_teardown() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_open
+ *
+ * Purpose:     Create and/or opens a file as an HDF5 file, and sets up
+ *              its io_uring instance.
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_iouring_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_iouring_t              *file = NULL;   /* io_uring VFD info        */
+    const H5FD_iouring_fapl_t   *fa;            /* io_uring properties      */
+    H5P_genplist_t              *plist;         /* Property list pointer    */
+    int                         fd = -1;        /* File descriptor          */
+    int                         direct_fd = -1; /* O_DIRECT file descriptor */
+    int                         o_flags;        /* Flags for open() call    */
+    h5_stat_t                   sb;
+    H5FD_t                      *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+
+    /* Get the driver specific information */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_iouring_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Build the open flags */
+    o_flags = (H5F_ACC_RDWR & flags) ? O_RDWR : O_RDONLY;
+    if(H5F_ACC_TRUNC & flags)
+        o_flags |= O_TRUNC;
+    if(H5F_ACC_CREAT & flags)
+        o_flags |= O_CREAT;
+    if(H5F_ACC_EXCL & flags)
+        o_flags |= O_EXCL;
+
+    /* Open the file */
+    if((fd = HDopen(name, o_flags, 0666)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x, o_flags = %x", name, myerrno, HDstrerror(myerrno), flags, (unsigned)o_flags);
+    } /* end if */
+
+    /* Open the same file for direct I/O (the file exists by now) */
+    if(fa->flags & H5FD_IOURING_DIRECT_IO)
+        if((direct_fd = HDopen(name, (o_flags & ~(O_CREAT | O_EXCL | O_TRUNC)) | O_DIRECT, 0666)) < 0)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file for direct I/O")
+
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_iouring_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+    file->fd = fd;
+    file->direct_fd = direct_fd;
+    file->ring.ring_fd = -1;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+    file->fa = *fa;
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Set up the ring */
+    if(H5FD_iouring_ring_setup(&file->ring, file->fa.queue_depth) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to set up io_uring")
+
+    /* Allocate and register the staging buffers, one per queue entry.  (They
+     * are aligned for direct I/O as well.)
+     */
+    if(file->fa.flags & H5FD_IOURING_FIXED_BUFFERS) {
+        struct iovec    *iov = NULL;    /* Staging buffers to register */
+        unsigned        u;              /* Local index variable */
+        int             ret;            /* Registration result */
+
+        /* NOTE: Use HDfree to release, to match HDposix_memalign */
+        if(0 != HDposix_memalign((void **)&file->stage, H5FD_IOURING_BLOCK_SIZE, file->fa.queue_depth * H5FD_IOURING_FIXED_BUF_SIZE)) {
+            file->stage = NULL;
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "unable to allocate staging buffers")
+        } /* end if */
+        if(NULL == (iov = (struct iovec *)H5MM_malloc(file->fa.queue_depth * sizeof(struct iovec))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate staging buffer list")
+        for(u = 0; u < file->fa.queue_depth; u++) {
+            iov[u].iov_base = file->stage + u * H5FD_IOURING_FIXED_BUF_SIZE;
+            iov[u].iov_len = H5FD_IOURING_FIXED_BUF_SIZE;
+        } /* end for */
+        ret = H5FD_IOURING_REGISTER(file->ring.ring_fd, IORING_REGISTER_BUFFERS, iov, file->fa.queue_depth);
+        iov = (struct iovec *)H5MM_xfree(iov);
+        if(ret < 0)
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTREGISTER, NULL, "unable to register io_uring staging buffers")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = (H5FD_t*)file;
+
+done:
+    if(NULL == ret_value) {
+        if(file) {
+            (void)H5FD_iouring_ring_teardown(&file->ring);
+            if(file->stage)
+                HDfree(file->stage);
+            file = H5FL_FREE(H5FD_iouring_t, file);
+        } /* end if */
+        if(direct_fd >= 0)
+            HDclose(direct_fd);
+        if(fd >= 0)
+            HDclose(fd);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_close
+ *
+ * Purpose:     Closes an HDF5 file, along with its io_uring instance.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_close(H5FD_t *_file)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Release the ring (which also unregisters the staging buffers) */
+    if(H5FD_iouring_ring_teardown(&file->ring) < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to release io_uring")
+    if(file->stage)
+        HDfree(file->stage);
+
+    /* Close the underlying file */
+    if(file->direct_fd >= 0 && HDclose(file->direct_fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+    if(HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_iouring_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_iouring_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_iouring_t    *f1 = (const H5FD_iouring_t *)_f1;
+    const H5FD_iouring_t    *f2 = (const H5FD_iouring_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if(f1->device < f2->device) HGOTO_DONE(-1)
+    if(f1->device > f2->device) HGOTO_DONE(1)
+#else /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) < 0) HGOTO_DONE(-1)
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) > 0) HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if(f1->inode < f2->inode) HGOTO_DONE(-1)
+    if(f1->inode > f2->inode) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_ACCUMULATE_METADATA;    /* OK to accumulate metadata for faster writes                      */
+        *flags |= H5FD_FEAT_DATA_SIEVE;             /* OK to perform data sieving for faster raw data reads & writes    */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* VFD handle is POSIX I/O call compatible                          */
+        *flags |= H5FD_FEAT_SUPPORTS_SWMR_IO;       /* VFD supports the single-writer/multiple-readers (SWMR) pattern   */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_iouring_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_iouring_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_iouring_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the greater of
+ *              either the filesystem end-of-file or the HDF5 end-of-address
+ *              markers.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              "file", either the filesystem file or the HDF5 file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_iouring_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_iouring_t    *file = (const H5FD_iouring_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD_iouring_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD_iouring_get_handle
+ *
+ * Purpose:        Returns the (buffered) file handle of io_uring file
+ *                 driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_iouring_t      *file = (H5FD_iouring_t *)_file;
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_transfer
+ *
+ * Purpose:     Reads (or writes, if DO_WRITE is set) COUNT extents through
+ *              the file's io_uring instance.
+ *
+ *              The extents are split into pieces of at most
+ *              H5FD_IOURING_PIECE_SIZE bytes (H5FD_IOURING_FIXED_BUF_SIZE
+ *              when staging), and pieces are queued until the configured
+ *              queue depth is reached.  Each completion frees an entry for
+ *              the next piece; short transfers resubmit the rest of their
+ *              piece.  As for the sec2 driver, reading past the end of the
+ *              file returns zeros.
+ *
+ *              Pieces whose offset, size and memory are all aligned to
+ *              H5FD_IOURING_BLOCK_SIZE use the O_DIRECT descriptor, if the
+ *              file has one.  When staging through registered buffers,
+ *              each piece in flight holds one staging buffer.
+ *
+ *              On error, the entries queued but not yet submitted are
+ *              taken back and the ones in flight are waited for (see
+ *              H5FD_iouring_drain), so the ring is empty and the kernel
+ *              is done with the caller's buffers when this returns.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_transfer(H5FD_iouring_t *file, hbool_t do_write, uint32_t count,
+    const haddr_t addrs[], const size_t sizes[], void * const bufs[])
+{
+    H5FD_iouring_ring_t     *ring = &file->ring;    /* The file's ring */
+    H5FD_iouring_piece_t    *pieces = NULL;     /* Pieces of the extents */
+    unsigned    *retry = NULL;      /* Pieces to resubmit after a short transfer */
+    int         *free_slots = NULL; /* Unused staging buffers */
+    hbool_t     staged = (file->stage != NULL);     /* Whether to stage I/O */
+    size_t      piece_size;         /* Largest piece */
+    size_t      npieces = 0;        /* Number of pieces */
+    size_t      next = 0;           /* Next piece not yet started */
+    size_t      nleft;              /* Pieces not yet finished */
+    unsigned    nretry = 0;         /* Number of pieces to resubmit */
+    unsigned    nfree = 0;          /* Number of unused staging buffers */
+    unsigned    inflight = 0;       /* Entries submitted to the kernel */
+    unsigned    to_submit = 0;      /* Entries queued but not yet submitted */
+    int         io_errno = 0;       /* First I/O error (stops new submissions) */
+    uint32_t    u;                  /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(ring->ring_fd >= 0);
+
+    /* Split the extents into pieces */
+    piece_size = staged ? H5FD_IOURING_FIXED_BUF_SIZE : H5FD_IOURING_PIECE_SIZE;
+    for(u = 0; u < count; u++)
+        npieces += (sizes[u] + piece_size - 1) / piece_size;
+    if(0 == npieces)
+        HGOTO_DONE(SUCCEED)
+    if(NULL == (pieces = (H5FD_iouring_piece_t *)H5MM_malloc(npieces * sizeof(H5FD_iouring_piece_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate I/O pieces")
+    if(NULL == (retry = (unsigned *)H5MM_malloc(file->fa.queue_depth * sizeof(unsigned))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate I/O retry list")
+    npieces = 0;
+    for(u = 0; u < count; u++) {
+        size_t off;                 /* Offset of the piece in the extent */
+
+        for(off = 0; off < sizes[u]; off += piece_size) {
+            pieces[npieces].addr = addrs[u] + off;
+            pieces[npieces].size = MIN(piece_size, sizes[u] - off);
+            pieces[npieces].done = 0;
+            pieces[npieces].buf = (uint8_t *)bufs[u] + off;
+            pieces[npieces].slot = -1;
+            npieces++;
+        } /* end for */
+    } /* end for */
+    nleft = npieces;
+
+    /* All the staging buffers start out unused */
+    if(staged) {
+        if(NULL == (free_slots = (int *)H5MM_malloc(file->fa.queue_depth * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "unable to allocate staging buffer list")
+        for(nfree = 0; nfree < file->fa.queue_depth; nfree++)
+            free_slots[nfree] = (int)nfree;
+    } /* end if */
+
+    for(;;) {
+        unsigned    head;           /* Completion ring head */
+        unsigned    tail;           /* Completion ring tail */
+        int         ret;            /* io_uring_enter() result */
+
+        /* Queue pieces while the ring has room, unless an error occurred */
+        while(0 == io_errno && inflight + to_submit < file->fa.queue_depth) {
+            H5FD_iouring_piece_t    *piece;     /* Piece to queue */
+            struct io_uring_sqe     *sqe;       /* Entry for the piece */
+            size_t                  len;        /* Bytes to transfer */
+            unsigned                idx;        /* Piece index */
+            unsigned                sq_tail;    /* Submission ring tail */
+            uint8_t                 *mem;       /* Memory to transfer */
+            int                     fd;         /* Descriptor for the piece */
+
+            /* Pick the next piece: resubmissions first */
+            if(nretry > 0)
+                idx = retry[--nretry];
+            else if(next < npieces && (!staged || nfree > 0)) {
+                idx = (unsigned)next++;
+
+                /* Stage the piece */
+                if(staged) {
+                    piece = &pieces[idx];
+                    piece->slot = free_slots[--nfree];
+                    if(do_write)
+                        HDmemcpy(file->stage + (size_t)piece->slot * H5FD_IOURING_FIXED_BUF_SIZE, piece->buf, piece->size);
+                } /* end if */
+            } /* end if */
+            else
+                break;
+            piece = &pieces[idx];
+
+            /* Work out what's left of the piece, and where it goes */
+            len = piece->size - piece->done;
+            if(piece->slot >= 0)
+                mem = file->stage + (size_t)piece->slot * H5FD_IOURING_FIXED_BUF_SIZE + piece->done;
+            else
+                mem = piece->buf + piece->done;
+            if(file->direct_fd >= 0
+                    && 0 == (piece->addr + piece->done) % H5FD_IOURING_BLOCK_SIZE
+                    && 0 == len % H5FD_IOURING_BLOCK_SIZE
+                    && 0 == (size_t)mem % H5FD_IOURING_BLOCK_SIZE)
+                fd = file->direct_fd;
+            else
+                fd = file->fd;
+
+            /* Fill in the next submission queue entry */
+            sq_tail = *ring->sq_tail;
+            sqe = &ring->sqes[sq_tail & ring->sq_mask];
+            HDmemset(sqe, 0, sizeof(struct io_uring_sqe));
+            if(piece->slot >= 0) {
+                sqe->opcode = (uint8_t)(do_write ? IORING_OP_WRITE_FIXED : IORING_OP_READ_FIXED);
+                sqe->buf_index = (uint16_t)piece->slot;
+            } /* end if */
+            else
+                sqe->opcode = (uint8_t)(do_write ? IORING_OP_WRITE : IORING_OP_READ);
+            sqe->fd = fd;
+            sqe->off = (uint64_t)(piece->addr + piece->done);
+            sqe->addr = (uint64_t)(uintptr_t)mem;
+            sqe->len = (uint32_t)len;
+            sqe->user_data = (uint64_t)idx;
+            ring->sq_array[sq_tail & ring->sq_mask] = sq_tail & ring->sq_mask;
+            H5FD_IOURING_STORE_RELEASE(ring->sq_tail, sq_tail + 1);
+            to_submit++;
+        } /* end while */
+
+        /* Done when nothing is queued or in flight */
+        if(0 == inflight && 0 == to_submit)
+            break;
+
+        /* Submit the queued entries and wait for at least one completion */
+        if(to_submit > 0 && H5FD_iouring_fail_submit_g > 0 && 0 == --H5FD_iouring_fail_submit_g) {
+            errno = H5FD_iouring_fail_errno_g;
+            ret = -1;
+        } /* end if */
+        else
+            ret = H5FD_IOURING_ENTER(ring->ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS);
+        if(ret < 0) {
+            if(EINTR == errno)
+                continue;
+            else if((EAGAIN == errno || EBUSY == errno) && inflight > 0) {
+                /* Can't submit right now: just wait for completions */
+                if(H5FD_IOURING_ENTER(ring->ring_fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && EINTR != errno)
+                    HSYS_GOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "unable to wait for io_uring completions")
+            } /* end if */
+            else
+                HSYS_GOTO_ERROR(H5E_IO, H5E_SYSERRSTR, FAIL, "unable to submit to io_uring")
+        } /* end if */
+        else {
+            HDassert((unsigned)ret <= to_submit);
+            to_submit -= (unsigned)ret;
+            inflight += (unsigned)ret;
+        } /* end else */
+
+        /* Reap the completions */
+        head = *ring->cq_head;
+        tail = H5FD_IOURING_LOAD_ACQUIRE(ring->cq_tail);
+        while(head != tail) {
+            struct io_uring_cqe     *cqe = &ring->cqes[head & ring->cq_mask];
+            H5FD_iouring_piece_t    *piece = &pieces[cqe->user_data];
+            int                     res = cqe->res;
+            hbool_t                 finished = FALSE;
+
+            HDassert(inflight > 0);
+            inflight--;
+            head++;
+
+            if(res < 0) {
+                if(-EINTR == res || -EAGAIN == res)
+                    retry[nretry++] = (unsigned)cqe->user_data;
+                else {
+                    if(0 == io_errno)
+                        io_errno = -res;
+                    finished = TRUE;
+                } /* end else */
+            } /* end if */
+            else if(0 == res) {
+                if(do_write) {
+                    if(0 == io_errno)
+                        io_errno = EIO;
+                } /* end if */
+                else {
+                    /* end of file but not end of format address space */
+                    if(piece->slot >= 0)
+                        HDmemset(file->stage + (size_t)piece->slot * H5FD_IOURING_FIXED_BUF_SIZE + piece->done, 0, piece->size - piece->done);
+                    else
+                        HDmemset(piece->buf + piece->done, 0, piece->size - piece->done);
+                    piece->done = piece->size;
+                } /* end else */
+                finished = TRUE;
+            } /* end if */
+            else {
+                HDassert((size_t)res <= piece->size - piece->done);
+                piece->done += (size_t)res;
+                if(piece->done < piece->size)
+                    retry[nretry++] = (unsigned)cqe->user_data;
+                else
+                    finished = TRUE;
+            } /* end else */
+
+            if(finished) {
+                /* Copy staged data out, and release the staging buffer */
+                if(piece->slot >= 0) {
+                    if(!do_write && 0 == io_errno)
+                        HDmemcpy(piece->buf, file->stage + (size_t)piece->slot * H5FD_IOURING_FIXED_BUF_SIZE, piece->size);
+                    free_slots[nfree++] = piece->slot;
+                    piece->slot = -1;
+                } /* end if */
+                nleft--;
+            } /* end if */
+        } /* end while */
+        H5FD_IOURING_STORE_RELEASE(ring->cq_head, head);
+    } /* end for */
+
+    if(io_errno != 0) {
+        time_t mytime = HDtime(NULL);
+
+        HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "file %s failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', extents = %u, pieces = %llu, pieces not done = %llu", do_write ? "write" : "read", HDctime(&mytime), file->filename, file->fd, io_errno, HDstrerror(io_errno), (unsigned)count, (unsigned long long)npieces, (unsigned long long)nleft);
+    } /* end if */
+    HDassert(0 == nleft);
+
+    /* Update eof */
+    if(do_write)
+        for(u = 0; u < count; u++)
+            if(sizes[u] > 0 && addrs[u] + sizes[u] > file->eof)
+                file->eof = addrs[u] + sizes[u];
+
+done:
+    /* Leave nothing of this transfer in the ring */
+    if(ret_value < 0 && (to_submit > 0 || inflight > 0))
+        H5FD_iouring_drain(ring, to_submit, inflight);
+
+    pieces = (H5FD_iouring_piece_t *)H5MM_xfree(pieces);
+    retry = (unsigned *)H5MM_xfree(retry);
+    free_slots = (int *)H5MM_xfree(free_slots);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_transfer() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_drain
+ *
+ * Purpose:     Cleans up the ring after a failed transfer: takes back the
+ *              last UNSUBMITTED entries of the submission ring, which the
+ *              kernel hasn't consumed, and waits for and discards the
+ *              completions of the INFLIGHT entries it has.
+ *
+ *              If waiting fails for a reason other than a signal, the
+ *              remaining completions are left in the ring.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_iouring_drain(H5FD_iouring_ring_t *ring, unsigned unsubmitted, unsigned inflight)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(ring);
+
+    /* Take back the entries that weren't submitted */
+    if(unsubmitted > 0)
+        H5FD_IOURING_STORE_RELEASE(ring->sq_tail, *ring->sq_tail - unsubmitted);
+
+    /* Reap the completions of the entries in flight */
+    while(inflight > 0) {
+        unsigned    head = *ring->cq_head;      /* Completion ring head */
+        unsigned    tail = H5FD_IOURING_LOAD_ACQUIRE(ring->cq_tail);    /* Completion ring tail */
+
+        if(head == tail) {
+            if(H5FD_IOURING_ENTER(ring->ring_fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && EINTR != errno)
+                break;
+        } /* end if */
+        else {
+            while(head != tail && inflight > 0) {
+                head++;
+                inflight--;
+            } /* end while */
+            H5FD_IOURING_STORE_RELEASE(ring->cq_head, head);
+        } /* end else */
+    } /* end while */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_iouring_drain() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_fail_submit_test
+ *
+ * Purpose:     Makes the NSUBMIT'th submission to io_uring from now on
+ *              fail with errno set to ERR, as if io_uring_enter() had
+ *              failed.  A NSUBMIT of 0 cancels a pending failure.
+ *
+ *              This function is only intended for use in the test code.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5FD_iouring_fail_submit_test(unsigned nsubmit, int err)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5FD_iouring_fail_submit_g = nsubmit;
+    H5FD_iouring_fail_errno_g = err;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_iouring_fail_submit_test() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_idle_test
+ *
+ * Purpose:     Checks whether FILE's io_uring instance is idle: every
+ *              entry queued has been consumed by the kernel, and every
+ *              completion has been reaped.
+ *
+ *              This function is only intended for use in the test code.
+ *
+ * Return:      TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5FD_iouring_idle_test(const H5FD_t *_file)
+{
+    const H5FD_iouring_t *file = (const H5FD_iouring_t *)_file;   /* VFD file struct */
+    const H5FD_iouring_ring_t *ring;    /* The file's ring */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(file);
+
+    ring = &file->ring;
+    ret_value = (H5FD_IOURING_LOAD_ACQUIRE(ring->sq_head) == *ring->sq_tail
+            && *ring->cq_head == H5FD_IOURING_LOAD_ACQUIRE(ring->cq_tail));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_idle_test() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    if(H5FD_iouring_transfer(file, FALSE, 1, &addr, &size, &buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_write
+ *
+ * Purpose:     Writes SIZE bytes of data to FILE beginning at address ADDR
+ *              from buffer BUF according to data transfer properties in
+ *              DXPL_ID.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, const void *buf)
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    void            *wbuf       = (void *)buf;      /* Casting away const OK, the buffer isn't modified */
+    herr_t          ret_value   = SUCCEED;                  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addr, (unsigned long long)size)
+
+    if(H5FD_iouring_transfer(file, TRUE, 1, &addr, &size, &wbuf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_read_vector
+ *
+ * Purpose:     Reads COUNT extents from FILE into the buffers BUFS, according
+ *              to data transfer properties in DXPL_ID.  The pieces of all
+ *              the extents are queued together.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_read_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+    H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    uint32_t        u;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addrs[u])
+    } /* end for */
+
+    if(H5FD_iouring_transfer(file, FALSE, count, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_write_vector
+ *
+ * Purpose:     Writes COUNT extents to FILE from the buffers BUFS, according
+ *              to data transfer properties in DXPL_ID.  The pieces of all
+ *              the extents are queued together.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_write_vector(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, uint32_t count,
+    H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    H5FD_iouring_t  *file       = (H5FD_iouring_t *)_file;
+    uint32_t        u;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+    } /* end for */
+
+    /* (Casting away const OK, the buffers aren't modified) */
+    if(H5FD_iouring_transfer(file, TRUE, count, addrs, sizes, (void * const *)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_write_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_truncate
+ *
+ * Purpose:     Makes sure that the true file size is the same (or larger)
+ *              than the end-of-address.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_UNUSED closing)
+{
+    H5FD_iouring_t  *file = (H5FD_iouring_t *)_file;
+    herr_t          ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Extend the file to make sure it's large enough */
+    if(!H5F_addr_eq(file->eoa, file->eof)) {
+        if(-1 == HDftruncate(file->fd, (HDoff_t)file->eoa))
+            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to extend file properly")
+
+        /* Update the eof value */
+        file->eof = file->eoa;
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_truncate() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct      */
+    int lock_flags;                             /* file locking flags       */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if(HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to lock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_iouring_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_iouring_unlock(H5FD_t *_file)
+{
+    H5FD_iouring_t *file = (H5FD_iouring_t *)_file; /* VFD file struct      */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(HDflock(file->fd, LOCK_UN) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to unlock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_iouring_unlock() */
+
+#endif /* H5_HAVE_IOURING */
+
@@ -18,11 +18,9 @@
  *              Monday, April 17, 2000
  *
  * Purpose:     The POSIX unbuffered file driver using only the HDF5 public
- *              API and with a few optimizations: the lseek() call is made
- *              only when the current file position is unknown or needs to be
- *              changed based on previous I/O through this driver (don't mix
- *              I/O from this driver with I/O from other parts of the
- *              application to the same file).
+ *              API.  Where the system provides pread() and pwrite(), all
+ *              I/O is positional and no seeks are made (or logged).
+ *              Otherwise each I/O call seeks to its address first.
  *              With custom modifications...
  */
 
@@ -66,22 +64,16 @@ static const char *flavors[]={
 
 /* The description of a file belonging to this driver. The `eoa' and `eof'
  * determine the amount of hdf5 address space in use and the high-water mark
- * of the file (the current size of the underlying filesystem file). The
- * `pos' value is used to eliminate file position updates when they would be a
- * no-op. Unfortunately we've found systems that use separate file position
- * indicators for reading and writing so the lseek can only be eliminated if
- * the current operation is the same as the previous operation.  When opening
- * a file the `eof' will be set to the current file size, `eoa' will be set
- * to zero, `pos' will be set to H5F_ADDR_UNDEF (as it is when an error
- * occurs), and `op' will be set to H5F_OP_UNKNOWN.
+ * of the file (the current size of the underlying filesystem file).  When
+ * opening a file the `eof' will be set to the current file size and `eoa'
+ * will be set to zero.  As with the sec2 driver, no file position is
+ * tracked between I/O calls.
  */
 typedef struct H5FD_log_t {
     H5FD_t          pub;    /* public stuff, must be first      */
     int             fd;     /* the unix file                    */
     haddr_t         eoa;    /* end of allocated region          */
     haddr_t         eof;    /* end of file; current file size   */
-    haddr_t         pos;    /* current file I/O position        */
-    H5FD_file_op_t  op;     /* last operation                   */
     char            filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
 #ifndef H5_HAVE_WIN32_API
     /* On most systems the combination of device and i-node number uniquely
@@ -217,7 +209,10 @@ static const H5FD_class_t H5FD_log_g = {
     H5FD_log_truncate,				/*truncate		*/
     H5FD_log_lock,                              /*lock                  */
     H5FD_log_unlock,                            /*unlock                */
-    H5FD_FLMAP_DICHOTOMY			/*fl_map		*/
+    H5FD_FLMAP_DICHOTOMY,			/*fl_map		*/
+    NULL,					/*read_vector		*/
+    NULL,					/*write_vector		*/
+    NULL					/*map			*/
 };
 
 /* Declare a free list to manage the H5FD_log_t struct */
@@ -572,8 +567,6 @@ H5FD_log_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
 
     file->fd = fd;
     H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
-    file->pos = HADDR_UNDEF;
-    file->op = OP_UNKNOWN;
 #ifdef H5_HAVE_WIN32_API
     file->hFile = (HANDLE)_get_osfhandle(fd);
     if(INVALID_HANDLE_VALUE == file->hFile)
@@ -1196,49 +1189,49 @@ H5FD_log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hadd
         } /* end if */
     } /* end if */
 
-    /* Seek to the correct location */
-    if(addr != file->pos || OP_READ != file->op) {
+#ifndef H5_HAVE_PREADWRITE
+    /* Seek to the correct location (if we don't have pread/pwrite) */
 #ifdef H5_HAVE_GETTIMEOFDAY
-        if(file->fa.flags & H5FD_LOG_TIME_SEEK)
-            HDgettimeofday(&timeval_start, NULL);
+    if(file->fa.flags & H5FD_LOG_TIME_SEEK)
+        HDgettimeofday(&timeval_start, NULL);
 #endif /* H5_HAVE_GETTIMEOFDAY */
-        if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
 #ifdef H5_HAVE_GETTIMEOFDAY
-        if(file->fa.flags & H5FD_LOG_TIME_SEEK)
-            HDgettimeofday(&timeval_stop, NULL);
+    if(file->fa.flags & H5FD_LOG_TIME_SEEK)
+        HDgettimeofday(&timeval_stop, NULL);
 #endif /* H5_HAVE_GETTIMEOFDAY */
 
-        /* Log information about the seek */
-        if(file->fa.flags & H5FD_LOG_NUM_SEEK)
-            file->total_seek_ops++;
-        if(file->fa.flags & H5FD_LOG_LOC_SEEK) {
-            HDfprintf(file->logfp, "Seek: From %10a To %10a", file->pos, addr);
+    /* Log information about the seek */
+    if(file->fa.flags & H5FD_LOG_NUM_SEEK)
+        file->total_seek_ops++;
+    if(file->fa.flags & H5FD_LOG_LOC_SEEK) {
+        HDfprintf(file->logfp, "Seek: To %10a", addr);
 #ifdef H5_HAVE_GETTIMEOFDAY
-            if(file->fa.flags & H5FD_LOG_TIME_SEEK) {
-                struct timeval timeval_diff;
-                double time_diff;
-
-                /* Calculate the elapsed gettimeofday time */
-                timeval_diff.tv_usec = timeval_stop.tv_usec - timeval_start.tv_usec;
-                timeval_diff.tv_sec = timeval_stop.tv_sec - timeval_start.tv_sec;
-                if(timeval_diff.tv_usec < 0) {
-                    timeval_diff.tv_usec += 1000000;
-                    timeval_diff.tv_sec--;
-                } /* end if */
-                time_diff = (double)timeval_diff.tv_sec + ((double)timeval_diff.tv_usec / (double)1000000.0f);
-                HDfprintf(file->logfp, " (%fs @ %.6lu.%.6llu)\n", time_diff, (unsigned long long)timeval_start.tv_sec, (unsigned long long)timeval_start.tv_usec);
+        if(file->fa.flags & H5FD_LOG_TIME_SEEK) {
+            struct timeval timeval_diff;
+            double time_diff;
 
-                /* Add to total seek time */
-                file->total_seek_time += time_diff;
+            /* Calculate the elapsed gettimeofday time */
+            timeval_diff.tv_usec = timeval_stop.tv_usec - timeval_start.tv_usec;
+            timeval_diff.tv_sec = timeval_stop.tv_sec - timeval_start.tv_sec;
+            if(timeval_diff.tv_usec < 0) {
+                timeval_diff.tv_usec += 1000000;
+                timeval_diff.tv_sec--;
             } /* end if */
-            else
-                HDfprintf(file->logfp, "\n");
-#else /* H5_HAVE_GETTIMEOFDAY */
+            time_diff = (double)timeval_diff.tv_sec + ((double)timeval_diff.tv_usec / (double)1000000.0f);
+            HDfprintf(file->logfp, " (%fs @ %.6lu.%.6llu)\n", time_diff, (unsigned long long)timeval_start.tv_sec, (unsigned long long)timeval_start.tv_usec);
+
+            /* Add to total seek time */
+            file->total_seek_time += time_diff;
+        } /* end if */
+        else
             HDfprintf(file->logfp, "\n");
+#else /* H5_HAVE_GETTIMEOFDAY */
+        HDfprintf(file->logfp, "\n");
 #endif /* H5_HAVE_GETTIMEOFDAY */
-        } /* end if */
     } /* end if */
+#endif /* H5_HAVE_PREADWRITE */
 
     /*
      * Read data, being careful of interrupted system calls, partial results,
@@ -1262,18 +1255,21 @@ H5FD_log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hadd
             bytes_in = (h5_posix_io_t)size;
 
         do {
+#ifdef H5_HAVE_PREADWRITE
+            bytes_read = HDpread(file->fd, buf, bytes_in, (HDoff_t)addr);
+#else /* H5_HAVE_PREADWRITE */
             bytes_read = HDread(file->fd, buf, bytes_in);
+#endif /* H5_HAVE_PREADWRITE */
         } while(-1 == bytes_read && EINTR == errno);
 
         if(-1 == bytes_read) { /* error */
             int myerrno = errno;
             time_t mytime = HDtime(NULL);
-            HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
 
             if(file->fa.flags & H5FD_LOG_LOC_READ)
                 HDfprintf(file->logfp, "Error! Reading: %10a-%10a (%10Zu bytes)\n", orig_addr, (orig_addr + orig_size) - 1, orig_size);
 
-            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)myoffset);
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)addr);
         } /* end if */
 
         if(0 == bytes_read) {
@@ -1333,17 +1329,7 @@ H5FD_log_read(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, hadd
 #endif /* H5_HAVE_GETTIMEOFDAY */
     } /* end if */
 
-    /* Update current position */
-    file->pos = addr;
-    file->op = OP_READ;
-
 done:
-    if(ret_value < 0) {
-        /* Reset last file I/O information */
-        file->pos = HADDR_UNDEF;
-        file->op = OP_UNKNOWN;
-    } /* end if */
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_log_read() */
 
@@ -1403,49 +1389,49 @@ H5FD_log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
             file->nwrite[tmp_addr++]++;
     } /* end if */
 
-    /* Seek to the correct location */
-    if(addr != file->pos || OP_WRITE != file->op) {
+#ifndef H5_HAVE_PREADWRITE
+    /* Seek to the correct location (if we don't have pread/pwrite) */
 #ifdef H5_HAVE_GETTIMEOFDAY
-        if(file->fa.flags & H5FD_LOG_TIME_SEEK)
-            HDgettimeofday(&timeval_start, NULL);
+    if(file->fa.flags & H5FD_LOG_TIME_SEEK)
+        HDgettimeofday(&timeval_start, NULL);
 #endif /* H5_HAVE_GETTIMEOFDAY */
-        if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+    if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
 #ifdef H5_HAVE_GETTIMEOFDAY
-        if(file->fa.flags & H5FD_LOG_TIME_SEEK)
-            HDgettimeofday(&timeval_stop, NULL);
+    if(file->fa.flags & H5FD_LOG_TIME_SEEK)
+        HDgettimeofday(&timeval_stop, NULL);
 #endif /* H5_HAVE_GETTIMEOFDAY */
 
-        /* Log information about the seek */
-        if(file->fa.flags & H5FD_LOG_NUM_SEEK)
-            file->total_seek_ops++;
-        if(file->fa.flags & H5FD_LOG_LOC_SEEK) {
-            HDfprintf(file->logfp, "Seek: From %10a To %10a", file->pos, addr);
+    /* Log information about the seek */
+    if(file->fa.flags & H5FD_LOG_NUM_SEEK)
+        file->total_seek_ops++;
+    if(file->fa.flags & H5FD_LOG_LOC_SEEK) {
+        HDfprintf(file->logfp, "Seek: To %10a", addr);
 #ifdef H5_HAVE_GETTIMEOFDAY
-            if(file->fa.flags & H5FD_LOG_TIME_SEEK) {
-                struct timeval timeval_diff;
-                double time_diff;
-
-                /* Calculate the elapsed gettimeofday time */
-                timeval_diff.tv_usec = timeval_stop.tv_usec - timeval_start.tv_usec;
-                timeval_diff.tv_sec = timeval_stop.tv_sec - timeval_start.tv_sec;
-                if(timeval_diff.tv_usec < 0) {
-                    timeval_diff.tv_usec += 1000000;
-                    timeval_diff.tv_sec--;
-                } /* end if */
-                time_diff = (double)timeval_diff.tv_sec + ((double)timeval_diff.tv_usec / (double)1000000.0f);
-                HDfprintf(file->logfp, " (%fs @ %.6lu.%.6llu)\n", time_diff, (unsigned long long)timeval_start.tv_sec, (unsigned long long)timeval_start.tv_usec);
+        if(file->fa.flags & H5FD_LOG_TIME_SEEK) {
+            struct timeval timeval_diff;
+            double time_diff;
 
-                /* Add to total seek time */
-                file->total_seek_time += time_diff;
+            /* Calculate the elapsed gettimeofday time */
+            timeval_diff.tv_usec = timeval_stop.tv_usec - timeval_start.tv_usec;
+            timeval_diff.tv_sec = timeval_stop.tv_sec - timeval_start.tv_sec;
+            if(timeval_diff.tv_usec < 0) {
+                timeval_diff.tv_usec += 1000000;
+                timeval_diff.tv_sec--;
             } /* end if */
-            else
-                HDfprintf(file->logfp, "\n");
-#else /* H5_HAVE_GETTIMEOFDAY */
+            time_diff = (double)timeval_diff.tv_sec + ((double)timeval_diff.tv_usec / (double)1000000.0f);
+            HDfprintf(file->logfp, " (%fs @ %.6lu.%.6llu)\n", time_diff, (unsigned long long)timeval_start.tv_sec, (unsigned long long)timeval_start.tv_usec);
+
+            /* Add to total seek time */
+            file->total_seek_time += time_diff;
+        } /* end if */
+        else
             HDfprintf(file->logfp, "\n");
+#else /* H5_HAVE_GETTIMEOFDAY */
+        HDfprintf(file->logfp, "\n");
 #endif /* H5_HAVE_GETTIMEOFDAY */
-        } /* end if */
     } /* end if */
+#endif /* H5_HAVE_PREADWRITE */
 
     /*
      * Write the data, being careful of interrupted system calls and partial
@@ -1469,18 +1455,21 @@ H5FD_log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
             bytes_in = (h5_posix_io_t)size;
 
         do {
+#ifdef H5_HAVE_PREADWRITE
+            bytes_wrote = HDpwrite(file->fd, buf, bytes_in, (HDoff_t)addr);
+#else /* H5_HAVE_PREADWRITE */
             bytes_wrote = HDwrite(file->fd, buf, bytes_in);
+#endif /* H5_HAVE_PREADWRITE */
         } while(-1 == bytes_wrote && EINTR == errno);
 
         if(-1 == bytes_wrote) { /* error */
             int myerrno = errno;
             time_t mytime = HDtime(NULL);
-            HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
 
             if(file->fa.flags & H5FD_LOG_LOC_WRITE)
                 HDfprintf(file->logfp, "Error! Writing: %10a-%10a (%10Zu bytes)\n", orig_addr, (orig_addr + orig_size) - 1, orig_size);
 
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total write size = %llu, bytes this sub-write = %llu, bytes actually written = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_wrote, (unsigned long long)myoffset);
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total write size = %llu, bytes this sub-write = %llu, bytes actually written = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_wrote, (unsigned long long)addr);
         } /* end if */
 
         HDassert(bytes_wrote > 0);
@@ -1534,19 +1523,11 @@ H5FD_log_write(H5FD_t *_file, H5FD_mem_t type, hid_t H5_ATTR_UNUSED dxpl_id, had
 #endif /* H5_HAVE_GETTIMEOFDAY */
     } /* end if */
 
-    /* Update current position and eof */
-    file->pos = addr;
-    file->op = OP_WRITE;
-    if(file->pos > file->eof)
-        file->eof = file->pos;
+    /* Update eof */
+    if(addr > file->eof)
+        file->eof = addr;
 
 done:
-    if(ret_value < 0) {
-        /* Reset last file I/O information */
-        file->pos = HADDR_UNDEF;
-        file->op = OP_UNKNOWN;
-    } /* end if */
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_log_write() */
 
@@ -1652,10 +1633,6 @@ H5FD_log_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_U
 
         /* Update the eof value */
         file->eof = file->eoa;
-
-        /* Reset last file I/O information */
-        file->pos = HADDR_UNDEF;
-        file->op = OP_UNKNOWN;
     } /* end if */
 
 done:
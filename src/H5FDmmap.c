@@ -0,0 +1,1027 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose: The read-only mmap file driver.  The file is mapped into
+ *          memory with mmap(), either whole or in fixed size windows
+ *          that are mapped as they are first touched, and reads are
+ *          served with memcpy() from the mapping.
+ *
+ *          The driver also implements the 'map' callback, which hands
+ *          out pointers into the mapping so that the library can use
+ *          file data in place.  Mappings are shared, so processes that
+ *          open the same file share its page cache pages rather than
+ *          each holding a private copy.
+ *
+ *          At most H5FD_MMAP_MAX_MAPPED bytes of windows are kept mapped
+ *          at once; the least recently used window is unmapped to make
+ *          room for a new one.  Pointers from the 'map' callback are
+ *          therefore only valid until the next read or map call.
+ */
+
+#include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
+#define H5FD_FRIEND         /* Suppress error about including H5FDpkg   */
+#define H5FD_TESTING        /* Suppress warning about H5FD testing funcs */
+
+#include "H5private.h"      /* Generic Functions        */
+#include "H5Eprivate.h"     /* Error handling           */
+#include "H5Fprivate.h"     /* File access              */
+#include "H5FDpkg.h"        /* File drivers             */
+#include "H5FDmmap.h"       /* mmap file driver         */
+#include "H5FLprivate.h"    /* Free Lists               */
+#include "H5Iprivate.h"     /* IDs                      */
+#include "H5MMprivate.h"    /* Memory management        */
+#include "H5Pprivate.h"     /* Property lists           */
+
+#ifdef H5_HAVE_MMAP
+
+#include <sys/mman.h>
+
+/* The driver identification number, initialized at runtime */
+static hid_t H5FD_MMAP_g = 0;
+
+/* Maximum total size of the windows mapped at once.  Two windows are
+ * always allowed, whatever their size.
+ */
+#define H5FD_MMAP_MAX_MAPPED    ((size_t)1024 * 1024 * 1024)
+
+/* The maximum used for files opened from now on, changed for testing */
+static size_t H5FD_mmap_max_mapped_g = H5FD_MMAP_MAX_MAPPED;
+
+/* Driver-specific file access properties */
+typedef struct H5FD_mmap_fapl_t {
+    size_t      window_size;    /* Size of each mapped window, 0 for the whole file */
+} H5FD_mmap_fapl_t;
+
+/* The description of a file belonging to this driver.  The 'eoa' and 'eof'
+ * determine the amount of hdf5 address space in use and the size of the
+ * (read-only) filesystem file.  'window_size' is the size of the windows the
+ * file is mapped in (rounded up to a multiple of the page size, or the size
+ * of the file when mapping it whole), and 'windows' holds the address of
+ * each window, or NULL for windows that aren't mapped.  'last_used' holds
+ * the value of the 'clock' counter when each window was last used, so that
+ * the least recently used window can be unmapped when 'nmapped' reaches
+ * 'max_mapped'.
+ */
+typedef struct H5FD_mmap_t {
+    H5FD_t          pub;            /* public stuff, must be first      */
+    int             fd;             /* the filesystem file descriptor   */
+    haddr_t         eoa;            /* end of allocated region          */
+    haddr_t         eof;            /* end of file; current file size   */
+    H5FD_mmap_fapl_t fa;            /* file access properties           */
+    size_t          window_size;    /* size of each mapped window       */
+    size_t          nwindows;       /* number of windows                */
+    uint8_t         **windows;      /* mapped windows                   */
+    uint64_t        *last_used;     /* when each window was last used   */
+    uint64_t        clock;          /* count of window uses             */
+    size_t          nmapped;        /* number of windows mapped         */
+    size_t          max_mapped;     /* max. number of windows mapped    */
+    char            filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
+    dev_t           device;         /* file device number               */
+    ino_t           inode;          /* file i-node number               */
+} H5FD_mmap_t;
+
+/*
+ * These macros check for overflow of various quantities.  These macros
+ * assume that HDoff_t is signed and haddr_t and size_t are unsigned.
+ *
+ * ADDR_OVERFLOW:   Checks whether a file address of type `haddr_t'
+ *                  is too large to be represented by the second argument
+ *                  of the file seek function.
+ *
+ * SIZE_OVERFLOW:   Checks whether a buffer size of type `hsize_t' is too
+ *                  large to be represented by the `size_t' type.
+ *
+ * REGION_OVERFLOW: Checks whether an address and size pair describe data
+ *                  which can be addressed entirely by the second
+ *                  argument of the file seek function.
+ */
+#define MAXADDR (((haddr_t)1<<(8*sizeof(HDoff_t)-1))-1)
+#define ADDR_OVERFLOW(A)    (HADDR_UNDEF==(A) || ((A) & ~(haddr_t)MAXADDR))
+#define SIZE_OVERFLOW(Z)    ((Z) & ~(hsize_t)MAXADDR)
+#define REGION_OVERFLOW(A,Z)    (ADDR_OVERFLOW(A) || SIZE_OVERFLOW(Z) ||    \
+                                 HADDR_UNDEF==(A)+(Z) ||                    \
+                                (HDoff_t)((A)+(Z))<(HDoff_t)(A))
+
+/* Prototypes */
+static herr_t H5FD_mmap_term(void);
+static void *H5FD_mmap_fapl_get(H5FD_t *file);
+static void *H5FD_mmap_fapl_copy(const void *_old_fa);
+static H5FD_t *H5FD_mmap_open(const char *name, unsigned flags, hid_t fapl_id,
+            haddr_t maxaddr);
+static herr_t H5FD_mmap_close(H5FD_t *_file);
+static int H5FD_mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2);
+static herr_t H5FD_mmap_query(const H5FD_t *_f1, unsigned long *flags);
+static haddr_t H5FD_mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t H5FD_mmap_set_eoa(H5FD_t *_file, H5FD_mem_t type, haddr_t addr);
+static haddr_t H5FD_mmap_get_eof(const H5FD_t *_file, H5FD_mem_t type);
+static herr_t  H5FD_mmap_get_handle(H5FD_t *_file, hid_t fapl, void** file_handle);
+static herr_t H5FD_mmap_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, void *buf);
+static herr_t H5FD_mmap_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
+            size_t size, const void *buf);
+static herr_t H5FD_mmap_map(H5FD_t *_file, H5FD_mem_t type, haddr_t addr,
+            size_t size, const void **ptr);
+static herr_t H5FD_mmap_lock(H5FD_t *_file, hbool_t rw);
+static herr_t H5FD_mmap_unlock(H5FD_t *_file);
+
+static uint8_t *H5FD_mmap_window(H5FD_mmap_t *file, size_t idx);
+
+static const H5FD_class_t H5FD_mmap_g = {
+    "mmap",                     /* name                 */
+    MAXADDR,                    /* maxaddr              */
+    H5F_CLOSE_WEAK,             /* fc_degree            */
+    H5FD_mmap_term,             /* terminate            */
+    NULL,                       /* sb_size              */
+    NULL,                       /* sb_encode            */
+    NULL,                       /* sb_decode            */
+    sizeof(H5FD_mmap_fapl_t),   /* fapl_size            */
+    H5FD_mmap_fapl_get,         /* fapl_get             */
+    H5FD_mmap_fapl_copy,        /* fapl_copy            */
+    NULL,                       /* fapl_free            */
+    0,                          /* dxpl_size            */
+    NULL,                       /* dxpl_copy            */
+    NULL,                       /* dxpl_free            */
+    H5FD_mmap_open,             /* open                 */
+    H5FD_mmap_close,            /* close                */
+    H5FD_mmap_cmp,              /* cmp                  */
+    H5FD_mmap_query,            /* query                */
+    NULL,                       /* get_type_map         */
+    NULL,                       /* alloc                */
+    NULL,                       /* free                 */
+    H5FD_mmap_get_eoa,          /* get_eoa              */
+    H5FD_mmap_set_eoa,          /* set_eoa              */
+    H5FD_mmap_get_eof,          /* get_eof              */
+    H5FD_mmap_get_handle,       /* get_handle           */
+    H5FD_mmap_read,             /* read                 */
+    H5FD_mmap_write,            /* write                */
+    NULL,                       /* flush                */
+    NULL,                       /* truncate             */
+    H5FD_mmap_lock,             /* lock                 */
+    H5FD_mmap_unlock,           /* unlock               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    NULL,                       /* read_vector          */
+    NULL,                       /* write_vector         */
+    H5FD_mmap_map               /* map                  */
+};
+
+/* Declare a free list to manage the H5FD_mmap_t struct */
+H5FL_DEFINE_STATIC(H5FD_mmap_t);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD__init_package
+ *
+ * Purpose:     Initializes any interface-specific data or routines.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD__init_package(void)
+{
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_STATIC
+
+    if(H5FD_mmap_init() < 0)
+        HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, FAIL, "unable to initialize mmap VFD")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5FD__init_package() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_init
+ *
+ * Purpose:     Initialize this driver by registering the driver with the
+ *              library.
+ *
+ * Return:      Success:    The driver ID for the mmap driver.
+ *              Failure:    Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+hid_t
+H5FD_mmap_init(void)
+{
+    hid_t ret_value = H5I_INVALID_HID;          /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    if(H5I_VFL != H5I_get_type(H5FD_MMAP_g))
+        H5FD_MMAP_g = H5FD_register(&H5FD_mmap_g, sizeof(H5FD_class_t), FALSE);
+
+    /* Set return value */
+    ret_value = H5FD_MMAP_g;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_init() */
+
+
+/*---------------------------------------------------------------------------
+ * Function:    H5FD_mmap_term
+ *
+ * Purpose:     Shut down the VFD
+ *
+ * Returns:     SUCCEED (Can't fail)
+ *
+ *---------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_term(void)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Reset VFL ID */
+    H5FD_MMAP_g = 0;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_mmap_term() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_fapl_mmap
+ *
+ * Purpose:     Modify the file access property list to use the H5FD_MMAP
+ *              driver defined in this source file.
+ *
+ *              WINDOW_SIZE is the size of the windows the file is mapped
+ *              in, which is rounded up to a multiple of the page size.  A
+ *              WINDOW_SIZE of 0 maps the whole file when it is opened.
+ *
+ *              The driver only opens files read-only.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_fapl_mmap(hid_t fapl_id, size_t window_size)
+{
+    H5P_genplist_t      *plist;         /* Property list pointer */
+    H5FD_mmap_fapl_t    fa;             /* mmap VFD info */
+    herr_t              ret_value;
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", fapl_id, window_size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    fa.window_size = window_size;
+
+    ret_value = H5P_set_driver(plist, H5FD_MMAP, &fa);
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_fapl_mmap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_fapl_mmap
+ *
+ * Purpose:     Returns information about the mmap file access property
+ *              list though the function arguments.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_fapl_mmap(hid_t fapl_id, size_t *window_size/*out*/)
+{
+    H5P_genplist_t          *plist;     /* Property list pointer */
+    const H5FD_mmap_fapl_t  *fa;        /* mmap VFD info */
+    herr_t                  ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", fapl_id, window_size);
+
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access list")
+    if(H5FD_MMAP != H5P_peek_driver(plist))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "incorrect VFL driver")
+    if(NULL == (fa = (const H5FD_mmap_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "bad VFL driver info")
+
+    if(window_size)
+        *window_size = fa->window_size;
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_fapl_mmap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_fapl_get
+ *
+ * Purpose:     Returns a file access property list which indicates how the
+ *              specified file is being accessed. The return list could be
+ *              used to access another file the same way.
+ *
+ * Return:      Success:    Ptr to new file access property list with all
+ *                          members copied from the file struct.
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_mmap_fapl_get(H5FD_t *_file)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+    void        *ret_value = NULL;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set return value */
+    ret_value = H5FD_mmap_fapl_copy(&(file->fa));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_fapl_get() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_fapl_copy
+ *
+ * Purpose:     Copies the mmap-specific file access properties.
+ *
+ * Return:      Success:    Ptr to a new property list
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5FD_mmap_fapl_copy(const void *_old_fa)
+{
+    const H5FD_mmap_fapl_t  *old_fa = (const H5FD_mmap_fapl_t *)_old_fa;
+    H5FD_mmap_fapl_t        *new_fa = NULL;     /* New mmap VFD info */
+    void                    *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(old_fa);
+
+    if(NULL == (new_fa = (H5FD_mmap_fapl_t *)H5MM_malloc(sizeof(H5FD_mmap_fapl_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+
+    /* Copy the general information */
+    HDmemcpy(new_fa, old_fa, sizeof(H5FD_mmap_fapl_t));
+
+    /* Set return value */
+    ret_value = new_fa;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_fapl_copy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_open
+ *
+ * Purpose:     Opens an HDF5 file read-only, and maps it (or sets up the
+ *              windows to map it in).
+ *
+ * Return:      Success:    A pointer to a new file data structure. The
+ *                          public fields will be initialized by the
+ *                          caller, which is always H5FD_open().
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_t *
+H5FD_mmap_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    H5FD_mmap_t             *file = NULL;   /* mmap VFD info            */
+    const H5FD_mmap_fapl_t  *fa;            /* mmap properties          */
+    H5P_genplist_t          *plist;         /* Property list pointer    */
+    int                     fd = -1;        /* File descriptor          */
+    long                    page_size;      /* System page size         */
+    h5_stat_t               sb;
+    H5FD_t                  *ret_value = NULL;  /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check on file offsets */
+    HDcompile_assert(sizeof(HDoff_t) >= sizeof(size_t));
+
+    /* Check arguments */
+    if(!name || !*name)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "invalid file name")
+    if(0 == maxaddr || HADDR_UNDEF == maxaddr)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, NULL, "bogus maxaddr")
+    if(ADDR_OVERFLOW(maxaddr))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, NULL, "bogus maxaddr")
+    if(flags & (H5F_ACC_RDWR | H5F_ACC_TRUNC | H5F_ACC_CREAT | H5F_ACC_EXCL))
+        HGOTO_ERROR(H5E_ARGS, H5E_UNSUPPORTED, NULL, "the mmap driver only opens files read-only")
+
+    /* Get the driver specific information */
+    if(NULL == (plist = H5P_object_verify(fapl_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not a file access property list")
+    if(NULL == (fa = (const H5FD_mmap_fapl_t *)H5P_peek_driver_info(plist)))
+        HGOTO_ERROR(H5E_PLIST, H5E_BADVALUE, NULL, "bad VFL driver info")
+
+    /* Open the file */
+    if((fd = HDopen(name, O_RDONLY, 0666)) < 0) {
+        int myerrno = errno;
+        HGOTO_ERROR(H5E_FILE, H5E_CANTOPENFILE, NULL, "unable to open file: name = '%s', errno = %d, error message = '%s', flags = %x", name, myerrno, HDstrerror(myerrno), flags);
+    } /* end if */
+
+    if(HDfstat(fd, &sb) < 0)
+        HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, NULL, "unable to fstat file")
+
+    /* Create the new file struct */
+    if(NULL == (file = H5FL_CALLOC(H5FD_mmap_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate file struct")
+    file->fd = fd;
+    H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
+    file->device = sb.st_dev;
+    file->inode = sb.st_ino;
+    file->fa = *fa;
+
+    /* Retain a copy of the name used to open the file, for possible error reporting */
+    HDstrncpy(file->filename, name, sizeof(file->filename));
+    file->filename[sizeof(file->filename) - 1] = '\0';
+
+    /* Work out the windows: the whole file, or windows of a whole number
+     * of pages.
+     */
+    if((page_size = HDsysconf(_SC_PAGESIZE)) <= 0)
+        HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTGET, NULL, "unable to get the page size")
+    if(0 == fa->window_size || (haddr_t)fa->window_size >= file->eof)
+        H5_CHECKED_ASSIGN(file->window_size, size_t, file->eof, haddr_t)
+    else
+        file->window_size = ((fa->window_size + (size_t)page_size - 1) / (size_t)page_size) * (size_t)page_size;
+    if(file->eof > 0) {
+        file->nwindows = (size_t)((file->eof + file->window_size - 1) / file->window_size);
+        if(NULL == (file->windows = (uint8_t **)H5MM_calloc(file->nwindows * sizeof(uint8_t *))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate window list")
+        if(NULL == (file->last_used = (uint64_t *)H5MM_calloc(file->nwindows * sizeof(uint64_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "unable to allocate window list")
+        file->max_mapped = MAX(H5FD_mmap_max_mapped_g / file->window_size, 2);
+
+        /* Map a file mapped whole right away */
+        if(1 == file->nwindows && NULL == H5FD_mmap_window(file, (size_t)0))
+            HGOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to map file")
+    } /* end if */
+
+    /* Set return value */
+    ret_value = (H5FD_t*)file;
+
+done:
+    if(NULL == ret_value) {
+        if(file) {
+            if(file->windows)
+                file->windows = (uint8_t **)H5MM_xfree(file->windows);
+            if(file->last_used)
+                file->last_used = (uint64_t *)H5MM_xfree(file->last_used);
+            file = H5FL_FREE(H5FD_mmap_t, file);
+        } /* end if */
+        if(fd >= 0)
+            HDclose(fd);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_open() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_close
+ *
+ * Purpose:     Unmaps and closes an HDF5 file.
+ *
+ * Return:      Success:    SUCCEED
+ *              Failure:    FAIL, file not closed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_close(H5FD_t *_file)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+    size_t      u;                              /* Local index variable */
+    herr_t      ret_value = SUCCEED;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Sanity check */
+    HDassert(file);
+
+    /* Unmap the windows */
+    for(u = 0; u < file->nwindows; u++)
+        if(file->windows[u]) {
+            size_t len = (size_t)MIN((haddr_t)file->window_size, file->eof - (haddr_t)u * file->window_size);
+
+            if(HDmunmap(file->windows[u], len) < 0)
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTRELEASE, FAIL, "unable to unmap file")
+            file->windows[u] = NULL;
+            file->nmapped--;
+        } /* end if */
+    HDassert(0 == file->nmapped);
+    file->windows = (uint8_t **)H5MM_xfree(file->windows);
+    file->last_used = (uint64_t *)H5MM_xfree(file->last_used);
+
+    /* Close the underlying file */
+    if(HDclose(file->fd) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_CANTCLOSEFILE, FAIL, "unable to close file")
+
+    /* Release the file info */
+    file = H5FL_FREE(H5FD_mmap_t, file);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_close() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_cmp
+ *
+ * Purpose:     Compares two files belonging to this driver using an
+ *              arbitrary (but consistent) ordering.
+ *
+ * Return:      Success:    A value like strcmp()
+ *              Failure:    never fails (arguments were checked by the
+ *                          caller).
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_mmap_cmp(const H5FD_t *_f1, const H5FD_t *_f2)
+{
+    const H5FD_mmap_t   *f1 = (const H5FD_mmap_t *)_f1;
+    const H5FD_mmap_t   *f2 = (const H5FD_mmap_t *)_f2;
+    int ret_value = 0;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+#ifdef H5_DEV_T_IS_SCALAR
+    if(f1->device < f2->device) HGOTO_DONE(-1)
+    if(f1->device > f2->device) HGOTO_DONE(1)
+#else /* H5_DEV_T_IS_SCALAR */
+    /* If dev_t isn't a scalar value on this system, just use memcmp to
+     * determine if the values are the same or not.  The actual return value
+     * shouldn't really matter...
+     */
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) < 0) HGOTO_DONE(-1)
+    if(HDmemcmp(&(f1->device),&(f2->device),sizeof(dev_t)) > 0) HGOTO_DONE(1)
+#endif /* H5_DEV_T_IS_SCALAR */
+    if(f1->inode < f2->inode) HGOTO_DONE(-1)
+    if(f1->inode > f2->inode) HGOTO_DONE(1)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_query
+ *
+ * Purpose:     Set the flags that this VFL driver is capable of supporting.
+ *              (listed in H5FDpublic.h)
+ *
+ *              Metadata accumulation and data sieving are left off, as
+ *              they would only add a copy to reads served from memory.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_query(const H5FD_t H5_ATTR_UNUSED *_file, unsigned long *flags /* out */)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Set the VFL feature flags that this driver supports */
+    if(flags) {
+        *flags = 0;
+        *flags |= H5FD_FEAT_AGGREGATE_METADATA;     /* OK to aggregate metadata allocations                             */
+        *flags |= H5FD_FEAT_AGGREGATE_SMALLDATA;    /* OK to aggregate "small" raw data allocations                     */
+        *flags |= H5FD_FEAT_POSIX_COMPAT_HANDLE;    /* VFD handle is POSIX I/O call compatible                          */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_mmap_query() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_get_eoa
+ *
+ * Purpose:     Gets the end-of-address marker for the file. The EOA marker
+ *              is the first address past the last byte allocated in the
+ *              format address space.
+ *
+ * Return:      The end-of-address marker.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_mmap_get_eoa(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t   *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eoa)
+} /* end H5FD_mmap_get_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_set_eoa
+ *
+ * Purpose:     Set the end-of-address marker for the file. This function is
+ *              called shortly after an existing HDF5 file is opened in order
+ *              to tell the driver where the end of the HDF5 data is located.
+ *
+ * Return:      SUCCEED (Can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_set_eoa(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    file->eoa = addr;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5FD_mmap_set_eoa() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_get_eof
+ *
+ * Purpose:     Returns the end-of-file marker, which is the size of the
+ *              file when it was opened.
+ *
+ * Return:      End of file address, the first address past the end of the
+ *              filesystem file.
+ *
+ *-------------------------------------------------------------------------
+ */
+static haddr_t
+H5FD_mmap_get_eof(const H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type)
+{
+    const H5FD_mmap_t   *file = (const H5FD_mmap_t *)_file;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(file->eof)
+} /* end H5FD_mmap_get_eof() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5FD_mmap_get_handle
+ *
+ * Purpose:        Returns the file handle of mmap file driver.
+ *
+ * Returns:        SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_get_handle(H5FD_t *_file, hid_t H5_ATTR_UNUSED fapl, void **file_handle)
+{
+    H5FD_mmap_t     *file = (H5FD_mmap_t *)_file;
+    herr_t          ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(!file_handle)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "file handle not valid")
+
+    *file_handle = &(file->fd);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_get_handle() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_window
+ *
+ * Purpose:     Returns the address of window IDX of the file, mapping it
+ *              first if it isn't mapped.  If that would exceed the number
+ *              of windows that may be mapped at once, the least recently
+ *              used window is unmapped first.
+ *
+ * Return:      Success:    Address of the window
+ *              Failure:    NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint8_t *
+H5FD_mmap_window(H5FD_mmap_t *file, size_t idx)
+{
+    uint8_t     *ret_value = NULL;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(idx < file->nwindows);
+
+    if(NULL == file->windows[idx]) {
+        haddr_t start = (haddr_t)idx * file->window_size;    /* Start of the window */
+        size_t  len = (size_t)MIN((haddr_t)file->window_size, file->eof - start);
+        void    *window;                        /* The mapped window */
+
+        /* Unmap the least recently used window, if necessary */
+        if(file->nmapped >= file->max_mapped) {
+            size_t  lru = file->nwindows;       /* Least recently used window */
+            size_t  u;                          /* Local index variable */
+
+            for(u = 0; u < file->nwindows; u++)
+                if(file->windows[u] && (lru == file->nwindows || file->last_used[u] < file->last_used[lru]))
+                    lru = u;
+            HDassert(lru < file->nwindows);
+
+            if(HDmunmap(file->windows[lru], (size_t)MIN((haddr_t)file->window_size, file->eof - (haddr_t)lru * file->window_size)) < 0)
+                HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTRELEASE, NULL, "unable to unmap file window")
+            file->windows[lru] = NULL;
+            file->nmapped--;
+        } /* end if */
+
+        if(MAP_FAILED == (window = HDmmap(NULL, len, PROT_READ, MAP_SHARED, file->fd, (HDoff_t)start)))
+            HSYS_GOTO_ERROR(H5E_VFL, H5E_CANTINIT, NULL, "unable to map file window")
+        file->windows[idx] = (uint8_t *)window;
+        file->nmapped++;
+    } /* end if */
+    file->last_used[idx] = ++file->clock;
+
+    /* Set return value */
+    ret_value = file->windows[idx];
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_window() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_read
+ *
+ * Purpose:     Reads SIZE bytes of data from FILE beginning at address ADDR
+ *              into buffer BUF, by copying them from the mapping.  Reading
+ *              past the end of the file returns zeros.
+ *
+ * Return:      Success:    SUCCEED. Result is stored in caller-supplied
+ *                          buffer BUF.
+ *              Failure:    FAIL, Contents of buffer BUF are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t addr, size_t size, void *buf /*out*/)
+{
+    H5FD_mmap_t *file       = (H5FD_mmap_t *)_file;
+    uint8_t     *dst        = (uint8_t *)buf;       /* Where to copy to */
+    herr_t      ret_value   = SUCCEED;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(buf);
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    /* Copy from the windows the region falls in */
+    while(size > 0 && addr < file->eof) {
+        size_t  idx = (size_t)(addr / file->window_size);   /* Window holding addr */
+        size_t  off = (size_t)(addr - (haddr_t)idx * file->window_size);   /* Offset in the window */
+        size_t  len = (size_t)MIN((haddr_t)size, MIN((haddr_t)(file->window_size - off), file->eof - addr));
+        uint8_t *window;                        /* The window */
+
+        if(NULL == (window = H5FD_mmap_window(file, idx)))
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to map file window, addr = %llu", (unsigned long long)addr)
+        HDmemcpy(dst, window + off, len);
+
+        addr += len;
+        size -= len;
+        dst += len;
+    } /* end while */
+
+    /* Zero any remainder: end of file but not end of format address space */
+    if(size > 0)
+        HDmemset(dst, 0, size);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_write
+ *
+ * Purpose:     Fails, as the mmap driver is read-only.
+ *
+ * Return:      FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_write(H5FD_t H5_ATTR_UNUSED *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUSED dxpl_id,
+    haddr_t H5_ATTR_UNUSED addr, size_t H5_ATTR_UNUSED size, const void H5_ATTR_UNUSED *buf)
+{
+    herr_t      ret_value = FAIL;               /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "the mmap driver is read-only")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_map
+ *
+ * Purpose:     Sets *PTR to the address of SIZE bytes of the file at ADDR
+ *              in the mapping, which stays valid until the next read or
+ *              map call on the file (either may unmap the window).
+ *
+ *              Regions that extend past the end of the file or span two
+ *              windows can't be handed out, and *PTR is set to NULL for
+ *              them; the caller should read those instead.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_map(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, haddr_t addr,
+    size_t size, const void **ptr /*out*/)
+{
+    H5FD_mmap_t *file       = (H5FD_mmap_t *)_file;
+    herr_t      ret_value   = SUCCEED;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(ptr);
+
+    *ptr = NULL;
+
+    /* Check for overflow conditions */
+    if(!H5F_addr_defined(addr))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addr)
+    if(REGION_OVERFLOW(addr, size))
+        HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
+
+    if(size > 0 && addr + size <= file->eof) {
+        size_t  idx = (size_t)(addr / file->window_size);   /* Window holding addr */
+        size_t  off = (size_t)(addr - (haddr_t)idx * file->window_size);   /* Offset in the window */
+
+        if(size <= file->window_size - off) {
+            uint8_t *window;                    /* The window */
+
+            if(NULL == (window = H5FD_mmap_window(file, idx)))
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to map file window, addr = %llu", (unsigned long long)addr)
+            *ptr = window + off;
+        } /* end if */
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_map() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_lock
+ *
+ * Purpose:     To place an advisory lock on a file.
+ *		The lock type to apply depends on the parameter "rw":
+ *			TRUE--opens for write: an exclusive lock
+ *			FALSE--opens for read: a shared lock
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_lock(H5FD_t *_file, hbool_t rw)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;   /* VFD file struct          */
+    int lock_flags;                             /* file locking flags       */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    /* Set exclusive or shared lock based on rw status */
+    lock_flags = rw ? LOCK_EX : LOCK_SH;
+
+    /* Place a non-blocking lock on the file */
+    if(HDflock(file->fd, lock_flags | LOCK_NB) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to lock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_lock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_unlock
+ *
+ * Purpose:     To remove the existing lock on the file
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mmap_unlock(H5FD_t *_file)
+{
+    H5FD_mmap_t *file = (H5FD_mmap_t *)_file;   /* VFD file struct          */
+    herr_t ret_value = SUCCEED;                 /* Return value             */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+
+    if(HDflock(file->fd, LOCK_UN) < 0) {
+        if(ENOSYS == errno)
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "file locking disabled on this file system (use HDF5_USE_FILE_LOCKING environment variable to override)")
+        else
+            HSYS_GOTO_ERROR(H5E_FILE, H5E_BADFILE, FAIL, "unable to unlock file")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mmap_unlock() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_max_mapped_test
+ *
+ * Purpose:     Sets the maximum total size of the windows mapped at once
+ *              to MAX_SIZE bytes, for files opened from now on.  A
+ *              MAX_SIZE of 0 restores the default.
+ *
+ *              This function is only intended for use in the test code.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5FD_mmap_max_mapped_test(size_t max_size)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5FD_mmap_max_mapped_g = (max_size > 0 ? max_size : H5FD_MMAP_MAX_MAPPED);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_mmap_max_mapped_test() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_mmap_nmapped_test
+ *
+ * Purpose:     Retrieves the number of windows of FILE currently mapped.
+ *
+ *              This function is only intended for use in the test code.
+ *
+ * Return:      The number of mapped windows
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5FD_mmap_nmapped_test(const H5FD_t *_file)
+{
+    const H5FD_mmap_t *file = (const H5FD_mmap_t *)_file;   /* VFD file struct */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(file);
+
+    FUNC_LEAVE_NOAPI(file->nmapped)
+} /* end H5FD_mmap_nmapped_test() */
+
+#endif /* H5_HAVE_MMAP */
+
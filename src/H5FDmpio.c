@@ -71,6 +71,13 @@ typedef struct H5FD_mpio_t {
     haddr_t	local_eof;	/* Local end-of-file address for each process */
 } H5FD_mpio_t;
 
+/* An extent of a vector I/O request, for sorting the extents by address */
+typedef struct H5FD_mpio_vector_elmt_t {
+    haddr_t     addr;           /* File address of the extent           */
+    size_t      size;           /* Size of the extent                   */
+    void        *buf;           /* Buffer for the extent                */
+} H5FD_mpio_vector_elmt_t;
+
 /* Private Prototypes */
 
 /* Callbacks */
@@ -90,12 +97,26 @@ static herr_t H5FD_mpio_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, hadd
             size_t size, void *buf);
 static herr_t H5FD_mpio_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD_mpio_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t H5FD_mpio_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[]);
 static herr_t H5FD_mpio_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_mpio_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static int H5FD_mpio_mpi_rank(const H5FD_t *_file);
 static int H5FD_mpio_mpi_size(const H5FD_t *_file);
 static MPI_Comm H5FD_mpio_communicator(const H5FD_t *_file);
 
+/* Other functions */
+static herr_t H5FD_mpio_vector_io(H5FD_mpio_t *file, hid_t dxpl_id,
+            hbool_t do_write, uint32_t count, H5FD_mem_t types[],
+            haddr_t addrs[], size_t sizes[], void *bufs[]);
+static int H5FD_mpio_vector_elmt_cmp(const void *_elmt1, const void *_elmt2);
+static void H5FD_mpio_vector_fill(size_t nelmts,
+            const H5FD_mpio_vector_elmt_t *elmts, size_t nbytes);
+static herr_t H5FD_mpio_vector_runs(H5FD_mpio_t *file, hbool_t do_write,
+            size_t nelmts, const H5FD_mpio_vector_elmt_t *elmts);
+
 /* The MPIO file driver information */
 static const H5FD_class_mpi_t H5FD_mpio_g = {
     {   /* Start of superclass information */
@@ -130,7 +151,10 @@ static const H5FD_class_mpi_t H5FD_mpio_g = {
     H5FD_mpio_truncate,				/*truncate		*/
     NULL,                                       /*lock                  */
     NULL,                                       /*unlock                */
-    H5FD_FLMAP_DICHOTOMY                        /*fl_map                */
+    H5FD_FLMAP_DICHOTOMY,                       /*fl_map                */
+    H5FD_mpio_read_vector,			/*read_vector		*/
+    H5FD_mpio_write_vector,			/*write_vector		*/
+    NULL					/*map			*/
     },  /* End of superclass information */
     H5FD_mpio_mpi_rank,                         /*get_rank              */
     H5FD_mpio_mpi_size,                         /*get_size              */
@@ -1850,6 +1874,530 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_mpio_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_mpio_read_vector
+ *
+ * Purpose:	Reads COUNT extents from FILE into the buffers BUFS, according
+ *		to data transfer properties in DXPL_ID.
+ *
+ *		Independent transfers read each run of adjacent extents
+ *		with one MPI-I/O call; collective transfers read all the
+ *		extents with one collective call (see H5FD_mpio_vector_io()).
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mpio_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/)
+{
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    if(H5FD_mpio_vector_io((H5FD_mpio_t *)_file, dxpl_id, FALSE, count, types, addrs, sizes, bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't read vector")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mpio_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_mpio_write_vector
+ *
+ * Purpose:	Writes COUNT extents to FILE from the buffers BUFS, according
+ *		to data transfer properties in DXPL_ID.
+ *
+ *		Independent transfers write each run of adjacent extents
+ *		with one MPI-I/O call; collective transfers write all the
+ *		extents with one collective call (see H5FD_mpio_vector_io()).
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mpio_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    herr_t      ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* (The buffers are only read from, when writing) */
+    if(H5FD_mpio_vector_io((H5FD_mpio_t *)_file, dxpl_id, TRUE, count, types, addrs, sizes, (void **)bufs) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write vector")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mpio_write_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_mpio_vector_elmt_cmp
+ *
+ * Purpose:	Compares two extents of a vector I/O request by address,
+ *		for HDqsort().
+ *
+ * Return:	Negative, zero or positive, as the first extent's address
+ *		is less than, equal to or greater than the second's
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5FD_mpio_vector_elmt_cmp(const void *_elmt1, const void *_elmt2)
+{
+    const H5FD_mpio_vector_elmt_t *elmt1 = (const H5FD_mpio_vector_elmt_t *)_elmt1;
+    const H5FD_mpio_vector_elmt_t *elmt2 = (const H5FD_mpio_vector_elmt_t *)_elmt2;
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(elmt1->addr, elmt2->addr))
+} /* end H5FD_mpio_vector_elmt_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_mpio_vector_fill
+ *
+ * Purpose:	Zeroes the parts of the NELMTS extents in ELMTS, which are
+ *		sorted by address, that lie beyond the first NBYTES bytes
+ *		read, i.e. beyond the end of the physical MPI file.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5FD_mpio_vector_fill(size_t nelmts, const H5FD_mpio_vector_elmt_t *elmts,
+    size_t nbytes)
+{
+    size_t      u;              /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    for(u = 0; u < nelmts; u++) {
+        if(nbytes >= elmts[u].size)
+            nbytes -= elmts[u].size;
+        else {
+            HDmemset((char *)elmts[u].buf + nbytes, 0, elmts[u].size - nbytes);
+            nbytes = 0;
+        } /* end else */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_mpio_vector_fill() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_mpio_vector_runs
+ *
+ * Purpose:	Reads or writes the NELMTS extents in ELMTS independently,
+ *		with the default file view.  Each run of extents that are
+ *		adjacent in the file is transferred with one
+ *		MPI_File_read_at()/MPI_File_write_at() call, using an
+ *		hindexed MPI datatype for the buffers of a run with more
+ *		than one extent.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mpio_vector_runs(H5FD_mpio_t *file, hbool_t do_write, size_t nelmts,
+    const H5FD_mpio_vector_elmt_t *elmts)
+{
+    int                 *lens = NULL;           /* Lengths of the extents in a run */
+    MPI_Aint            *buf_disps = NULL;      /* Absolute addresses of the buffers in a run */
+    MPI_Datatype        buf_type = MPI_DATATYPE_NULL;   /* MPI description of the buffers in memory */
+    hbool_t             buf_type_created = FALSE;
+    MPI_Status          mpi_stat;               /* Status from I/O operation */
+    int                 mpi_code;               /* MPI return code */
+#if MPI_VERSION >= 3
+    MPI_Count           bytes_io;               /* Number of bytes transferred */
+#else
+    int                 bytes_io;               /* Number of bytes transferred */
+#endif
+    size_t              u, v, w;                /* Local index variables */
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(elmts || 0 == nelmts);
+
+    for(u = 0; u < nelmts; u = v) {
+        MPI_Offset      mpi_off;                /* File offset of the run */
+        size_t          run_size = elmts[u].size;       /* Size of the run */
+        void            *buf;                   /* Buffer for the transfer */
+        int             buf_count;              /* Count of BUF_TYPE to transfer */
+        MPI_Datatype    type;                   /* MPI datatype for the transfer */
+
+        /* Portably initialize MPI status variable */
+        HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+
+        if(H5FD_mpi_haddr_to_MPIOff(elmts[u].addr, &mpi_off) < 0)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from haddr to MPI off")
+        if((size_t)(int)run_size != run_size)
+            HGOTO_ERROR(H5E_INTERNAL, H5E_BADRANGE, FAIL, "can't convert from size to size_i")
+
+        /* Extend the run over the following adjacent extents, as long as
+         * its size fits in an MPI count
+         */
+        for(v = u + 1; v < nelmts; v++) {
+            if(!H5F_addr_eq(elmts[v].addr, elmts[v - 1].addr + elmts[v - 1].size))
+                break;
+            if(elmts[v].size > (size_t)INT_MAX - run_size)
+                break;
+            run_size += elmts[v].size;
+        } /* end for */
+
+        if(v - u == 1) {
+            buf = elmts[u].buf;
+            buf_count = (int)run_size;
+            type = MPI_BYTE;
+        } /* end if */
+        else {
+            /* Describe the buffers of the run with an MPI datatype */
+            if(NULL == lens) {
+                if(NULL == (lens = (int *)H5MM_malloc(nelmts * sizeof(int))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for extent lengths")
+                if(NULL == (buf_disps = (MPI_Aint *)H5MM_malloc(nelmts * sizeof(MPI_Aint))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for buffer displacements")
+            } /* end if */
+            for(w = u; w < v; w++) {
+                lens[w - u] = (int)elmts[w].size;
+                if(MPI_SUCCESS != (mpi_code = MPI_Get_address(elmts[w].buf, &buf_disps[w - u])))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+            } /* end for */
+            if(MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed((int)(v - u), lens, buf_disps, MPI_BYTE, &buf_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
+            buf_type_created = TRUE;
+            if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&buf_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+
+            buf = MPI_BOTTOM;
+            buf_count = 1;
+            type = buf_type;
+        } /* end else */
+
+#ifdef H5FDmpio_DEBUG
+        if(H5FD_mpio_Debug[(int)(do_write ? 'w' : 'r')])
+            fprintf(stdout, "in H5FD_mpio_vector_runs  mpi_off=%ld  nelmts=%d  run_size=%llu\n",
+                    (long)mpi_off, (int)(v - u), (unsigned long long)run_size);
+#endif
+
+        if(do_write) {
+            if(MPI_SUCCESS != (mpi_code = MPI_File_write_at(file->f, mpi_off, buf, buf_count, type, &mpi_stat)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at failed", mpi_code)
+        } /* end if */
+        else {
+            if(MPI_SUCCESS != (mpi_code = MPI_File_read_at(file->f, mpi_off, buf, buf_count, type, &mpi_stat)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at failed", mpi_code)
+        } /* end else */
+
+        if(buf_type_created) {
+            MPI_Type_free(&buf_type);
+            buf_type_created = FALSE;
+        } /* end if */
+
+        /* How many bytes were actually transferred? */
+#if MPI_VERSION >= 3
+        if(MPI_SUCCESS != (mpi_code = MPI_Get_elements_x(&mpi_stat, MPI_BYTE, &bytes_io)))
+#else
+        if(MPI_SUCCESS != (mpi_code = MPI_Get_elements(&mpi_stat, MPI_BYTE, &bytes_io)))
+#endif
+            HMPI_GOTO_ERROR(FAIL, "MPI_Get_elements failed", mpi_code)
+        if(bytes_io < 0 || (size_t)bytes_io > run_size)
+            HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "file vector I/O failed")
+
+        if(do_write) {
+            if((size_t)bytes_io != run_size)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+            /* Keep track of the local EOF (see H5FD_mpio_write()) */
+            file->eof = HADDR_UNDEF;
+            if((elmts[u].addr + run_size) > file->local_eof)
+                file->local_eof = elmts[u].addr + run_size;
+        } /* end if */
+        else
+            /* This gives us zeroes beyond end of physical MPI file */
+            H5FD_mpio_vector_fill(v - u, &elmts[u], (size_t)bytes_io);
+    } /* end for */
+
+done:
+    if(buf_type_created)
+        MPI_Type_free(&buf_type);
+    H5MM_xfree(buf_disps);
+    H5MM_xfree(lens);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mpio_vector_runs() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_mpio_vector_io
+ *
+ * Purpose:	Reads or writes the extents of a vector I/O request.
+ *
+ *		The non-empty extents are sorted by address, unless they
+ *		overlap, in which case they are kept in the order given.
+ *
+ *		Independent transfers leave the file view alone: each run
+ *		of extents that are adjacent in the file is transferred
+ *		with its own MPI_File_read_at()/MPI_File_write_at() call
+ *		(see H5FD_mpio_vector_runs()).
+ *
+ *		Collective transfers describe the extents with two hindexed
+ *		MPI datatypes: one of the extents' file addresses, which is
+ *		set as the file view, and one of their buffers' absolute
+ *		addresses, which is used with MPI_BOTTOM.  All the extents
+ *		are then transferred with one MPI_File_read_at_all()/
+ *		MPI_File_write_at_all() call, which lets the MPI-I/O layer
+ *		aggregate them across processes.  Setting the file view is
+ *		collective, so a process whose extents can't be described
+ *		by a file view (overlapping extents, or extents too large
+ *		for an MPI count) still takes part, with nothing to
+ *		transfer, and then transfers its extents independently.
+ *
+ *		As for H5FD_mpio_read(), reading past the end of the file
+ *		returns zeros.
+ *
+ * Return:	Success:	Non-negative
+ *
+ *		Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_mpio_vector_io(H5FD_mpio_t *file, hid_t dxpl_id, hbool_t do_write,
+    uint32_t count, H5FD_mem_t H5_ATTR_UNUSED types[], haddr_t addrs[],
+    size_t sizes[], void *bufs[])
+{
+    H5FD_mpio_vector_elmt_t *elmts = NULL;      /* Non-empty extents, sorted by address */
+    int                 *lens = NULL;           /* Lengths of the extents */
+    MPI_Aint            *file_disps = NULL;     /* File displacements of the extents */
+    MPI_Aint            *buf_disps = NULL;      /* Absolute addresses of the buffers */
+    MPI_Datatype        file_type = MPI_BYTE;   /* MPI description of the extents in the file */
+    MPI_Datatype        buf_type = MPI_BYTE;    /* MPI description of the buffers in memory */
+    hbool_t             file_type_created = FALSE;
+    hbool_t             buf_type_created = FALSE;
+    hbool_t             view_set = FALSE;       /* Whether the file view is set to the extents */
+    MPI_Status          mpi_stat;               /* Status from I/O operation */
+    int                 mpi_code;               /* MPI return code */
+#if MPI_VERSION >= 3
+    MPI_Count           bytes_io;               /* Number of bytes transferred */
+#else
+    int                 bytes_io;               /* Number of bytes transferred */
+#endif
+    H5P_genplist_t      *plist;                 /* Property list pointer */
+    H5FD_mpio_xfer_t    xfer_mode;              /* I/O tranfer mode */
+    hbool_t             use_view;               /* Whether to transfer the extents through a file view */
+    hbool_t             sorted = TRUE;          /* Whether the extents are sorted */
+    hbool_t             overlap = FALSE;        /* Whether any extents overlap */
+    size_t              io_size = 0;            /* Number of bytes requested */
+    size_t              nelmts = 0;             /* Number of non-empty extents */
+    size_t              u;                      /* Local index variable */
+    herr_t              ret_value = SUCCEED;
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file);
+    HDassert(H5FD_MPIO == file->pub.driver_id);
+    /* Make certain we have the correct type of property list */
+    HDassert(H5I_GENPROP_LST == H5I_get_type(dxpl_id));
+    HDassert(TRUE == H5P_isa_class(dxpl_id, H5P_DATASET_XFER));
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    /* Portably initialize MPI status variable */
+    HDmemset(&mpi_stat, 0, sizeof(MPI_Status));
+
+    /* Obtain the data transfer properties */
+    if(NULL == (plist = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list")
+
+    /* get the transfer mode from the dxpl */
+    if(H5P_get(plist, H5D_XFER_IO_XFER_MODE_NAME, &xfer_mode) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode")
+
+    /* Collect the non-empty extents */
+    if(count > 0) {
+        if(NULL == (elmts = (H5FD_mpio_vector_elmt_t *)H5MM_malloc(count * sizeof(H5FD_mpio_vector_elmt_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for vector extents")
+
+        for(u = 0; u < count; u++) {
+            if(0 == sizes[u])
+                continue;
+            if(nelmts > 0 && H5F_addr_lt(addrs[u], elmts[nelmts - 1].addr))
+                sorted = FALSE;
+            elmts[nelmts].addr = addrs[u];
+            elmts[nelmts].size = sizes[u];
+            elmts[nelmts].buf = bufs[u];
+            io_size += sizes[u];
+            nelmts++;
+        } /* end for */
+
+        if(!sorted)
+            HDqsort(elmts, nelmts, sizeof(H5FD_mpio_vector_elmt_t), H5FD_mpio_vector_elmt_cmp);
+        for(u = 1; u < nelmts && !overlap; u++)
+            if(H5F_addr_lt(elmts[u].addr, elmts[u - 1].addr + elmts[u - 1].size))
+                overlap = TRUE;
+
+        /* Overlapping extents are transferred in the order given */
+        if(overlap && !sorted)
+            for(u = 0, nelmts = 0; u < count; u++)
+                if(sizes[u] > 0) {
+                    elmts[nelmts].addr = addrs[u];
+                    elmts[nelmts].size = sizes[u];
+                    elmts[nelmts].buf = bufs[u];
+                    nelmts++;
+                } /* end if */
+    } /* end if */
+
+    /* Independent transfers don't touch the file view */
+    if(xfer_mode != H5FD_MPIO_COLLECTIVE) {
+        if(H5FD_mpio_vector_runs(file, do_write, nelmts, elmts) < 0)
+            HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "can't transfer vector extents")
+    } /* end if */
+    else {
+        H5FD_mpio_collective_opt_t coll_opt_mode;       /* Collective or independent I/O */
+        int buf_count = 0;                              /* Count of BUF_TYPE to transfer */
+
+        /* Check that the extents can be described with MPI datatypes */
+        use_view = (nelmts > 0 && !overlap && (size_t)(int)io_size == io_size);
+        for(u = 0; u < nelmts && use_view; u++)
+            if((size_t)(int)elmts[u].size != elmts[u].size || (haddr_t)(MPI_Aint)elmts[u].addr != elmts[u].addr)
+                use_view = FALSE;
+
+        /* Build the file and memory types */
+        if(use_view) {
+            int nelmts_i = (int)nelmts;
+
+            if(NULL == (lens = (int *)H5MM_malloc(nelmts * sizeof(int))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for extent lengths")
+            if(NULL == (file_disps = (MPI_Aint *)H5MM_malloc(nelmts * sizeof(MPI_Aint))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for file displacements")
+            if(NULL == (buf_disps = (MPI_Aint *)H5MM_malloc(nelmts * sizeof(MPI_Aint))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for buffer displacements")
+            for(u = 0; u < nelmts; u++) {
+                lens[u] = (int)elmts[u].size;
+                file_disps[u] = (MPI_Aint)elmts[u].addr;
+                if(MPI_SUCCESS != (mpi_code = MPI_Get_address(elmts[u].buf, &buf_disps[u])))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_Get_address failed", mpi_code)
+            } /* end for */
+
+            if(MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed(nelmts_i, lens, file_disps, MPI_BYTE, &file_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
+            file_type_created = TRUE;
+            if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&file_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+            if(MPI_SUCCESS != (mpi_code = MPI_Type_create_hindexed(nelmts_i, lens, buf_disps, MPI_BYTE, &buf_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_create_hindexed failed", mpi_code)
+            buf_type_created = TRUE;
+            if(MPI_SUCCESS != (mpi_code = MPI_Type_commit(&buf_type)))
+                HMPI_GOTO_ERROR(FAIL, "MPI_Type_commit failed", mpi_code)
+            buf_count = 1;
+        } /* end if */
+
+#ifdef H5FDmpio_DEBUG
+        if(H5FD_mpio_Debug[(int)(do_write ? 'w' : 'r')])
+            fprintf(stdout, "in H5FD_mpio_vector_io  nelmts=%d  io_size=%llu  do_write=%d  use_view=%d\n",
+                    (int)nelmts, (unsigned long long)io_size, (int)do_write, (int)use_view);
+#endif
+
+        /* Get the collective_opt property to check whether the application wants to do IO individually. */
+        if(H5P_get(plist, H5D_XFER_MPIO_COLLECTIVE_OPT_NAME, &coll_opt_mode) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI-I/O collective_op property")
+
+        /* Set the file view to the extents (all processes must take part),
+         * and transfer them all at once
+         */
+        if(MPI_SUCCESS != (mpi_code = MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, file_type, H5FD_mpi_native_g, file->info)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+        view_set = TRUE;
+
+        if(coll_opt_mode == H5FD_MPIO_COLLECTIVE_IO) {
+            if(do_write) {
+                if(MPI_SUCCESS != (mpi_code = MPI_File_write_at_all(file->f, (MPI_Offset)0, MPI_BOTTOM, buf_count, buf_type, &mpi_stat)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at_all failed", mpi_code)
+            } /* end if */
+            else {
+                if(MPI_SUCCESS != (mpi_code = MPI_File_read_at_all(file->f, (MPI_Offset)0, MPI_BOTTOM, buf_count, buf_type, &mpi_stat)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at_all failed", mpi_code)
+            } /* end else */
+        } /* end if */
+        else if(use_view) {
+            if(do_write) {
+                if(MPI_SUCCESS != (mpi_code = MPI_File_write_at(file->f, (MPI_Offset)0, MPI_BOTTOM, buf_count, buf_type, &mpi_stat)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_File_write_at failed", mpi_code)
+            } /* end if */
+            else {
+                if(MPI_SUCCESS != (mpi_code = MPI_File_read_at(file->f, (MPI_Offset)0, MPI_BOTTOM, buf_count, buf_type, &mpi_stat)))
+                    HMPI_GOTO_ERROR(FAIL, "MPI_File_read_at failed", mpi_code)
+            } /* end else */
+        } /* end if */
+
+        /* Reset the file view */
+        view_set = FALSE;
+        if(MPI_SUCCESS != (mpi_code = MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, MPI_BYTE, H5FD_mpi_native_g, file->info)))
+            HMPI_GOTO_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+
+        if(use_view) {
+            /* How many bytes were actually transferred? */
+#if MPI_VERSION >= 3
+            if(MPI_SUCCESS != (mpi_code = MPI_Get_elements_x(&mpi_stat, MPI_BYTE, &bytes_io)))
+#else
+            if(MPI_SUCCESS != (mpi_code = MPI_Get_elements(&mpi_stat, MPI_BYTE, &bytes_io)))
+#endif
+                HMPI_GOTO_ERROR(FAIL, "MPI_Get_elements failed", mpi_code)
+            if(bytes_io < 0 || (size_t)bytes_io > io_size)
+                HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "file vector I/O failed")
+
+            if(do_write) {
+                if((size_t)bytes_io != io_size)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+                /* Keep track of the local EOF (see H5FD_mpio_write()) */
+                file->eof = HADDR_UNDEF;
+                if((elmts[nelmts - 1].addr + elmts[nelmts - 1].size) > file->local_eof)
+                    file->local_eof = elmts[nelmts - 1].addr + elmts[nelmts - 1].size;
+            } /* end if */
+            else
+                /* This gives us zeroes beyond end of physical MPI file,
+                 * which the extents reach in address order.
+                 */
+                H5FD_mpio_vector_fill(nelmts, elmts, (size_t)bytes_io);
+        } /* end if */
+        else
+            /* Transfer the extents that couldn't go through the view */
+            if(H5FD_mpio_vector_runs(file, do_write, nelmts, elmts) < 0)
+                HGOTO_ERROR(H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, FAIL, "can't transfer vector extents")
+    } /* end else */
+
+done:
+    if(view_set)
+        if(MPI_SUCCESS != (mpi_code = MPI_File_set_view(file->f, (MPI_Offset)0, MPI_BYTE, MPI_BYTE, H5FD_mpi_native_g, file->info)))
+            HMPI_DONE_ERROR(FAIL, "MPI_File_set_view failed", mpi_code)
+    if(file_type_created)
+        MPI_Type_free(&file_type);
+    if(buf_type_created)
+        MPI_Type_free(&buf_type);
+    H5MM_xfree(buf_disps);
+    H5MM_xfree(file_disps);
+    H5MM_xfree(lens);
+    H5MM_xfree(elmts);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_mpio_vector_io() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_mpio_flush
@@ -111,6 +111,10 @@ typedef struct H5FD_multi_dxpl_t {
 static char *my_strdup(const char *s);
 static int compute_next(H5FD_multi_t *file);
 static int open_members(H5FD_multi_t *file);
+static H5FD_mem_t locate_member(const H5FD_multi_t *file, haddr_t addr);
+static herr_t vector_io(H5FD_multi_t *file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[],
+    int do_write);
 
 /* Callback prototypes */
 static herr_t H5FD_multi_term(void);
@@ -137,6 +141,10 @@ static herr_t H5FD_multi_free(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, had
 			      hsize_t size);
 static herr_t H5FD_multi_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
 			      size_t size, void *_buf/*out*/);
+static herr_t H5FD_multi_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/);
+static herr_t H5FD_multi_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[]);
 static herr_t H5FD_multi_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
 			       size_t size, const void *_buf);
 static herr_t H5FD_multi_flush(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
@@ -177,7 +185,10 @@ static const H5FD_class_t H5FD_multi_g = {
     H5FD_multi_truncate,			/*truncate		*/
     H5FD_multi_lock,                            /*lock                  */
     H5FD_multi_unlock,                          /*unlock                */
-    H5FD_FLMAP_DEFAULT 				/*fl_map		*/
+    H5FD_FLMAP_DEFAULT,				/*fl_map		*/
+    H5FD_multi_read_vector,			/*read_vector		*/
+    H5FD_multi_write_vector,			/*write_vector		*/
+    NULL					/*map			*/
 };
 
 
@@ -1614,30 +1625,16 @@ H5FD_multi_read(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     size_t size, void *_buf/*out*/)
 {
     H5FD_multi_t	*file = (H5FD_multi_t*)_file;
-    H5FD_mem_t		mt, mmt, hi = H5FD_MEM_DEFAULT;
-    haddr_t		start_addr = 0;
+    H5FD_mem_t		hi;
 
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
     /* Find the file to which this address belongs */
-    for(mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
-	mmt = file->fa.memb_map[mt];
-	if(H5FD_MEM_DEFAULT == mmt)
-            mmt = mt;
-	assert(mmt > 0 && mmt < H5FD_MEM_NTYPES);
-
-	if(file->fa.memb_addr[mmt] > addr)
-            continue;
-	if(file->fa.memb_addr[mmt] >= start_addr) {
-	    start_addr = file->fa.memb_addr[mmt];
-	    hi = mmt;
-	} /* end if */
-    } /* end for */
-    assert(hi > 0);
+    hi = locate_member(file, addr);
 
     /* Read from that member */
-    return H5FDread(file->memb[hi], type, dxpl_id, addr - start_addr, size, _buf);
+    return H5FDread(file->memb[hi], type, dxpl_id, addr - file->fa.memb_addr[hi], size, _buf);
 } /* end H5FD_multi_read() */
 
 
@@ -1662,32 +1659,59 @@ H5FD_multi_write(H5FD_t *_file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr,
     size_t size, const void *_buf)
 {
     H5FD_multi_t	*file = (H5FD_multi_t*)_file;
-    H5FD_mem_t		mt, mmt, hi = H5FD_MEM_DEFAULT;
-    haddr_t		start_addr = 0;
+    H5FD_mem_t		hi;
 
     /* Clear the error stack */
     H5Eclear2(H5E_DEFAULT);
 
     /* Find the file to which this address belongs */
-    for(mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
-	mmt = file->fa.memb_map[mt];
-	if(H5FD_MEM_DEFAULT == mmt)
-            mmt = mt;
-	assert(mmt > 0 && mmt<H5FD_MEM_NTYPES);
-
-	if(file->fa.memb_addr[mmt] > addr)
-            continue;
-	if(file->fa.memb_addr[mmt] >= start_addr) {
-	    start_addr = file->fa.memb_addr[mmt];
-	    hi = mmt;
-	} /* end if */
-    } /* end for */
-    assert(hi > 0);
+    hi = locate_member(file, addr);
 
     /* Write to that member */
-    return H5FDwrite(file->memb[hi], type, dxpl_id, addr - start_addr, size, _buf);
+    return H5FDwrite(file->memb[hi], type, dxpl_id, addr - file->fa.memb_addr[hi], size, _buf);
 } /* end H5FD_multi_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_multi_read_vector
+ *
+ * Purpose:	Reads COUNT extents from FILE into the buffers BUFS, with
+ *		one vector request to each member that holds some of them.
+ *
+ * Return:	Success:	Zero. Result is stored in caller-supplied
+ *				buffers BUFS.
+ *
+ *		Failure:	-1, contents of buffers BUFS are undefined.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_multi_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/)
+{
+    return vector_io((H5FD_multi_t *)_file, dxpl_id, count, types, addrs, sizes, bufs, 0);
+} /* end H5FD_multi_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_multi_write_vector
+ *
+ * Purpose:	Writes COUNT extents to FILE from the buffers BUFS, with
+ *		one vector request to each member that holds some of them.
+ *
+ * Return:	Success:	Zero
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_multi_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    return vector_io((H5FD_multi_t *)_file, dxpl_id, count, types, addrs, sizes, (void **)bufs, 1);
+} /* end H5FD_multi_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5FD_multi_flush
@@ -1994,3 +2018,135 @@ open_members(H5FD_multi_t *file)
  */
 #error "Do not use HDF5 private definitions"
 #endif
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	locate_member
+ *
+ * Purpose:	Finds the member to which address ADDR belongs: the one
+ *		with the highest starting address at or below ADDR.
+ *
+ * Return:	The memory type of the member
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5FD_mem_t
+locate_member(const H5FD_multi_t *file, haddr_t addr)
+{
+    H5FD_mem_t		mt, mmt, hi = H5FD_MEM_DEFAULT;
+    haddr_t		start_addr = 0;
+
+    for(mt = H5FD_MEM_SUPER; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
+	mmt = file->fa.memb_map[mt];
+	if(H5FD_MEM_DEFAULT == mmt)
+            mmt = mt;
+	assert(mmt > 0 && mmt < H5FD_MEM_NTYPES);
+
+	if(file->fa.memb_addr[mmt] > addr)
+            continue;
+	if(file->fa.memb_addr[mmt] >= start_addr) {
+	    start_addr = file->fa.memb_addr[mmt];
+	    hi = mmt;
+	} /* end if */
+    } /* end for */
+    assert(hi > 0);
+
+    return hi;
+} /* end locate_member() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	vector_io
+ *
+ * Purpose:	Reads or writes COUNT extents of FILE.  The extents are
+ *		gathered by member, and each member gets a single vector
+ *		request, so that members whose drivers have vector
+ *		callbacks can batch their extents.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	-1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+vector_io(H5FD_multi_t *file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[],
+    int do_write)
+{
+    H5FD_mem_t		*memb_of = NULL;	/*member of each extent		*/
+    H5FD_mem_t		*memb_types = NULL;	/*extents grouped by member...	*/
+    haddr_t		*memb_addrs = NULL;
+    size_t		*memb_sizes = NULL;
+    void		**memb_bufs = NULL;
+    uint32_t		memb_start[H5FD_MEM_NTYPES];	/*first extent of each member	*/
+    uint32_t		memb_count[H5FD_MEM_NTYPES];	/*# of extents in each member	*/
+    H5FD_mem_t		mt;
+    uint32_t		u, n;
+    herr_t		status = 0;
+    static const char *func="H5FD_multi_vector_io";  /* Function Name for error reporting */
+
+    /* Clear the error stack */
+    H5Eclear2(H5E_DEFAULT);
+
+    if(0 == count)
+        return 0;
+
+    memb_of = (H5FD_mem_t *)malloc(count * sizeof(H5FD_mem_t));
+    memb_types = (H5FD_mem_t *)malloc(count * sizeof(H5FD_mem_t));
+    memb_addrs = (haddr_t *)malloc(count * sizeof(haddr_t));
+    memb_sizes = (size_t *)malloc(count * sizeof(size_t));
+    memb_bufs = (void **)malloc(count * sizeof(void *));
+    if(!memb_of || !memb_types || !memb_addrs || !memb_sizes || !memb_bufs) {
+        free(memb_of);
+        free(memb_types);
+        free(memb_addrs);
+        free(memb_sizes);
+        free(memb_bufs);
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_RESOURCE, H5E_NOSPACE, "memory allocation failed", -1)
+    } /* end if */
+
+    /* Count the extents in each member, then place them in the member's
+     * part of the arrays, with addresses relative to the member.
+     */
+    memset(memb_count, 0, sizeof(memb_count));
+    for(u = 0; u < count; u++) {
+        memb_of[u] = locate_member(file, addrs[u]);
+        memb_count[memb_of[u]]++;
+    } /* end for */
+    for(mt = H5FD_MEM_DEFAULT, n = 0; mt < H5FD_MEM_NTYPES; mt = (H5FD_mem_t)(mt + 1)) {
+        memb_start[mt] = n;
+        n += memb_count[mt];
+        memb_count[mt] = 0;
+    } /* end for */
+    for(u = 0; u < count; u++) {
+        mt = memb_of[u];
+        n = memb_start[mt] + memb_count[mt]++;
+        memb_types[n] = types[u];
+        memb_addrs[n] = addrs[u] - file->fa.memb_addr[mt];
+        memb_sizes[n] = sizes[u];
+        memb_bufs[n] = bufs[u];
+    } /* end for */
+
+    for(mt = H5FD_MEM_DEFAULT; mt < H5FD_MEM_NTYPES && status >= 0; mt = (H5FD_mem_t)(mt + 1)) {
+        if(0 == memb_count[mt])
+            continue;
+        n = memb_start[mt];
+        if(do_write)
+            status = H5FDwrite_vector(file->memb[mt], dxpl_id, memb_count[mt], memb_types + n, memb_addrs + n, memb_sizes + n, (const void **)(memb_bufs + n));
+        else
+            status = H5FDread_vector(file->memb[mt], dxpl_id, memb_count[mt], memb_types + n, memb_addrs + n, memb_sizes + n, memb_bufs + n);
+    } /* end for */
+
+    free(memb_of);
+    free(memb_types);
+    free(memb_addrs);
+    free(memb_sizes);
+    free(memb_bufs);
+
+    if(status < 0)
+        H5Epush_ret(func, H5E_ERR_CLS, H5E_IO, do_write ? H5E_WRITEERROR : H5E_READERROR, "member vector I/O failed", -1)
+
+    return 0;
+} /* end vector_io() */
@@ -48,6 +48,9 @@
 /* Package Private Variables */
 /*****************************/
 
+/* Whether member file I/O fails, for testing */
+H5_DLLVAR hbool_t H5FD_memb_io_fail_g;
+
 
 /******************************/
 /* Package Private Prototypes */
@@ -60,6 +63,15 @@ H5_DLL herr_t H5FD_free_real(H5FD_t *file, hid_t dxpl_id, H5FD_mem_t type,
 /* Testing functions */
 #ifdef H5FD_TESTING
 H5_DLL hbool_t H5FD_supports_swmr_test(const char *vfd_name);
+H5_DLL void H5FD_members_fail_io_test(hbool_t fail);
+#ifdef H5_HAVE_IOURING
+H5_DLL void H5FD_iouring_fail_submit_test(unsigned nsubmit, int err);
+H5_DLL hbool_t H5FD_iouring_idle_test(const H5FD_t *file);
+#endif /* H5_HAVE_IOURING */
+#ifdef H5_HAVE_MMAP
+H5_DLL void H5FD_mmap_max_mapped_test(size_t max_size);
+H5_DLL size_t H5FD_mmap_nmapped_test(const H5FD_t *file);
+#endif /* H5_HAVE_MMAP */
 #endif /* H5FD_TESTING */
 
 #endif /* _H5FDpkg_H */
@@ -96,6 +96,18 @@ typedef struct {
     const void *driver_info;    /* Driver info, for open callbacks */
 } H5FD_driver_prop_t;
 
+/* One member file's part of a request that spans several files, for
+ * H5FD_read_members() and H5FD_write_members()
+ */
+typedef struct H5FD_memb_io_t {
+    H5FD_t      *file;          /* Member file */
+    uint32_t    count;          /* Number of extents in the member */
+    H5FD_mem_t  *types;         /* Memory type of each extent */
+    haddr_t     *addrs;         /* Address of each extent in the member */
+    size_t      *sizes;         /* Size of each extent */
+    void        **bufs;         /* Buffer of each extent */
+} H5FD_memb_io_t;
+
 #ifdef H5_HAVE_PARALLEL
 /* MPIO-specific file access properties */
 typedef struct H5FD_mpio_fapl_t {
@@ -171,6 +183,24 @@ const
 #endif /* H5_DEBUG_BUILD */
 H5P_genplist_t *dxpl, H5FD_mem_t type,
     haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5FD_read_vector(H5FD_t *file,
+#ifndef H5_DEBUG_BUILD
+const
+#endif /* H5_DEBUG_BUILD */
+H5P_genplist_t *dxpl, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], void *bufs[]/*out*/);
+H5_DLL herr_t H5FD_write_vector(H5FD_t *file,
+#ifndef H5_DEBUG_BUILD
+const
+#endif /* H5_DEBUG_BUILD */
+H5P_genplist_t *dxpl, uint32_t count, H5FD_mem_t types[],
+    haddr_t addrs[], size_t sizes[], const void *bufs[]);
+H5_DLL herr_t H5FD_read_members(unsigned nmembs, H5FD_memb_io_t io[],
+    hid_t dxpl_id);
+H5_DLL herr_t H5FD_write_members(unsigned nmembs, H5FD_memb_io_t io[],
+    hid_t dxpl_id);
+H5_DLL herr_t H5FD_map(H5FD_t *file, H5FD_mem_t type, haddr_t addr,
+    size_t size, const void **ptr/*out*/);
 H5_DLL herr_t H5FD_flush(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FD_truncate(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FD_lock(H5FD_t *file, hbool_t rw);
@@ -179,6 +209,7 @@ H5_DLL herr_t H5FD_get_fileno(const H5FD_t *file, unsigned long *filenum);
 H5_DLL herr_t H5FD_get_vfd_handle(H5FD_t *file, hid_t fapl, void** file_handle);
 H5_DLL herr_t H5FD_set_base_addr(H5FD_t *file, haddr_t base_addr);
 H5_DLL haddr_t H5FD_get_base_addr(const H5FD_t *file);
+H5_DLL herr_t H5FD_set_paged_aggr(H5FD_t *file, hbool_t paged);
 
 /* Function prototypes for MPI based VFDs*/
 #ifdef H5_HAVE_PARALLEL
@@ -239,6 +239,13 @@ typedef enum H5F_mem_t	H5FD_mem_t;
      * driver supports the single-writer/multiple-readers I/O pattern.
      */
 #define H5FD_FEAT_SUPPORTS_SWMR_IO      0x00001000
+    /*
+     * Defining H5FD_FEAT_ALIGNED_MEM for a VFL driver means that the driver
+     * sets the 'mem_align' field of the file to the memory alignment that
+     * lets I/O buffers be passed to it without copying.  For drivers that
+     * don't set this flag, the library resets 'mem_align' to 0.
+     */
+#define H5FD_FEAT_ALIGNED_MEM           0x00002000
 
 /* Forward declaration */
 typedef struct H5FD_t H5FD_t;
@@ -282,6 +289,18 @@ typedef struct H5FD_class_t {
     herr_t  (*lock)(H5FD_t *file, hbool_t rw);
     herr_t  (*unlock)(H5FD_t *file);
     H5FD_mem_t fl_map[H5FD_MEM_NTYPES];
+
+    /* Optional callbacks added after 'fl_map', so that drivers written
+     * against the older layout keep their positional initializers.
+     */
+    herr_t  (*read_vector)(H5FD_t *file, hid_t dxpl, uint32_t count,
+                           H5FD_mem_t types[], haddr_t addrs[],
+                           size_t sizes[], void *bufs[]);
+    herr_t  (*write_vector)(H5FD_t *file, hid_t dxpl, uint32_t count,
+                            H5FD_mem_t types[], haddr_t addrs[],
+                            size_t sizes[], const void *bufs[]);
+    herr_t  (*map)(H5FD_t *file, H5FD_mem_t type, haddr_t addr,
+                   size_t size, const void **ptr);
 } H5FD_class_t;
 
 /* A free list is a singly-linked list of address/size pairs. */
@@ -307,6 +326,10 @@ struct H5FD_t {
     /* Space allocation management fields */
     hsize_t             threshold;      /* Threshold for alignment  */
     hsize_t             alignment;      /* Allocation alignment     */
+    hbool_t             paged_aggr;     /* Whether space is allocated in pages */
+
+    /* Memory alignment for I/O buffers (see H5FD_FEAT_ALIGNED_MEM) */
+    size_t              mem_align;      /* Alignment of I/O buffers (0 for none) */
 };
 
 /* Define enum for the source of file image callbacks */
@@ -359,6 +382,14 @@ H5_DLL herr_t H5FDread(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                        haddr_t addr, size_t size, void *buf/*out*/);
 H5_DLL herr_t H5FDwrite(H5FD_t *file, H5FD_mem_t type, hid_t dxpl_id,
                         haddr_t addr, size_t size, const void *buf);
+H5_DLL herr_t H5FDread_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count,
+                              H5FD_mem_t types[], haddr_t addrs[],
+                              size_t sizes[], void *bufs[]/*out*/);
+H5_DLL herr_t H5FDwrite_vector(H5FD_t *file, hid_t dxpl_id, uint32_t count,
+                               H5FD_mem_t types[], haddr_t addrs[],
+                               size_t sizes[], const void *bufs[]);
+H5_DLL herr_t H5FDmap(H5FD_t *file, H5FD_mem_t type, haddr_t addr,
+                      size_t size, const void **ptr/*out*/);
 H5_DLL herr_t H5FDflush(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDtruncate(H5FD_t *file, hid_t dxpl_id, hbool_t closing);
 H5_DLL herr_t H5FDlock(H5FD_t *file, hbool_t rw);
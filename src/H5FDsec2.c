@@ -18,11 +18,10 @@
  *              Thursday, July 29, 1999
  *
  * Purpose: The POSIX unbuffered file driver using only the HDF5 public
- *          API and with a few optimizations: the lseek() call is made
- *          only when the current file position is unknown or needs to be
- *          changed based on previous I/O through this driver (don't mix
- *          I/O from this driver with I/O from other parts of the
- *          application to the same file).
+ *          API.  Where the system provides pread() and pwrite(), all I/O
+ *          is positional and the driver keeps no file position state, so
+ *          no lseek() calls are made at all.  Otherwise each I/O call
+ *          seeks to its address before reading or writing.
  */
 
 #include "H5FDdrvr_module.h" /* This source code file is part of the H5FD driver module */
@@ -43,22 +42,17 @@ static hid_t H5FD_SEC2_g = 0;
 
 /* The description of a file belonging to this driver. The 'eoa' and 'eof'
  * determine the amount of hdf5 address space in use and the high-water mark
- * of the file (the current size of the underlying filesystem file). The
- * 'pos' value is used to eliminate file position updates when they would be a
- * no-op. Unfortunately we've found systems that use separate file position
- * indicators for reading and writing so the lseek can only be eliminated if
- * the current operation is the same as the previous operation.  When opening
- * a file the 'eof' will be set to the current file size, `eoa' will be set
- * to zero, 'pos' will be set to H5F_ADDR_UNDEF (as it is when an error
- * occurs), and 'op' will be set to H5F_OP_UNKNOWN.
+ * of the file (the current size of the underlying filesystem file).  When
+ * opening a file the 'eof' will be set to the current file size and `eoa'
+ * will be set to zero.  The driver doesn't track the current file position:
+ * with pread()/pwrite() each I/O call names its own offset, and without them
+ * each call seeks before doing I/O.
  */
 typedef struct H5FD_sec2_t {
     H5FD_t          pub;    /* public stuff, must be first      */
     int             fd;     /* the filesystem file descriptor   */
     haddr_t         eoa;    /* end of allocated region          */
     haddr_t         eof;    /* end of file; current file size   */
-    haddr_t         pos;    /* current file I/O position        */
-    H5FD_file_op_t  op;     /* last operation                   */
     char            filename[H5FD_MAX_FILENAME_LEN];    /* Copy of file name from open operation */
 #ifndef H5_HAVE_WIN32_API
     /* On most systems the combination of device and i-node number uniquely
@@ -122,6 +116,11 @@ typedef struct H5FD_sec2_t {
                                  HADDR_UNDEF==(A)+(Z) ||                    \
                                 (HDoff_t)((A)+(Z))<(HDoff_t)(A))
 
+/* Maximum number of extents gathered into a single preadv()/pwritev() call.
+ * (Well below the IOV_MAX of any system with these calls.)
+ */
+#define H5FD_SEC2_MAX_IOV   64
+
 /* Prototypes */
 static herr_t H5FD_sec2_term(void);
 static H5FD_t *H5FD_sec2_open(const char *name, unsigned flags, hid_t fapl_id,
@@ -137,6 +136,10 @@ static herr_t H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, hadd
             size_t size, void *buf);
 static herr_t H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t type, hid_t fapl_id, haddr_t addr,
             size_t size, const void *buf);
+static herr_t H5FD_sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[]);
+static herr_t H5FD_sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+            H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[]);
 static herr_t H5FD_sec2_truncate(H5FD_t *_file, hid_t dxpl_id, hbool_t closing);
 static herr_t H5FD_sec2_lock(H5FD_t *_file, hbool_t rw);
 static herr_t H5FD_sec2_unlock(H5FD_t *_file);
@@ -173,7 +176,10 @@ static const H5FD_class_t H5FD_sec2_g = {
     H5FD_sec2_truncate,         /* truncate             */
     H5FD_sec2_lock,             /* lock                 */
     H5FD_sec2_unlock,           /* unlock               */
-    H5FD_FLMAP_DICHOTOMY        /* fl_map               */
+    H5FD_FLMAP_DICHOTOMY,       /* fl_map               */
+    H5FD_sec2_read_vector,      /* read_vector          */
+    H5FD_sec2_write_vector,     /* write_vector         */
+    NULL                        /* map                  */
 };
 
 /* Declare a free list to manage the H5FD_sec2_t struct */
@@ -357,8 +363,6 @@ H5FD_sec2_open(const char *name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
 
     file->fd = fd;
     H5_CHECKED_ASSIGN(file->eof, haddr_t, sb.st_size, h5_stat_size_t);
-    file->pos = HADDR_UNDEF;
-    file->op = OP_UNKNOWN;
 #ifdef H5_HAVE_WIN32_API
     file->hFile = (HANDLE)_get_osfhandle(fd);
     if(INVALID_HANDLE_VALUE == file->hFile)
@@ -683,11 +687,11 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
     if(REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addr)
 
-    /* Seek to the correct location */
-    if(addr != file->pos || OP_READ != file->op) {
-        if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-    } /* end if */
+#ifndef H5_HAVE_PREADWRITE
+    /* Seek to the correct location (if we don't have pread/pwrite) */
+    if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+#endif /* H5_HAVE_PREADWRITE */
 
     /* Read data, being careful of interrupted system calls, partial results,
      * and the end of the file.
@@ -706,15 +710,18 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
             bytes_in = (h5_posix_io_t)size;
 
         do {
+#ifdef H5_HAVE_PREADWRITE
+            bytes_read = HDpread(file->fd, buf, bytes_in, (HDoff_t)addr);
+#else /* H5_HAVE_PREADWRITE */
             bytes_read = HDread(file->fd, buf, bytes_in);
+#endif /* H5_HAVE_PREADWRITE */
         } while(-1 == bytes_read && EINTR == errno);
         
         if(-1 == bytes_read) { /* error */
             int myerrno = errno;
             time_t mytime = HDtime(NULL);
-            HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
 
-            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)myoffset);
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total read size = %llu, bytes this sub-read = %llu, bytes actually read = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_read, (unsigned long long)addr);
         } /* end if */
         
         if(0 == bytes_read) {
@@ -731,17 +738,7 @@ H5FD_sec2_read(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNUS
         buf = (char *)buf + bytes_read;
     } /* end while */
 
-    /* Update current position */
-    file->pos = addr;
-    file->op = OP_READ;
-
 done:
-    if(ret_value < 0) {
-        /* Reset last file I/O information */
-        file->pos = HADDR_UNDEF;
-        file->op = OP_UNKNOWN;
-    } /* end if */
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_read() */
 
@@ -778,11 +775,11 @@ H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
     if(REGION_OVERFLOW(addr, size))
         HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addr, (unsigned long long)size)
 
-    /* Seek to the correct location */
-    if(addr != file->pos || OP_WRITE != file->op) {
-        if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
-            HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
-    } /* end if */
+#ifndef H5_HAVE_PREADWRITE
+    /* Seek to the correct location (if we don't have pread/pwrite) */
+    if(HDlseek(file->fd, (HDoff_t)addr, SEEK_SET) < 0)
+        HSYS_GOTO_ERROR(H5E_IO, H5E_SEEKERROR, FAIL, "unable to seek to proper position")
+#endif /* H5_HAVE_PREADWRITE */
 
     /* Write the data, being careful of interrupted system calls and partial
      * results
@@ -801,15 +798,18 @@ H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
             bytes_in = (h5_posix_io_t)size;
 
         do {
+#ifdef H5_HAVE_PREADWRITE
+            bytes_wrote = HDpwrite(file->fd, buf, bytes_in, (HDoff_t)addr);
+#else /* H5_HAVE_PREADWRITE */
             bytes_wrote = HDwrite(file->fd, buf, bytes_in);
+#endif /* H5_HAVE_PREADWRITE */
         } while(-1 == bytes_wrote && EINTR == errno);
         
         if(-1 == bytes_wrote) { /* error */
             int myerrno = errno;
             time_t mytime = HDtime(NULL);
-            HDoff_t myoffset = HDlseek(file->fd, (HDoff_t)0, SEEK_CUR);
 
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total write size = %llu, bytes this sub-write = %llu, bytes actually written = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_wrote, (unsigned long long)myoffset);
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', buf = %p, total write size = %llu, bytes this sub-write = %llu, bytes actually written = %llu, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), buf, (unsigned long long)size, (unsigned long long)bytes_in, (unsigned long long)bytes_wrote, (unsigned long long)addr);
         } /* end if */
         
         HDassert(bytes_wrote > 0);
@@ -820,22 +820,263 @@ H5FD_sec2_write(H5FD_t *_file, H5FD_mem_t H5_ATTR_UNUSED type, hid_t H5_ATTR_UNU
         buf = (const char *)buf + bytes_wrote;
     } /* end while */
 
-    /* Update current position and eof */
-    file->pos = addr;
-    file->op = OP_WRITE;
-    if(file->pos > file->eof)
-        file->eof = file->pos;
+    /* Update eof */
+    if(addr > file->eof)
+        file->eof = addr;
 
 done:
-    if(ret_value < 0) {
-        /* Reset last file I/O information */
-        file->pos = HADDR_UNDEF;
-        file->op = OP_UNKNOWN;
-    } /* end if */
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5FD_sec2_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_read_vector
+ *
+ * Purpose:     Reads COUNT extents from FILE into the buffers BUFS, according
+ *              to data transfer properties in DXPL_ID.
+ *
+ *              Runs of extents that are adjacent in the file are read with
+ *              a single preadv() call, scattering the data into their
+ *              buffers.  Without preadv(), the extents are read one at a
+ *              time.  As for H5FD_sec2_read(), reading past the end of the
+ *              file returns zeros.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_read_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], void *bufs[] /*out*/)
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+#ifdef H5_HAVE_PREADV
+    struct iovec    iov[H5FD_SEC2_MAX_IOV];     /* I/O vector for a run of extents */
+#endif /* H5_HAVE_PREADV */
+    uint32_t        u;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu", (unsigned long long)addrs[u])
+    } /* end for */
+
+#ifdef H5_HAVE_PREADV
+    u = 0;
+    while(u < count) {
+        haddr_t     addr = addrs[u];    /* File address of the run */
+        size_t      size = 0;           /* Bytes left to read in the run */
+        int         niov = 0;           /* Number of buffers in the run */
+        int         first = 0;          /* First buffer still to be filled */
+
+        /* Extents too large for a single call go through the read callback */
+        if(sizes[u] > H5_POSIX_MAX_IO_BYTES) {
+            if(H5FD_sec2_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+            u++;
+            continue;
+        } /* end if */
+
+        /* Gather the run of adjacent extents starting at this one */
+        do {
+            if(sizes[u] > 0) {
+                iov[niov].iov_base = bufs[u];
+                iov[niov].iov_len = sizes[u];
+                niov++;
+                size += sizes[u];
+            } /* end if */
+            u++;
+        } while(u < count && niov < H5FD_SEC2_MAX_IOV
+                && addrs[u] == addrs[u - 1] + sizes[u - 1]
+                && sizes[u] <= H5_POSIX_MAX_IO_BYTES - size);
+
+        /* Read the run, being careful of interrupted system calls, partial
+         * results, and the end of the file.
+         */
+        while(size > 0) {
+            h5_posix_io_ret_t   bytes_read  = -1;   /* # of bytes actually read */
+
+            do {
+                bytes_read = HDpreadv(file->fd, &iov[first], niov - first, (HDoff_t)addr);
+            } while(-1 == bytes_read && EINTR == errno);
+
+            if(-1 == bytes_read) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file vector read failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', run size = %llu, buffers = %d, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), (unsigned long long)size, niov - first, (unsigned long long)addr);
+            } /* end if */
+
+            if(0 == bytes_read) {
+                /* end of file but not end of format address space */
+                for(; first < niov; first++)
+                    HDmemset(iov[first].iov_base, 0, iov[first].iov_len);
+                break;
+            } /* end if */
+
+            HDassert((size_t)bytes_read <= size);
+            size -= (size_t)bytes_read;
+            addr += (haddr_t)bytes_read;
+
+            /* Skip the buffers that were filled, and advance into a
+             * partially filled one.
+             */
+            while(bytes_read > 0) {
+                if((size_t)bytes_read >= iov[first].iov_len) {
+                    bytes_read -= (h5_posix_io_ret_t)iov[first].iov_len;
+                    first++;
+                } /* end if */
+                else {
+                    iov[first].iov_base = (char *)iov[first].iov_base + bytes_read;
+                    iov[first].iov_len -= (size_t)bytes_read;
+                    bytes_read = 0;
+                } /* end else */
+            } /* end while */
+        } /* end while */
+    } /* end while */
+
+#else /* H5_HAVE_PREADV */
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0)
+            if(H5FD_sec2_read(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "file read failed")
+#endif /* H5_HAVE_PREADV */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_read_vector() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5FD_sec2_write_vector
+ *
+ * Purpose:     Writes COUNT extents to FILE from the buffers BUFS, according
+ *              to data transfer properties in DXPL_ID.
+ *
+ *              Runs of extents that are adjacent in the file are written
+ *              with a single pwritev() call, gathering the data from their
+ *              buffers.  Without pwritev(), the extents are written one at
+ *              a time.
+ *
+ * Return:      SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5FD_sec2_write_vector(H5FD_t *_file, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    H5FD_sec2_t     *file       = (H5FD_sec2_t *)_file;
+#ifdef H5_HAVE_PWRITEV
+    struct iovec    iov[H5FD_SEC2_MAX_IOV];     /* I/O vector for a run of extents */
+#endif /* H5_HAVE_PWRITEV */
+    uint32_t        u;                          /* Local index variable */
+    herr_t          ret_value   = SUCCEED;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(file && file->pub.cls);
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    /* Check for overflow conditions */
+    for(u = 0; u < count; u++) {
+        if(!H5F_addr_defined(addrs[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "addr undefined, addr = %llu", (unsigned long long)addrs[u])
+        if(REGION_OVERFLOW(addrs[u], sizes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_OVERFLOW, FAIL, "addr overflow, addr = %llu, size = %llu", (unsigned long long)addrs[u], (unsigned long long)sizes[u])
+    } /* end for */
+
+#ifdef H5_HAVE_PWRITEV
+    u = 0;
+    while(u < count) {
+        haddr_t     addr = addrs[u];    /* File address of the run */
+        size_t      size = 0;           /* Bytes left to write in the run */
+        int         niov = 0;           /* Number of buffers in the run */
+        int         first = 0;          /* First buffer still to be written */
+
+        /* Extents too large for a single call go through the write callback */
+        if(sizes[u] > H5_POSIX_MAX_IO_BYTES) {
+            if(H5FD_sec2_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+            u++;
+            continue;
+        } /* end if */
+
+        /* Gather the run of adjacent extents starting at this one */
+        do {
+            if(sizes[u] > 0) {
+                iov[niov].iov_base = (void *)bufs[u];
+                iov[niov].iov_len = sizes[u];
+                niov++;
+                size += sizes[u];
+            } /* end if */
+            u++;
+        } while(u < count && niov < H5FD_SEC2_MAX_IOV
+                && addrs[u] == addrs[u - 1] + sizes[u - 1]
+                && sizes[u] <= H5_POSIX_MAX_IO_BYTES - size);
+
+        /* Write the run, being careful of interrupted system calls and
+         * partial results
+         */
+        while(size > 0) {
+            h5_posix_io_ret_t   bytes_wrote = -1;   /* # of bytes written */
+
+            do {
+                bytes_wrote = HDpwritev(file->fd, &iov[first], niov - first, (HDoff_t)addr);
+            } while(-1 == bytes_wrote && EINTR == errno);
+
+            if(-1 == bytes_wrote) { /* error */
+                int myerrno = errno;
+                time_t mytime = HDtime(NULL);
+
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file vector write failed: time = %s, filename = '%s', file descriptor = %d, errno = %d, error message = '%s', run size = %llu, buffers = %d, offset = %llu", HDctime(&mytime), file->filename, file->fd, myerrno, HDstrerror(myerrno), (unsigned long long)size, niov - first, (unsigned long long)addr);
+            } /* end if */
+
+            HDassert(bytes_wrote > 0);
+            HDassert((size_t)bytes_wrote <= size);
+            size -= (size_t)bytes_wrote;
+            addr += (haddr_t)bytes_wrote;
+
+            /* Skip the buffers that were written, and advance into a
+             * partially written one.
+             */
+            while(bytes_wrote > 0) {
+                if((size_t)bytes_wrote >= iov[first].iov_len) {
+                    bytes_wrote -= (h5_posix_io_ret_t)iov[first].iov_len;
+                    first++;
+                } /* end if */
+                else {
+                    iov[first].iov_base = (char *)iov[first].iov_base + bytes_wrote;
+                    iov[first].iov_len -= (size_t)bytes_wrote;
+                    bytes_wrote = 0;
+                } /* end else */
+            } /* end while */
+        } /* end while */
+
+        /* Update eof */
+        if(addr > file->eof)
+            file->eof = addr;
+    } /* end while */
+
+#else /* H5_HAVE_PWRITEV */
+    for(u = 0; u < count; u++)
+        if(sizes[u] > 0)
+            if(H5FD_sec2_write(_file, types[u], dxpl_id, addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+#endif /* H5_HAVE_PWRITEV */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5FD_sec2_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5FD_sec2_truncate
@@ -895,10 +1136,6 @@ H5FD_sec2_truncate(H5FD_t *_file, hid_t H5_ATTR_UNUSED dxpl_id, hbool_t H5_ATTR_
 
         /* Update the eof value */
         file->eof = file->eoa;
-
-        /* Reset last file I/O information */
-        file->pos = HADDR_UNDEF;
-        file->op = OP_UNKNOWN;
     } /* end if */
 
 done:
@@ -118,8 +118,9 @@ H5FD_extend(H5FD_t *file, H5FD_mem_t type, hbool_t new_block, hsize_t size, hadd
     eoa = file->cls->get_eoa(file, type);
 
     /* Compute extra space to allocate, if this is a new block and should be aligned */
+    /* (Files that allocate space in pages align it themselves) */
     extra = 0;
-    if(new_block && file->alignment > 1 && orig_size >= file->threshold) {
+    if(new_block && !file->paged_aggr && file->alignment > 1 && orig_size >= file->threshold) {
         hsize_t mis_align;              /* Amount EOA is misaligned */
 
         /* Check for EOA already aligned */
@@ -148,7 +149,7 @@ H5FD_extend(H5FD_t *file, H5FD_mem_t type, hbool_t new_block, hsize_t size, hadd
         HGOTO_ERROR(H5E_VFL, H5E_NOSPACE, HADDR_UNDEF, "file allocation request failed")
 
     /* Post-condition sanity check */
-    if(new_block && file->alignment && orig_size >= file->threshold)
+    if(new_block && !file->paged_aggr && file->alignment && orig_size >= file->threshold)
 	HDassert(!(ret_value % file->alignment));
 
 done:
@@ -116,3 +116,27 @@ H5FD_supports_swmr_test(const char *vfd_name)
     
 } /* end H5FD_supports_swmr_test() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5FD_members_fail_io_test()
+ *
+ * Purpose:	Makes the I/O on the member files of a driver that splits
+ *		requests over members (see H5FD_read_members()) fail when
+ *		FAIL is TRUE, and succeed again when it is FALSE.
+ *
+ *              This function is only intended for use in the test code.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5FD_members_fail_io_test(hbool_t fail)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    H5FD_memb_io_fail_g = fail;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5FD_members_fail_io_test() */
+
@@ -23,6 +23,12 @@
  *                      cache small metadata I/Os and group them into a
  *                      single larger I/O)
  *
+ *                      A file has several accumulators, each holding a
+ *                      separate region of the file, so that metadata
+ *                      accessed in turn at different places (a B-tree and
+ *                      a fractal heap, say) doesn't keep flushing and
+ *                      moving a single accumulator.
+ *
  *-------------------------------------------------------------------------
  */
 
@@ -72,6 +78,8 @@ typedef enum {
 /********************/
 /* Local Prototypes */
 /********************/
+static herr_t H5F__accum_select(const H5F_io_info_t *fio_info, H5FD_mem_t map_type,
+    haddr_t addr, size_t size, hbool_t create, H5F_meta_accum_t **accum_p);
 
 
 /*********************/
@@ -92,6 +100,118 @@ typedef enum {
 H5FL_BLK_DEFINE_STATIC(meta_accum);
 
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F__accum_select
+ *
+ * Purpose:	Picks the metadata accumulator for an access of SIZE bytes
+ *              at ADDR, and moves it to the front of the file's
+ *              accumulators, which are kept in most recently used order.
+ *
+ *              An accumulator that the access overlaps, or else one that
+ *              it adjoins, is picked.  If there is none and CREATE is set, one is picked
+ *              to start over with the access: an unused one, or else the
+ *              least recently used one holding the same type of metadata
+ *              (so that one type of metadata can't push out all the
+ *              others), or else the least recently used one.  Otherwise
+ *              *ACCUM_P is set to NULL.
+ *
+ *              The accumulators never overlap, so any other accumulator
+ *              that the access overlaps is flushed and emptied.
+ *
+ *              When the file is open for SWMR writing, only the first
+ *              accumulator is picked and all others are flushed and
+ *              emptied, so that metadata reaches the file in the order
+ *              it was written and readers never see a child missing.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5F__accum_select(const H5F_io_info_t *fio_info, H5FD_mem_t map_type,
+    haddr_t addr, size_t size, hbool_t create, H5F_meta_accum_t **accum_p)
+{
+    H5F_meta_accum_t *accums;           /* Alias for file's metadata accumulators */
+    unsigned    naccum;                 /* Number of accumulators that can be picked */
+    unsigned    idx = H5F_NUM_META_ACCUM; /* Index of the accumulator picked */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+    HDassert(accum_p);
+
+    /* Set up alias for file's metadata accumulators */
+    accums = fio_info->f->shared->accum;
+
+    /* Keep to a single accumulator for SWMR writes, to preserve write order */
+    naccum = (H5F_INTENT(fio_info->f) & H5F_ACC_SWMR_WRITE) ? 1 : H5F_NUM_META_ACCUM;
+
+    /* Look for an accumulator that the access overlaps, or else one it adjoins */
+    for(u = 0; u < naccum && idx == H5F_NUM_META_ACCUM; u++)
+        if(accums[u].size > 0 && H5F_addr_overlap(addr, size, accums[u].loc, accums[u].size))
+            idx = u;
+    for(u = 0; u < naccum && idx == H5F_NUM_META_ACCUM; u++)
+        if(accums[u].size > 0 && ((addr + size) == accums[u].loc
+                || (accums[u].loc + accums[u].size) == addr))
+            idx = u;
+
+    /* Pick an accumulator to start over with, if requested */
+    if(idx == H5F_NUM_META_ACCUM && create) {
+        for(u = naccum; u > 0 && idx == H5F_NUM_META_ACCUM; u--)
+            if(0 == accums[u - 1].size)
+                idx = u - 1;
+        for(u = naccum; u > 0 && idx == H5F_NUM_META_ACCUM; u--)
+            if(map_type == accums[u - 1].type)
+                idx = u - 1;
+        if(idx == H5F_NUM_META_ACCUM)
+            idx = naccum - 1;
+
+        accums[idx].type = map_type;
+    } /* end if */
+
+    if(idx < H5F_NUM_META_ACCUM) {
+        H5F_meta_accum_t tmp_accum;     /* Accumulator being moved to the front */
+
+        /* Flush and empty any other accumulators the access overlaps (or
+         * all of them, for SWMR writes)
+         */
+        for(u = 0; u < H5F_NUM_META_ACCUM; u++)
+            if(u != idx && accums[u].size > 0 && (naccum == 1 || H5F_addr_overlap(addr, size, accums[u].loc, accums[u].size))) {
+                if(accums[u].dirty) {
+                    /* Write out the dirty region of the accumulator, with dispatch to driver */
+                    if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, accums[u].loc + accums[u].dirty_off, accums[u].dirty_len, accums[u].buf + accums[u].dirty_off) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+                    /* Reset accumulator dirty flag */
+                    accums[u].dirty = FALSE;
+                } /* end if */
+
+                /* Empty the accumulator, but keep its buffer */
+                accums[u].loc = HADDR_UNDEF;
+                accums[u].size = 0;
+            } /* end if */
+
+        /* Move the accumulator to the front */
+        if(idx > 0) {
+            tmp_accum = accums[idx];
+            HDmemmove(accums + 1, accums, idx * sizeof(H5F_meta_accum_t));
+            accums[0] = tmp_accum;
+        } /* end if */
+
+        *accum_p = &accums[0];
+    } /* end if */
+    else
+        *accum_p = NULL;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F__accum_select() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_read
@@ -115,6 +235,7 @@ herr_t
 H5F__accum_read(const H5F_io_info_t *fio_info, H5FD_mem_t map_type, haddr_t addr,
     size_t size, void *buf/*out*/)
 {
+    unsigned    u;                      /* Local index variable */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -128,17 +249,16 @@ H5F__accum_read(const H5F_io_info_t *fio_info, H5FD_mem_t map_type, haddr_t addr
     if((fio_info->f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
         H5F_meta_accum_t *accum;     /* Alias for file's metadata accumulator */
 
-        /* Set up alias for file's metadata accumulator info */
-        accum = &fio_info->f->shared->accum;
-
         if(size < H5F_ACCUM_MAX_SIZE) {
+            /* Look for the metadata accumulator the read adjoins or overlaps */
+            if(H5F__accum_select(fio_info, map_type, addr, size, FALSE, &accum) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "can't select metadata accumulator")
+
             /* Sanity check */
-            HDassert(!accum->buf || (accum->alloc_size >= accum->size));
+            HDassert(!accum || !accum->buf || (accum->alloc_size >= accum->size));
 
             /* Current read adjoins or overlaps with metadata accumulator */
-            if(H5F_addr_overlap(addr, size, accum->loc, accum->size)
-                    || ((addr + size) == accum->loc)
-                    || (accum->loc + accum->size) == addr) {
+            if(accum) {
                 size_t amount_before;       /* Amount to read before current accumulator */
                 haddr_t new_addr;           /* New address of the accumulator buffer */
                 size_t new_size;            /* New size of the accumulator buffer */
@@ -215,42 +335,47 @@ H5F__accum_read(const H5F_io_info_t *fio_info, H5FD_mem_t map_type, haddr_t addr
             if(H5FD_read(fio_info->f->shared->lf, fio_info->dxpl, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "driver read request failed")
 
-            /* Check for overlap w/dirty accumulator */
+            /* Check for overlap w/dirty accumulators */
             /* (Note that this could be improved by updating the non-dirty
              *  information in the accumulator with [some of] the information
              *  just read in. -QAK)
              */
-            if(accum->dirty &&
-                    H5F_addr_overlap(addr, size, accum->loc + accum->dirty_off, accum->dirty_len)) {
-                haddr_t dirty_loc = accum->loc + accum->dirty_off;  /* File offset of dirty information */
-                size_t buf_off;         /* Offset of dirty region in buffer */
-                size_t dirty_off;       /* Offset within dirty region */
-                size_t overlap_size;    /* Size of overlap with dirty region */
-
-                /* Check for read starting before beginning dirty region */
-                if(H5F_addr_le(addr, dirty_loc)) {
-                    /* Compute offset of dirty region within buffer */
-                    buf_off = (size_t)(dirty_loc - addr);
-
-                    /* Compute offset within dirty region */
-                    dirty_off = 0;
-
-                    /* Check for read ending within dirty region */
-                    if(H5F_addr_lt(addr + size, dirty_loc + accum->dirty_len))
-                        overlap_size = (size_t)((addr + size) - buf_off);
-                    else        /* Access covers whole dirty region */
-                        overlap_size = accum->dirty_len;
-                } /* end if */
-                else { /* Read starts after beginning of dirty region */
-                    /* Compute dirty offset within buffer and overlap size */
-                    buf_off = 0;
-                    dirty_off = (size_t)(addr - dirty_loc);
-                    overlap_size = (size_t)((dirty_loc + accum->dirty_len) - addr);
-                } /* end else */
+            for(u = 0; u < H5F_NUM_META_ACCUM; u++) {
+                /* Set up alias for metadata accumulator info */
+                accum = &fio_info->f->shared->accum[u];
+
+                if(accum->dirty &&
+                        H5F_addr_overlap(addr, size, accum->loc + accum->dirty_off, accum->dirty_len)) {
+                    haddr_t dirty_loc = accum->loc + accum->dirty_off;  /* File offset of dirty information */
+                    size_t buf_off;         /* Offset of dirty region in buffer */
+                    size_t dirty_off;       /* Offset within dirty region */
+                    size_t overlap_size;    /* Size of overlap with dirty region */
+
+                    /* Check for read starting before beginning dirty region */
+                    if(H5F_addr_le(addr, dirty_loc)) {
+                        /* Compute offset of dirty region within buffer */
+                        buf_off = (size_t)(dirty_loc - addr);
+
+                        /* Compute offset within dirty region */
+                        dirty_off = 0;
+
+                        /* Check for read ending within dirty region */
+                        if(H5F_addr_lt(addr + size, dirty_loc + accum->dirty_len))
+                            overlap_size = (size_t)((addr + size) - buf_off);
+                        else        /* Access covers whole dirty region */
+                            overlap_size = accum->dirty_len;
+                    } /* end if */
+                    else { /* Read starts after beginning of dirty region */
+                        /* Compute dirty offset within buffer and overlap size */
+                        buf_off = 0;
+                        dirty_off = (size_t)(addr - dirty_loc);
+                        overlap_size = (size_t)((dirty_loc + accum->dirty_len) - addr);
+                    } /* end else */
 
-                /* Copy the dirty region to buffer */
-                HDmemcpy((unsigned char *)buf + buf_off, (unsigned char *)accum->buf + accum->dirty_off + dirty_off, overlap_size);
-            } /* end if */
+                    /* Copy the dirty region to buffer */
+                    HDmemcpy((unsigned char *)buf + buf_off, (unsigned char *)accum->buf + accum->dirty_off + dirty_off, overlap_size);
+                } /* end if */
+            } /* end for */
         } /* end else */
     } /* end if */
     else {
@@ -420,6 +545,7 @@ herr_t
 H5F__accum_write(const H5F_io_info_t *fio_info, H5FD_mem_t map_type, haddr_t addr,
     size_t size, const void *buf)
 {
+    unsigned    u;                      /* Local index variable */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -434,10 +560,11 @@ H5F__accum_write(const H5F_io_info_t *fio_info, H5FD_mem_t map_type, haddr_t add
     if((fio_info->f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && map_type != H5FD_MEM_DRAW) {
         H5F_meta_accum_t *accum;     /* Alias for file's metadata accumulator */
 
-        /* Set up alias for file's metadata accumulator info */
-        accum = &fio_info->f->shared->accum;
-
         if(size < H5F_ACCUM_MAX_SIZE) {
+            /* Pick the metadata accumulator to write into */
+            if(H5F__accum_select(fio_info, map_type, addr, size, TRUE, &accum) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "can't select metadata accumulator")
+
             /* Sanity check */
             HDassert(!accum->buf || (accum->alloc_size >= accum->size));
 
@@ -635,7 +762,9 @@ H5F__accum_write(const H5F_io_info_t *fio_info, H5FD_mem_t map_type, haddr_t add
                 } /* end if */
                 /* New piece of metadata doesn't adjoin or overlap the existing accumulator */
                 else {
-                    /* Write out the existing metadata accumulator, with dispatch to driver */
+                    /* Write out the existing metadata accumulator (the least
+                     * recently used one), with dispatch to driver
+                     */
                     if(accum->dirty) {
                         if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off, accum->dirty_len, accum->buf + accum->dirty_off) < 0)
                             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
@@ -736,19 +865,65 @@ H5F__accum_write(const H5F_io_info_t *fio_info, H5FD_mem_t map_type, haddr_t add
             if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, map_type, addr, size, buf) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
 
-            /* Check for overlap w/accumulator */
+            /* Check for overlap w/accumulators */
             /* (Note that this could be improved by updating the accumulator
              *  with [some of] the information just read in. -QAK)
              */
-            if(H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
-                /* Check for write starting before beginning of accumulator */
-                if(H5F_addr_le(addr, accum->loc)) {
-                    /* Check for write ending within accumulator */
-                    if(H5F_addr_le(addr + size, accum->loc + accum->size)) {
+            for(u = 0; u < H5F_NUM_META_ACCUM; u++) {
+                /* Set up alias for metadata accumulator info */
+                accum = &fio_info->f->shared->accum[u];
+
+                if(accum->size > 0 && H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
+                    /* Check for write starting before beginning of accumulator */
+                    if(H5F_addr_le(addr, accum->loc)) {
+                        /* Check for write ending within accumulator */
+                        if(H5F_addr_le(addr + size, accum->loc + accum->size)) {
+                            size_t overlap_size;    /* Size of overlapping region */
+
+                            /* Compute overlap size */
+                            overlap_size = (size_t)((addr + size) - accum->loc);
+
+                            /* Check for dirty region */
+                            if(accum->dirty) {
+                                haddr_t dirty_start = accum->loc + accum->dirty_off;    /* File address of start of dirty region */
+                                haddr_t dirty_end = dirty_start + accum->dirty_len;               /* File address of end of dirty region */
+
+                                /* Check if entire dirty region is overwritten */
+                                if(H5F_addr_le(dirty_end, addr + size)) {
+                                    accum->dirty = FALSE;
+                                    accum->dirty_len = 0;
+                                } /* end if */
+                                else {
+                                    /* Check for dirty region falling after write */
+                                    if(H5F_addr_le(addr + size, dirty_start))
+                                        accum->dirty_off = overlap_size;
+                                    else {    /* Dirty region overlaps w/written region */
+                                        accum->dirty_off = 0;
+                                        accum->dirty_len -= (size_t)((addr + size) - dirty_start);
+                                    } /* end else */
+                                } /* end if */
+                            } /* end if */
+
+                            /* Trim bottom of accumulator off */
+                            accum->loc += overlap_size;
+                            accum->size -= overlap_size;
+                            HDmemmove(accum->buf, accum->buf + overlap_size, accum->size);
+                        } /* end if */
+                        else {        /* Access covers whole accumulator */
+                            /* Empty accumulator, but don't flush */
+                            accum->loc = HADDR_UNDEF;
+                            accum->size = 0;
+                            accum->dirty = FALSE;
+                        } /* end else */
+                    } /* end if */
+                    else {  /* Write starts after beginning of accumulator */
                         size_t overlap_size;    /* Size of overlapping region */
 
+                        /* Sanity check */
+                        HDassert(H5F_addr_gt(addr + size, accum->loc + accum->size));
+
                         /* Compute overlap size */
-                        overlap_size = (size_t)((addr + size) - accum->loc);
+                        overlap_size = (size_t)((accum->loc + accum->size) - addr);
 
                         /* Check for dirty region */
                         if(accum->dirty) {
@@ -756,64 +931,24 @@ H5F__accum_write(const H5F_io_info_t *fio_info, H5FD_mem_t map_type, haddr_t add
                             haddr_t dirty_end = dirty_start + accum->dirty_len;               /* File address of end of dirty region */
 
                             /* Check if entire dirty region is overwritten */
-                            if(H5F_addr_le(dirty_end, addr + size)) {
+                            if(H5F_addr_ge(dirty_start, addr)) {
                                 accum->dirty = FALSE;
                                 accum->dirty_len = 0;
                             } /* end if */
                             else {
-                                /* Check for dirty region falling after write */
-                                if(H5F_addr_le(addr + size, dirty_start))
-                                    accum->dirty_off = overlap_size;
-                                else {    /* Dirty region overlaps w/written region */
-                                    accum->dirty_off = 0;
-                                    accum->dirty_len -= (size_t)((addr + size) - dirty_start);
-                                } /* end else */
+                                /* Check for dirty region falling before write */
+                                if(H5F_addr_le(dirty_end, addr))
+                                    ; /* noop */
+                                else    /* Dirty region overlaps w/written region */
+                                    accum->dirty_len = (size_t)(addr - dirty_start);
                             } /* end if */
                         } /* end if */
 
-                        /* Trim bottom of accumulator off */
-                        accum->loc += overlap_size;
+                        /* Trim top of accumulator off */
                         accum->size -= overlap_size;
-                        HDmemmove(accum->buf, accum->buf + overlap_size, accum->size);
-                    } /* end if */
-                    else {        /* Access covers whole accumulator */
-                        /* Reset accumulator, but don't flush */
-                        if(H5F__accum_reset(fio_info, FALSE) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_CANTRESET, FAIL, "can't reset accumulator")
                     } /* end else */
                 } /* end if */
-                else {  /* Write starts after beginning of accumulator */
-                    size_t overlap_size;    /* Size of overlapping region */
-
-                    /* Sanity check */
-                    HDassert(H5F_addr_gt(addr + size, accum->loc + accum->size));
-
-                    /* Compute overlap size */
-                    overlap_size = (size_t)((accum->loc + accum->size) - addr);
-
-                    /* Check for dirty region */
-                    if(accum->dirty) {
-                        haddr_t dirty_start = accum->loc + accum->dirty_off;    /* File address of start of dirty region */
-                        haddr_t dirty_end = dirty_start + accum->dirty_len;               /* File address of end of dirty region */
-
-                        /* Check if entire dirty region is overwritten */
-                        if(H5F_addr_ge(dirty_start, addr)) {
-                            accum->dirty = FALSE;
-                            accum->dirty_len = 0;
-                        } /* end if */
-                        else {
-                            /* Check for dirty region falling before write */
-                            if(H5F_addr_le(dirty_end, addr))
-                                ; /* noop */
-                            else    /* Dirty region overlaps w/written region */
-                                accum->dirty_len = (size_t)(addr - dirty_start);
-                        } /* end if */
-                    } /* end if */
-
-                    /* Trim top of accumulator off */
-                    accum->size -= overlap_size;
-                } /* end else */
-            } /* end if */
+            } /* end for */
         } /* end else */
     } /* end if */
     else {
@@ -846,6 +981,7 @@ H5F__accum_free(const H5F_io_info_t *fio_info, H5FD_mem_t H5_ATTR_UNUSED type, h
     hsize_t size)
 {
     H5F_meta_accum_t *accum;            /* Alias for file's metadata accumulator */
+    unsigned u;                         /* Local index variable */
     herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -855,137 +991,140 @@ H5F__accum_free(const H5F_io_info_t *fio_info, H5FD_mem_t H5_ATTR_UNUSED type, h
     HDassert(fio_info->f);
     HDassert(fio_info->dxpl);
 
-    /* Set up alias for file's metadata accumulator info */
-    accum = &fio_info->f->shared->accum;
-
-    /* Adjust the metadata accumulator to remove the freed block, if it overlaps */
-    if((fio_info->f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)
-            && H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
-        size_t overlap_size;        /* Size of overlap with accumulator */
-
-        /* Sanity check */
-        /* (The metadata accumulator should not intersect w/raw data */
-        HDassert(H5FD_MEM_DRAW != type);
-        HDassert(H5FD_MEM_GHEAP != type); /* (global heap data is being treated as raw data currently) */
-
-        /* Check for overlapping the beginning of the accumulator */
-        if(H5F_addr_le(addr, accum->loc)) {
-            /* Check for completely overlapping the accumulator */
-            if(H5F_addr_ge(addr + size, accum->loc + accum->size)) {
-                /* Reset the accumulator, but don't free buffer */
-                accum->loc = HADDR_UNDEF;
-                accum->size = 0;
-                accum->dirty = FALSE;
-            } /* end if */
-            /* Block to free must end within the accumulator */
-            else {
-                size_t new_accum_size;      /* Size of new accumulator buffer */
-
-                /* Calculate the size of the overlap with the accumulator, etc. */
-                H5_CHECKED_ASSIGN(overlap_size, size_t, (addr + size) - accum->loc, haddr_t);
-                new_accum_size = accum->size - overlap_size;
+    /* Adjust the metadata accumulators to remove the freed block */
+    if(fio_info->f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA)
+        for(u = 0; u < H5F_NUM_META_ACCUM; u++) {
+            /* Set up alias for metadata accumulator info */
+            accum = &fio_info->f->shared->accum[u];
 
-                /* Move the accumulator buffer information to eliminate the freed block */
-                HDmemmove(accum->buf, accum->buf + overlap_size, new_accum_size);
+            /* Adjust the metadata accumulator to remove the freed block, if it overlaps */
+            if(accum->size > 0 && H5F_addr_overlap(addr, size, accum->loc, accum->size)) {
+                size_t overlap_size;        /* Size of overlap with accumulator */
 
-                /* Adjust the accumulator information */
-                accum->loc += overlap_size;
-                accum->size = new_accum_size;
+                /* Sanity check */
+                /* (The metadata accumulator should not intersect w/raw data */
+                HDassert(H5FD_MEM_DRAW != type);
+                HDassert(H5FD_MEM_GHEAP != type); /* (global heap data is being treated as raw data currently) */
 
-                /* Adjust the dirty region and possibly mark accumulator clean */
-                if(accum->dirty) {
-                    /* Check if block freed is entirely before dirty region */
-                    if(overlap_size < accum->dirty_off)
-                        accum->dirty_off -= overlap_size;
+                /* Check for overlapping the beginning of the accumulator */
+                if(H5F_addr_le(addr, accum->loc)) {
+                    /* Check for completely overlapping the accumulator */
+                    if(H5F_addr_ge(addr + size, accum->loc + accum->size)) {
+                        /* Reset the accumulator, but don't free buffer */
+                        accum->loc = HADDR_UNDEF;
+                        accum->size = 0;
+                        accum->dirty = FALSE;
+                    } /* end if */
+                    /* Block to free must end within the accumulator */
                     else {
-                        /* Check if block freed ends within dirty region */
-                        if(overlap_size < (accum->dirty_off + accum->dirty_len)) {
-                            accum->dirty_len = (accum->dirty_off + accum->dirty_len) - overlap_size;
-                            accum->dirty_off = 0;
+                        size_t new_accum_size;      /* Size of new accumulator buffer */
+
+                        /* Calculate the size of the overlap with the accumulator, etc. */
+                        H5_CHECKED_ASSIGN(overlap_size, size_t, (addr + size) - accum->loc, haddr_t);
+                        new_accum_size = accum->size - overlap_size;
+
+                        /* Move the accumulator buffer information to eliminate the freed block */
+                        HDmemmove(accum->buf, accum->buf + overlap_size, new_accum_size);
+
+                        /* Adjust the accumulator information */
+                        accum->loc += overlap_size;
+                        accum->size = new_accum_size;
+
+                        /* Adjust the dirty region and possibly mark accumulator clean */
+                        if(accum->dirty) {
+                            /* Check if block freed is entirely before dirty region */
+                            if(overlap_size < accum->dirty_off)
+                                accum->dirty_off -= overlap_size;
+                            else {
+                                /* Check if block freed ends within dirty region */
+                                if(overlap_size < (accum->dirty_off + accum->dirty_len)) {
+                                    accum->dirty_len = (accum->dirty_off + accum->dirty_len) - overlap_size;
+                                    accum->dirty_off = 0;
+                                } /* end if */
+                                /* Block freed encompasses dirty region */
+                                else
+                                    accum->dirty = FALSE;
+                            } /* end else */
                         } /* end if */
-                        /* Block freed encompasses dirty region */
-                        else
-                            accum->dirty = FALSE;
                     } /* end else */
                 } /* end if */
-            } /* end else */
-        } /* end if */
-        /* Block to free must start within the accumulator */
-        else {
-            haddr_t dirty_end = accum->loc + accum->dirty_off + accum->dirty_len;
-            haddr_t dirty_start = accum->loc + accum->dirty_off;
-
-            /* Calculate the size of the overlap with the accumulator */
-            H5_CHECKED_ASSIGN(overlap_size, size_t, (accum->loc + accum->size) - addr, haddr_t);
-
-            /* Check if block to free begins before end of dirty region */
-            if(accum->dirty && H5F_addr_lt(addr, dirty_end)) {
-                haddr_t tail_addr;
+                /* Block to free must start within the accumulator */
+                else {
+                    haddr_t dirty_end = accum->loc + accum->dirty_off + accum->dirty_len;
+                    haddr_t dirty_start = accum->loc + accum->dirty_off;
+
+                    /* Calculate the size of the overlap with the accumulator */
+                    H5_CHECKED_ASSIGN(overlap_size, size_t, (accum->loc + accum->size) - addr, haddr_t);
+
+                    /* Check if block to free begins before end of dirty region */
+                    if(accum->dirty && H5F_addr_lt(addr, dirty_end)) {
+                        haddr_t tail_addr;
+
+                        /* Calculate the address of the tail to write */
+                        tail_addr = addr + size;
+
+                        /* Check if the block to free begins before dirty region */
+                        if(H5F_addr_lt(addr, dirty_start)) {
+                            /* Check if block to free is entirely before dirty region */
+                            if(H5F_addr_le(tail_addr, dirty_start)) {
+                                /* Write out the entire dirty region of the accumulator */
+                                if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, dirty_start, accum->dirty_len, accum->buf + accum->dirty_off) < 0)
+                                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                            } /* end if */
+                            /* Block to free overlaps with some/all of dirty region */
+                            /* Check for unfreed dirty region to write */
+                            else if(H5F_addr_lt(tail_addr, dirty_end)) {
+                                size_t write_size;
+                                size_t dirty_delta;
 
-                /* Calculate the address of the tail to write */
-                tail_addr = addr + size;
+                                write_size = (size_t)(dirty_end - tail_addr);
+                                dirty_delta = accum->dirty_len - write_size;
 
-                /* Check if the block to free begins before dirty region */
-                if(H5F_addr_lt(addr, dirty_start)) {
-                    /* Check if block to free is entirely before dirty region */
-                    if(H5F_addr_le(tail_addr, dirty_start)) {
-                        /* Write out the entire dirty region of the accumulator */
-                        if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, dirty_start, accum->dirty_len, accum->buf + accum->dirty_off) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-                    } /* end if */
-                    /* Block to free overlaps with some/all of dirty region */
-                    /* Check for unfreed dirty region to write */
-                    else if(H5F_addr_lt(tail_addr, dirty_end)) {
-                        size_t write_size;
-                        size_t dirty_delta;
+                                HDassert(write_size > 0);
 
-                        write_size = (size_t)(dirty_end - tail_addr);
-                        dirty_delta = accum->dirty_len - write_size;
+                                /* Write out the unfreed dirty region of the accumulator */
+                                if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size, accum->buf + accum->dirty_off + dirty_delta) < 0)
+                                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                            } /* end if */
 
-                        HDassert(write_size > 0);
+                            /* Reset dirty flag */
+                            accum->dirty = FALSE;
+                        } /* end if */
+                        /* Block to free begins at beginning of or in middle of dirty region */
+                        else {
+                            /* Check if block to free ends before end of dirty region */
+                            if(H5F_addr_lt(tail_addr, dirty_end)) {
+                                size_t write_size;
+                                size_t dirty_delta;
 
-                        /* Write out the unfreed dirty region of the accumulator */
-                        if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size, accum->buf + accum->dirty_off + dirty_delta) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
-                    } /* end if */
+                                write_size = (size_t)(dirty_end - tail_addr);
+                                dirty_delta = accum->dirty_len - write_size;
 
-                    /* Reset dirty flag */
-                    accum->dirty = FALSE;
-                } /* end if */
-                /* Block to free begins at beginning of or in middle of dirty region */
-                else {
-                    /* Check if block to free ends before end of dirty region */
-                    if(H5F_addr_lt(tail_addr, dirty_end)) {
-                        size_t write_size;
-                        size_t dirty_delta;
+                                HDassert(write_size > 0);
 
-                        write_size = (size_t)(dirty_end - tail_addr);
-                        dirty_delta = accum->dirty_len - write_size;
+                                /* Write out the unfreed end of the dirty region of the accumulator */
+                                if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size, accum->buf + accum->dirty_off + dirty_delta) < 0)
+                                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+                            } /* end if */
 
-                        HDassert(write_size > 0);
+                            /* Check for block to free beginning at same location as dirty region */
+                            if(H5F_addr_eq(addr, dirty_start)) {
+                                /* Reset dirty flag */
+                                accum->dirty = FALSE;
+                            } /* end if */
+                            /* Block to free eliminates end of dirty region */
+                            else {
+                                accum->dirty_len = (size_t)(addr - dirty_start);
+                            } /* end else */
+                        } /* end else */
 
-                        /* Write out the unfreed end of the dirty region of the accumulator */
-                        if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, dirty_start + dirty_delta, write_size, accum->buf + accum->dirty_off + dirty_delta) < 0)
-                            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
                     } /* end if */
 
-                    /* Check for block to free beginning at same location as dirty region */
-                    if(H5F_addr_eq(addr, dirty_start)) {
-                        /* Reset dirty flag */
-                        accum->dirty = FALSE;
-                    } /* end if */
-                    /* Block to free eliminates end of dirty region */
-                    else {
-                        accum->dirty_len = (size_t)(addr - dirty_start);
-                    } /* end else */
+                    /* Adjust the accumulator information */
+                    accum->size = accum->size - overlap_size;
                 } /* end else */
-
             } /* end if */
-
-            /* Adjust the accumulator information */
-            accum->size = accum->size - overlap_size;
-        } /* end else */
-    } /* end if */
+        } /* end for */
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -995,7 +1134,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_flush
  *
- * Purpose:	Flush the metadata accumulator to the file
+ * Purpose:	Flush the metadata accumulators to the file, in address
+ *              order
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1016,14 +1156,29 @@ H5F__accum_flush(const H5F_io_info_t *fio_info)
     HDassert(fio_info->f);
     HDassert(fio_info->dxpl);
 
-    /* Check if we need to flush out the metadata accumulator */
-    if((fio_info->f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) && fio_info->f->shared->accum.dirty) {
-        /* Flush the metadata contents */
-        if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, fio_info->f->shared->accum.loc + fio_info->f->shared->accum.dirty_off, fio_info->f->shared->accum.dirty_len, fio_info->f->shared->accum.buf + fio_info->f->shared->accum.dirty_off) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+    /* Check if we need to flush out the metadata accumulators */
+    if(fio_info->f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) {
+        H5F_meta_accum_t *accum;        /* Dirty accumulator with the lowest address */
 
-        /* Reset the dirty flag */
-        fio_info->f->shared->accum.dirty = FALSE;
+        do {
+            unsigned u;                 /* Local index variable */
+
+            /* Find the next dirty accumulator */
+            accum = NULL;
+            for(u = 0; u < H5F_NUM_META_ACCUM; u++)
+                if(fio_info->f->shared->accum[u].dirty && (NULL == accum
+                        || H5F_addr_lt(fio_info->f->shared->accum[u].loc, accum->loc)))
+                    accum = &fio_info->f->shared->accum[u];
+
+            if(accum) {
+                /* Flush the metadata contents */
+                if(H5FD_write(fio_info->f->shared->lf, fio_info->dxpl, H5FD_MEM_DEFAULT, accum->loc + accum->dirty_off, accum->dirty_len, accum->buf + accum->dirty_off) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "file write failed")
+
+                /* Reset the dirty flag */
+                accum->dirty = FALSE;
+            } /* end if */
+        } while(accum);
     } /* end if */
 
 done:
@@ -1034,7 +1189,7 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5F__accum_reset
  *
- * Purpose:	Reset the metadata accumulator for the file
+ * Purpose:	Reset the metadata accumulators for the file
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -1062,18 +1217,24 @@ H5F__accum_reset(const H5F_io_info_t *fio_info, hbool_t flush)
 
     /* Check if we need to reset the metadata accumulator information */
     if(fio_info->f->shared->feature_flags & H5FD_FEAT_ACCUMULATE_METADATA) {
-        /* Sanity check */
-        HDassert(!fio_info->f->closing || FALSE == fio_info->f->shared->accum.dirty);
-
-        /* Free the buffer */
-        if(fio_info->f->shared->accum.buf)
-            fio_info->f->shared->accum.buf = H5FL_BLK_FREE(meta_accum, fio_info->f->shared->accum.buf);
-
-        /* Reset the buffer sizes & location */
-        fio_info->f->shared->accum.alloc_size = fio_info->f->shared->accum.size = 0;
-        fio_info->f->shared->accum.loc = HADDR_UNDEF;
-        fio_info->f->shared->accum.dirty = FALSE;
-        fio_info->f->shared->accum.dirty_len = 0;
+        unsigned u;                     /* Local index variable */
+
+        for(u = 0; u < H5F_NUM_META_ACCUM; u++) {
+            H5F_meta_accum_t *accum = &fio_info->f->shared->accum[u];  /* Alias for metadata accumulator info */
+
+            /* Sanity check */
+            HDassert(!fio_info->f->closing || FALSE == accum->dirty);
+
+            /* Free the buffer */
+            if(accum->buf)
+                accum->buf = H5FL_BLK_FREE(meta_accum, accum->buf);
+
+            /* Reset the buffer sizes & location */
+            accum->alloc_size = accum->size = 0;
+            accum->loc = HADDR_UNDEF;
+            accum->dirty = FALSE;
+            accum->dirty_len = 0;
+        } /* end for */
     } /* end if */
 
 done:
@@ -599,7 +599,8 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
         f->shared->sohm_vers = HDF5_SHAREDHEADER_VERSION;
         for(u = 0; u < NELMTS(f->shared->fs_addr); u++)
             f->shared->fs_addr[u] = HADDR_UNDEF;
-        f->shared->accum.loc = HADDR_UNDEF;
+        for(u = 0; u < NELMTS(f->shared->accum); u++)
+            f->shared->accum[u].loc = HADDR_UNDEF;
         f->shared->lf = lf;
 
         /*
@@ -623,6 +624,13 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get file space strategy")
         if(H5P_get(plist, H5F_CRT_FREE_SPACE_THRESHOLD_NAME, &f->shared->fs_threshold) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get free-space section threshold")
+        if(H5P_get(plist, H5F_CRT_FILE_SPACE_PAGE_SIZE_NAME, &f->shared->fs_page_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get file space page size")
+
+        /* Allocate file space from the VFD in pages, for paged aggregation */
+        if(H5F_PAGED_AGGR(f))
+            if(H5FD_set_paged_aggr(lf, TRUE) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTSET, NULL, "can't set paged aggregation for file driver")
 
         /* Get the FAPL values to cache */
         if(NULL == (plist = (H5P_genplist_t *)H5I_object(fapl_id)))
@@ -652,6 +660,10 @@ H5F_new(H5F_file_t *shared, unsigned flags, hid_t fcpl_id, hid_t fapl_id, H5FD_t
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'use mdc logging' flag")
         if(H5P_get(plist, H5F_ACS_START_MDC_LOG_ON_ACCESS_NAME, &(f->shared->start_mdc_log_on_access)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get 'start mdc log on access' flag")
+        if(H5P_get(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, &(f->shared->mdc_log_format)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get mdc log format")
+        if(H5P_get(plist, H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_NAME, &(f->shared->mdc_log_sample_interval)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get mdc log sample interval")
         if(H5P_get(plist, H5F_ACS_META_BLOCK_SIZE_NAME, &(f->shared->meta_aggr.alloc_size)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get metadata cache size")
         f->shared->meta_aggr.feature_flag = H5FD_FEAT_AGGREGATE_METADATA;
@@ -994,6 +1006,9 @@ H5F_dest(H5F_t *f, hid_t dxpl_id, hbool_t flush)
             HDONE_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
 
         /* Destroy other components of the file */
+        if(H5PB_dest(&fio_info) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
         if(H5F__accum_reset(&fio_info, TRUE) < 0)
             /* Push error, but keep going*/
             HDONE_ERROR(H5E_FILE, H5E_CANTRELEASE, FAIL, "problems closing file")
@@ -1322,6 +1337,40 @@ H5F_open(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_id,
     if(NULL == (a_plist = (H5P_genplist_t *)H5I_object(fapl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, NULL, "not file access property list")
 
+    /* Set up the page buffer.  This is done once the superblock has been
+     * read (or initialized), so that pages are loaded up to the file's
+     * real EOA.
+     */
+    if(1 == shared->nrefs) {
+        size_t page_buf_size;           /* Size of page buffer */
+
+        if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_SIZE_NAME, &page_buf_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get page buffer size")
+        if(page_buf_size) {
+            size_t page_size;           /* Size of pages */
+            unsigned min_meta_perc;     /* Percentage of pages reserved for metadata */
+            unsigned min_raw_perc;      /* Percentage of pages reserved for raw data */
+
+            if(H5F_HAS_FEATURE(file, H5FD_FEAT_HAS_MPI))
+                HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, NULL, "page buffering is not supported with parallel I/O")
+            if(H5F_INTENT(file) & (H5F_ACC_SWMR_WRITE | H5F_ACC_SWMR_READ))
+                HGOTO_ERROR(H5E_FILE, H5E_UNSUPPORTED, NULL, "can't have both SWMR and page buffering")
+
+            if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, &page_size) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get page buffer page size")
+            if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, &min_meta_perc) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get percentage of page buffer reserved for metadata")
+            if(H5P_get(a_plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &min_raw_perc) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, NULL, "can't get percentage of page buffer reserved for raw data")
+            /* Match the pages of files that allocate space in pages */
+            if(0 == page_size)
+                page_size = H5F_PAGED_AGGR(file) ? (size_t)file->shared->fs_page_size : H5PB_DEFAULT_PAGE_SIZE;
+
+            if(H5PB_create(file, page_size, page_buf_size, min_meta_perc, min_raw_perc) < 0)
+                HGOTO_ERROR(H5E_FILE, H5E_CANTINIT, NULL, "unable to create page buffer")
+        } /* end if */
+    } /* end if */
+
     /*
      * Decide the file close degree.  If it's the first time to open the
      * file, set the degree to access property list value; if it's the
@@ -1521,6 +1570,11 @@ H5F__flush_phase2(H5F_t *f, hid_t dxpl_id, hbool_t closing)
         /* Push error, but keep going*/
         HDONE_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
 
+    /* Flush out the page buffer */
+    if(H5PB_flush(&fio_info) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush page buffer")
+
     /* Flush out the metadata accumulator */
     if(H5F__accum_flush(&fio_info) < 0)
         /* Push error, but keep going*/
@@ -129,14 +129,70 @@ HDfprintf(stderr, "%s: read from addr = %a, size = %Zu\n", FUNC, addr, size);
     if(NULL == (fio_info.dxpl = (H5P_genplist_t *)H5I_object(my_dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
 
-    /* Pass through metadata accumulator layer */
-    if(H5F__accum_read(&fio_info, map_type, addr, size, buf) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through metadata accumulator failed")
+    /* Pass through page buffer layer */
+    if(H5PB_read(&fio_info, map_type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through page buffer failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_map
+ *
+ * Purpose:	Sets *PTR to the address of SIZE contiguous bytes of the
+ *		file at ADDR (relative to the base address for the file),
+ *		when the file driver exposes the file in memory.  The
+ *		memory is read-only and only stays valid until the next
+ *		read or map on the file, so callers can use it in place of
+ *		a copy read with H5F_block_read(), but can't hold on to it.
+ *
+ *		*PTR is set to NULL when the region can't be used in place:
+ *		the driver can't expose it, or the file is open for writing
+ *		or SWMR reading (and so the file may be stale with respect
+ *		to the library's buffers).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_map(const H5F_t *f, H5FD_mem_t type, haddr_t addr, size_t size,
+    const void **ptr/*out*/)
+{
+    H5FD_mem_t  map_type;               /* Mapped memory type */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(ptr);
+    HDassert(H5F_addr_defined(addr));
+
+    *ptr = NULL;
+
+    /* Only files open read-only (and not being written by a SWMR writer)
+     * are used in place */
+    if(H5F_INTENT(f) & (H5F_ACC_RDWR | H5F_ACC_SWMR_READ))
+        HGOTO_DONE(SUCCEED)
+
+    /* Check for attempting I/O on 'temporary' file address */
+    if(H5F_addr_le(f->shared->tmp_addr, (addr + size)))
+        HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+
+    /* Treat global heap as raw data */
+    map_type = (type == H5FD_MEM_GHEAP) ? H5FD_MEM_DRAW : type;
+
+    /* Pass through to the file driver */
+    if(H5FD_map(f->shared->lf, map_type, addr, size, ptr) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "unable to map file region")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_map() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_block_write
@@ -191,14 +247,86 @@ HDfprintf(stderr, "%s: write to addr = %a, size = %Zu\n", FUNC, addr, size);
     if(NULL == (fio_info.dxpl = (H5P_genplist_t *)H5I_object(my_dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
 
-    /* Pass through metadata accumulator layer */
-    if(H5F__accum_write(&fio_info, map_type, addr, size, buf) < 0)
-        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through metadata accumulator failed")
+    /* Pass through page buffer layer */
+    if(H5PB_write(&fio_info, map_type, addr, size, buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5F_block_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_block_write_vector
+ *
+ * Purpose:	Writes COUNT blocks of metadata from memory to a file in
+ *		one request: block I is SIZES[I] bytes of memory type
+ *		TYPES[I] at address ADDRS[I] (relative to the base
+ *		address), written from BUFS[I].  The blocks must not
+ *		overlap, and can't be raw data or global heap blocks.
+ *
+ *		Without a page buffer, the blocks are dropped from the
+ *		metadata accumulators, which would otherwise hold stale
+ *		copies of them, and passed to the file driver as one
+ *		vector write.  With a page buffer, each block is written
+ *		through it as for H5F_block_write(), to keep the pages it
+ *		holds up to date.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5F_block_write_vector(const H5F_t *f, hid_t dxpl_id, uint32_t count,
+    H5FD_mem_t types[], haddr_t addrs[], size_t sizes[], const void *bufs[])
+{
+    H5F_io_info_t fio_info;             /* I/O info for operation */
+    uint32_t    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(H5F_INTENT(f) & H5F_ACC_RDWR);
+    HDassert(0 == count || (types && addrs && sizes && bufs));
+
+    for(u = 0; u < count; u++) {
+        HDassert(H5FD_MEM_DRAW != types[u] && H5FD_MEM_GHEAP != types[u]);
+        HDassert(H5F_addr_defined(addrs[u]));
+        HDassert(bufs[u]);
+
+        /* Check for attempting I/O on 'temporary' file address */
+        if(H5F_addr_le(f->shared->tmp_addr, (addrs[u] + sizes[u])))
+            HGOTO_ERROR(H5E_IO, H5E_BADRANGE, FAIL, "attempting I/O in temporary file space")
+    } /* end for */
+
+    /* Set up I/O info for operation */
+    fio_info.f = f;
+    if(NULL == (fio_info.dxpl = (H5P_genplist_t *)H5I_object(dxpl_id)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
+
+    if(f->shared->page_buf) {
+        /* Pass each block through the page buffer layer */
+        for(u = 0; u < count; u++)
+            if(H5PB_write(&fio_info, types[u], addrs[u], sizes[u], bufs[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through page buffer failed")
+    } /* end if */
+    else {
+        /* Drop the blocks from the metadata accumulators */
+        for(u = 0; u < count; u++)
+            if(H5F__accum_free(&fio_info, types[u], addrs[u], (hsize_t)sizes[u]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_CANTFREE, FAIL, "can't remove blocks from metadata accumulator")
+
+        /* Write the blocks, with dispatch to driver */
+        if(H5FD_write_vector(f->shared->lf, fio_info.dxpl, count, types, addrs, sizes, bufs) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "vector write failed")
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5F_block_write_vector() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5F_flush_tagged_metadata
@@ -231,6 +359,9 @@ H5F_flush_tagged_metadata(H5F_t * f, haddr_t tag, hid_t dxpl_id)
     if(NULL == (fio_info.dxpl = (H5P_genplist_t *)H5I_object(dxpl_id)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't get property list")
     
+    /* Flush the page buffer */
+    if(H5PB_flush(&fio_info) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush page buffer")
 
     /* Flush and reset the accumulator */
     if(H5F__accum_reset(&fio_info, TRUE) < 0)
@@ -42,6 +42,7 @@
 #include "H5FSprivate.h"	/* File free space                      */
 #include "H5Gprivate.h"		/* Groups 			  	*/
 #include "H5Oprivate.h"         /* Object header messages               */
+#include "H5PBprivate.h"        /* Page buffer                          */
 #include "H5UCprivate.h"	/* Reference counted object functions	*/
 
 
@@ -69,7 +70,19 @@
 /* Macro to abstract checking whether file is using a free space manager */
 #define H5F_HAVE_FREE_SPACE_MANAGER(F)  \
     ((F)->shared->fs_strategy == H5F_FILE_SPACE_ALL ||                        \
-            (F)->shared->fs_strategy == H5F_FILE_SPACE_ALL_PERSIST)
+            (F)->shared->fs_strategy == H5F_FILE_SPACE_ALL_PERSIST ||         \
+            (F)->shared->fs_strategy == H5F_FILE_SPACE_PAGE)
+
+/* Macro to abstract checking whether the free space managers are persistent */
+#define H5F_HAVE_PERSISTENT_FREE_SPACE(F)  \
+    ((F)->shared->fs_strategy == H5F_FILE_SPACE_ALL_PERSIST ||                \
+            (F)->shared->fs_strategy == H5F_FILE_SPACE_PAGE)
+
+/* Macro to abstract checking whether file space is allocated in pages */
+#define H5F_PAGED_AGGR(F)  ((F)->shared->fs_strategy == H5F_FILE_SPACE_PAGE)
+
+/* Number of metadata accumulators for a file */
+#define H5F_NUM_META_ACCUM              4
 
 /* Macros for encoding/decoding superblock */
 #define H5F_MAX_DRVINFOBLOCK_SIZE  1024         /* Maximum size of superblock driver info buffer */
@@ -198,6 +211,7 @@ typedef struct H5F_meta_accum_t {
     size_t              dirty_off;      /* Offset of the dirty region in the accumulator buffer */
     size_t              dirty_len;      /* Length of the dirty region in the accumulator buffer */
     hbool_t             dirty;          /* Flag to indicate that the accumulated metadata is dirty */
+    H5FD_mem_t          type;           /* Type of the metadata the accumulator was started with */
 } H5F_meta_accum_t;
 
 /* Enum for free space manager state */
@@ -297,6 +311,8 @@ struct H5F_file_t {
     hbool_t     start_mdc_log_on_access; /* set when mdc logging should  */
                                 /* begin on file access/create          */
     char        *mdc_log_location; /* location of mdc log               */
+    H5AC_log_format_t mdc_log_format; /* format of mdc log              */
+    unsigned    mdc_log_sample_interval; /* log 1 in this many entries  */
     hid_t       fcpl_id;	/* File creation property list ID 	*/
     H5F_close_degree_t fc_degree;   /* File close behavior degree	*/
     hbool_t evict_on_close; /* If the file's objects should be evicted from the metadata cache on close */
@@ -318,6 +334,7 @@ struct H5F_file_t {
     /* File space allocation information */
     H5F_file_space_type_t fs_strategy;	/* File space handling strategy		*/
     hsize_t     fs_threshold;	/* Free space section threshold 	*/
+    hsize_t     fs_page_size;	/* File space page size (for paged aggregation) */
     hbool_t     use_tmp_space;  /* Whether temp. file space allocation is allowed */
     haddr_t	tmp_addr;       /* Next address to use for temp. space in the file */
     unsigned fs_aggr_merge[H5FD_MEM_NTYPES];    /* Flags for whether free space can merge with aggregator(s) */
@@ -331,7 +348,10 @@ struct H5F_file_t {
                                 /* (if aggregating "small data" allocations) */
 
     /* Metadata accumulator information */
-    H5F_meta_accum_t accum;     /* Metadata accumulator info           	*/
+    H5F_meta_accum_t accum[H5F_NUM_META_ACCUM]; /* Metadata accumulators, most recently used first */
+
+    /* Page buffer information */
+    H5PB_t      *page_buf;      /* Page buffer, or NULL if not enabled  */
 
     /* Metadata retry info */
     unsigned 		read_attempts;	/* The # of reads to try when reading metadata with checksum */
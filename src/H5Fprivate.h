@@ -290,6 +290,7 @@
 #define H5F_DRIVER_ID(F)        ((F)->shared->lf->driver_id)
 #define H5F_GET_FILENO(F,FILENUM) ((FILENUM) = (F)->shared->lf->fileno)
 #define H5F_HAS_FEATURE(F,FL)   ((F)->shared->lf->feature_flags & (FL))
+#define H5F_MEM_ALIGN(F)        ((F)->shared->lf->mem_align)
 #define H5F_BASE_ADDR(F)        ((F)->shared->sblock->base_addr)
 #define H5F_SYM_LEAF_K(F)       ((F)->shared->sblock->sym_leaf_k)
 #define H5F_KVALUE(F,T)         ((F)->shared->sblock->btree_k[(T)->id])
@@ -324,6 +325,8 @@
 #define H5F_USE_MDC_LOGGING(F)  ((F)->shared->use_mdc_logging)
 #define H5F_START_MDC_LOG_ON_ACCESS(F)  ((F)->shared->start_mdc_log_on_access)
 #define H5F_MDC_LOG_LOCATION(F) ((F)->shared->mdc_log_location)
+#define H5F_MDC_LOG_FORMAT(F)   ((F)->shared->mdc_log_format)
+#define H5F_MDC_LOG_SAMPLE_INTERVAL(F) ((F)->shared->mdc_log_sample_interval)
 #else /* H5F_MODULE */
 #define H5F_INTENT(F)           (H5F_get_intent(F))
 #define H5F_OPEN_NAME(F)        (H5F_get_open_name(F))
@@ -341,6 +344,7 @@
 #define H5F_DRIVER_ID(F)        (H5F_get_driver_id(F))
 #define H5F_GET_FILENO(F,FILENUM) (H5F_get_fileno((F), &(FILENUM)))
 #define H5F_HAS_FEATURE(F,FL)   (H5F_has_feature(F,FL))
+#define H5F_MEM_ALIGN(F)        (H5F_mem_align(F))
 #define H5F_BASE_ADDR(F)        (H5F_get_base_addr(F))
 #define H5F_SYM_LEAF_K(F)       (H5F_sym_leaf_k(F))
 #define H5F_KVALUE(F,T)         (H5F_Kvalue(F,T))
@@ -375,6 +379,8 @@
 #define H5F_USE_MDC_LOGGING(F)  (H5F_use_mdc_logging(F))
 #define H5F_START_MDC_LOG_ON_ACCESS(F)  (H5F_start_mdc_log_on_access(F))
 #define H5F_MDC_LOG_LOCATION(F) (H5F_mdc_log_location(F))
+#define H5F_MDC_LOG_FORMAT(F)   (H5F_mdc_log_format(F))
+#define H5F_MDC_LOG_SAMPLE_INTERVAL(F) (H5F_mdc_log_sample_interval(F))
 #endif /* H5F_MODULE */
 
 
@@ -449,6 +455,7 @@
 #define H5F_CRT_SHMSG_BTREE_MIN_NAME "shmsg_btree_min"  /* Shared message B-tree minimum size */
 #define H5F_CRT_FILE_SPACE_STRATEGY_NAME "file_space_strategy"  /* File space handling strategy */
 #define H5F_CRT_FREE_SPACE_THRESHOLD_NAME "free_space_threshold"  /* Free space section threshold */
+#define H5F_CRT_FILE_SPACE_PAGE_SIZE_NAME "file_space_page_size"  /* File space page size for paged aggregation */
 
 
 
@@ -479,11 +486,19 @@
 #define H5F_ACS_USE_MDC_LOGGING_NAME            "use_mdc_logging" /* Whether to use metadata cache logging */
 #define H5F_ACS_MDC_LOG_LOCATION_NAME           "mdc_log_location" /* Name of metadata cache log location */
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_NAME    "start_mdc_log_on_access" /* Whether logging starts on file create/open */
+#define H5F_ACS_MDC_LOG_FORMAT_NAME             "mdc_log_format" /* Format of metadata cache log */
+#define H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_NAME    "mdc_log_sample_interval" /* Sampling interval of binary metadata cache log */
 #define H5F_ACS_CORE_WRITE_TRACKING_FLAG_NAME   "core_write_tracking_flag" /* Whether or not core VFD backing store write tracking is enabled */
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_NAME        "evict_on_close_flag" /* Whether or not the metadata cache will evict objects on close */
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_NAME "core_write_tracking_page_size" /* The page size in kiB when core VFD write tracking is enabled */
+#define H5F_ACS_CORE_MMAP_FLAG_NAME             "core_mmap_flag" /* Whether or not the core VFD maps existing files instead of reading them */
+#define H5F_ACS_CORE_WRITE_BACK_FLAG_NAME       "core_write_back_flag" /* Whether or not the core VFD maps files shared, for background write-back */
 #define H5F_ACS_COLL_MD_WRITE_FLAG_NAME         "collective_metadata_write" /* property indicating whether metadata writes are done collectively or not */
 #define H5F_ACS_META_CACHE_INIT_IMAGE_CONFIG_NAME "mdc_initCacheImageCfg" /* Initial metadata cache image creation configuration */
+#define H5F_ACS_PAGE_BUFFER_SIZE_NAME           "page_buffer_size" /* Size of the page buffer, or 0 to disable it */
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME      "page_buffer_page_size" /* Size of the pages in the page buffer */
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME  "page_buffer_min_meta_perc" /* Percentage of the page buffer reserved for metadata */
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME   "page_buffer_min_raw_perc" /* Percentage of the page buffer reserved for raw data */
 
 /* ======================== File Mount properties ====================*/
 #define H5F_MNT_SYM_LOCAL_NAME 		"local"                 /* Whether absolute symlinks local to file. */
@@ -525,6 +540,9 @@
 #define H5F_FILE_SPACE_STRATEGY_DEF	        H5F_FILE_SPACE_ALL
 /* Default free space section threshold used by free-space managers */
 #define H5F_FREE_SPACE_THRESHOLD_DEF	        1
+/* Default and minimum file space page size for paged aggregation */
+#define H5F_FILE_SPACE_PAGE_SIZE_DEF	        4096
+#define H5F_FILE_SPACE_PAGE_SIZE_MIN	        512
 
 /* Metadata read attempt values */
 #define H5F_METADATA_READ_ATTEMPTS		1	/* Default # of read attempts for non-SWMR access */
@@ -711,11 +729,14 @@ H5_DLL void H5F_set_coll_md_read(H5F_t *f, H5P_coll_md_read_flag_t flag);
 H5_DLL hbool_t H5F_use_mdc_logging(const H5F_t *f);
 H5_DLL hbool_t H5F_start_mdc_log_on_access(const H5F_t *f);
 H5_DLL char *H5F_mdc_log_location(const H5F_t *f);
+H5_DLL H5AC_log_format_t H5F_mdc_log_format(const H5F_t *f);
+H5_DLL unsigned H5F_mdc_log_sample_interval(const H5F_t *f);
 
 /* Functions that retrieve values from VFD layer */
 H5_DLL hid_t H5F_get_driver_id(const H5F_t *f);
 H5_DLL herr_t H5F_get_fileno(const H5F_t *f, unsigned long *filenum);
 H5_DLL hbool_t H5F_has_feature(const H5F_t *f, unsigned feature);
+H5_DLL size_t H5F_mem_align(const H5F_t *f);
 H5_DLL haddr_t H5F_get_eoa(const H5F_t *f, H5FD_mem_t type);
 H5_DLL herr_t H5F_get_vfd_handle(const H5F_t *file, hid_t fapl, void **file_handle);
 
@@ -730,6 +751,11 @@ H5_DLL herr_t H5F_block_read(const H5F_t *f, H5FD_mem_t type, haddr_t addr,
                 size_t size, hid_t dxpl_id, void *buf/*out*/);
 H5_DLL herr_t H5F_block_write(const H5F_t *f, H5FD_mem_t type, haddr_t addr,
                 size_t size, hid_t dxpl_id, const void *buf);
+H5_DLL herr_t H5F_block_write_vector(const H5F_t *f, hid_t dxpl_id,
+                uint32_t count, H5FD_mem_t types[], haddr_t addrs[],
+                size_t sizes[], const void *bufs[]);
+H5_DLL herr_t H5F_block_map(const H5F_t *f, H5FD_mem_t type, haddr_t addr,
+                size_t size, const void **ptr/*out*/);
 
 /* Functions that flush or evict */
 H5_DLL herr_t H5F_flush_tagged_metadata(H5F_t * f, haddr_t tag, hid_t dxpl_id);
@@ -189,6 +189,7 @@ typedef enum H5F_file_space_type_t {
 				    /* This is the library default */
     H5F_FILE_SPACE_AGGR_VFD = 3,    /* Aggregators, Virtual file driver */
     H5F_FILE_SPACE_VFD = 4,	    /* Virtual file driver */
+    H5F_FILE_SPACE_PAGE = 5,	    /* Persistent free space managers, paged aggregation, virtual file driver */
     H5F_FILE_SPACE_NTYPES	    /* must be last */
 } H5F_file_space_type_t;
 
@@ -239,6 +240,12 @@ H5_DLL herr_t H5Fget_mdc_size(hid_t file_id,
                               size_t * cur_size_ptr,
                               int * cur_num_entries_ptr);
 H5_DLL herr_t H5Freset_mdc_hit_rate_stats(hid_t file_id);
+H5_DLL ssize_t H5Fget_mdc_stats(hid_t file_id, size_t nstats,
+                                H5AC_cache_type_stats_t *stats/*out*/);
+H5_DLL herr_t H5Freset_mdc_stats(hid_t file_id);
+H5_DLL herr_t H5Fget_page_buffering_stats(hid_t file_id, unsigned accesses[2],
+    unsigned hits[2], unsigned misses[2], unsigned evictions[2], unsigned bypasses[2]);
+H5_DLL herr_t H5Freset_page_buffering_stats(hid_t file_id);
 H5_DLL ssize_t H5Fget_name(hid_t obj_id, char *name, size_t size);
 H5_DLL herr_t H5Fget_info2(hid_t obj_id, H5F_info2_t *finfo);
 H5_DLL herr_t H5Fget_metadata_read_retry_info(hid_t file_id, H5F_retry_info_t *info);
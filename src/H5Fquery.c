@@ -939,6 +939,33 @@ H5F_has_feature(const H5F_t *f, unsigned feature)
     FUNC_LEAVE_NOAPI((hbool_t)(f->shared->lf->feature_flags&feature))
 } /* end H5F_has_feature() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mem_align
+ *
+ * Purpose:	Retrieve the alignment the file's driver wants for memory
+ *              buffers used in I/O, so that they can be transferred
+ *              without copying.
+ *
+ * Return:	Success:	The memory alignment, or 0 if the driver
+ *                              has none
+ * 		Failure:	(should not happen)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5F_mem_align(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(f->shared->lf);
+
+    FUNC_LEAVE_NOAPI(f->shared->lf->mem_align)
+} /* end H5F_mem_align() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5F_get_driver_id
@@ -1235,3 +1262,53 @@ H5F_mdc_log_location(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->mdc_log_location)
 } /* end H5F_mdc_log_location() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdc_log_format
+ *
+ * Purpose:	Quick and dirty routine to retrieve the MDC log format
+ *		for this file.
+ *          (Mainly added to stop non-file routines from poking about in the
+ *          H5F_t data structure)
+ *
+ * Return:	The MDC log format on success/abort on failure (shouldn't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+H5AC_log_format_t
+H5F_mdc_log_format(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->mdc_log_format)
+} /* end H5F_mdc_log_format() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5F_mdc_log_sample_interval
+ *
+ * Purpose:	Quick and dirty routine to retrieve the sampling interval
+ *		of the MDC log for this file.
+ *          (Mainly added to stop non-file routines from poking about in the
+ *          H5F_t data structure)
+ *
+ * Return:	The sampling interval on success/abort on failure (shouldn't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+H5F_mdc_log_sample_interval(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(f->shared->mdc_log_sample_interval)
+} /* end H5F_mdc_log_sample_interval() */
+
@@ -685,6 +685,17 @@ H5F__super_read(H5F_t *f, hid_t dxpl_id, hbool_t initial_read)
 		if(H5P_set(c_plist, H5F_CRT_FREE_SPACE_THRESHOLD_NAME, &fsinfo.threshold) < 0)
 		    HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to set file space strategy")
 	    } /* end if */
+	    if(fsinfo.strategy == H5F_FILE_SPACE_PAGE) {
+		f->shared->fs_page_size = fsinfo.page_size;
+
+		/* Set the file's page size in the property list */
+		if(H5P_set(c_plist, H5F_CRT_FILE_SPACE_PAGE_SIZE_NAME, &fsinfo.page_size) < 0)
+		    HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to set file space page size")
+
+		/* Allocate file space from the VFD in pages */
+		if(H5FD_set_paged_aggr(f->shared->lf, TRUE) < 0)
+		    HGOTO_ERROR(H5E_FILE, H5E_CANTSET, FAIL, "unable to set paged aggregation for file driver")
+	    } /* end if */
 
 	    /* Set free-space manager addresses */
 	    f->shared->fs_addr[0] = HADDR_UNDEF;
@@ -1112,6 +1123,7 @@ H5F__super_init(H5F_t *f, hid_t dxpl_id)
 	    /* Write free-space manager info message to superblock extension object header if needed */
 	    fsinfo.strategy = f->shared->fs_strategy;
 	    fsinfo.threshold = f->shared->fs_threshold;
+	    fsinfo.page_size = f->shared->fs_page_size;
 	    for(type = H5FD_MEM_SUPER; type < H5FD_MEM_NTYPES; H5_INC_ENUM(H5FD_mem_t, type))
                 fsinfo.fs_addr[type-1] = HADDR_UNDEF;
 
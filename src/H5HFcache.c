@@ -175,7 +175,7 @@ const H5AC_class_t H5AC_FHEAP_DBLOCK[1] = {{
     H5AC_FHEAP_DBLOCK_ID,               /* Metadata client ID */
     "fractal heap direct block",        /* Metadata client name (for debugging) */
     H5FD_MEM_FHEAP_DBLOCK,              /* File space memory type for client */
-    H5AC__CLASS_NO_FLAGS_SET,           /* Client class behavior flags */
+    H5AC__CLASS_MODIFIES_IMAGE_FLAG,    /* Client class behavior flags */
     H5HF__cache_dblock_get_initial_load_size,   /* 'get_initial_load_size' callback */
     NULL,				/* 'get_final_load_size' callback */
     H5HF__cache_dblock_verify_chksum,	/* 'verify_chksum' callback */
@@ -85,6 +85,7 @@
 /********************/
 
 static haddr_t H5HG_create(H5F_t *f, hid_t dxpl_id, size_t size);
+static int H5HG_read_multi_cmp(const void *_hobj1, const void *_hobj2);
 
 
 /*********************/
@@ -585,6 +586,101 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* H5HG_insert() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_insert_multi
+ *
+ * Purpose:	Inserts NOBJS new objects into the global heap, OBJ[i]
+ *		being SIZE[i] bytes long, and returns their heap object
+ *		handles through HOBJ.  Rather than placing each object
+ *		wherever the CWFS list finds room, the objects are packed
+ *		in order into new collections sized to fit them exactly,
+ *		so that objects written together are also read together.
+ *		Groups of objects too small to justify a collection of
+ *		their own are inserted with H5HG_insert().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_insert_multi(H5F_t *f, hid_t dxpl_id, size_t nobjs, const size_t size[],
+    void *obj[], H5HG_t hobj[]/*out*/)
+{
+    H5HG_heap_t	*heap = NULL;
+    unsigned 	heap_flags = H5AC__NO_FLAGS_SET;
+    size_t      first, last;            /* Objects in the current collection */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dxpl_id, H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(size || 0 == nobjs);
+    HDassert(obj || 0 == nobjs);
+    HDassert(hobj || 0 == nobjs);
+
+    if(0 == (H5F_INTENT(f) & H5F_ACC_RDWR))
+	HGOTO_ERROR(H5E_HEAP, H5E_WRITEERROR, FAIL, "no write intent on file")
+
+    for(first = 0; first < nobjs; first = last) {
+        size_t	need;		/*total space needed for the objects	*/
+        haddr_t	addr;           /* Address of the new collection */
+
+        /* Gather as many objects as fit in a collection of maximum size */
+        need = H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(size[first]);
+        for(last = first + 1; last < nobjs && (last - first) < H5HG_MAXIDX; last++) {
+            size_t obj_need = H5HG_SIZEOF_OBJHDR(f) + H5HG_ALIGN(size[last]);
+
+            if(need + obj_need + H5HG_SIZEOF_HDR(f) > H5HG_MAXSIZE)
+                break;
+            need += obj_need;
+        } /* end for */
+
+        /* Let small groups share the collections on the CWFS list */
+        if(need + H5HG_SIZEOF_HDR(f) < H5HG_MINSIZE) {
+            for(u = first; u < last; u++)
+                if(H5HG_insert(f, dxpl_id, size[u], obj[u], &hobj[u]) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTINSERT, FAIL, "unable to insert global heap object")
+            continue;
+        } /* end if */
+
+        /* Allocate a collection with exactly enough room for the group */
+        addr = H5HG_create(f, dxpl_id, need + H5HG_SIZEOF_HDR(f));
+        if(!H5F_addr_defined(addr))
+	    HGOTO_ERROR(H5E_HEAP, H5E_CANTINIT, FAIL, "unable to allocate a global heap collection")
+
+        if(NULL == (heap = H5HG_protect(f, dxpl_id, addr, H5AC__NO_FLAGS_SET)))
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+
+        /* Copy the objects into the collection */
+        for(u = first; u < last; u++) {
+            size_t idx;
+
+            if(0 == (idx = H5HG_alloc(f, heap, size[u], &heap_flags)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTALLOC, FAIL, "unable to allocate global heap object")
+            if(size[u] > 0)
+                HDmemcpy(heap->obj[idx].begin + H5HG_SIZEOF_OBJHDR(f), obj[u], size[u]);
+
+            hobj[u].addr = heap->addr;
+            hobj[u].idx = idx;
+        } /* end for */
+        heap_flags |= H5AC__DIRTIED_FLAG;
+
+        if(H5AC_unprotect(f, dxpl_id, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0)
+            HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap.")
+        heap = NULL;
+        heap_flags = H5AC__NO_FLAGS_SET;
+    } /* end for */
+
+done:
+    if(heap && H5AC_unprotect(f, dxpl_id, H5AC_GHEAP, heap->addr, heap, heap_flags) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to unprotect heap.")
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* H5HG_insert_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5HG_read
@@ -659,6 +755,103 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, NULL)
 } /* end H5HG_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_read_multi_cmp
+ *
+ * Purpose:	Compares two heap IDs by collection address, for qsort().
+ *
+ * Return:	Negative, zero or positive
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5HG_read_multi_cmp(const void *_hobj1, const void *_hobj2)
+{
+    const H5HG_t *hobj1 = *(const H5HG_t * const *)_hobj1;
+    const H5HG_t *hobj2 = *(const H5HG_t * const *)_hobj2;
+
+    if(H5F_addr_lt(hobj1->addr, hobj2->addr))
+        return -1;
+    if(H5F_addr_gt(hobj1->addr, hobj2->addr))
+        return 1;
+    return 0;
+} /* end H5HG_read_multi_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5HG_read_multi
+ *
+ * Purpose:	Reads NOBJS global heap objects, HOBJ[i] into the buffer
+ *		OBJECT[i] supplied by the caller, which must be large enough
+ *		to hold it.  The objects are grouped by heap collection so
+ *		that each collection is protected only once, instead of
+ *		once per object as with H5HG_read().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5HG_read_multi(H5F_t *f, hid_t dxpl_id, size_t nobjs, const H5HG_t *hobj,
+    void *object[]/*out*/)
+{
+    const H5HG_t **order = NULL;        /* Heap IDs, sorted by collection */
+    H5HG_heap_t	*heap = NULL;           /* Pointer to global heap object */
+    size_t      u;                      /* Local index variable */
+    herr_t	ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_TAG(dxpl_id, H5AC__GLOBALHEAP_TAG, FAIL)
+
+    /* Check args */
+    HDassert(f);
+    HDassert(hobj || 0 == nobjs);
+    HDassert(object || 0 == nobjs);
+
+    if(0 == nobjs)
+        HGOTO_DONE(SUCCEED)
+
+    /* Sort the heap IDs by collection */
+    if(NULL == (order = (const H5HG_t **)H5MM_malloc(nobjs * sizeof(H5HG_t *))))
+	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    for(u = 0; u < nobjs; u++)
+        order[u] = hobj + u;
+    HDqsort(order, nobjs, sizeof(H5HG_t *), H5HG_read_multi_cmp);
+
+    for(u = 0; u < nobjs; u++) {
+        const H5HG_t *cur = order[u];
+        size_t	size;                   /* Size of the heap object */
+
+        /* Switch to the next collection */
+        if(NULL == heap || H5F_addr_ne(heap->addr, cur->addr)) {
+            if(heap) {
+                if(H5AC_unprotect(f, dxpl_id, H5AC_GHEAP, heap->addr, heap, H5AC__NO_FLAGS_SET) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+                heap = NULL;
+            } /* end if */
+            if(NULL == (heap = H5HG_protect(f, dxpl_id, cur->addr, H5AC__READ_ONLY_FLAG)))
+                HGOTO_ERROR(H5E_HEAP, H5E_CANTPROTECT, FAIL, "unable to protect global heap")
+
+            /* Advance the heap in the CWFS list */
+            if(heap->obj[0].begin)
+                if(H5F_cwfs_advance_heap(f, heap, FALSE) < 0)
+                    HGOTO_ERROR(H5E_HEAP, H5E_CANTMODIFY, FAIL, "can't adjust file's CWFS")
+        } /* end if */
+
+        HDassert(cur->idx < heap->nused);
+        HDassert(heap->obj[cur->idx].begin);
+        size = heap->obj[cur->idx].size;
+        HDmemcpy(object[cur - hobj], heap->obj[cur->idx].begin + H5HG_SIZEOF_OBJHDR(f), size);
+    } /* end for */
+
+done:
+    if(heap && H5AC_unprotect(f, dxpl_id, H5AC_GHEAP, heap->addr, heap, H5AC__NO_FLAGS_SET) < 0)
+        HDONE_ERROR(H5E_HEAP, H5E_CANTUNPROTECT, FAIL, "unable to release global heap")
+    H5MM_xfree(order);
+
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5HG_read_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5HG_link
@@ -88,6 +88,8 @@ static herr_t H5MF_alloc_create(H5F_t *f, hid_t dxpl_id, H5FD_mem_t type);
 static herr_t H5MF__alloc_close(H5F_t *f, hid_t dxpl_id, H5FD_mem_t type);
 static herr_t H5MF__close_delete(H5F_t *f, hid_t dxpl_id, H5P_genplist_t **dxpl);
 static herr_t H5MF__close_shrink_eoa(H5F_t *f, hid_t dxpl_id);
+static herr_t H5MF__page_round_free(H5F_t *f, H5FD_mem_t alloc_type,
+    haddr_t addr, hsize_t *size);
 
 
 /*********************/
@@ -271,8 +273,13 @@ H5MF__alloc_open(H5F_t *f, hid_t dxpl_id, H5FD_mem_t type)
     reset_ring = TRUE;
 
     /* Open an existing free space structure for the file */
+    /* (Files that allocate space in pages find page aligned sections for
+     *  requests of a page or more)
+     */
     if(NULL == (f->shared->fs_man[type] = H5FS_open(f, dxpl_id, f->shared->fs_addr[type],
-	    NELMTS(classes), classes, f, f->shared->alignment, f->shared->threshold)))
+	    NELMTS(classes), classes, f,
+            H5F_PAGED_AGGR(f) ? f->shared->fs_page_size : f->shared->alignment,
+            H5F_PAGED_AGGR(f) ? f->shared->fs_page_size : f->shared->threshold)))
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't initialize free space info")
 
     /* Set the state for the free space manager to "open", if it is now */
@@ -331,7 +338,9 @@ H5MF_alloc_create(H5F_t *f, hid_t dxpl_id, H5FD_mem_t type)
     fs_create.max_sect_size = f->shared->maxaddr;
 
     if(NULL == (f->shared->fs_man[type] = H5FS_create(f, dxpl_id, NULL,
-	    &fs_create, NELMTS(classes), classes, f, f->shared->alignment, f->shared->threshold)))
+	    &fs_create, NELMTS(classes), classes, f,
+            H5F_PAGED_AGGR(f) ? f->shared->fs_page_size : f->shared->alignment,
+            H5F_PAGED_AGGR(f) ? f->shared->fs_page_size : f->shared->threshold)))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't initialize free space info")
 
 
@@ -452,6 +461,7 @@ H5MF_alloc(H5F_t *f, H5FD_mem_t alloc_type, hid_t dxpl_id, hsize_t size)
     H5AC_ring_t fsm_ring = H5AC_RING_INV;       /* free space manager ring */
     H5AC_ring_t orig_ring = H5AC_RING_INV;      /* Original ring value */
     H5FD_mem_t  fs_type;                /* Free space type (mapped from allocation type) */
+    hsize_t     sect_size = size;       /* Amount of free space section used */
     hbool_t reset_ring = FALSE;         /* Whether the ring was set */
     haddr_t ret_value = HADDR_UNDEF;    /* Return value */
 
@@ -469,6 +479,13 @@ HDfprintf(stderr, "%s: alloc_type = %u, size = %Hu\n", FUNC, (unsigned)alloc_typ
     /* Get free space type from allocation type */
     fs_type = H5MF_ALLOC_TO_FS_TYPE(f, alloc_type);
 
+    /* Blocks of a page or more in files that allocate space in pages use
+     *  whole pages, the rest of the last page going unused until the block
+     *  is freed.
+     */
+    if(H5F_PAGED_AGGR(f) && size >= f->shared->fs_page_size)
+        sect_size = H5MF_PAGE_ROUNDUP(f, size);
+
     /* Set the ring type in the DXPL */
     if((fs_type == H5MF_ALLOC_TO_FS_TYPE(f, H5FD_MEM_FSPACE_HDR))
             || (fs_type == H5MF_ALLOC_TO_FS_TYPE(f, H5FD_MEM_FSPACE_SINFO)))
@@ -492,7 +509,7 @@ HDfprintf(stderr, "%s: alloc_type = %u, size = %Hu\n", FUNC, (unsigned)alloc_typ
             htri_t node_found = FALSE;      /* Whether an existing free list node was found */
 
             /* Try to get a section from the free space manager */
-            if((node_found = H5FS_sect_find(f, dxpl_id, f->shared->fs_man[fs_type], size, (H5FS_section_info_t **)&node)) < 0)
+            if((node_found = H5FS_sect_find(f, dxpl_id, f->shared->fs_man[fs_type], sect_size, (H5FS_section_info_t **)&node)) < 0)
                 HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, HADDR_UNDEF, "error locating free space in file")
 #ifdef H5MF_ALLOC_DEBUG_MORE
 HDfprintf(stderr, "%s: Check 1.5, node_found = %t\n", FUNC, node_found);
@@ -507,7 +524,7 @@ HDfprintf(stderr, "%s: Check 1.5, node_found = %t\n", FUNC, node_found);
                 ret_value = node->sect_info.addr;
 
                 /* Check for eliminating the section */
-                if(node->sect_info.size == size) {
+                if(node->sect_info.size == sect_size) {
 #ifdef H5MF_ALLOC_DEBUG_MORE
 HDfprintf(stderr, "%s: Check 1.6, freeing node\n", FUNC);
 #endif /* H5MF_ALLOC_DEBUG_MORE */
@@ -519,8 +536,8 @@ HDfprintf(stderr, "%s: Check 1.6, freeing node\n", FUNC);
                     H5MF_sect_ud_t udata;               /* User data for callback */
 
                     /* Adjust information for section */
-                    node->sect_info.addr += size;
-                    node->sect_info.size -= size;
+                    node->sect_info.addr += sect_size;
+                    node->sect_info.size -= sect_size;
 
                     /* Construct user data for callbacks */
                     udata.f = f;
@@ -529,6 +546,25 @@ HDfprintf(stderr, "%s: Check 1.6, freeing node\n", FUNC);
                     udata.allow_sect_absorb = TRUE;
 		    udata.allow_eoa_shrink_only = FALSE; 
 
+                    /* Keep the sections of files that allocate space in pages
+                     *  either within one page or starting on a page boundary,
+                     *  by splitting off the part of what's left of the section
+                     *  that is in the same page as the new block.
+                     */
+                    if(H5F_PAGED_AGGR(f) && (node->sect_info.addr % f->shared->fs_page_size) != 0
+                            && !H5MF_IN_ONE_PAGE(f, node->sect_info.addr, node->sect_info.size)) {
+                        H5MF_free_section_t *page_node;     /* Section starting on the next page */
+                        hsize_t head_size;                  /* Size of the section in the new block's page */
+
+                        head_size = f->shared->fs_page_size - (node->sect_info.addr % f->shared->fs_page_size);
+                        if(NULL == (page_node = H5MF_sect_simple_new(node->sect_info.addr + head_size, node->sect_info.size - head_size)))
+                            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, HADDR_UNDEF, "can't initialize free space section")
+                        node->sect_info.size = head_size;
+
+                        if(H5FS_sect_add(f, dxpl_id, f->shared->fs_man[fs_type], (H5FS_section_info_t *)page_node, H5FS_ADD_RETURNED_SPACE, &udata) < 0)
+                            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, HADDR_UNDEF, "can't re-add section to file free space")
+                    } /* end if */
+
 #ifdef H5MF_ALLOC_DEBUG_MORE
 HDfprintf(stderr, "%s: Check 1.7, re-adding node, node->sect_info.size = %Hu\n", FUNC, node->sect_info.size);
 #endif /* H5MF_ALLOC_DEBUG_MORE */
@@ -670,6 +706,25 @@ HDfprintf(stderr, "%s: Entering - alloc_type = %u, addr = %a, size = %Hu\n", FUN
     if(H5F_addr_le(f->shared->tmp_addr, addr))
         HGOTO_ERROR(H5E_RESOURCE, H5E_BADRANGE, FAIL, "attempting to free temporary file space")
 
+    /* For files that allocate space in pages, free a block that spans pages
+     *  as the part in its first page, if that doesn't start on a page
+     *  boundary, and then whole pages.
+     */
+    if(H5F_PAGED_AGGR(f) && !H5MF_IN_ONE_PAGE(f, addr, size)) {
+        hsize_t page_off = addr % f->shared->fs_page_size;
+
+        if(page_off) {
+            hsize_t head_size = f->shared->fs_page_size - page_off;
+
+            if(H5MF_xfree(f, alloc_type, dxpl_id, addr, head_size) < 0)
+                HGOTO_ERROR(H5E_RESOURCE, H5E_CANTFREE, FAIL, "can't free start of block")
+            addr += head_size;
+            size -= head_size;
+        } /* end if */
+        if(H5MF__page_round_free(f, alloc_type, addr, &size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, FAIL, "can't round block to page")
+    } /* end if */
+
     /* Get free space type from allocation type */
     fs_type = H5MF_ALLOC_TO_FS_TYPE(f, alloc_type);
 #ifdef H5MF_ALLOC_DEBUG_MORE
@@ -849,6 +904,19 @@ HDfprintf(stderr, "%s: Entering: alloc_type = %u, addr = %a, size = %Hu, extra_r
     /* Compute end of block to extend */
     end = addr + size;
 
+    /* In files that allocate space in pages, a block within one page can
+     *  only be extended to the end of that page, and a block that uses
+     *  whole pages only to the end of its last page.
+     */
+    if(H5F_PAGED_AGGR(f)) {
+        if(H5MF_IN_ONE_PAGE(f, addr, size)) {
+            if(!H5MF_IN_ONE_PAGE(f, addr, size + extra_requested))
+                HGOTO_DONE(FALSE)
+        } /* end if */
+        else
+            HGOTO_DONE(H5F_addr_le(end + extra_requested, H5MF_PAGE_ROUNDUP(f, end)))
+    } /* end if */
+
     /* Get free space type from allocation type */
     fs_type = H5MF_ALLOC_TO_FS_TYPE(f, alloc_type);
 
@@ -1117,6 +1185,11 @@ HDfprintf(stderr, "%s: Entering - alloc_type = %u, addr = %a, size = %Hu\n", FUN
     HDassert(H5F_addr_defined(addr));
     HDassert(size > 0);
 
+    /* A block that spans pages also frees the rest of its last page */
+    if(H5F_PAGED_AGGR(f) && !H5MF_IN_ONE_PAGE(f, addr, size))
+        if(H5MF__page_round_free(f, alloc_type, addr, &size) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, FAIL, "can't round block to page")
+
     /* Create free space section for block */
     if(NULL == (node = H5MF_sect_simple_new(addr, size)))
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't initialize free space section")
@@ -1149,6 +1222,48 @@ HDfprintf(stderr, "%s: Leaving, ret_value = %d\n", FUNC, ret_value);
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5MF_try_shrink() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5MF__page_round_free
+ *
+ * Purpose:     Extend a block being freed in a file that allocates space
+ *              in pages to the end of its last page, as blocks that span
+ *              pages are allocated whole pages.  The block is never
+ *              extended past the EOA.
+ *
+ * Return:	SUCCEED/FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5MF__page_round_free(H5F_t *f, H5FD_mem_t alloc_type, haddr_t addr,
+    hsize_t *size)
+{
+    haddr_t eoa;                /* End of allocated space in the file */
+    haddr_t end;                /* End of the block's last page */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* check args */
+    HDassert(f);
+    HDassert(H5F_PAGED_AGGR(f));
+    HDassert(size);
+
+    /* Retrieve the 'eoa' for the file */
+    if(HADDR_UNDEF == (eoa = H5F_get_eoa(f, alloc_type)))
+	HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, FAIL, "driver get_eoa request failed")
+
+    end = H5MF_PAGE_ROUNDUP(f, addr + *size);
+    if(H5F_addr_gt(end, eoa))
+        end = eoa;
+    if(H5F_addr_gt(end, addr + *size))
+        *size = end - addr;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5MF__page_round_free() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5MF__close_shrink_eoa
@@ -1332,7 +1447,7 @@ H5MF_settle_raw_data_fsm(H5F_t *f, hid_t dxpl_id, hbool_t *fsm_settled)
     HDassert(fsm_settled);
 
     /* Only need to settle things if we are persisting the free space info */
-    if(f->shared->fs_strategy == H5F_FILE_SPACE_ALL_PERSIST) {
+    if(H5F_HAVE_PERSISTENT_FREE_SPACE(f)) {
         H5O_fsinfo_t fsinfo;                    /* Free space manager info message */
         H5FD_mem_t	type;			/* Memory type for iteration */
         H5AC_ring_t curr_ring = H5AC_RING_INV;  /* Current ring value */
@@ -1489,6 +1604,7 @@ H5MF_settle_raw_data_fsm(H5F_t *f, hid_t dxpl_id, hbool_t *fsm_settled)
             fsinfo.fs_addr[type-1] = HADDR_UNDEF;
         fsinfo.strategy = f->shared->fs_strategy;
         fsinfo.threshold = f->shared->fs_threshold;
+        fsinfo.page_size = f->shared->fs_page_size;
         if(H5F_super_ext_write_msg(f, dxpl_id, H5O_FSINFO_ID, &fsinfo, TRUE, H5O_MSG_NO_FLAGS_SET) < 0)
             HGOTO_ERROR(H5E_RESOURCE, H5E_WRITEERROR, FAIL, "error in writing message to superblock extension")
 
@@ -1736,7 +1852,7 @@ H5MF_settle_meta_data_fsm(H5F_t *f, hid_t dxpl_id, hbool_t *fsm_settled)
     HDassert(fsm_settled);
 
     /* Only need to settle things if we are persisting the free space info */
-    if(f->shared->fs_strategy == H5F_FILE_SPACE_ALL_PERSIST) {
+    if(H5F_HAVE_PERSISTENT_FREE_SPACE(f)) {
         H5FS_t     *hdr_fspace;             /* Ptr to FSM hdr alloc FSM */
         H5FS_t     *sinfo_fspace;           /* Ptr to FSM sinfo alloc FSM */
         H5FS_stat_t fs_stat;		    /* Information for FSM */
@@ -2086,7 +2202,7 @@ HDfprintf(stderr, "%s: Entering\n", FUNC);
 
     /* Making free-space managers persistent for superblock version >= 2 */
     if(f->shared->sblock->super_vers >= HDF5_SUPERBLOCK_VERSION_2
-            && f->shared->fs_strategy == H5F_FILE_SPACE_ALL_PERSIST) {
+            && H5F_HAVE_PERSISTENT_FREE_SPACE(f)) {
         H5O_fsinfo_t fsinfo;		/* Free space manager info message */
 
         /* Superblock extension and free space manager message should 
@@ -2111,6 +2227,7 @@ HDfprintf(stderr, "%s: Entering\n", FUNC);
             fsinfo.fs_addr[type - 1] = f->shared->fs_addr[type];
 	fsinfo.strategy = f->shared->fs_strategy;
 	fsinfo.threshold = f->shared->fs_threshold;
+	fsinfo.page_size = f->shared->fs_page_size;
 
         /* Write the free space manager message -- message must already exist */
         if(H5F_super_ext_write_msg(f, dxpl_id, H5O_FSINFO_ID, &fsinfo, FALSE, H5O_MSG_NO_FLAGS_SET) < 0)
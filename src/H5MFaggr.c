@@ -86,6 +86,12 @@ static herr_t H5MF_aggr_free(H5F_t *f, hid_t dxpl_id, H5FD_mem_t type,
  *		The TYPE argument describes the purpose for which the storage
  *		is being requested.
  *
+ *              For files that allocate space in pages, a block smaller
+ *              than a page is not allowed to cross a page boundary, and
+ *              a larger block starts on a page boundary and is allocated
+ *              whole pages.  Any space skipped to do so is a fragment,
+ *              like the space skipped to align blocks in other files.
+ *
  * Return:      Success:        The file address of new chunk.
  *              Failure:        HADDR_UNDEF
  *
@@ -101,6 +107,8 @@ H5MF_vfd_alloc(H5F_t *f, hid_t dxpl_id, H5FD_mem_t alloc_type, hsize_t size,
     haddr_t eoa;                        /* Initial EOA for the file */
     haddr_t eoa_frag_addr = HADDR_UNDEF; /* Address of fragment at EOA */
     hsize_t eoa_frag_size = 0;          /* Size of fragment at EOA */
+    hsize_t page_frag_size = 0;         /* Size of fragment to reach a page boundary */
+    hsize_t alloc_size = size;          /* Amount of space to allocate for the block */
     haddr_t ret_value = HADDR_UNDEF;    /* Return value */
 
     FUNC_ENTER_NOAPI(HADDR_UNDEF)
@@ -118,19 +126,42 @@ HDfprintf(stderr, "%s: alloc_type = %u, size = %Hu\n", FUNC, (unsigned)alloc_typ
     if(HADDR_UNDEF == (eoa = H5F_get_eoa(f, alloc_type)))
        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTGET, HADDR_UNDEF, "Unable to get eoa")
 
+    /* Work out the fragment needed to keep the block to its page(s) */
+    if(H5F_PAGED_AGGR(f)) {
+        hsize_t page_off = eoa % f->shared->fs_page_size;
+
+        if(size >= f->shared->fs_page_size) {
+            if(page_off)
+                page_frag_size = f->shared->fs_page_size - page_off;
+            alloc_size = H5MF_PAGE_ROUNDUP(f, size);
+        } /* end if */
+        else if(page_off + size > f->shared->fs_page_size)
+            page_frag_size = f->shared->fs_page_size - page_off;
+    } /* end if */
+
     /* Check for overlap into temporary allocation space */
-    if(H5F_addr_gt((eoa + size), f->shared->tmp_addr))
+    if(H5F_addr_gt((eoa + page_frag_size + alloc_size), f->shared->tmp_addr))
         HGOTO_ERROR(H5E_RESOURCE, H5E_BADRANGE, HADDR_UNDEF, "hdr file space alloc will overlap into 'temporary' file space")
 
     /* Allocate space for the header */
-    if(HADDR_UNDEF == (ret_value = H5FD_alloc(f->shared->lf, dxpl_id, alloc_type, f, size, &eoa_frag_addr, &eoa_frag_size)))
+    if(HADDR_UNDEF == (ret_value = H5FD_alloc(f->shared->lf, dxpl_id, alloc_type, f, page_frag_size + alloc_size, &eoa_frag_addr, &eoa_frag_size)))
         HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, HADDR_UNDEF, "can't allocate file space for hdr")
 
+    /* The VFD doesn't align the space allocated for files that allocate
+     *  space in pages, so the page fragment is the only fragment.
+     */
+    if(page_frag_size > 0) {
+        HDassert(eoa_frag_size == 0);
+        eoa_frag_addr = ret_value;
+        eoa_frag_size = page_frag_size;
+        ret_value += page_frag_size;
+    } /* end if */
+
     /* Sanity check for overlapping into file's temporary allocation space */
     HDassert(H5F_addr_le((ret_value + size), f->shared->tmp_addr));
 
     /* If the file alignment is 1, there should be no eoa fragment */
-    HDassert((eoa_frag_size == 0) || (f->shared->alignment != 1));
+    HDassert((eoa_frag_size == 0) || (f->shared->alignment != 1) || H5F_PAGED_AGGR(f));
 
     /* Check if fragment was generated and we want to keep it */
     if(keep_fragment && eoa_frag_size > 0) {
@@ -187,8 +218,13 @@ HDfprintf(stderr, "%s: alloc_type = %u, size = %Hu\n", FUNC, (unsigned)alloc_typ
     HDassert(f->shared->lf);
     HDassert(size > 0);
 
+    /* Files that allocate space in pages don't use the aggregators */
+    if(H5F_PAGED_AGGR(f)) {
+        if(HADDR_UNDEF == (ret_value = H5MF_vfd_alloc(f, dxpl_id, alloc_type, size, TRUE)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, HADDR_UNDEF, "can't allocate file space in pages")
+    } /* end if */
     /* Couldn't find anything from the free space manager, go allocate some */
-    if(alloc_type != H5FD_MEM_DRAW && alloc_type != H5FD_MEM_GHEAP) {
+    else if(alloc_type != H5FD_MEM_DRAW && alloc_type != H5FD_MEM_GHEAP) {
         /* Handle metadata differently from "raw" data */
         if(HADDR_UNDEF == (ret_value = H5MF_aggr_alloc(f, dxpl_id, &(f->shared->meta_aggr), &(f->shared->sdata_aggr), alloc_type, size)))
             HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, HADDR_UNDEF, "can't allocate metadata")
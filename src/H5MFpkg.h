@@ -55,6 +55,12 @@
 /* (values stored in free space data structures in file) */
 #define H5MF_FSPACE_SECT_SIMPLE         0       /* Section is a range of actual bytes in file */
 
+/* Page helpers, for files that allocate space in pages (H5F_FILE_SPACE_PAGE) */
+#define H5MF_IN_ONE_PAGE(F, A, S)                                             \
+    ((((A) % (F)->shared->fs_page_size) + (S)) <= (F)->shared->fs_page_size)
+#define H5MF_PAGE_ROUNDUP(F, X)                                               \
+    ((((X) + (F)->shared->fs_page_size - 1) / (F)->shared->fs_page_size) * (F)->shared->fs_page_size)
+
 
 /****************************/
 /* Package Private Typedefs */
@@ -215,10 +215,11 @@ done:
  */
 static htri_t
 H5MF_sect_simple_can_merge(const H5FS_section_info_t *_sect1,
-    const H5FS_section_info_t *_sect2, void H5_ATTR_UNUSED *_udata)
+    const H5FS_section_info_t *_sect2, void *_udata)
 {
     const H5MF_free_section_t *sect1 = (const H5MF_free_section_t *)_sect1;   /* File free section */
     const H5MF_free_section_t *sect2 = (const H5MF_free_section_t *)_sect2;   /* File free section */
+    H5MF_sect_ud_t *udata = (H5MF_sect_ud_t *)_udata;   /* User data for callback */
     htri_t ret_value = FAIL;            /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT_NOERR
@@ -232,6 +233,16 @@ H5MF_sect_simple_can_merge(const H5FS_section_info_t *_sect1,
     /* Check if second section adjoins first section */
     ret_value = H5F_addr_eq(sect1->sect_info.addr + sect1->sect_info.size, sect2->sect_info.addr);
 
+    /* For files that allocate space in pages, every section must either
+     *  start on a page boundary or lie within a single page, so that small
+     *  blocks are never allocated across a page boundary.  Only merge
+     *  sections that keep it that way.
+     */
+    if(ret_value > 0 && udata && H5F_PAGED_AGGR(udata->f))
+        if((sect1->sect_info.addr % udata->f->shared->fs_page_size) != 0 &&
+                !H5MF_IN_ONE_PAGE(udata->f, sect1->sect_info.addr, sect1->sect_info.size + sect2->sect_info.size))
+            ret_value = FALSE;
+
     FUNC_LEAVE_NOAPI(ret_value)
 } /* H5MF_sect_simple_can_merge() */
 
@@ -35,6 +35,7 @@
 /* Headers */
 /***********/
 #include "H5private.h"		/* Generic Functions			*/
+#include "H5Dprivate.h"		/* Datasets				*/
 #include "H5Eprivate.h"		/* Error handling		  	*/
 #include "H5Fprivate.h"		/* File access				*/
 #include "H5FLprivate.h"	/* Free lists                           */
@@ -42,9 +43,7 @@
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5Lprivate.h"		/* Links				*/
 #include "H5MFprivate.h"	/* File memory management		*/
-#ifdef H5O_ENABLE_BOGUS
 #include "H5MMprivate.h"	/* Memory management			*/
-#endif /* H5O_ENABLE_BOGUS */
 #include "H5Opkg.h"             /* Object headers			*/
 #include "H5SMprivate.h"        /* Shared object header messages        */
 
@@ -80,6 +79,8 @@ typedef struct {
 /********************/
 
 static herr_t H5O_delete_oh(H5F_t *f, hid_t dxpl_id, H5O_t *oh);
+static herr_t H5O__prefetch_chunks(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
+    const H5O_cont_msgs_t *cont_msg_info, H5O_chk_cache_ud_t *chk_udata);
 static herr_t H5O_obj_type_real(H5O_t *oh, H5O_type_t *obj_type);
 static herr_t H5O_visit(hid_t loc_id, const char *obj_name, H5_index_t idx_type,
     H5_iter_order_t order, H5O_iterate_t op, void *op_data, hid_t lapl_id,
@@ -1821,6 +1822,9 @@ H5O_protect(const H5O_loc_t *loc, hid_t dxpl_id, unsigned prot_flags,
     /* prot_flags may only contain the H5AC__READ_ONLY_FLAG */
     HDassert((prot_flags & (unsigned)(~H5AC__READ_ONLY_FLAG)) == 0);
 
+    /* Reset the continuation message info, for cleanup on error */
+    HDmemset(&cont_msg_info, 0, sizeof(cont_msg_info));
+
     /* Check for valid address */
     if(!H5F_addr_defined(loc->addr))
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, NULL, "address undefined")
@@ -1839,7 +1843,6 @@ H5O_protect(const H5O_loc_t *loc, hid_t dxpl_id, unsigned prot_flags,
     udata.common.dxpl_id = dxpl_id;
     udata.common.file_intent = file_intent;
     udata.common.merged_null_msgs = 0;
-    HDmemset(&cont_msg_info, 0, sizeof(cont_msg_info));
     udata.common.cont_msg_info = &cont_msg_info;
     udata.common.addr = loc->addr;
 
@@ -1868,6 +1871,13 @@ H5O_protect(const H5O_loc_t *loc, hid_t dxpl_id, unsigned prot_flags,
         chk_udata.common.merged_null_msgs = udata.common.merged_null_msgs;
         chk_udata.common.cont_msg_info = &cont_msg_info;
 
+        /* Prefetch the chunks referenced from the first chunk, so that
+         *      chunks near each other in the file are read together,
+         *      instead of with one read per chunk below.
+         */
+        if(H5O__prefetch_chunks(loc->file, dxpl_id, oh, &cont_msg_info, &chk_udata) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "unable to prefetch object header chunks")
+
         /* Read in continuation messages, until there are no more */
         /* (Note that loading chunks could increase the # of continuation
          *      messages if new ones are found - QAK, 19/11/2016)
@@ -1965,6 +1975,10 @@ H5O_assert(oh);
     ret_value = oh;
 
 done:
+    /* Release any continuation messages left by an error */
+    if(cont_msg_info.msgs)
+        cont_msg_info.msgs = (H5O_cont_t *)H5FL_SEQ_FREE(H5O_cont_t, cont_msg_info.msgs);
+
     if(ret_value == NULL && oh)
         if(H5O_unprotect(loc, dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
             HDONE_ERROR(H5E_OHDR, H5E_CANTUNPROTECT, NULL, "unable to release object header")
@@ -1972,6 +1986,91 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, NULL)
 } /* end H5O_protect() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5O__prefetch_chunks
+ *
+ * Purpose:	Prefetch the object header continuation chunks described
+ *              by the continuation messages found so far into the
+ *              metadata cache, so that they can be protected without
+ *              further reads.  The header of a dataset's chunk index is
+ *              prefetched too, if it is close enough to the chunks to
+ *              be read along with them.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5O__prefetch_chunks(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
+    const H5O_cont_msgs_t *cont_msg_info, H5O_chk_cache_ud_t *chk_udata)
+{
+    H5AC_prefetch_t *pf = NULL; /* Entries to prefetch */
+    size_t npf = 0;             /* Number of entries to prefetch */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Check args */
+    HDassert(f);
+    HDassert(oh);
+    HDassert(cont_msg_info);
+    HDassert(cont_msg_info->msgs);
+    HDassert(chk_udata);
+    HDassert(chk_udata->oh == oh);
+
+    /* Gather the locations of the chunks, and room for an index header */
+    if(NULL == (pf = (H5AC_prefetch_t *)H5MM_malloc(sizeof(H5AC_prefetch_t) * (cont_msg_info->nmsgs + 1))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    /* (The chunk user data is only used to verify checksums here) */
+    for(u = 0; u < cont_msg_info->nmsgs; u++, npf++) {
+        pf[npf].type = H5AC_OHDR_CHK;
+        pf[npf].addr = cont_msg_info->msgs[u].addr;
+        pf[npf].len = cont_msg_info->msgs[u].size;
+        pf[npf].udata = chk_udata;
+        pf[npf].optional = FALSE;
+    } /* end for */
+
+    /* Look for a chunked layout message in the first chunk */
+    for(u = 0; u < oh->nmesgs; u++)
+        if(H5O_MSG_LAYOUT == oh->mesg[u].type) {
+            H5O_mesg_t *mesg = &oh->mesg[u];   /* Layout message */
+            const H5O_layout_t *layout;         /* Decoded layout */
+
+            H5O_LOAD_NATIVE(f, dxpl_id, 0, oh, mesg, FAIL)
+            layout = (const H5O_layout_t *)mesg->native;
+
+            if(H5D_CHUNKED == layout->type && H5F_addr_defined(layout->storage.u.chunk.idx_addr)) {
+                const H5AC_class_t *idx_type;   /* Class of index header */
+                size_t idx_size;                /* Size of index header */
+
+                if(H5D_chunk_idx_hdr_info(f, &layout->storage.u.chunk, &idx_type, &idx_size) < 0)
+                    HGOTO_ERROR(H5E_OHDR, H5E_CANTGET, FAIL, "can't get chunk index header info")
+                if(idx_type) {
+                    pf[npf].type = idx_type;
+                    pf[npf].addr = layout->storage.u.chunk.idx_addr;
+                    pf[npf].len = idx_size;
+                    pf[npf].udata = NULL;
+                    pf[npf].optional = TRUE;
+                    npf++;
+                } /* end if */
+            } /* end if */
+            break;
+        } /* end if */
+
+    /* Load them into the cache */
+    if(npf > 1)
+        if(H5AC_prefetch_entries(f, dxpl_id, npf, pf) < 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, FAIL, "unable to prefetch object header chunks")
+
+done:
+    if(pf)
+        pf = (H5AC_prefetch_t *)H5MM_xfree(pf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5O__prefetch_chunks() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5O_pin
@@ -65,8 +65,17 @@ const H5O_msg_class_t H5O_MSG_FSINFO[1] = {{
     H5O_fsinfo_debug          	/* debug the message            	*/
 }};
 
-/* Current version of free-space manager info information */
-#define H5O_FSINFO_VERSION 	0
+/* Versions of free-space manager info information */
+#define H5O_FSINFO_VERSION_0 	0
+#define H5O_FSINFO_VERSION_1 	1       /* Adds the file space page size */
+
+/* Message version needed for a file space strategy */
+#define H5O_FSINFO_VERSION(S)   \
+    ((S) == H5F_FILE_SPACE_PAGE ? H5O_FSINFO_VERSION_1 : H5O_FSINFO_VERSION_0)
+
+/* Whether a file space strategy stores the free space manager addresses */
+#define H5O_FSINFO_PERSIST(S)   \
+    ((S) == H5F_FILE_SPACE_ALL_PERSIST || (S) == H5F_FILE_SPACE_PAGE)
 
 /* Declare a free list to manage the H5O_fsinfo_t struct */
 H5FL_DEFINE_STATIC(H5O_fsinfo_t);
@@ -90,6 +99,7 @@ H5O_fsinfo_decode(H5F_t *f, hid_t H5_ATTR_UNUSED dxpl_id, H5O_t H5_ATTR_UNUSED *
 {
     H5O_fsinfo_t	*fsinfo = NULL; /* free-space manager info */
     H5FD_mem_t 		type;		/* Memory type for iteration */
+    unsigned            vers;           /* Message version */
     void                *ret_value = NULL;      /* Return value */
 
     FUNC_ENTER_NOAPI_NOINIT
@@ -99,7 +109,8 @@ H5O_fsinfo_decode(H5F_t *f, hid_t H5_ATTR_UNUSED dxpl_id, H5O_t H5_ATTR_UNUSED *
     HDassert(p);
 
     /* Version of message */
-    if(*p++ != H5O_FSINFO_VERSION)
+    vers = *p++;
+    if(vers > H5O_FSINFO_VERSION_1)
         HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "bad version number for message")
 
     /* Allocate space for message */
@@ -109,8 +120,17 @@ H5O_fsinfo_decode(H5F_t *f, hid_t H5_ATTR_UNUSED dxpl_id, H5O_t H5_ATTR_UNUSED *
     fsinfo->strategy = (H5F_file_space_type_t)*p++;	/* file space strategy */
     H5F_DECODE_LENGTH(f, p, fsinfo->threshold);	/* free space section size threshold */
 
-    /* Addresses of free space managers: only exist for H5F_FILE_SPACE_ALL_PERSIST */
-    if(fsinfo->strategy == H5F_FILE_SPACE_ALL_PERSIST) {
+    /* File space page size: only exists for H5F_FILE_SPACE_PAGE */
+    if(fsinfo->strategy == H5F_FILE_SPACE_PAGE) {
+        if(vers < H5O_FSINFO_VERSION_1)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "bad version number for paged file space strategy")
+        H5F_DECODE_LENGTH(f, p, fsinfo->page_size);
+        if(fsinfo->page_size == 0)
+            HGOTO_ERROR(H5E_OHDR, H5E_CANTLOAD, NULL, "invalid file space page size")
+    } /* end if */
+
+    /* Addresses of free space managers: only exist for persistent free space */
+    if(H5O_FSINFO_PERSIST(fsinfo->strategy)) {
 	for(type = H5FD_MEM_SUPER; type < H5FD_MEM_NTYPES; H5_INC_ENUM(H5FD_mem_t, type))
 	    H5F_addr_decode(f, &p, &(fsinfo->fs_addr[type-1]));
     } /* end if */
@@ -154,12 +174,16 @@ H5O_fsinfo_encode(H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, uint8_t *p, c
     HDassert(p);
     HDassert(fsinfo);
 
-    *p++ = H5O_FSINFO_VERSION;	/* message version */
+    *p++ = (uint8_t)H5O_FSINFO_VERSION(fsinfo->strategy);	/* message version */
     *p++ = fsinfo->strategy;	/* file space strategy */
     H5F_ENCODE_LENGTH(f, p, fsinfo->threshold); /* free-space section size threshold */
 
-    /* Addresses of free space managers: only exist for H5F_FILE_SPACE_ALL_PERSIST */
-    if(fsinfo->strategy == H5F_FILE_SPACE_ALL_PERSIST) {
+    /* File space page size: only exists for H5F_FILE_SPACE_PAGE */
+    if(fsinfo->strategy == H5F_FILE_SPACE_PAGE)
+        H5F_ENCODE_LENGTH(f, p, fsinfo->page_size);
+
+    /* Addresses of free space managers: only exist for persistent free space */
+    if(H5O_FSINFO_PERSIST(fsinfo->strategy)) {
 	for(type = H5FD_MEM_SUPER; type < H5FD_MEM_NTYPES; H5_INC_ENUM(H5FD_mem_t, type))
 	    H5F_addr_encode(f, &p, fsinfo->fs_addr[type-1]);
     } /* end if */
@@ -230,12 +254,14 @@ H5O_fsinfo_size(const H5F_t *f, hbool_t H5_ATTR_UNUSED disable_shared, const voi
     FUNC_ENTER_NOAPI_NOINIT_NOERR
 
 
-    /* Addresses of free-space managers exist only for H5F_FILE_SPACE_ALL_PERSIST type */
-    if(H5F_FILE_SPACE_ALL_PERSIST == fsinfo->strategy)
+    /* Addresses of free-space managers exist only for persistent free space */
+    if(H5O_FSINFO_PERSIST(fsinfo->strategy))
 	fs_addr_size = (H5FD_MEM_NTYPES - 1) * (size_t)H5F_SIZEOF_ADDR(f);
 
     ret_value = 2                       /* Version & strategy */
 		+ (size_t)H5F_SIZEOF_SIZE(f)	/* Threshold */
+		+ (fsinfo->strategy == H5F_FILE_SPACE_PAGE ?
+                    (size_t)H5F_SIZEOF_SIZE(f) : 0) /* Page size */
                 + fs_addr_size;		/* Addresses of free-space managers */
 
     FUNC_LEAVE_NOAPI(ret_value)
@@ -299,7 +325,11 @@ H5O_fsinfo_debug(H5F_t H5_ATTR_UNUSED *f, hid_t H5_ATTR_UNUSED dxpl_id, const vo
     HDfprintf(stream, "%*s%-*s %Hu\n", indent, "", fwidth,
               "Free space section threshold:", fsinfo->threshold);
 
-    if(fsinfo->strategy == H5F_FILE_SPACE_ALL_PERSIST) {
+    if(fsinfo->strategy == H5F_FILE_SPACE_PAGE)
+        HDfprintf(stream, "%*s%-*s %Hu\n", indent, "", fwidth,
+                  "File space page size:", fsinfo->page_size);
+
+    if(H5O_FSINFO_PERSIST(fsinfo->strategy)) {
 	for(type = H5FD_MEM_SUPER; type < H5FD_MEM_NTYPES; H5_INC_ENUM(H5FD_mem_t, type))
 	    HDfprintf(stream, "%*s%-*s %a\n", indent, "", fwidth,
 		"Free space manager address:", fsinfo->fs_addr[type-1]);
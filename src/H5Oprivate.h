@@ -793,6 +793,7 @@ typedef unsigned H5O_unknown_t;         /* Original message type ID */
 typedef struct H5O_fsinfo_t {
     H5F_file_space_type_t strategy;	/* File space strategy */
     hsize_t		  threshold;	/* Free space section threshold */
+    hsize_t		  page_size;	/* File space page size (H5F_FILE_SPACE_PAGE only) */
     haddr_t     	  fs_addr[H5FD_MEM_NTYPES-1]; /* Addresses of free space managers */
 } H5O_fsinfo_t;
 
@@ -0,0 +1,789 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Module Info:	Page buffer routines.  The page buffer sits between
+ *		H5F_block_read/write and the metadata accumulator, and
+ *		holds fixed size pages of the file.  Accesses smaller than
+ *		a page are served from (and aggregated in) the pages
+ *		holding them, so the file driver only sees page sized I/O
+ *		for them.  Larger accesses go straight to the file, and are
+ *		reconciled with any pages held for the same region.
+ *
+ *		Pages are evicted in LRU order, except that a minimum
+ *		number of pages can be reserved for metadata and for raw
+ *		data.
+ */
+
+/****************/
+/* Module Setup */
+/****************/
+
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+#include "H5PBmodule.h"         /* This source code file is part of the H5PB module */
+
+
+/***********/
+/* Headers */
+/***********/
+#include "H5private.h"		/* Generic Functions			*/
+#include "H5Eprivate.h"		/* Error handling		  	*/
+#include "H5Fpkg.h"             /* File access				*/
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5PBpkg.h"            /* Page buffer				*/
+
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Statistics index for a type of data */
+#define H5PB__STATS_IDX(is_meta)        ((is_meta) ? H5PB__STATS_META : H5PB__STATS_RAW)
+
+/* Remove a page from the LRU list */
+#define H5PB__LRU_REMOVE(pb, entry)                                         \
+{                                                                           \
+    if((entry)->prev)                                                       \
+        (entry)->prev->next = (entry)->next;                                \
+    else                                                                    \
+        (pb)->LRU_head = (entry)->next;                                     \
+    if((entry)->next)                                                       \
+        (entry)->next->prev = (entry)->prev;                                \
+    else                                                                    \
+        (pb)->LRU_tail = (entry)->prev;                                     \
+    (entry)->next = (entry)->prev = NULL;                                   \
+}
+
+/* Insert a page at the head (most recently used end) of the LRU list */
+#define H5PB__LRU_PREPEND(pb, entry)                                        \
+{                                                                           \
+    (entry)->prev = NULL;                                                   \
+    (entry)->next = (pb)->LRU_head;                                         \
+    if((pb)->LRU_head)                                                      \
+        (pb)->LRU_head->prev = (entry);                                     \
+    else                                                                    \
+        (pb)->LRU_tail = (entry);                                           \
+    (pb)->LRU_head = (entry);                                               \
+}
+
+
+/******************/
+/* Local Typedefs */
+/******************/
+
+
+/********************/
+/* Package Typedefs */
+/********************/
+
+
+/********************/
+/* Local Prototypes */
+/********************/
+static herr_t H5PB__write_entry(const H5F_io_info_t *fio_info,
+    H5PB_entry_t *entry);
+static herr_t H5PB__evict_entry(const H5F_io_info_t *fio_info, H5PB_t *pb,
+    H5PB_entry_t *entry);
+static herr_t H5PB__make_space(const H5F_io_info_t *fio_info, H5PB_t *pb,
+    hbool_t is_meta, hbool_t *room);
+static herr_t H5PB__load_page(const H5F_io_info_t *fio_info, H5PB_t *pb,
+    H5FD_mem_t type, haddr_t page_addr, H5PB_entry_t **entry_ptr);
+static herr_t H5PB__free_entry_cb(void *item, void *key, void *op_data);
+
+
+/*********************/
+/* Package Variables */
+/*********************/
+
+/* Package initialization variable */
+hbool_t H5_PKG_INIT_VAR = FALSE;
+
+/*****************************/
+/* Library Private Variables */
+/*****************************/
+
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Declare a free list to manage the H5PB_t struct */
+H5FL_DEFINE_STATIC(H5PB_t);
+
+/* Declare a free list to manage the H5PB_entry_t struct */
+H5FL_DEFINE_STATIC(H5PB_entry_t);
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_create
+ *
+ * Purpose:	Create the page buffer for a file, holding pages of
+ *		PAGE_SIZE bytes in at most BUF_SIZE bytes of memory.
+ *		MIN_META_PERC and MIN_RAW_PERC are the percentages of the
+ *		pages reserved for metadata and raw data.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_create(H5F_t *f, size_t page_size, size_t buf_size,
+    unsigned min_meta_perc, unsigned min_raw_perc)
+{
+    H5PB_t *pb = NULL;                  /* New page buffer */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(f);
+    HDassert(f->shared);
+    HDassert(NULL == f->shared->page_buf);
+    HDassert(page_size >= H5PB_MIN_PAGE_SIZE);
+    HDassert(min_meta_perc + min_raw_perc <= 100);
+
+    if(buf_size < page_size)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page buffer size is smaller than a page")
+
+    /* Allocate the page buffer */
+    if(NULL == (pb = H5FL_CALLOC(H5PB_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for page buffer")
+
+    pb->page_size = page_size;
+    pb->max_pages = buf_size / page_size;
+    pb->min_meta_pages = (pb->max_pages * min_meta_perc) / 100;
+    pb->min_raw_pages = (pb->max_pages * min_raw_perc) / 100;
+
+    if(NULL == (pb->page_fac = H5FL_fac_init(page_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINIT, FAIL, "can't create page factory")
+    if(NULL == (pb->slist = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTCREATE, FAIL, "can't create skip list for pages")
+
+    f->shared->page_buf = pb;
+
+done:
+    if(ret_value < 0 && pb) {
+        if(pb->slist && H5SL_close(pb->slist) < 0)
+            HDONE_ERROR(H5E_RESOURCE, H5E_CANTCLOSEOBJ, FAIL, "can't close skip list for pages")
+        if(pb->page_fac && H5FL_fac_term(pb->page_fac) < 0)
+            HDONE_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "can't release page factory")
+        pb = H5FL_FREE(H5PB_t, pb);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_create() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_flush
+ *
+ * Purpose:	Write all dirty pages of the file's page buffer to the
+ *		metadata accumulator (and so to the file), in address
+ *		order.  The pages stay in the page buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_flush(const H5F_io_info_t *fio_info)
+{
+    H5PB_t *pb;                         /* File's page buffer */
+    H5SL_node_t *node;                  /* Current page's skip list node */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+
+    /* Nothing to do if the file doesn't have a page buffer */
+    if(NULL == (pb = fio_info->f->shared->page_buf))
+        HGOTO_DONE(SUCCEED)
+
+    for(node = H5SL_first(pb->slist); node; node = H5SL_next(node)) {
+        H5PB_entry_t *entry = (H5PB_entry_t *)H5SL_item(node);
+
+        if(entry->is_dirty)
+            if(H5PB__write_entry(fio_info, entry) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write page")
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_flush() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_dest
+ *
+ * Purpose:	Flush (if the file is open for writing) and destroy the
+ *		file's page buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_dest(const H5F_io_info_t *fio_info)
+{
+    H5PB_t *pb;                         /* File's page buffer */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+
+    /* Nothing to do if the file doesn't have a page buffer */
+    if(NULL == (pb = fio_info->f->shared->page_buf))
+        HGOTO_DONE(SUCCEED)
+
+    /* Write out the dirty pages */
+    if(H5F_INTENT(fio_info->f) & H5F_ACC_RDWR)
+        if(H5PB_flush(fio_info) < 0)
+            /* Push error, but keep going*/
+            HDONE_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush page buffer")
+
+    /* Release the pages */
+    if(H5SL_destroy(pb->slist, H5PB__free_entry_cb, pb) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTCLOSEOBJ, FAIL, "can't destroy skip list for pages")
+    if(H5FL_fac_term(pb->page_fac) < 0)
+        /* Push error, but keep going*/
+        HDONE_ERROR(H5E_RESOURCE, H5E_CANTRELEASE, FAIL, "can't release page factory")
+
+    fio_info->f->shared->page_buf = H5FL_FREE(H5PB_t, pb);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_dest() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_read
+ *
+ * Purpose:	Reads SIZE bytes at ADDR into BUF through the file's page
+ *		buffer.  Without a page buffer, this is a read through the
+ *		metadata accumulator.
+ *
+ *		Reads of a page or more go to the file, and then pick up
+ *		any newer data held in dirty pages.  Smaller reads are
+ *		served from the pages holding them, which are loaded
+ *		whole on a miss.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_read(const H5F_io_info_t *fio_info, H5FD_mem_t type, haddr_t addr,
+    size_t size, void *buf/*out*/)
+{
+    H5PB_t *pb;                         /* File's page buffer */
+    H5PB_entry_t *entry;                /* Page holding (part of) the read */
+    haddr_t first_page;                 /* Address of first page touched */
+    haddr_t page_addr;                  /* Address of current page */
+    haddr_t end = addr + size;          /* End of the read */
+    unsigned idx;                       /* Statistics index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+    HDassert(buf);
+
+    /* Pass through to the metadata accumulator without a page buffer */
+    if(NULL == (pb = fio_info->f->shared->page_buf)) {
+        if(H5F__accum_read(fio_info, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through metadata accumulator failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    idx = H5PB__STATS_IDX(type != H5FD_MEM_DRAW);
+    first_page = (addr / pb->page_size) * pb->page_size;
+
+    if(size >= pb->page_size) {
+        H5SL_node_t *node;              /* Skip list node for page */
+
+        pb->accesses[idx]++;
+        pb->bypasses[idx]++;
+
+        if(H5F__accum_read(fio_info, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through metadata accumulator failed")
+
+        /* Overlay the data in dirty pages, which is newer than the file's */
+        for(node = H5SL_above(pb->slist, &first_page); node; node = H5SL_next(node)) {
+            haddr_t lo, hi;             /* Bounds of the overlap */
+
+            entry = (H5PB_entry_t *)H5SL_item(node);
+            if(entry->addr >= end)
+                break;
+            if(!entry->is_dirty)
+                continue;
+
+            lo = MAX(addr, entry->addr);
+            hi = MIN(end, entry->addr + pb->page_size);
+            HDmemcpy((uint8_t *)buf + (lo - addr), entry->image + (lo - entry->addr), (size_t)(hi - lo));
+        } /* end for */
+    } /* end if */
+    else {
+        for(page_addr = first_page; page_addr < end; page_addr += pb->page_size) {
+            haddr_t lo = MAX(addr, page_addr);                 /* Start of the read in this page */
+            haddr_t hi = MIN(end, page_addr + pb->page_size);  /* End of the read in this page */
+
+            pb->accesses[idx]++;
+
+            if(NULL != (entry = (H5PB_entry_t *)H5SL_search(pb->slist, &page_addr))) {
+                pb->hits[idx]++;
+                H5PB__LRU_REMOVE(pb, entry)
+                H5PB__LRU_PREPEND(pb, entry)
+            } /* end if */
+            else {
+                if(H5PB__load_page(fio_info, pb, type, page_addr, &entry) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't load page")
+
+                /* Read the piece in this page directly if there's no room for it */
+                if(NULL == entry) {
+                    pb->bypasses[idx]++;
+                    if(H5F__accum_read(fio_info, type, lo, (size_t)(hi - lo), (uint8_t *)buf + (lo - addr)) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through metadata accumulator failed")
+                    continue;
+                } /* end if */
+                pb->misses[idx]++;
+            } /* end else */
+
+            HDmemcpy((uint8_t *)buf + (lo - addr), entry->image + (lo - page_addr), (size_t)(hi - lo));
+        } /* end for */
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_write
+ *
+ * Purpose:	Writes SIZE bytes from BUF to ADDR through the file's page
+ *		buffer.  Without a page buffer, this is a write through the
+ *		metadata accumulator.
+ *
+ *		Writes of a page or more go to the file, and update the
+ *		pages held for the same region.  Smaller writes are made
+ *		to the pages holding them, and reach the file when the
+ *		page is evicted or the page buffer is flushed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_write(const H5F_io_info_t *fio_info, H5FD_mem_t type, haddr_t addr,
+    size_t size, const void *buf)
+{
+    H5PB_t *pb;                         /* File's page buffer */
+    H5PB_entry_t *entry;                /* Page holding (part of) the write */
+    haddr_t first_page;                 /* Address of first page touched */
+    haddr_t page_addr;                  /* Address of current page */
+    haddr_t end = addr + size;          /* End of the write */
+    unsigned idx;                       /* Statistics index */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_NOAPI(FAIL)
+
+    /* Sanity checks */
+    HDassert(fio_info);
+    HDassert(fio_info->f);
+    HDassert(buf);
+
+    /* Pass through to the metadata accumulator without a page buffer */
+    if(NULL == (pb = fio_info->f->shared->page_buf)) {
+        if(H5F__accum_write(fio_info, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through metadata accumulator failed")
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    idx = H5PB__STATS_IDX(type != H5FD_MEM_DRAW);
+    first_page = (addr / pb->page_size) * pb->page_size;
+
+    if(size >= pb->page_size) {
+        H5SL_node_t *node;              /* Skip list node for page */
+
+        pb->accesses[idx]++;
+        pb->bypasses[idx]++;
+
+        if(H5F__accum_write(fio_info, type, addr, size, buf) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through metadata accumulator failed")
+
+        /* Bring the pages held for the region up to date */
+        for(node = H5SL_above(pb->slist, &first_page); node; node = H5SL_next(node)) {
+            haddr_t lo, hi;             /* Bounds of the overlap */
+
+            entry = (H5PB_entry_t *)H5SL_item(node);
+            if(entry->addr >= end)
+                break;
+
+            lo = MAX(addr, entry->addr);
+            hi = MIN(end, entry->addr + pb->page_size);
+            HDmemcpy(entry->image + (lo - entry->addr), (const uint8_t *)buf + (lo - addr), (size_t)(hi - lo));
+        } /* end for */
+    } /* end if */
+    else {
+        for(page_addr = first_page; page_addr < end; page_addr += pb->page_size) {
+            haddr_t lo = MAX(addr, page_addr);                 /* Start of the write in this page */
+            haddr_t hi = MIN(end, page_addr + pb->page_size);  /* End of the write in this page */
+
+            pb->accesses[idx]++;
+
+            if(NULL != (entry = (H5PB_entry_t *)H5SL_search(pb->slist, &page_addr))) {
+                pb->hits[idx]++;
+                H5PB__LRU_REMOVE(pb, entry)
+                H5PB__LRU_PREPEND(pb, entry)
+            } /* end if */
+            else {
+                if(H5PB__load_page(fio_info, pb, type, page_addr, &entry) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "can't load page")
+
+                /* Write the piece in this page directly if there's no room for it */
+                if(NULL == entry) {
+                    pb->bypasses[idx]++;
+                    if(H5F__accum_write(fio_info, type, lo, (size_t)(hi - lo), (const uint8_t *)buf + (lo - addr)) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through metadata accumulator failed")
+                    continue;
+                } /* end if */
+                pb->misses[idx]++;
+            } /* end else */
+
+            HDmemcpy(entry->image + (lo - page_addr), (const uint8_t *)buf + (lo - addr), (size_t)(hi - lo));
+            entry->is_dirty = TRUE;
+        } /* end for */
+    } /* end else */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_get_stats
+ *
+ * Purpose:	Retrieve the statistics of a page buffer.  Each array is
+ *		indexed by 0 for metadata and 1 for raw data.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_get_stats(const H5PB_t *pb, unsigned accesses[2], unsigned hits[2],
+    unsigned misses[2], unsigned evictions[2], unsigned bypasses[2])
+{
+    unsigned u;                         /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(pb);
+
+    for(u = 0; u < 2; u++) {
+        if(accesses)
+            accesses[u] = pb->accesses[u];
+        if(hits)
+            hits[u] = pb->hits[u];
+        if(misses)
+            misses[u] = pb->misses[u];
+        if(evictions)
+            evictions[u] = pb->evictions[u];
+        if(bypasses)
+            bypasses[u] = pb->bypasses[u];
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5PB_get_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB_reset_stats
+ *
+ * Purpose:	Reset the statistics of a page buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5PB_reset_stats(H5PB_t *pb)
+{
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Sanity check */
+    HDassert(pb);
+
+    HDmemset(pb->accesses, 0, sizeof(pb->accesses));
+    HDmemset(pb->hits, 0, sizeof(pb->hits));
+    HDmemset(pb->misses, 0, sizeof(pb->misses));
+    HDmemset(pb->evictions, 0, sizeof(pb->evictions));
+    HDmemset(pb->bypasses, 0, sizeof(pb->bypasses));
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5PB_reset_stats() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__write_entry
+ *
+ * Purpose:	Write a dirty page through the metadata accumulator, and
+ *		mark it clean.  Only the part of the page below the EOA is
+ *		written, as the end of the file may have been freed (and
+ *		the file truncated) since the page was dirtied.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__write_entry(const H5F_io_info_t *fio_info, H5PB_entry_t *entry)
+{
+    H5PB_t *pb = fio_info->f->shared->page_buf; /* File's page buffer */
+    haddr_t eoa;                        /* End of allocated space for page's type */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(pb);
+    HDassert(entry);
+    HDassert(entry->is_dirty);
+
+    if(HADDR_UNDEF == (eoa = H5F_get_eoa(fio_info->f, entry->type)))
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "can't get EOA")
+
+    if(H5F_addr_lt(entry->addr, eoa)) {
+        size_t len = (size_t)MIN((haddr_t)pb->page_size, eoa - entry->addr);   /* Amount to write */
+
+        if(H5F__accum_write(fio_info, entry->type, entry->addr, len, entry->image) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "write through metadata accumulator failed")
+    } /* end if */
+
+    entry->is_dirty = FALSE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__write_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__evict_entry
+ *
+ * Purpose:	Write a page if it's dirty, then remove it from the page
+ *		buffer and release it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__evict_entry(const H5F_io_info_t *fio_info, H5PB_t *pb, H5PB_entry_t *entry)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(pb);
+    HDassert(entry);
+
+    if(entry->is_dirty)
+        if(H5PB__write_entry(fio_info, entry) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "can't write page")
+
+    if(entry != H5SL_remove(pb->slist, &entry->addr))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTDELETE, FAIL, "can't remove page from skip list")
+    H5PB__LRU_REMOVE(pb, entry)
+    if(entry->is_meta)
+        pb->meta_count--;
+    else
+        pb->raw_count--;
+
+    entry->image = (uint8_t *)H5FL_FAC_FREE(pb->page_fac, entry->image);
+    entry = H5FL_FREE(H5PB_entry_t, entry);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__evict_entry() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__make_space
+ *
+ * Purpose:	Make room for a new metadata (IS_META) or raw data page,
+ *		evicting the least recently used page that may go: a page
+ *		of the same kind, or one of the other kind if that kind
+ *		holds more than its reserved number of pages.
+ *
+ *		*ROOM is set to FALSE if no page can be evicted, in which
+ *		case the access must bypass the page buffer.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__make_space(const H5F_io_info_t *fio_info, H5PB_t *pb, hbool_t is_meta,
+    hbool_t *room)
+{
+    H5PB_entry_t *entry;                /* Eviction candidate */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(pb);
+    HDassert(room);
+
+    *room = TRUE;
+    if(pb->meta_count + pb->raw_count < pb->max_pages)
+        HGOTO_DONE(SUCCEED)
+
+    for(entry = pb->LRU_tail; entry; entry = entry->prev) {
+        if(entry->is_meta == is_meta)
+            break;
+        if(entry->is_meta ? (pb->meta_count > pb->min_meta_pages) : (pb->raw_count > pb->min_raw_pages))
+            break;
+    } /* end for */
+
+    if(NULL == entry) {
+        *room = FALSE;
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    pb->evictions[H5PB__STATS_IDX(entry->is_meta)]++;
+    if(H5PB__evict_entry(fio_info, pb, entry) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTEXPUNGE, FAIL, "can't evict page")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__make_space() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__load_page
+ *
+ * Purpose:	Read the page at PAGE_ADDR into the page buffer, evicting
+ *		another page if needed, and make it the most recently used
+ *		page.  The part of the page past the EOA is zeroed.
+ *
+ *		*ENTRY_PTR is set to NULL if there's no room for the page.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__load_page(const H5F_io_info_t *fio_info, H5PB_t *pb, H5FD_mem_t type,
+    haddr_t page_addr, H5PB_entry_t **entry_ptr)
+{
+    H5PB_entry_t *entry = NULL;         /* New page */
+    hbool_t is_meta = (type != H5FD_MEM_DRAW);  /* Whether the page holds metadata */
+    hbool_t room;                       /* Whether there's room for the page */
+    haddr_t eoa;                        /* End of allocated space for type */
+    size_t len;                         /* Amount of the page to read */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(pb);
+    HDassert(entry_ptr);
+
+    *entry_ptr = NULL;
+
+    if(H5PB__make_space(fio_info, pb, is_meta, &room) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't make room for page")
+    if(!room)
+        HGOTO_DONE(SUCCEED)
+
+    if(HADDR_UNDEF == (eoa = H5F_get_eoa(fio_info->f, type)))
+        HGOTO_ERROR(H5E_IO, H5E_CANTGET, FAIL, "can't get EOA")
+    HDassert(H5F_addr_lt(page_addr, eoa));
+    len = (size_t)MIN((haddr_t)pb->page_size, eoa - page_addr);
+
+    if(NULL == (entry = H5FL_CALLOC(H5PB_entry_t)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for page")
+    if(NULL == (entry->image = (uint8_t *)H5FL_FAC_MALLOC(pb->page_fac)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "memory allocation failed for page image")
+    entry->addr = page_addr;
+    entry->type = type;
+    entry->is_meta = is_meta;
+
+    if(H5F__accum_read(fio_info, type, page_addr, len, entry->image) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "read through metadata accumulator failed")
+    if(len < pb->page_size)
+        HDmemset(entry->image + len, 0, pb->page_size - len);
+
+    if(H5SL_insert(pb->slist, entry, &entry->addr) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_CANTINSERT, FAIL, "can't insert page in skip list")
+    H5PB__LRU_PREPEND(pb, entry)
+    if(is_meta)
+        pb->meta_count++;
+    else
+        pb->raw_count++;
+
+    *entry_ptr = entry;
+
+done:
+    if(ret_value < 0 && entry) {
+        if(entry->image)
+            entry->image = (uint8_t *)H5FL_FAC_FREE(pb->page_fac, entry->image);
+        entry = H5FL_FREE(H5PB_entry_t, entry);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5PB__load_page() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5PB__free_entry_cb
+ *
+ * Purpose:	Skip list callback to release a page when the page buffer
+ *		is destroyed.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5PB__free_entry_cb(void *item, void H5_ATTR_UNUSED *key, void *op_data)
+{
+    H5PB_entry_t *entry = (H5PB_entry_t *)item; /* Page to release */
+    H5PB_t *pb = (H5PB_t *)op_data;     /* Page buffer */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(entry);
+    HDassert(pb);
+
+    entry->image = (uint8_t *)H5FL_FAC_FREE(pb->page_fac, entry->image);
+    entry = H5FL_FREE(H5PB_entry_t, entry);
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5PB__free_entry_cb() */
+
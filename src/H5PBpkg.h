@@ -0,0 +1,94 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	This file contains declarations which are visible only within
+ *		the H5PB package.  Source files outside the H5PB package should
+ *		include H5PBprivate.h instead.
+ */
+#if !(defined H5PB_FRIEND || defined H5PB_MODULE)
+#error "Do not include this file outside the H5PB package!"
+#endif
+
+#ifndef _H5PBpkg_H
+#define _H5PBpkg_H
+
+/* Get package's private header */
+#include "H5PBprivate.h"
+
+/* Other private headers needed by this file */
+#include "H5FLprivate.h"	/* Free Lists                           */
+#include "H5SLprivate.h"	/* Skip lists				*/
+
+
+/**************************/
+/* Package Private Macros */
+/**************************/
+
+/* Index of the metadata and raw data statistics */
+#define H5PB__STATS_META                0
+#define H5PB__STATS_RAW                 1
+
+
+/****************************/
+/* Package Private Typedefs */
+/****************************/
+
+/* A page of the file held in the page buffer */
+typedef struct H5PB_entry_t {
+    haddr_t     addr;           /* Address of the page in the file */
+    uint8_t     *image;         /* The page's contents */
+    H5FD_mem_t  type;           /* Type of data the page was loaded for */
+    hbool_t     is_meta;        /* Whether the page counts against the metadata quota */
+    hbool_t     is_dirty;       /* Whether the page must be written to the file */
+    struct H5PB_entry_t *next;  /* Next (less recently used) page in the LRU list */
+    struct H5PB_entry_t *prev;  /* Previous (more recently used) page in the LRU list */
+} H5PB_entry_t;
+
+/* The page buffer for a file */
+struct H5PB_t {
+    /* Configuration */
+    size_t      page_size;      /* Size of a page, in bytes */
+    size_t      max_pages;      /* Number of pages the buffer may hold */
+    size_t      min_meta_pages; /* Number of pages reserved for metadata */
+    size_t      min_raw_pages;  /* Number of pages reserved for raw data */
+    H5FL_fac_head_t *page_fac;  /* Factory for page images */
+
+    /* Pages held */
+    H5SL_t      *slist;         /* Pages, indexed by address */
+    size_t      meta_count;     /* Number of metadata pages held */
+    size_t      raw_count;      /* Number of raw data pages held */
+    H5PB_entry_t *LRU_head;     /* Most recently used page */
+    H5PB_entry_t *LRU_tail;     /* Least recently used page */
+
+    /* Statistics, indexed by H5PB__STATS_META and H5PB__STATS_RAW */
+    unsigned    accesses[2];    /* Page accesses */
+    unsigned    hits[2];        /* Accesses served from a held page */
+    unsigned    misses[2];      /* Accesses that loaded a page */
+    unsigned    evictions[2];   /* Pages evicted to make room */
+    unsigned    bypasses[2];    /* Accesses that went straight to the file */
+};
+
+
+/*****************************/
+/* Package Private Variables */
+/*****************************/
+
+
+/******************************/
+/* Package Private Prototypes */
+/******************************/
+
+#endif /* _H5PBpkg_H */
+
@@ -151,6 +151,27 @@
 /* Definitions for type conversion callback function property */
 #define H5D_XFER_CONV_CB_SIZE       sizeof(H5T_conv_cb_t)
 #define H5D_XFER_CONV_CB_DEF        {NULL,NULL}
+/* Definitions for type conversion thread count property */
+#define H5D_XFER_CONV_NTHREADS_SIZE     sizeof(unsigned)
+#define H5D_XFER_CONV_NTHREADS_DEF      H5D_CONV_NTHREADS
+#define H5D_XFER_CONV_NTHREADS_SET      H5P__dxfr_conv_nthreads_set
+#define H5D_XFER_CONV_NTHREADS_ENC      H5P__encode_unsigned
+#define H5D_XFER_CONV_NTHREADS_DEC      H5P__decode_unsigned
+/* Definitions for type conversion minimum elements per thread property */
+#define H5D_XFER_CONV_MIN_ELMTS_SIZE    sizeof(size_t)
+#define H5D_XFER_CONV_MIN_ELMTS_DEF     H5D_CONV_MIN_ELMTS
+#define H5D_XFER_CONV_MIN_ELMTS_ENC     H5P__encode_size_t
+#define H5D_XFER_CONV_MIN_ELMTS_DEC     H5P__decode_size_t
+/* Definitions for member file I/O thread count property */
+#define H5D_XFER_MEMB_IO_NTHREADS_SIZE  sizeof(unsigned)
+#define H5D_XFER_MEMB_IO_NTHREADS_DEF   H5D_MEMB_IO_NTHREADS
+#define H5D_XFER_MEMB_IO_NTHREADS_ENC   H5P__encode_unsigned
+#define H5D_XFER_MEMB_IO_NTHREADS_DEC   H5P__decode_unsigned
+/* Definitions for member file I/O minimum bytes per thread property */
+#define H5D_XFER_MEMB_IO_MIN_SIZE_SIZE  sizeof(size_t)
+#define H5D_XFER_MEMB_IO_MIN_SIZE_DEF   H5D_MEMB_IO_MIN_SIZE
+#define H5D_XFER_MEMB_IO_MIN_SIZE_ENC   H5P__encode_size_t
+#define H5D_XFER_MEMB_IO_MIN_SIZE_DEC   H5P__decode_size_t
 /* Definitions for data transform property */
 #define H5D_XFER_XFORM_SIZE         sizeof(void *)
 #define H5D_XFER_XFORM_DEF          NULL
@@ -219,6 +240,7 @@ static herr_t H5P__dxfr_mpio_chunk_opt_hard_enc(const void *value, void **pp, si
 static herr_t H5P__dxfr_mpio_chunk_opt_hard_dec(const void **pp, void *value);
 static herr_t H5P__dxfr_edc_enc(const void *value, void **pp, size_t *size);
 static herr_t H5P__dxfr_edc_dec(const void **pp, void *value);
+static herr_t H5P__dxfr_conv_nthreads_set(hid_t prop_id, const char *name, size_t size, void *value);
 static herr_t H5P__dxfr_xform_set(hid_t prop_id, const char* name, size_t size, void* value);
 static herr_t H5P__dxfr_xform_get(hid_t prop_id, const char* name, size_t size, void* value);
 static herr_t H5P__dxfr_xform_enc(const void *value, void **pp, size_t *size);
@@ -257,6 +279,8 @@ const H5P_libclass_t H5P_CLS_DXFR[1] = {{
 /* Library Private Variables */
 /*****************************/
 
+/* Datatype conversion thread count in the default property list */
+unsigned H5P_def_conv_nthreads_g = H5D_XFER_CONV_NTHREADS_DEF;
 
 /***************************/
 /* Local Private Variables */
@@ -290,6 +314,10 @@ static const H5P_coll_md_read_flag_t H5D_def_coll_md_read_g = H5D_XFER_COLL_MD_R
 static const H5Z_EDC_t H5D_def_enable_edc_g = H5D_XFER_EDC_DEF;            /* Default value for EDC property */
 static const H5Z_cb_t H5D_def_filter_cb_g = H5D_XFER_FILTER_CB_DEF;        /* Default value for filter callback */
 static const H5T_conv_cb_t H5D_def_conv_cb_g = H5D_XFER_CONV_CB_DEF;       /* Default value for datatype conversion callback */
+static const unsigned H5D_def_conv_nthreads_g = H5D_XFER_CONV_NTHREADS_DEF;   /* Default value for datatype conversion thread count */
+static const size_t H5D_def_conv_min_elmts_g = H5D_XFER_CONV_MIN_ELMTS_DEF;  /* Default value for datatype conversion elements per thread */
+static const unsigned H5D_def_memb_io_nthreads_g = H5D_XFER_MEMB_IO_NTHREADS_DEF;   /* Default value for member file I/O thread count */
+static const size_t H5D_def_memb_io_min_size_g = H5D_XFER_MEMB_IO_MIN_SIZE_DEF;  /* Default value for member file I/O bytes per thread */
 static const void *H5D_def_xfer_xform_g = H5D_XFER_XFORM_DEF;          /* Default value for data transform */
 static const hbool_t H5D_def_direct_chunk_flag_g = H5D_XFER_DIRECT_CHUNK_WRITE_FLAG_DEF; 	/* Default value for the flag of direct chunk write */
 static const uint32_t H5D_def_direct_chunk_filters_g = H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_DEF;	/* Default value for the filters of direct chunk write */
@@ -469,6 +497,31 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the type conversion thread count property */
+    if(H5P_register_real(pclass, H5D_XFER_CONV_NTHREADS_NAME, H5D_XFER_CONV_NTHREADS_SIZE, &H5D_def_conv_nthreads_g,
+            NULL, H5D_XFER_CONV_NTHREADS_SET, NULL, H5D_XFER_CONV_NTHREADS_ENC, H5D_XFER_CONV_NTHREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+    H5P_def_conv_nthreads_g = H5D_def_conv_nthreads_g;
+
+    /* Register the type conversion minimum elements per thread property */
+    if(H5P_register_real(pclass, H5D_XFER_CONV_MIN_ELMTS_NAME, H5D_XFER_CONV_MIN_ELMTS_SIZE, &H5D_def_conv_min_elmts_g,
+            NULL, NULL, NULL, H5D_XFER_CONV_MIN_ELMTS_ENC, H5D_XFER_CONV_MIN_ELMTS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the member file I/O thread count property */
+    if(H5P_register_real(pclass, H5D_XFER_MEMB_IO_NTHREADS_NAME, H5D_XFER_MEMB_IO_NTHREADS_SIZE, &H5D_def_memb_io_nthreads_g,
+            NULL, NULL, NULL, H5D_XFER_MEMB_IO_NTHREADS_ENC, H5D_XFER_MEMB_IO_NTHREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the member file I/O minimum bytes per thread property */
+    if(H5P_register_real(pclass, H5D_XFER_MEMB_IO_MIN_SIZE_NAME, H5D_XFER_MEMB_IO_MIN_SIZE_SIZE, &H5D_def_memb_io_min_size_g,
+            NULL, NULL, NULL, H5D_XFER_MEMB_IO_MIN_SIZE_ENC, H5D_XFER_MEMB_IO_MIN_SIZE_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the data transform property */
     if(H5P_register_real(pclass, H5D_XFER_XFORM_NAME, H5D_XFER_XFORM_SIZE, &H5D_def_xfer_xform_g,
             NULL, H5D_XFER_XFORM_SET, H5D_XFER_XFORM_GET, H5D_XFER_XFORM_ENC, H5D_XFER_XFORM_DEC, 
@@ -685,6 +738,34 @@ done:
 } /* end H5P__dxfr_btree_split_ratio_dec() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dxfr_conv_nthreads_set
+ *
+ * Purpose:     Keeps H5P_def_conv_nthreads_g up to date when the
+ *              datatype conversion thread count of the default data
+ *              transfer property list is set, so that H5T_convert()
+ *              doesn't have to look it up.
+ *
+ * Return:      Non-negative (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dxfr_conv_nthreads_set(hid_t prop_id, const char H5_ATTR_UNUSED *name,
+    size_t H5_ATTR_UNUSED size, void *value)
+{
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(value);
+
+    if(H5P_LST_DATASET_XFER_ID_g == prop_id)
+        H5P_def_conv_nthreads_g = *(const unsigned *)value;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dxfr_conv_nthreads_set() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    H5P__dxfr_xform_set
  *
@@ -1523,6 +1604,172 @@ done:
     FUNC_LEAVE_API(ret_value)
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_type_conv_threads
+ *
+ * Purpose:     Sets the number of threads used to convert large buffers
+ *              between datatypes and the minimum number of elements each
+ *              thread is given.  Only conversions that process each
+ *              element independently (the hardware conversions, byte-order
+ *              swapping, floating-point and optimized compound
+ *              conversions) are split across threads, and only when the
+ *              library is built thread-safe.  A thread count of one
+ *              (the default) converts on the calling thread.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_type_conv_threads(hid_t plist_id, unsigned nthreads, size_t min_elmts)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuz", plist_id, nthreads, min_elmts);
+
+    /* Check arguments */
+    if(nthreads == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "thread count must not be zero")
+    if(min_elmts == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "minimum elements per thread must not be zero")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_CONV_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+    if(H5P_set(plist, H5D_XFER_CONV_MIN_ELMTS_NAME, &min_elmts) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_type_conv_threads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_type_conv_threads
+ *
+ * Purpose:     Retrieves the datatype conversion thread settings set with
+ *              H5Pset_type_conv_threads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_type_conv_threads(hid_t plist_id, unsigned *nthreads/*out*/,
+    size_t *min_elmts/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, nthreads, min_elmts);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(nthreads)
+        if(H5P_get(plist, H5D_XFER_CONV_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+    if(min_elmts)
+        if(H5P_get(plist, H5D_XFER_CONV_MIN_ELMTS_NAME, min_elmts) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_type_conv_threads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_member_io_threads
+ *
+ * Purpose:     Sets the number of threads used to access the member files
+ *              of a family file concurrently, when one request spans
+ *              several of them, and the minimum number of bytes each
+ *              thread is given.  This pays off when the members are on
+ *              different devices.  Threads are only used when the
+ *              library is built thread-safe; a thread count of one (the
+ *              default) accesses the members one after another on the
+ *              calling thread.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_member_io_threads(hid_t plist_id, unsigned nthreads, size_t min_size)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iIuz", plist_id, nthreads, min_size);
+
+    /* Check arguments */
+    if(nthreads == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "thread count must not be zero")
+    if(min_size == 0)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "minimum bytes per thread must not be zero")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_MEMB_IO_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+    if(H5P_set(plist, H5D_XFER_MEMB_IO_MIN_SIZE_NAME, &min_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_member_io_threads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_member_io_threads
+ *
+ * Purpose:     Retrieves the member file I/O thread settings set with
+ *              H5Pset_member_io_threads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_member_io_threads(hid_t plist_id, unsigned *nthreads/*out*/,
+    size_t *min_size/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, nthreads, min_size);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(nthreads)
+        if(H5P_get(plist, H5D_XFER_MEMB_IO_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+    if(min_size)
+        if(H5P_get(plist, H5D_XFER_MEMB_IO_MIN_SIZE_NAME, min_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_member_io_threads() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pget_btree_ratios
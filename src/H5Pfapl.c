@@ -42,6 +42,7 @@
 #include "H5FDprivate.h"	/* File drivers				*/
 #include "H5Iprivate.h"		/* IDs			  		*/
 #include "H5MMprivate.h"        /* Memory Management                    */
+#include "H5PBprivate.h"        /* Page buffer                          */
 #include "H5Ppkg.h"		/* Property lists		  	*/
 
 /* Includes needed to set as default file driver */
@@ -178,6 +179,16 @@
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEF       524288
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_ENC       H5P__encode_size_t
 #define H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEC       H5P__decode_size_t
+/* Definition of core VFD mmap flag */
+#define H5F_ACS_CORE_MMAP_FLAG_SIZE             sizeof(hbool_t)
+#define H5F_ACS_CORE_MMAP_FLAG_DEF              FALSE
+#define H5F_ACS_CORE_MMAP_FLAG_ENC              H5P__encode_hbool_t
+#define H5F_ACS_CORE_MMAP_FLAG_DEC              H5P__decode_hbool_t
+/* Definition of core VFD background write-back flag */
+#define H5F_ACS_CORE_WRITE_BACK_FLAG_SIZE       sizeof(hbool_t)
+#define H5F_ACS_CORE_WRITE_BACK_FLAG_DEF        FALSE
+#define H5F_ACS_CORE_WRITE_BACK_FLAG_ENC        H5P__encode_hbool_t
+#define H5F_ACS_CORE_WRITE_BACK_FLAG_DEC        H5P__decode_hbool_t
 /* Definition for # of metadata read attempts */
 #define H5F_ACS_METADATA_READ_ATTEMPTS_SIZE	sizeof(unsigned)
 #define H5F_ACS_METADATA_READ_ATTEMPTS_DEF     	0
@@ -208,11 +219,38 @@
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF     FALSE
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_ENC     H5P__encode_hbool_t
 #define H5F_ACS_START_MDC_LOG_ON_ACCESS_DEC     H5P__decode_hbool_t
+/* Definition for metadata cache log format */
+#define H5F_ACS_MDC_LOG_FORMAT_SIZE             sizeof(H5AC_log_format_t)
+#define H5F_ACS_MDC_LOG_FORMAT_DEF              H5AC_LOG_FORMAT_JSON
+#define H5F_ACS_MDC_LOG_FORMAT_ENC              H5P__facc_mdc_log_format_enc
+#define H5F_ACS_MDC_LOG_FORMAT_DEC              H5P__facc_mdc_log_format_dec
+/* Definition for metadata cache log sampling interval */
+#define H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_SIZE    sizeof(unsigned)
+#define H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_DEF     1
+#define H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_ENC     H5P__encode_unsigned
+#define H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_DEC     H5P__decode_unsigned
 /* Definition for evict on close property */
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_SIZE                sizeof(hbool_t)
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF                 FALSE
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_ENC                 H5P__encode_hbool_t
 #define H5F_ACS_EVICT_ON_CLOSE_FLAG_DEC                 H5P__decode_hbool_t
+/* Definitions for the page buffer */
+#define H5F_ACS_PAGE_BUFFER_SIZE_SIZE           sizeof(size_t)
+#define H5F_ACS_PAGE_BUFFER_SIZE_DEF            0       /* Page buffering disabled */
+#define H5F_ACS_PAGE_BUFFER_SIZE_ENC            H5P__encode_size_t
+#define H5F_ACS_PAGE_BUFFER_SIZE_DEC            H5P__decode_size_t
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_SIZE      sizeof(size_t)
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_DEF       0       /* Use the default page size */
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_ENC       H5P__encode_size_t
+#define H5F_ACS_PAGE_BUFFER_PAGE_SIZE_DEC       H5P__decode_size_t
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_SIZE  sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF   0
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_ENC   H5P__encode_unsigned
+#define H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEC   H5P__decode_unsigned
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_SIZE   sizeof(unsigned)
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF    0
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC    H5P__encode_unsigned
+#define H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC    H5P__decode_unsigned
 #ifdef H5_HAVE_PARALLEL
 /* Definition of collective metadata read mode flag */
 #define H5F_ACS_COLL_MD_READ_FLAG_SIZE   sizeof(H5P_coll_md_read_flag_t)
@@ -286,6 +324,10 @@ static herr_t H5P_facc_mdc_log_location_copy(const char *name, size_t size, void
 static int    H5P_facc_mdc_log_location_cmp(const void *value1, const void *value2, size_t size);
 static herr_t H5P_facc_mdc_log_location_close(const char *name, size_t size, void *value);
 
+/* Metadata cache log format property callbacks */
+static herr_t H5P__facc_mdc_log_format_enc(const void *value, void **_pp, size_t *size);
+static herr_t H5P__facc_mdc_log_format_dec(const void **_pp, void *value);
+
 /* Metadata cache image property callbacks */
 static int H5P__facc_cache_image_config_cmp(const void *_config1, const void *_config2, size_t H5_ATTR_UNUSED size);
 static herr_t H5P__facc_cache_image_config_enc(const void *value, void **_pp, size_t *size);
@@ -347,13 +389,21 @@ static const unsigned H5F_def_efc_size_g = H5F_ACS_EFC_SIZE_DEF;
 static const H5FD_file_image_info_t H5F_def_file_image_info_g = H5F_ACS_FILE_IMAGE_INFO_DEF;                 /* Default file image info and callbacks */
 static const hbool_t H5F_def_core_write_tracking_flag_g = H5F_ACS_CORE_WRITE_TRACKING_FLAG_DEF;              /* Default setting for core VFD write tracking */
 static const size_t H5F_def_core_write_tracking_page_size_g = H5F_ACS_CORE_WRITE_TRACKING_PAGE_SIZE_DEF;     /* Default core VFD write tracking page size */
+static const hbool_t H5F_def_core_mmap_flag_g = H5F_ACS_CORE_MMAP_FLAG_DEF;                                  /* Default setting for core VFD mmap */
+static const hbool_t H5F_def_core_write_back_flag_g = H5F_ACS_CORE_WRITE_BACK_FLAG_DEF;                      /* Default setting for core VFD background write-back */
 static const unsigned H5F_def_metadata_read_attempts_g = H5F_ACS_METADATA_READ_ATTEMPTS_DEF;  /* Default setting for the # of metadata read attempts */
 static const H5F_object_flush_t H5F_def_object_flush_cb_g = H5F_ACS_OBJECT_FLUSH_CB_DEF;      /* Default setting for object flush callback */
 static const hbool_t H5F_def_clear_status_flags_g = H5F_ACS_CLEAR_STATUS_FLAGS_DEF;           /* Default to clear the superblock status_flags */
 static const hbool_t H5F_def_use_mdc_logging_g = H5F_ACS_USE_MDC_LOGGING_DEF;                 /* Default metadata cache logging flag */
 static const char *H5F_def_mdc_log_location_g = H5F_ACS_MDC_LOG_LOCATION_DEF;                 /* Default mdc log location */
 static const hbool_t H5F_def_start_mdc_log_on_access_g = H5F_ACS_START_MDC_LOG_ON_ACCESS_DEF; /* Default mdc log start on access flag */
+static const H5AC_log_format_t H5F_def_mdc_log_format_g = H5F_ACS_MDC_LOG_FORMAT_DEF;         /* Default mdc log format */
+static const unsigned H5F_def_mdc_log_sample_interval_g = H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_DEF; /* Default mdc log sampling interval */
 static const hbool_t H5F_def_evict_on_close_flag_g = H5F_ACS_EVICT_ON_CLOSE_FLAG_DEF;         /* Default setting for evict on close property */
+static const size_t H5F_def_page_buf_size_g = H5F_ACS_PAGE_BUFFER_SIZE_DEF;                   /* Default page buffer size */
+static const size_t H5F_def_page_buf_page_size_g = H5F_ACS_PAGE_BUFFER_PAGE_SIZE_DEF;         /* Default page buffer page size */
+static const unsigned H5F_def_page_buf_min_meta_perc_g = H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEF; /* Default percentage of pages reserved for metadata */
+static const unsigned H5F_def_page_buf_min_raw_perc_g = H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEF;   /* Default percentage of pages reserved for raw data */
 #ifdef H5_HAVE_PARALLEL
 static const H5P_coll_md_read_flag_t H5F_def_coll_md_read_flag_g = H5F_ACS_COLL_MD_READ_FLAG_DEF;  /* Default setting for the collective metedata read flag */
 static const hbool_t H5F_def_coll_md_write_flag_g = H5F_ACS_COLL_MD_WRITE_FLAG_DEF;  /* Default setting for the collective metedata write flag */
@@ -515,6 +565,18 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the core VFD mmap flag */
+    if(H5P_register_real(pclass, H5F_ACS_CORE_MMAP_FLAG_NAME, H5F_ACS_CORE_MMAP_FLAG_SIZE, &H5F_def_core_mmap_flag_g, 
+            NULL, NULL, NULL, H5F_ACS_CORE_MMAP_FLAG_ENC, H5F_ACS_CORE_MMAP_FLAG_DEC, 
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the core VFD background write-back flag */
+    if(H5P_register_real(pclass, H5F_ACS_CORE_WRITE_BACK_FLAG_NAME, H5F_ACS_CORE_WRITE_BACK_FLAG_SIZE, &H5F_def_core_write_back_flag_g, 
+            NULL, NULL, NULL, H5F_ACS_CORE_WRITE_BACK_FLAG_ENC, H5F_ACS_CORE_WRITE_BACK_FLAG_DEC, 
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the # of read attempts */
     if(H5P_register_real(pclass, H5F_ACS_METADATA_READ_ATTEMPTS_NAME, H5F_ACS_METADATA_READ_ATTEMPTS_SIZE, &H5F_def_metadata_read_attempts_g, 
             NULL, NULL, NULL, H5F_ACS_METADATA_READ_ATTEMPTS_ENC, H5F_ACS_METADATA_READ_ATTEMPTS_DEC, 
@@ -548,12 +610,42 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, H5F_ACS_START_MDC_LOG_ON_ACCESS_ENC, H5F_ACS_START_MDC_LOG_ON_ACCESS_DEC, NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the mdc log format */
+    if(H5P_register_real(pclass, H5F_ACS_MDC_LOG_FORMAT_NAME, H5F_ACS_MDC_LOG_FORMAT_SIZE, &H5F_def_mdc_log_format_g,
+            NULL, NULL, NULL, H5F_ACS_MDC_LOG_FORMAT_ENC, H5F_ACS_MDC_LOG_FORMAT_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the mdc log sampling interval */
+    if(H5P_register_real(pclass, H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_NAME, H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_SIZE, &H5F_def_mdc_log_sample_interval_g,
+            NULL, NULL, NULL, H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_ENC, H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the evict on close flag */
     if(H5P_register_real(pclass, H5F_ACS_EVICT_ON_CLOSE_FLAG_NAME, H5F_ACS_EVICT_ON_CLOSE_FLAG_SIZE, &H5F_def_evict_on_close_flag_g, 
             NULL, NULL, NULL, H5F_ACS_EVICT_ON_CLOSE_FLAG_ENC, H5F_ACS_EVICT_ON_CLOSE_FLAG_DEC, 
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the page buffer size */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_SIZE_NAME, H5F_ACS_PAGE_BUFFER_SIZE_SIZE, &H5F_def_page_buf_size_g,
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_SIZE_ENC, H5F_ACS_PAGE_BUFFER_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the page buffer page size */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_SIZE, &H5F_def_page_buf_page_size_g,
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_ENC, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the percentage of the page buffer reserved for metadata */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_SIZE, &H5F_def_page_buf_min_meta_perc_g,
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_ENC, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the percentage of the page buffer reserved for raw data */
+    if(H5P_register_real(pclass, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_SIZE, &H5F_def_page_buf_min_raw_perc_g,
+            NULL, NULL, NULL, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_ENC, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_DEC, NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
 #ifdef H5_HAVE_PARALLEL
     /* Register the metadata collective read flag */
     if(H5P_register_real(pclass, H5_COLL_MD_READ_FLAG_NAME, H5F_ACS_COLL_MD_READ_FLAG_SIZE, &H5F_def_coll_md_read_flag_g, 
@@ -2905,6 +2997,9 @@ H5P__facc_cache_image_config_cmp(const void *_config1, const void *_config2, siz
     if(config1->entry_ageout < config2->entry_ageout) HGOTO_DONE(-1);
     if(config1->entry_ageout > config2->entry_ageout) HGOTO_DONE(1);
 
+    if(config1->compress_image < config2->compress_image) HGOTO_DONE(-1);
+    if(config1->compress_image > config2->compress_image) HGOTO_DONE(1);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_image_config_cmp() */
@@ -2947,10 +3042,12 @@ H5P__facc_cache_image_config_enc(const void *value, void **_pp, size_t *size)
         H5_ENCODE_UNSIGNED(*pp, config->save_resize_status);
 
         INT32ENCODE(*pp, (int32_t)config->entry_ageout);
+
+        H5_ENCODE_UNSIGNED(*pp, config->compress_image);
     } /* end if */
 
     /* Compute encoded size of fixed-size values */
-    *size += (1 + (2 * sizeof(unsigned)) + (2 * sizeof(int32_t)));
+    *size += (1 + (3 * sizeof(unsigned)) + (2 * sizeof(int32_t)));
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P__facc_cache_image_config_enc() */
@@ -3003,6 +3100,14 @@ H5P__facc_cache_image_config_dec(const void **_pp, void *_value)
 
     INT32DECODE(*pp, config->entry_ageout);
 
+    /* Version 1 configurations don't encode the compress_image field, 
+     * which is left at its default value.  Either way, the decoded 
+     * configuration is a current one.
+     */
+    if(config->version >= 2)
+        H5_DECODE_UNSIGNED(*pp, config->compress_image);
+    config->version = H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION;
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5P__facc_cache_image_config_dec() */
@@ -3844,6 +3949,89 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_core_write_tracking() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_core_mmap
+ *
+ * Purpose:	Makes the core VFD map an existing file into memory instead
+ *              of reading the whole file when it is opened, so that the
+ *              file's pages are read in as they are used.
+ *
+ *              When WRITE_BACK is set, a file opened for writing with a
+ *              backing store is mapped shared: writes reach the file's
+ *              pages directly, and the operating system writes the dirty
+ *              pages back in the background.  Otherwise the mapping is
+ *              private and the dirty pages are written back on flush.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_core_mmap(hid_t plist_id, hbool_t use_mmap, hbool_t write_back)
+{
+    H5P_genplist_t *plist;        /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ibb", plist_id, use_mmap, write_back);
+
+    /* Write-back needs the mapping */
+    if(write_back && !use_mmap)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "write-back requires mmap")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set values */
+    if(H5P_set(plist, H5F_ACS_CORE_MMAP_FLAG_NAME, &use_mmap) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD mmap flag")
+    if(H5P_set(plist, H5F_ACS_CORE_WRITE_BACK_FLAG_NAME, &write_back) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set core VFD write-back flag")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_core_mmap() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_core_mmap
+ *
+ * Purpose:	Gets the core VFD mmap and background write-back settings.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_core_mmap(hid_t plist_id, hbool_t *use_mmap, hbool_t *write_back)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "i*b*b", plist_id, use_mmap, write_back);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get values */
+    if(use_mmap) {
+        if(H5P_get(plist, H5F_ACS_CORE_MMAP_FLAG_NAME, use_mmap) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get core VFD mmap flag")
+    } /* end if */
+
+    if(write_back) {
+        if(H5P_get(plist, H5F_ACS_CORE_WRITE_BACK_FLAG_NAME, write_back) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get core VFD write-back flag")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_core_mmap() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Pset_metadata_read_attempts
@@ -4327,6 +4515,162 @@ H5P_facc_mdc_log_location_close(const char H5_ATTR_UNUSED *name, size_t H5_ATTR_
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P_facc_mdc_log_location_close() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_mdc_log_format
+ *
+ * Purpose:	Set the format of the metadata cache log enabled with
+ *		H5Pset_mdc_log_options().
+ *
+ *		With H5AC_LOG_FORMAT_BINARY, only the operations on entries
+ *		whose address hashes to 0 modulo sample_interval are
+ *		recorded.  A sample_interval of 1 records every operation.
+ *		The sample interval is ignored for the JSON format.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_mdc_log_format(hid_t plist_id, H5AC_log_format_t format,
+                      unsigned sample_interval)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "iCfIu", plist_id, format, sample_interval);
+
+    /* Check arguments */
+    if(H5P_DEFAULT == plist_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "can't modify default property list")
+    if(format != H5AC_LOG_FORMAT_JSON && format != H5AC_LOG_FORMAT_BINARY)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "unknown log format")
+    if(0 == sample_interval)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "sample interval must be positive")
+
+    /* Get the property list structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list")
+
+    /* Set values */
+    if(H5P_set(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, &format) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set log format")
+    if(H5P_set(plist, H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_NAME, &sample_interval) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set log sample interval")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_mdc_log_format() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_mdc_log_format
+ *
+ * Purpose:	Get the format and sampling interval of the metadata cache
+ *		log.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_mdc_log_format(hid_t plist_id, H5AC_log_format_t *format/*out*/,
+                      unsigned *sample_interval/*out*/)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE3("e", "ixx", plist_id, format, sample_interval);
+
+    /* Get the property list structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list")
+
+    /* Get values */
+    if(format)
+        if(H5P_get(plist, H5F_ACS_MDC_LOG_FORMAT_NAME, format) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get log format")
+    if(sample_interval)
+        if(H5P_get(plist, H5F_ACS_MDC_LOG_SAMPLE_INTERVAL_NAME, sample_interval) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get log sample interval")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_mdc_log_format() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_mdc_log_format_enc
+ *
+ * Purpose:        Callback routine which is called whenever the metadata
+ *                 cache log format property in the file access property
+ *                 list is encoded.
+ *
+ * Return:	   Success:	Non-negative
+ *		   Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_mdc_log_format_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5AC_log_format_t *format = (const H5AC_log_format_t *)value; /* Create local alias for values */
+    uint8_t **pp = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(format);
+    HDassert(size);
+
+    if(NULL != *pp)
+        /* Encode log format */
+        *(*pp)++ = (uint8_t)*format;
+
+    /* Size of log format */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_mdc_log_format_enc() */
+
+
+
+/*-------------------------------------------------------------------------
+ * Function:       H5P__facc_mdc_log_format_dec
+ *
+ * Purpose:        Callback routine which is called whenever the metadata
+ *                 cache log format property in the file access property
+ *                 list is decoded.
+ *
+ * Return:	   Success:	Non-negative
+ *		   Failure:	Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__facc_mdc_log_format_dec(const void **_pp, void *_value)
+{
+    H5AC_log_format_t *format = (H5AC_log_format_t *)_value; /* Log format */
+    const uint8_t **pp = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(format);
+
+    /* Decode log format */
+    *format = (H5AC_log_format_t)*(*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__facc_mdc_log_format_dec() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_evict_on_close
@@ -4414,6 +4758,111 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_evict_on_close() */
 
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_page_buffer_size
+ *
+ * Purpose:	Enable page buffering for files opened with the file access
+ *		property list, holding pages of PAGE_SIZE bytes in at most
+ *		BUF_SIZE bytes of memory.  A BUF_SIZE of 0 disables page
+ *		buffering, and a PAGE_SIZE of 0 selects the default page
+ *		size.  Otherwise, PAGE_SIZE must be a power of two no
+ *		smaller than 512, and BUF_SIZE must hold at least one page.
+ *
+ *		MIN_META_PERC and MIN_RAW_PERC are the percentages of the
+ *		pages reserved for metadata and for raw data; pages of the
+ *		other kind are never evicted to make room for pages beyond
+ *		these reservations.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_page_buffer_size(hid_t plist_id, size_t page_size, size_t buf_size,
+    unsigned min_meta_perc, unsigned min_raw_perc)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "izzIuIu", plist_id, page_size, buf_size, min_meta_perc,
+             min_raw_perc);
+
+    /* Check arguments */
+    if(H5P_DEFAULT == plist_id)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "can't modify default property list")
+    if(page_size && (page_size < H5PB_MIN_PAGE_SIZE || !POWER_OF_TWO(page_size)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page size must be a power of two, and at least 512")
+    if(buf_size && buf_size < (page_size ? page_size : H5PB_DEFAULT_PAGE_SIZE))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "page buffer size must hold at least one page")
+    if(min_meta_perc > 100 || min_raw_perc > 100 || min_meta_perc + min_raw_perc > 100)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "reserved percentages of the page buffer exceed 100")
+
+    /* Get the property list structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list")
+
+    /* Set values */
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_SIZE_NAME, &buf_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer size")
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, &page_size) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set page buffer page size")
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, &min_meta_perc) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set percentage of page buffer reserved for metadata")
+    if(H5P_set(plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, &min_raw_perc) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set percentage of page buffer reserved for raw data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_page_buffer_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_page_buffer_size
+ *
+ * Purpose:	Retrieve the page buffer settings set with
+ *		H5Pset_page_buffer_size().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_page_buffer_size(hid_t plist_id, size_t *page_size/*out*/,
+    size_t *buf_size/*out*/, unsigned *min_meta_perc/*out*/,
+    unsigned *min_raw_perc/*out*/)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE5("e", "ixxxx", plist_id, page_size, buf_size, min_meta_perc,
+             min_raw_perc);
+
+    /* Get the property list structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "plist_id is not a file access property list")
+
+    /* Get values */
+    if(page_size)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_PAGE_SIZE_NAME, page_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer page size")
+    if(buf_size)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_SIZE_NAME, buf_size) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get page buffer size")
+    if(min_meta_perc)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_MIN_META_PERC_NAME, min_meta_perc) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get percentage of page buffer reserved for metadata")
+    if(min_raw_perc)
+        if(H5P_get(plist, H5F_ACS_PAGE_BUFFER_MIN_RAW_PERC_NAME, min_raw_perc) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get percentage of page buffer reserved for raw data")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_page_buffer_size() */
+
 #ifdef H5_HAVE_PARALLEL
 
 /*-------------------------------------------------------------------------
@@ -143,6 +143,9 @@ H5_DLLVAR const struct H5P_libclass_t H5P_CLS_GACC[1];  /* Group access */
 H5_DLLVAR const struct H5P_libclass_t H5P_CLS_TACC[1];  /* Named datatype access */
 H5_DLLVAR const struct H5P_libclass_t H5P_CLS_FACC[1];  /* File access */
 
+/* Datatype conversion thread count in the default data transfer property list */
+H5_DLLVAR unsigned H5P_def_conv_nthreads_g;
+
 /******************************/
 /* Library Private Prototypes */
 /******************************/
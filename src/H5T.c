@@ -55,6 +55,13 @@
 
 #define H5T_ENCODE_VERSION      0
 
+/* Slot in the conversion path hash index for a pair of datatype hashes */
+#define H5T_PATH_HASH_SLOT(SRC_HASH, DST_HASH, NSLOTS)                        \
+    ((size_t)((SRC_HASH) ^ ((DST_HASH) * 0x9e3779b1U)) & ((NSLOTS) - 1))
+
+/* Length of the error description kept for a failed conversion thread */
+#define H5T_CONV_TASK_ERR_DESC_LEN      128
+
 /*
  * Type initialization macros
  *
@@ -129,6 +136,56 @@
     H5T_INIT_TYPE_DOUBLE_COMMON(H5T_ORDER_BE)				      \
 }
 
+/* Define the code templates for IEEE half precision floats for the "GUTS" in the H5T_INIT_TYPE macro */
+#define H5T_INIT_TYPE_HALF_COMMON(ENDIANNESS) {				      \
+    H5T_INIT_TYPE_NUM_COMMON(ENDIANNESS)				      \
+    dt->shared->u.atomic.u.f.sign = 15;					      \
+    dt->shared->u.atomic.u.f.epos = 10;					      \
+    dt->shared->u.atomic.u.f.esize = 5;					      \
+    dt->shared->u.atomic.u.f.ebias = 0x0f;				      \
+    dt->shared->u.atomic.u.f.mpos = 0;					      \
+    dt->shared->u.atomic.u.f.msize = 10;				      \
+    dt->shared->u.atomic.u.f.norm = H5T_NORM_IMPLIED;			      \
+    dt->shared->u.atomic.u.f.pad = H5T_PAD_ZERO;			      \
+}
+
+#define H5T_INIT_TYPE_HALFLE_CORE {					      \
+    H5T_INIT_TYPE_HALF_COMMON(H5T_ORDER_LE)				      \
+}
+
+#define H5T_INIT_TYPE_HALFBE_CORE {					      \
+    H5T_INIT_TYPE_HALF_COMMON(H5T_ORDER_BE)				      \
+}
+
+#define H5T_INIT_TYPE_HALFNATIVE_CORE {					      \
+    H5T_INIT_TYPE_HALF_COMMON(H5T_native_order_g)			      \
+}
+
+/* Define the code templates for bfloat16 floats for the "GUTS" in the H5T_INIT_TYPE macro */
+#define H5T_INIT_TYPE_BFLOAT_COMMON(ENDIANNESS) {			      \
+    H5T_INIT_TYPE_NUM_COMMON(ENDIANNESS)				      \
+    dt->shared->u.atomic.u.f.sign = 15;					      \
+    dt->shared->u.atomic.u.f.epos = 7;					      \
+    dt->shared->u.atomic.u.f.esize = 8;					      \
+    dt->shared->u.atomic.u.f.ebias = 0x7f;				      \
+    dt->shared->u.atomic.u.f.mpos = 0;					      \
+    dt->shared->u.atomic.u.f.msize = 7;					      \
+    dt->shared->u.atomic.u.f.norm = H5T_NORM_IMPLIED;			      \
+    dt->shared->u.atomic.u.f.pad = H5T_PAD_ZERO;			      \
+}
+
+#define H5T_INIT_TYPE_BFLOATLE_CORE {					      \
+    H5T_INIT_TYPE_BFLOAT_COMMON(H5T_ORDER_LE)				      \
+}
+
+#define H5T_INIT_TYPE_BFLOATBE_CORE {					      \
+    H5T_INIT_TYPE_BFLOAT_COMMON(H5T_ORDER_BE)				      \
+}
+
+#define H5T_INIT_TYPE_BFLOATNATIVE_CORE {				      \
+    H5T_INIT_TYPE_BFLOAT_COMMON(H5T_native_order_g)			      \
+}
+
 /* Define the code templates for VAX float for the "GUTS" in the H5T_INIT_TYPE macro */
 #define H5T_INIT_TYPE_FLOATVAX_CORE {			                      \
     H5T_INIT_TYPE_NUM_COMMON(H5T_ORDER_VAX)				      \
@@ -276,6 +333,25 @@
 /* Local Typedefs */
 /******************/
 
+#ifdef H5_HAVE_THREADSAFE
+/* Range of elements converted by one thread in H5T__convert_mt() */
+typedef struct H5T_conv_task_t {
+    H5T_path_t  *tpath;                 /* Conversion path */
+    hid_t       src_id;                 /* Source datatype */
+    hid_t       dst_id;                 /* Destination datatype */
+    size_t      nelmts;                 /* Number of elements to convert */
+    size_t      buf_stride;             /* Stride in BUF */
+    size_t      bkg_stride;             /* Stride in BKG */
+    void        *buf;                   /* First element to convert */
+    void        *bkg;                   /* First background element */
+    hbool_t     worker;                 /* Whether a worker thread runs the task */
+    herr_t      status;                 /* Result of the conversion */
+    hid_t       maj_id;                 /* Major error ID of a failure */
+    hid_t       min_id;                 /* Minor error ID of a failure */
+    char        desc[H5T_CONV_TASK_ERR_DESC_LEN]; /* Description of a failure */
+} H5T_conv_task_t;
+#endif /* H5_HAVE_THREADSAFE */
+
 
 /********************/
 /* Local Prototypes */
@@ -286,6 +362,18 @@ static herr_t H5T_register(H5T_pers_t pers, const char *name, H5T_t *src,
         H5T_t *dst, H5T_conv_t func, hid_t dxpl_id, hbool_t api_call);
 static htri_t H5T_compiler_conv(H5T_t *src, H5T_t *dst);
 static herr_t H5T_set_size(H5T_t *dt, size_t size);
+static uint32_t H5T_hash_real(const H5T_t *dt);
+static void H5T_path_hash_rebuild(void);
+static void H5T_path_hash_add(H5T_path_t *path);
+static H5T_path_t *H5T_path_hash_find(const H5T_t *src, const H5T_t *dst);
+#ifdef H5_HAVE_THREADSAFE
+static herr_t H5T__conv_nthreads(H5T_path_t *tpath, hid_t src_id, hid_t dst_id,
+    size_t nelmts, size_t buf_stride, hid_t dxpl_id, unsigned *nthreads);
+static void *H5T__conv_task(void *_task);
+static herr_t H5T__convert_mt(H5T_path_t *tpath, hid_t src_id, hid_t dst_id,
+    size_t nelmts, size_t buf_stride, size_t bkg_stride, void *buf, void *bkg,
+    unsigned nthreads);
+#endif /* H5_HAVE_THREADSAFE */
 
 
 /*****************************/
@@ -314,6 +402,10 @@ hid_t H5T_IEEE_F32BE_g			= FAIL;
 hid_t H5T_IEEE_F32LE_g			= FAIL;
 hid_t H5T_IEEE_F64BE_g			= FAIL;
 hid_t H5T_IEEE_F64LE_g			= FAIL;
+hid_t H5T_IEEE_F16BE_g			= FAIL;
+hid_t H5T_IEEE_F16LE_g			= FAIL;
+hid_t H5T_FLOAT_BF16BE_g		= FAIL;
+hid_t H5T_FLOAT_BF16LE_g		= FAIL;
 
 hid_t H5T_VAX_F32_g			= FAIL;
 hid_t H5T_VAX_F64_g			= FAIL;
@@ -379,6 +471,8 @@ hid_t H5T_NATIVE_HSIZE_g		= FAIL;
 hid_t H5T_NATIVE_HSSIZE_g		= FAIL;
 hid_t H5T_NATIVE_HERR_g			= FAIL;
 hid_t H5T_NATIVE_HBOOL_g		= FAIL;
+hid_t H5T_NATIVE_FLOAT16_g		= FAIL;
+hid_t H5T_NATIVE_BFLOAT16_g		= FAIL;
 
 hid_t H5T_NATIVE_INT8_g			= FAIL;
 hid_t H5T_NATIVE_UINT8_g		= FAIL;
@@ -495,6 +589,9 @@ float H5T_NATIVE_FLOAT_NEG_INF_g        = 0.0f;
 double H5T_NATIVE_DOUBLE_POS_INF_g      = (double)0.0f;
 double H5T_NATIVE_DOUBLE_NEG_INF_g      = (double)0.0f;
 
+/* Number of conversion path lookups answered by the hash index */
+size_t H5T_path_hash_hits_g             = 0;
+
 /* Declare the free list for H5T_t's and H5T_shared_t's */
 H5FL_DEFINE(H5T_t);
 H5FL_DEFINE(H5T_shared_t);
@@ -512,6 +609,9 @@ static struct {
     int	npaths;		/*number of paths defined		*/
     size_t	apaths;		/*number of paths allocated		*/
     H5T_path_t	**path;		/*sorted array of path pointers		*/
+    H5T_path_t	**hash;		/*open-addressed index of paths by hash	*/
+    size_t	nhash;		/*number of slots in hash index		*/
+    size_t	hash_used;	/*number of paths in hash index		*/
     int	nsoft;		/*number of soft conversions defined	*/
     size_t	asoft;		/*number of soft conversions allocated	*/
     H5T_soft_t	*soft;		/*unsorted array of soft conversions	*/
@@ -531,6 +631,12 @@ static const H5I_class_t H5I_DATATYPE_CLS[1] = {{
 /* Flag indicating "top" of interface has been initialized */
 static hbool_t H5T_top_package_initialize_s = FALSE;
 
+#ifdef H5_HAVE_THREADSAFE
+/* Transfer property list for the ranges of H5T__convert_mt(), which
+ * converts with one thread */
+static hid_t H5T_conv_task_dxpl_id_s = FAIL;
+#endif /* H5_HAVE_THREADSAFE */
+
 
 
 /*-------------------------------------------------------------------------
@@ -701,6 +807,8 @@ H5T__init_package(void)
 #if H5_SIZEOF_LONG_DOUBLE !=0
     H5T_t       *native_ldouble=NULL;   /* Datatype structure for native long double */
 #endif
+    H5T_t       *native_half=NULL;      /* Datatype structure for native IEEE half precision float */
+    H5T_t       *native_bfloat=NULL;    /* Datatype structure for native bfloat16 float */
     H5T_t       *std_u8le=NULL;         /* Datatype structure for unsigned 8-bit little-endian integer */
     H5T_t       *std_u8be=NULL;         /* Datatype structure for unsigned 8-bit big-endian integer */
     H5T_t       *std_u16le=NULL;        /* Datatype structure for unsigned 16-bit little-endian integer */
@@ -741,6 +849,10 @@ H5T__init_package(void)
     if(H5T__init_native() < 0)
 	HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize interface")
 
+    /* Pick the byte swapping and 16-bit float kernels for this processor */
+    H5T__swap_init();
+    H5T__half_init();
+
     /* Get the atomic datatype structures needed by the initialization code below */
     if(NULL == (native_schar = (H5T_t *)H5I_object(H5T_NATIVE_SCHAR_g)))
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype object")
@@ -803,6 +915,14 @@ H5T__init_package(void)
     /* hbool_t */
     H5T_INIT_TYPE(OFFSET,H5T_NATIVE_HBOOL_g,COPY,native_uint,SET,sizeof(hbool_t))
 
+    /* IEEE half precision float, in the machine's byte order */
+    H5T_INIT_TYPE(HALFNATIVE,H5T_NATIVE_FLOAT16_g,COPY,native_double,SET,2)
+    native_half=dt;    /* Keep type for later */
+
+    /* bfloat16 float, in the machine's byte order */
+    H5T_INIT_TYPE(BFLOATNATIVE,H5T_NATIVE_BFLOAT16_g,COPY,native_double,SET,2)
+    native_bfloat=dt;    /* Keep type for later */
+
     /*------------------------------------------------------------
      * IEEE Types
      *------------------------------------------------------------
@@ -820,6 +940,23 @@ H5T__init_package(void)
     /* IEEE 8-byte big-endian float */
     H5T_INIT_TYPE(DOUBLEBE,H5T_IEEE_F64BE_g,COPY,native_double,SET,8)
 
+    /* IEEE 2-byte little-endian float */
+    H5T_INIT_TYPE(HALFLE,H5T_IEEE_F16LE_g,COPY,native_double,SET,2)
+
+    /* IEEE 2-byte big-endian float */
+    H5T_INIT_TYPE(HALFBE,H5T_IEEE_F16BE_g,COPY,native_double,SET,2)
+
+    /*------------------------------------------------------------
+     * bfloat16 Types
+     *------------------------------------------------------------
+     */
+
+    /* 2-byte little-endian bfloat16 */
+    H5T_INIT_TYPE(BFLOATLE,H5T_FLOAT_BF16LE_g,COPY,native_double,SET,2)
+
+    /* 2-byte big-endian bfloat16 */
+    H5T_INIT_TYPE(BFLOATBE,H5T_FLOAT_BF16BE_g,COPY,native_double,SET,2)
+
     /*------------------------------------------------------------
      * VAX Types
      *------------------------------------------------------------
@@ -1029,6 +1166,14 @@ H5T__init_package(void)
     status |= H5T_register(H5T_PERS_HARD, "ldbl_flt", native_ldouble, native_float, H5T__conv_ldouble_float, H5AC_noio_dxpl_id, FALSE);
     status |= H5T_register(H5T_PERS_HARD, "ldbl_dbl", native_ldouble, native_double, H5T__conv_ldouble_double, H5AC_noio_dxpl_id, FALSE);
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
+    status |= H5T_register(H5T_PERS_HARD, "half_flt", native_half, native_float, H5T__conv_half_float, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "half_dbl", native_half, native_double, H5T__conv_half_double, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "flt_half", native_float, native_half, H5T__conv_float_half, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "dbl_half", native_double, native_half, H5T__conv_double_half, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "bflt_flt", native_bfloat, native_float, H5T__conv_bfloat_float, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "bflt_dbl", native_bfloat, native_double, H5T__conv_bfloat_double, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "flt_bflt", native_float, native_bfloat, H5T__conv_float_bfloat, H5AC_noio_dxpl_id, FALSE);
+    status |= H5T_register(H5T_PERS_HARD, "dbl_bflt", native_double, native_bfloat, H5T__conv_double_bfloat, H5AC_noio_dxpl_id, FALSE);
 
     /* from long long */
     status |= H5T_register(H5T_PERS_HARD, "llong_ullong", native_llong, native_ullong, H5T__conv_llong_ullong, H5AC_noio_dxpl_id, FALSE);
@@ -1390,6 +1535,9 @@ H5T_top_term_package(void)
             H5T_g.path = (H5T_path_t **)H5MM_xfree(H5T_g.path);
             H5T_g.npaths = 0;
             H5T_g.apaths = 0;
+            H5T_g.hash = (H5T_path_t **)H5MM_xfree(H5T_g.hash);
+            H5T_g.nhash = 0;
+            H5T_g.hash_used = 0;
             H5T_g.soft = (H5T_soft_t *)H5MM_xfree(H5T_g.soft);
             H5T_g.nsoft = 0;
             H5T_g.asoft = 0;
@@ -1397,6 +1545,15 @@ H5T_top_term_package(void)
             n++;
         } /* end if */
 
+#ifdef H5_HAVE_THREADSAFE
+        /* Close the transfer property list for conversion threads */
+        if(H5T_conv_task_dxpl_id_s >= 0) {
+            (void)H5I_dec_ref(H5T_conv_task_dxpl_id_s);
+            H5T_conv_task_dxpl_id_s = FAIL;
+            n++;
+        } /* end if */
+#endif /* H5_HAVE_THREADSAFE */
+
 	/* Unlock all datatypes, then free them */
 	/* note that we are ignoring the return value from H5I_iterate() */
         /* Also note that we are incrementing 'n' in the callback */
@@ -1414,6 +1571,10 @@ H5T_top_term_package(void)
             H5T_IEEE_F32LE_g			= FAIL;
             H5T_IEEE_F64BE_g			= FAIL;
             H5T_IEEE_F64LE_g			= FAIL;
+            H5T_IEEE_F16BE_g			= FAIL;
+            H5T_IEEE_F16LE_g			= FAIL;
+            H5T_FLOAT_BF16BE_g			= FAIL;
+            H5T_FLOAT_BF16LE_g			= FAIL;
 
             H5T_STD_I8BE_g			= FAIL;
             H5T_STD_I8LE_g			= FAIL;
@@ -1476,6 +1637,8 @@ H5T_top_term_package(void)
             H5T_NATIVE_HSSIZE_g			= FAIL;
             H5T_NATIVE_HERR_g			= FAIL;
             H5T_NATIVE_HBOOL_g			= FAIL;
+            H5T_NATIVE_FLOAT16_g		= FAIL;
+            H5T_NATIVE_BFLOAT16_g		= FAIL;
 
             H5T_NATIVE_INT8_g			= FAIL;
             H5T_NATIVE_UINT8_g			= FAIL;
@@ -2396,6 +2559,9 @@ H5T_register(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst,
             /* We don't care about any failures during the freeing process */
 	    H5E_clear_stack(NULL);
         } /* end for */
+
+        /* Some paths may have been replaced */
+        H5T_path_hash_rebuild();
     } /* end else */
 
 done:
@@ -2563,6 +2729,9 @@ H5T_unregister(H5T_pers_t pers, const char *name, H5T_t *src, H5T_t *dst,
         } /* end else */
     } /* end for */
 
+    /* Drop removed paths from the hash index */
+    H5T_path_hash_rebuild();
+
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5T_unregister() */
 
@@ -3711,6 +3880,8 @@ H5T_set_size(H5T_t *dt, size_t size)
     HDassert(H5T_REFERENCE!=dt->shared->type);
     HDassert(!(H5T_ENUM==dt->shared->type && 0==dt->shared->u.enumer.nmembs));
 
+    H5T_RESET_HASH(dt);
+
     if (dt->shared->parent) {
         if (H5T_set_size(dt->shared->parent, size)<0)
             HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to set size for parent data type");
@@ -4357,6 +4528,273 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T_cmp() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_hash_real
+ *
+ * Purpose:	Computes a structural hash of a datatype from the same
+ *		properties that H5T_cmp() compares, so that datatypes which
+ *		compare equal always hash equal.  Members of compound
+ *		datatypes are combined without regard to their order, since
+ *		H5T_cmp() compares them in name order.  Cached hashes of
+ *		member and parent types are not used.
+ *
+ * Return:	The hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5T_hash_real(const H5T_t *dt)
+{
+    size_t      key[8];                 /* Properties hashed together */
+    size_t      nkey = 0;               /* Number of properties used */
+    unsigned    u;                      /* Local index variable */
+    uint32_t    ret_value;              /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(dt);
+
+    key[nkey++] = (size_t)dt->shared->type;
+    key[nkey++] = dt->shared->size;
+    switch(dt->shared->type) {
+        case H5T_INTEGER:
+        case H5T_FLOAT:
+        case H5T_TIME:
+        case H5T_STRING:
+        case H5T_BITFIELD:
+        case H5T_REFERENCE:
+            key[nkey++] = (size_t)dt->shared->u.atomic.order;
+            key[nkey++] = dt->shared->u.atomic.prec;
+            key[nkey++] = dt->shared->u.atomic.offset;
+            key[nkey++] = ((size_t)dt->shared->u.atomic.lsb_pad << 8) ^ (size_t)dt->shared->u.atomic.msb_pad;
+            if(H5T_INTEGER == dt->shared->type)
+                key[nkey++] = (size_t)dt->shared->u.atomic.u.i.sign;
+            else if(H5T_FLOAT == dt->shared->type) {
+                key[nkey++] = dt->shared->u.atomic.u.f.epos;
+                key[nkey++] = dt->shared->u.atomic.u.f.mpos;
+            } /* end if */
+            else if(H5T_STRING == dt->shared->type)
+                key[nkey++] = ((size_t)dt->shared->u.atomic.u.s.cset << 8) ^ (size_t)dt->shared->u.atomic.u.s.pad;
+            else if(H5T_REFERENCE == dt->shared->type)
+                key[nkey++] = (size_t)dt->shared->u.atomic.u.r.rtype;
+            break;
+
+        case H5T_COMPOUND:
+            key[nkey++] = dt->shared->u.compnd.nmembs;
+            break;
+
+        case H5T_ENUM:
+            key[nkey++] = dt->shared->u.enumer.nmembs;
+            break;
+
+        case H5T_VLEN:
+            key[nkey++] = (size_t)dt->shared->u.vlen.type;
+            break;
+
+        case H5T_ARRAY:
+            key[nkey++] = dt->shared->u.array.ndims;
+            break;
+
+        case H5T_OPAQUE:
+        case H5T_NO_CLASS:
+        case H5T_NCLASSES:
+        default:
+            break;
+    } /* end switch */
+    ret_value = H5_checksum_lookup3(key, nkey * sizeof(size_t), 0);
+
+    /* Mix in the array dimensions */
+    if(H5T_ARRAY == dt->shared->type)
+        ret_value = H5_checksum_lookup3(dt->shared->u.array.dim,
+                dt->shared->u.array.ndims * sizeof(size_t), ret_value);
+
+    /* Mix in the parent type */
+    if(dt->shared->parent) {
+        uint32_t parent_hash = H5T_hash_real(dt->shared->parent);
+
+        ret_value = H5_checksum_lookup3(&parent_hash, sizeof(parent_hash), ret_value);
+    } /* end if */
+
+    /* Mix in the members, in any order */
+    if(H5T_COMPOUND == dt->shared->type) {
+        uint32_t memb_sum = 0;
+
+        for(u = 0; u < dt->shared->u.compnd.nmembs; u++) {
+            const H5T_cmemb_t *memb = dt->shared->u.compnd.memb + u;
+            uint32_t memb_hash;
+
+            key[0] = memb->offset;
+            key[1] = memb->size;
+            memb_hash = H5_checksum_lookup3(key, 2 * sizeof(size_t), H5_hash_string(memb->name));
+            key[0] = H5T_hash_real(memb->type);
+            memb_sum += H5_checksum_lookup3(key, sizeof(size_t), memb_hash);
+        } /* end for */
+        ret_value = H5_checksum_lookup3(&memb_sum, sizeof(memb_sum), ret_value);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_hash_real() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__hash
+ *
+ * Purpose:	Returns the structural hash of a datatype, computing it and
+ *		caching it in the shared datatype information the first time.
+ *		Functions which modify a datatype discard the cached value
+ *		with H5T_RESET_HASH().
+ *
+ * Return:	The hash value (never zero)
+ *
+ *-------------------------------------------------------------------------
+ */
+uint32_t
+H5T__hash(const H5T_t *dt)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(dt);
+    HDassert(dt->shared);
+
+    if(0 == dt->shared->hash) {
+        uint32_t hash = H5T_hash_real(dt);
+
+        dt->shared->hash = hash ? hash : 1;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(dt->shared->hash)
+} /* end H5T__hash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_path_hash_rebuild
+ *
+ * Purpose:	Rebuilds the hash index of conversion paths from the path
+ *		table, sizing it to stay at most half full.  The no-op path
+ *		isn't indexed.  If memory can't be allocated the index is
+ *		left empty and H5T_path_find() falls back to its binary
+ *		search.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_path_hash_rebuild(void)
+{
+    size_t      nhash = 256;            /* New number of slots */
+    int         i;                      /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    while(nhash < 2 * (size_t)H5T_g.npaths)
+        nhash *= 2;
+
+    if(nhash != H5T_g.nhash) {
+        H5T_g.hash = (H5T_path_t **)H5MM_xfree(H5T_g.hash);
+        H5T_g.hash = (H5T_path_t **)H5MM_malloc(nhash * sizeof(H5T_path_t *));
+        H5T_g.nhash = H5T_g.hash ? nhash : 0;
+    } /* end if */
+    if(H5T_g.hash)
+        HDmemset(H5T_g.hash, 0, H5T_g.nhash * sizeof(H5T_path_t *));
+    H5T_g.hash_used = 0;
+
+    for(i = 1; i < H5T_g.npaths && H5T_g.hash; i++) {
+        H5T_path_t *path = H5T_g.path[i];
+        size_t      idx;
+
+        path->src_hash = H5T__hash(path->src);
+        path->dst_hash = H5T__hash(path->dst);
+        idx = H5T_PATH_HASH_SLOT(path->src_hash, path->dst_hash, H5T_g.nhash);
+        while(H5T_g.hash[idx])
+            idx = (idx + 1) & (H5T_g.nhash - 1);
+        H5T_g.hash[idx] = path;
+        H5T_g.hash_used++;
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_path_hash_rebuild() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_path_hash_add
+ *
+ * Purpose:	Adds a path that was just inserted into the path table to
+ *		the hash index, growing the index when needed.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_path_hash_add(H5T_path_t *path)
+{
+    size_t      idx;                    /* Slot in index */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(path);
+
+    if(2 * (H5T_g.hash_used + 1) > H5T_g.nhash)
+        H5T_path_hash_rebuild();
+    else {
+        path->src_hash = H5T__hash(path->src);
+        path->dst_hash = H5T__hash(path->dst);
+        idx = H5T_PATH_HASH_SLOT(path->src_hash, path->dst_hash, H5T_g.nhash);
+        while(H5T_g.hash[idx])
+            idx = (idx + 1) & (H5T_g.nhash - 1);
+        H5T_g.hash[idx] = path;
+        H5T_g.hash_used++;
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_path_hash_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_path_hash_find
+ *
+ * Purpose:	Looks up the conversion path from SRC to DST in the hash
+ *		index.  Candidates with matching hashes are confirmed with a
+ *		full comparison of each datatype.
+ *
+ * Return:	Success:	Pointer to the path
+ *
+ *		Failure:	NULL if the path isn't in the index
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5T_path_t *
+H5T_path_hash_find(const H5T_t *src, const H5T_t *dst)
+{
+    uint32_t    src_hash, dst_hash;     /* Hashes of the datatypes */
+    size_t      idx;                    /* Slot in index */
+    H5T_path_t  *ret_value = NULL;      /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(0 == H5T_g.hash_used)
+        HGOTO_DONE(NULL)
+
+    src_hash = H5T__hash(src);
+    dst_hash = H5T__hash(dst);
+    idx = H5T_PATH_HASH_SLOT(src_hash, dst_hash, H5T_g.nhash);
+    while(H5T_g.hash[idx]) {
+        H5T_path_t *path = H5T_g.hash[idx];
+
+        if(path->src_hash == src_hash && path->dst_hash == dst_hash
+                && 0 == H5T_cmp(src, path->src, FALSE) && 0 == H5T_cmp(dst, path->dst, FALSE)) {
+            H5T_path_hash_hits_g++;
+            HGOTO_DONE(path)
+        } /* end if */
+        idx = (idx + 1) & (H5T_g.nhash - 1);
+    } /* end while */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_path_hash_find() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_path_find
@@ -4455,6 +4893,12 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
 	cmp = 0;
 	md = 0;
     } /* end if */
+    else if(!func && NULL != (table = H5T_path_hash_find(src, dst))) {
+        /* Found through the hash index; the path won't be replaced, so
+         * its position in the table isn't needed */
+	cmp = 0;
+	md = -1;
+    } /* end if */
     else {
 	lt = md = 1;
 	rt = H5T_g.npaths;
@@ -4527,6 +4971,7 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
 	src_id = dst_id = -1;
 	path->func = func;
 	path->is_hard = TRUE;
+	path->is_api = is_api;
     } /* end if */
 
     /*
@@ -4606,6 +5051,9 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
         table = H5FL_FREE(H5T_path_t, table);
 	table = path;
 	H5T_g.path[md] = path;
+
+        /* Point the hash index at the new path */
+        H5T_path_hash_rebuild();
     } else if(path != table) {
 	HDassert(cmp);
         if((size_t)H5T_g.npaths >= H5T_g.apaths) {
@@ -4623,6 +5071,9 @@ H5T_path_find(const H5T_t *src, const H5T_t *dst, const char *name,
         H5T_g.npaths++;
 	H5T_g.path[md] = path;
 	table = path;
+
+        /* Add the new path to the hash index */
+        H5T_path_hash_add(path);
     } /* end else-if */
 
     /* Set the flag to indicate both source and destination types are compound types
@@ -4833,6 +5284,9 @@ H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts,
 #ifdef H5T_DEBUG
     H5_timer_t		timer;
 #endif
+#ifdef H5_HAVE_THREADSAFE
+    unsigned    nthreads = 1;           /* Number of threads to convert with */
+#endif /* H5_HAVE_THREADSAFE */
     herr_t      ret_value=SUCCEED;       /* Return value */
 
     FUNC_ENTER_NOAPI(FAIL)
@@ -4841,6 +5295,20 @@ H5T_convert(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts,
     if (H5DEBUG(T)) H5_timer_begin(&timer);
 #endif
     tpath->cdata.command = H5T_CONV_CONV;
+#ifdef H5_HAVE_THREADSAFE
+    /* Check if the elements should be split between threads.  The thread
+     * count of the default transfer property list is kept by H5P, so it's
+     * only looked up when that is more than one. */
+    if(nelmts > 1 && !tpath->is_noop
+            && (H5P_DATASET_XFER_DEFAULT != dset_xfer_plist || H5P_def_conv_nthreads_g > 1))
+        if(H5T__conv_nthreads(tpath, src_id, dst_id, nelmts, buf_stride, dset_xfer_plist, &nthreads) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't determine number of conversion threads")
+    if(nthreads > 1) {
+        if(H5T__convert_mt(tpath, src_id, dst_id, nelmts, buf_stride, bkg_stride, buf, bkg, nthreads) < 0)
+            HGOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, FAIL, "data type conversion failed");
+    } /* end if */
+    else
+#endif /* H5_HAVE_THREADSAFE */
     if ((tpath->func)(src_id, dst_id, &(tpath->cdata), nelmts, buf_stride,
                       bkg_stride, buf, bkg, dset_xfer_plist)<0)
 	HGOTO_ERROR(H5E_ATTR, H5E_CANTENCODE, FAIL, "data type conversion failed");
@@ -4856,6 +5324,230 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }
 
+
+#ifdef H5_HAVE_THREADSAFE
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_nthreads
+ *
+ * Purpose:	Determines how many threads H5T_convert() should use to
+ *		convert NELMTS elements, from the thread count and minimum
+ *		number of elements per thread in the dataset transfer
+ *		property list.
+ *
+ *		Conversions that call an application's exception callback,
+ *		conversions that change the element size in place and
+ *		conversions that don't treat each element independently
+ *		(see H5T__conv_mt_prepare) are always done by one thread.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__conv_nthreads(H5T_path_t *tpath, hid_t src_id, hid_t dst_id,
+    size_t nelmts, size_t buf_stride, hid_t dxpl_id, unsigned *nthreads)
+{
+    H5P_genplist_t *plist;              /* Property list pointer */
+    H5T_conv_cb_t cb_struct;            /* Conversion exception callback */
+    H5T_t       *src, *dst;             /* Source and destination datatypes */
+    unsigned    max_threads;            /* Thread count from property list */
+    size_t      min_elmts;              /* Minimum # of elements per thread */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(tpath);
+    HDassert(nthreads);
+
+    *nthreads = 1;
+
+#ifdef H5T_DEBUG
+    /* The path statistics aren't updated atomically */
+    if(H5DEBUG(T))
+        HGOTO_DONE(SUCCEED)
+#endif
+
+    /* Get the thread settings */
+    if(NULL == (plist = H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find property list for ID")
+    if(H5P_get(plist, H5D_XFER_CONV_NTHREADS_NAME, &max_threads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get conversion thread count")
+    if(max_threads <= 1)
+        HGOTO_DONE(SUCCEED)
+    if(H5P_get(plist, H5D_XFER_CONV_MIN_ELMTS_NAME, &min_elmts) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get conversion elements per thread")
+    HDassert(min_elmts > 0);
+    if(nelmts / min_elmts < 2)
+        HGOTO_DONE(SUCCEED)
+
+    /* The application's exception callback may not be reentrant */
+    if(H5P_get(plist, H5D_XFER_CONV_CB_NAME, &cb_struct) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
+    if(cb_struct.func)
+        HGOTO_DONE(SUCCEED)
+
+    /* Packed elements that change size in place overlap their neighbors */
+    if(NULL == (src = (H5T_t *)H5I_object(src_id)) || NULL == (dst = (H5T_t *)H5I_object(dst_id)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_BADTYPE, FAIL, "not a datatype")
+    if(0 == buf_stride && src->shared->size != dst->shared->size)
+        HGOTO_DONE(SUCCEED)
+
+    if(!H5T__conv_mt_prepare(tpath, src, dst))
+        HGOTO_DONE(SUCCEED)
+
+    *nthreads = (unsigned)MIN((size_t)max_threads, nelmts / min_elmts);
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_task
+ *
+ * Purpose:	Thread routine which converts one range of elements for
+ *		H5T__convert_mt().
+ *
+ *		When the conversion fails in a worker thread, the major and
+ *		minor error IDs and the description of the innermost error
+ *		are kept in the task and the worker's error stack is
+ *		cleared, as H5FD__memb_io_task() does.
+ *
+ * Return:	NULL (the result is stored in the task)
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5T__conv_task(void *_task)
+{
+    H5T_conv_task_t *task = (H5T_conv_task_t *)_task;
+
+    /* (The transfer properties don't split the elements again) */
+    task->status = (task->tpath->func)(task->src_id, task->dst_id,
+            &(task->tpath->cdata), task->nelmts, task->buf_stride,
+            task->bkg_stride, task->buf, task->bkg, H5T_conv_task_dxpl_id_s);
+
+    if(task->status < 0 && task->worker) {
+        if(H5E_get_innermost_error(&task->maj_id, &task->min_id, task->desc, sizeof(task->desc)) < 0) {
+            task->maj_id = H5E_DATATYPE;
+            task->min_id = H5E_CANTCONVERT;
+            HDstrncpy(task->desc, "datatype conversion failed", sizeof(task->desc));
+        } /* end if */
+        H5E_clear_stack(NULL);
+    } /* end if */
+
+    return NULL;
+} /* end H5T__conv_task() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__convert_mt
+ *
+ * Purpose:	Converts NELMTS elements by dividing them into NTHREADS
+ *		contiguous ranges and converting the ranges concurrently.
+ *		The calling thread converts the last range itself, and any
+ *		range whose thread couldn't be started.
+ *
+ *		The errors of the other threads are pushed on the calling
+ *		thread's error stack once they have finished.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T__convert_mt(H5T_path_t *tpath, hid_t src_id, hid_t dst_id, size_t nelmts,
+    size_t buf_stride, size_t bkg_stride, void *buf, void *bkg,
+    unsigned nthreads)
+{
+    H5T_conv_task_t *tasks = NULL;      /* Ranges of elements to convert */
+    H5TS_thread_t *threads = NULL;      /* Worker threads */
+    H5T_t       *src, *dst;             /* Source and destination datatypes */
+    size_t      elmt_stride;            /* Bytes between elements in BUF */
+    size_t      bkg_elmt_stride;        /* Bytes between elements in BKG */
+    size_t      start = 0;              /* First element of current range */
+    unsigned    u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    HDassert(nthreads > 1);
+
+    if(NULL == (src = (H5T_t *)H5I_object(src_id)) || NULL == (dst = (H5T_t *)H5I_object(dst_id)))
+        HGOTO_ERROR(H5E_DATATYPE, H5E_BADTYPE, FAIL, "not a datatype")
+
+    /* Create the single-thread transfer property list for the ranges */
+    if(H5T_conv_task_dxpl_id_s < 0) {
+        H5P_genplist_t *plist;          /* Property list pointer */
+        unsigned one_thread = 1;        /* Thread count for the ranges */
+
+        if((H5T_conv_task_dxpl_id_s = H5P_create_id(H5P_CLS_DATASET_XFER_g, FALSE)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTCREATE, FAIL, "unable to create transfer property list")
+        if(NULL == (plist = (H5P_genplist_t *)H5I_object(H5T_conv_task_dxpl_id_s)))
+            HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find property list for ID")
+        if(H5P_set(plist, H5D_XFER_CONV_NTHREADS_NAME, &one_thread) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set conversion thread count")
+    } /* end if */
+
+    /* Compute the element strides the same way the conversion functions do */
+    elmt_stride = buf_stride ? buf_stride : src->shared->size;
+    bkg_elmt_stride = (buf_stride && bkg_stride) ? bkg_stride : dst->shared->size;
+
+    if(NULL == (tasks = (H5T_conv_task_t *)H5MM_malloc(nthreads * sizeof(H5T_conv_task_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for conversion tasks")
+    if(NULL == (threads = (H5TS_thread_t *)H5MM_malloc(nthreads * sizeof(H5TS_thread_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for conversion threads")
+
+    /* Divide the elements as evenly as possible */
+    for(u = 0; u < nthreads; u++) {
+        size_t count = (nelmts / nthreads) + (u < (nelmts % nthreads) ? 1 : 0);
+
+        tasks[u].tpath = tpath;
+        tasks[u].src_id = src_id;
+        tasks[u].dst_id = dst_id;
+        tasks[u].nelmts = count;
+        tasks[u].buf_stride = buf_stride;
+        tasks[u].bkg_stride = bkg_stride;
+        tasks[u].buf = (uint8_t *)buf + (start * elmt_stride);
+        tasks[u].bkg = bkg ? (uint8_t *)bkg + (start * bkg_elmt_stride) : NULL;
+        tasks[u].worker = FALSE;
+        tasks[u].status = SUCCEED;
+        start += count;
+    } /* end for */
+    HDassert(start == nelmts);
+
+    /* Start the worker threads, then convert the remaining ranges here */
+    for(u = 0; u < nthreads - 1; u++) {
+        tasks[u].worker = TRUE;
+        if(H5TS_try_create_thread(&threads[u], H5T__conv_task, NULL, &tasks[u]) < 0)
+            tasks[u].worker = FALSE;
+    } /* end for */
+    for(u = 0; u < nthreads; u++)
+        if(!tasks[u].worker)
+            H5T__conv_task(&tasks[u]);
+
+    /* Wait for the started threads before checking their results */
+    for(u = 0; u < nthreads - 1; u++)
+        if(tasks[u].worker)
+            H5TS_wait_for_thread(threads[u]);
+    for(u = 0; u < nthreads; u++)
+        if(tasks[u].status < 0) {
+            if(tasks[u].worker)
+                HERROR(tasks[u].maj_id, tasks[u].min_id, "%s", tasks[u].desc);
+            ret_value = FAIL;
+        } /* end if */
+    if(ret_value < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed in thread")
+
+done:
+    H5MM_xfree(tasks);
+    H5MM_xfree(threads);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__convert_mt() */
+#endif /* H5_HAVE_THREADSAFE */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_oloc
@@ -5186,6 +5878,8 @@ H5T_set_loc(H5T_t *dt, H5F_t *f, H5T_loc_t loc)
     HDassert(dt);
     HDassert(loc>=H5T_LOC_BADLOC && loc<H5T_LOC_MAXLOC);
 
+    H5T_RESET_HASH(dt);
+
     /* Datatypes can't change in size if the force_conv flag is not set */
     if(dt->shared->force_conv) {
         /* Check the datatype of this element */
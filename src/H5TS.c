@@ -520,4 +520,43 @@ H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata)
 
 } /* H5TS_create_thread */
 
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_try_create_thread
+ *
+ * RETURNS
+ *    Non-negative on success/Negative on failure
+ *
+ * DESCRIPTION
+ *    Spawn off a new thread calling function 'func' with input 'udata',
+ *    as H5TS_create_thread() does, and return its identifier in 'thread'.
+ *    Unlike H5TS_create_thread(), a failure to create the thread is
+ *    reported, and 'thread' must not be waited for then.
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_try_create_thread(H5TS_thread_t *thread, void *(*func)(void *),
+    H5TS_attr_t *attr, void *udata)
+{
+    herr_t ret_value = SUCCEED;
+
+#ifdef  H5_HAVE_WIN_THREADS
+
+    /* (See H5TS_create_thread() for the choice of CreateThread) */
+    if(NULL == (*thread = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)func, udata, 0, NULL)))
+        ret_value = FAIL;
+
+#else /* H5_HAVE_WIN_THREADS */
+
+    if(0 != pthread_create(thread, attr, (void * (*)(void *))func, udata))
+        ret_value = FAIL;
+
+#endif /* H5_HAVE_WIN_THREADS */
+
+    return ret_value;
+
+} /* H5TS_try_create_thread */
+
 #endif  /* H5_HAVE_THREADSAFE */
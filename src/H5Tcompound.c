@@ -423,6 +423,8 @@ H5T__insert(H5T_t *parent, const char *name, size_t offset, const H5T_t *member)
     HDassert(member);
     HDassert(name && *name);
 
+    H5T_RESET_HASH(parent);
+
     /* Does NAME already exist in PARENT? */
     for(i = 0; i < parent->shared->u.compnd.nmembs; i++)
 	if(!HDstrcmp(parent->shared->u.compnd.memb[i].name, name))
@@ -511,6 +513,8 @@ H5T_pack(const H5T_t *dt)
 
     HDassert(dt);
 
+    H5T_RESET_HASH(dt);
+
     if(H5T_detect_class(dt, H5T_COMPOUND, FALSE) > 0) {
         /* If datatype has been packed, skip packing it and indicate success */
         if(TRUE == H5T_is_packed(dt))
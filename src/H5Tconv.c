@@ -961,10 +961,82 @@ done:                                                                         \
 /* Minimum size of variable-length conversion buffer */
 #define H5T_VLEN_MIN_CONF_BUF_SIZE      4096
 
+/* Maximum number of disk-based VL sequences, and of staged bytes, read from the global heap at once */
+#define H5T_VLEN_READ_BATCH             1024
+#define H5T_VLEN_READ_STAGE_MAX         (1024 * 1024)
+
+/* Staging offset of a sequence not held in a staging buffer ("nil" or in place) */
+#define H5T_VLEN_STAGE_NIL              ((size_t)-1)
+
+/* Maximum number of VL sequences, and of staged bytes, written to the global heap at once */
+#define H5T_VLEN_WRITE_BATCH            1024
+#define H5T_VLEN_WRITE_STAGE_MAX        (1024 * 1024)
+
+/* Number of elements converted at a time by H5T_conv_half() */
+#define H5T_HALF_BLOCK                  256
+
+/* Largest ratio of value range to member count for a direct enum lookup table */
+#define H5T_ENUM_DIRECT_RATIO           4
+
+/* Multiplier for hashing enum values (2^64 divided by the golden ratio) */
+#define H5T_ENUM_HASH_MULT              (((uint64_t)0x9E3779B9 << 32) | (uint64_t)0x7F4A7C15)
+
+/* Read a native integer of type T from S into the value held by
+ * H5T_conv_struct_plan_num() */
+#define H5T_CONV_STRUCT_GET(T, S) {                                           \
+    T _v;                                                                     \
+                                                                              \
+    HDmemcpy(&_v, S, sizeof(T));                                              \
+    if(_v < 0) {                                                              \
+        neg = TRUE;                                                           \
+        sval = (int64_t)_v;                                                   \
+    } /* end if */                                                            \
+    else                                                                      \
+        uval = (uint64_t)_v;                                                  \
+}
+
+/* Write the value held by H5T_conv_struct_plan_num() to D as a native
+ * integer of type T; the value is already within the range of T */
+#define H5T_CONV_STRUCT_PUT(T, D) {                                           \
+    T _v = neg ? (T)sval : (T)uval;                                           \
+                                                                              \
+    HDmemcpy(D, &_v, sizeof(T));                                              \
+}
+
 /******************/
 /* Local Typedefs */
 /******************/
 
+/* Kinds of steps in a compiled compound conversion plan */
+typedef enum H5T_conv_struct_op_type_t {
+    H5T_CONV_STRUCT_OP_COPY,            /*copy bytes unchanged               */
+    H5T_CONV_STRUCT_OP_SWAP,            /*reverse the bytes of each value    */
+    H5T_CONV_STRUCT_OP_NUM              /*convert native numbers inline      */
+} H5T_conv_struct_op_type_t;
+
+/* Kinds of native numbers converted inline by a compiled plan */
+typedef enum H5T_conv_struct_num_t {
+    H5T_CONV_STRUCT_NUM_SINT,           /*signed integer of 1, 2, 4 or 8 bytes*/
+    H5T_CONV_STRUCT_NUM_UINT,           /*unsigned integer of the same sizes */
+    H5T_CONV_STRUCT_NUM_FLOAT,          /*native float                       */
+    H5T_CONV_STRUCT_NUM_DOUBLE          /*native double                      */
+} H5T_conv_struct_num_t;
+
+/* One step of a compiled compound conversion plan */
+typedef struct H5T_conv_struct_op_t {
+    H5T_conv_struct_op_type_t type;     /*kind of step                       */
+    size_t      src_off;                /*offset of the data in src element  */
+    size_t      dst_off;                /*offset of the data in dst element  */
+    size_t      size;                   /*bytes to copy, or size of a value  */
+    size_t      src_size;               /*size of a source value             */
+    size_t      nvals;                  /*number of values to swap/convert   */
+    H5T_conv_struct_num_t src_num;      /*kind of source number              */
+    H5T_conv_struct_num_t dst_num;      /*kind of destination number         */
+    H5T_path_t  *path;                  /*hard path for the numbers          */
+    hid_t       src_id;                 /*source number type ID              */
+    hid_t       dst_id;                 /*destination number type ID         */
+} H5T_conv_struct_op_t;
+
 /* Conversion data for H5T__conv_struct() */
 typedef struct H5T_conv_struct_t {
     int	*src2dst;		/*mapping from src to dst member num */
@@ -973,15 +1045,47 @@ typedef struct H5T_conv_struct_t {
     H5T_path_t	**memb_path;		/*conversion path for each member    */
     H5T_subset_info_t   subset_info;    /*info related to compound subsets   */
     unsigned            src_nmembs;     /*needed by free function            */
+    H5T_conv_struct_op_t *plan;         /*compiled plan, NULL if none        */
+    size_t              plan_nops;      /*number of steps in plan            */
+    size_t              plan_nalloc;    /*number of steps allocated          */
+    hbool_t             plan_bkg;       /*whether the plan needs bkg values  */
+    hbool_t             plan_num;       /*whether the plan converts numbers  */
 } H5T_conv_struct_t;
 
+/* How H5T__conv_enum() finds the source member for a value */
+typedef enum H5T_enum_map_t {
+    H5T_ENUM_MAP_SEARCH,        /*binary search of source values     */
+    H5T_ENUM_MAP_DIRECT,        /*table indexed by value - base      */
+    H5T_ENUM_MAP_HASH           /*open-addressing hash on the value  */
+} H5T_enum_map_t;
+
 /* Conversion data for H5T__conv_enum() */
 typedef struct H5T_enum_struct_t {
-    int	base;			/*lowest `in' value		     */
-    unsigned length;		/*num elements in arrays	     */
-    int	*src2dst;		/*map from src to dst index	     */
+    H5T_enum_map_t map;         /*lookup method                      */
+    uint64_t	base;		/*lowest source key (direct map)     */
+    size_t	length;		/*num entries in src2dst[]           */
+    unsigned	shift;		/*hash shift, 64-log2(length)        */
+    int		*src2dst;	/*map from lookup slot to dst value  */
+    uint64_t	*keys;		/*source key of each hash slot       */
+    uint8_t	*src_value;	/*src values in value order (search) */
+    uint8_t	*dst_value;	/*dst values, one per src member     */
+    H5T_order_t	order;		/*byte order of source values        */
+    hbool_t	sign;		/*whether source values are signed   */
 } H5T_enum_struct_t;
 
+/* Name and original index of an enumeration member, for H5T_conv_enum_init() */
+typedef struct H5T_enum_name_t {
+    const char	*name;		/*member name                        */
+    unsigned	idx;		/*member index                       */
+} H5T_enum_name_t;
+
+/* Value and original index of an enumeration member, for H5T_conv_enum_init() */
+typedef struct H5T_enum_value_t {
+    const uint8_t *value;	/*member value                       */
+    size_t	size;		/*size of the value                  */
+    unsigned	idx;		/*member index                       */
+} H5T_enum_value_t;
+
 /* Conversion data for the hardware conversion functions */
 typedef struct H5T_conv_hw_t {
     size_t	s_aligned;		/*number source elements aligned     */
@@ -998,6 +1102,41 @@ typedef struct H5T_conv_hw_t {
 /********************/
 
 static herr_t H5T_reverse_order(uint8_t *rev, uint8_t *s, size_t size, H5T_order_t order);
+static hbool_t H5T_conv_struct_swappable(const H5T_t *src, const H5T_t *dst);
+static void H5T_conv_struct_plan_free(H5T_conv_struct_t *priv);
+static herr_t H5T_conv_struct_plan_add(H5T_conv_struct_t *priv,
+    const H5T_conv_struct_op_t *add, H5T_t *st, H5T_t *dt);
+#ifdef H5_WANT_DCONV_EXCEPTION
+static hbool_t H5T_conv_struct_plan_native(const H5T_t *type,
+    H5T_conv_struct_num_t *num);
+#endif /* H5_WANT_DCONV_EXCEPTION */
+static htri_t H5T_conv_struct_plan_build(H5T_conv_struct_t *priv,
+    const H5T_t *src, const H5T_t *dst, size_t src_off, size_t dst_off,
+    hid_t dxpl_id);
+static int H5T_conv_struct_plan_cmp(const void *_op1, const void *_op2);
+static herr_t H5T_conv_struct_plan_init(const H5T_t *src, const H5T_t *dst,
+    H5T_cdata_t *cdata, hid_t dxpl_id);
+static void H5T_conv_struct_plan_num(const H5T_conv_struct_op_t *op,
+    const uint8_t *s, uint8_t *d);
+static herr_t H5T_conv_struct_plan_conv(const H5T_conv_struct_t *priv,
+    const H5T_t *src, const H5T_t *dst, size_t nelmts, size_t buf_stride,
+    size_t bkg_stride, uint8_t *buf, const uint8_t *bkg, hbool_t use_path,
+    hid_t dxpl_id);
+static herr_t H5T_conv_vlen_stage(const H5T_t *src, hid_t dxpl_id,
+    const uint8_t *s, ssize_t s_stride, size_t max_nelmts, size_t src_base_size,
+    void **stage_buf, size_t *stage_buf_size, size_t *nelmts,
+    size_t stage_off[], size_t stage_len[], void *stage_vl[],
+    void *stage_ptr[]);
+static herr_t H5T_conv_vlen_flush(const H5T_t *dst, hid_t dxpl_id, size_t nseq,
+    void *vl[], void *bg[], void *buf[], const size_t off[],
+    const size_t seq_len[], void *stage_buf, size_t base_size);
+static int H5T_conv_enum_name_cmp(const void *_n1, const void *_n2);
+static int H5T_conv_enum_value_cmp(const void *_v1, const void *_v2);
+static uint64_t H5T__conv_enum_key(const uint8_t *s, size_t size,
+    H5T_order_t order, hbool_t sign);
+static herr_t H5T_conv_half(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+    size_t nelmts, size_t buf_stride, void *buf, hid_t dxpl_id,
+    H5T_half_op_t op, size_t src_size, size_t dst_size);
 
 
 /*********************/
@@ -1097,7 +1236,6 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
     uint8_t	*buf = (uint8_t*)_buf;
     H5T_t	*src = NULL;
     H5T_t	*dst = NULL;
-    size_t      i;
     herr_t      ret_value = SUCCEED;       /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -1180,296 +1318,7 @@ H5T__conv_order_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
             } /* end if */
 
             buf_stride = buf_stride ? buf_stride : src->shared->size;
-            switch(src->shared->size) {
-                case 1:
-                    /*no-op*/
-                    break;
-
-                case 2:
-                    for(/*void*/; nelmts >= 20; nelmts -= 20) {
-                        H5_SWAP_BYTES(buf, 0,   1); /*  0 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  1 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  2 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  3 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  4 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  5 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  6 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  7 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  8 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /*  9 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 10 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 11 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 12 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 13 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 14 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 15 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 16 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 17 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 18 */
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf, 0,   1); /* 19 */
-                        buf += buf_stride;
-                    } /* end for */
-                    for(i = 0; i < nelmts; i++, buf += buf_stride)
-                        H5_SWAP_BYTES(buf, 0, 1);
-                    break;
-
-                case 4:
-                    for(/*void*/; nelmts >= 20; nelmts -= 20) {
-                        H5_SWAP_BYTES(buf,  0,  3); /*  0 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  1 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  2 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  3 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  4 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  5 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  6 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  7 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  8 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /*  9 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 10 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 11 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 12 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 13 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 14 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 15 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 16 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 17 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 18 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  3); /* 19 */
-                        H5_SWAP_BYTES(buf,  1,  2);
-                        buf += buf_stride;
-                    } /* end for */
-                    for(i = 0; i < nelmts; i++, buf += buf_stride) {
-                        H5_SWAP_BYTES(buf, 0, 3);
-                        H5_SWAP_BYTES(buf, 1, 2);
-                    } /* end for */
-                    break;
-
-                case 8:
-                    for(/*void*/; nelmts >= 10; nelmts -= 10) {
-                        H5_SWAP_BYTES(buf,  0,  7); /*  0 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  1 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  2 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  3 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  4 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  5 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  6 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  7 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  8 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,  0,  7); /*  9 */
-                        H5_SWAP_BYTES(buf,  1,  6);
-                        H5_SWAP_BYTES(buf,  2,  5);
-                        H5_SWAP_BYTES(buf,  3,  4);
-                        buf += buf_stride;
-                    } /* end for */
-                    for(i = 0; i < nelmts; i++, buf += buf_stride) {
-                        H5_SWAP_BYTES(buf, 0, 7);
-                        H5_SWAP_BYTES(buf, 1, 6);
-                        H5_SWAP_BYTES(buf, 2, 5);
-                        H5_SWAP_BYTES(buf, 3, 4);
-                    } /* end for */
-                    break;
-
-                case 16:
-                    for(/*void*/; nelmts >= 10; nelmts -= 10) {
-                        H5_SWAP_BYTES(buf,   0,  15); /*  0 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  1 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  2 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  3 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  4 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  5 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  6 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  7 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  8 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                        H5_SWAP_BYTES(buf,   0,  15); /*  9 */
-                        H5_SWAP_BYTES(buf,   1,  14);
-                        H5_SWAP_BYTES(buf,   2,  13);
-                        H5_SWAP_BYTES(buf,   3,  12);
-                        H5_SWAP_BYTES(buf,   4,  11);
-                        H5_SWAP_BYTES(buf,   5,  10);
-                        H5_SWAP_BYTES(buf,   6,   9);
-                        H5_SWAP_BYTES(buf,   7,   8);
-                        buf += buf_stride;
-                    } /* end for */
-                    for(i = 0; i < nelmts; i++, buf += buf_stride) {
-                        H5_SWAP_BYTES(buf, 0, 15);
-                        H5_SWAP_BYTES(buf, 1, 14);
-                        H5_SWAP_BYTES(buf, 2, 13);
-                        H5_SWAP_BYTES(buf, 3, 12);
-                        H5_SWAP_BYTES(buf, 4, 11);
-                        H5_SWAP_BYTES(buf, 5, 10);
-                        H5_SWAP_BYTES(buf, 6,  9);
-                        H5_SWAP_BYTES(buf, 7,  8);
-                    } /* end for */
-                    break;
-
-                default:
-                    HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "invalid conversion size")
-            } /* end switch */
+            H5T__swap_bytes(buf, src->shared->size, nelmts, buf_stride);
             break;
 
         case H5T_CONV_FREE:
@@ -1887,6 +1736,7 @@ H5T_conv_struct_free(H5T_conv_struct_t *priv)
     H5MM_xfree(src_memb_id);
     H5MM_xfree(dst_memb_id);
     H5MM_xfree(priv->memb_path);
+    H5T_conv_struct_plan_free(priv);
 
     FUNC_LEAVE_NOAPI((H5T_conv_struct_t *)H5MM_xfree(priv))
 } /* end H5T_conv_struct_free() */
@@ -2084,6 +1934,669 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T_conv_struct_init() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_swappable
+ *
+ * Purpose:	Determines whether converting a value of atomic datatype
+ *		SRC to atomic datatype DST is nothing more than reversing
+ *		the order of its bytes.  This is true of integer, bitfield
+ *		and floating-point types that are identical except for
+ *		being little-endian and big-endian respectively and that
+ *		have no padding bits.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5T_conv_struct_swappable(const H5T_t *src, const H5T_t *dst)
+{
+    const H5T_atomic_t *s, *d;          /* Atomic type properties */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(src->shared->type != dst->shared->type || src->shared->size != dst->shared->size)
+        HGOTO_DONE(FALSE)
+    if(H5T_INTEGER != src->shared->type && H5T_BITFIELD != src->shared->type
+            && H5T_FLOAT != src->shared->type)
+        HGOTO_DONE(FALSE)
+
+    s = &src->shared->u.atomic;
+    d = &dst->shared->u.atomic;
+    if(!((H5T_ORDER_LE == s->order && H5T_ORDER_BE == d->order) ||
+            (H5T_ORDER_BE == s->order && H5T_ORDER_LE == d->order)))
+        HGOTO_DONE(FALSE)
+    if(s->offset != 0 || d->offset != 0 || s->prec != 8 * src->shared->size
+            || d->prec != 8 * dst->shared->size)
+        HGOTO_DONE(FALSE)
+
+    if(H5T_FLOAT == src->shared->type)
+        ret_value = (s->u.f.sign == d->u.f.sign && s->u.f.epos == d->u.f.epos
+                && s->u.f.esize == d->u.f.esize && s->u.f.ebias == d->u.f.ebias
+                && s->u.f.mpos == d->u.f.mpos && s->u.f.msize == d->u.f.msize
+                && s->u.f.norm == d->u.f.norm && s->u.f.pad == d->u.f.pad);
+    else if(H5T_INTEGER == src->shared->type)
+        ret_value = (s->u.i.sign == d->u.i.sign);
+    else
+        ret_value = TRUE;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_swappable() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_free
+ *
+ * Purpose:	Releases the compiled compound conversion plan in PRIV,
+ *		along with the datatype IDs held by its numeric steps.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_conv_struct_plan_free(H5T_conv_struct_t *priv)
+{
+    size_t      u;                      /* Local index variable */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    for(u = 0; u < priv->plan_nops; u++)
+        if(H5T_CONV_STRUCT_OP_NUM == priv->plan[u].type) {
+            int status;
+
+            status = H5I_dec_ref(priv->plan[u].src_id);
+            HDassert(status >= 0);
+            status = H5I_dec_ref(priv->plan[u].dst_id);
+            HDassert(status >= 0);
+        } /* end if */
+
+    priv->plan = (H5T_conv_struct_op_t *)H5MM_xfree(priv->plan);
+    priv->plan_nops = priv->plan_nalloc = 0;
+    priv->plan_num = FALSE;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_conv_struct_plan_free() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_add
+ *
+ * Purpose:	Appends the step ADD to the compiled compound conversion
+ *		plan in PRIV, merging it into the previous step when both
+ *		are of the same kind and the data they cover is contiguous
+ *		in both the source and the destination element.  A new
+ *		numeric step gets IDs for copies of its number types ST and
+ *		DT, for the hard conversion function.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_plan_add(H5T_conv_struct_t *priv, const H5T_conv_struct_op_t *add,
+    H5T_t *st, H5T_t *dt)
+{
+    H5T_conv_struct_op_t *op;           /* Step being added or extended */
+    H5T_t       *type = NULL;           /* Copy of a number type */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    /* Try to extend the previous step */
+    if(priv->plan_nops > 0) {
+        op = &priv->plan[priv->plan_nops - 1];
+        if(op->type == add->type && op->src_off + op->src_size * op->nvals == add->src_off
+                && op->dst_off + op->size * op->nvals == add->dst_off) {
+            if(H5T_CONV_STRUCT_OP_COPY == add->type) {
+                op->size += add->size;
+                op->src_size += add->size;
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+            else if(op->size == add->size && op->src_size == add->src_size
+                    && op->src_num == add->src_num && op->dst_num == add->dst_num) {
+                op->nvals += add->nvals;
+                HGOTO_DONE(SUCCEED)
+            } /* end if */
+        } /* end if */
+    } /* end if */
+
+    /* Make room for another step */
+    if(priv->plan_nops == priv->plan_nalloc) {
+        size_t na = MAX(8, 2 * priv->plan_nalloc);
+        H5T_conv_struct_op_t *x;
+
+        if(NULL == (x = (H5T_conv_struct_op_t *)H5MM_realloc(priv->plan, na * sizeof(H5T_conv_struct_op_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        priv->plan = x;
+        priv->plan_nalloc = na;
+    } /* end if */
+
+    op = &priv->plan[priv->plan_nops];
+    *op = *add;
+
+    /* Numeric steps keep their types registered, for the hard conversion */
+    if(H5T_CONV_STRUCT_OP_NUM == add->type) {
+        if(NULL == (type = H5T_copy(st, H5T_COPY_ALL)))
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "unable to copy datatype")
+        if((op->src_id = H5I_register(H5I_DATATYPE, type, FALSE)) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "unable to register datatype ID")
+        if(NULL == (type = H5T_copy(dt, H5T_COPY_ALL))) {
+            H5I_dec_ref(op->src_id);
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCOPY, FAIL, "unable to copy datatype")
+        } /* end if */
+        if((op->dst_id = H5I_register(H5I_DATATYPE, type, FALSE)) < 0) {
+            H5I_dec_ref(op->src_id);
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTREGISTER, FAIL, "unable to register datatype ID")
+        } /* end if */
+        type = NULL;
+    } /* end if */
+
+    priv->plan_nops++;
+
+done:
+    if(type && H5T_close(type) < 0)
+        HDONE_ERROR(H5E_DATATYPE, H5E_CANTCLOSEOBJ, FAIL, "unable to close datatype")
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_plan_add() */
+
+
+#ifdef H5_WANT_DCONV_EXCEPTION
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_native
+ *
+ * Purpose:	Checks whether TYPE is a native number that a compiled plan
+ *		can convert inline: an integer of 1, 2, 4 or 8 bytes, a
+ *		float or a double.  The kind of number is returned in NUM.
+ *		Without conversion exceptions the hard functions simply
+ *		cast, so numbers are only compiled into plans when they
+ *		are enabled.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5T_conv_struct_plan_native(const H5T_t *type, H5T_conv_struct_num_t *num)
+{
+    size_t      size = type->shared->size;  /* Size of a value */
+    hbool_t     ret_value = TRUE;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(H5T_INTEGER == type->shared->type && (1 == size || 2 == size || 4 == size || 8 == size))
+        *num = (H5T_SGN_2 == type->shared->u.atomic.u.i.sign) ?
+                H5T_CONV_STRUCT_NUM_SINT : H5T_CONV_STRUCT_NUM_UINT;
+    else if(H5T_FLOAT == type->shared->type && sizeof(float) == size)
+        *num = H5T_CONV_STRUCT_NUM_FLOAT;
+    else if(H5T_FLOAT == type->shared->type && sizeof(double) == size)
+        *num = H5T_CONV_STRUCT_NUM_DOUBLE;
+    else
+        ret_value = FALSE;
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_plan_native() */
+#endif /* H5_WANT_DCONV_EXCEPTION */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_build
+ *
+ * Purpose:	Appends the steps needed to convert compound datatype SRC,
+ *		located SRC_OFF bytes into each source element, to compound
+ *		datatype DST, located DST_OFF bytes into each destination
+ *		element.  Members are matched by name, as in
+ *		H5T_conv_struct_init().  Members that need no conversion are
+ *		copied, members that differ only in byte order are swapped,
+ *		members (or arrays of them) converted by one of the library's
+ *		hard integer and floating-point conversions are converted
+ *		inline and nested compound members are compiled recursively
+ *		into the same plan.
+ *
+ * Return:	TRUE if every member could be compiled, FALSE if some
+ *		member needs a real conversion, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5T_conv_struct_plan_build(H5T_conv_struct_t *priv, const H5T_t *src,
+    const H5T_t *dst, size_t src_off, size_t dst_off, hid_t dxpl_id)
+{
+    H5T_conv_struct_op_t op;            /* Step to add */
+    unsigned    i, j;                   /* Local index variables */
+    htri_t      ret_value = TRUE;       /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(H5T_COMPOUND == src->shared->type);
+    HDassert(H5T_COMPOUND == dst->shared->type);
+
+    /* Walk the members in offset order so that adjacent steps merge */
+    H5T__sort_value(src, NULL);
+    H5T__sort_value(dst, NULL);
+
+    for(i = 0; i < src->shared->u.compnd.nmembs && ret_value > 0; i++) {
+        const H5T_cmemb_t *src_memb = src->shared->u.compnd.memb + i;
+        const H5T_cmemb_t *dst_memb = NULL;
+        H5T_t *st, *dt;
+        size_t nvals = 1;
+
+        for(j = 0; j < dst->shared->u.compnd.nmembs; j++)
+            if(!HDstrcmp(src_memb->name, dst->shared->u.compnd.memb[j].name)) {
+                dst_memb = dst->shared->u.compnd.memb + j;
+                break;
+            } /* end if */
+        if(NULL == dst_memb)
+            continue; /*subsetting*/
+
+        st = src_memb->type;
+        dt = dst_memb->type;
+        HDmemset(&op, 0, sizeof(op));
+        op.src_off = src_off + src_memb->offset;
+        op.dst_off = dst_off + dst_memb->offset;
+        if(!st->shared->force_conv && !dt->shared->force_conv && 0 == H5T_cmp(st, dt, FALSE)) {
+            op.type = H5T_CONV_STRUCT_OP_COPY;
+            op.size = op.src_size = dst_memb->size;
+            op.nvals = 1;
+            if(H5T_conv_struct_plan_add(priv, &op, NULL, NULL) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to add step to conversion plan")
+            continue;
+        } /* end if */
+        if(H5T_COMPOUND == st->shared->type && H5T_COMPOUND == dt->shared->type) {
+            if((ret_value = H5T_conv_struct_plan_build(priv, st, dt, op.src_off, op.dst_off, dxpl_id)) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to compile nested compound member")
+            continue;
+        } /* end if */
+
+        /* Arrays are handled as runs of their base type */
+        if(H5T_ARRAY == st->shared->type && H5T_ARRAY == dt->shared->type) {
+            if(st->shared->u.array.nelem != dt->shared->u.array.nelem) {
+                ret_value = FALSE;
+                continue;
+            } /* end if */
+            nvals = dt->shared->u.array.nelem;
+            st = st->shared->parent;
+            dt = dt->shared->parent;
+        } /* end if */
+        op.nvals = nvals;
+        op.size = dt->shared->size;
+        op.src_size = st->shared->size;
+
+        if(H5T_conv_struct_swappable(st, dt)) {
+            op.type = H5T_CONV_STRUCT_OP_SWAP;
+            if(H5T_conv_struct_plan_add(priv, &op, NULL, NULL) < 0)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to add step to conversion plan")
+        } /* end if */
+#ifdef H5_WANT_DCONV_EXCEPTION
+        else if(H5T_conv_struct_plan_native(st, &op.src_num) && H5T_conv_struct_plan_native(dt, &op.dst_num)) {
+            /* Only numbers the library converts with a hard function */
+            if(NULL == (op.path = H5T_path_find(st, dt, NULL, NULL, dxpl_id, FALSE)))
+                HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "unable to convert member datatype")
+            if(!op.path->is_hard || op.path->is_api)
+                ret_value = FALSE;
+            else {
+                op.type = H5T_CONV_STRUCT_OP_NUM;
+                if(H5T_conv_struct_plan_add(priv, &op, st, dt) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to add step to conversion plan")
+            } /* end else */
+        } /* end if */
+#endif /* H5_WANT_DCONV_EXCEPTION */
+        else
+            ret_value = FALSE;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_plan_build() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_cmp
+ *
+ * Purpose:	Compares two plan steps by destination offset, for qsort().
+ *
+ * Return:	Negative, zero or positive
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5T_conv_struct_plan_cmp(const void *_op1, const void *_op2)
+{
+    const H5T_conv_struct_op_t *op1 = (const H5T_conv_struct_op_t *)_op1;
+    const H5T_conv_struct_op_t *op2 = (const H5T_conv_struct_op_t *)_op2;
+
+    if(op1->dst_off < op2->dst_off)
+        return -1;
+    if(op1->dst_off > op2->dst_off)
+        return 1;
+    return 0;
+} /* end H5T_conv_struct_plan_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_init
+ *
+ * Purpose:	Compiles the conversion from compound datatype SRC to
+ *		compound datatype DST into a plan of copy, byte-swap and
+ *		numeric conversion steps that H5T__conv_struct_opt() can
+ *		apply to each element in a single pass, and caches it in
+ *		the `priv' field of CDATA.  H5T_conv_struct_init() must have
+ *		been called first.
+ *
+ *		When the steps of the plan write every byte of the
+ *		destination element the background buffer isn't needed and
+ *		`need_bkg' is lowered accordingly.  If some member needs a
+ *		real conversion no plan is built and the member-wise
+ *		algorithm is used instead.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_plan_init(const H5T_t *src, const H5T_t *dst, H5T_cdata_t *cdata,
+    hid_t dxpl_id)
+{
+    H5T_conv_struct_t *priv = (H5T_conv_struct_t *)(cdata->priv);
+    H5T_conv_struct_op_t *sorted = NULL; /* Steps sorted by destination */
+    htri_t      status;                 /* Whether plan could be built */
+    size_t      end;                    /* End of covered destination */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(priv);
+
+    /* Discard any previous plan */
+    H5T_conv_struct_plan_free(priv);
+    priv->plan_bkg = TRUE;
+
+    /* The subset optimization already moves data directly */
+    if(priv->subset_info.subset != H5T_SUBSET_FALSE)
+        HGOTO_DONE(SUCCEED)
+
+    if((status = H5T_conv_struct_plan_build(priv, src, dst, (size_t)0, (size_t)0, dxpl_id)) < 0) {
+        H5T_conv_struct_plan_free(priv);
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to compile compound conversion")
+    } /* end if */
+    if(!status || 0 == priv->plan_nops) {
+        H5T_conv_struct_plan_free(priv);
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+    for(u = 0; u < priv->plan_nops; u++)
+        if(H5T_CONV_STRUCT_OP_NUM == priv->plan[u].type)
+            priv->plan_num = TRUE;
+
+    /* Check whether the steps cover the whole destination element */
+    if(NULL == (sorted = (H5T_conv_struct_op_t *)H5MM_malloc(priv->plan_nops * sizeof(H5T_conv_struct_op_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    HDmemcpy(sorted, priv->plan, priv->plan_nops * sizeof(H5T_conv_struct_op_t));
+    HDqsort(sorted, priv->plan_nops, sizeof(H5T_conv_struct_op_t), H5T_conv_struct_plan_cmp);
+    for(u = 0, end = 0; u < priv->plan_nops && sorted[u].dst_off <= end; u++)
+        end = MAX(end, sorted[u].dst_off + sorted[u].size * sorted[u].nvals);
+    priv->plan_bkg = (end < dst->shared->size);
+
+    if(!priv->plan_bkg)
+        cdata->need_bkg = H5T_BKG_NO;
+
+done:
+    H5MM_xfree(sorted);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_plan_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_num
+ *
+ * Purpose:	Converts the native number at S to the native number at D
+ *		as described by the numeric plan step OP, with the results
+ *		the hard conversion functions give when no conversion
+ *		exception callback is set: integers are clamped to the
+ *		range of the destination, floating-point values are clamped
+ *		to the range of an integer destination and out of range
+ *		doubles become infinite floats.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_conv_struct_plan_num(const H5T_conv_struct_op_t *op, const uint8_t *s,
+    uint8_t *d)
+{
+    int64_t     sval = 0;               /* Value of a negative integer */
+    uint64_t    uval = 0;               /* Value of a non-negative integer */
+    hbool_t     neg = FALSE;            /* Whether the integer is negative */
+    float       fval = 0.0f;            /* Value of a float */
+    double      dval = 0.0;             /* Value of a double */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Read the source value */
+    if(H5T_CONV_STRUCT_NUM_SINT == op->src_num) {
+        switch(op->src_size) {
+            case 1: H5T_CONV_STRUCT_GET(int8_t, s) break;
+            case 2: H5T_CONV_STRUCT_GET(int16_t, s) break;
+            case 4: H5T_CONV_STRUCT_GET(int32_t, s) break;
+            default: H5T_CONV_STRUCT_GET(int64_t, s) break;
+        } /* end switch */
+    } /* end if */
+    else if(H5T_CONV_STRUCT_NUM_UINT == op->src_num) {
+        switch(op->src_size) {
+            case 1: H5T_CONV_STRUCT_GET(uint8_t, s) break;
+            case 2: H5T_CONV_STRUCT_GET(uint16_t, s) break;
+            case 4: H5T_CONV_STRUCT_GET(uint32_t, s) break;
+            default: H5T_CONV_STRUCT_GET(uint64_t, s) break;
+        } /* end switch */
+    } /* end if */
+    else if(H5T_CONV_STRUCT_NUM_FLOAT == op->src_num)
+        HDmemcpy(&fval, s, sizeof(float));
+    else
+        HDmemcpy(&dval, s, sizeof(double));
+
+    if(H5T_CONV_STRUCT_NUM_SINT == op->dst_num || H5T_CONV_STRUCT_NUM_UINT == op->dst_num) {
+        uint64_t    dmax;               /* Largest destination value */
+        int64_t     dmin;               /* Smallest destination value */
+
+        if(H5T_CONV_STRUCT_NUM_SINT == op->dst_num) {
+            dmax = ((uint64_t)1 << (8 * op->size - 1)) - 1;
+            dmin = -(int64_t)dmax - 1;
+        } /* end if */
+        else {
+            dmax = (8 == op->size) ? ~(uint64_t)0 : ((uint64_t)1 << (8 * op->size)) - 1;
+            dmin = 0;
+        } /* end else */
+
+        /* Floating-point values are clamped to the integer range first */
+H5_GCC_DIAG_OFF(float-equal)
+        if(H5T_CONV_STRUCT_NUM_FLOAT == op->src_num) {
+            if(fval > (float)dmax)
+                uval = dmax;
+            else if(fval < (float)dmin) {
+                neg = TRUE;
+                sval = dmin;
+            } /* end if */
+            else if(fval < 0.0f) {
+                neg = TRUE;
+                sval = (int64_t)fval;
+            } /* end if */
+            else
+                uval = (uint64_t)fval;
+        } /* end if */
+        else if(H5T_CONV_STRUCT_NUM_DOUBLE == op->src_num) {
+            if(dval > (double)dmax)
+                uval = dmax;
+            else if(dval < (double)dmin) {
+                neg = TRUE;
+                sval = dmin;
+            } /* end if */
+            else if(dval < 0.0) {
+                neg = TRUE;
+                sval = (int64_t)dval;
+            } /* end if */
+            else
+                uval = (uint64_t)dval;
+        } /* end if */
+H5_GCC_DIAG_ON(float-equal)
+
+        /* Clamp the integer to the destination range */
+        if(neg) {
+            if(sval < dmin)
+                sval = dmin;
+        } /* end if */
+        else if(uval > dmax)
+            uval = dmax;
+
+        if(H5T_CONV_STRUCT_NUM_SINT == op->dst_num) {
+            switch(op->size) {
+                case 1: H5T_CONV_STRUCT_PUT(int8_t, d) break;
+                case 2: H5T_CONV_STRUCT_PUT(int16_t, d) break;
+                case 4: H5T_CONV_STRUCT_PUT(int32_t, d) break;
+                default: H5T_CONV_STRUCT_PUT(int64_t, d) break;
+            } /* end switch */
+        } /* end if */
+        else {
+            switch(op->size) {
+                case 1: H5T_CONV_STRUCT_PUT(uint8_t, d) break;
+                case 2: H5T_CONV_STRUCT_PUT(uint16_t, d) break;
+                case 4: H5T_CONV_STRUCT_PUT(uint32_t, d) break;
+                default: H5T_CONV_STRUCT_PUT(uint64_t, d) break;
+            } /* end switch */
+        } /* end else */
+    } /* end if */
+    else if(H5T_CONV_STRUCT_NUM_FLOAT == op->dst_num) {
+        if(H5T_CONV_STRUCT_NUM_DOUBLE == op->src_num) {
+            if(dval > (double)FLT_MAX)
+                fval = H5T_NATIVE_FLOAT_POS_INF_g;
+            else if(dval < (double)(-FLT_MAX))
+                fval = H5T_NATIVE_FLOAT_NEG_INF_g;
+            else
+                fval = (float)dval;
+        } /* end if */
+        else if(H5T_CONV_STRUCT_NUM_FLOAT != op->src_num)
+            fval = neg ? (float)sval : (float)uval;
+        HDmemcpy(d, &fval, sizeof(float));
+    } /* end if */
+    else {
+        if(H5T_CONV_STRUCT_NUM_FLOAT == op->src_num)
+            dval = (double)fval;
+        else if(H5T_CONV_STRUCT_NUM_DOUBLE != op->src_num)
+            dval = neg ? (double)sval : (double)uval;
+        HDmemcpy(d, &dval, sizeof(double));
+    } /* end else */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T_conv_struct_plan_num() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_struct_plan_conv
+ *
+ * Purpose:	Converts NELMTS elements in BUF from compound datatype SRC
+ *		to compound datatype DST by applying the compiled plan to
+ *		each element.  Each element is assembled in a temporary
+ *		buffer, starting from its background value when the plan
+ *		doesn't cover the whole destination, and then copied to its
+ *		final position.  The elements are processed from the end of
+ *		the buffer when the destination stride is larger than the
+ *		source stride so that unconverted source elements are never
+ *		overwritten.
+ *
+ *		Numbers are converted inline unless USE_PATH is set, in
+ *		which case each one goes through its hard conversion
+ *		function so that the conversion exception callback in
+ *		DXPL_ID sees it.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_struct_plan_conv(const H5T_conv_struct_t *priv, const H5T_t *src,
+    const H5T_t *dst, size_t nelmts, size_t buf_stride, size_t bkg_stride,
+    uint8_t *buf, const uint8_t *bkg, hbool_t use_path, hid_t dxpl_id)
+{
+    uint8_t     tmp_stack[256];         /* Element buffer for small types */
+    uint8_t     *tmp = tmp_stack;       /* Element being assembled */
+    size_t      src_stride, dst_stride; /* Strides through BUF */
+    size_t      dst_size = dst->shared->size; /* Size of destination element */
+    hbool_t     backward;               /* Whether to start at the end */
+    size_t      n, elmtno;              /* Element counters */
+    size_t      u, v;                   /* Local index variables */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(priv->plan);
+    HDassert(!priv->plan_bkg || bkg);
+
+    /* Compute strides through the buffer */
+    if(buf_stride)
+        src_stride = dst_stride = buf_stride;
+    else {
+        src_stride = src->shared->size;
+        dst_stride = dst_size;
+    } /* end else */
+    if(!buf_stride || !bkg_stride)
+        bkg_stride = dst_size;
+    backward = (dst_stride > src_stride);
+
+    if(dst_size > sizeof(tmp_stack) && NULL == (tmp = (uint8_t *)H5MM_malloc(dst_size)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    for(n = 0; n < nelmts; n++) {
+        const uint8_t *s;               /* Source element */
+
+        elmtno = backward ? (nelmts - n) - 1 : n;
+        s = buf + elmtno * src_stride;
+
+        /* Start from the background value, if it shows through */
+        if(priv->plan_bkg)
+            HDmemcpy(tmp, bkg + elmtno * bkg_stride, dst_size);
+
+        for(u = 0; u < priv->plan_nops; u++) {
+            const H5T_conv_struct_op_t *op = priv->plan + u;
+
+            if(H5T_CONV_STRUCT_OP_COPY == op->type)
+                HDmemcpy(tmp + op->dst_off, s + op->src_off, op->size);
+            else if(H5T_CONV_STRUCT_OP_SWAP == op->type) {
+                HDmemcpy(tmp + op->dst_off, s + op->src_off, op->size * op->nvals);
+                H5T__swap_bytes(tmp + op->dst_off, op->size, op->nvals, op->size);
+            } /* end if */
+            else if(!use_path) {
+                for(v = 0; v < op->nvals; v++)
+                    H5T_conv_struct_plan_num(op, s + op->src_off + v * op->src_size,
+                            tmp + op->dst_off + v * op->size);
+            } /* end if */
+            else {
+                for(v = 0; v < op->nvals; v++) {
+                    uint64_t val;       /* Number being converted */
+
+                    HDmemcpy(&val, s + op->src_off + v * op->src_size, op->src_size);
+                    if(H5T_convert(op->path, op->src_id, op->dst_id, (size_t)1, (size_t)0,
+                            (size_t)0, &val, NULL, dxpl_id) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to convert compound datatype member")
+                    HDmemcpy(tmp + op->dst_off + v * op->size, &val, op->size);
+                } /* end for */
+            } /* end else */
+        } /* end for */
+
+        HDmemcpy(buf + elmtno * dst_stride, tmp, dst_size);
+    } /* end for */
+
+done:
+    if(tmp && tmp != tmp_stack)
+        H5MM_xfree(tmp);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_struct_plan_conv() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T__conv_struct_subset
@@ -2360,6 +2873,12 @@ done:
  *
  *		Copy BKG to BUF for all elements
  *
+ *		When every member can simply be copied, byte-swapped or
+ *		converted between native numbers (see
+ *		H5T_conv_struct_plan_init()), the compiled plan is
+ *		applied to each element instead, and the destination may
+ *		then be larger than the source.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -2451,6 +2970,12 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
             priv = (H5T_conv_struct_t *)(cdata->priv);
             src2dst = priv->src2dst;
 
+            /* Compile the conversion into a plan, when possible */
+            if(H5T_conv_struct_plan_init(src, dst, cdata, dxpl_id) < 0) {
+                cdata->priv = H5T_conv_struct_free(priv);
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to compile conversion plan")
+            } /* end if */
+
             /*
              * If the destination type is not larger than the source type then
              * this conversion function is guaranteed to work (provided all
@@ -2460,8 +2985,9 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
              * conversion of a member in place. This is basically the same pair
              * of loops as in the actual conversion except it checks that there
              * is room for each conversion instead of actually doing anything.
+             * A compiled plan converts whole elements and always works.
              */
-            if(dst->shared->size > src->shared->size) {
+            if(NULL == priv->plan && dst->shared->size > src->shared->size) {
                 for(u = 0, offset = 0; u < src->shared->u.compnd.nmembs; u++) {
                     if(src2dst[u] < 0)
                         continue;
@@ -2502,12 +3028,15 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
 
             /* Update cached data if necessary */
-            if(cdata->recalc && H5T_conv_struct_init(src, dst, cdata, dxpl_id)<0)
-                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion data")
+            if(cdata->recalc) {
+                if(H5T_conv_struct_init(src, dst, cdata, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to initialize conversion data")
+                if(H5T_conv_struct_plan_init(src, dst, cdata, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to compile conversion plan")
+            } /* end if */
             priv = (H5T_conv_struct_t *)(cdata->priv);
             HDassert(priv);
             src2dst = priv->src2dst;
-            HDassert(bkg && cdata->need_bkg);
 
             /*
              * Insure that members are sorted.
@@ -2515,6 +3044,31 @@ H5T__conv_struct_opt(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
             H5T__sort_value(src, NULL);
             H5T__sort_value(dst, NULL);
 
+            /* Apply the compiled plan to each element, if there is one */
+            if(priv->plan) {
+                hbool_t use_path = FALSE;
+
+                if(priv->plan_bkg && NULL == bkg)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "no background buffer")
+
+                /* An exception callback must see each converted number */
+                if(priv->plan_num) {
+                    H5P_genplist_t *plist;
+                    H5T_conv_cb_t cb_struct;
+
+                    if(NULL == (plist = H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+                        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find property list for ID")
+                    if(H5P_get(plist, H5D_XFER_CONV_CB_NAME, &cb_struct) < 0)
+                        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
+                    use_path = (NULL != cb_struct.func);
+                } /* end if */
+
+                if(H5T_conv_struct_plan_conv(priv, src, dst, nelmts, buf_stride, bkg_stride, buf, bkg, use_path, dxpl_id) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "unable to convert compound datatype")
+                break;
+            } /* end if */
+            HDassert(bkg && cdata->need_bkg);
+
             /*
              * Calculate strides. If BUF_STRIDE is non-zero then convert one
              * data element at every BUF_STRIDE bytes through the main buffer
@@ -2634,12 +3188,161 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_struct_opt() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_mt_prepare
+ *
+ * Purpose:	Determines whether the conversion function for a path
+ *		converts each element independently of all others, so that
+ *		H5T_convert() may split the elements between threads.  The
+ *		library's hard conversions, the byte-order and floating-point
+ *		soft conversions and the optimized compound conversion (when
+ *		all of its members qualify) are element-independent.
+ *
+ *		Compound datatypes are sorted here so that the threads only
+ *		read the datatypes.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5T__conv_mt_prepare(H5T_path_t *tpath, H5T_t *src, H5T_t *dst)
+{
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(tpath);
+
+    if(tpath->is_noop || (tpath->is_hard && !tpath->is_api)
+            || tpath->func == H5T__conv_order_opt || tpath->func == H5T__conv_f_f)
+        ret_value = TRUE;
+    else if(tpath->func == H5T__conv_struct_opt && !tpath->cdata.recalc && src && dst) {
+        H5T_conv_struct_t *priv = (H5T_conv_struct_t *)(tpath->cdata.priv);
+        unsigned u;
+
+        HDassert(priv);
+
+        /* Sort the members now, instead of in every thread */
+        H5T__sort_value(src, NULL);
+        H5T__sort_value(dst, NULL);
+
+        /* A compiled plan only copies and swaps bytes; otherwise each
+         * member conversion must qualify also */
+        ret_value = TRUE;
+        for(u = 0; u < priv->src_nmembs && ret_value && !priv->plan; u++)
+            if(priv->src2dst[u] >= 0)
+                ret_value = H5T__conv_mt_prepare(priv->memb_path[u],
+                        (H5T_t *)H5I_object(priv->src_memb_id[u]),
+                        (H5T_t *)H5I_object(priv->dst_memb_id[priv->src2dst[u]]));
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_mt_prepare() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_enum_name_cmp
+ *
+ * Purpose:	Compares two enumeration member names for HDqsort().
+ *
+ * Return:	Negative, zero, or positive as the name of N1 sorts
+ *		before, equal to, or after the name of N2.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5T_conv_enum_name_cmp(const void *_n1, const void *_n2)
+{
+    const H5T_enum_name_t *n1 = (const H5T_enum_name_t *)_n1;
+    const H5T_enum_name_t *n2 = (const H5T_enum_name_t *)_n2;
+
+    return HDstrcmp(n1->name, n2->name);
+} /* end H5T_conv_enum_name_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_enum_value_cmp
+ *
+ * Purpose:	Compares two enumeration member values for HDqsort(), in
+ *		the order used by the binary search of H5T__conv_enum().
+ *
+ * Return:	Negative, zero, or positive as the value of V1 sorts
+ *		before, equal to, or after the value of V2.
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5T_conv_enum_value_cmp(const void *_v1, const void *_v2)
+{
+    const H5T_enum_value_t *v1 = (const H5T_enum_value_t *)_v1;
+    const H5T_enum_value_t *v2 = (const H5T_enum_value_t *)_v2;
+
+    return HDmemcmp(v1->value, v2->value, v1->size);
+} /* end H5T_conv_enum_value_cmp() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_enum_key
+ *
+ * Purpose:	Decodes the SIZE-byte enumeration value at S, stored in
+ *		byte order ORDER, into the key used by the lookup maps of
+ *		H5T__conv_enum().  Signed values are sign-extended and then
+ *		biased so that keys compare in the same order as the values.
+ *
+ * Return:	The lookup key
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5T__conv_enum_key(const uint8_t *s, size_t size, H5T_order_t order, hbool_t sign)
+{
+    uint64_t    key = 0;        /* Decoded value */
+    size_t      u;              /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    HDassert(s);
+    HDassert(size > 0 && size <= sizeof(uint64_t));
+
+    if(H5T_ORDER_BE == order)
+        for(u = 0; u < size; u++)
+            key = (key << 8) | s[u];
+    else
+        for(u = size; u > 0; u--)
+            key = (key << 8) | s[u - 1];
+
+    if(sign) {
+        if(size < sizeof(uint64_t) && ((key >> (8 * size - 1)) & 1))
+            key |= ~(uint64_t)0 << (8 * size);
+        key ^= (uint64_t)1 << 63;
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(key)
+} /* end H5T__conv_enum_key() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_conv_enum_init
  *
  * Purpose:	Initialize information for H5T__conv_enum().
  *
+ *		The destination value for each source member is found by
+ *		matching member names once, here, and cached in the private
+ *		data along with a map from source value to source member:
+ *
+ *		  * When the source values span a range no more than
+ *		    H5T_ENUM_DIRECT_RATIO times the number of members, the
+ *		    map is a table indexed by the value less the smallest
+ *		    value.
+ *
+ *		  * Otherwise the map is an open-addressing hash table with
+ *		    linear probing, at most half full.
+ *
+ *		  * Values wider than 64 bits fall back to a binary search
+ *		    of a copy of the source values sorted by value.
+ *
  * Return:	Success:	Non-negative
  *
  *		Failure:	Negative
@@ -2655,10 +3358,18 @@ static herr_t
 H5T_conv_enum_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
 {
     H5T_enum_struct_t	*priv = NULL;	/*private conversion data	*/
-    int		n;		/*src value cast as native int	*/
-    int		domain[2] = {0, 0};	/*min and max source values	*/
-    int		*map = NULL;	/*map from src value to dst idx	*/
-    unsigned	length;		/*nelmts in map array		*/
+    H5T_enum_name_t	*src_name = NULL; /*source names in sorted order */
+    H5T_enum_name_t	*dst_name = NULL; /*dest names in sorted order	*/
+    H5T_enum_value_t	*src_val = NULL; /*source values in sorted order */
+    uint8_t	*value = NULL;	/*dst values in value order	*/
+    const H5T_t	*base_type;	/*integer type of source values	*/
+    unsigned	src_nmembs;	/*number of source members	*/
+    unsigned	dst_nmembs;	/*number of destination members	*/
+    size_t	src_size;	/*size of a source value	*/
+    size_t	dst_size;	/*size of a destination value	*/
+    uint64_t	key;		/*source value as a lookup key	*/
+    uint64_t	lo = 0, hi = 0;	/*smallest and largest keys	*/
+    size_t	slot;		/*index into lookup map		*/
     unsigned	i, j;		/*counters			*/
     herr_t      ret_value = SUCCEED;    /* Return value */
 
@@ -2667,116 +3378,150 @@ H5T_conv_enum_init(H5T_t *src, H5T_t *dst, H5T_cdata_t *cdata)
     cdata->need_bkg = H5T_BKG_NO;
     if(NULL == (priv = (H5T_enum_struct_t *)(cdata->priv = H5MM_calloc(sizeof(*priv)))))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-    if(0 == src->shared->u.enumer.nmembs)
+    priv->map = H5T_ENUM_MAP_SEARCH;
+    src_nmembs = src->shared->u.enumer.nmembs;
+    dst_nmembs = dst->shared->u.enumer.nmembs;
+    if(0 == src_nmembs)
 	HGOTO_DONE(SUCCEED);
+    src_size = src->shared->size;
+    dst_size = dst->shared->size;
 
     /*
      * Check that the source symbol names are a subset of the destination
-     * symbol names and build a map from source member index to destination
-     * member index.
+     * symbol names and copy the matching destination value for each
+     * source member.  The names are matched through sorted copies so
+     * that neither datatype is reordered, and converting doesn't depend
+     * on the member order of the destination type.
      */
-    H5T__sort_name(src, NULL);
-    H5T__sort_name(dst, NULL);
-    if(NULL == (priv->src2dst = (int *)H5MM_malloc(src->shared->u.enumer.nmembs * sizeof(int))))
+    if(NULL == (src_name = (H5T_enum_name_t *)H5MM_malloc(src_nmembs * sizeof(H5T_enum_name_t))))
+	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (dst_name = (H5T_enum_name_t *)H5MM_malloc(MAX(dst_nmembs, 1) * sizeof(H5T_enum_name_t))))
+	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    for(i = 0; i < src_nmembs; i++) {
+        src_name[i].name = src->shared->u.enumer.name[i];
+        src_name[i].idx = i;
+    } /* end for */
+    for(j = 0; j < dst_nmembs; j++) {
+        dst_name[j].name = dst->shared->u.enumer.name[j];
+        dst_name[j].idx = j;
+    } /* end for */
+    HDqsort(src_name, (size_t)src_nmembs, sizeof(H5T_enum_name_t), H5T_conv_enum_name_cmp);
+    HDqsort(dst_name, (size_t)dst_nmembs, sizeof(H5T_enum_name_t), H5T_conv_enum_name_cmp);
+
+    if(NULL == (priv->dst_value = (uint8_t *)H5MM_malloc(src_nmembs * dst_size)))
 	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-    for(i = 0, j = 0;
-             i < src->shared->u.enumer.nmembs && j < dst->shared->u.enumer.nmembs;
-             i++, j++) {
-	while(j < dst->shared->u.enumer.nmembs &&
-	       HDstrcmp(src->shared->u.enumer.name[i], dst->shared->u.enumer.name[j]))
+    for(i = 0, j = 0; i < src_nmembs && j < dst_nmembs; i++, j++) {
+	while(j < dst_nmembs && HDstrcmp(src_name[i].name, dst_name[j].name))
             j++;
-	if(j >= dst->shared->u.enumer.nmembs)
+	if(j >= dst_nmembs)
 	    HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "source type is not a subset of destination type")
-	priv->src2dst[i] = (int)j;
+        HDmemcpy(priv->dst_value + src_name[i].idx * dst_size,
+                 dst->shared->u.enumer.value + dst_name[j].idx * dst_size, dst_size);
     } /* end for */
+    if(i < src_nmembs)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "source type is not a subset of destination type")
 
     /*
-     * The conversion function will use an O(log N) lookup method for each
-     * value converted. However, if all of the following constraints are met
-     * then we can build a perfect hash table and use an O(1) lookup method.
-     *
-     *	  A: The source datatype size matches one of our native datatype
-     *	     sizes.
-     *
-     *	  B: After casting the source value bit pattern to a native type
-     *	     the size of the range of values is less than 20% larger than
-     *	     the number of values.
-     *
-     * If this special case is met then we use the source bit pattern cast as
-     * a native integer type as an index into the `val2dst'. The values of
-     * that array are the index numbers in the destination type or negative
-     * if the entry is unused.
-     *
-     * (This optimized algorithm doesn't work when the byte orders are different.  
-     * The code such as "n = *((int*)(src->shared->u.enumer.value+i*src->shared->size));"
-     * can change the value significantly. i.g. if the source value is big-endian 0x0000000f,
-     * executing the casting on little-endian machine will get a big number 0x0f000000.
-     * Then it can't meet the condition 
-     * "if(src->shared->u.enumer.nmembs<2 || (double)length/src->shared->u.enumer.nmembs<1.2)"
-     * Because this is the optimized code, we won't fix it. It should still work in some 
-     * situations. SLU - 2011/5/24) 
+     * Values too wide for a 64-bit key are looked up with a binary search
+     * of a sorted copy of the source values, so put the destination values
+     * in the same order.
      */
-    if(1 == src->shared->size || sizeof(short) == src->shared->size || sizeof(int) == src->shared->size) {
-	for(i = 0; i < src->shared->u.enumer.nmembs; i++) {
-	    if(1 == src->shared->size)
-		n = *((signed char *)(src->shared->u.enumer.value + i));
-	    else if (sizeof(short) == src->shared->size)
-		n = *((short *)(src->shared->u.enumer.value + i * src->shared->size));
-	    else
-		n = *((int *)(src->shared->u.enumer.value + i * src->shared->size));
-	    if(0 == i) {
-		domain[0] = domain[1] = n;
-	    } else {
-		domain[0] = MIN(domain[0], n);
-		domain[1] = MAX(domain[1], n);
-	    }
-	} /* end for */
-
-        HDassert(domain[1] >= domain[0]);
-	length = (unsigned)(domain[1] - domain[0]) + 1;
-	if(src->shared->u.enumer.nmembs < 2 ||
-                (double)length / src->shared->u.enumer.nmembs < (double)(1.2f)) {
-	    priv->base = domain[0];
-	    priv->length = length;
-	    if(NULL == (map = (int *)H5MM_malloc(length * sizeof(int))))
-		HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
-	    for(i = 0; i < length; i++)
-                map[i] = -1; /*entry unused*/
-	    for(i = 0; i < src->shared->u.enumer.nmembs; i++) {
-		if(1 == src->shared->size)
-		    n = *((signed char *)(src->shared->u.enumer.value + i));
-		else if(sizeof(short) == src->shared->size)
-		    n = *((short *)(src->shared->u.enumer.value + i * src->shared->size));
-		else
-		    n = *((int *)(src->shared->u.enumer.value + i * src->shared->size));
-		n -= priv->base;
-		HDassert(n >= 0 && (unsigned)n < priv->length);
-		HDassert(map[n] < 0);
-		map[n] = priv->src2dst[i];
-	    } /* end for */
-
-	    /*
-	     * Replace original src2dst array with our new one. The original
-	     * was indexed by source member number while the new one is
-	     * indexed by source values.
-	     */
-	    H5MM_xfree(priv->src2dst);
-	    priv->src2dst = map;
-	    HGOTO_DONE(SUCCEED);
-	}
-    }
+    if(src_size > sizeof(uint64_t)) {
+        if(NULL == (src_val = (H5T_enum_value_t *)H5MM_malloc(src_nmembs * sizeof(H5T_enum_value_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        if(NULL == (priv->src_value = (uint8_t *)H5MM_malloc(src_nmembs * src_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        if(NULL == (value = (uint8_t *)H5MM_malloc(src_nmembs * dst_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for(i = 0; i < src_nmembs; i++) {
+            src_val[i].value = src->shared->u.enumer.value + i * src_size;
+            src_val[i].size = src_size;
+            src_val[i].idx = i;
+        } /* end for */
+        HDqsort(src_val, (size_t)src_nmembs, sizeof(H5T_enum_value_t), H5T_conv_enum_value_cmp);
+        for(i = 0; i < src_nmembs; i++) {
+            HDmemcpy(priv->src_value + i * src_size, src_val[i].value, src_size);
+            HDmemcpy(value + i * dst_size, priv->dst_value + src_val[i].idx * dst_size, dst_size);
+        } /* end for */
+        H5MM_xfree(priv->dst_value);
+        priv->dst_value = value;
+        value = NULL;
+        HGOTO_DONE(SUCCEED);
+    } /* end if */
 
-    /* Sort source type by value and adjust src2dst[] appropriately */
-    H5T__sort_value(src, priv->src2dst);
+    /* Find the range of the source values */
+    base_type = src->shared->parent;
+    HDassert(base_type);
+    priv->order = base_type->shared->u.atomic.order;
+    priv->sign = (hbool_t)(H5T_SGN_2 == base_type->shared->u.atomic.u.i.sign);
+    for(i = 0; i < src_nmembs; i++) {
+        key = H5T__conv_enum_key(src->shared->u.enumer.value + i * src_size, src_size, priv->order, priv->sign);
+        if(0 == i)
+            lo = hi = key;
+        else {
+            lo = MIN(lo, key);
+            hi = MAX(hi, key);
+        } /* end else */
+    } /* end for */
+
+    if((hi - lo) / H5T_ENUM_DIRECT_RATIO < src_nmembs) {
+        /* Dense values: index a table by the value less the smallest value */
+        priv->map = H5T_ENUM_MAP_DIRECT;
+        priv->base = lo;
+        priv->length = (size_t)(hi - lo) + 1;
+        if(NULL == (priv->src2dst = (int *)H5MM_malloc(priv->length * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for(slot = 0; slot < priv->length; slot++)
+            priv->src2dst[slot] = -1; /*entry unused*/
+        for(i = 0; i < src_nmembs; i++) {
+            key = H5T__conv_enum_key(src->shared->u.enumer.value + i * src_size, src_size, priv->order, priv->sign);
+            slot = (size_t)(key - lo);
+            HDassert(priv->src2dst[slot] < 0);
+            priv->src2dst[slot] = (int)i;
+        } /* end for */
+    } /* end if */
+    else {
+        /* Sparse values: hash them into a table at most half full */
+        priv->map = H5T_ENUM_MAP_HASH;
+        priv->length = 2;
+        priv->shift = 63;
+        while(priv->length < 2 * (size_t)src_nmembs) {
+            priv->length *= 2;
+            priv->shift--;
+        } /* end while */
+        if(NULL == (priv->src2dst = (int *)H5MM_malloc(priv->length * sizeof(int))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        if(NULL == (priv->keys = (uint64_t *)H5MM_malloc(priv->length * sizeof(uint64_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+        for(slot = 0; slot < priv->length; slot++)
+            priv->src2dst[slot] = -1; /*entry unused*/
+        for(i = 0; i < src_nmembs; i++) {
+            key = H5T__conv_enum_key(src->shared->u.enumer.value + i * src_size, src_size, priv->order, priv->sign);
+            slot = (size_t)((key * H5T_ENUM_HASH_MULT) >> priv->shift);
+            while(priv->src2dst[slot] >= 0) {
+                HDassert(priv->keys[slot] != key);
+                slot = (slot + 1) & (priv->length - 1);
+            } /* end while */
+            priv->keys[slot] = key;
+            priv->src2dst[slot] = (int)i;
+        } /* end for */
+    } /* end else */
 
 done:
-    if (ret_value<0 && priv) {
+    H5MM_xfree(src_name);
+    H5MM_xfree(dst_name);
+    H5MM_xfree(src_val);
+    H5MM_xfree(value);
+    if(ret_value < 0 && priv) {
 	H5MM_xfree(priv->src2dst);
+	H5MM_xfree(priv->keys);
+	H5MM_xfree(priv->src_value);
+	H5MM_xfree(priv->dst_value);
 	H5MM_xfree(priv);
 	cdata->priv = NULL;
-    }
+    } /* end if */
     FUNC_LEAVE_NOAPI(ret_value)
-}
+} /* end H5T_conv_enum_init() */
 
 
 /*-------------------------------------------------------------------------
@@ -2801,7 +3546,9 @@ H5T__conv_enum(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     H5T_t	*src = NULL, *dst = NULL;	/*src and dst datatypes	*/
     uint8_t	*s = NULL, *d = NULL;	/*src and dst BUF pointers	*/
     ssize_t	src_delta, dst_delta;	/*conversion strides		*/
-    int	n;			/*src value cast as native int	*/
+    int		memb;			/*source member of a value	*/
+    uint64_t	key;			/*source value as a lookup key	*/
+    size_t	slot;			/*index into lookup map		*/
     H5T_enum_struct_t *priv = (H5T_enum_struct_t*)(cdata->priv);
     H5P_genplist_t      *plist;         /*property list pointer         */
     H5T_conv_cb_t       cb_struct;      /*conversion callback structure */
@@ -2832,14 +3579,18 @@ H5T__conv_enum(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
 
         case H5T_CONV_FREE:
 #ifdef H5T_DEBUG
-            if (H5DEBUG(T)) {
+            if (H5DEBUG(T) && priv) {
                 fprintf(H5DEBUG(T), "      Using %s mapping function%s\n",
-                        priv->length?"O(1)":"O(log N)",
-                        priv->length?"":", where N is the number of enum members");
+                        H5T_ENUM_MAP_DIRECT == priv->map ? "O(1) table" :
+                            (H5T_ENUM_MAP_HASH == priv->map ? "O(1) hash" : "O(log N)"),
+                        H5T_ENUM_MAP_SEARCH == priv->map ? ", where N is the number of enum members" : "");
             }
 #endif
             if (priv) {
                 H5MM_xfree(priv->src2dst);
+                H5MM_xfree(priv->keys);
+                H5MM_xfree(priv->src_value);
+                H5MM_xfree(priv->dst_value);
                 H5MM_xfree(priv);
             }
             cdata->priv = NULL;
@@ -2853,14 +3604,6 @@ H5T__conv_enum(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(H5T_ENUM != dst->shared->type) 
                 HGOTO_ERROR(H5E_DATATYPE, H5E_BADTYPE, FAIL, "not a H5T_ENUM datatype")
 
-            /* priv->src2dst map was computed for certain sort keys. Make sure those same
-             * sort keys are used here during conversion. See H5T_conv_enum_init(). But
-             * we actually don't care about the source type's order when doing the O(1)
-             * conversion algorithm, which is turned on by non-zero priv->length */
-            H5T__sort_name(dst, NULL);
-            if(!priv->length)
-                H5T__sort_value(src, NULL);
-
             /*
              * Direction of conversion.
              */
@@ -2890,76 +3633,67 @@ H5T__conv_enum(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                 HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
 
             for(i = 0; i < nelmts; i++, s += src_delta, d += dst_delta) {
-                if(priv->length) {
-                    /* Use O(1) lookup */
-                    /* (The casting won't work when the byte orders are different. i.g. if the source value
-                     * is big-endian 0x0000000f, the direct casting "n = *((int*)s);" will make it a big
-                     * number 0x0f000000 on little-endian machine. But we won't fix it because it's an 
-                     * optimization code. Please also see the comment in the H5T_conv_enum_init() function.
-                     * SLU - 2011/5/24)
-                     */ 
-                    if(1 == src->shared->size)
-                        n = *((signed char*)s);
-                    else if(sizeof(short) == src->shared->size)
-                        n = *((short*)s);
-                    else
-                        n = *((int*)s);
-                    n -= priv->base;
-                    if(n < 0 || (unsigned)n >= priv->length || priv->src2dst[n] < 0) {
-                        /*overflow*/
-                        except_ret = H5T_CONV_UNHANDLED;
-                        /*If user's exception handler is present, use it*/
-                        if(cb_struct.func)
-                            except_ret = (cb_struct.func)(H5T_CONV_EXCEPT_RANGE_HI, src_id, dst_id,
-                                    s, d, cb_struct.user_data);
+                /* Find the source member with this value */
+                memb = -1;
+                switch(priv->map) {
+                    case H5T_ENUM_MAP_DIRECT:
+                        key = H5T__conv_enum_key(s, src->shared->size, priv->order, priv->sign);
+                        if(key - priv->base < priv->length)
+                            memb = priv->src2dst[key - priv->base];
+                        break;
 
-                        if(except_ret == H5T_CONV_UNHANDLED)
-                            HDmemset(d, 0xff, dst->shared->size);
-                        else if(except_ret == H5T_CONV_ABORT)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception")
-                    } else
-                        HDmemcpy(d,
-                                 dst->shared->u.enumer.value + (unsigned)priv->src2dst[n] * dst->shared->size,
-                                 dst->shared->size);
-                } /* end if */
-                else {
-                    /* Use O(log N) lookup */
-                    unsigned lt = 0;
-                    unsigned rt = src->shared->u.enumer.nmembs;
-                    unsigned md = 0;
-                    int cmp;
-
-                    while(lt < rt) {
-                        md = (lt + rt) / 2;
-                        cmp = HDmemcmp(s, src->shared->u.enumer.value + md * src->shared->size,
-                                       src->shared->size);
-                        if(cmp < 0)
-                            rt = md;
-                        else if(cmp > 0)
-                            lt = md + 1;
-                        else
-                            break;
-                    } /* end while */
-                    if(lt >= rt) {
-                        except_ret = H5T_CONV_UNHANDLED;
-                        /*If user's exception handler is present, use it*/
-                        if(cb_struct.func)
-                            except_ret = (cb_struct.func)(H5T_CONV_EXCEPT_RANGE_HI, src_id, dst_id,
-                                    src, d, cb_struct.user_data);
+                    case H5T_ENUM_MAP_HASH:
+                        key = H5T__conv_enum_key(s, src->shared->size, priv->order, priv->sign);
+                        slot = (size_t)((key * H5T_ENUM_HASH_MULT) >> priv->shift);
+                        while(priv->src2dst[slot] >= 0) {
+                            if(priv->keys[slot] == key) {
+                                memb = priv->src2dst[slot];
+                                break;
+                            } /* end if */
+                            slot = (slot + 1) & (priv->length - 1);
+                        } /* end while */
+                        break;
 
-                        if(except_ret == H5T_CONV_UNHANDLED)
-                            HDmemset(d, 0xff, dst->shared->size);
-                        else if(except_ret == H5T_CONV_ABORT)
-                            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception")
-                    } /* end if */
-                    else {
-                        HDassert(priv->src2dst[md] >= 0);
-                        HDmemcpy(d,
-                                 dst->shared->u.enumer.value + (unsigned)priv->src2dst[md] * dst->shared->size,
-                                 dst->shared->size);
-                    } /* end else */
-                } /* end else */
-            }
+                    case H5T_ENUM_MAP_SEARCH:
+                    default:
+                        {
+                            unsigned lt = 0;
+                            unsigned rt = src->shared->u.enumer.nmembs;
+                            unsigned md;
+                            int cmp;
+
+                            while(lt < rt) {
+                                md = (lt + rt) / 2;
+                                cmp = HDmemcmp(s, priv->src_value + md * src->shared->size,
+                                               src->shared->size);
+                                if(cmp < 0)
+                                    rt = md;
+                                else if(cmp > 0)
+                                    lt = md + 1;
+                                else {
+                                    memb = (int)md;
+                                    break;
+                                } /* end else */
+                            } /* end while */
+                        }
+                        break;
+                } /* end switch */
+
+                if(memb < 0) {
+                    except_ret = H5T_CONV_UNHANDLED;
+                    /*If user's exception handler is present, use it*/
+                    if(cb_struct.func)
+                        except_ret = (cb_struct.func)(H5T_CONV_EXCEPT_RANGE_HI, src_id, dst_id,
+                                s, d, cb_struct.user_data);
+
+                    if(except_ret == H5T_CONV_UNHANDLED)
+                        HDmemset(d, 0xff, dst->shared->size);
+                    else if(except_ret == H5T_CONV_ABORT)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception")
+                } /* end if */
+                else
+                    HDmemcpy(d, priv->dst_value + (unsigned)memb * dst->shared->size, dst->shared->size);
+            } /* end for */
 
             break;
 
@@ -3053,6 +3787,135 @@ done:
 } /* end H5T__conv_enum_numeric() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_vlen_stage
+ *
+ * Purpose:	Reads up to MAX_NELMTS disk-based VL sequences starting
+ *		at S (advancing S_STRIDE bytes each time) into a single
+ *		staging buffer, growing it as necessary.  The global heap
+ *		objects are fetched together, so each heap collection is
+ *		protected only once per batch.  The batch stops before the
+ *		staged sequences exceed H5T_VLEN_READ_STAGE_MAX bytes
+ *		(but holds at least one sequence), and *NELMTS is set to
+ *		the number of sequences in it.
+ *
+ *		On return STAGE_OFF[i] holds the offset of the i'th
+ *		sequence in the staging buffer, or H5T_VLEN_STAGE_NIL for
+ *		"nil" sequences, and STAGE_LEN[i] holds its number of
+ *		elements, so the caller needn't look them up again.
+ *		STAGE_VL and STAGE_PTR are scratch arrays.  All four
+ *		arrays have at least MAX_NELMTS entries.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_vlen_stage(const H5T_t *src, hid_t dxpl_id, const uint8_t *s,
+    ssize_t s_stride, size_t max_nelmts, size_t src_base_size, void **stage_buf,
+    size_t *stage_buf_size, size_t *nelmts, size_t stage_off[],
+    size_t stage_len[], void *stage_vl[], void *stage_ptr[])
+{
+    size_t      total = 0;              /* Total size of the batch in bytes */
+    size_t      nseq = 0;               /* Number of non-nil sequences */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(src);
+    HDassert(H5T_LOC_DISK == src->shared->u.vlen.loc);
+    HDassert(stage_buf && stage_buf_size);
+    HDassert(max_nelmts > 0);
+    HDassert(nelmts);
+
+    /* Lay out the non-nil sequences back to back in the staging buffer */
+    for(u = 0; u < max_nelmts; u++, s += s_stride) {
+        htri_t  isnull;         /* Whether the sequence is "nil" */
+        ssize_t sseq_len;       /* Number of elements in the sequence */
+        size_t  seq_size;       /* Size of the sequence in bytes */
+
+        if((isnull = (*(src->shared->u.vlen.isnull))(src->shared->u.vlen.f, (void *)s)) < 0)
+            HGOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check for 'nil' VL data")
+        if(isnull) {
+            stage_off[u] = H5T_VLEN_STAGE_NIL;
+            stage_len[u] = 0;
+            continue;
+        } /* end if */
+        if((sseq_len = (*(src->shared->u.vlen.getlen))(s)) < 0)
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "incorrect length")
+        seq_size = (size_t)sseq_len * src_base_size;
+
+        /* End the batch at the byte limit */
+        if(nseq > 0 && total + seq_size > H5T_VLEN_READ_STAGE_MAX)
+            break;
+
+        stage_off[u] = total;
+        stage_len[u] = (size_t)sseq_len;
+        stage_vl[nseq++] = (void *)s;
+        total += seq_size;
+    } /* end for */
+    *nelmts = u;
+
+    /* Grow the staging buffer, in H5T_VLEN_MIN_CONF_BUF_SIZE increments */
+    if(NULL == *stage_buf || *stage_buf_size < total) {
+        size_t new_size = ((total / H5T_VLEN_MIN_CONF_BUF_SIZE) + 1) * H5T_VLEN_MIN_CONF_BUF_SIZE;
+
+        if(NULL == (*stage_buf = H5FL_BLK_REALLOC(vlen_seq, *stage_buf, new_size)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+        *stage_buf_size = new_size;
+    } /* end if */
+
+    /* Point each sequence at its slot and read the whole batch */
+    for(u = 0, nseq = 0; u < *nelmts; u++)
+        if(stage_off[u] != H5T_VLEN_STAGE_NIL)
+            stage_ptr[nseq++] = (uint8_t *)*stage_buf + stage_off[u];
+    if(H5T__vlen_disk_read_multi(src->shared->u.vlen.f, dxpl_id, nseq, stage_vl, stage_ptr) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_vlen_stage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_vlen_flush
+ *
+ * Purpose:	Writes a batch of NSEQ VL sequences to the file.  Sequences
+ *		with an offset OFF[i] other than H5T_VLEN_STAGE_NIL were
+ *		copied into STAGE_BUF at that offset; the others are
+ *		written directly from BUF[i].
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_vlen_flush(const H5T_t *dst, hid_t dxpl_id, size_t nseq, void *vl[],
+    void *bg[], void *buf[], const size_t off[], const size_t seq_len[],
+    void *stage_buf, size_t base_size)
+{
+    size_t      u;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    HDassert(dst);
+    HDassert(H5T_LOC_DISK == dst->shared->u.vlen.loc);
+
+    /* Point the staged sequences at their final location in the staging buffer */
+    for(u = 0; u < nseq; u++)
+        if(off[u] != H5T_VLEN_STAGE_NIL)
+            buf[u] = (uint8_t *)stage_buf + off[u];
+
+    if(H5T__vlen_disk_write_multi(dst->shared->u.vlen.f, dxpl_id, nseq, vl, bg, buf, seq_len, base_size) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_vlen_flush() */
+
+
 /*-------------------------------------------------------------------------
  * Function:	H5T__conv_vlen
  *
@@ -3120,6 +3983,25 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
     void	*tmp_buf = NULL;     	/*temporary background buffer 	     */
     size_t	tmp_buf_size = 0;	/*size of temporary bkg buffer	     */
     hbool_t     nested = FALSE;         /*flag of nested VL case             */
+    hbool_t     batch_read = FALSE;     /*read sequences from file in batches */
+    void	*stage_buf = NULL;	/*staging buffer for batched reads   */
+    size_t	stage_buf_size = 0;	/*size of staging buffer in bytes    */
+    size_t	*stage_off = NULL;	/*staging offset of each sequence    */
+    size_t	*stage_len = NULL;	/*length of each staged sequence     */
+    void	**stage_vl = NULL;	/*scratch space for batched reads    */
+    void	**stage_ptr = NULL;	/*scratch space for batched reads    */
+    size_t	batch_start = 0, batch_end = 0;/*elements staged in current batch */
+    void	*seq_buf = NULL;	/*sequence to write to destination   */
+    hbool_t     batch_write = FALSE;    /*write sequences to file in batches */
+    void	*wstage_buf = NULL;	/*staging buffer for batched writes  */
+    size_t	wstage_buf_size = 0;	/*size of write staging buffer       */
+    size_t	wstage_used = 0;	/*bytes used in write staging buffer */
+    size_t	nwbatch = 0;		/*sequences in current write batch   */
+    void	**wbatch_vl = NULL;	/*destinations of batched sequences  */
+    void	**wbatch_bg = NULL;	/*backgrounds of batched sequences   */
+    void	**wbatch_buf = NULL;	/*data of batched sequences          */
+    size_t	*wbatch_off = NULL;	/*staging offsets of batched sequences */
+    size_t	*wbatch_len = NULL;	/*lengths of batched sequences       */
     size_t	elmtno;			/*element number counter	     */
     herr_t      ret_value = SUCCEED;    /* Return value */
 
@@ -3221,6 +4103,38 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
             if(write_to_file && parent_is_vlen && bkg != NULL)
                 nested = TRUE;
 
+            /* Sequences read from the file are fetched from the global heap
+             * in batches, so that each heap collection is only protected once
+             * per batch instead of once per sequence.
+             */
+            if(!write_to_file && H5T_LOC_DISK == src->shared->u.vlen.loc && nelmts > 1) {
+                size_t batch_size = MIN(nelmts, H5T_VLEN_READ_BATCH);
+
+                if(NULL == (stage_off = (size_t *)H5MM_malloc(batch_size * sizeof(size_t))) ||
+                        NULL == (stage_len = (size_t *)H5MM_malloc(batch_size * sizeof(size_t))) ||
+                        NULL == (stage_vl = (void **)H5MM_malloc(batch_size * sizeof(void *))) ||
+                        NULL == (stage_ptr = (void **)H5MM_malloc(batch_size * sizeof(void *))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+                batch_read = TRUE;
+            } /* end if */
+
+            /* Likewise, sequences written to the file are collected and
+             * inserted into the global heap together, so that they end up
+             * packed into as few collections as possible.  (The nested VL
+             * case needs each sequence's background data, so is left alone.)
+             */
+            if(write_to_file && H5T_LOC_DISK == dst->shared->u.vlen.loc && !nested && nelmts > 1) {
+                size_t batch_size = MIN(nelmts, H5T_VLEN_WRITE_BATCH);
+
+                if(NULL == (wbatch_vl = (void **)H5MM_malloc(batch_size * sizeof(void *))) ||
+                        NULL == (wbatch_bg = (void **)H5MM_malloc(batch_size * sizeof(void *))) ||
+                        NULL == (wbatch_buf = (void **)H5MM_malloc(batch_size * sizeof(void *))) ||
+                        NULL == (wbatch_off = (size_t *)H5MM_malloc(batch_size * sizeof(size_t))) ||
+                        NULL == (wbatch_len = (size_t *)H5MM_malloc(batch_size * sizeof(size_t))))
+                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+                batch_write = TRUE;
+            } /* end if */
+
             /* The outer loop of the type conversion macro, controlling which */
             /* direction the buffer is walked */
             while(nelmts > 0) {
@@ -3261,9 +4175,22 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                     safe = nelmts;
                 } /* end else */
 
+                batch_start = batch_end = 0;
                 for(elmtno = 0; elmtno < safe; elmtno++) {
-                    /* Check for "nil" source sequence */
-                    if((*(src->shared->u.vlen.isnull))(src->shared->u.vlen.f, s)) {
+                    /* Stage the next batch of sequences from the file */
+                    if(batch_read && elmtno == batch_end) {
+                        size_t nstaged;     /* Number of sequences in the batch */
+
+                        batch_start = elmtno;
+                        if(H5T_conv_vlen_stage(src, dxpl_id, s, s_stride, MIN(safe - elmtno, H5T_VLEN_READ_BATCH), src_base_size, &stage_buf, &stage_buf_size, &nstaged, stage_off, stage_len, stage_vl, stage_ptr) < 0)
+                            HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
+                        batch_end = batch_start + nstaged;
+                    } /* end if */
+
+                    /* Check for "nil" source sequence (staged sequences were
+                     * checked, and measured, when they were staged) */
+                    if(batch_read ? (stage_off[elmtno - batch_start] == H5T_VLEN_STAGE_NIL)
+                            : (*(src->shared->u.vlen.isnull))(src->shared->u.vlen.f, s)) {
                         /* Write "nil" sequence to destination location */
                         if((*(dst->shared->u.vlen.setnull))(dst->shared->u.vlen.f, dxpl_id, d, b) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't set VL data to 'nil'")
@@ -3273,9 +4200,13 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                         size_t 	seq_len;    /* The number of elements in the current sequence*/
 
                         /* Get length of element sequences */
-                        if((sseq_len = (*(src->shared->u.vlen.getlen))(s)) < 0)
-                            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "incorrect length")
-                        seq_len = (size_t)sseq_len;
+                        if(batch_read)
+                            seq_len = stage_len[elmtno - batch_start];
+                        else {
+                            if((sseq_len = (*(src->shared->u.vlen.getlen))(s)) < 0)
+                                HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "incorrect length")
+                            seq_len = (size_t)sseq_len;
+                        } /* end else */
 
                         /* If we are reading from memory and there is no conversion, just get the pointer to sequence */
                         if(write_to_file && noop_conv) {
@@ -3283,6 +4214,11 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                             if(NULL == (conv_buf = (*(src->shared->u.vlen.getptr))(s)))
                                 HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "invalid source pointer")
                         } /* end if */
+                        /* If the sequence was staged and there is no conversion, write it from the staging buffer */
+                        else if(batch_read && noop_conv) {
+                            HDassert(stage_off[elmtno - batch_start] != H5T_VLEN_STAGE_NIL);
+                            seq_buf = (uint8_t *)stage_buf + stage_off[elmtno - batch_start];
+                        } /* end else-if */
                         else {
                             size_t	src_size, dst_size;     /*source & destination total size in bytes*/
 
@@ -3306,9 +4242,15 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                             } /* end if */
 
                             /* Read in VL sequence */
-                            if((*(src->shared->u.vlen.read))(src->shared->u.vlen.f, dxpl_id, s, conv_buf, src_size) < 0)
+                            if(batch_read) {
+                                HDassert(stage_off[elmtno - batch_start] != H5T_VLEN_STAGE_NIL);
+                                HDmemcpy(conv_buf, (uint8_t *)stage_buf + stage_off[elmtno - batch_start], src_size);
+                            } /* end if */
+                            else if((*(src->shared->u.vlen.read))(src->shared->u.vlen.f, dxpl_id, s, conv_buf, src_size) < 0)
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "can't read VL data")
                         } /* end else */
+                        if(!(batch_read && noop_conv))
+                            seq_buf = conv_buf;
 
                         if(!noop_conv) {
                             /* Check if temporary buffer is large enough, resize if necessary */
@@ -3350,8 +4292,41 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                                 HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "datatype conversion failed")
                         } /* end if */
 
+                        /* Queue sequence for writing to destination location */
+                        if(batch_write) {
+                            wbatch_vl[nwbatch] = d;
+                            wbatch_bg[nwbatch] = b;
+                            wbatch_len[nwbatch] = seq_len;
+
+                            /* Sequences in the application's buffer stay where they are,
+                             * converted ones are copied out of the conversion buffer */
+                            if(noop_conv) {
+                                wbatch_buf[nwbatch] = seq_buf;
+                                wbatch_off[nwbatch] = H5T_VLEN_STAGE_NIL;
+                            } /* end if */
+                            else {
+                                size_t dst_size = seq_len * dst_base_size;
+
+                                if(wstage_buf_size < wstage_used + dst_size) {
+                                    wstage_buf_size = (((wstage_used + dst_size) / H5T_VLEN_MIN_CONF_BUF_SIZE) + 1) * H5T_VLEN_MIN_CONF_BUF_SIZE;
+                                    if(NULL == (wstage_buf = H5FL_BLK_REALLOC(vlen_seq, wstage_buf, wstage_buf_size)))
+                                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for type conversion")
+                                } /* end if */
+                                HDmemcpy((uint8_t *)wstage_buf + wstage_used, seq_buf, dst_size);
+                                wbatch_off[nwbatch] = wstage_used;
+                                wstage_used += dst_size;
+                            } /* end else */
+                            nwbatch++;
+
+                            /* Write the batch once it is full */
+                            if(nwbatch == H5T_VLEN_WRITE_BATCH || wstage_used >= H5T_VLEN_WRITE_STAGE_MAX) {
+                                if(H5T_conv_vlen_flush(dst, dxpl_id, nwbatch, wbatch_vl, wbatch_bg, wbatch_buf, wbatch_off, wbatch_len, wstage_buf, dst_base_size) < 0)
+                                    HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+                                nwbatch = wstage_used = 0;
+                            } /* end if */
+                        } /* end if */
                         /* Write sequence to destination location */
-                        if((*(dst->shared->u.vlen.write))(dst->shared->u.vlen.f, dxpl_id, vl_alloc_info, d, conv_buf, b, seq_len, dst_base_size) < 0)
+                        else if((*(dst->shared->u.vlen.write))(dst->shared->u.vlen.f, dxpl_id, vl_alloc_info, d, seq_buf, b, seq_len, dst_base_size) < 0)
                             HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
 
                         if(!noop_conv) {
@@ -3382,6 +4357,13 @@ H5T__conv_vlen(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
                     b += b_stride;
                 } /* end for */
 
+                /* Write any sequences still queued */
+                if(nwbatch > 0) {
+                    if(H5T_conv_vlen_flush(dst, dxpl_id, nwbatch, wbatch_vl, wbatch_bg, wbatch_buf, wbatch_off, wbatch_len, wstage_buf, dst_base_size) < 0)
+                        HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "can't write VL data")
+                    nwbatch = wstage_used = 0;
+                } /* end if */
+
                 /* Decrement number of elements left to convert */
                 nelmts -= safe;
             } /* end while */
@@ -3407,6 +4389,21 @@ done:
     /* Release the background buffer, if we have one */
     if(tmp_buf)
         tmp_buf = H5FL_BLK_FREE(vlen_seq, tmp_buf);
+    /* Release the staging buffer for batched reads */
+    if(stage_buf)
+        stage_buf = H5FL_BLK_FREE(vlen_seq, stage_buf);
+    H5MM_xfree(stage_off);
+    H5MM_xfree(stage_len);
+    H5MM_xfree(stage_vl);
+    H5MM_xfree(stage_ptr);
+    /* Release the staging buffer for batched writes */
+    if(wstage_buf)
+        wstage_buf = H5FL_BLK_FREE(vlen_seq, wstage_buf);
+    H5MM_xfree(wbatch_vl);
+    H5MM_xfree(wbatch_bg);
+    H5MM_xfree(wbatch_buf);
+    H5MM_xfree(wbatch_off);
+    H5MM_xfree(wbatch_len);
 
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5T__conv_vlen() */
@@ -7274,6 +8271,351 @@ H5T__conv_ldouble_double (hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
 }
 #endif /* H5_SIZEOF_LONG_DOUBLE != 0 */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_conv_half
+ *
+ * Purpose:	Common code for the hardware conversions between the 16-bit
+ *		floating-point types and native `float' and `double'.
+ *		Elements are gathered H5T_HALF_BLOCK at a time into aligned
+ *		temporary arrays, converted there by H5T__half_convert()
+ *		and scattered back, so BUF need not be aligned.  Widening
+ *		conversions of packed data walk the buffer from the end, so
+ *		no block overwrites values that have not been converted yet.
+ *
+ *		Narrowing values too large for the destination become
+ *		infinity, which is reported to the application's conversion
+ *		exception callback, if any, like H5T__conv_double_float()
+ *		does.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5T_conv_half(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata, size_t nelmts,
+    size_t buf_stride, void *buf, hid_t dxpl_id, H5T_half_op_t op,
+    size_t src_size, size_t dst_size)
+{
+    H5T_t       *st, *dt;               /* Datatype descriptors */
+    H5P_genplist_t *plist;              /* Property list pointer */
+    H5T_conv_cb_t cb_struct;            /* Conversion callback structure */
+    double      src_tmp[H5T_HALF_BLOCK];    /* Aligned source values */
+    double      dst_tmp[H5T_HALF_BLOCK];    /* Aligned destination values */
+    size_t      s_stride, d_stride;     /* Source and destination strides */
+    size_t      nconv;                  /* Number of elements converted so far */
+    hbool_t     reverse;                /* Whether to walk the buffer backwards */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT
+
+    switch(cdata->command) {
+        case H5T_CONV_INIT:
+            cdata->need_bkg = H5T_BKG_NO;
+            if(NULL == (st = (H5T_t *)H5I_object(src_id)) || NULL == (dt = (H5T_t *)H5I_object(dst_id)))
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to dereference datatype object ID")
+            if(st->shared->size != src_size || dt->shared->size != dst_size)
+                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "disagreement about datatype size")
+            cdata->priv = NULL;
+            break;
+
+        case H5T_CONV_FREE:
+            break;
+
+        case H5T_CONV_CONV:
+            /* Get the plist structure */
+            if(NULL == (plist = H5P_object_verify(dxpl_id, H5P_DATASET_XFER)))
+                HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find property list for ID")
+
+            /* Get conversion exception callback property */
+            if(H5P_get(plist, H5D_XFER_CONV_CB_NAME, &cb_struct) < 0)
+                HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get conversion exception callback")
+
+            s_stride = buf_stride ? buf_stride : src_size;
+            d_stride = buf_stride ? buf_stride : dst_size;
+            reverse = (hbool_t)(0 == buf_stride && dst_size > src_size);
+
+            for(nconv = 0; nconv < nelmts; /*void*/) {
+                size_t  nblk = MIN(H5T_HALF_BLOCK, nelmts - nconv);
+                size_t  first = reverse ? (nelmts - nconv) - nblk : nconv;
+                uint8_t *s = (uint8_t *)buf + first * s_stride;
+                uint8_t *d = (uint8_t *)buf + first * d_stride;
+                size_t  u;
+
+                /* Gather the source values */
+                if(s_stride == src_size)
+                    HDmemcpy(src_tmp, s, nblk * src_size);
+                else
+                    for(u = 0; u < nblk; u++)
+                        HDmemcpy((uint8_t *)src_tmp + u * src_size, s + u * s_stride, src_size);
+
+                H5T__half_convert(op, src_tmp, dst_tmp, nblk);
+
+#ifdef H5_WANT_DCONV_EXCEPTION
+                /* Report values which overflowed to infinity */
+                if(cb_struct.func && dst_size < src_size) {
+                    uint16_t inf = (uint16_t)((H5T_FLOAT_TO_HALF == op || H5T_DOUBLE_TO_HALF == op) ? 0x7c00 : 0x7f80);
+
+                    for(u = 0; u < nblk; u++) {
+                        double  val = (sizeof(float) == src_size) ? (double)((float *)src_tmp)[u] : src_tmp[u];
+
+                        if((((uint16_t *)dst_tmp)[u] & 0x7fff) == inf && val == val &&
+                                val <= DBL_MAX && val >= -DBL_MAX) {
+                            H5T_conv_ret_t except_ret;  /* Return of callback function */
+
+                            except_ret = (cb_struct.func)(val > 0 ? H5T_CONV_EXCEPT_RANGE_HI : H5T_CONV_EXCEPT_RANGE_LOW,
+                                    src_id, dst_id, (uint8_t *)src_tmp + u * src_size,
+                                    (uint8_t *)dst_tmp + u * dst_size, cb_struct.user_data);
+                            if(H5T_CONV_ABORT == except_ret)
+                                HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "can't handle conversion exception")
+                        } /* end if */
+                    } /* end for */
+                } /* end if */
+#endif /* H5_WANT_DCONV_EXCEPTION */
+
+                /* Scatter the destination values */
+                if(d_stride == dst_size)
+                    HDmemcpy(d, dst_tmp, nblk * dst_size);
+                else
+                    for(u = 0; u < nblk; u++)
+                        HDmemcpy(d + u * d_stride, (uint8_t *)dst_tmp + u * dst_size, dst_size);
+
+                nconv += nblk;
+            } /* end for */
+            break;
+
+        default:
+            HGOTO_ERROR(H5E_DATATYPE, H5E_UNSUPPORTED, FAIL, "unknown conversion command")
+    } /* end switch */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T_conv_half() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_half_float
+ *
+ * Purpose:	Convert IEEE half precision to native `float' using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_half_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5T_conv_half(src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id, H5T_HALF_TO_FLOAT, sizeof(uint16_t), sizeof(float)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_half_float() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_half_double
+ *
+ * Purpose:	Convert IEEE half precision to native `double' using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_half_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5T_conv_half(src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id, H5T_HALF_TO_DOUBLE, sizeof(uint16_t), sizeof(double)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_half_double() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_float_half
+ *
+ * Purpose:	Convert native `float' to IEEE half precision using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_float_half(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5T_conv_half(src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id, H5T_FLOAT_TO_HALF, sizeof(float), sizeof(uint16_t)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_float_half() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_double_half
+ *
+ * Purpose:	Convert native `double' to IEEE half precision using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_double_half(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5T_conv_half(src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id, H5T_DOUBLE_TO_HALF, sizeof(double), sizeof(uint16_t)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_double_half() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_bfloat_float
+ *
+ * Purpose:	Convert bfloat16 to native `float' using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_bfloat_float(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5T_conv_half(src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id, H5T_BFLOAT_TO_FLOAT, sizeof(uint16_t), sizeof(float)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_bfloat_float() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_bfloat_double
+ *
+ * Purpose:	Convert bfloat16 to native `double' using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_bfloat_double(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5T_conv_half(src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id, H5T_BFLOAT_TO_DOUBLE, sizeof(uint16_t), sizeof(double)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_bfloat_double() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_float_bfloat
+ *
+ * Purpose:	Convert native `float' to bfloat16 using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_float_bfloat(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5T_conv_half(src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id, H5T_FLOAT_TO_BFLOAT, sizeof(float), sizeof(uint16_t)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_float_bfloat() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__conv_double_bfloat
+ *
+ * Purpose:	Convert native `double' to bfloat16 using hardware.
+ *		This is a fast special case.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__conv_double_bfloat(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
+		       size_t nelmts, size_t buf_stride,
+                       size_t H5_ATTR_UNUSED bkg_stride, void *buf, void H5_ATTR_UNUSED *bkg,
+                       hid_t dxpl_id)
+{
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5T_conv_half(src_id, dst_id, cdata, nelmts, buf_stride, buf, dxpl_id, H5T_DOUBLE_TO_BFLOAT, sizeof(double), sizeof(uint16_t)) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_CANTCONVERT, FAIL, "datatype conversion failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5T__conv_double_bfloat() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T__conv_schar_float
@@ -200,6 +200,8 @@ H5T__enum_insert(const H5T_t *dt, const char *name, const void *value)
     HDassert(name && *name);
     HDassert(value);
 
+    H5T_RESET_HASH(dt);
+
     /* The name and value had better not already exist */
     for (i=0; i<dt->shared->u.enumer.nmembs; i++) {
 	if (!HDstrcmp(dt->shared->u.enumer.name[i], name))
@@ -137,6 +137,9 @@ H5Tset_sign(hid_t type_id, H5T_sign_t sign)
         HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not an integer datatype")
     if (H5T_STATE_TRANSIENT!=dt->shared->state)
         HGOTO_ERROR(H5E_ARGS, H5E_CANTINIT, FAIL, "datatype is read-only")
+
+    H5T_RESET_HASH(dt);
+
     if (sign < H5T_SGN_NONE || sign >= H5T_NSGN)
         HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "illegal sign type")
     if (H5T_ENUM==dt->shared->type && dt->shared->u.enumer.nmembs>0)
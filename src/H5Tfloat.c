@@ -116,6 +116,9 @@ H5Tset_fields(hid_t type_id, size_t spos, size_t epos, size_t esize,
 	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
     if(H5T_STATE_TRANSIENT != dt->shared->state)
 	HGOTO_ERROR(H5E_ARGS, H5E_CANTSET, FAIL, "datatype is read-only")
+
+    H5T_RESET_HASH(dt);
+
     while(dt->shared->parent)
         dt = dt->shared->parent; /*defer to parent*/
     if(H5T_FLOAT != dt->shared->type)
@@ -216,6 +219,9 @@ H5Tset_ebias(hid_t type_id, size_t ebias)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
     if(H5T_STATE_TRANSIENT != dt->shared->state)
 	HGOTO_ERROR(H5E_ARGS, H5E_CANTSET, FAIL, "datatype is read-only")
+
+    H5T_RESET_HASH(dt);
+
     while(dt->shared->parent)
         dt = dt->shared->parent; /*defer to parent*/
     if(H5T_FLOAT != dt->shared->type)
@@ -296,6 +302,9 @@ H5Tset_norm(hid_t type_id, H5T_norm_t norm)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
     if(H5T_STATE_TRANSIENT != dt->shared->state)
 	HGOTO_ERROR(H5E_ARGS, H5E_CANTSET, FAIL, "datatype is read-only")
+
+    H5T_RESET_HASH(dt);
+
     if(norm < H5T_NORM_IMPLIED || norm > H5T_NORM_NONE)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "illegal normalization")
     while(dt->shared->parent)
@@ -382,6 +391,9 @@ H5Tset_inpad(hid_t type_id, H5T_pad_t pad)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a datatype")
     if(H5T_STATE_TRANSIENT != dt->shared->state)
 	HGOTO_ERROR(H5E_ARGS, H5E_CANTSET, FAIL, "datatype is read-only")
+
+    H5T_RESET_HASH(dt);
+
     if(pad < H5T_PAD_ZERO || pad >= H5T_NPAD)
 	HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "illegal internal pad type")
     while(dt->shared->parent)
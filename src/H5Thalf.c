@@ -0,0 +1,714 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Module Info:	Conversion of packed arrays between the 16-bit floating
+ *		point formats (IEEE half precision and bfloat16) and the
+ *		native `float' and `double' types, used by the hardware
+ *		conversion functions for those formats.  Where the processor
+ *		allows it the arrays are converted with vector instructions
+ *		(F16C and AVX2 on x86, chosen at run time, and NEON on
+ *		AArch64); otherwise one element at a time with integer
+ *		arithmetic.  All conversions round to nearest, ties to even,
+ *		and preserve infinities, NaNs and subnormals.
+ */
+
+#include "H5Tmodule.h"          /* This source code file is part of the H5T module */
+
+
+#include "H5private.h"		/*generic functions			  */
+#include "H5Tpkg.h"		/*data-type functions			  */
+
+/* Check which vector kernels can be built */
+#if (defined(__x86_64__) || defined(__i386__)) && \
+        (defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ * 100) + __GNUC_MINOR__) >= 409))
+#define H5T_HALF_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define H5T_HALF_NEON
+#include <arm_neon.h>
+#endif
+
+/* Layout of the 16-bit formats: mantissa bits and maximum exponent (which
+ * is also the exponent bias) */
+#define H5T_HALF_MBITS          10
+#define H5T_HALF_EMAX           15
+#define H5T_BFLOAT_MBITS        7
+#define H5T_BFLOAT_EMAX         127
+
+/* Kernel converting NELMTS packed values from SRC to DST */
+typedef void (*H5T_half_func_t)(const void *src, void *dst, size_t nelmts);
+
+/* Local Prototypes */
+static double H5T_half_decode(uint16_t val, unsigned mbits, int emax);
+static uint16_t H5T_half_encode(double val, unsigned mbits, int emax);
+static void H5T_half_float(const void *_src, void *_dst, size_t nelmts);
+static void H5T_half_double(const void *_src, void *_dst, size_t nelmts);
+static void H5T_float_half(const void *_src, void *_dst, size_t nelmts);
+static void H5T_double_half(const void *_src, void *_dst, size_t nelmts);
+static void H5T_bfloat_float(const void *_src, void *_dst, size_t nelmts);
+static void H5T_bfloat_double(const void *_src, void *_dst, size_t nelmts);
+static void H5T_float_bfloat(const void *_src, void *_dst, size_t nelmts);
+static void H5T_double_bfloat(const void *_src, void *_dst, size_t nelmts);
+#ifdef H5T_HALF_X86
+static void H5T_half_float_f16c(const void *_src, void *_dst, size_t nelmts)
+    __attribute__((target("avx,f16c")));
+static void H5T_half_double_f16c(const void *_src, void *_dst, size_t nelmts)
+    __attribute__((target("avx,f16c")));
+static void H5T_float_half_f16c(const void *_src, void *_dst, size_t nelmts)
+    __attribute__((target("avx,f16c")));
+static void H5T_bfloat_float_avx2(const void *_src, void *_dst, size_t nelmts)
+    __attribute__((target("avx2")));
+static void H5T_bfloat_double_avx2(const void *_src, void *_dst, size_t nelmts)
+    __attribute__((target("avx2")));
+static void H5T_float_bfloat_avx2(const void *_src, void *_dst, size_t nelmts)
+    __attribute__((target("avx2")));
+#endif /* H5T_HALF_X86 */
+#ifdef H5T_HALF_NEON
+static void H5T_half_float_neon(const void *_src, void *_dst, size_t nelmts);
+static void H5T_float_half_neon(const void *_src, void *_dst, size_t nelmts);
+static void H5T_bfloat_float_neon(const void *_src, void *_dst, size_t nelmts);
+#endif /* H5T_HALF_NEON */
+
+/* Kernel for each conversion, indexed by H5T_half_op_t */
+static H5T_half_func_t H5T_half_func_g[H5T_HALF_NOPS] = {
+#ifdef H5T_HALF_NEON
+    H5T_half_float_neon,        /* H5T_HALF_TO_FLOAT */
+#else
+    H5T_half_float,             /* H5T_HALF_TO_FLOAT */
+#endif
+    H5T_half_double,            /* H5T_HALF_TO_DOUBLE */
+#ifdef H5T_HALF_NEON
+    H5T_float_half_neon,        /* H5T_FLOAT_TO_HALF */
+#else
+    H5T_float_half,             /* H5T_FLOAT_TO_HALF */
+#endif
+    H5T_double_half,            /* H5T_DOUBLE_TO_HALF */
+#ifdef H5T_HALF_NEON
+    H5T_bfloat_float_neon,      /* H5T_BFLOAT_TO_FLOAT */
+#else
+    H5T_bfloat_float,           /* H5T_BFLOAT_TO_FLOAT */
+#endif
+    H5T_bfloat_double,          /* H5T_BFLOAT_TO_DOUBLE */
+    H5T_float_bfloat,           /* H5T_FLOAT_TO_BFLOAT */
+    H5T_double_bfloat           /* H5T_DOUBLE_TO_BFLOAT */
+};
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__half_init
+ *
+ * Purpose:	Chooses the vector kernels for the 16-bit floating-point
+ *		conversions that suit the processor the library is running
+ *		on.  Conversions from `double' always use the scalar code,
+ *		since going through `float' could round twice.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T__half_init(void)
+{
+#ifdef H5T_HALF_X86
+    unsigned    eax, ebx, ecx, edx;     /* CPUID registers */
+#endif /* H5T_HALF_X86 */
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+#ifdef H5T_HALF_X86
+    __builtin_cpu_init();
+
+    /* F16C uses the AVX registers, so also needs the OS support that the
+     * "avx" check includes */
+    if(__builtin_cpu_supports("avx") && __get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+            (ecx & bit_F16C)) {
+        H5T_half_func_g[H5T_HALF_TO_FLOAT] = H5T_half_float_f16c;
+        H5T_half_func_g[H5T_HALF_TO_DOUBLE] = H5T_half_double_f16c;
+        H5T_half_func_g[H5T_FLOAT_TO_HALF] = H5T_float_half_f16c;
+    } /* end if */
+    else {
+        H5T_half_func_g[H5T_HALF_TO_FLOAT] = H5T_half_float;
+        H5T_half_func_g[H5T_HALF_TO_DOUBLE] = H5T_half_double;
+        H5T_half_func_g[H5T_FLOAT_TO_HALF] = H5T_float_half;
+    } /* end else */
+
+    if(__builtin_cpu_supports("avx2")) {
+        H5T_half_func_g[H5T_BFLOAT_TO_FLOAT] = H5T_bfloat_float_avx2;
+        H5T_half_func_g[H5T_BFLOAT_TO_DOUBLE] = H5T_bfloat_double_avx2;
+        H5T_half_func_g[H5T_FLOAT_TO_BFLOAT] = H5T_float_bfloat_avx2;
+    } /* end if */
+    else {
+        H5T_half_func_g[H5T_BFLOAT_TO_FLOAT] = H5T_bfloat_float;
+        H5T_half_func_g[H5T_BFLOAT_TO_DOUBLE] = H5T_bfloat_double;
+        H5T_half_func_g[H5T_FLOAT_TO_BFLOAT] = H5T_float_bfloat;
+    } /* end else */
+#endif /* H5T_HALF_X86 */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__half_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__half_convert
+ *
+ * Purpose:	Performs conversion OP on the NELMTS packed values in SRC,
+ *		storing the results packed in DST.  Both buffers must be
+ *		aligned for their types and must not overlap.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T__half_convert(H5T_half_op_t op, const void *src, void *dst, size_t nelmts)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(op < H5T_HALF_NOPS);
+    HDassert((src && dst) || 0 == nelmts);
+
+    (*H5T_half_func_g[op])(src, dst, nelmts);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__half_convert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_half_decode
+ *
+ * Purpose:	Decodes a 16-bit float with MBITS mantissa bits and an
+ *		exponent bias of EMAX.  Every such value is exactly
+ *		representable as a `double'.
+ *
+ * Return:	The value of VAL
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+H5T_half_decode(uint16_t val, unsigned mbits, int emax)
+{
+    unsigned    emask = (unsigned)(2 * emax + 1);       /* All-ones exponent */
+    unsigned    e = ((unsigned)val >> mbits) & emask;   /* Biased exponent */
+    uint64_t    m = (uint64_t)val & (((uint64_t)1 << mbits) - 1);  /* Mantissa */
+    uint64_t    bits = (uint64_t)(val & 0x8000) << 48;  /* Bits of the result */
+    double      ret_value;
+
+    if(e == emask)
+        /* Infinity or NaN, keeping the NaN's payload */
+        bits |= ((uint64_t)0x7ff << 52) | (m << (52 - mbits));
+    else if(e > 0)
+        bits |= ((uint64_t)((int)e - emax + 1023) << 52) | (m << (52 - mbits));
+    else if(m > 0) {
+        uint64_t    sbits = (uint64_t)(1 - emax - (int)mbits + 1023) << 52;
+        double      scale;
+
+        /* Subnormal: a multiple of the smallest subnormal, 2^(1-EMAX-MBITS) */
+        HDmemcpy(&scale, &sbits, sizeof(scale));
+        ret_value = (double)m * scale;
+        return((val & 0x8000) ? -ret_value : ret_value);
+    } /* end if */
+
+    HDmemcpy(&ret_value, &bits, sizeof(ret_value));
+    return(ret_value);
+} /* end H5T_half_decode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_half_encode
+ *
+ * Purpose:	Rounds VAL to a 16-bit float with MBITS mantissa bits and
+ *		an exponent bias of EMAX, to nearest with ties to even.
+ *		Values too large for the format become infinity and NaNs
+ *		stay quiet NaNs, keeping the top bits of their payload.
+ *
+ * Return:	The encoded value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint16_t
+H5T_half_encode(double val, unsigned mbits, int emax)
+{
+    uint16_t    inf = (uint16_t)((unsigned)(2 * emax + 1) << mbits);   /* Infinity */
+    uint64_t    bits;                   /* Bits of VAL */
+    uint64_t    m;                      /* Mantissa of VAL */
+    uint64_t    rem, half;              /* Rounding remainder and tie */
+    uint16_t    sign;                   /* Sign bit of result */
+    unsigned    shift;                  /* Mantissa bits dropped */
+    int         e;                      /* Exponent of VAL */
+    uint16_t    ret_value;
+
+    HDmemcpy(&bits, &val, sizeof(bits));
+    sign = (uint16_t)((bits >> 48) & 0x8000);
+    e = (int)((bits >> 52) & 0x7ff);
+    m = bits & (((uint64_t)1 << 52) - 1);
+
+    /* Infinity or NaN */
+    if(0x7ff == e) {
+        if(0 == m)
+            return((uint16_t)(sign | inf));
+        return((uint16_t)(sign | inf | (1 << (mbits - 1)) | (uint16_t)(m >> (52 - mbits))));
+    } /* end if */
+
+    e -= 1023;
+    if(e > emax)
+        return((uint16_t)(sign | inf));
+    if(e >= 1 - emax) {
+        shift = 52 - mbits;
+        ret_value = (uint16_t)(((unsigned)(e + emax) << mbits) | (unsigned)(m >> shift));
+    } /* end if */
+    else {
+        /* Subnormal result, or too small for one */
+        shift = 52 - mbits + (unsigned)(1 - emax - e);
+        if(shift > 53)
+            return(sign);
+        m |= (uint64_t)1 << 52;
+        ret_value = (uint16_t)(m >> shift);
+    } /* end else */
+
+    /* Round to nearest, ties to even.  A carry out of the mantissa moves the
+     * value to the next binade, or to infinity, as it should. */
+    rem = m & (((uint64_t)1 << shift) - 1);
+    half = (uint64_t)1 << (shift - 1);
+    if(rem > half || (rem == half && (ret_value & 1)))
+        ret_value++;
+
+    return((uint16_t)(sign | ret_value));
+} /* end H5T_half_encode() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_half_float
+ *
+ * Purpose:	Converts IEEE half precision values to `float'.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_half_float(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    float       *dst = (float *)_dst;
+    size_t      u;
+
+    for(u = 0; u < nelmts; u++)
+        dst[u] = (float)H5T_half_decode(src[u], H5T_HALF_MBITS, H5T_HALF_EMAX);
+} /* end H5T_half_float() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_half_double
+ *
+ * Purpose:	Converts IEEE half precision values to `double'.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_half_double(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    double      *dst = (double *)_dst;
+    size_t      u;
+
+    for(u = 0; u < nelmts; u++)
+        dst[u] = H5T_half_decode(src[u], H5T_HALF_MBITS, H5T_HALF_EMAX);
+} /* end H5T_half_double() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_float_half
+ *
+ * Purpose:	Converts `float' values to IEEE half precision.  Widening
+ *		to `double' first is exact, so rounds only once.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_float_half(const void *_src, void *_dst, size_t nelmts)
+{
+    const float *src = (const float *)_src;
+    uint16_t    *dst = (uint16_t *)_dst;
+    size_t      u;
+
+    for(u = 0; u < nelmts; u++)
+        dst[u] = H5T_half_encode((double)src[u], H5T_HALF_MBITS, H5T_HALF_EMAX);
+} /* end H5T_float_half() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_double_half
+ *
+ * Purpose:	Converts `double' values to IEEE half precision.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_double_half(const void *_src, void *_dst, size_t nelmts)
+{
+    const double *src = (const double *)_src;
+    uint16_t    *dst = (uint16_t *)_dst;
+    size_t      u;
+
+    for(u = 0; u < nelmts; u++)
+        dst[u] = H5T_half_encode(src[u], H5T_HALF_MBITS, H5T_HALF_EMAX);
+} /* end H5T_double_half() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_bfloat_float
+ *
+ * Purpose:	Converts bfloat16 values to `float'.  A bfloat16 is the top
+ *		half of a `float', so this is a shift.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_bfloat_float(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    float       *dst = (float *)_dst;
+    size_t      u;
+
+    for(u = 0; u < nelmts; u++) {
+        uint32_t    bits = (uint32_t)src[u] << 16;
+
+        HDmemcpy(&dst[u], &bits, sizeof(bits));
+    } /* end for */
+} /* end H5T_bfloat_float() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_bfloat_double
+ *
+ * Purpose:	Converts bfloat16 values to `double'.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_bfloat_double(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    double      *dst = (double *)_dst;
+    size_t      u;
+
+    for(u = 0; u < nelmts; u++)
+        dst[u] = H5T_half_decode(src[u], H5T_BFLOAT_MBITS, H5T_BFLOAT_EMAX);
+} /* end H5T_bfloat_double() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_float_bfloat
+ *
+ * Purpose:	Converts `float' values to bfloat16 by rounding away the
+ *		low sixteen bits.  Adding 0x7fff plus the lowest kept bit
+ *		rounds to nearest with ties to even; NaNs are kept quiet
+ *		instead, since rounding could turn them into infinity.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_float_bfloat(const void *_src, void *_dst, size_t nelmts)
+{
+    const float *src = (const float *)_src;
+    uint16_t    *dst = (uint16_t *)_dst;
+    size_t      u;
+
+    for(u = 0; u < nelmts; u++) {
+        uint32_t    bits;
+
+        HDmemcpy(&bits, &src[u], sizeof(bits));
+        if((bits & 0x7fffffff) > 0x7f800000)
+            dst[u] = (uint16_t)((bits >> 16) | 0x40);
+        else
+            dst[u] = (uint16_t)((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+    } /* end for */
+} /* end H5T_float_bfloat() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_double_bfloat
+ *
+ * Purpose:	Converts `double' values to bfloat16.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_double_bfloat(const void *_src, void *_dst, size_t nelmts)
+{
+    const double *src = (const double *)_src;
+    uint16_t    *dst = (uint16_t *)_dst;
+    size_t      u;
+
+    for(u = 0; u < nelmts; u++)
+        dst[u] = H5T_half_encode(src[u], H5T_BFLOAT_MBITS, H5T_BFLOAT_EMAX);
+} /* end H5T_double_bfloat() */
+
+#ifdef H5T_HALF_X86
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_half_float_f16c
+ *
+ * Purpose:	Converts IEEE half precision values to `float' eight at a
+ *		time with VCVTPH2PS.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_half_float_f16c(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    float       *dst = (float *)_dst;
+    size_t      u = 0;
+
+    for(/*void*/; u + 8 <= nelmts; u += 8)
+        _mm256_storeu_ps(dst + u, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + u))));
+
+    H5T_half_float(src + u, dst + u, nelmts - u);
+} /* end H5T_half_float_f16c() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_half_double_f16c
+ *
+ * Purpose:	Converts IEEE half precision values to `double' four at a
+ *		time, widening to `float' with VCVTPH2PS first.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_half_double_f16c(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    double      *dst = (double *)_dst;
+    size_t      u = 0;
+
+    for(/*void*/; u + 4 <= nelmts; u += 4)
+        _mm256_storeu_pd(dst + u, _mm256_cvtps_pd(_mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)(src + u)))));
+
+    H5T_half_double(src + u, dst + u, nelmts - u);
+} /* end H5T_half_double_f16c() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_float_half_f16c
+ *
+ * Purpose:	Converts `float' values to IEEE half precision eight at a
+ *		time with VCVTPS2PH.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_float_half_f16c(const void *_src, void *_dst, size_t nelmts)
+{
+    const float *src = (const float *)_src;
+    uint16_t    *dst = (uint16_t *)_dst;
+    size_t      u = 0;
+
+    for(/*void*/; u + 8 <= nelmts; u += 8)
+        _mm_storeu_si128((__m128i *)(dst + u), _mm256_cvtps_ph(_mm256_loadu_ps(src + u), _MM_FROUND_TO_NEAREST_INT));
+
+    H5T_float_half(src + u, dst + u, nelmts - u);
+} /* end H5T_float_half_f16c() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_bfloat_float_avx2
+ *
+ * Purpose:	Converts bfloat16 values to `float' eight at a time.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_bfloat_float_avx2(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    float       *dst = (float *)_dst;
+    size_t      u = 0;
+
+    for(/*void*/; u + 8 <= nelmts; u += 8) {
+        __m256i v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src + u)));
+
+        _mm256_storeu_si256((__m256i *)(dst + u), _mm256_slli_epi32(v, 16));
+    } /* end for */
+
+    H5T_bfloat_float(src + u, dst + u, nelmts - u);
+} /* end H5T_bfloat_float_avx2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_bfloat_double_avx2
+ *
+ * Purpose:	Converts bfloat16 values to `double' four at a time.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_bfloat_double_avx2(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    double      *dst = (double *)_dst;
+    size_t      u = 0;
+
+    for(/*void*/; u + 4 <= nelmts; u += 4) {
+        __m128i v = _mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i *)(src + u)));
+
+        _mm256_storeu_pd(dst + u, _mm256_cvtps_pd(_mm_castsi128_ps(_mm_slli_epi32(v, 16))));
+    } /* end for */
+
+    H5T_bfloat_double(src + u, dst + u, nelmts - u);
+} /* end H5T_bfloat_double_avx2() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_float_bfloat_avx2
+ *
+ * Purpose:	Converts `float' values to bfloat16 eight at a time, with
+ *		the same rounding as H5T_float_bfloat().  The 32-bit results
+ *		are packed within each lane and the two lanes' halves then
+ *		gathered into the low lane.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_float_bfloat_avx2(const void *_src, void *_dst, size_t nelmts)
+{
+    const float *src = (const float *)_src;
+    uint16_t    *dst = (uint16_t *)_dst;
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i bias = _mm256_set1_epi32(0x7fff);
+    const __m256i quiet = _mm256_set1_epi32(0x40);
+    size_t      u = 0;
+
+    for(/*void*/; u + 8 <= nelmts; u += 8) {
+        __m256  f = _mm256_loadu_ps(src + u);
+        __m256i bits = _mm256_castps_si256(f);
+        __m256i hi = _mm256_srli_epi32(bits, 16);
+        __m256i r = _mm256_add_epi32(_mm256_add_epi32(bits, bias), _mm256_and_si256(hi, one));
+        __m256i nan = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+
+        r = _mm256_blendv_epi8(_mm256_srli_epi32(r, 16), _mm256_or_si256(hi, quiet), nan);
+        r = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08);
+        _mm_storeu_si128((__m128i *)(dst + u), _mm256_castsi256_si128(r));
+    } /* end for */
+
+    H5T_float_bfloat(src + u, dst + u, nelmts - u);
+} /* end H5T_float_bfloat_avx2() */
+#endif /* H5T_HALF_X86 */
+
+#ifdef H5T_HALF_NEON
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_half_float_neon
+ *
+ * Purpose:	Converts IEEE half precision values to `float' four at a
+ *		time with FCVTL.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_half_float_neon(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    float       *dst = (float *)_dst;
+    size_t      u = 0;
+
+    for(/*void*/; u + 4 <= nelmts; u += 4)
+        vst1q_f32(dst + u, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + u))));
+
+    H5T_half_float(src + u, dst + u, nelmts - u);
+} /* end H5T_half_float_neon() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_float_half_neon
+ *
+ * Purpose:	Converts `float' values to IEEE half precision four at a
+ *		time with FCVTN, which rounds to nearest even in the
+ *		default floating-point mode.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_float_half_neon(const void *_src, void *_dst, size_t nelmts)
+{
+    const float *src = (const float *)_src;
+    uint16_t    *dst = (uint16_t *)_dst;
+    size_t      u = 0;
+
+    for(/*void*/; u + 4 <= nelmts; u += 4)
+        vst1_u16(dst + u, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + u))));
+
+    H5T_float_half(src + u, dst + u, nelmts - u);
+} /* end H5T_float_half_neon() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_bfloat_float_neon
+ *
+ * Purpose:	Converts bfloat16 values to `float' four at a time with a
+ *		widening shift.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_bfloat_float_neon(const void *_src, void *_dst, size_t nelmts)
+{
+    const uint16_t *src = (const uint16_t *)_src;
+    float       *dst = (float *)_dst;
+    size_t      u = 0;
+
+    for(/*void*/; u + 4 <= nelmts; u += 4)
+        vst1q_f32(dst + u, vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(src + u), 16)));
+
+    H5T_bfloat_float(src + u, dst + u, nelmts - u);
+} /* end H5T_bfloat_float_neon() */
+#endif /* H5T_HALF_NEON */
@@ -255,6 +255,8 @@ H5T_set_offset(const H5T_t *dt, size_t offset)
     HDassert(H5T_COMPOUND!=dt->shared->type);
     HDassert(!(H5T_ENUM==dt->shared->type && 0==dt->shared->u.enumer.nmembs));
 
+    H5T_RESET_HASH(dt);
+
     if (dt->shared->parent) {
 	if (H5T_set_offset(dt->shared->parent, offset)<0)
 	    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "unable to set offset for base type")
@@ -246,6 +246,8 @@ H5T_set_order(H5T_t *dtype, H5T_order_t order)
     if(H5T_ENUM == dtype->shared->type && dtype->shared->u.enumer.nmembs > 0)
 	HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "operation not allowed after enum members are defined")
 
+    H5T_RESET_HASH(dtype);
+
     /* For derived data type, defer to parent */ 
     while(dtype->shared->parent)
         dtype = dtype->shared->parent;
@@ -64,6 +64,9 @@
 /* Macro to ease detecting atomic datatypes */
 #define H5T_IS_ATOMIC(dt)       (!(H5T_IS_COMPLEX((dt)->type) || (dt)->type == H5T_OPAQUE))
 
+/* Macro to discard the cached structural hash of a datatype being modified */
+#define H5T_RESET_HASH(dt)      ((dt)->shared->hash = 0)
+
 /* Macro to ease retrieving class of shared datatype */
 /* (Externally, a VL string is a string; internally, a VL string is a VL.  Lie
  *      to the user if they have a VL string and tell them it's in the string
@@ -158,8 +161,11 @@ struct H5T_path_t {
     H5T_t	*dst;			/*destination datatype		     */
     H5T_conv_t	func;			/*data conversion function	     */
     hbool_t	is_hard;		/*is it a hard function?	     */
+    hbool_t	is_api;			/*was the function set by the app?   */
     hbool_t	is_noop;		/*is it the noop conversion?	     */
     hbool_t	are_compounds;		/*are source and dest both compounds?*/
+    uint32_t	src_hash;		/*structural hash of source type     */
+    uint32_t	dst_hash;		/*structural hash of dest type	     */
     H5T_stats_t	stats;			/*statistics for the conversion	     */
     H5T_cdata_t	cdata;			/*data for this function	     */
 };
@@ -292,6 +298,7 @@ typedef struct H5T_shared_t {
     size_t		size;	/*total size of an instance of this type     */
     unsigned            version;        /* Version of object header message to encode this object with */
     hbool_t		force_conv;/* Set if this type always needs to be converted and H5T__conv_noop cannot be called */
+    uint32_t		hash;	/*cached structural hash, 0 if unknown	     */
     struct H5T_t	*parent;/*parent type for derived datatypes	     */
     union {
         H5T_atomic_t	atomic; /* an atomic datatype              */
@@ -325,6 +332,19 @@ typedef enum H5T_sdir_t {
     H5T_BIT_MSB				/*search msb toward lsb		     */
 } H5T_sdir_t;
 
+/* 16-bit floating-point conversions performed by H5T__half_convert() */
+typedef enum H5T_half_op_t {
+    H5T_HALF_TO_FLOAT = 0,		/*IEEE half to native float	     */
+    H5T_HALF_TO_DOUBLE,			/*IEEE half to native double	     */
+    H5T_FLOAT_TO_HALF,			/*native float to IEEE half	     */
+    H5T_DOUBLE_TO_HALF,			/*native double to IEEE half	     */
+    H5T_BFLOAT_TO_FLOAT,		/*bfloat16 to native float	     */
+    H5T_BFLOAT_TO_DOUBLE,		/*bfloat16 to native double	     */
+    H5T_FLOAT_TO_BFLOAT,		/*native float to bfloat16	     */
+    H5T_DOUBLE_TO_BFLOAT,		/*native double to bfloat16	     */
+    H5T_HALF_NOPS			/*number of operations (must be last)*/
+} H5T_half_op_t;
+
 /* Typedef for named datatype creation operation */
 typedef struct {
     H5T_t *dt;                  /* Datatype to commit */
@@ -419,6 +439,9 @@ H5_DLLVAR double H5T_NATIVE_LDOUBLE_POS_INF_g;
 H5_DLLVAR double H5T_NATIVE_LDOUBLE_NEG_INF_g;
 #endif
 
+/* Number of conversion path lookups answered by the hash index (for testing) */
+H5_DLLVAR size_t H5T_path_hash_hits_g;
+
 /* Declare extern the free lists for H5T_t's and H5T_shared_t's */
 H5FL_EXTERN(H5T_t);
 H5FL_EXTERN(H5T_shared_t);
@@ -426,6 +449,7 @@ H5FL_EXTERN(H5T_shared_t);
 /* Common functions */
 H5_DLL herr_t H5T__init_native(void);
 H5_DLL H5T_t *H5T__create(H5T_class_t type, size_t size);
+H5_DLL uint32_t H5T__hash(const H5T_t *dt);
 H5_DLL herr_t H5T__commit(H5F_t *file, H5T_t *type, hid_t tcpl_id, hid_t dxpl_id);
 H5_DLL herr_t H5T__commit_named(const H5G_loc_t *loc, const char *name,
     H5T_t *dt, hid_t lcpl_id, hid_t tcpl_id, hid_t tapl_id, hid_t dxpl_id);
@@ -434,6 +458,7 @@ H5_DLL herr_t H5T__free(H5T_t *dt);
 H5_DLL herr_t H5T__visit(H5T_t *dt, unsigned visit_flags, H5T_operator_t op,
     void *op_value);
 H5_DLL herr_t H5T__upgrade_version(H5T_t *dt, unsigned new_version);
+H5_DLL hbool_t H5T__conv_mt_prepare(H5T_path_t *tpath, H5T_t *src, H5T_t *dst);
 
 /* Conversion functions */
 H5_DLL herr_t H5T__conv_noop(hid_t src_id, hid_t dst_id, H5T_cdata_t *cdata,
@@ -976,6 +1001,46 @@ H5_DLL herr_t H5T__conv_ldouble_double(hid_t src_id, hid_t dst_id,
 				     size_t buf_stride, size_t bkg_stride,
                                      void *buf, void *bkg,
                                      hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_half_float(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_half_double(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_float_half(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_double_half(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_bfloat_float(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_bfloat_double(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_float_bfloat(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
+H5_DLL herr_t H5T__conv_double_bfloat(hid_t src_id, hid_t dst_id,
+				     H5T_cdata_t *cdata, size_t nelmts,
+				     size_t buf_stride, size_t bkg_stride,
+                                     void *buf, void *bkg,
+                                     hid_t dset_xfer_plist);
 H5_DLL herr_t H5T__conv_schar_float(hid_t src_id, hid_t dst_id,
 				     H5T_cdata_t *cdata, size_t nelmts,
 				     size_t buf_stride, size_t bkg_stride,
@@ -1292,9 +1357,23 @@ H5_DLL hbool_t H5T__bit_inc(uint8_t *buf, size_t start, size_t size);
 H5_DLL hbool_t H5T__bit_dec(uint8_t *buf, size_t start, size_t size);
 H5_DLL void H5T__bit_neg(uint8_t *buf, size_t start, size_t size);
 
+/* Byte swapping functions */
+H5_DLL void H5T__swap_init(void);
+H5_DLL void H5T__swap_bytes(uint8_t *buf, size_t size, size_t nelmts,
+    size_t stride);
+
+/* 16-bit floating-point functions */
+H5_DLL void H5T__half_init(void);
+H5_DLL void H5T__half_convert(H5T_half_op_t op, const void *src, void *dst,
+    size_t nelmts);
+
 /* VL functions */
 H5_DLL H5T_t * H5T__vlen_create(const H5T_t *base);
 H5_DLL htri_t H5T__vlen_set_loc(const H5T_t *dt, H5F_t *f, H5T_loc_t loc);
+H5_DLL herr_t H5T__vlen_disk_read_multi(H5F_t *f, hid_t dxpl_id, size_t nseq,
+    void *vl[], void *buf[]);
+H5_DLL herr_t H5T__vlen_disk_write_multi(H5F_t *f, hid_t dxpl_id, size_t nseq,
+    void *vl[], void *bg[], void *buf[], const size_t seq_len[], size_t base_size);
 
 /* Array functions */
 H5_DLL H5T_t *H5T__array_create(H5T_t *base, unsigned ndims, const hsize_t dim[/* ndims */]);
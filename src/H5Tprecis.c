@@ -219,6 +219,8 @@ H5T_set_precision(const H5T_t *dt, size_t prec)
     HDassert(H5T_STRING!=dt->shared->type);
     HDassert(!(H5T_ENUM==dt->shared->type && 0==dt->shared->u.enumer.nmembs));
 
+    H5T_RESET_HASH(dt);
+
     if (dt->shared->parent) {
 	if (H5T_set_precision(dt->shared->parent, prec)<0)
 	    HGOTO_ERROR(H5E_DATATYPE, H5E_CANTSET, FAIL, "unable to set precision for base type")
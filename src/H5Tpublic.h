@@ -236,6 +236,20 @@ H5_DLLVAR hid_t H5T_IEEE_F32LE_g;
 H5_DLLVAR hid_t H5T_IEEE_F64BE_g;
 H5_DLLVAR hid_t H5T_IEEE_F64LE_g;
 
+/*
+ * The IEEE half precision (16-bit) floating point types, and the "brain
+ * floating point" bfloat16 types (the upper half of an IEEE single precision
+ * float), in various byte orders.
+ */
+#define H5T_IEEE_F16BE		(H5OPEN H5T_IEEE_F16BE_g)
+#define H5T_IEEE_F16LE		(H5OPEN H5T_IEEE_F16LE_g)
+#define H5T_FLOAT_BF16BE	(H5OPEN H5T_FLOAT_BF16BE_g)
+#define H5T_FLOAT_BF16LE	(H5OPEN H5T_FLOAT_BF16LE_g)
+H5_DLLVAR hid_t H5T_IEEE_F16BE_g;
+H5_DLLVAR hid_t H5T_IEEE_F16LE_g;
+H5_DLLVAR hid_t H5T_FLOAT_BF16BE_g;
+H5_DLLVAR hid_t H5T_FLOAT_BF16LE_g;
+
 /*
  * These are "standard" types.  For instance, signed (2's complement) and
  * unsigned integers of various sizes and byte orders.
@@ -418,6 +432,8 @@ H5_DLLVAR hid_t H5T_VAX_F64_g;
 #define H5T_NATIVE_HSSIZE	(H5OPEN H5T_NATIVE_HSSIZE_g)
 #define H5T_NATIVE_HERR		(H5OPEN H5T_NATIVE_HERR_g)
 #define H5T_NATIVE_HBOOL	(H5OPEN H5T_NATIVE_HBOOL_g)
+#define H5T_NATIVE_FLOAT16	(H5OPEN H5T_NATIVE_FLOAT16_g)
+#define H5T_NATIVE_BFLOAT16	(H5OPEN H5T_NATIVE_BFLOAT16_g)
 H5_DLLVAR hid_t H5T_NATIVE_SCHAR_g;
 H5_DLLVAR hid_t H5T_NATIVE_UCHAR_g;
 H5_DLLVAR hid_t H5T_NATIVE_SHORT_g;
@@ -443,6 +459,8 @@ H5_DLLVAR hid_t H5T_NATIVE_HSIZE_g;
 H5_DLLVAR hid_t H5T_NATIVE_HSSIZE_g;
 H5_DLLVAR hid_t H5T_NATIVE_HERR_g;
 H5_DLLVAR hid_t H5T_NATIVE_HBOOL_g;
+H5_DLLVAR hid_t H5T_NATIVE_FLOAT16_g;
+H5_DLLVAR hid_t H5T_NATIVE_BFLOAT16_g;
 
 /* C9x integer types */
 #define H5T_NATIVE_INT8			(H5OPEN H5T_NATIVE_INT8_g)
@@ -0,0 +1,381 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * Copyright by the Board of Trustees of the University of Illinois.         *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Module Info:	Byte order reversal of arrays of fixed-size elements, used
+ *		by the byte order conversion functions.  Packed arrays of
+ *		2, 4, 8 and 16 byte elements are swapped with vector
+ *		shuffles where the processor supports them (SSSE3 or AVX2 on
+ *		x86, chosen at run time, and NEON on ARM); everything else
+ *		is swapped one element at a time.
+ */
+
+#include "H5Tmodule.h"          /* This source code file is part of the H5T module */
+
+
+#include "H5private.h"		/*generic functions			  */
+#include "H5Tpkg.h"		/*data-type functions			  */
+
+/* Check which vector kernels can be built */
+#if (defined(__x86_64__) || defined(__i386__)) && \
+        (defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ * 100) + __GNUC_MINOR__) >= 409))
+#define H5T_SWAP_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define H5T_SWAP_NEON
+#include <arm_neon.h>
+#endif
+
+/* Byte-reverse integers, with the compiler's builtins when available */
+#if defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ * 100) + __GNUC_MINOR__) >= 408)
+#define H5T_BSWAP16(X)  __builtin_bswap16(X)
+#define H5T_BSWAP32(X)  __builtin_bswap32(X)
+#define H5T_BSWAP64(X)  __builtin_bswap64(X)
+#else
+#define H5T_BSWAP16(X)  ((uint16_t)(((uint16_t)(X) >> 8) | ((uint16_t)(X) << 8)))
+#define H5T_BSWAP32(X)  ((((uint32_t)(X) & 0xff000000U) >> 24) |           \
+                         (((uint32_t)(X) & 0x00ff0000U) >> 8) |            \
+                         (((uint32_t)(X) & 0x0000ff00U) << 8) |            \
+                         (((uint32_t)(X) & 0x000000ffU) << 24))
+#define H5T_BSWAP64(X)  (((uint64_t)H5T_BSWAP32((uint32_t)(X)) << 32) |    \
+                         (uint64_t)H5T_BSWAP32((uint32_t)((uint64_t)(X) >> 32)))
+#endif
+
+/* Kernel swapping NELMTS packed elements of SIZE bytes in BUF */
+typedef void (*H5T_swap_packed_func_t)(uint8_t *buf, size_t size, size_t nelmts);
+
+/* Local Prototypes */
+static void H5T_swap_scalar(uint8_t *buf, size_t size, size_t nelmts, size_t stride);
+#ifdef H5T_SWAP_X86
+static const uint8_t *H5T_swap_mask(size_t size);
+static void H5T_swap_ssse3(uint8_t *buf, size_t size, size_t nelmts)
+    __attribute__((target("ssse3")));
+static void H5T_swap_avx2(uint8_t *buf, size_t size, size_t nelmts)
+    __attribute__((target("avx2")));
+#endif /* H5T_SWAP_X86 */
+#ifdef H5T_SWAP_NEON
+static void H5T_swap_neon(uint8_t *buf, size_t size, size_t nelmts);
+#endif /* H5T_SWAP_NEON */
+
+/* Vector kernel for packed arrays, NULL if there is none */
+#ifdef H5T_SWAP_NEON
+static H5T_swap_packed_func_t H5T_swap_packed_g = H5T_swap_neon;
+#else
+static H5T_swap_packed_func_t H5T_swap_packed_g = NULL;
+#endif
+
+#ifdef H5T_SWAP_X86
+/* Shuffle masks reversing each 2, 4, 8 and 16 byte element of a vector */
+static const uint8_t H5T_swap_mask_g[4][16] = {
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+    {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8},
+    {15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}
+};
+#endif /* H5T_SWAP_X86 */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__swap_init
+ *
+ * Purpose:	Chooses the vector kernel for swapping packed arrays that
+ *		best suits the processor the library is running on.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T__swap_init(void)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+#ifdef H5T_SWAP_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        H5T_swap_packed_g = H5T_swap_avx2;
+    else if(__builtin_cpu_supports("ssse3"))
+        H5T_swap_packed_g = H5T_swap_ssse3;
+    else
+        H5T_swap_packed_g = NULL;
+#endif /* H5T_SWAP_X86 */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__swap_init() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__swap_bytes
+ *
+ * Purpose:	Reverses the byte order of each of the NELMTS elements of
+ *		SIZE bytes in BUF, which are STRIDE bytes apart.  BUF need
+ *		not be aligned.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5T__swap_bytes(uint8_t *buf, size_t size, size_t nelmts, size_t stride)
+{
+    FUNC_ENTER_PACKAGE_NOERR
+
+    HDassert(buf || 0 == nelmts);
+    HDassert(stride >= size);
+
+    if(H5T_swap_packed_g && stride == size &&
+            (2 == size || 4 == size || 8 == size || 16 == size))
+        (*H5T_swap_packed_g)(buf, size, nelmts);
+    else
+        H5T_swap_scalar(buf, size, nelmts, stride);
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5T__swap_bytes() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_swap_scalar
+ *
+ * Purpose:	Reverses the byte order of strided elements one at a time.
+ *		Elements are moved through integer temporaries, so BUF need
+ *		not be aligned.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_swap_scalar(uint8_t *buf, size_t size, size_t nelmts, size_t stride)
+{
+    size_t      u, v;           /* Local index variables */
+
+    switch(size) {
+        case 1:
+            /*no-op*/
+            break;
+
+        case 2:
+            for(u = 0; u < nelmts; u++, buf += stride) {
+                uint16_t val;
+
+                HDmemcpy(&val, buf, sizeof(val));
+                val = H5T_BSWAP16(val);
+                HDmemcpy(buf, &val, sizeof(val));
+            } /* end for */
+            break;
+
+        case 4:
+            for(u = 0; u < nelmts; u++, buf += stride) {
+                uint32_t val;
+
+                HDmemcpy(&val, buf, sizeof(val));
+                val = H5T_BSWAP32(val);
+                HDmemcpy(buf, &val, sizeof(val));
+            } /* end for */
+            break;
+
+        case 8:
+            for(u = 0; u < nelmts; u++, buf += stride) {
+                uint64_t val;
+
+                HDmemcpy(&val, buf, sizeof(val));
+                val = H5T_BSWAP64(val);
+                HDmemcpy(buf, &val, sizeof(val));
+            } /* end for */
+            break;
+
+        case 16:
+            for(u = 0; u < nelmts; u++, buf += stride) {
+                uint64_t lo, hi;
+
+                HDmemcpy(&lo, buf, sizeof(lo));
+                HDmemcpy(&hi, buf + 8, sizeof(hi));
+                lo = H5T_BSWAP64(lo);
+                hi = H5T_BSWAP64(hi);
+                HDmemcpy(buf, &hi, sizeof(hi));
+                HDmemcpy(buf + 8, &lo, sizeof(lo));
+            } /* end for */
+            break;
+
+        default:
+            for(u = 0; u < nelmts; u++, buf += stride)
+                for(v = 0; v < size / 2; v++) {
+                    uint8_t tmp = buf[v];
+
+                    buf[v] = buf[size - (v + 1)];
+                    buf[size - (v + 1)] = tmp;
+                } /* end for */
+            break;
+    } /* end switch */
+} /* end H5T_swap_scalar() */
+
+#ifdef H5T_SWAP_X86
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_swap_mask
+ *
+ * Purpose:	Looks up the shuffle mask for elements of SIZE bytes.
+ *
+ * Return:	Pointer to 16 bytes of shuffle mask
+ *
+ *-------------------------------------------------------------------------
+ */
+static const uint8_t *
+H5T_swap_mask(size_t size)
+{
+    switch(size) {
+        case 2:
+            return H5T_swap_mask_g[0];
+        case 4:
+            return H5T_swap_mask_g[1];
+        case 8:
+            return H5T_swap_mask_g[2];
+        default:
+            HDassert(16 == size);
+            return H5T_swap_mask_g[3];
+    } /* end switch */
+} /* end H5T_swap_mask() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_swap_ssse3
+ *
+ * Purpose:	Swaps packed elements sixteen bytes at a time with PSHUFB.
+ *		Since SIZE divides sixteen, every vector holds whole
+ *		elements; the remainder is swapped by H5T_swap_scalar().
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_swap_ssse3(uint8_t *buf, size_t size, size_t nelmts)
+{
+    const __m128i mask = _mm_loadu_si128((const __m128i *)H5T_swap_mask(size));
+    size_t      nbytes = size * nelmts;         /* Bytes to swap */
+    size_t      u = 0;                          /* Byte offset in BUF */
+
+    for(/*void*/; u + 64 <= nbytes; u += 64) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(buf + u));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(buf + u + 16));
+        __m128i v2 = _mm_loadu_si128((const __m128i *)(buf + u + 32));
+        __m128i v3 = _mm_loadu_si128((const __m128i *)(buf + u + 48));
+
+        _mm_storeu_si128((__m128i *)(buf + u), _mm_shuffle_epi8(v0, mask));
+        _mm_storeu_si128((__m128i *)(buf + u + 16), _mm_shuffle_epi8(v1, mask));
+        _mm_storeu_si128((__m128i *)(buf + u + 32), _mm_shuffle_epi8(v2, mask));
+        _mm_storeu_si128((__m128i *)(buf + u + 48), _mm_shuffle_epi8(v3, mask));
+    } /* end for */
+    for(/*void*/; u + 16 <= nbytes; u += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(buf + u));
+
+        _mm_storeu_si128((__m128i *)(buf + u), _mm_shuffle_epi8(v, mask));
+    } /* end for */
+
+    H5T_swap_scalar(buf + u, size, (nbytes - u) / size, size);
+} /* end H5T_swap_ssse3() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_swap_avx2
+ *
+ * Purpose:	Swaps packed elements thirty-two bytes at a time with
+ *		VPSHUFB, which shuffles within each sixteen byte lane, so
+ *		the same mask is used for both lanes.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_swap_avx2(uint8_t *buf, size_t size, size_t nelmts)
+{
+    const __m256i mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)H5T_swap_mask(size)));
+    size_t      nbytes = size * nelmts;         /* Bytes to swap */
+    size_t      u = 0;                          /* Byte offset in BUF */
+
+    for(/*void*/; u + 128 <= nbytes; u += 128) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i *)(buf + u));
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(buf + u + 32));
+        __m256i v2 = _mm256_loadu_si256((const __m256i *)(buf + u + 64));
+        __m256i v3 = _mm256_loadu_si256((const __m256i *)(buf + u + 96));
+
+        _mm256_storeu_si256((__m256i *)(buf + u), _mm256_shuffle_epi8(v0, mask));
+        _mm256_storeu_si256((__m256i *)(buf + u + 32), _mm256_shuffle_epi8(v1, mask));
+        _mm256_storeu_si256((__m256i *)(buf + u + 64), _mm256_shuffle_epi8(v2, mask));
+        _mm256_storeu_si256((__m256i *)(buf + u + 96), _mm256_shuffle_epi8(v3, mask));
+    } /* end for */
+    for(/*void*/; u + 32 <= nbytes; u += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(buf + u));
+
+        _mm256_storeu_si256((__m256i *)(buf + u), _mm256_shuffle_epi8(v, mask));
+    } /* end for */
+
+    H5T_swap_scalar(buf + u, size, (nbytes - u) / size, size);
+} /* end H5T_swap_avx2() */
+#endif /* H5T_SWAP_X86 */
+
+#ifdef H5T_SWAP_NEON
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T_swap_neon
+ *
+ * Purpose:	Swaps packed elements sixteen bytes at a time with the NEON
+ *		byte reversal instructions.  Sixteen byte elements are
+ *		reversed within each half and then have their halves
+ *		exchanged.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5T_swap_neon(uint8_t *buf, size_t size, size_t nelmts)
+{
+    size_t      nbytes = size * nelmts;         /* Bytes to swap */
+    size_t      u = 0;                          /* Byte offset in BUF */
+
+    switch(size) {
+        case 2:
+            for(/*void*/; u + 16 <= nbytes; u += 16)
+                vst1q_u8(buf + u, vrev16q_u8(vld1q_u8(buf + u)));
+            break;
+
+        case 4:
+            for(/*void*/; u + 16 <= nbytes; u += 16)
+                vst1q_u8(buf + u, vrev32q_u8(vld1q_u8(buf + u)));
+            break;
+
+        case 8:
+            for(/*void*/; u + 16 <= nbytes; u += 16)
+                vst1q_u8(buf + u, vrev64q_u8(vld1q_u8(buf + u)));
+            break;
+
+        default:
+            HDassert(16 == size);
+            for(/*void*/; u + 16 <= nbytes; u += 16) {
+                uint8x16_t v = vrev64q_u8(vld1q_u8(buf + u));
+
+                vst1q_u8(buf + u, vextq_u8(v, v, 8));
+            } /* end for */
+            break;
+    } /* end switch */
+
+    H5T_swap_scalar(buf + u, size, (nbytes - u) / size, size);
+} /* end H5T_swap_neon() */
+#endif /* H5T_SWAP_NEON */
+
@@ -863,6 +863,75 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5T_vlen_disk_read() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_read_multi
+ *
+ * Purpose:	Reads NSEQ disk based VL elements, VL[i] into the buffer
+ *		BUF[i].  The global heap objects are read with a single
+ *		call to H5HG_read_multi(), so each heap collection is
+ *		protected only once for the whole batch.  Sequences without
+ *		any data are skipped.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__vlen_disk_read_multi(H5F_t *f, hid_t dxpl_id, size_t nseq, void *vl[],
+    void *buf[])
+{
+    H5HG_t *hobjid = NULL;      /* Heap IDs of the sequences to read */
+    void **obj_buf = NULL;      /* Buffers for the sequences to read */
+    size_t nobjs = 0;           /* Number of heap objects to read */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check parameters */
+    HDassert(f);
+    HDassert(vl || 0 == nseq);
+    HDassert(buf || 0 == nseq);
+
+    if(0 == nseq)
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (hobjid = (H5HG_t *)H5MM_malloc(nseq * sizeof(H5HG_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (obj_buf = (void **)H5MM_malloc(nseq * sizeof(void *))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    /* Decode the heap information for each sequence */
+    for(u = 0; u < nseq; u++) {
+        const uint8_t *p = (const uint8_t *)vl[u];
+
+        HDassert(p);
+        HDassert(buf[u]);
+
+        /* Skip the length of the sequence */
+        p += 4;
+
+        /* Get the heap information */
+        H5F_addr_decode(f, &p, &(hobjid[nobjs].addr));
+        UINT32DECODE(p, hobjid[nobjs].idx);
+
+        /* Check if this sequence actually has any data */
+        if(hobjid[nobjs].addr > 0)
+            obj_buf[nobjs++] = buf[u];
+    } /* end for */
+
+    /* Read the VL information from disk */
+    if(H5HG_read_multi(f, dxpl_id, nobjs, hobjid, obj_buf) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_READERROR, FAIL, "Unable to read VL information")
+
+done:
+    H5MM_xfree(hobjid);
+    H5MM_xfree(obj_buf);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5T__vlen_disk_read_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_vlen_disk_write
@@ -928,6 +997,90 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* end H5T_vlen_disk_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5T__vlen_disk_write_multi
+ *
+ * Purpose:	Writes NSEQ disk based VL elements, the SEQ_LEN[i] elements
+ *		of BASE_SIZE bytes in BUF[i] being stored into the heap and
+ *		described by VL[i].  Heap objects for old data described by
+ *		BG[i] are freed first, unless BG or BG[i] is NULL.  All the
+ *		sequences are inserted into the global heap with a single
+ *		call to H5HG_insert_multi(), which keeps them together in
+ *		as few collections as possible.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5T__vlen_disk_write_multi(H5F_t *f, hid_t dxpl_id, size_t nseq, void *vl[],
+    void *bg[], void *buf[], const size_t seq_len[], size_t base_size)
+{
+    H5HG_t *hobjid = NULL;      /* New VL sequences' heap IDs */
+    size_t *len = NULL;         /* Sizes of new sequences on disk (in bytes) */
+    size_t u;                   /* Local index variable */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* check parameters */
+    HDassert(f);
+    HDassert(vl || 0 == nseq);
+    HDassert(buf || 0 == nseq);
+    HDassert(seq_len || 0 == nseq);
+
+    if(0 == nseq)
+        HGOTO_DONE(SUCCEED)
+
+    if(NULL == (hobjid = (H5HG_t *)H5MM_malloc(nseq * sizeof(H5HG_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+    if(NULL == (len = (size_t *)H5MM_malloc(nseq * sizeof(size_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
+
+    for(u = 0; u < nseq; u++) {
+        /* Free heap object for old data.  */
+        if(bg && bg[u]) {
+            const uint8_t *p = (const uint8_t *)bg[u];
+            H5HG_t bg_hobjid;   /* "Background" VL info sequence's ID info */
+
+            /* Skip the length of the sequence and heap object ID from background data. */
+            p += 4;
+
+            /* Get heap information */
+            H5F_addr_decode(f, &p, &(bg_hobjid.addr));
+            UINT32DECODE(p, bg_hobjid.idx);
+
+            /* Free heap object for old data */
+            if(bg_hobjid.addr > 0)
+                if(H5HG_remove(f, dxpl_id, &bg_hobjid) < 0)
+                    HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "Unable to remove heap object")
+        } /* end if */
+
+        HDassert(seq_len[u] == 0 || buf[u]);
+        len[u] = seq_len[u] * base_size;
+    } /* end for */
+
+    /* Write the VL information to disk (allocates space also) */
+    if(H5HG_insert_multi(f, dxpl_id, nseq, len, buf, hobjid) < 0)
+        HGOTO_ERROR(H5E_DATATYPE, H5E_WRITEERROR, FAIL, "Unable to write VL information")
+
+    /* Encode the length and heap information */
+    for(u = 0; u < nseq; u++) {
+        uint8_t *p = (uint8_t *)vl[u];
+
+        UINT32ENCODE(p, seq_len[u]);
+        H5F_addr_encode(f, &p, hobjid[u].addr);
+        UINT32ENCODE(p, hobjid[u].idx);
+    } /* end for */
+
+done:
+    H5MM_xfree(hobjid);
+    H5MM_xfree(len);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* end H5T__vlen_disk_write_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5T_vlen_disk_setnull
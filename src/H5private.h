@@ -74,6 +74,21 @@
 #   include <pwd.h>
 #endif
 
+/*
+ * Positional I/O (pread() and pwrite()).  Both are needed for the POSIX
+ * file drivers to drop their seek-then-read/write code paths.
+ */
+#if defined(H5_HAVE_PREAD) && defined(H5_HAVE_PWRITE)
+#   define H5_HAVE_PREADWRITE
+#endif
+
+/*
+ * Scatter/gather I/O (preadv() and pwritev())
+ */
+#if defined(H5_HAVE_PREADV) || defined(H5_HAVE_PWRITEV)
+#   include <sys/uio.h>
+#endif
+
 /*
  * C9x integer types
  */
@@ -1112,9 +1127,18 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDmktime
     #define HDmktime(T)    mktime(T)
 #endif /* HDmktime */
+#ifndef HDmmap
+    #define HDmmap(A,L,P,F,D,O)    mmap(A,L,P,F,D,O)
+#endif /* HDmmap */
 #ifndef HDmodf
     #define HDmodf(X,Y)    modf(X,Y)
 #endif /* HDmodf */
+#ifndef HDmsync
+    #define HDmsync(A,L,F)    msync(A,L,F)
+#endif /* HDmsync */
+#ifndef HDmunmap
+    #define HDmunmap(A,L)    munmap(A,L)
+#endif /* HDmunmap */
 #ifndef HDnanosleep
     #define HDnanosleep(N, O)    nanosleep(N, O)
 #endif /* HDnanosleep */
@@ -1149,6 +1173,12 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDprintf
     #define HDprintf(...)   HDfprintf(stdout, __VA_ARGS__)
 #endif /* HDprintf */
+#ifndef HDpread
+    #define HDpread(F,B,S,O)    pread(F,B,S,O)
+#endif /* HDpread */
+#ifndef HDpreadv
+    #define HDpreadv(F,V,N,O)    preadv(F,V,N,O)
+#endif /* HDpreadv */
 #ifndef HDputc
     #define HDputc(C,F)    putc(C,F)
 #endif /* HDputc*/
@@ -1158,6 +1188,12 @@ typedef off_t               h5_stat_size_t;
 #ifndef HDputs
     #define HDputs(S)    puts(S)
 #endif /* HDputs */
+#ifndef HDpwrite
+    #define HDpwrite(F,B,S,O)    pwrite(F,B,S,O)
+#endif /* HDpwrite */
+#ifndef HDpwritev
+    #define HDpwritev(F,V,N,O)    pwritev(F,V,N,O)
+#endif /* HDpwritev */
 #ifndef HDqsort
     #define HDqsort(M,N,Z,F)  qsort(M,N,Z,F)
 #endif /* HDqsort*/
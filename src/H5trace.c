@@ -293,6 +293,40 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                 } /* end else */
                 break;
 
+            case 'C':
+                switch(type[1]) {
+                    case 'f':
+                        if(ptr) {
+                            if(vp)
+                                fprintf(out, "0x%lx", (unsigned long)vp);
+                            else
+                                fprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5AC_log_format_t log_format = (H5AC_log_format_t)va_arg(ap, int);
+
+                            switch(log_format) {
+                                case H5AC_LOG_FORMAT_JSON:
+                                    fprintf(out, "H5AC_LOG_FORMAT_JSON");
+                                    break;
+
+                                case H5AC_LOG_FORMAT_BINARY:
+                                    fprintf(out, "H5AC_LOG_FORMAT_BINARY");
+                                    break;
+
+                                default:
+                                    fprintf(out, "%ld", (long)log_format);
+                                    break;
+                            } /* end switch */
+                        } /* end else */
+                        break;
+
+                    default:
+                        fprintf(out, "BADTYPE(C%c)", type[1]);
+                        goto error;
+                } /* end switch */
+                break;
+
             case 'D':
                 switch(type[1]) {
                     case 'a':
@@ -918,6 +952,10 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                                     fprintf(out, "H5F_FILE_SPACE_VFD");
                                     break;
 
+                                case H5F_FILE_SPACE_PAGE:
+                                    fprintf(out, "H5F_FILE_SPACE_PAGE");
+                                    break;
+
                                 case H5F_FILE_SPACE_NTYPES:
                                 default:
                                     fprintf(out, "%ld", (long)fs_type);
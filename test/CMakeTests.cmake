@@ -553,6 +553,11 @@ set (test_CLEANFILES
     test_swmr*.h5
     cache_logging.h5
     cache_logging.out
+    cache_logging.trace
+    cache_replay.h5
+    cache_replay.trace
+    cache_replay_sampled.trace
+    page_buffer.h5
     vds_swmr.h5
     vds_swmr_src_*.h5
 )
@@ -622,6 +627,8 @@ set (H5TEST_TESTS
     file_image
     unregister
     cache_logging
+    cache_replay
+    page_buffer
     cork
     swmr
 )
@@ -41,6 +41,13 @@
 #define RAND_SEG_LEN    (1024)
 #define RANDOM_BASE_OFF (1024 * 1024)
 
+/* Multiple accumulator test values */
+#define MULTI_ACCUM_BASE    (512 * 1024)
+#define MULTI_ACCUM_WRITE   256
+#define MULTI_ACCUM_NWRITES 8
+#define MULTI_ACCUM_REGION  (4 * 1024)
+#define MULTI_ACCUM_SPAN    ((H5F_NUM_META_ACCUM + 1) * MULTI_ACCUM_REGION)
+
 /* Make file global to all tests */
 H5F_t * f = NULL;
 
@@ -57,6 +64,8 @@ unsigned test_read_after(const H5F_io_info_t *fio_info);
 unsigned test_free(const H5F_io_info_t *fio_info);
 unsigned test_big(const H5F_io_info_t *fio_info);
 unsigned test_random_write(const H5F_io_info_t *fio_info);
+unsigned test_multiple_accum(const H5F_io_info_t *fio_info);
+unsigned test_multiple_accum_swmr(const H5F_io_info_t *fio_info);
 unsigned test_swmr_write_big(hbool_t newest_format);
 
 /* Helper Function Prototypes */
@@ -127,6 +136,8 @@ main(void)
     nerrors += test_free(&fio_info);
     nerrors += test_big(&fio_info);
     nerrors += test_random_write(&fio_info);
+    nerrors += test_multiple_accum(&fio_info);
+    nerrors += test_multiple_accum_swmr(&fio_info);
 
     /* End of test code, close and delete file */
     if(H5Fclose(fid) < 0) TEST_ERROR
@@ -1789,6 +1800,222 @@ error:
     return 1;
 } /* end test_random_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multiple_accum
+ * 
+ * Purpose:     Test that metadata of different types written in turn to
+ *              different places in the file is kept in separate
+ *              accumulators, that the accumulators stay consistent when
+ *              an access spans more than one of them, and that the least
+ *              recently used accumulator for a type is reused when they
+ *              are all in use.
+ * 
+ * Return:      Success: SUCCEED
+ *              Failure: FAIL
+ * 
+ *-------------------------------------------------------------------------
+ */
+unsigned
+test_multiple_accum(const H5F_io_info_t *fio_info)
+{
+    const H5FD_mem_t types[H5F_NUM_META_ACCUM] = {H5FD_MEM_BTREE, H5FD_MEM_OHDR, H5FD_MEM_LHEAP, H5FD_MEM_SUPER};
+    H5F_meta_accum_t *accums = f->shared->accum;
+    uint8_t *wbuf = NULL, *wbuf2 = NULL, *expect = NULL, *rbuf = NULL;
+    haddr_t addr;
+    size_t size;
+    size_t i;
+    unsigned u, v;
+
+    TESTING("multiple metadata accumulators");
+
+    /* Allocate buffers */
+    wbuf = (uint8_t *)HDmalloc((size_t)MULTI_ACCUM_SPAN);
+    HDassert(wbuf);
+    wbuf2 = (uint8_t *)HDmalloc((size_t)MULTI_ACCUM_SPAN);
+    HDassert(wbuf2);
+    expect = (uint8_t *)HDmalloc((size_t)MULTI_ACCUM_SPAN);
+    HDassert(expect);
+    rbuf = (uint8_t *)HDcalloc((size_t)1, (size_t)MULTI_ACCUM_SPAN);
+    HDassert(rbuf);
+
+    for(i = 0; i < MULTI_ACCUM_SPAN; i++) {
+        wbuf[i] = (uint8_t)(i % 251);
+        wbuf2[i] = (uint8_t)(255 - (i % 253));
+    } /* end for */
+    HDmemcpy(expect, wbuf, (size_t)MULTI_ACCUM_SPAN);
+
+    /* Append to two regions in turn, with different types of metadata */
+    for(u = 0; u < MULTI_ACCUM_NWRITES; u++)
+        for(v = 0; v < 2; v++) {
+            addr = (haddr_t)(v * MULTI_ACCUM_REGION + u * MULTI_ACCUM_WRITE);
+            if(H5F_block_write(f, types[v], MULTI_ACCUM_BASE + addr, (size_t)MULTI_ACCUM_WRITE, H5AC_ind_read_dxpl_id, wbuf + addr) < 0) FAIL_STACK_ERROR;
+        } /* end for */
+
+    /* Each region has its own accumulator, which holds all the writes */
+    for(v = 0; v < 2; v++) {
+        for(u = 0; u < H5F_NUM_META_ACCUM; u++)
+            if(accums[u].loc == MULTI_ACCUM_BASE + v * MULTI_ACCUM_REGION)
+                break;
+        if(u == H5F_NUM_META_ACCUM) TEST_ERROR;
+        if(accums[u].size != MULTI_ACCUM_NWRITES * MULTI_ACCUM_WRITE || !accums[u].dirty) TEST_ERROR;
+    } /* end for */
+
+    /* Write across the end of the first region, the gap after it and the
+     * start of the second region
+     */
+    addr = (haddr_t)((MULTI_ACCUM_NWRITES - 1) * MULTI_ACCUM_WRITE);
+    size = (size_t)(MULTI_ACCUM_REGION + MULTI_ACCUM_WRITE - addr);
+    if(H5F_block_write(f, H5FD_MEM_LHEAP, MULTI_ACCUM_BASE + addr, size, H5AC_ind_read_dxpl_id, wbuf2 + addr) < 0) FAIL_STACK_ERROR;
+    HDmemcpy(expect + addr, wbuf2 + addr, size);
+
+    /* Read across both regions, before and after flushing */
+    size = (size_t)(MULTI_ACCUM_REGION + MULTI_ACCUM_NWRITES * MULTI_ACCUM_WRITE);
+    for(u = 0; u < 2; u++) {
+        HDmemset(rbuf, 0, size);
+        if(H5F_block_read(f, H5FD_MEM_BTREE, MULTI_ACCUM_BASE, size, H5AC_ind_read_dxpl_id, rbuf) < 0) FAIL_STACK_ERROR;
+        if(HDmemcmp(rbuf, expect, size) != 0) TEST_ERROR;
+
+        if(accum_reset(fio_info) < 0) FAIL_STACK_ERROR;
+    } /* end for */
+
+    /* Fill all the accumulators with a region of each type, then write
+     * another region of the first type: only its accumulator is reused
+     */
+    for(u = 0; u <= H5F_NUM_META_ACCUM; u++) {
+        addr = (haddr_t)(u * MULTI_ACCUM_REGION);
+        if(H5F_block_write(f, types[u % H5F_NUM_META_ACCUM], MULTI_ACCUM_BASE + addr, (size_t)MULTI_ACCUM_WRITE, H5AC_ind_read_dxpl_id, wbuf2 + addr) < 0) FAIL_STACK_ERROR;
+        HDmemcpy(expect + addr, wbuf2 + addr, (size_t)MULTI_ACCUM_WRITE);
+    } /* end for */
+    for(u = 1; u <= H5F_NUM_META_ACCUM; u++) {
+        for(v = 0; v < H5F_NUM_META_ACCUM; v++)
+            if(accums[v].loc == MULTI_ACCUM_BASE + u * MULTI_ACCUM_REGION)
+                break;
+        if(v == H5F_NUM_META_ACCUM) TEST_ERROR;
+    } /* end for */
+    if(accums[0].loc != MULTI_ACCUM_BASE + H5F_NUM_META_ACCUM * MULTI_ACCUM_REGION) TEST_ERROR;
+
+    /* The data written to the reused accumulator reached the file */
+    HDmemset(rbuf, 0, (size_t)MULTI_ACCUM_WRITE);
+    if(H5FD_read(f->shared->lf, fio_info->dxpl, H5FD_MEM_BTREE, MULTI_ACCUM_BASE, (size_t)MULTI_ACCUM_WRITE, rbuf) < 0) FAIL_STACK_ERROR;
+    if(HDmemcmp(rbuf, expect, (size_t)MULTI_ACCUM_WRITE) != 0) TEST_ERROR;
+
+    if(accum_reset(fio_info) < 0) FAIL_STACK_ERROR;
+
+    PASSED();
+
+    /* Release memory */
+    HDfree(wbuf);
+    HDfree(wbuf2);
+    HDfree(expect);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    /* Release memory */
+    HDfree(wbuf);
+    HDfree(wbuf2);
+    HDfree(expect);
+    HDfree(rbuf);
+
+    return 1;
+} /* test_multiple_accum */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_multiple_accum_swmr
+ *
+ * Purpose:     Checks that writes to a file open for SWMR writing reach
+ *              the file in the order they were made, across regions that
+ *              would otherwise be held by different metadata accumulators.
+ *
+ * Return:      Success: 0
+ *              Failure: 1
+ *
+ *-------------------------------------------------------------------------
+ */
+unsigned
+test_multiple_accum_swmr(const H5F_io_info_t *fio_info)
+{
+    const H5FD_mem_t types[H5F_NUM_META_ACCUM] = {H5FD_MEM_BTREE, H5FD_MEM_OHDR, H5FD_MEM_LHEAP, H5FD_MEM_SUPER};
+    H5F_meta_accum_t *accums = f->shared->accum;
+    unsigned saved_flags = f->shared->flags;
+    uint8_t *wbuf = NULL, *rbuf = NULL;
+    haddr_t addr, prev_addr = HADDR_UNDEF;
+    size_t i;
+    unsigned u, v;
+
+    TESTING("multiple metadata accumulators with SWMR writes");
+
+    /* Allocate buffers */
+    wbuf = (uint8_t *)HDmalloc((size_t)MULTI_ACCUM_SPAN);
+    HDassert(wbuf);
+    rbuf = (uint8_t *)HDcalloc((size_t)1, (size_t)MULTI_ACCUM_WRITE);
+    HDassert(rbuf);
+
+    for(i = 0; i < MULTI_ACCUM_SPAN; i++)
+        wbuf[i] = (uint8_t)(7 + (i % 249));
+
+    /* Leave dirty data in several accumulators before SWMR writing starts */
+    for(u = 0; u < H5F_NUM_META_ACCUM; u++) {
+        addr = (haddr_t)(u * MULTI_ACCUM_REGION);
+        if(H5F_block_write(f, types[u], MULTI_ACCUM_BASE + addr, (size_t)MULTI_ACCUM_WRITE, H5AC_ind_read_dxpl_id, wbuf + addr) < 0) FAIL_STACK_ERROR;
+    } /* end for */
+    if(accums[H5F_NUM_META_ACCUM - 1].size == 0 || !accums[H5F_NUM_META_ACCUM - 1].dirty) TEST_ERROR;
+
+    f->shared->flags |= H5F_ACC_SWMR_WRITE;
+
+    /* Append to two regions in turn: each write must push the one before
+     * it out to the file, and only one accumulator is ever in use
+     */
+    for(u = 1; u < MULTI_ACCUM_NWRITES; u++)
+        for(v = 0; v < 2; v++) {
+            addr = (haddr_t)(v * MULTI_ACCUM_REGION + u * MULTI_ACCUM_WRITE);
+            if(H5F_block_write(f, types[v], MULTI_ACCUM_BASE + addr, (size_t)MULTI_ACCUM_WRITE, H5AC_ind_read_dxpl_id, wbuf + addr) < 0) FAIL_STACK_ERROR;
+
+            /* The writes made before SWMR writing started are all in the file */
+            if(1 == u && 0 == v)
+                for(i = 0; i < H5F_NUM_META_ACCUM; i++) {
+                    HDmemset(rbuf, 0, (size_t)MULTI_ACCUM_WRITE);
+                    if(H5FD_read(f->shared->lf, fio_info->dxpl, types[i], MULTI_ACCUM_BASE + i * MULTI_ACCUM_REGION, (size_t)MULTI_ACCUM_WRITE, rbuf) < 0) FAIL_STACK_ERROR;
+                    if(HDmemcmp(rbuf, wbuf + i * MULTI_ACCUM_REGION, (size_t)MULTI_ACCUM_WRITE) != 0) TEST_ERROR;
+                } /* end for */
+
+            /* The previous write is in the file */
+            if(H5F_addr_defined(prev_addr)) {
+                HDmemset(rbuf, 0, (size_t)MULTI_ACCUM_WRITE);
+                if(H5FD_read(f->shared->lf, fio_info->dxpl, types[1 - v], MULTI_ACCUM_BASE + prev_addr, (size_t)MULTI_ACCUM_WRITE, rbuf) < 0) FAIL_STACK_ERROR;
+                if(HDmemcmp(rbuf, wbuf + prev_addr, (size_t)MULTI_ACCUM_WRITE) != 0) TEST_ERROR;
+            } /* end if */
+            prev_addr = addr;
+
+            for(i = 1; i < H5F_NUM_META_ACCUM; i++)
+                if(accums[i].size > 0) TEST_ERROR;
+        } /* end for */
+
+    f->shared->flags = saved_flags;
+
+    if(accum_reset(fio_info) < 0) FAIL_STACK_ERROR;
+
+    PASSED();
+
+    /* Release memory */
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 0;
+
+error:
+    f->shared->flags = saved_flags;
+
+    /* Release memory */
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    return 1;
+} /* test_multiple_accum_swmr */
+
 /*-------------------------------------------------------------------------
  * Function:    test_swmr_write_big
  * 
@@ -2016,29 +2243,33 @@ error:
 void
 accum_printf(void)
 {
-    H5F_meta_accum_t * accum = &f->shared->accum;
-
-    printf("\n");
-    printf("Current contents of accumulator:\n");
-    if (accum->alloc_size == 0) {
-        printf("=====================================================\n");
-        printf(" No accumulator allocated.\n");
-        printf("=====================================================\n");
-    } else {
-        printf("=====================================================\n");
-        printf(" accumulator allocated size == %zu\n", accum->alloc_size);
-        printf(" accumulated data size      == %zu\n", accum->size);
-        HDfprintf(stdout, " accumulator dirty?         == %t\n", accum->dirty);
-        printf("=====================================================\n");
-        HDfprintf(stdout, " start of accumulated data, loc = %a\n", accum->loc);
-        if(accum->dirty) {
-            HDfprintf(stdout, " start of dirty region, loc = %a\n", (haddr_t)(accum->loc + accum->dirty_off));
-            HDfprintf(stdout, " end of dirty region,   loc = %a\n", (haddr_t)(accum->loc + accum->dirty_off + accum->dirty_len));
-        } /* end if */
-        HDfprintf(stdout, " end of accumulated data,   loc = %a\n", (haddr_t)(accum->loc + accum->size));
-        HDfprintf(stdout, " end of accumulator allocation,   loc = %a\n", (haddr_t)(accum->loc + accum->alloc_size));
-        printf("=====================================================\n");
-    }
+    unsigned u;
+
+    for(u = 0; u < H5F_NUM_META_ACCUM; u++) {
+        H5F_meta_accum_t * accum = &f->shared->accum[u];
+
+        printf("\n");
+        printf("Current contents of accumulator %u:\n", u);
+        if (accum->alloc_size == 0) {
+            printf("=====================================================\n");
+            printf(" No accumulator allocated.\n");
+            printf("=====================================================\n");
+        } else {
+            printf("=====================================================\n");
+            printf(" accumulator allocated size == %zu\n", accum->alloc_size);
+            printf(" accumulated data size      == %zu\n", accum->size);
+            HDfprintf(stdout, " accumulator dirty?         == %t\n", accum->dirty);
+            printf("=====================================================\n");
+            HDfprintf(stdout, " start of accumulated data, loc = %a\n", accum->loc);
+            if(accum->dirty) {
+                HDfprintf(stdout, " start of dirty region, loc = %a\n", (haddr_t)(accum->loc + accum->dirty_off));
+                HDfprintf(stdout, " end of dirty region,   loc = %a\n", (haddr_t)(accum->loc + accum->dirty_off + accum->dirty_len));
+            } /* end if */
+            HDfprintf(stdout, " end of accumulated data,   loc = %a\n", (haddr_t)(accum->loc + accum->size));
+            HDfprintf(stdout, " end of accumulator allocation,   loc = %a\n", (haddr_t)(accum->loc + accum->alloc_size));
+            printf("=====================================================\n");
+        }
+    } /* end for */
     printf("\n\n");
 } /* accum_printf() */
 
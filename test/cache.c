@@ -194,6 +194,9 @@ static unsigned check_flush_deps(void);
 static unsigned check_flush_deps_err(void);
 static unsigned check_flush_deps_order(void);
 static unsigned check_notify_cb(void);
+static unsigned check_coalesced_flush(void);
+static unsigned check_index_resize(void);
+static unsigned check_slist_sort(void);
 static unsigned check_metadata_cork(hbool_t fill_via_insertion);
 static unsigned check_entry_deletions_during_scans(void);
 static void cedds__expunge_dirty_entry_in_flush_test(H5F_t * file_ptr);
@@ -33497,6 +33500,362 @@ done:
     return (unsigned)!pass;
 } /* check_notify_cb() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	check_coalesced_flush()
+ *
+ * Purpose:	Verify that a flush stages the images of dirty entries and
+ *		merges the images of entries adjacent in the file into a
+ *		single write, that the data written is correct, and that
+ *		entries are written one at a time when the cache is told
+ *		not to coalesce flush writes, or the file is open for SWMR
+ *		writing.
+ *
+ * Return:	0 on success, non-zero on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+#define CCF_NUM_ENTRIES         64
+
+static unsigned
+check_coalesced_flush(void)
+{
+    H5F_t * file_ptr = NULL;            /* File for this test */
+    H5C_t * cache_ptr = NULL;           /* Metadata cache for this test */
+    test_entry_t *base_addr;            /* Base address of entries for test */
+    int32_t entry_type = TINY_ENTRY_TYPE; /* Type of entries for test */
+    uint8_t image[TINY_ENTRY_SIZE];     /* Image of an entry read from the file */
+    int64_t images;                     /* Images staged before a flush */
+    int64_t writes;                     /* Staged writes before a flush */
+    int32_t i;                          /* Local index variable */
+
+    TESTING("coalesced writes during flush");
+
+    pass = TRUE;
+
+    reset_entries();
+    file_ptr = setup_cache((size_t)(2 * 1024 * 1024), (size_t)(1 * 1024 * 1024));
+    if(!file_ptr) CACHE_ERROR("setup_cache returned NULL")
+    cache_ptr = file_ptr->shared->cache;
+    base_addr = entries[entry_type];
+
+    if(!pass) CACHE_ERROR("setup_cache failed")
+    if(!cache_ptr->coalesce_flush_writes)
+        CACHE_ERROR("flush writes not coalesced by default")
+
+    /* Insert entries adjacent in the file, and flush them */
+    for(i = 0; i < CCF_NUM_ENTRIES; i++) {
+        insert_entry(file_ptr, entry_type, i, H5C__NO_FLAGS_SET);
+        if(!pass) CACHE_ERROR("insert_entry failed")
+    } /* end for */
+    images = cache_ptr->flush_stage_images;
+    writes = cache_ptr->flush_stage_writes;
+    flush_cache(file_ptr, FALSE, FALSE, FALSE);
+    if(!pass) CACHE_ERROR("flush_cache failed")
+    if(cache_ptr->flush_stage_images - images != CCF_NUM_ENTRIES)
+        CACHE_ERROR("unexpected number of staged images")
+    if(cache_ptr->flush_stage_writes - writes != 1)
+        CACHE_ERROR("adjacent images not written together")
+    if(cache_ptr->slist_len != 0 || cache_ptr->flush_stage_len != 0)
+        CACHE_ERROR("entries left after flush")
+
+    /* Verify the images in the file */
+    for(i = 0; i < CCF_NUM_ENTRIES; i++) {
+        if(H5F_block_read(file_ptr, H5FD_MEM_DEFAULT, base_addr[i].addr, sizeof(image), H5AC_ind_read_dxpl_id, image) < 0)
+            CACHE_ERROR("H5F_block_read failed")
+        if(image[0] != (uint8_t)entry_type || image[1] != (uint8_t)((i & 0xFF00) >> 8)
+                || image[2] != (uint8_t)(i & 0xFF))
+            CACHE_ERROR("unexpected entry image in file")
+    } /* end for */
+
+    /* Dirty every other entry: none of the images are adjacent now */
+    for(i = 0; i < CCF_NUM_ENTRIES; i += 2) {
+        protect_entry(file_ptr, entry_type, i);
+        if(!pass) CACHE_ERROR("protect_entry failed")
+        unprotect_entry(file_ptr, entry_type, i, H5C__DIRTIED_FLAG);
+        if(!pass) CACHE_ERROR("unprotect_entry failed")
+    } /* end for */
+    images = cache_ptr->flush_stage_images;
+    writes = cache_ptr->flush_stage_writes;
+    flush_cache(file_ptr, FALSE, FALSE, FALSE);
+    if(!pass) CACHE_ERROR("flush_cache failed")
+    if(cache_ptr->flush_stage_images - images != CCF_NUM_ENTRIES / 2)
+        CACHE_ERROR("unexpected number of staged images")
+    if(cache_ptr->flush_stage_writes - writes != CCF_NUM_ENTRIES / 2)
+        CACHE_ERROR("unexpected number of staged writes")
+
+    /* Turn coalescing off: nothing is staged */
+    cache_ptr->coalesce_flush_writes = FALSE;
+    for(i = 0; i < CCF_NUM_ENTRIES; i++) {
+        protect_entry(file_ptr, entry_type, i);
+        if(!pass) CACHE_ERROR("protect_entry failed")
+        unprotect_entry(file_ptr, entry_type, i, H5C__DIRTIED_FLAG);
+        if(!pass) CACHE_ERROR("unprotect_entry failed")
+    } /* end for */
+    images = cache_ptr->flush_stage_images;
+    flush_cache(file_ptr, FALSE, FALSE, FALSE);
+    if(!pass) CACHE_ERROR("flush_cache failed")
+    if(cache_ptr->flush_stage_images != images)
+        CACHE_ERROR("images staged with coalescing off")
+    cache_ptr->coalesce_flush_writes = TRUE;
+
+    /* Nothing is staged for SWMR writes either, which must keep the order
+     * of flush dependencies
+     */
+    file_ptr->shared->flags |= H5F_ACC_SWMR_WRITE;
+    for(i = 0; i < CCF_NUM_ENTRIES; i++) {
+        protect_entry(file_ptr, entry_type, i);
+        if(!pass) CACHE_ERROR("protect_entry failed")
+        unprotect_entry(file_ptr, entry_type, i, H5C__DIRTIED_FLAG);
+        if(!pass) CACHE_ERROR("unprotect_entry failed")
+    } /* end for */
+    images = cache_ptr->flush_stage_images;
+    flush_cache(file_ptr, FALSE, FALSE, FALSE);
+    file_ptr->shared->flags &= ~H5F_ACC_SWMR_WRITE;
+    if(!pass) CACHE_ERROR("flush_cache failed")
+    if(cache_ptr->flush_stage_images != images)
+        CACHE_ERROR("images staged for SWMR writes")
+
+    /* Dirty all entries again and destroy them in a coalesced flush */
+    for(i = 0; i < CCF_NUM_ENTRIES; i++) {
+        protect_entry(file_ptr, entry_type, i);
+        if(!pass) CACHE_ERROR("protect_entry failed")
+        unprotect_entry(file_ptr, entry_type, i, H5C__DIRTIED_FLAG);
+        if(!pass) CACHE_ERROR("unprotect_entry failed")
+    } /* end for */
+    writes = cache_ptr->flush_stage_writes;
+    flush_cache(file_ptr, TRUE, FALSE, FALSE);
+    if(!pass) CACHE_ERROR("flush_cache failed")
+    if(cache_ptr->flush_stage_writes - writes != 1)
+        CACHE_ERROR("adjacent images not written together")
+
+    /* Reload the entries from the file */
+    for(i = 0; i < CCF_NUM_ENTRIES; i++) {
+        protect_entry(file_ptr, entry_type, i);
+        if(!pass) CACHE_ERROR("protect_entry failed")
+        if(!base_addr[i].deserialized)
+            CACHE_ERROR("entry not reloaded")
+        unprotect_entry(file_ptr, entry_type, i, H5C__NO_FLAGS_SET);
+        if(!pass) CACHE_ERROR("unprotect_entry failed")
+    } /* end for */
+
+done:
+    takedown_cache(file_ptr, FALSE, FALSE);
+
+    if(pass)
+        PASSED()
+    else {
+        H5_FAILED();
+        HDfprintf(stdout, "%s.\n", failure_mssg);
+    } /* end else */
+
+    return (unsigned)!pass;
+} /* check_coalesced_flush() */
+#undef CCF_NUM_ENTRIES
+
+
+/*-------------------------------------------------------------------------
+ * Function:	check_index_resize()
+ *
+ * Purpose:	Verify that the hash table indexing the cache grows as
+ *		entries are inserted, that all entries can be found in it
+ *		after it has been resized, and that it shrinks back to its
+ *		minimum length as entries leave the cache.
+ *
+ * Return:	0 on success, non-zero on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static unsigned
+check_index_resize(void)
+{
+    H5F_t * file_ptr = NULL;            /* File for this test */
+    H5C_t * cache_ptr = NULL;           /* Metadata cache for this test */
+    test_entry_t *base_addr;            /* Base address of entries for test */
+    int32_t entry_type = PICO_ENTRY_TYPE; /* Type of entries for test */
+    H5C_cache_entry_t *entry_ptr;       /* Entry found in the index */
+    int32_t i;                          /* Local index variable */
+
+    TESTING("metadata cache index resizing");
+
+    pass = TRUE;
+
+    reset_entries();
+    file_ptr = setup_cache((size_t)(2 * 1024 * 1024), (size_t)(1 * 1024 * 1024));
+    if(!file_ptr) CACHE_ERROR("setup_cache returned NULL")
+    cache_ptr = file_ptr->shared->cache;
+    base_addr = entries[entry_type];
+
+    if(!pass) CACHE_ERROR("setup_cache failed")
+    if(cache_ptr->index_len_slots != H5C__INDEX_MIN_LEN)
+        CACHE_ERROR("unexpected initial index length")
+
+    /* Insert enough entries to force the index to grow twice */
+    for(i = 0; i < NUM_PICO_ENTRIES; i++) {
+        insert_entry(file_ptr, entry_type, i, H5C__NO_FLAGS_SET);
+        if(!pass) CACHE_ERROR("insert_entry failed")
+        if((size_t)cache_ptr->index_len * 4 > cache_ptr->index_len_slots * 3)
+            CACHE_ERROR("index more than 3/4 full")
+    } /* end for */
+    if(cache_ptr->index_len != NUM_PICO_ENTRIES)
+        CACHE_ERROR("unexpected index length")
+    if(cache_ptr->index_len_slots != 4 * H5C__INDEX_MIN_LEN)
+        CACHE_ERROR("index didn't grow")
+
+    /* Every entry must be found at its address, and nothing at others */
+    for(i = 0; i < NUM_PICO_ENTRIES; i++) {
+        H5C_TEST__SEARCH_INDEX(cache_ptr, base_addr[i].addr, entry_ptr)
+        if(entry_ptr != &(base_addr[i].header))
+            CACHE_ERROR("entry not found in index")
+    } /* end for */
+    H5C_TEST__SEARCH_INDEX(cache_ptr, base_addr[NUM_PICO_ENTRIES - 1].addr + PICO_ENTRY_SIZE, entry_ptr)
+    if(entry_ptr != NULL)
+        CACHE_ERROR("found entry at unused address")
+
+    /* Expunge all but a few of the entries, checking the index shrinks
+     * and that the remaining entries are still found.
+     */
+    for(i = 0; i < NUM_PICO_ENTRIES - 16; i++) {
+        expunge_entry(file_ptr, entry_type, i);
+        if(!pass) CACHE_ERROR("expunge_entry failed")
+    } /* end for */
+    if(cache_ptr->index_len != 16)
+        CACHE_ERROR("unexpected index length after expunge")
+    if(cache_ptr->index_len_slots != H5C__INDEX_MIN_LEN)
+        CACHE_ERROR("index didn't shrink")
+    for(i = 0; i < NUM_PICO_ENTRIES; i++) {
+        H5C_TEST__SEARCH_INDEX(cache_ptr, base_addr[i].addr, entry_ptr)
+        if((i < NUM_PICO_ENTRIES - 16) ? (entry_ptr != NULL) : (entry_ptr != &(base_addr[i].header)))
+            CACHE_ERROR("unexpected result of index search after expunge")
+    } /* end for */
+
+    /* Dirty one of the remaining entries, and destroy them all in a flush */
+    protect_entry(file_ptr, entry_type, NUM_PICO_ENTRIES - 1);
+    if(!pass) CACHE_ERROR("protect_entry failed")
+    unprotect_entry(file_ptr, entry_type, NUM_PICO_ENTRIES - 1, H5C__DIRTIED_FLAG);
+    if(!pass) CACHE_ERROR("unprotect_entry failed")
+
+    flush_cache(file_ptr, TRUE, FALSE, FALSE);
+    if(!pass) CACHE_ERROR("flush_cache failed")
+    if(cache_ptr->index_len != 0)
+        CACHE_ERROR("entries left in index after destroy")
+
+done:
+    takedown_cache(file_ptr, FALSE, FALSE);
+
+    if(pass)
+        PASSED()
+    else {
+        H5_FAILED();
+        HDfprintf(stdout, "%s.\n", failure_mssg);
+    } /* end else */
+
+    return (unsigned)!pass;
+} /* check_index_resize() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	check_slist_sort()
+ *
+ * Purpose:	Verify that entries dirtied out of address order leave the
+ *		slist unsorted, and that H5C__slist_first() sorts it into
+ *		increasing address order with consistent links.
+ *
+ * Return:	0 on success, non-zero on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+#define CSS_NUM_ENTRIES 257
+static unsigned
+check_slist_sort(void)
+{
+    H5F_t * file_ptr = NULL;            /* File for this test */
+    H5C_t * cache_ptr = NULL;           /* Metadata cache for this test */
+    int32_t entry_type = PICO_ENTRY_TYPE; /* Type of entries for test */
+    H5C_cache_entry_t *entry_ptr;       /* Entry on the slist */
+    H5C_cache_entry_t *prev_ptr;        /* Previous entry on the slist */
+    uint32_t count;                     /* # of entries found on the slist */
+    int32_t i;                          /* Local index variable */
+
+    TESTING("metadata cache slist sorting");
+
+    pass = TRUE;
+
+    reset_entries();
+    file_ptr = setup_cache((size_t)(2 * 1024 * 1024), (size_t)(1 * 1024 * 1024));
+    if(!file_ptr) CACHE_ERROR("setup_cache returned NULL")
+    cache_ptr = file_ptr->shared->cache;
+
+    if(!pass) CACHE_ERROR("setup_cache failed")
+    if(!cache_ptr->slist_sorted || cache_ptr->slist_head != NULL)
+        CACHE_ERROR("unexpected initial slist")
+
+    /* Insert dirty entries in increasing address order -- the slist
+     * should stay sorted.
+     */
+    for(i = 0; i < 8; i++) {
+        insert_entry(file_ptr, entry_type, i, H5C__NO_FLAGS_SET);
+        if(!pass) CACHE_ERROR("insert_entry failed")
+    } /* end for */
+    if(!cache_ptr->slist_sorted)
+        CACHE_ERROR("slist unsorted after in order inserts")
+
+    /* Insert the rest in a scrambled order */
+    for(i = 8; i < CSS_NUM_ENTRIES; i++) {
+        insert_entry(file_ptr, entry_type, 8 + (((i - 8) * 97) % (CSS_NUM_ENTRIES - 8)), H5C__NO_FLAGS_SET);
+        if(!pass) CACHE_ERROR("insert_entry failed")
+    } /* end for */
+    if(cache_ptr->slist_sorted)
+        CACHE_ERROR("slist sorted after out of order inserts")
+    if(cache_ptr->slist_len != CSS_NUM_ENTRIES)
+        CACHE_ERROR("unexpected slist length")
+
+    /* Remove a few entries from the middle and ends of the unsorted list */
+    expunge_entry(file_ptr, entry_type, 0);
+    expunge_entry(file_ptr, entry_type, 100);
+    expunge_entry(file_ptr, entry_type, CSS_NUM_ENTRIES - 1);
+    if(!pass) CACHE_ERROR("expunge_entry failed")
+
+    /* Sort the slist and check its order and links */
+    count = 0;
+    prev_ptr = NULL;
+    for(entry_ptr = H5C__slist_first(cache_ptr); entry_ptr != NULL; entry_ptr = entry_ptr->slist_next) {
+        if(!entry_ptr->in_slist || !entry_ptr->is_dirty)
+            CACHE_ERROR("clean entry on slist")
+        if(entry_ptr->slist_prev != prev_ptr)
+            CACHE_ERROR("bad slist prev link")
+        if(prev_ptr && !H5F_addr_lt(prev_ptr->addr, entry_ptr->addr))
+            CACHE_ERROR("slist out of order")
+        prev_ptr = entry_ptr;
+        count++;
+    } /* end for */
+    if(!cache_ptr->slist_sorted)
+        CACHE_ERROR("slist not marked sorted")
+    if(cache_ptr->slist_tail != prev_ptr)
+        CACHE_ERROR("bad slist tail")
+    if(count != cache_ptr->slist_len || count != CSS_NUM_ENTRIES - 3)
+        CACHE_ERROR("unexpected number of entries on slist")
+
+    /* Flush everything -- this empties the slist */
+    flush_cache(file_ptr, FALSE, FALSE, FALSE);
+    if(!pass) CACHE_ERROR("flush_cache failed")
+    if(cache_ptr->slist_len != 0 || cache_ptr->slist_head != NULL || cache_ptr->slist_tail != NULL)
+        CACHE_ERROR("slist not empty after flush")
+
+done:
+    takedown_cache(file_ptr, FALSE, FALSE);
+
+    if(pass)
+        PASSED()
+    else {
+        H5_FAILED();
+        HDfprintf(stdout, "%s.\n", failure_mssg);
+    } /* end else */
+
+    return (unsigned)!pass;
+} /* check_slist_sort() */
+#undef CSS_NUM_ENTRIES
+
 
 /*-------------------------------------------------------------------------
  * Function:	check_metadata_cork
@@ -35365,6 +35724,11 @@ cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t * file_ptr)
  *
  *						JRM -- 11/2/16
  *
+ *		The index is now an open addressing hash table, so there
+ *		are no hash buckets to scan.  Modified the test to verify
+ *		the order of the test entries on the index list instead,
+ *		as this is the list H5C_flush_invalidate_cache() scans.
+ *
  *		Verify that H5C_flush_invalidate_cache() can handle
  *		the removal from the cache of the next item in 
  *		its scans of hash buckets.
@@ -35440,7 +35804,6 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 {
     H5C_t *                    cache_ptr = file_ptr->shared->cache;
     int		               i;
-    int		               expected_hash_bucket = 0;
     herr_t	               result;
     haddr_t                    entry_addr;
     test_entry_t *             entry_ptr;
@@ -35518,26 +35881,11 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
     if(pass) {
 
-        /* verify that the above entries hash to the same bucket */
         base_addr = entries[MONSTER_ENTRY_TYPE];
         entry_ptr = &(base_addr[0]);
         entry_addr = entry_ptr->header.addr;
 
         HDassert(entry_addr == entry_ptr->addr);
-
-        expected_hash_bucket = H5C__HASH_FCN(entry_addr);
-
-        for (i = 8; i <= 24; i += 8) {
-        
-            entry_ptr = &(base_addr[i]);
-            entry_addr = entry_ptr->header.addr;
-
-            if(expected_hash_bucket != H5C__HASH_FCN(entry_addr)) {
-
-                pass = FALSE;
-                failure_mssg = "Test entries don't map to same bucket -- hash table size or hash fcn change?";
-            }
-        }
     }
 
     if(pass) {
@@ -35562,22 +35910,6 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 	unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, 31, H5C__DIRTIED_FLAG);
     }
 
-    if(pass) {
-
-        /* verify that the dirty entry doesn't map to the same 
-         * hash bucket as the clean entries.
-         */
-
-        entry_ptr = &(base_addr[31]);
-        entry_addr = entry_ptr->header.addr;
-
-        if(expected_hash_bucket == H5C__HASH_FCN(entry_addr)) {
-
-            pass = FALSE;
-            failure_mssg = "Dirty entry maps to same hash bucket as clean entries?!?!";
-        }
-    }
-
     if(pass) {
 
 	/* Next, create the flush dependency requiring (MET, 31) to 
@@ -35611,25 +35943,11 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
     if(pass) {
 
-        /* now do some protect / unprotect cycles to force the 
-         * entries into the desired order in the hash bucket.
-         * Recall that entries are moved to the head of the 
-         * hash bucket list on lookup.
-         */
-
-	for (i = 24; i >= 0; i -= 8)
-	{
-	    protect_entry(file_ptr, MONSTER_ENTRY_TYPE, i);
-            unprotect_entry(file_ptr, MONSTER_ENTRY_TYPE, i, H5C__NO_FLAGS_SET);
-	}
-    }
-
-    if(pass) {
-
-        /* scan the hash bucket to verify that the expected entries appear
-         * in the expected order.
+        /* scan the index list to verify that the expected entries appear
+         * in the expected order.  Recall that entries are appended to the
+         * index list on insertion.
          */
-        scan_ptr = cache_ptr->index[expected_hash_bucket];
+        scan_ptr = cache_ptr->il_head;
 
         i = 0;
 
@@ -35640,18 +35958,18 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
             if(scan_ptr == NULL) {
 
                 pass = FALSE;
-                failure_mssg = "premature end of hash bucket list?!?!";
+                failure_mssg = "premature end of index list?!?!";
 
             } else if((scan_ptr == NULL) ||
                         (scan_ptr != &(entry_ptr->header))) {
 
                 pass = FALSE;
-                failure_mssg = "bad test hash bucket setup?!?!";
+                failure_mssg = "bad test index list setup?!?!";
             }
 
             if(pass) {
 
-                scan_ptr = scan_ptr->ht_next;
+                scan_ptr = scan_ptr->il_next;
                 i += 8;
             }
 	}
@@ -35910,7 +36228,7 @@ check_stats__smoke_check_1(H5F_t * file_ptr)
              (cache_ptr->successful_ht_searches != 0) ||
              (cache_ptr->total_successful_ht_search_depth != 0) ||
              (cache_ptr->failed_ht_searches != 32) ||
-             (cache_ptr->total_failed_ht_search_depth != 48) ||
+             (cache_ptr->total_failed_ht_search_depth != 0) ||
              (cache_ptr->max_index_len != 32) ||
              (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
              (cache_ptr->max_clean_index_size != 0) ||
@@ -35993,9 +36311,9 @@ check_stats__smoke_check_1(H5F_t * file_ptr)
         if((cache_ptr->total_ht_insertions != 32) ||
              (cache_ptr->total_ht_deletions != 0) ||
              (cache_ptr->successful_ht_searches != 32) ||
-             (cache_ptr->total_successful_ht_search_depth != 96) ||
+             (cache_ptr->total_successful_ht_search_depth != 0) ||
              (cache_ptr->failed_ht_searches != 32) ||
-             (cache_ptr->total_failed_ht_search_depth != 48) ||
+             (cache_ptr->total_failed_ht_search_depth != 0) ||
              (cache_ptr->max_index_len != 32) ||
              (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
              (cache_ptr->max_clean_index_size != 0) ||
@@ -36078,9 +36396,9 @@ check_stats__smoke_check_1(H5F_t * file_ptr)
         if((cache_ptr->total_ht_insertions != 33) ||
              (cache_ptr->total_ht_deletions != 1) ||
              (cache_ptr->successful_ht_searches != 32) ||
-             (cache_ptr->total_successful_ht_search_depth != 96) ||
+             (cache_ptr->total_successful_ht_search_depth != 0) ||
              (cache_ptr->failed_ht_searches != 33) ||
-             (cache_ptr->total_failed_ht_search_depth != 52) ||
+             (cache_ptr->total_failed_ht_search_depth != 0) ||
              (cache_ptr->max_index_len != 32) ||
              (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
              (cache_ptr->max_clean_index_size != 2 * 1024 * 1024) ||
@@ -36182,9 +36500,9 @@ check_stats__smoke_check_1(H5F_t * file_ptr)
         if((cache_ptr->total_ht_insertions != 33) ||
              (cache_ptr->total_ht_deletions != 33) ||
              (cache_ptr->successful_ht_searches != 33) ||
-             (cache_ptr->total_successful_ht_search_depth != 99) ||
+             (cache_ptr->total_successful_ht_search_depth != 0) ||
              (cache_ptr->failed_ht_searches != 33) ||
-             (cache_ptr->total_failed_ht_search_depth != 52) ||
+             (cache_ptr->total_failed_ht_search_depth != 0) ||
              (cache_ptr->max_index_len != 32) ||
              (cache_ptr->max_index_size != 2 * 1024 * 1024) ||
              (cache_ptr->max_clean_index_size != 2 * 1024 * 1024) ||
@@ -36322,6 +36640,9 @@ main(void)
     nerrs += check_flush_deps_err();
     nerrs += check_flush_deps_order();
     nerrs += check_notify_cb();
+    nerrs += check_coalesced_flush();
+    nerrs += check_index_resize();
+    nerrs += check_slist_sort();
     nerrs += check_metadata_cork(TRUE);
     nerrs += check_metadata_cork(FALSE);
     nerrs += check_entry_deletions_during_scans();
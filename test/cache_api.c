@@ -32,6 +32,7 @@
 
 static hbool_t check_fapl_mdc_api_calls(void);
 static hbool_t check_file_mdc_api_calls(void);
+static hbool_t check_file_mdc_stats_api_calls(void);
 static hbool_t mdc_api_call_smoke_check(int express_test);
 static H5AC_cache_config_t * init_invalid_configs(void);
 static hbool_t check_fapl_mdc_api_errs(void);
@@ -850,6 +851,264 @@ check_file_mdc_api_calls(void)
 
 } /* check_file_mdc_api_calls() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    check_file_mdc_stats_api_calls()
+ *
+ * Purpose:     Verify that the per entry type metadata cache statistics
+ *              API calls are functioning correctly.
+ *
+ *              Create a file containing some groups, close it, reopen
+ *              it, and open the groups.  Verify that the statistics
+ *              reflect the resulting cache misses and loads from file,
+ *              and that H5Freset_mdc_stats() resets the statistics.
+ *
+ * Return:      Test pass status (TRUE/FALSE)
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#define NUM_STATS_GROUPS        16
+
+static hbool_t
+check_file_mdc_stats_api_calls(void)
+{
+    char filename[512];
+    char group_name[64];
+    hid_t file_id = -1;
+    hid_t group_id = -1;
+    ssize_t ntypes = 0;
+    ssize_t result;
+    int i;
+    size_t u;
+    unsigned long long misses = 0;
+    unsigned long long loads = 0;
+    unsigned long long bytes_read = 0;
+    H5AC_cache_type_stats_t * stats = NULL;
+
+    TESTING("MDC/FILE statistics API calls");
+
+    pass = TRUE;
+
+    /* setup the file name */
+    if ( pass ) {
+
+        if ( h5_fixname(FILENAME[1], H5P_DEFAULT, filename, sizeof(filename))
+            == NULL ) {
+
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    /* create the file, and some groups in it */
+    if ( pass ) {
+
+        file_id = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+        if ( file_id < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fcreate() failed.\n";
+        }
+    }
+
+    for ( i = 0; ( pass ) && ( i < NUM_STATS_GROUPS ); i++ ) {
+
+        HDsprintf(group_name, "/group_%d", i);
+
+        group_id = H5Gcreate2(file_id, group_name, H5P_DEFAULT, 
+                              H5P_DEFAULT, H5P_DEFAULT);
+
+        if ( ( group_id < 0 ) || ( H5Gclose(group_id) < 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Gcreate2() or H5Gclose() failed.\n";
+        }
+    }
+
+    /* the number of entry types must not depend on the file */
+    if ( pass ) {
+
+        ntypes = H5Fget_mdc_stats(file_id, (size_t)0, NULL);
+
+        if ( ntypes <= 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_stats() failed 1.\n";
+
+        } else if ( NULL == (stats = (H5AC_cache_type_stats_t *)
+                             HDmalloc((size_t)ntypes * 
+                                      sizeof(H5AC_cache_type_stats_t))) ) {
+
+            pass = FALSE;
+            failure_mssg = "HDmalloc() failed.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    /* reopen the file and open the groups */
+    if ( pass ) {
+
+        file_id = H5Fopen(filename, H5F_ACC_RDONLY, H5P_DEFAULT);
+
+        if ( file_id < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fopen() failed.\n";
+        }
+    }
+
+    for ( i = 0; ( pass ) && ( i < NUM_STATS_GROUPS ); i++ ) {
+
+        HDsprintf(group_name, "/group_%d", i);
+
+        group_id = H5Gopen2(file_id, group_name, H5P_DEFAULT);
+
+        if ( ( group_id < 0 ) || ( H5Gclose(group_id) < 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Gopen2() or H5Gclose() failed.\n";
+        }
+    }
+
+    /* get the statistics, and verify that they are plausible */
+    if ( pass ) {
+
+        result = H5Fget_mdc_stats(file_id, (size_t)ntypes, stats);
+
+        if ( result != ntypes ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_stats() failed 2.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        for ( u = 0; u < (size_t)ntypes; u++ ) {
+
+            if ( ( stats[u].name == NULL ) ||
+                 ( stats[u].flushes != 0 ) ||
+                 ( stats[u].bytes_written != 0 ) ||
+                 ( stats[u].deserialize_time < 0.0f ) ) {
+
+                pass = FALSE;
+                failure_mssg = "unexpected per type statistics.\n";
+            }
+
+            misses += stats[u].misses;
+            loads += stats[u].loads;
+            bytes_read += stats[u].bytes_read;
+        }
+    }
+
+    if ( pass ) {
+
+        if ( ( misses == 0 ) || ( loads == 0 ) || ( bytes_read == 0 ) ) {
+
+            pass = FALSE;
+            failure_mssg = "no cache misses or loads reported.\n";
+
+        } else if ( loads < misses ) {
+
+            pass = FALSE;
+            failure_mssg = "fewer loads than misses reported.\n";
+        }
+    }
+
+    /* reset the statistics, and verify that they are zero */
+    if ( pass ) {
+
+        if ( H5Freset_mdc_stats(file_id) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Freset_mdc_stats() failed.\n";
+
+        } else if ( H5Fget_mdc_stats(file_id, (size_t)ntypes, stats) 
+                    != ntypes ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_stats() failed 3.\n";
+        }
+    }
+
+    if ( pass ) {
+
+        for ( u = 0; u < (size_t)ntypes; u++ ) {
+
+            if ( ( stats[u].hits != 0 ) ||
+                 ( stats[u].misses != 0 ) ||
+                 ( stats[u].loads != 0 ) ||
+                 ( stats[u].evictions != 0 ) ||
+                 ( stats[u].bytes_read != 0 ) ||
+                 ( !H5_DBL_ABS_EQUAL(stats[u].deserialize_time, 0.0f) ) ) {
+
+                pass = FALSE;
+                failure_mssg = "statistics not reset.\n";
+            }
+        }
+    }
+
+    /* verify that a bad file id is rejected */
+    if ( pass ) {
+
+        H5E_BEGIN_TRY {
+            result = H5Fget_mdc_stats((hid_t)-1, (size_t)ntypes, stats);
+        } H5E_END_TRY;
+
+        if ( result >= 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fget_mdc_stats() accepted bad file_id.\n";
+        }
+    }
+
+    /* close the file and delete it */
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+
+        } else if ( HDremove(filename) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    if ( stats != NULL )
+        HDfree(stats);
+
+    if ( pass ) {
+
+        PASSED();
+
+    } else {
+
+        H5_FAILED();
+    }
+
+    if ( ! pass ) {
+        
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n", FUNC, failure_mssg);
+    }
+
+    return pass;
+
+} /* check_file_mdc_stats_api_calls() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	mdc_api_call_smoke_check()
@@ -2299,6 +2558,11 @@ main(void)
         nerrs += 1;
     }
 
+    if ( !check_file_mdc_stats_api_calls() ) {
+
+        nerrs += 1;
+    }
+
     if ( !mdc_api_call_smoke_check(express_test) ) {
 
         nerrs += 1;
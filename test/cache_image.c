@@ -30,6 +30,9 @@ const char *FILENAMES[] = {
         NULL
 };
 
+/* Whether open_hdf5_file() requests compressed cache images */
+static hbool_t compress_cache_image = FALSE;
+
 /* local utility function declarations */
 static void create_datasets(hid_t file_id, int min_dset, int max_dset);
 static void delete_datasets(hid_t file_id, int min_dset, int max_dset);
@@ -55,6 +58,7 @@ static unsigned cache_image_smoke_check_3(void);
 static unsigned cache_image_smoke_check_4(void);
 static unsigned cache_image_smoke_check_5(void);
 static unsigned cache_image_smoke_check_6(void);
+static unsigned cache_image_smoke_check_7(void);
 
 static unsigned cache_image_api_error_check_1(void);
 static unsigned cache_image_api_error_check_2(void);
@@ -550,7 +554,8 @@ open_hdf5_file(hbool_t create_file, hbool_t mdci_sbem_expected,
         H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION,
         TRUE,
         FALSE,
-        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE};
+        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE,
+        FALSE};
 
     if ( pass )
     {
@@ -623,7 +628,8 @@ open_hdf5_file(hbool_t create_file, hbool_t mdci_sbem_expected,
              ( cache_image_config.generate_image != FALSE ) ||
              ( cache_image_config.save_resize_status != FALSE ) ||
              ( cache_image_config.entry_ageout != 
-               H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE ) ) {
+               H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE ) ||
+             ( cache_image_config.compress_image != FALSE ) ) {
 
             pass = FALSE;
             failure_mssg = "Unexpected default cache image config.\n";
@@ -639,6 +645,7 @@ open_hdf5_file(hbool_t create_file, hbool_t mdci_sbem_expected,
         cache_image_config.generate_image = TRUE;
         cache_image_config.save_resize_status = FALSE;
         cache_image_config.entry_ageout = H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE;
+        cache_image_config.compress_image = compress_cache_image;
 
         result = H5Pset_mdc_image_config(fapl_id, &cache_image_config);
 
@@ -907,7 +914,8 @@ attempt_swmr_open_hdf5_file(const hbool_t create_file,
         H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION,
         TRUE,
         FALSE,
-        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE};
+        H5AC__CACHE_IMAGE__ENTRY_AGEOUT__NONE,
+        FALSE};
 
     /* create a file access propertly list. */
     if ( pass ) {
@@ -5393,6 +5401,297 @@ cache_image_smoke_check_6(void)
 
 } /* cache_image_smoke_check_6() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    cache_image_smoke_check_7()
+ *
+ * Purpose:     Verify that the images of prefetched entries are extracted
+ *		from the compressed cache image blocks on demand, rather 
+ *		than all at once when the cache image is loaded, and that
+ *		each block is discarded once all images in it have been
+ *		extracted.
+ *
+ *		Do this as follows:
+ *
+ *		1) Create a HDF5 file with the cache image FAPL entry,
+ *		   requesting a compressed cache image.
+ *
+ *		2) Create some datasets in the file.
+ *
+ *		3) Close the file.
+ *
+ *		4) Open the file read only, and verify the contents of 
+ *		   the first dataset.  This forces the load of the cache
+ *		   image.
+ *
+ *		   Verify that at least some of the prefetched entries 
+ *		   have not yet had their images extracted.  Verify that
+ *		   the count of such entries maintained by the cache 
+ *		   matches the number of such entries in the index.
+ *
+ *		5) Verify the contents of the remaining datasets.
+ *
+ *		   Verify that the number of prefetched entries whose
+ *		   images have not been extracted has decreased, and that
+ *		   it still matches the count maintained by the cache.
+ *		   Verify that only the blocks holding pending images 
+ *		   are retained.
+ *
+ *		6) Close the file.
+ *
+ *		7) Delete the file.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+
+static unsigned
+cache_image_smoke_check_7(void)
+{
+    const char * fcn_name = "cache_image_smoke_check_7()";
+    char filename[512];
+    hbool_t show_progress = FALSE;
+    hid_t file_id = -1;
+    H5F_t *file_ptr = NULL;
+    H5C_t *cache_ptr = NULL;
+    H5C_cache_entry_t *entry_ptr;
+    uint32_t initial_pending = 0;
+    uint32_t pending;
+    uint32_t u;
+    int cp = 0;
+
+    TESTING("metadata cache image smoke check 7");
+
+#ifndef H5_HAVE_FILTER_DEFLATE
+    /* Without the deflate filter, uncompressed version 0 cache images
+     * are written, and their entry images are loaded eagerly.
+     */
+    SKIPPED();
+    HDputs("    Deflate filter not enabled");
+    return 0;
+#else /* H5_HAVE_FILTER_DEFLATE */
+    pass = TRUE;
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* setup the file name */
+    if ( pass ) {
+
+        if ( h5_fixname(FILENAMES[0], H5P_DEFAULT, filename, sizeof(filename))
+            == NULL ) {
+
+            pass = FALSE;
+            failure_mssg = "h5_fixname() failed.\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+
+    /* 1) Create a HDF5 file with the cache image FAPL entry, requesting
+     *    a compressed cache image.
+     */
+
+    if ( pass ) {
+
+        compress_cache_image = TRUE;
+
+        open_hdf5_file(/* create_file        */ TRUE,
+                       /* mdci_sbem_expected */ FALSE,
+                       /* read_only          */ FALSE,
+                       /* set_mdci_fapl      */ TRUE,
+		       /* config_fsm         */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ H5C_CI__ALL_FLAGS,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+
+        compress_cache_image = FALSE;
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+ 
+    /* 2) Create some datasets in the file. */
+
+    if ( pass ) {
+
+        create_datasets(file_id, 0, 10);
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+ 
+ 
+    /* 3) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+ 
+ 
+    /* 4) Open the file read only, and verify the contents of the 
+     *    first dataset.
+     *
+     *    Verify that some prefetched entries have not yet had their
+     *    images extracted from the cache image.
+     */
+
+    if ( pass ) {
+
+        open_hdf5_file(/* create_file        */ FALSE,
+		       /* mdci_sbem_expected */ TRUE,
+                       /* read_only          */ TRUE,
+                       /* set_mdci_fapl      */ FALSE,
+		       /* config_fsm         */ FALSE,
+                       /* hdf_file_name      */ filename,
+                       /* cache_image_flags  */ 0,
+                       /* file_id_ptr        */ &file_id,
+                       /* file_ptr_ptr       */ &file_ptr,
+                       /* cache_ptr_ptr      */ &cache_ptr);
+    }
+
+    if ( pass ) {
+
+       verify_datasets(file_id, 0, 0);
+    }
+
+    if ( pass ) {
+
+        initial_pending = 0;
+        entry_ptr = cache_ptr->il_head;
+
+        while ( entry_ptr != NULL ) {
+
+            if ( ( entry_ptr->prefetched ) && ( entry_ptr->pf_image_pending ) )
+                initial_pending++;
+
+            entry_ptr = entry_ptr->il_next;
+        }
+
+        if ( initial_pending == 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "no prefetched entries with pending images.\n";
+
+        } else if ( initial_pending != cache_ptr->pf_pending ) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected pf_pending (1).\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+ 
+ 
+    /* 5) Verify the contents of the remaining datasets.
+     *
+     *    Verify that the number of pending prefetched entry images 
+     *    has decreased.
+     */
+
+    if ( pass ) {
+
+       verify_datasets(file_id, 1, 10);
+    }
+
+    if ( pass ) {
+
+        pending = 0;
+        entry_ptr = cache_ptr->il_head;
+
+        while ( entry_ptr != NULL ) {
+
+            if ( ( entry_ptr->prefetched ) && ( entry_ptr->pf_image_pending ) )
+                pending++;
+
+            entry_ptr = entry_ptr->il_next;
+        }
+
+        if ( pending >= initial_pending ) {
+
+            pass = FALSE;
+            failure_mssg = "pending prefetched entry images not extracted.\n";
+
+        } else if ( pending != cache_ptr->pf_pending ) {
+
+            pass = FALSE;
+            failure_mssg = "unexpected pf_pending (2).\n";
+        }
+    }
+
+    if ( ( pass ) && ( cache_ptr->pf_pending > 0 ) ) {
+
+        for ( u = 0; u < cache_ptr->pf_num_blocks; u++ ) {
+
+            if ( ( cache_ptr->pf_blocks[u].pending > 0 ) !=
+                 ( cache_ptr->pf_blocks[u].image != NULL ) ) {
+
+                pass = FALSE;
+                failure_mssg = "unexpected retained cache image block.\n";
+            }
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+ 
+
+    /* 6) Close the file. */
+
+    if ( pass ) {
+
+        if ( H5Fclose(file_id) < 0  ) {
+
+            pass = FALSE;
+            failure_mssg = "H5Fclose() failed.\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+ 
+
+    /* 7) Delete the file */
+
+    if ( pass ) {
+
+        if ( HDremove(filename) < 0 ) {
+
+            pass = FALSE;
+            failure_mssg = "HDremove() failed.\n";
+        }
+    }
+
+    if ( show_progress ) 
+        HDfprintf(stdout, "%s: cp = %d, pass = %d.\n", fcn_name, cp++, pass);
+
+    if ( pass ) { PASSED(); } else { H5_FAILED(); }
+
+    if ( ! pass )
+        HDfprintf(stdout, "%s: failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+
+    return !pass;
+#endif /* H5_HAVE_FILTER_DEFLATE */
+
+} /* cache_image_smoke_check_7() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    cache_image_api_error_check_1()
@@ -6485,6 +6784,7 @@ main(void)
     nerrs += cache_image_smoke_check_4();
     nerrs += cache_image_smoke_check_5();
     nerrs += cache_image_smoke_check_6();
+    nerrs += cache_image_smoke_check_7();
 
     nerrs += cache_image_api_error_check_1();
     nerrs += cache_image_api_error_check_2();
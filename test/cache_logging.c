@@ -18,6 +18,7 @@
 #include "h5test.h"
 
 #define LOG_LOCATION "cache_logging.out"
+#define TRACE_LOCATION "cache_logging.trace"
 #define FILE_NAME    "cache_logging"
 
 #define N_GROUPS 100
@@ -143,6 +144,122 @@ error:
     return 1;
  } /* test_logging_api() */
 
+/*-------------------------------------------------------------------------
+ * Function:    test_logging_binary
+ *
+ * Purpose:     Tests the binary trace format of mdc logging
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_logging_binary(void)
+{
+    hid_t       fapl = -1;
+    H5AC_log_format_t format;
+    unsigned    sample_interval;
+    herr_t      ret;
+
+    hid_t       fid = -1;
+    hid_t       gid;
+    char        group_name[8];
+    char        filename[1024];
+    FILE        *fp = NULL;
+    unsigned char header[16];
+    unsigned char record[24];
+    size_t      nrecords;
+    int         i;
+
+    TESTING("metadata cache binary trace");
+
+    fapl = h5_fileaccess();
+    h5_fixname(FILE_NAME, fapl, filename, sizeof filename);
+
+    /* Check the default format */
+    if(H5Pget_mdc_log_format(fapl, &format, &sample_interval) < 0)
+        TEST_ERROR;
+    if(format != H5AC_LOG_FORMAT_JSON || sample_interval != 1)
+        TEST_ERROR;
+
+    /* Bad arguments should fail */
+    H5E_BEGIN_TRY {
+        ret = H5Pset_mdc_log_format(fapl, H5AC_LOG_FORMAT_BINARY, 0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_mdc_log_format(fapl, (H5AC_log_format_t)99, 1);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        TEST_ERROR;
+
+    /* Set up binary metadata cache logging */
+    if(H5Pset_mdc_log_options(fapl, TRUE, TRACE_LOCATION, FALSE) < 0)
+        TEST_ERROR;
+    if(H5Pset_mdc_log_format(fapl, H5AC_LOG_FORMAT_BINARY, 1) < 0)
+        TEST_ERROR;
+    if(H5Pget_mdc_log_format(fapl, &format, &sample_interval) < 0)
+        TEST_ERROR;
+    if(format != H5AC_LOG_FORMAT_BINARY || sample_interval != 1)
+        TEST_ERROR;
+
+    /* Create a file and perform some logged manipulations */
+    if(H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        TEST_ERROR;
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    if(H5Fstart_mdc_logging(fid) < 0)
+        TEST_ERROR;
+    for(i = 0; i < N_GROUPS; i++) {
+        HDmemset(group_name, 0, 8);
+        HDsnprintf(group_name, 8, "%d", i);
+        if((gid = H5Gcreate2(fid, group_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if(H5Gclose(gid) < 0)
+            TEST_ERROR;
+    }
+
+    /* Stopping logging writes out the buffered records */
+    if(H5Fstop_mdc_logging(fid) < 0)
+        TEST_ERROR;
+
+    /* Check the header and records of the trace */
+    if(NULL == (fp = HDfopen(TRACE_LOCATION, "rb")))
+        TEST_ERROR;
+    if(1 != HDfread(header, sizeof(header), (size_t)1, fp))
+        TEST_ERROR;
+    if(HDmemcmp(header, "HDF5MDCT", (size_t)8)
+            || header[8] != 1 || header[9] || header[10] || header[11]
+            || header[12] != 1 || header[13] || header[14] || header[15])
+        TEST_ERROR;
+    nrecords = 0;
+    while(1 == HDfread(record, sizeof(record), (size_t)1, fp)) {
+        /* Operation codes are 1 (insert) to 12 (evict) */
+        if(record[0] < 1 || record[0] > 12)
+            TEST_ERROR;
+        nrecords++;
+    }
+    if(!HDfeof(fp) || nrecords == 0)
+        TEST_ERROR;
+    if(HDfclose(fp) < 0)
+        TEST_ERROR;
+    fp = NULL;
+
+    if(H5Fclose(fid) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    if(fp)
+        HDfclose(fp);
+    return 1;
+ } /* test_logging_binary() */
+
 /*-------------------------------------------------------------------------
  * Function:    main
  *
@@ -164,6 +281,7 @@ main(void)
     printf("Testing basic metadata cache logging functionality.\n");
 
     nerrors += test_logging_api();
+    nerrors += test_logging_binary();
 
     if(nerrors) {
         printf("***** %d Metadata cache logging TEST%s FAILED! *****\n",
@@ -0,0 +1,1160 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *		This file contains a replay tool for binary metadata cache
+ *		traces (see H5Pset_mdc_log_format()), and its tests.
+ *
+ *		The records of a trace are fed through a standalone instance
+ *		of H5C, whose entries stand in for the traced entries with
+ *		their recorded types, addresses and sizes, but are never
+ *		read from or written to file.  Replaying a trace with
+ *		different cache sizes shows how the cache would have
+ *		behaved for the traced workload.
+ *
+ *		Usage:
+ *
+ *		    cache_replay [-c min_clean_fraction] [-s cache_size]...
+ *		                 trace_file
+ *
+ *		replays trace_file once for each cache size given, and
+ *		reports the protects, hit rate, misses and evictions of
+ *		each replay.  When the trace was sampled, the cache sizes
+ *		are divided by the sample interval.  Without arguments,
+ *		the tests of the tool are run.
+ */
+
+#define H5C_FRIEND		/*suppress error about including H5Cpkg   */
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+
+/* Include library header files */
+#include "H5ACprivate.h"
+#include "H5Cpkg.h"
+#include "H5Fpkg.h"
+#include "H5Iprivate.h"
+#include "H5SLprivate.h"
+
+/* Include test header files */
+#include "h5test.h"
+
+const char *FILENAME[] = {
+    "cache_replay",
+    NULL
+};
+
+#define TRACE_NAME              "cache_replay.trace"
+#define SAMPLED_TRACE_NAME      "cache_replay_sampled.trace"
+#define MOVES_TRACE_NAME        "cache_replay_moves.trace"
+
+#define N_GROUPS                200
+#define N_PASSES                3
+
+/* Default cache sizes to replay with, when none are given */
+#define N_DEF_CACHE_SIZES       4
+static const size_t def_cache_sizes_g[N_DEF_CACHE_SIZES] = {
+    (size_t)(16 * 1024),
+    (size_t)(256 * 1024),
+    (size_t)(2 * 1024 * 1024),
+    (size_t)(32 * 1024 * 1024)
+};
+
+#define MAX_CACHE_SIZES         32
+
+/* Unprotect and insert flags kept by the replay */
+#define REPLAY_UNPROTECT_FLAGS  (H5C__DIRTIED_FLAG | H5C__DELETED_FLAG | \
+                                 H5C__PIN_ENTRY_FLAG | H5C__UNPIN_ENTRY_FLAG)
+#define REPLAY_INSERT_FLAGS     (H5C__PIN_ENTRY_FLAG)
+
+/* A decoded trace record */
+typedef struct replay_record_t {
+    unsigned    op;                     /* H5C__TRACE_OP_* */
+    int         type_id;                /* Client type of the entry */
+    unsigned    flags;                  /* Flags of the operation */
+    size_t      size;                   /* Size of the entry */
+    haddr_t     addr;                   /* Address of the entry */
+    haddr_t     new_addr;               /* New address, for moves */
+} replay_record_t;
+
+/* A decoded trace */
+typedef struct replay_trace_t {
+    unsigned    sample_interval;        /* Sampling interval of the trace */
+    size_t      nrecords;               /* Number of records */
+    replay_record_t *records;           /* Records, in trace order */
+} replay_trace_t;
+
+/* Cache entry standing in for a traced entry */
+typedef struct replay_entry_t {
+    H5C_cache_entry_t cache_info;       /* Must be first */
+    haddr_t     addr;                   /* Key in the entry map */
+    size_t      size;                   /* Current size of the entry */
+} replay_entry_t;
+
+/* User data for loading a replay entry */
+typedef struct replay_udata_t {
+    haddr_t     addr;                   /* Address of the entry */
+    size_t      size;                   /* Size of the entry */
+} replay_udata_t;
+
+/* Results of a replay */
+typedef struct replay_stats_t {
+    size_t      max_cache_size;         /* Cache size replayed with */
+    unsigned long long protects;        /* Protects replayed */
+    unsigned long long hits;            /* Protects of resident entries */
+    unsigned long long misses;          /* Protects of absent entries */
+    unsigned long long evictions;       /* Entries evicted by the cache */
+    unsigned long long skipped;         /* Records inconsistent with the replay */
+} replay_stats_t;
+
+/* Cache client callbacks */
+static herr_t replay_get_initial_load_size(void *udata, size_t *image_len);
+static void *replay_deserialize(const void *image, size_t len, void *udata,
+    hbool_t *dirty);
+static herr_t replay_image_len(const void *thing, size_t *image_len);
+static herr_t replay_serialize(const H5F_t *f, void *image, size_t len,
+    void *thing);
+static herr_t replay_free_icr(void *thing);
+
+/* Replay routines */
+static int read_trace(const char *name, replay_trace_t *trace);
+static int replay_trace(hid_t fid, const replay_trace_t *trace,
+    size_t max_cache_size, double min_clean_fraction, replay_stats_t *stats);
+static int write_trace(const char *filename, hid_t fapl, const char *trace_name,
+    unsigned sample_interval);
+
+/* Entry classes, one for each client type of the library */
+static H5C_class_t replay_classes_g[H5AC_NTYPES];
+static const H5C_class_t *replay_class_table_g[H5AC_NTYPES];
+
+/* Map from address to replay entry for the entries in the cache */
+static H5SL_t *replay_entries_g = NULL;
+
+/* Number of entries evicted by the cache to make space during the
+ * current replay, and whether entries freed now are such evictions.
+ */
+static unsigned long long replay_evictions_g = 0;
+static hbool_t replay_making_space_g = FALSE;
+
+
+/*-------------------------------------------------------------------------
+ * Function:	replay_get_initial_load_size
+ *
+ * Purpose:	Report the recorded size of the entry to load.
+ *
+ * Return:	SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+replay_get_initial_load_size(void *_udata, size_t *image_len)
+{
+    replay_udata_t *udata = (replay_udata_t *)_udata;
+
+    HDassert(udata);
+    HDassert(image_len);
+
+    *image_len = udata->size;
+
+    return(SUCCEED);
+} /* replay_get_initial_load_size() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	replay_deserialize
+ *
+ * Purpose:	Create a replay entry for an entry loaded by the cache, and
+ *		add it to the entry map.
+ *
+ * Return:	Pointer to the new entry on success, NULL on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+replay_deserialize(const void H5_ATTR_UNUSED *image, size_t len, void *_udata,
+    hbool_t *dirty)
+{
+    replay_udata_t *udata = (replay_udata_t *)_udata;
+    replay_entry_t *entry;
+
+    HDassert(udata);
+    HDassert(dirty);
+
+    if(NULL == (entry = (replay_entry_t *)HDcalloc((size_t)1, sizeof(replay_entry_t))))
+        return(NULL);
+    entry->addr = udata->addr;
+    entry->size = len;
+
+    if(H5SL_insert(replay_entries_g, entry, &entry->addr) < 0) {
+        HDfree(entry);
+        return(NULL);
+    } /* end if */
+
+    *dirty = FALSE;
+
+    return(entry);
+} /* replay_deserialize() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	replay_image_len
+ *
+ * Purpose:	Report the current size of a replay entry.
+ *
+ * Return:	SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+replay_image_len(const void *thing, size_t *image_len)
+{
+    const replay_entry_t *entry = (const replay_entry_t *)thing;
+
+    HDassert(entry);
+    HDassert(image_len);
+
+    *image_len = entry->size;
+
+    return(SUCCEED);
+} /* replay_image_len() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	replay_serialize
+ *
+ * Purpose:	Replay entries have no image, as they are never written.
+ *
+ * Return:	SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+replay_serialize(const H5F_t H5_ATTR_UNUSED *f, void *image, size_t len,
+    void H5_ATTR_UNUSED *thing)
+{
+    HDmemset(image, 0, len);
+
+    return(SUCCEED);
+} /* replay_serialize() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	replay_free_icr
+ *
+ * Purpose:	Remove a replay entry leaving the cache from the entry map,
+ *		and free it.
+ *
+ * Return:	SUCCEED
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+replay_free_icr(void *thing)
+{
+    replay_entry_t *entry = (replay_entry_t *)thing;
+
+    HDassert(entry);
+
+    H5SL_remove(replay_entries_g, &entry->addr);
+    HDfree(entry);
+    if(replay_making_space_g)
+        replay_evictions_g++;
+
+    return(SUCCEED);
+} /* replay_free_icr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	read_trace
+ *
+ * Purpose:	Read and decode a binary metadata cache trace.
+ *
+ * Return:	0 on success, -1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+read_trace(const char *name, replay_trace_t *trace)
+{
+    FILE *fp = NULL;
+    uint8_t header[H5C__TRACE_HEADER_SIZE];
+    uint8_t buf[H5C__TRACE_RECORD_SIZE];
+    const uint8_t *p;
+    size_t nalloc = 0;
+    unsigned version;
+
+    HDmemset(trace, 0, sizeof(*trace));
+
+    if(NULL == (fp = HDfopen(name, "rb"))) {
+        HDfprintf(stderr, "can't open trace file '%s'\n", name);
+        goto error;
+    } /* end if */
+
+    /* Check the header */
+    if(1 != HDfread(header, sizeof(header), (size_t)1, fp)
+            || HDmemcmp(header, H5C__TRACE_SIGNATURE, (size_t)H5C__TRACE_SIGNATURE_LEN)) {
+        HDfprintf(stderr, "'%s' is not a metadata cache trace\n", name);
+        goto error;
+    } /* end if */
+    p = header + H5C__TRACE_SIGNATURE_LEN;
+    UINT32DECODE(p, version);
+    UINT32DECODE(p, trace->sample_interval);
+    if(version != H5C__TRACE_VERSION || trace->sample_interval == 0) {
+        HDfprintf(stderr, "unsupported trace version or sample interval\n");
+        goto error;
+    } /* end if */
+
+    /* Decode the records */
+    while(1 == HDfread(buf, sizeof(buf), (size_t)1, fp)) {
+        replay_record_t *rec;
+        uint64_t addr;
+        uint32_t size;
+
+        if(trace->nrecords == nalloc) {
+            replay_record_t *tmp;
+
+            nalloc = nalloc ? 2 * nalloc : 4096;
+            if(NULL == (tmp = (replay_record_t *)HDrealloc(trace->records, nalloc * sizeof(replay_record_t))))
+                goto error;
+            trace->records = tmp;
+        } /* end if */
+        rec = &trace->records[trace->nrecords++];
+
+        p = buf;
+        rec->op = *p++;
+        rec->type_id = *p++;
+        UINT16DECODE(p, rec->flags);
+        UINT32DECODE(p, size);
+        rec->size = (size_t)size;
+        UINT64DECODE(p, addr);
+        rec->addr = (haddr_t)addr;
+        UINT64DECODE(p, addr);
+        rec->new_addr = (haddr_t)addr;
+
+        if(rec->op < H5C__TRACE_OP_INSERT || rec->op > H5C__TRACE_OP_EVICT) {
+            HDfprintf(stderr, "bad operation in trace record %lu\n", (unsigned long)(trace->nrecords - 1));
+            goto error;
+        } /* end if */
+    } /* end while */
+
+    HDfclose(fp);
+
+    return 0;
+
+error:
+    if(fp)
+        HDfclose(fp);
+    if(trace->records)
+        HDfree(trace->records);
+    HDmemset(trace, 0, sizeof(*trace));
+
+    return -1;
+} /* read_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	replay_trace
+ *
+ * Purpose:	Replay a trace through a standalone cache of the given
+ *		size, using the file fid as the cache's file.
+ *
+ *		Records that are inconsistent with the state of the replay
+ *		cache are skipped and counted.  They can occur when
+ *		logging was started while entries were already protected
+ *		or pinned, or when the trace was sampled.  Moves and
+ *		expunges of entries the replay cache has already evicted
+ *		are not inconsistent, and are simply dropped.
+ *
+ * Return:	0 on success, -1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+replay_trace(hid_t fid, const replay_trace_t *trace, size_t max_cache_size,
+    double min_clean_fraction, replay_stats_t *stats)
+{
+    H5F_t *f;
+    H5C_t *saved_cache = NULL;
+    H5C_t *cache_ptr = NULL;
+    hid_t dxpl_id = H5AC_ind_read_dxpl_id;
+    size_t u;
+
+    HDmemset(stats, 0, sizeof(*stats));
+    stats->max_cache_size = max_cache_size;
+    replay_evictions_g = 0;
+
+    if(NULL == (f = (H5F_t *)H5I_object_verify(fid, H5I_FILE)))
+        goto error;
+    if(NULL == (replay_entries_g = H5SL_create(H5SL_TYPE_HADDR, NULL)))
+        goto error;
+
+    /* Swap in a standalone cache for the file, as setup_cache() does */
+    saved_cache = f->shared->cache;
+    f->shared->cache = NULL;
+    if(NULL == (cache_ptr = H5C_create(max_cache_size,
+            (size_t)((double)max_cache_size * min_clean_fraction),
+            (H5AC_NTYPES - 1), replay_class_table_g, NULL, TRUE, NULL, NULL)))
+        goto error;
+    f->shared->cache = cache_ptr;
+    cache_ptr->ignore_tags = TRUE;
+
+    for(u = 0; u < trace->nrecords; u++) {
+        const replay_record_t *rec = &trace->records[u];
+        const H5C_class_t *type;
+        replay_entry_t *entry;
+
+        if(rec->type_id >= H5AC_NTYPES) {
+            stats->skipped++;
+            continue;
+        } /* end if */
+        type = replay_class_table_g[rec->type_id];
+        entry = (replay_entry_t *)H5SL_search(replay_entries_g, &rec->addr);
+
+        switch(rec->op) {
+            case H5C__TRACE_OP_INSERT:
+                if(entry || rec->size == 0 || rec->size > H5C_MAX_ENTRY_SIZE)
+                    stats->skipped++;
+                else {
+                    if(NULL == (entry = (replay_entry_t *)HDcalloc((size_t)1, sizeof(replay_entry_t))))
+                        goto error;
+                    entry->addr = rec->addr;
+                    entry->size = rec->size;
+                    if(H5SL_insert(replay_entries_g, entry, &entry->addr) < 0) {
+                        HDfree(entry);
+                        goto error;
+                    } /* end if */
+                    replay_making_space_g = TRUE;
+                    if(H5C_insert_entry(f, dxpl_id, type, rec->addr, entry, rec->flags & REPLAY_INSERT_FLAGS) < 0)
+                        goto error;
+                    replay_making_space_g = FALSE;
+                } /* end else */
+                break;
+
+            case H5C__TRACE_OP_PROTECT:
+                {
+                    unsigned flags = rec->flags & H5C__READ_ONLY_FLAG;
+
+                    if(rec->size == 0 || rec->size > H5C_MAX_ENTRY_SIZE
+                            || (entry && (entry->cache_info.type->id != rec->type_id
+                                || (entry->cache_info.is_protected
+                                    && !(entry->cache_info.is_read_only && flags))))) {
+                        stats->skipped++;
+                        break;
+                    } /* end if */
+
+                    stats->protects++;
+                    if(entry)
+                        stats->hits++;
+                    else {
+                        replay_udata_t udata;
+
+                        stats->misses++;
+                        udata.addr = rec->addr;
+                        udata.size = rec->size;
+                        replay_making_space_g = TRUE;
+                        if(NULL == H5C_protect(f, dxpl_id, type, rec->addr, &udata, flags))
+                            goto error;
+                        replay_making_space_g = FALSE;
+                        break;
+                    } /* end else */
+
+                    if(NULL == H5C_protect(f, dxpl_id, type, rec->addr, NULL, flags))
+                        goto error;
+                }
+                break;
+
+            case H5C__TRACE_OP_UNPROTECT:
+                {
+                    unsigned flags = rec->flags & REPLAY_UNPROTECT_FLAGS;
+
+                    if(NULL == entry || !entry->cache_info.is_protected) {
+                        stats->skipped++;
+                        break;
+                    } /* end if */
+
+                    /* Keep the pin state of the entry consistent */
+                    if(entry->cache_info.is_read_only)
+                        flags &= ~(unsigned)(H5C__DIRTIED_FLAG | H5C__DELETED_FLAG);
+                    if(entry->cache_info.is_pinned)
+                        flags &= ~(unsigned)H5C__PIN_ENTRY_FLAG;
+                    else
+                        flags &= ~(unsigned)H5C__UNPIN_ENTRY_FLAG;
+                    if((flags & H5C__DELETED_FLAG) && entry->cache_info.is_pinned)
+                        flags |= H5C__UNPIN_ENTRY_FLAG;
+
+                    if(H5C_unprotect(f, dxpl_id, rec->addr, entry, flags) < 0)
+                        goto error;
+                }
+                break;
+
+            case H5C__TRACE_OP_MARK_DIRTY:
+                if(NULL == entry || entry->cache_info.is_read_only
+                        || !(entry->cache_info.is_protected || entry->cache_info.is_pinned))
+                    stats->skipped++;
+                else if(H5C_mark_entry_dirty(entry) < 0)
+                    goto error;
+                break;
+
+            case H5C__TRACE_OP_PIN:
+                if(NULL == entry || !entry->cache_info.is_protected || entry->cache_info.is_pinned)
+                    stats->skipped++;
+                else if(H5C_pin_protected_entry(entry) < 0)
+                    goto error;
+                break;
+
+            case H5C__TRACE_OP_UNPIN:
+                if(NULL == entry || !entry->cache_info.is_pinned)
+                    stats->skipped++;
+                else if(H5C_unpin_entry(entry) < 0)
+                    goto error;
+                break;
+
+            case H5C__TRACE_OP_RESIZE:
+                if(NULL == entry || rec->size == 0 || rec->size > H5C_MAX_ENTRY_SIZE
+                        || entry->cache_info.is_read_only
+                        || !(entry->cache_info.is_protected || entry->cache_info.is_pinned))
+                    stats->skipped++;
+                else {
+                    entry->size = rec->size;
+                    replay_making_space_g = TRUE;
+                    if(H5C_resize_entry(entry, rec->size) < 0)
+                        goto error;
+                    replay_making_space_g = FALSE;
+                } /* end else */
+                break;
+
+            case H5C__TRACE_OP_MOVE:
+                if(NULL == entry)
+                    break;
+                if(entry->cache_info.is_read_only
+                        || NULL != H5SL_search(replay_entries_g, &rec->new_addr)) {
+                    stats->skipped++;
+                    break;
+                } /* end if */
+                if(H5C_move_entry(cache_ptr, type, rec->addr, rec->new_addr) < 0)
+                    goto error;
+                H5SL_remove(replay_entries_g, &entry->addr);
+                entry->addr = rec->new_addr;
+                if(H5SL_insert(replay_entries_g, entry, &entry->addr) < 0)
+                    goto error;
+                break;
+
+            case H5C__TRACE_OP_EXPUNGE:
+            case H5C__TRACE_OP_REMOVE:
+                /* Removed entries are expunged, as the replay doesn't
+                 * track whether the entry was clean in the traced cache.
+                 */
+                if(NULL == entry)
+                    break;
+                if(entry->cache_info.is_protected || entry->cache_info.is_pinned) {
+                    stats->skipped++;
+                    break;
+                } /* end if */
+                if(H5C_expunge_entry(f, dxpl_id, entry->cache_info.type, rec->addr, H5C__NO_FLAGS_SET) < 0)
+                    goto error;
+                break;
+
+            case H5C__TRACE_OP_FLUSH:
+                if(cache_ptr->pl_len > 0)
+                    stats->skipped++;
+                else if(H5C_flush_cache(f, dxpl_id, H5C__NO_FLAGS_SET) < 0)
+                    goto error;
+                break;
+
+            case H5C__TRACE_OP_EVICT:
+                if(cache_ptr->pl_len > 0)
+                    stats->skipped++;
+                else if(H5C_evict(f, dxpl_id) < 0)
+                    goto error;
+                break;
+
+            default:
+                HDassert(0 && "unknown trace operation");
+                goto error;
+        } /* end switch */
+    } /* end for */
+
+    stats->evictions = replay_evictions_g;
+
+    /* Release the entries still protected at the end of the trace */
+    while(cache_ptr->pl_len > 0) {
+        H5C_cache_entry_t *entry_ptr = cache_ptr->pl_head_ptr;
+
+        if(H5C_unprotect(f, dxpl_id, entry_ptr->addr, entry_ptr, H5C__NO_FLAGS_SET) < 0)
+            goto error;
+    } /* end while */
+
+    /* Release the entries still pinned, as the library unpins entries
+     * at file close without logging it.
+     */
+    while(cache_ptr->pel_len > 0)
+        if(H5C_unpin_entry(cache_ptr->pel_head_ptr) < 0)
+            goto error;
+
+    /* Shut down the replay cache, and restore the file's own */
+    if(H5C_prep_for_file_close(f, dxpl_id) < 0)
+        goto error;
+    if(H5C_dest(f, dxpl_id) < 0)
+        goto error;
+    cache_ptr = NULL;
+    f->shared->cache = saved_cache;
+    saved_cache = NULL;
+
+    HDassert(0 == H5SL_count(replay_entries_g));
+    H5SL_close(replay_entries_g);
+    replay_entries_g = NULL;
+
+    return 0;
+
+error:
+    replay_making_space_g = FALSE;
+    if(saved_cache) {
+        /* The replay cache is abandoned, rather than destroyed with
+         * entries in an unknown state.
+         */
+        f->shared->cache = saved_cache;
+    } /* end if */
+    if(replay_entries_g) {
+        H5SL_close(replay_entries_g);
+        replay_entries_g = NULL;
+    } /* end if */
+
+    return -1;
+} /* replay_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	init_replay_classes
+ *
+ * Purpose:	Set up the replay entry class for every client type id.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+init_replay_classes(void)
+{
+    int i;
+
+    for(i = 0; i < H5AC_NTYPES; i++) {
+        H5C_class_t *cls = &replay_classes_g[i];
+
+        HDmemset(cls, 0, sizeof(*cls));
+        cls->id = i;
+        cls->name = "replay entry";
+        cls->mem_type = H5FD_MEM_DEFAULT;
+        cls->flags = H5C__CLASS_SKIP_READS | H5C__CLASS_SKIP_WRITES;
+        cls->get_initial_load_size = replay_get_initial_load_size;
+        cls->deserialize = replay_deserialize;
+        cls->image_len = replay_image_len;
+        cls->serialize = replay_serialize;
+        cls->free_icr = replay_free_icr;
+
+        replay_class_table_g[i] = cls;
+    } /* end for */
+} /* init_replay_classes() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	open_replay_file
+ *
+ * Purpose:	Create the in memory file that replay caches are attached
+ *		to.
+ *
+ * Return:	File ID on success, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static hid_t
+open_replay_file(void)
+{
+    hid_t fapl = -1;
+    hid_t fid = -1;
+
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        goto error;
+    if(H5Pset_fapl_core(fapl, (size_t)(64 * 1024), FALSE) < 0)
+        goto error;
+    if((fid = H5Fcreate("cache_replay_scratch", H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        goto error;
+    if(H5Pclose(fapl) < 0)
+        goto error;
+
+    return fid;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+
+    return -1;
+} /* open_replay_file() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	write_trace
+ *
+ * Purpose:	Record a binary trace of a workload that revisits the
+ *		metadata of N_GROUPS groups N_PASSES times through a
+ *		small metadata cache.
+ *
+ * Return:	0 on success, -1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+write_trace(const char *filename, hid_t fapl, const char *trace_name,
+    unsigned sample_interval)
+{
+    H5AC_cache_config_t mdc_config;
+    hid_t tfapl = -1;
+    hid_t fid = -1;
+    hid_t gid = -1;
+    char name[16];
+    int pass_num;
+    int i;
+
+    if((tfapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_libver_bounds(tfapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        FAIL_STACK_ERROR
+
+    /* Use a small, fixed size cache, so the workload causes evictions */
+    mdc_config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    if(H5Pget_mdc_config(tfapl, &mdc_config) < 0)
+        FAIL_STACK_ERROR
+    mdc_config.set_initial_size = TRUE;
+    mdc_config.initial_size = 16 * 1024;
+    mdc_config.min_size = 16 * 1024;
+    mdc_config.incr_mode = H5C_incr__off;
+    mdc_config.flash_incr_mode = H5C_flash_incr__off;
+    mdc_config.decr_mode = H5C_decr__off;
+    if(H5Pset_mdc_config(tfapl, &mdc_config) < 0)
+        FAIL_STACK_ERROR
+
+    /* Trace from the creation of the file */
+    if(H5Pset_mdc_log_options(tfapl, TRUE, trace_name, TRUE) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_mdc_log_format(tfapl, H5AC_LOG_FORMAT_BINARY, sample_interval) < 0)
+        FAIL_STACK_ERROR
+
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, tfapl)) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < N_GROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "g%d", i);
+        if((gid = H5Gcreate2(fid, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Gclose(gid) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    for(pass_num = 0; pass_num < N_PASSES; pass_num++)
+        for(i = 0; i < N_GROUPS; i++) {
+            HDsnprintf(name, sizeof(name), "g%d", i);
+            if((gid = H5Gopen2(fid, name, H5P_DEFAULT)) < 0)
+                FAIL_STACK_ERROR
+            if(H5Gclose(gid) < 0)
+                FAIL_STACK_ERROR
+        } /* end for */
+    if(H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(tfapl) < 0)
+        FAIL_STACK_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Gclose(gid);
+        H5Fclose(fid);
+        H5Pclose(tfapl);
+    } H5E_END_TRY;
+
+    return -1;
+} /* write_trace() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	test_replay
+ *
+ * Purpose:	Record binary traces of a workload, and check that they
+ *		replay consistently.
+ *
+ * Return:	0 on success, 1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_replay(hid_t fapl)
+{
+    char filename[1024];
+    replay_trace_t trace;
+    replay_trace_t sampled;
+    replay_stats_t small;
+    replay_stats_t large;
+    unsigned long long nprotects = 0;
+    hid_t fid = -1;
+    size_t u;
+
+    TESTING("binary metadata cache trace replay");
+
+    HDmemset(&trace, 0, sizeof(trace));
+    HDmemset(&sampled, 0, sizeof(sampled));
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    /* Record and read back a complete trace */
+    if(write_trace(filename, fapl, TRACE_NAME, 1) < 0)
+        TEST_ERROR
+    if(read_trace(TRACE_NAME, &trace) < 0)
+        TEST_ERROR
+    if(trace.sample_interval != 1 || trace.nrecords == 0)
+        TEST_ERROR
+    for(u = 0; u < trace.nrecords; u++)
+        if(trace.records[u].op == H5C__TRACE_OP_PROTECT)
+            nprotects++;
+    if(nprotects == 0)
+        TEST_ERROR
+
+    /* Replay it through a cache that holds everything, and through a
+     * cache too small to hold the groups' metadata.  A complete trace
+     * is consistent whatever the cache size.
+     */
+    if((fid = open_replay_file()) < 0)
+        TEST_ERROR
+    if(replay_trace(fid, &trace, H5C__MAX_MAX_CACHE_SIZE, 0.3, &large) < 0)
+        TEST_ERROR
+    if(replay_trace(fid, &trace, H5C__MIN_MAX_CACHE_SIZE * 4, 0.3, &small) < 0)
+        TEST_ERROR
+    if(large.skipped != 0 || small.skipped != 0)
+        TEST_ERROR
+    if(large.protects != nprotects || small.protects != nprotects)
+        TEST_ERROR
+    if(large.hits + large.misses != large.protects
+            || small.hits + small.misses != small.protects)
+        TEST_ERROR
+    if(large.evictions != 0 || small.evictions == 0)
+        TEST_ERROR
+    if(small.misses <= large.misses)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    fid = -1;
+
+    /* A sampled trace only holds part of the operations */
+    if(write_trace(filename, fapl, SAMPLED_TRACE_NAME, 8) < 0)
+        TEST_ERROR
+    if(read_trace(SAMPLED_TRACE_NAME, &sampled) < 0)
+        TEST_ERROR
+    if(sampled.sample_interval != 8)
+        TEST_ERROR
+    if(sampled.nrecords == 0 || sampled.nrecords >= trace.nrecords)
+        TEST_ERROR
+
+    HDfree(trace.records);
+    HDfree(sampled.records);
+    if(GetTestCleanup()) {
+        HDremove(TRACE_NAME);
+        HDremove(SAMPLED_TRACE_NAME);
+    } /* end if */
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(trace.records)
+        HDfree(trace.records);
+    if(sampled.records)
+        HDfree(sampled.records);
+
+    return 1;
+} /* test_replay() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	addr_sampled
+ *
+ * Purpose:	Determine whether a trace with the given sample interval
+ *		samples the entry at ADDR by its address, as
+ *		H5C_write_log_record() does.
+ *
+ * Return:	TRUE/FALSE
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+addr_sampled(haddr_t addr, unsigned sample_interval)
+{
+    uint8_t addr_buf[8];
+    uint8_t *p = addr_buf;
+
+    UINT64ENCODE(p, addr);
+
+    return(0 == (H5_checksum_lookup3(addr_buf, sizeof(addr_buf), 0) % sample_interval));
+} /* addr_sampled() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	test_sampled_moves
+ *
+ * Purpose:	Check that a sampled trace keeps following an entry that
+ *		moves out of the sample, and records moves into the sample.
+ *
+ * Return:	0 on success, 1 on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_sampled_moves(void)
+{
+    H5F_t *f;
+    H5C_t *cache_ptr = NULL;
+    replay_trace_t trace;
+    haddr_t in[2];                      /* Addresses in the sample */
+    haddr_t out[5];                     /* Addresses outside of it */
+    haddr_t addr;
+    hid_t fid = -1;
+    hbool_t logging = FALSE;
+    size_t nin = 0, nout = 0;
+    const unsigned sample_interval = 8;
+
+    TESTING("sampled trace of moved entries");
+
+    HDmemset(&trace, 0, sizeof(trace));
+
+    for(addr = 4096; nin < 2 || nout < 5; addr += 512)
+        if(addr_sampled(addr, sample_interval)) {
+            if(nin < 2)
+                in[nin++] = addr;
+        } /* end if */
+        else if(nout < 5)
+            out[nout++] = addr;
+
+    if((fid = open_replay_file()) < 0)
+        TEST_ERROR
+    if(NULL == (f = (H5F_t *)H5I_object_verify(fid, H5I_FILE)))
+        TEST_ERROR
+    cache_ptr = f->shared->cache;
+    if(H5C_set_up_logging(cache_ptr, MOVES_TRACE_NAME, H5C_LOG_FORMAT_BINARY, sample_interval, TRUE) < 0)
+        TEST_ERROR
+    logging = TRUE;
+
+    /* A sampled entry moves out of the sample, and then moves again */
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_PROTECT, H5AC_OHDR_ID, 0, in[0], HADDR_UNDEF, (size_t)64) < 0)
+        TEST_ERROR
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_MOVE, H5AC_OHDR_ID, 0, in[0], out[0], (size_t)0) < 0)
+        TEST_ERROR
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_PROTECT, H5AC_OHDR_ID, 0, out[0], HADDR_UNDEF, (size_t)64) < 0)
+        TEST_ERROR
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_MOVE, H5AC_OHDR_ID, 0, out[0], out[1], (size_t)0) < 0)
+        TEST_ERROR
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_PROTECT, H5AC_OHDR_ID, 0, out[0], HADDR_UNDEF, (size_t)64) < 0)
+        TEST_ERROR
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_PROTECT, H5AC_OHDR_ID, 0, out[1], HADDR_UNDEF, (size_t)64) < 0)
+        TEST_ERROR
+
+    /* An entry moves into the sample, and one moves outside of it */
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_MOVE, H5AC_OHDR_ID, 0, out[2], in[1], (size_t)0) < 0)
+        TEST_ERROR
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_MOVE, H5AC_OHDR_ID, 0, out[3], out[4], (size_t)0) < 0)
+        TEST_ERROR
+    if(H5C_write_log_record(cache_ptr, H5C__TRACE_OP_PROTECT, H5AC_OHDR_ID, 0, out[4], HADDR_UNDEF, (size_t)64) < 0)
+        TEST_ERROR
+
+    logging = FALSE;
+    if(H5C_tear_down_logging(cache_ptr) < 0)
+        TEST_ERROR
+    if(H5Fclose(fid) < 0)
+        FAIL_STACK_ERROR
+    fid = -1;
+
+    /* Check the records kept */
+    if(read_trace(MOVES_TRACE_NAME, &trace) < 0)
+        TEST_ERROR
+    if(trace.nrecords != 6)
+        TEST_ERROR
+    if(trace.records[0].op != H5C__TRACE_OP_PROTECT || trace.records[0].addr != in[0])
+        TEST_ERROR
+    if(trace.records[1].op != H5C__TRACE_OP_MOVE || trace.records[1].addr != in[0]
+            || trace.records[1].new_addr != out[0])
+        TEST_ERROR
+    if(trace.records[2].op != H5C__TRACE_OP_PROTECT || trace.records[2].addr != out[0])
+        TEST_ERROR
+    if(trace.records[3].op != H5C__TRACE_OP_MOVE || trace.records[3].addr != out[0]
+            || trace.records[3].new_addr != out[1])
+        TEST_ERROR
+    if(trace.records[4].op != H5C__TRACE_OP_PROTECT || trace.records[4].addr != out[1])
+        TEST_ERROR
+    if(trace.records[5].op != H5C__TRACE_OP_MOVE || trace.records[5].addr != out[2]
+            || trace.records[5].new_addr != in[1])
+        TEST_ERROR
+
+    HDfree(trace.records);
+    if(GetTestCleanup())
+        HDremove(MOVES_TRACE_NAME);
+
+    PASSED();
+    return 0;
+
+error:
+    if(logging)
+        H5C_tear_down_logging(cache_ptr);
+    H5E_BEGIN_TRY {
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    if(trace.records)
+        HDfree(trace.records);
+
+    return 1;
+} /* test_sampled_moves() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	usage
+ *
+ * Purpose:	Print the usage message of the replay tool.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+usage(const char *prog)
+{
+    HDfprintf(stderr, "usage: %s [-c min_clean_fraction] [-s cache_size]... trace_file\n", prog);
+    HDfprintf(stderr, "       %s\n", prog);
+    HDfprintf(stderr, "Replay a binary metadata cache trace with each of the given cache sizes\n");
+    HDfprintf(stderr, "in bytes.  Without arguments, run the tests of the replay tool.\n");
+} /* usage() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	main
+ *
+ * Purpose:	Replay a trace given on the command line, or run the tests
+ *		of the replay tool.
+ *
+ * Return:	EXIT_SUCCESS/EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(int argc, char *argv[])
+{
+    size_t cache_sizes[MAX_CACHE_SIZES];
+    size_t ncache_sizes = 0;
+    double min_clean_fraction = 0.3;
+    replay_trace_t trace;
+    hid_t fid = -1;
+    int argno;
+    size_t u;
+
+    init_replay_classes();
+    if(H5open() < 0)
+        return EXIT_FAILURE;
+
+    /* Run the tests */
+    if(argc == 1) {
+        hid_t fapl;
+        int nerrors = 0;
+
+        h5_reset();
+        fapl = h5_fileaccess();
+
+        printf("Testing metadata cache trace replay.\n");
+
+        nerrors += test_replay(fapl);
+        nerrors += test_sampled_moves();
+
+        if(nerrors) {
+            printf("***** %d Metadata cache trace replay TEST%s FAILED! *****\n",
+                   nerrors, nerrors > 1 ? "S" : "");
+            return EXIT_FAILURE;
+        } /* end if */
+
+        h5_cleanup(FILENAME, fapl);
+        printf("All metadata cache trace replay tests passed.\n");
+        return EXIT_SUCCESS;
+    } /* end if */
+
+    /* Parse the arguments */
+    for(argno = 1; argno < argc - 1; argno++) {
+        if(!HDstrcmp(argv[argno], "-s") && argno + 1 < argc - 1) {
+            if(ncache_sizes == MAX_CACHE_SIZES) {
+                HDfprintf(stderr, "too many cache sizes\n");
+                return EXIT_FAILURE;
+            } /* end if */
+            cache_sizes[ncache_sizes++] = (size_t)HDstrtoull(argv[++argno], NULL, 0);
+        } /* end if */
+        else if(!HDstrcmp(argv[argno], "-c") && argno + 1 < argc - 1) {
+            min_clean_fraction = HDatof(argv[++argno]);
+            if(min_clean_fraction < 0.0 || min_clean_fraction > 1.0) {
+                HDfprintf(stderr, "min_clean_fraction must be in [0, 1]\n");
+                return EXIT_FAILURE;
+            } /* end if */
+        } /* end if */
+        else {
+            usage(argv[0]);
+            return EXIT_FAILURE;
+        } /* end else */
+    } /* end for */
+    if(argno != argc - 1 || argv[argno][0] == '-') {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    } /* end if */
+    if(ncache_sizes == 0)
+        for(ncache_sizes = 0; ncache_sizes < N_DEF_CACHE_SIZES; ncache_sizes++)
+            cache_sizes[ncache_sizes] = def_cache_sizes_g[ncache_sizes];
+
+    if(read_trace(argv[argno], &trace) < 0)
+        return EXIT_FAILURE;
+    if((fid = open_replay_file()) < 0) {
+        HDfprintf(stderr, "can't create replay file\n");
+        return EXIT_FAILURE;
+    } /* end if */
+
+    HDfprintf(stdout, "%s: %Zu records, sample interval %u\n",
+            argv[argno], trace.nrecords, trace.sample_interval);
+    HDfprintf(stdout, "%12s %12s %12s %9s %12s %12s %9s\n", "cache size",
+            "replayed", "protects", "hit rate", "misses", "evictions", "skipped");
+    for(u = 0; u < ncache_sizes; u++) {
+        replay_stats_t stats;
+        size_t replay_size;
+
+        /* Scale the cache size by the sampling rate of the trace */
+        replay_size = cache_sizes[u] / trace.sample_interval;
+        if(replay_size < H5C__MIN_MAX_CACHE_SIZE)
+            replay_size = H5C__MIN_MAX_CACHE_SIZE;
+        if(replay_size > H5C__MAX_MAX_CACHE_SIZE)
+            replay_size = H5C__MAX_MAX_CACHE_SIZE;
+
+        if(replay_trace(fid, &trace, replay_size, min_clean_fraction, &stats) < 0) {
+            HDfprintf(stderr, "replay with cache size %Zu failed\n", cache_sizes[u]);
+            H5Eprint2(H5E_DEFAULT, stderr);
+            return EXIT_FAILURE;
+        } /* end if */
+
+        HDfprintf(stdout, "%12Zu %12Zu %12llu %8.2f%% %12llu %12llu %9llu\n",
+                cache_sizes[u], replay_size, stats.protects,
+                (stats.protects ? 100.0 * (double)stats.hits / (double)stats.protects : 0.0),
+                stats.misses, stats.evictions, stats.skipped);
+    } /* end for */
+
+    HDfree(trace.records);
+    if(H5Fclose(fid) < 0)
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+} /* main() */
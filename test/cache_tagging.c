@@ -152,24 +152,20 @@ verify_no_unknown_tags(hid_t fid)
 
     H5F_t *f;           /* File Pointer */
     H5C_t *cache_ptr;   /* Cache Pointer */
-    int i;              /* Iterator */
+    H5C_cache_entry_t *entry_ptr;   /* entry pointer */
 
     /* Get Internal File / Cache Pointers */
     if(NULL == (f = (H5F_t *)H5I_object(fid)))
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr;      /* entry pointer */
-
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(!entry_ptr->dirtied)
-                TEST_ERROR;
+    entry_ptr = cache_ptr->il_head;
+    while(entry_ptr != NULL) {
+        if(!entry_ptr->dirtied)
+            TEST_ERROR;
 
-            entry_ptr = entry_ptr->ht_next;
-        } /* end if */
-    } /* end for */
+        entry_ptr = entry_ptr->il_next;
+    } /* end while */
 
     return 0;
 
@@ -200,24 +196,20 @@ mark_all_entries_investigated(hid_t fid)
 {
     H5F_t *f;           /* File Pointer */
     H5C_t *cache_ptr;   /* Cache Pointer */
-    int i;              /* Iterator */
+    H5C_cache_entry_t *entry_ptr;   /* entry pointer */
 
     /* Get Internal File / Cache Pointers */
     if(NULL == (f = (H5F_t *)H5I_object(fid)))
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr;      /* entry pointer */
-
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(!entry_ptr->dirtied)
-                entry_ptr->dirtied = TRUE;
+    entry_ptr = cache_ptr->il_head;
+    while(entry_ptr != NULL) {
+        if(!entry_ptr->dirtied)
+            entry_ptr->dirtied = TRUE;
 
-            entry_ptr = entry_ptr->ht_next;
-        } /* end if */
-    } /* end for */
+        entry_ptr = entry_ptr->il_next;
+    } /* end while */
 
     return 0;
 
@@ -246,24 +238,20 @@ reset_all_entries_investigated(hid_t fid)
 {
     H5F_t *f;           /* File Pointer */
     H5C_t *cache_ptr;   /* Cache Pointer */
-    int i;              /* Iterator */
+    H5C_cache_entry_t *entry_ptr;   /* entry pointer */
 
     /* Get Internal File / Cache Pointers */
     if(NULL == (f = (H5F_t *)H5I_object(fid)))
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr;      /* entry pointer */
-
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(entry_ptr->dirtied)
-                entry_ptr->dirtied = FALSE;
+    entry_ptr = cache_ptr->il_head;
+    while(entry_ptr != NULL) {
+        if(entry_ptr->dirtied)
+            entry_ptr->dirtied = FALSE;
 
-            entry_ptr = entry_ptr->ht_next;
-        } /* end if */
-    } /* end for */
+        entry_ptr = entry_ptr->il_next;
+    } /* end while */
 
     return 0;
 
@@ -282,6 +270,10 @@ error:
  *              attempts can skip over this entry, knowing it has already been 
  *              checked.
  *
+ *              Of the entries with the provided id not yet checked, the
+ *              one at the lowest address is the one verified, so entries
+ *              of the same type are verified in address order.
+ *
  * Return:      0 on Success, -1 on Failure
  *
  * Programmer:  Mike McGreevy
@@ -294,37 +286,32 @@ verify_tag(hid_t fid, int id, haddr_t tag)
 {
     H5F_t *f;                   /* File Pointer */
     H5C_t *cache_ptr;           /* Cache Pointer */
-    int i;                      /* Iterator */
+    H5C_cache_entry_t *entry_ptr; /* entry pointer */
+    H5C_cache_entry_t *found_ptr = NULL; /* entry to verify */
 
     /* Get Internal File / Cache Pointers */
     if(NULL == (f = (H5F_t *)H5I_object(fid)))
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
-        H5C_cache_entry_t *entry_ptr; /* entry pointer */
+    entry_ptr = cache_ptr->il_head;
+    while(entry_ptr != NULL) {
+        if(entry_ptr->type->id == id && !entry_ptr->dirtied)
+            if(found_ptr == NULL || H5F_addr_lt(entry_ptr->addr, found_ptr->addr))
+                found_ptr = entry_ptr;
 
-        entry_ptr = cache_ptr->index[i];
-        while(entry_ptr != NULL) {
-            if(entry_ptr->type->id == id && !entry_ptr->dirtied) {
-                if(entry_ptr->tag_info->tag != tag)
-                    TEST_ERROR;
+        entry_ptr = entry_ptr->il_next;
+    } /* end while */
 
-                /* Mark the entry/tag pair as found */
-                entry_ptr->dirtied = TRUE;
+    /* Didn't find the tagged entry, throw an error */
+    if(found_ptr == NULL)
+        TEST_ERROR;
+    if(found_ptr->tag_info->tag != tag)
+        TEST_ERROR;
 
-                /* leave now that we've found the entry */
-                goto done;
-            } /* end if */
+    /* Mark the entry/tag pair as found */
+    found_ptr->dirtied = TRUE;
 
-            entry_ptr = entry_ptr->ht_next;
-        } /* end if */
-    } /* end for */
-
-    /* Didn't find the tagged entry, throw an error */
-    TEST_ERROR;
-    
-done:
     return 0;
 
 error:
@@ -3394,6 +3394,332 @@ error:
     return 1;
 } /* end test_compound_18() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_compound_19
+ *
+ * Purpose:     Tests compound conversions that are compiled into a plan of
+ *              copies and byte swaps: reordered members, a nested compound
+ *              and an array member converted to big-endian in a packed
+ *              destination (which needs no background buffer), and back
+ *              into the native padded struct (which does).
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_compound_19(void)
+{
+    typedef struct {
+        short   x;
+        int     y;
+    } inner_t;
+    typedef struct {
+        char    c;
+        int     a;
+        inner_t in;
+        double  d;
+        int     arr[3];
+    } src_t;
+    const size_t nelmts = 100;
+    hsize_t     arr_dim = 3;
+    hid_t       inner_tid = -1, src_tid = -1;
+    hid_t       be_inner_tid = -1, be_arr_tid = -1, be_tid = -1;
+    hid_t       arr_tid = -1;
+    H5T_cdata_t *cdata = NULL;
+    src_t       *orig = NULL, *buf = NULL;
+    unsigned char *bkg = NULL;
+    size_t      u, v;
+
+    TESTING("compiled compound conversions");
+
+    /* Native types */
+    if((inner_tid = H5Tcreate(H5T_COMPOUND, sizeof(inner_t))) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(inner_tid, "x", HOFFSET(inner_t, x), H5T_NATIVE_SHORT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(inner_tid, "y", HOFFSET(inner_t, y), H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+    if((arr_tid = H5Tarray_create2(H5T_NATIVE_INT, 1, &arr_dim)) < 0) FAIL_STACK_ERROR
+    if((src_tid = H5Tcreate(H5T_COMPOUND, sizeof(src_t))) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_tid, "c", HOFFSET(src_t, c), H5T_NATIVE_SCHAR) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_tid, "a", HOFFSET(src_t, a), H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_tid, "in", HOFFSET(src_t, in), inner_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_tid, "d", HOFFSET(src_t, d), H5T_NATIVE_DOUBLE) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src_tid, "arr", HOFFSET(src_t, arr), arr_tid) < 0) FAIL_STACK_ERROR
+
+    /* Packed, reordered big-endian types that cover every byte */
+    if((be_inner_tid = H5Tcreate(H5T_COMPOUND, (size_t)6)) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(be_inner_tid, "y", (size_t)0, H5T_STD_I32BE) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(be_inner_tid, "x", (size_t)4, H5T_STD_I16BE) < 0) FAIL_STACK_ERROR
+    if((be_arr_tid = H5Tarray_create2(H5T_STD_I32BE, 1, &arr_dim)) < 0) FAIL_STACK_ERROR
+    if((be_tid = H5Tcreate(H5T_COMPOUND, (size_t)31)) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(be_tid, "d", (size_t)0, H5T_IEEE_F64BE) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(be_tid, "in", (size_t)8, be_inner_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(be_tid, "arr", (size_t)14, be_arr_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(be_tid, "a", (size_t)26, H5T_STD_I32BE) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(be_tid, "c", (size_t)30, H5T_NATIVE_SCHAR) < 0) FAIL_STACK_ERROR
+
+    /* Initialize data */
+    if(NULL == (orig = (src_t *)HDcalloc(nelmts, sizeof(src_t)))) TEST_ERROR
+    if(NULL == (buf = (src_t *)HDcalloc(nelmts, sizeof(src_t)))) TEST_ERROR
+    if(NULL == (bkg = (unsigned char *)HDmalloc(nelmts * sizeof(src_t)))) TEST_ERROR
+    for(u = 0; u < nelmts; u++) {
+        orig[u].c = (char)u;
+        orig[u].a = (int)u * 1000 - 7;
+        orig[u].in.x = (short)(u * 3);
+        orig[u].in.y = -(int)u;
+        orig[u].d = (double)u / 3.0;
+        for(v = 0; v < 3; v++)
+            orig[u].arr[v] = (int)(u * 10 + v);
+    } /* end for */
+    HDmemcpy(buf, orig, nelmts * sizeof(src_t));
+
+    /* The packed destination is overwritten completely */
+    if(NULL == H5Tfind(src_tid, be_tid, &cdata)) FAIL_STACK_ERROR
+    if(cdata->need_bkg != H5T_BKG_NO) FAIL_PUTS_ERROR("background buffer needed for packed destination")
+    if(H5Tconvert(src_tid, be_tid, nelmts, buf, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* Spot-check the big-endian bytes */
+    for(u = 0; u < nelmts; u++) {
+        const unsigned char *e = (const unsigned char *)buf + u * 31;
+        int a = (int)(((unsigned)e[26] << 24) | ((unsigned)e[27] << 16) | ((unsigned)e[28] << 8) | e[29]);
+        short x = (short)(((unsigned)e[12] << 8) | e[13]);
+
+        if(a != orig[u].a || x != orig[u].in.x || (char)e[30] != orig[u].c)
+            FAIL_PUTS_ERROR("incorrect packed big-endian value")
+    } /* end for */
+
+    /* Converting back needs the background for the native padding */
+    if(NULL == H5Tfind(be_tid, src_tid, &cdata)) FAIL_STACK_ERROR
+    if(cdata->need_bkg != H5T_BKG_YES) FAIL_PUTS_ERROR("background buffer not needed for padded destination")
+    HDmemset(bkg, 0, nelmts * sizeof(src_t));
+    if(H5Tconvert(be_tid, src_tid, nelmts, buf, bkg, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < nelmts; u++)
+        if(buf[u].c != orig[u].c || buf[u].a != orig[u].a || buf[u].in.x != orig[u].in.x
+                || buf[u].in.y != orig[u].in.y || !H5_DBL_ABS_EQUAL(buf[u].d, orig[u].d)
+                || buf[u].arr[0] != orig[u].arr[0] || buf[u].arr[1] != orig[u].arr[1]
+                || buf[u].arr[2] != orig[u].arr[2])
+            FAIL_PUTS_ERROR("incorrect value after round trip")
+
+    /* Close IDs */
+    if(H5Tclose(be_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(be_arr_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(be_inner_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(src_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(arr_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(inner_tid) < 0) FAIL_STACK_ERROR
+    HDfree(orig);
+    HDfree(buf);
+    HDfree(bkg);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(be_tid);
+        H5Tclose(be_arr_tid);
+        H5Tclose(be_inner_tid);
+        H5Tclose(src_tid);
+        H5Tclose(arr_tid);
+        H5Tclose(inner_tid);
+    } H5E_END_TRY;
+    if(orig)
+        HDfree(orig);
+    if(buf)
+        HDfree(buf);
+    if(bkg)
+        HDfree(bkg);
+    return 1;
+} /* end test_compound_19() */
+
+/*-------------------------------------------------------------------------
+ * Function:    conv_except_count
+ *
+ * Purpose:     Conversion exception callback for test_compound_20() that
+ *              counts the exceptions and leaves them to the library.
+ *
+ * Return:      H5T_CONV_UNHANDLED
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_ret_t
+conv_except_count(H5T_conv_except_t H5_ATTR_UNUSED except_type, hid_t H5_ATTR_UNUSED src_id,
+    hid_t H5_ATTR_UNUSED dst_id, void H5_ATTR_UNUSED *src_buf, void H5_ATTR_UNUSED *dst_buf,
+    void *_count)
+{
+    unsigned *count = (unsigned *)_count;
+
+    (*count)++;
+
+    return H5T_CONV_UNHANDLED;
+} /* end conv_except_count() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_compound_20
+ *
+ * Purpose:     Tests compound conversions whose compiled plan converts
+ *              native numbers inline: widening, narrowing and same-size
+ *              conversions between integers and floating-point values,
+ *              including values out of the destination range, into a
+ *              packed destination.  Each member must come out as the
+ *              hard conversion of that member alone gives it, with and
+ *              without a conversion exception callback.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_compound_20(void)
+{
+    typedef struct {
+        signed char c;
+        int     i;
+        unsigned u;
+        long long ll;
+        float   f;
+        double  d;
+        int     arr[2];
+    } src_t;
+    struct {
+        const char *name;               /* Member name */
+        size_t  src_off;                /* Offset in src_t */
+        hid_t   src_type;               /* Native source type */
+        size_t  src_size;               /* Size of a source value */
+        size_t  dst_off;                /* Offset in the packed destination */
+        hid_t   dst_type;               /* Native destination type */
+        size_t  dst_size;               /* Size of a destination value */
+        size_t  nvals;                  /* Number of values in the member */
+    } memb[7];
+    const size_t nelmts = 100;
+    const size_t dst_size = 34;
+    hsize_t     arr_dim = 2;
+    hid_t       src_tid = -1, dst_tid = -1;
+    hid_t       src_arr_tid = -1, dst_arr_tid = -1;
+    hid_t       dxpl = -1;
+    H5T_cdata_t *cdata = NULL;
+    src_t       *orig = NULL;
+    unsigned char *buf = NULL, *val = NULL;
+    unsigned    count, ref_count;
+    unsigned    pass;
+    size_t      u, v, m;
+
+    TESTING("compiled compound conversions of mixed types");
+
+    /* Members: source type, and the type each one becomes */
+    memb[0].name = "d"; memb[0].src_off = HOFFSET(src_t, d); memb[0].src_type = H5T_NATIVE_DOUBLE;
+    memb[0].dst_off = 0; memb[0].dst_type = H5T_NATIVE_FLOAT;
+    memb[1].name = "i"; memb[1].src_off = HOFFSET(src_t, i); memb[1].src_type = H5T_NATIVE_INT;
+    memb[1].dst_off = 4; memb[1].dst_type = H5T_NATIVE_DOUBLE;
+    memb[2].name = "u"; memb[2].src_off = HOFFSET(src_t, u); memb[2].src_type = H5T_NATIVE_UINT;
+    memb[2].dst_off = 12; memb[2].dst_type = H5T_NATIVE_INT;
+    memb[3].name = "f"; memb[3].src_off = HOFFSET(src_t, f); memb[3].src_type = H5T_NATIVE_FLOAT;
+    memb[3].dst_off = 16; memb[3].dst_type = H5T_NATIVE_INT;
+    memb[4].name = "ll"; memb[4].src_off = HOFFSET(src_t, ll); memb[4].src_type = H5T_NATIVE_LLONG;
+    memb[4].dst_off = 20; memb[4].dst_type = H5T_NATIVE_SHORT;
+    memb[5].name = "c"; memb[5].src_off = HOFFSET(src_t, c); memb[5].src_type = H5T_NATIVE_SCHAR;
+    memb[5].dst_off = 22; memb[5].dst_type = H5T_NATIVE_UINT;
+    memb[6].name = "arr"; memb[6].src_off = HOFFSET(src_t, arr); memb[6].src_type = H5T_NATIVE_INT;
+    memb[6].dst_off = 26; memb[6].dst_type = H5T_NATIVE_FLOAT;
+    for(m = 0; m < 7; m++) {
+        memb[m].src_size = H5Tget_size(memb[m].src_type);
+        memb[m].dst_size = H5Tget_size(memb[m].dst_type);
+        memb[m].nvals = (m == 6) ? 2 : 1;
+    } /* end for */
+
+    /* Native source and packed destination types */
+    if((src_arr_tid = H5Tarray_create2(H5T_NATIVE_INT, 1, &arr_dim)) < 0) FAIL_STACK_ERROR
+    if((dst_arr_tid = H5Tarray_create2(H5T_NATIVE_FLOAT, 1, &arr_dim)) < 0) FAIL_STACK_ERROR
+    if((src_tid = H5Tcreate(H5T_COMPOUND, sizeof(src_t))) < 0) FAIL_STACK_ERROR
+    if((dst_tid = H5Tcreate(H5T_COMPOUND, dst_size)) < 0) FAIL_STACK_ERROR
+    for(m = 0; m < 7; m++) {
+        if(H5Tinsert(src_tid, memb[m].name, memb[m].src_off, m == 6 ? src_arr_tid : memb[m].src_type) < 0) FAIL_STACK_ERROR
+        if(H5Tinsert(dst_tid, memb[m].name, memb[m].dst_off, m == 6 ? dst_arr_tid : memb[m].dst_type) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Initialize data, with values out of range for each destination */
+    if(NULL == (orig = (src_t *)HDcalloc(nelmts, sizeof(src_t)))) TEST_ERROR
+    if(NULL == (buf = (unsigned char *)HDcalloc(nelmts, sizeof(src_t)))) TEST_ERROR
+    if(NULL == (val = (unsigned char *)HDmalloc(2 * sizeof(double)))) TEST_ERROR
+    for(u = 0; u < nelmts; u++) {
+        orig[u].c = (signed char)((int)u - 50);
+        orig[u].i = (int)u * 123457 - 6000000;
+        orig[u].u = (unsigned)u * 50000000U;
+        orig[u].ll = ((long long)u - 50) * 1000;
+        orig[u].f = ((float)u - 50.0f) * 1.0e8f + 0.25f;
+        if(u % 3 == 0)
+            orig[u].d = (u & 1) ? 1.0e300 : -1.0e300;
+        else
+            orig[u].d = (double)u / 7.0;
+        orig[u].arr[0] = (int)u * 16777217;
+        orig[u].arr[1] = -(int)u;
+    } /* end for */
+
+    /* The packed destination is overwritten completely */
+    if(NULL == H5Tfind(src_tid, dst_tid, &cdata)) FAIL_STACK_ERROR
+    if(cdata->need_bkg != H5T_BKG_NO) FAIL_PUTS_ERROR("mixed-type members not compiled into a plan")
+
+    /* Convert without and then with an exception callback */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_type_conv_cb(dxpl, conv_except_count, &count) < 0) FAIL_STACK_ERROR
+    for(pass = 0; pass < 2; pass++) {
+        hid_t xfer = pass ? dxpl : H5P_DEFAULT;
+
+        count = 0;
+        HDmemcpy(buf, orig, nelmts * sizeof(src_t));
+        if(H5Tconvert(src_tid, dst_tid, nelmts, buf, NULL, xfer) < 0) FAIL_STACK_ERROR
+        ref_count = count;
+
+        /* Compare each value with the conversion of the member alone */
+        count = 0;
+        for(u = 0; u < nelmts; u++)
+            for(m = 0; m < 7; m++)
+                for(v = 0; v < memb[m].nvals; v++) {
+                    HDmemcpy(val, (const unsigned char *)(orig + u) + memb[m].src_off + v * memb[m].src_size, memb[m].src_size);
+                    if(H5Tconvert(memb[m].src_type, memb[m].dst_type, (size_t)1, val, NULL, xfer) < 0) FAIL_STACK_ERROR
+                    if(HDmemcmp(val, buf + u * dst_size + memb[m].dst_off + v * memb[m].dst_size, memb[m].dst_size)) {
+                        H5_FAILED();
+                        printf("    element %u, member \"%s\": incorrect value\n", (unsigned)u, memb[m].name);
+                        goto error;
+                    } /* end if */
+                } /* end for */
+        if(pass && (0 == count || count != ref_count))
+            FAIL_PUTS_ERROR("conversion exceptions not reported for compiled members")
+    } /* end for */
+
+    /* Close IDs */
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(dst_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(src_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(dst_arr_tid) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(src_arr_tid) < 0) FAIL_STACK_ERROR
+    HDfree(orig);
+    HDfree(buf);
+    HDfree(val);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dxpl);
+        H5Tclose(dst_tid);
+        H5Tclose(src_tid);
+        H5Tclose(dst_arr_tid);
+        H5Tclose(src_arr_tid);
+    } H5E_END_TRY;
+    if(orig)
+        HDfree(orig);
+    if(buf)
+        HDfree(buf);
+    if(val)
+        HDfree(val);
+    return 1;
+} /* end test_compound_20() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_query
@@ -4717,6 +5043,200 @@ test_conv_enum_2(void)
     return 0;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:    conv_enum_except
+ *
+ * Purpose:     Exception callback for test_conv_enum_3.  Counts the values
+ *              without a matching member and stores -2 for each of them.
+ *
+ * Return:      H5T_CONV_HANDLED
+ *-------------------------------------------------------------------------
+ */
+static H5T_conv_ret_t
+conv_enum_except(H5T_conv_except_t except_type, hid_t H5_ATTR_UNUSED src_id,
+    hid_t H5_ATTR_UNUSED dst_id, void H5_ATTR_UNUSED *src_buf, void *dst_buf,
+    void *user_data)
+{
+    short       val = -2;
+
+    if(H5T_CONV_EXCEPT_RANGE_HI == except_type) {
+        (*(int *)user_data)++;
+        HDmemcpy(dst_buf, &val, sizeof(short));
+    } /* end if */
+
+    return H5T_CONV_HANDLED;
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_enum_3
+ *
+ * Purpose:     Tests conversions of enumerations with many members, both
+ *              with a dense range of big-endian values and with sparse
+ *              64-bit values, including values that aren't members.
+ *
+ * Return:      Success:        0
+ *
+ *              Failure:        number of errors
+ *-------------------------------------------------------------------------
+ */
+#define CONV_ENUM_NMEMBS        1000
+static int
+test_conv_enum_3(void)
+{
+    hid_t       srctype = -1, dsttype = -1, dxpl = -1, basetype = -1;
+    char        name[32];
+    unsigned char wide[16];
+    unsigned char *raw = NULL;
+    int         *idata = NULL, *wdata;
+    long long   *ldata = NULL;
+    short       *sdata = NULL;
+    long long   lval;
+    short       sval;
+    int         ival, nexcept = 0;
+    int         i;
+
+    TESTING("large enumeration type conversion");
+
+    /* Dense source values -500..499 stored as big-endian 16-bit integers */
+    if((srctype = H5Tenum_create(H5T_STD_I16BE)) < 0) TEST_ERROR
+    if((dsttype = H5Tenum_create(H5T_NATIVE_INT)) < 0) TEST_ERROR
+    for(i = 0; i < CONV_ENUM_NMEMBS; i++) {
+        unsigned char pattern[2];
+        int v = i - CONV_ENUM_NMEMBS / 2;
+
+        pattern[0] = (unsigned char)(((unsigned)v >> 8) & 0xff);
+        pattern[1] = (unsigned char)((unsigned)v & 0xff);
+        HDsnprintf(name, sizeof(name), "m%d", i);
+        if(H5Tenum_insert(srctype, name, pattern) < 0) TEST_ERROR
+    } /* end for */
+    for(i = CONV_ENUM_NMEMBS - 1; i >= 0; i--) {
+        ival = 3 * i;
+        HDsnprintf(name, sizeof(name), "m%d", i);
+        if(H5Tenum_insert(dsttype, name, &ival) < 0) TEST_ERROR
+    } /* end for */
+
+    if(NULL == (idata = (int *)HDmalloc(NTESTELEM * sizeof(int)))) TEST_ERROR
+    raw = (unsigned char *)idata;
+    for(i = 0; i < NTESTELEM; i++) {
+        int v = (i * 7) % (CONV_ENUM_NMEMBS + 1) - CONV_ENUM_NMEMBS / 2;
+
+        raw[2 * i] = (unsigned char)(((unsigned)v >> 8) & 0xff);
+        raw[2 * i + 1] = (unsigned char)((unsigned)v & 0xff);
+    } /* end for */
+    if(H5Tconvert(srctype, dsttype, (size_t)NTESTELEM, idata, NULL, H5P_DEFAULT) < 0) TEST_ERROR
+    for(i = 0; i < NTESTELEM; i++) {
+        int m = (i * 7) % (CONV_ENUM_NMEMBS + 1);
+
+        /* The value one past the last member isn't in the source type */
+        ival = (m == CONV_ENUM_NMEMBS) ? -1 : 3 * m;
+        if(idata[i] != ival) {
+            H5_FAILED();
+            printf("    dense element %d is %d but should have been %d\n", i, idata[i], ival);
+            goto error;
+        } /* end if */
+    } /* end for */
+    if(H5Tclose(srctype) < 0) TEST_ERROR
+    if(H5Tclose(dsttype) < 0) TEST_ERROR
+
+    /* Sparse 64-bit source values, some of them negative */
+    if((srctype = H5Tenum_create(H5T_NATIVE_LLONG)) < 0) TEST_ERROR
+    if((dsttype = H5Tenum_create(H5T_NATIVE_SHORT)) < 0) TEST_ERROR
+    for(i = 0; i < CONV_ENUM_NMEMBS; i++) {
+        lval = ((long long)i - CONV_ENUM_NMEMBS / 2) * 1000003LL * 4099LL;
+        HDsnprintf(name, sizeof(name), "s%d", i);
+        if(H5Tenum_insert(srctype, name, &lval) < 0) TEST_ERROR
+        sval = (short)(CONV_ENUM_NMEMBS - i);
+        if(H5Tenum_insert(dsttype, name, &sval) < 0) TEST_ERROR
+    } /* end for */
+
+    if(NULL == (ldata = (long long *)HDmalloc(NTESTELEM * sizeof(long long)))) TEST_ERROR
+    for(i = 0; i < NTESTELEM; i++) {
+        if(i % 1000 == 999)
+            ldata[i] = (long long)i;     /* Not a member */
+        else
+            ldata[i] = ((long long)(i % CONV_ENUM_NMEMBS) - CONV_ENUM_NMEMBS / 2) * 1000003LL * 4099LL;
+    } /* end for */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) TEST_ERROR
+    if(H5Pset_type_conv_cb(dxpl, conv_enum_except, &nexcept) < 0) TEST_ERROR
+    if(H5Tconvert(srctype, dsttype, (size_t)NTESTELEM, ldata, NULL, dxpl) < 0) TEST_ERROR
+    sdata = (short *)ldata;
+    for(i = 0; i < NTESTELEM; i++) {
+        sval = (short)((i % 1000 == 999) ? -2 : CONV_ENUM_NMEMBS - i % CONV_ENUM_NMEMBS);
+        if(sdata[i] != sval) {
+            H5_FAILED();
+            printf("    sparse element %d is %d but should have been %d\n", i, (int)sdata[i], (int)sval);
+            goto error;
+        } /* end if */
+    } /* end for */
+    if(nexcept != NTESTELEM / 1000) {
+        H5_FAILED();
+        printf("    %d exceptions but should have been %d\n", nexcept, NTESTELEM / 1000);
+        goto error;
+    } /* end if */
+
+    if(H5Pclose(dxpl) < 0) TEST_ERROR
+    if(H5Tclose(srctype) < 0) TEST_ERROR
+    if(H5Tclose(dsttype) < 0) TEST_ERROR
+
+    /* 128-bit big-endian source values, inserted in decreasing order */
+    if((basetype = H5Tcopy(H5T_STD_U64BE)) < 0) TEST_ERROR
+    if(H5Tset_size(basetype, sizeof(wide)) < 0) TEST_ERROR
+    if((srctype = H5Tenum_create(basetype)) < 0) TEST_ERROR
+    if((dsttype = H5Tenum_create(H5T_NATIVE_INT)) < 0) TEST_ERROR
+    for(i = 0; i < CONV_ENUM_NMEMBS; i++) {
+        HDmemset(wide, 0, sizeof(wide));
+        wide[0] = (unsigned char)((CONV_ENUM_NMEMBS - i) >> 8);
+        wide[15] = (unsigned char)(CONV_ENUM_NMEMBS - i);
+        HDsnprintf(name, sizeof(name), "w%d", i);
+        if(H5Tenum_insert(srctype, name, wide) < 0) TEST_ERROR
+        if(H5Tenum_insert(dsttype, name, &i) < 0) TEST_ERROR
+    } /* end for */
+
+    raw = (unsigned char *)ldata;
+    for(i = 0; i < NTESTELEM / 2; i++) {
+        int m = i % CONV_ENUM_NMEMBS;
+
+        HDmemset(raw + 16 * i, 0, sizeof(wide));
+        raw[16 * i] = (unsigned char)((CONV_ENUM_NMEMBS - m) >> 8);
+        raw[16 * i + 15] = (unsigned char)(CONV_ENUM_NMEMBS - m);
+    } /* end for */
+    if(H5Tconvert(srctype, dsttype, (size_t)(NTESTELEM / 2), ldata, NULL, H5P_DEFAULT) < 0) TEST_ERROR
+    wdata = (int *)ldata;
+    for(i = 0; i < NTESTELEM / 2; i++)
+        if(wdata[i] != i % CONV_ENUM_NMEMBS) {
+            H5_FAILED();
+            printf("    wide element %d is %d but should have been %d\n", i, wdata[i], i % CONV_ENUM_NMEMBS);
+            goto error;
+        } /* end if */
+
+    /* The conversion doesn't reorder the source type */
+    if(H5Tget_member_value(srctype, 0, wide) < 0) TEST_ERROR
+    if(wide[0] != (unsigned char)(CONV_ENUM_NMEMBS >> 8) || wide[15] != (unsigned char)CONV_ENUM_NMEMBS) TEST_ERROR
+
+    if(H5Tclose(basetype) < 0) TEST_ERROR
+    if(H5Tclose(srctype) < 0) TEST_ERROR
+    if(H5Tclose(dsttype) < 0) TEST_ERROR
+    HDfree(idata);
+    HDfree(ldata);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dxpl);
+        H5Tclose(basetype);
+        H5Tclose(srctype);
+        H5Tclose(dsttype);
+    } H5E_END_TRY;
+    HDfree(idata);
+    HDfree(ldata);
+    return 1;
+}
+#undef CONV_ENUM_NMEMBS
+
 
 /*-------------------------------------------------------------------------
  * Function:	test_conv_bitfield
@@ -6342,6 +6862,522 @@ error:
     return 1;
 } /* end test_set_order() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_threads
+ *
+ * Purpose:     Tests H5Pset/get_type_conv_threads and verifies that
+ *              conversions split between threads give the same results
+ *              as conversions done by one thread.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_threads(void)
+{
+    typedef struct {
+        int     a;
+        float   b;
+    } src_cmpd_t;
+    hid_t       dxpl = -1;              /* Dataset transfer property list */
+    hid_t       src_cmpd = -1, dst_cmpd = -1;   /* Compound datatypes */
+    int         *ibuf = NULL, *ibuf2 = NULL;    /* Integer buffers */
+    src_cmpd_t  *cbuf = NULL, *cbuf2 = NULL;    /* Compound buffers */
+    void        *bkg = NULL;            /* Background buffer */
+    unsigned    nthreads;               /* Thread count */
+    size_t      min_elmts;              /* Minimum elements per thread */
+    size_t      def_min_elmts;          /* Default minimum elements per thread */
+    size_t      u;                      /* Local index variable */
+    herr_t      ret;                    /* Generic return value */
+
+    TESTING("multithreaded datatype conversion");
+
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) TEST_ERROR
+
+    /* Check the defaults and the setting of invalid values */
+    if(H5Pget_type_conv_threads(dxpl, &nthreads, &min_elmts) < 0) TEST_ERROR
+    if(nthreads != 1) TEST_ERROR
+    if(min_elmts == 0) TEST_ERROR
+    def_min_elmts = min_elmts;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_type_conv_threads(dxpl, 0, (size_t)1024);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Pset_type_conv_threads(dxpl, 4, (size_t)0);
+    } H5E_END_TRY;
+    if(ret >= 0) TEST_ERROR
+
+    /* Use several threads for small amounts of data */
+    if(H5Pset_type_conv_threads(dxpl, 4, (size_t)1000) < 0) TEST_ERROR
+    if(H5Pget_type_conv_threads(dxpl, &nthreads, &min_elmts) < 0) TEST_ERROR
+    if(nthreads != 4 || min_elmts != 1000) TEST_ERROR
+
+    if(NULL == (ibuf = (int *)HDmalloc(NTESTELEM * sizeof(int)))) TEST_ERROR
+    if(NULL == (ibuf2 = (int *)HDmalloc(NTESTELEM * sizeof(int)))) TEST_ERROR
+    for(u = 0; u < NTESTELEM; u++)
+        ibuf[u] = ibuf2[u] = (int)u - (NTESTELEM / 2);
+
+    /* Byte-order conversion */
+    if(H5Tconvert(H5T_NATIVE_INT, H5T_STD_I32BE, (size_t)NTESTELEM, ibuf, NULL, dxpl) < 0) TEST_ERROR
+    if(H5Tconvert(H5T_NATIVE_INT, H5T_STD_I32BE, (size_t)NTESTELEM, ibuf2, NULL, H5P_DEFAULT) < 0) TEST_ERROR
+    if(HDmemcmp(ibuf, ibuf2, NTESTELEM * sizeof(int))) TEST_ERROR
+    if(H5Tconvert(H5T_STD_I32BE, H5T_NATIVE_INT, (size_t)NTESTELEM, ibuf, NULL, dxpl) < 0) TEST_ERROR
+    for(u = 0; u < NTESTELEM; u++)
+        if(ibuf[u] != (int)u - (NTESTELEM / 2)) TEST_ERROR
+
+    /* Hardware conversion, with an odd number of elements */
+    if(H5Tconvert(H5T_NATIVE_INT, H5T_NATIVE_FLOAT, (size_t)(NTESTELEM - 1), ibuf, NULL, dxpl) < 0) TEST_ERROR
+    for(u = 0; u < NTESTELEM - 1; u++)
+        if(!H5_FLT_ABS_EQUAL(((float *)ibuf)[u], (float)((int)u - (NTESTELEM / 2)))) TEST_ERROR
+    if(ibuf[NTESTELEM - 1] != (NTESTELEM / 2) - 1) TEST_ERROR
+
+    /* Optimized compound conversion, reordering members & swapping bytes */
+    if((src_cmpd = H5Tcreate(H5T_COMPOUND, sizeof(src_cmpd_t))) < 0) TEST_ERROR
+    if(H5Tinsert(src_cmpd, "a", HOFFSET(src_cmpd_t, a), H5T_NATIVE_INT) < 0) TEST_ERROR
+    if(H5Tinsert(src_cmpd, "b", HOFFSET(src_cmpd_t, b), H5T_NATIVE_FLOAT) < 0) TEST_ERROR
+    if((dst_cmpd = H5Tcreate(H5T_COMPOUND, sizeof(src_cmpd_t))) < 0) TEST_ERROR
+    if(H5Tinsert(dst_cmpd, "b", (size_t)0, H5T_NATIVE_FLOAT) < 0) TEST_ERROR
+    if(H5Tinsert(dst_cmpd, "a", sizeof(float), H5T_STD_I32BE) < 0) TEST_ERROR
+    if(H5Tget_size(dst_cmpd) != sizeof(src_cmpd_t)) TEST_ERROR
+
+    if(NULL == (cbuf = (src_cmpd_t *)HDmalloc(NTESTELEM * sizeof(src_cmpd_t)))) TEST_ERROR
+    if(NULL == (cbuf2 = (src_cmpd_t *)HDmalloc(NTESTELEM * sizeof(src_cmpd_t)))) TEST_ERROR
+    if(NULL == (bkg = HDcalloc((size_t)NTESTELEM, sizeof(src_cmpd_t)))) TEST_ERROR
+    for(u = 0; u < NTESTELEM; u++) {
+        cbuf[u].a = cbuf2[u].a = (int)u;
+        cbuf[u].b = cbuf2[u].b = (float)u / 2.0f;
+    } /* end for */
+    if(H5Tconvert(src_cmpd, dst_cmpd, (size_t)NTESTELEM, cbuf, bkg, dxpl) < 0) TEST_ERROR
+    if(H5Tconvert(src_cmpd, dst_cmpd, (size_t)NTESTELEM, cbuf2, bkg, H5P_DEFAULT) < 0) TEST_ERROR
+    if(HDmemcmp(cbuf, cbuf2, NTESTELEM * sizeof(src_cmpd_t))) TEST_ERROR
+    if(H5Tconvert(dst_cmpd, src_cmpd, (size_t)NTESTELEM, cbuf, bkg, dxpl) < 0) TEST_ERROR
+    for(u = 0; u < NTESTELEM; u++)
+        if(cbuf[u].a != (int)u || !H5_FLT_ABS_EQUAL(cbuf[u].b, (float)u / 2.0f)) TEST_ERROR
+
+    /* Use several threads with the default property list */
+    if(H5Pset_type_conv_threads(H5P_DATASET_XFER_DEFAULT, 4, (size_t)1000) < 0) TEST_ERROR
+    if(H5Tconvert(src_cmpd, dst_cmpd, (size_t)NTESTELEM, cbuf, bkg, H5P_DEFAULT) < 0) TEST_ERROR
+    if(HDmemcmp(cbuf, cbuf2, NTESTELEM * sizeof(src_cmpd_t))) TEST_ERROR
+    if(H5Tconvert(dst_cmpd, src_cmpd, (size_t)NTESTELEM, cbuf, bkg, H5P_DEFAULT) < 0) TEST_ERROR
+    for(u = 0; u < NTESTELEM; u++)
+        if(cbuf[u].a != (int)u || !H5_FLT_ABS_EQUAL(cbuf[u].b, (float)u / 2.0f)) TEST_ERROR
+    if(H5Pset_type_conv_threads(H5P_DATASET_XFER_DEFAULT, 1, def_min_elmts) < 0) TEST_ERROR
+
+    if(H5Tclose(src_cmpd) < 0) TEST_ERROR
+    if(H5Tclose(dst_cmpd) < 0) TEST_ERROR
+    if(H5Pclose(dxpl) < 0) TEST_ERROR
+    HDfree(ibuf);
+    HDfree(ibuf2);
+    HDfree(cbuf);
+    HDfree(cbuf2);
+    HDfree(bkg);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(src_cmpd);
+        H5Tclose(dst_cmpd);
+        H5Pclose(dxpl);
+    } H5E_END_TRY;
+    if(ibuf)
+        HDfree(ibuf);
+    if(ibuf2)
+        HDfree(ibuf2);
+    if(cbuf)
+        HDfree(cbuf);
+    if(cbuf2)
+        HDfree(cbuf2);
+    if(bkg)
+        HDfree(bkg);
+    return 1;
+} /* end test_conv_threads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_path_find
+ *
+ * Purpose:     Tests that conversion paths are found through the hash
+ *              index for equal copies of the source and destination
+ *              datatypes, and that modifying a datatype after its path was
+ *              found leads to a different path.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_path_find(void)
+{
+    hid_t       src = -1, dst = -1, src2 = -1, dst2 = -1;
+    H5T_cdata_t *cdata1 = NULL, *cdata2 = NULL;
+    size_t      hits;
+
+    TESTING("conversion path lookup");
+
+    /* Compound source and destination */
+    if((src = H5Tcreate(H5T_COMPOUND, (size_t)8)) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src, "a", (size_t)0, H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src, "b", (size_t)4, H5T_NATIVE_FLOAT) < 0) FAIL_STACK_ERROR
+    if((dst = H5Tcreate(H5T_COMPOUND, (size_t)8)) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(dst, "b", (size_t)0, H5T_NATIVE_FLOAT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(dst, "a", (size_t)4, H5T_STD_I32BE) < 0) FAIL_STACK_ERROR
+    if(NULL == H5Tfind(src, dst, &cdata1)) FAIL_STACK_ERROR
+
+    /* Equal copies find the same path */
+    if((src2 = H5Tcopy(src)) < 0) FAIL_STACK_ERROR
+    if((dst2 = H5Tcopy(dst)) < 0) FAIL_STACK_ERROR
+    hits = H5T_path_hash_hits_g;
+    if(NULL == H5Tfind(src2, dst2, &cdata2)) FAIL_STACK_ERROR
+    if(cdata1 != cdata2) FAIL_PUTS_ERROR("equal datatypes found different paths")
+    if(H5T_path_hash_hits_g != hits + 1) FAIL_PUTS_ERROR("path not found through the hash index")
+
+    /* A modified copy finds a different path */
+    if(H5Tset_size(dst2, (size_t)12) < 0) FAIL_STACK_ERROR
+    if(NULL == H5Tfind(src2, dst2, &cdata2)) FAIL_STACK_ERROR
+    if(cdata1 == cdata2) FAIL_PUTS_ERROR("modified datatype found old path")
+
+    /* The original path is still found, through the hash index */
+    hits = H5T_path_hash_hits_g;
+    if(NULL == H5Tfind(src, dst, &cdata2)) FAIL_STACK_ERROR
+    if(cdata1 != cdata2) FAIL_PUTS_ERROR("original path not found")
+    if(H5T_path_hash_hits_g != hits + 1) FAIL_PUTS_ERROR("original path not found through the hash index")
+
+    if(H5Tclose(src) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(dst) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(src2) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(dst2) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(src);
+        H5Tclose(dst);
+        H5Tclose(src2);
+        H5Tclose(dst2);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_path_find() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	test_conv_order
+ *
+ * Purpose:	Tests byte order conversion of 2, 4, 8 and 16 byte
+ *		integers, for unaligned buffers and for element counts
+ *		which do and don't fill whole vectors.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_order(void)
+{
+    const size_t sizes[] = {2, 4, 8, 16};
+    const size_t counts[] = {0, 1, 7, 31, 33, 100, 1027};
+    hid_t       src = -1, dst = -1;
+    uint8_t     *buf = NULL;
+    size_t      u, v, w, x;
+
+    TESTING("byte order conversion");
+
+    if(NULL == (buf = (uint8_t *)HDmalloc(1 + 16 * 1027)))
+        TEST_ERROR
+
+    for(u = 0; u < NELMTS(sizes); u++) {
+        if((src = H5Tcopy(H5T_STD_U64LE)) < 0) FAIL_STACK_ERROR
+        if(H5Tset_size(src, sizes[u]) < 0) FAIL_STACK_ERROR
+        if((dst = H5Tcopy(src)) < 0) FAIL_STACK_ERROR
+        if(H5Tset_order(dst, H5T_ORDER_BE) < 0) FAIL_STACK_ERROR
+
+        for(v = 0; v < NELMTS(counts); v++) {
+            /* Start one byte in, so the elements are never aligned */
+            for(w = 0; w < sizes[u] * counts[v]; w++)
+                buf[1 + w] = (uint8_t)(w * 7 + 3);
+
+            if(H5Tconvert(src, dst, counts[v], buf + 1, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+
+            for(w = 0; w < counts[v]; w++)
+                for(x = 0; x < sizes[u]; x++)
+                    if(buf[1 + w * sizes[u] + x] != (uint8_t)((w * sizes[u] + sizes[u] - (x + 1)) * 7 + 3)) {
+                        H5_FAILED();
+                        printf("    %u byte element %u of %u not swapped\n", (unsigned)sizes[u], (unsigned)w, (unsigned)counts[v]);
+                        goto error;
+                    } /* end if */
+        } /* end for */
+
+        if(H5Tclose(src) < 0) FAIL_STACK_ERROR
+        if(H5Tclose(dst) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    HDfree(buf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(src);
+        H5Tclose(dst);
+    } H5E_END_TRY;
+    if(buf)
+        HDfree(buf);
+    return 1;
+} /* end test_conv_order() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_conv_half
+ *
+ * Purpose:     Tests the hardware conversions between the 16-bit
+ *              floating-point types and native float and double.
+ *              Widening is checked against the software conversion of
+ *              the same values in the opposite byte order; narrowing is
+ *              checked by converting every value back, and by rounding
+ *              the midpoints between neighboring values (and the numbers
+ *              just either side of them), which must round to nearest
+ *              with ties to even.
+ *
+ * Return:      Success:        0
+ *              Failure:        number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_conv_half(void)
+{
+    struct {
+        const char *name;               /* Name of the format */
+        hid_t       type;               /* Native type of the format */
+        unsigned    inf;                /* Encoding of infinity */
+    } fmt[2];
+    const size_t ncodes = 65536;        /* Number of 16-bit encodings */
+    hid_t       other = -1;             /* Format in the other byte order */
+    hid_t       dxpl = -1;              /* Transfer property list */
+    hid_t       src = -1, dst = -1;     /* Compound types */
+    uint8_t     *raw = NULL;            /* Unaligned work buffer */
+    float       *fvals = NULL;          /* Float value of each encoding */
+    double      *dvals = NULL;          /* Double values */
+    float       *fsoft = NULL;          /* Float values from the software path */
+    double      *mids = NULL;           /* Midpoints and their neighbors */
+    uint16_t    *codes = NULL;          /* 16-bit encodings */
+    except_info_t e;                    /* Exception counts */
+    size_t      u, v, n;
+
+    TESTING("16-bit floating-point conversions");
+
+    fmt[0].name = "half";
+    fmt[0].type = H5T_NATIVE_FLOAT16;
+    fmt[0].inf = 0x7c00;
+    fmt[1].name = "bfloat16";
+    fmt[1].type = H5T_NATIVE_BFLOAT16;
+    fmt[1].inf = 0x7f80;
+
+    if(NULL == (raw = (uint8_t *)HDmalloc(1 + 6 * ncodes * sizeof(double)))) TEST_ERROR
+    if(NULL == (fvals = (float *)HDmalloc(ncodes * sizeof(float)))) TEST_ERROR
+    if(NULL == (dvals = (double *)HDmalloc(ncodes * sizeof(double)))) TEST_ERROR
+    if(NULL == (fsoft = (float *)HDmalloc(ncodes * sizeof(float)))) TEST_ERROR
+    if(NULL == (mids = (double *)HDmalloc(6 * ncodes * sizeof(double)))) TEST_ERROR
+    if(NULL == (codes = (uint16_t *)HDmalloc(6 * ncodes * sizeof(uint16_t)))) TEST_ERROR
+
+    for(u = 0; u < NELMTS(fmt); u++) {
+        unsigned max = fmt[u].inf - 1;  /* Largest finite encoding */
+
+        /* Widen every encoding, from an unaligned buffer */
+        for(v = 0; v < ncodes; v++)
+            codes[v] = (uint16_t)v;
+        HDmemcpy(raw + 1, codes, ncodes * sizeof(uint16_t));
+        if(H5Tconvert(fmt[u].type, H5T_NATIVE_FLOAT, ncodes, raw + 1, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        HDmemcpy(fvals, raw + 1, ncodes * sizeof(float));
+        HDmemcpy(raw + 1, codes, ncodes * sizeof(uint16_t));
+        if(H5Tconvert(fmt[u].type, H5T_NATIVE_DOUBLE, ncodes, raw + 1, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        HDmemcpy(dvals, raw + 1, ncodes * sizeof(double));
+
+        /* The software conversion of the byte-swapped encodings must agree */
+        if((other = H5Tcopy(fmt[u].type)) < 0) FAIL_STACK_ERROR
+        if(H5Tset_order(other, H5T_ORDER_BE == H5Tget_order(fmt[u].type) ? H5T_ORDER_LE : H5T_ORDER_BE) < 0) FAIL_STACK_ERROR
+        for(v = 0; v < ncodes; v++)
+            codes[v] = (uint16_t)((v >> 8) | (v << 8));
+        HDmemcpy(fsoft, codes, ncodes * sizeof(uint16_t));
+        if(H5Tconvert(other, H5T_NATIVE_FLOAT, ncodes, fsoft, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+        if(H5Tclose(other) < 0) FAIL_STACK_ERROR
+        for(v = 0; v < ncodes; v++) {
+            hbool_t nan = (v & 0x7fff) > fmt[u].inf;
+
+            if(nan ? (fvals[v] == fvals[v] || dvals[v] == dvals[v]) :
+                    (HDmemcmp(&fvals[v], &fsoft[v], sizeof(float)) || (double)fvals[v] != dvals[v])) {
+                H5_FAILED();
+                printf("    %s 0x%04x widened to %g and %g, expected %g\n", fmt[u].name, (unsigned)v,
+                        (double)fvals[v], dvals[v], (double)fsoft[v]);
+                goto error;
+            } /* end if */
+        } /* end for */
+
+        /* Every value must narrow back to itself, and NaNs stay NaNs */
+        for(n = 0; n < 2; n++) {
+            if(0 == n) {
+                HDmemcpy(raw + 1, fvals, ncodes * sizeof(float));
+                if(H5Tconvert(H5T_NATIVE_FLOAT, fmt[u].type, ncodes, raw + 1, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+            } /* end if */
+            else {
+                HDmemcpy(raw + 1, dvals, ncodes * sizeof(double));
+                if(H5Tconvert(H5T_NATIVE_DOUBLE, fmt[u].type, ncodes, raw + 1, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+            } /* end else */
+            HDmemcpy(codes, raw + 1, ncodes * sizeof(uint16_t));
+            for(v = 0; v < ncodes; v++)
+                if((v & 0x7fff) > fmt[u].inf ? (codes[v] & 0x7fff) <= fmt[u].inf : codes[v] != v) {
+                    H5_FAILED();
+                    printf("    %s 0x%04x narrowed back from %s to 0x%04x\n", fmt[u].name, (unsigned)v,
+                            n ? "double" : "float", (unsigned)codes[v]);
+                    goto error;
+                } /* end if */
+        } /* end for */
+
+        /* Round the midpoint between each pair of neighbors, and the numbers
+         * just below and above it, of both signs.  Past the largest finite
+         * value the next value is where infinity would be. */
+        for(v = 0; v <= max; v++) {
+            double  lo = dvals[v];
+            double  hi = v < max ? dvals[v + 1] : 2 * lo - dvals[v - 1];
+            double  mid = (lo + hi) / 2;
+            uint64_t bits;
+
+            HDmemcpy(&bits, &mid, sizeof(bits));
+            mids[6 * v] = mid;
+            bits--;
+            HDmemcpy(&mids[6 * v + 1], &bits, sizeof(bits));
+            bits += 2;
+            HDmemcpy(&mids[6 * v + 2], &bits, sizeof(bits));
+            for(n = 0; n < 3; n++)
+                mids[6 * v + 3 + n] = -mids[6 * v + n];
+        } /* end for */
+        for(n = 0; n < 2; n++) {
+            size_t nmids = 6 * (max + 1);
+
+            if(0 == n) {
+                /* Float neighbors of the midpoints are one float ulp away */
+                for(v = 0; v < nmids; v++) {
+                    float       f = (float)mids[v - v % 3];
+                    uint32_t    fbits;
+
+                    HDmemcpy(&fbits, &f, sizeof(fbits));
+                    if(1 == v % 3)
+                        fbits--;
+                    else if(2 == v % 3)
+                        fbits++;
+                    HDmemcpy(raw + 1 + v * sizeof(float), &fbits, sizeof(fbits));
+                } /* end for */
+                if(H5Tconvert(H5T_NATIVE_FLOAT, fmt[u].type, nmids, raw + 1, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+            } /* end if */
+            else {
+                HDmemcpy(raw + 1, mids, nmids * sizeof(double));
+                if(H5Tconvert(H5T_NATIVE_DOUBLE, fmt[u].type, nmids, raw + 1, NULL, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+            } /* end else */
+            HDmemcpy(codes, raw + 1, nmids * sizeof(uint16_t));
+            for(v = 0; v < nmids; v++) {
+                unsigned    lo = (unsigned)(v / 6);
+                unsigned    expect = (1 == v % 3) ? lo : (2 == v % 3) ? lo + 1 : (lo & 1) ? lo + 1 : lo;
+
+                if(v % 6 >= 3)
+                    expect |= 0x8000;
+                if(codes[v] != expect) {
+                    H5_FAILED();
+                    printf("    %s %s %.17g rounded to 0x%04x, expected 0x%04x\n", fmt[u].name,
+                            n ? "double" : "float", mids[v], (unsigned)codes[v], expect);
+                    goto error;
+                } /* end if */
+            } /* end for */
+        } /* end for */
+    } /* end for */
+
+    /* Values too large to narrow are reported to the exception callback */
+    HDmemset(&e, 0, sizeof(except_info_t));
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_type_conv_cb(dxpl, conv_except, &e) < 0) FAIL_STACK_ERROR
+    fvals[0] = 1.0e6f;
+    fvals[1] = -1.0e6f;
+    fvals[2] = 1.0f;
+    fvals[3] = fvals[0] * fvals[0] * fvals[0] * fvals[0] * fvals[0] * fvals[0] * fvals[0];
+    if(H5Tconvert(H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT16, (size_t)4, fvals, NULL, dxpl) < 0) FAIL_STACK_ERROR
+    HDmemcpy(codes, fvals, 4 * sizeof(uint16_t));
+    if(codes[0] != 0x7c00 || codes[1] != 0xfc00 || codes[2] != 0x3c00 || codes[3] != 0x7c00) TEST_ERROR
+    if(e.num_range_hi != 1 || e.num_range_low != 1 || e.num_precision || e.num_truncate || e.num_other) TEST_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+
+    /* Strided conversion of a compound member */
+    if((src = H5Tcreate(H5T_COMPOUND, (size_t)8)) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src, "v", (size_t)0, H5T_NATIVE_FLOAT16) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(src, "i", (size_t)4, H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+    if((dst = H5Tcreate(H5T_COMPOUND, (size_t)8)) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(dst, "v", (size_t)0, H5T_NATIVE_FLOAT) < 0) FAIL_STACK_ERROR
+    if(H5Tinsert(dst, "i", (size_t)4, H5T_NATIVE_INT) < 0) FAIL_STACK_ERROR
+    for(v = 0; v < 300; v++) {
+        uint16_t    h = (uint16_t)(0x3c00 + v);     /* 1.0 and up */
+        int         i = (int)v;
+
+        HDmemcpy(raw + v * 8, &h, sizeof(h));
+        HDmemcpy(raw + v * 8 + 4, &i, sizeof(i));
+    } /* end for */
+    if(H5Tconvert(src, dst, (size_t)300, raw, mids, H5P_DEFAULT) < 0) FAIL_STACK_ERROR
+    for(v = 0; v < 300; v++) {
+        float       f;
+        int         i;
+
+        HDmemcpy(&f, raw + v * 8, sizeof(f));
+        HDmemcpy(&i, raw + v * 8 + 4, sizeof(i));
+        if(f != 1.0f + (float)v / 1024.0f || i != (int)v) {
+            H5_FAILED();
+            printf("    compound element %u converted to {%g, %d}\n", (unsigned)v, (double)f, i);
+            goto error;
+        } /* end if */
+    } /* end for */
+    if(H5Tclose(src) < 0) FAIL_STACK_ERROR
+    if(H5Tclose(dst) < 0) FAIL_STACK_ERROR
+
+    HDfree(raw);
+    HDfree(fvals);
+    HDfree(dvals);
+    HDfree(fsoft);
+    HDfree(mids);
+    HDfree(codes);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Tclose(other);
+        H5Tclose(src);
+        H5Tclose(dst);
+        H5Pclose(dxpl);
+    } H5E_END_TRY;
+    if(raw)
+        HDfree(raw);
+    if(fvals)
+        HDfree(fvals);
+    if(dvals)
+        HDfree(dvals);
+    if(fsoft)
+        HDfree(fsoft);
+    if(mids)
+        HDfree(mids);
+    if(codes)
+        HDfree(codes);
+    return 1;
+} /* end test_conv_half() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_set_order_compound
@@ -7468,13 +8504,20 @@ main(void)
     nerrors += test_compound_16();
     nerrors += test_compound_17();
     nerrors += test_compound_18();
+    nerrors += test_compound_19();
+    nerrors += test_compound_20();
     nerrors += test_conv_enum_1();
     nerrors += test_conv_enum_2();
+    nerrors += test_conv_enum_3();
     nerrors += test_conv_bitfield();
     nerrors += test_bitfield_funcs();
     nerrors += test_opaque();
     nerrors += test_set_order();
     nerrors += test_utf_ascii_conv();
+    nerrors += test_conv_threads();
+    nerrors += test_path_find();
+    nerrors += test_conv_order();
+    nerrors += test_conv_half();
 
     if(nerrors) {
         printf("***** %lu FAILURE%s! *****\n",
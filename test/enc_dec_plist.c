@@ -121,7 +121,8 @@ main(void)
 	H5AC__CURR_CACHE_IMAGE_CONFIG_VERSION,
 	TRUE,
         FALSE,
-	-1};
+	-1,
+        TRUE};
 
     if(VERBOSE_MED)
 	printf("Encode/Decode DCPLs\n");
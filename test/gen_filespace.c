@@ -50,7 +50,7 @@ static void gen_file(void)
 	/* Get a copy of the default file creation property */
 	fcpl = H5Pcreate(H5P_FILE_CREATE);
 
-	if(fs_type == H5F_FILE_SPACE_NTYPES) /* last file */
+	if(j == NELMTS(FILENAMES) - 1) /* last file */
 	    /* Set default strategy but non-default threshold */
 	    H5Pset_file_space(fcpl, H5F_FILE_SPACE_ALL, (hsize_t)TEST_THRESHOLD2);
 	else
@@ -55,6 +55,7 @@ const char *FILENAME[] = {
     "gheap3",
     "gheap4",
     "gheapooo",
+    "gheapmulti",
     NULL
 };
 
@@ -561,6 +562,145 @@ test_ooo_indices(hid_t fapl)
     return MAX(1, nerrors);
 } /* end test_ooo_indices */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_multi
+ *
+ * Purpose:	Writes a batch of objects to the global heap with
+ *		H5HG_insert_multi() and reads them back with
+ *		H5HG_read_multi(), in reverse order.  The objects should be
+ *		packed in order into a few collections, apart from any
+ *		trailing group too small for a collection of its own.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	number of errors
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_multi(hid_t fapl)
+{
+    hid_t	file = -1;
+    H5F_t 	*f = NULL;
+    H5HG_t	*obj = NULL;
+    H5HG_t	*robj = NULL;
+    uint8_t	*out = NULL;
+    uint8_t	*in = NULL;
+    size_t	*size = NULL;
+    void	**out_ptr = NULL;
+    void	**in_ptr = NULL;
+    size_t	total = 0;
+    size_t	ncoll = 1;
+    size_t	u;
+    int		nerrors = 0;
+    char	filename[1024];
+
+    TESTING("bulk insert and read");
+
+    /* Allocate buffers */
+    if(NULL == (obj = (H5HG_t *)HDmalloc(sizeof(H5HG_t) * GHEAP_TEST_NOBJS)))
+        goto error;
+    if(NULL == (robj = (H5HG_t *)HDmalloc(sizeof(H5HG_t) * GHEAP_TEST_NOBJS)))
+        goto error;
+    if(NULL == (size = (size_t *)HDmalloc(sizeof(size_t) * GHEAP_TEST_NOBJS)))
+        goto error;
+    if(NULL == (out_ptr = (void **)HDmalloc(sizeof(void *) * GHEAP_TEST_NOBJS)))
+        goto error;
+    if(NULL == (in_ptr = (void **)HDmalloc(sizeof(void *) * GHEAP_TEST_NOBJS)))
+        goto error;
+    for(u = 0; u < GHEAP_TEST_NOBJS; u++)
+        total += size[u] = u % 100;
+    if(NULL == (out = (uint8_t *)HDmalloc(total)))
+        goto error;
+    if(NULL == (in = (uint8_t *)HDcalloc((size_t)1, total)))
+        goto error;
+    for(u = 0, total = 0; u < GHEAP_TEST_NOBJS; u++) {
+        out_ptr[u] = out + total;
+        in_ptr[GHEAP_TEST_NOBJS - 1 - u] = in + total;
+        HDmemset(out_ptr[u], (int)('A' + u % 26), size[u]);
+        total += size[u];
+    } /* end for */
+
+    /* Open a clean file */
+    h5_fixname(FILENAME[5], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+	goto error;
+    if(NULL == (f = (H5F_t *)H5I_object(file))) {
+	H5_FAILED();
+	puts("    Unable to create file");
+	goto error;
+    }
+
+    /* Write the objects */
+    if(H5HG_insert_multi(f, H5AC_ind_read_dxpl_id, (size_t)GHEAP_TEST_NOBJS, size, out_ptr, obj) < 0) {
+        H5_FAILED();
+        puts("    Unable to insert objects into global heap");
+        goto error;
+    } /* end if */
+
+    /* The objects should be grouped into collections in order */
+    for(u = 1; u < GHEAP_TEST_NOBJS; u++)
+        if(H5F_addr_ne(obj[u - 1].addr, obj[u].addr)) {
+            ncoll++;
+            if(H5F_addr_gt(obj[u - 1].addr, obj[u].addr))
+                GHEAP_REPEATED_ERR("    Collection addresses are not monotonically increasing")
+        } /* end if */
+    if(ncoll > (total / (H5HG_MAXSIZE / 2)) + 2) {
+        H5_FAILED();
+        printf("    Objects spread over too many collections: %u\n", (unsigned)ncoll);
+        nerrors++;
+    } /* end if */
+
+    /* Read the objects back, in reverse order */
+    for(u = 0; u < GHEAP_TEST_NOBJS; u++)
+        robj[u] = obj[GHEAP_TEST_NOBJS - 1 - u];
+    if(H5HG_read_multi(f, H5AC_ind_read_dxpl_id, (size_t)GHEAP_TEST_NOBJS, robj, in_ptr) < 0) {
+        H5_FAILED();
+        puts("    Unable to read objects");
+        goto error;
+    } /* end if */
+    for(u = 0; u < GHEAP_TEST_NOBJS; u++)
+        if(HDmemcmp(in_ptr[GHEAP_TEST_NOBJS - 1 - u], out_ptr[u], size[u]))
+            GHEAP_REPEATED_ERR("    Value read doesn't match value written")
+
+    if(H5Fclose(file) < 0) goto error;
+    if(nerrors) goto error;
+
+    /* Release buffers */
+    HDfree(obj);
+    HDfree(robj);
+    HDfree(size);
+    HDfree(out_ptr);
+    HDfree(in_ptr);
+    HDfree(out);
+    HDfree(in);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+	H5Fclose(file);
+    } H5E_END_TRY;
+    if(obj)
+        HDfree(obj);
+    if(robj)
+        HDfree(robj);
+    if(size)
+        HDfree(size);
+    if(out_ptr)
+        HDfree(out_ptr);
+    if(in_ptr)
+        HDfree(in_ptr);
+    if(out)
+        HDfree(out);
+    if(in)
+        HDfree(in);
+    return MAX(1, nerrors);
+} /* end test_multi() */
+
+
 
 /*-------------------------------------------------------------------------
  * Function:	main
@@ -592,6 +732,7 @@ main (void)
     nerrors += test_3(fapl);
     nerrors += test_4(fapl);
     nerrors += test_ooo_indices(fapl);
+    nerrors += test_multi(fapl);
 
     /* Verify symbol table messages are cached */
     nerrors += (h5_verify_cached_stabs(FILENAME, fapl) < 0 ? 1 : 0);
@@ -71,6 +71,9 @@
 #define TEST_THRESHOLD10	10
 #define TEST_THRESHOLD3		3
 
+#define TEST_PAGE_SIZE		2048
+#define TEST_NPAGE_BLOCKS	8
+
 #define CORE_INCREMENT  1024
 #define FAMILY_SIZE     1024
 
@@ -7122,6 +7125,10 @@ test_filespace_strategy_threshold(hid_t fapl_new)
 
 	for(fs_type = H5F_FILE_SPACE_ALL_PERSIST; fs_type < H5F_FILE_SPACE_NTYPES; H5_INC_ENUM(H5F_file_space_type_t, fs_type)) {
 
+	    /* The split and multi drivers can't allocate in pages */
+	    if(fs_type == H5F_FILE_SPACE_PAGE && H5Pget_driver(fapl_new) == H5FD_MULTI)
+		continue;
+
 	    /* Create file-creation template */
 	    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
 		FAIL_STACK_ERROR
@@ -7167,7 +7174,7 @@ test_filespace_strategy_threshold(hid_t fapl_new)
 		    FAIL_STACK_ERROR
 
 	    /* H5F_FILE_SPACE_AGGR_VFD and H5F_FILE_SPACE_VFD: should not have free-space manager */
-	    if(fs_type > H5F_FILE_SPACE_ALL && f->shared->fs_man[type])
+	    if((fs_type == H5F_FILE_SPACE_AGGR_VFD || fs_type == H5F_FILE_SPACE_VFD) && f->shared->fs_man[type])
 		TEST_ERROR
 
 	    /* Close the file */
@@ -7184,6 +7191,7 @@ test_filespace_strategy_threshold(hid_t fapl_new)
 
 	    switch(fs_type) {
 		case H5F_FILE_SPACE_ALL_PERSIST:
+		case H5F_FILE_SPACE_PAGE:
 		    if(fs_threshold <= TEST_BLOCK_SIZE5) {
 			if(!H5F_addr_defined(f->shared->fs_addr[type]))
 			    TEST_ERROR
@@ -7382,6 +7390,187 @@ error:
     return(1);
 } /* test_filespace_gone() */
 
+/*
+ * Verify that file space is allocated and freed in whole pages for
+ * the H5F_FILE_SPACE_PAGE strategy: small blocks do not cross page
+ * boundaries, large blocks start on a page boundary, and the free-space
+ * sections and the page size persist across file close and re-open.
+ */
+static unsigned
+test_filespace_page(hid_t fapl_new)
+{
+    hid_t	file = -1;              /* File ID */
+    hid_t	fcpl = -1;		/* File creation property list template */
+    hid_t	fcpl2 = -1;		/* File creation property list from the file */
+    char	filename[FILENAME_LEN]; /* Filename to use */
+    H5F_t	*f = NULL;              /* Internal file object pointer */
+    H5FD_mem_t 	type;			/* File allocation type */
+    haddr_t	small_addr[TEST_NPAGE_BLOCKS]; /* Addresses of the small blocks */
+    haddr_t	large_addr, tmp_addr;	/* Addresses of the large blocks */
+    H5F_sect_info_t sect_info[TEST_NPAGE_BLOCKS * 4]; /* Free-space section information */
+    H5F_file_space_type_t fs_type;	/* File space handling strategy */
+    hsize_t	fs_threshold;		/* Free space section threshold */
+    hsize_t	page_size;		/* File space page size */
+    htri_t	was_extended;		/* Whether the block was extended */
+    ssize_t	nsects;			/* # of free-space sections */
+    herr_t	ret;			/* Return value */
+    int		i;			/* Local index variable */
+
+    TESTING("file space paged allocation");
+
+    /* Set the filename to use for this test (dependent on fapl) */
+    h5_fixname(FILENAME[0], fapl_new, filename, sizeof(filename));
+
+    /* Create file-creation template */
+    if((fcpl = H5Pcreate(H5P_FILE_CREATE)) < 0)
+	FAIL_STACK_ERROR
+
+    /* The page size must be a power of two and not too small */
+    H5E_BEGIN_TRY {
+	ret = H5Pset_file_space_page_size(fcpl, (hsize_t)TEST_BLOCK_SIZE200);
+    } H5E_END_TRY;
+    if(ret >= 0)
+	TEST_ERROR
+    H5E_BEGIN_TRY {
+	ret = H5Pset_file_space_page_size(fcpl, (hsize_t)TEST_BLOCK_SIZE1970);
+    } H5E_END_TRY;
+    if(ret >= 0)
+	TEST_ERROR
+
+    if(H5Pset_file_space(fcpl, H5F_FILE_SPACE_PAGE, (hsize_t)1) < 0)
+	FAIL_STACK_ERROR
+    if(H5Pset_file_space_page_size(fcpl, (hsize_t)TEST_PAGE_SIZE) < 0)
+	FAIL_STACK_ERROR
+    if(H5Pget_file_space_page_size(fcpl, &page_size) < 0)
+	FAIL_STACK_ERROR
+    if(page_size != TEST_PAGE_SIZE)
+	TEST_ERROR
+
+    /* The split and multi drivers can't allocate in pages */
+    if(H5Pget_driver(fapl_new) == H5FD_MULTI) {
+	H5E_BEGIN_TRY {
+	    file = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl_new);
+	} H5E_END_TRY;
+	if(file >= 0)
+	    TEST_ERROR
+
+	if(H5Pclose(fcpl) < 0)
+	    FAIL_STACK_ERROR
+
+	PASSED()
+
+	return(0);
+    } /* end if */
+
+    /* Create the file to work on */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, fcpl, fapl_new)) < 0)
+	FAIL_STACK_ERROR
+
+    /* Get a pointer to the internal file object */
+    if(NULL == (f = (H5F_t *)H5I_object(file)))
+	FAIL_STACK_ERROR
+
+    /* Allocate small blocks: none of them may cross a page boundary */
+    type = H5FD_MEM_SUPER;
+    for(i = 0; i < TEST_NPAGE_BLOCKS; i++) {
+	if(HADDR_UNDEF == (small_addr[i] = H5MF_alloc(f, type, H5AC_ind_read_dxpl_id, (hsize_t)TEST_BLOCK_SIZE700)))
+	    FAIL_STACK_ERROR
+	if((small_addr[i] % TEST_PAGE_SIZE) + TEST_BLOCK_SIZE700 > TEST_PAGE_SIZE)
+	    TEST_ERROR
+    } /* end for */
+
+    /* Allocate a large block: it must start on a page boundary */
+    if(HADDR_UNDEF == (large_addr = H5MF_alloc(f, H5FD_MEM_DRAW, H5AC_ind_read_dxpl_id, (hsize_t)TEST_BLOCK_SIZE8000)))
+	FAIL_STACK_ERROR
+    if(large_addr % TEST_PAGE_SIZE)
+	TEST_ERROR
+
+    /* The large block may grow into the rest of its last page, but no further */
+    was_extended = H5MF_try_extend(f, H5AC_ind_read_dxpl_id, H5FD_MEM_DRAW, large_addr, (hsize_t)TEST_BLOCK_SIZE8000, (hsize_t)(TEST_PAGE_SIZE * 4 - TEST_BLOCK_SIZE8000));
+    if(was_extended != TRUE)
+	TEST_ERROR
+
+    /* Allocate another small block, past the pages of the large block */
+    if(HADDR_UNDEF == (tmp_addr = H5MF_alloc(f, type, H5AC_ind_read_dxpl_id, (hsize_t)TEST_BLOCK_SIZE1034)))
+	FAIL_STACK_ERROR
+    if(H5F_addr_overlap(tmp_addr, (hsize_t)TEST_BLOCK_SIZE1034, large_addr, (hsize_t)(TEST_PAGE_SIZE * 4)))
+	TEST_ERROR
+    if((tmp_addr % TEST_PAGE_SIZE) + TEST_BLOCK_SIZE1034 > TEST_PAGE_SIZE)
+	TEST_ERROR
+
+    /* Free every other small block and the large block */
+    for(i = 0; i < TEST_NPAGE_BLOCKS; i += 2)
+	if(H5MF_xfree(f, type, H5AC_ind_read_dxpl_id, small_addr[i], (hsize_t)TEST_BLOCK_SIZE700) < 0)
+	    FAIL_STACK_ERROR
+    if(H5MF_xfree(f, H5FD_MEM_DRAW, H5AC_ind_read_dxpl_id, large_addr, (hsize_t)(TEST_PAGE_SIZE * 4)) < 0)
+	FAIL_STACK_ERROR
+
+    /* Every free-space section lies within one page or starts on a page boundary */
+    if((nsects = H5Fget_free_sections(file, H5FD_MEM_DEFAULT, (size_t)(TEST_NPAGE_BLOCKS * 4), sect_info)) < 0)
+	FAIL_STACK_ERROR
+    if(nsects == 0 || nsects > TEST_NPAGE_BLOCKS * 4)
+	TEST_ERROR
+    for(i = 0; i < (int)nsects; i++)
+	if((sect_info[i].addr % TEST_PAGE_SIZE) && (sect_info[i].addr % TEST_PAGE_SIZE) + sect_info[i].size > TEST_PAGE_SIZE)
+	    TEST_ERROR
+
+    /* Close the file */
+    if(H5Fclose(file) < 0)
+	FAIL_STACK_ERROR
+
+    /* Re-open the file */
+    if((file = H5Fopen(filename, H5F_ACC_RDWR, fapl_new)) < 0)
+	FAIL_STACK_ERROR
+
+    /* The strategy and the page size are retained */
+    if((fcpl2 = H5Fget_create_plist(file)) < 0)
+	FAIL_STACK_ERROR
+    if(H5Pget_file_space(fcpl2, &fs_type, &fs_threshold) < 0)
+	FAIL_STACK_ERROR
+    if(fs_type != H5F_FILE_SPACE_PAGE || fs_threshold != 1)
+	TEST_ERROR
+    if(H5Pget_file_space_page_size(fcpl2, &page_size) < 0)
+	FAIL_STACK_ERROR
+    if(page_size != TEST_PAGE_SIZE)
+	TEST_ERROR
+    if(H5Pclose(fcpl2) < 0)
+	FAIL_STACK_ERROR
+
+    /* Get a pointer to the internal file object */
+    if(NULL == (f = (H5F_t *)H5I_object(file)))
+	FAIL_STACK_ERROR
+
+    /* The free-space sections persist */
+    if(!H5F_addr_defined(f->shared->fs_addr[type]))
+	TEST_ERROR
+    if(H5Fget_free_sections(file, H5FD_MEM_DEFAULT, (size_t)0, NULL) < nsects)
+	TEST_ERROR
+
+    /* A freed large block is reused for a small block */
+    if(HADDR_UNDEF == (tmp_addr = H5MF_alloc(f, H5FD_MEM_DRAW, H5AC_ind_read_dxpl_id, (hsize_t)TEST_BLOCK_SIZE2048)))
+	FAIL_STACK_ERROR
+    if(tmp_addr != large_addr)
+	TEST_ERROR
+
+    /* Closing */
+    if(H5Fclose(file) < 0)
+	FAIL_STACK_ERROR
+    if(H5Pclose(fcpl) < 0)
+	FAIL_STACK_ERROR
+
+    PASSED()
+
+    return(0);
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fcpl);
+        H5Pclose(fcpl2);
+	H5Fclose(file);
+    } H5E_END_TRY;
+    return(1);
+} /* test_filespace_page() */
+
 /*
  * Tests to verify file space management for different drivers.
  */
@@ -7424,6 +7613,7 @@ test_filespace_drivers(hid_t fapl)
 
 	ret += test_filespace_strategy_threshold(fapl_new);
 	ret += test_filespace_gone(fapl_new);
+	ret += test_filespace_page(fapl_new);
 
 	h5_clean_files(FILENAME, fapl_new);
 
@@ -7437,6 +7627,7 @@ test_filespace_drivers(hid_t fapl)
 
 	ret += test_filespace_strategy_threshold(fapl_new);
 	ret += test_filespace_gone(fapl_new);
+	ret += test_filespace_page(fapl_new);
 
 	h5_clean_files(FILENAME, fapl_new);
 
@@ -7451,6 +7642,7 @@ test_filespace_drivers(hid_t fapl)
 
 	ret += test_filespace_strategy_threshold(fapl_new);
 	ret += test_filespace_gone(fapl_new);
+	ret += test_filespace_page(fapl_new);
 
 	h5_clean_files(FILENAME, fapl_new);
 
@@ -7464,6 +7656,7 @@ test_filespace_drivers(hid_t fapl)
 
 	ret += test_filespace_strategy_threshold(fapl_new);
 	ret += test_filespace_gone(fapl_new);
+	ret += test_filespace_page(fapl_new);
 
 	h5_clean_files(FILENAME, fapl_new);
 
@@ -7478,6 +7671,7 @@ test_filespace_drivers(hid_t fapl)
 
 	ret += test_filespace_strategy_threshold(fapl_new);
 	ret += test_filespace_gone(fapl_new);
+	ret += test_filespace_page(fapl_new);
 
 	h5_clean_files(FILENAME, fapl_new);
 
@@ -7493,6 +7687,7 @@ test_filespace_drivers(hid_t fapl)
 
 	ret += test_filespace_strategy_threshold(fapl_new);
 	ret += test_filespace_gone(fapl_new);
+	ret += test_filespace_page(fapl_new);
 
 	h5_clean_files(FILENAME, fapl_new);
 
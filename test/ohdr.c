@@ -33,6 +33,14 @@
 #define H5G_FRIEND		/*suppress error about including H5Gpkg	  */
 #include "H5Gpkg.h"
 
+/*
+ * This file needs to access private datatypes from the H5C and H5F packages.
+ */
+#define H5C_FRIEND		/*suppress error about including H5Cpkg	  */
+#include "H5Cpkg.h"
+#define H5F_FRIEND		/*suppress error about including H5Fpkg	  */
+#include "H5Fpkg.h"
+
 const char *FILENAME[] = {
     "ohdr",
     NULL
@@ -158,6 +166,270 @@ error:
     return FAIL;
 } /* end test_cont() */
 
+/*
+ *  Verify that the continuation chunks of an object header, and the header
+ *      of a dataset's chunk index, are prefetched into the metadata cache
+ *      when the object header is loaded:
+ *	Create an object header with several continuation chunks
+ *	Close & re-open the file, and protect the object header
+ *	All the chunks should be in the cache as chunks, not prefetched entries
+ *	All the messages should be readable
+ *	Create a chunked dataset with an extensible array index and a
+ *	    continuation chunk
+ *	Close & re-open the file, and protect the dataset's object header
+ *	The index header should be in the cache
+ *	The dataset should be readable, using the prefetched index header
+ */
+static herr_t
+test_prefetch(char *filename, hid_t fapl)
+{
+    hid_t	file = -1;
+    H5F_t	*f = NULL;
+    H5O_loc_t	oh_loc, oh_locB;
+    H5O_t       *oh = NULL;
+    H5C_cache_entry_t *entry_ptr;
+    H5O_layout_t layout;
+    H5O_info_t  oinfo;
+    hid_t       my_fapl = -1, dcpl = -1, sid = -1, asid = -1;
+    hid_t       dset = -1, attr = -1;
+    hsize_t     dims[1] = {8}, max_dims[1] = {H5S_UNLIMITED}, chunk_dims[1] = {4};
+    hsize_t     adims[1] = {64};
+    haddr_t     idx_addr;
+    time_t	time_new;
+    size_t      nchunks;
+    size_t      u;
+    unsigned    status;
+    int         nmesgs;
+    int         wbuf[8], rbuf[8], abuf[64];
+    int		i;
+
+    TESTING("object header continuation chunk prefetch");
+
+    HDmemset(&oh_loc, 0, sizeof(oh_loc));
+    HDmemset(&oh_locB, 0, sizeof(oh_locB));
+
+    /* Create an object header with several chunks */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(NULL == (f = (H5F_t *)H5I_object(file)))
+        FAIL_STACK_ERROR
+    if(H5AC_ignore_tags(f) < 0)
+        FAIL_STACK_ERROR
+    if(H5O_create(f, H5AC_ind_read_dxpl_id, (size_t)H5O_MIN_SIZE, (size_t)0, H5P_GROUP_CREATE_DEFAULT, &oh_loc/*out*/) < 0)
+        FAIL_STACK_ERROR
+    if(1 != H5O_link(&oh_loc, 1, H5AC_ind_read_dxpl_id))
+        FAIL_STACK_ERROR
+    if(H5O_create(f, H5AC_ind_read_dxpl_id, (size_t)H5O_MIN_SIZE, (size_t)0, H5P_GROUP_CREATE_DEFAULT, &oh_locB/*out*/) < 0)
+        FAIL_STACK_ERROR
+    if(1 != H5O_link(&oh_locB, 1, H5AC_ind_read_dxpl_id))
+        FAIL_STACK_ERROR
+
+    /* (Interleave the messages with those of another object header, and
+     *  flush them to the file, so the chunks can't just be extended)
+     */
+    for(i = 0; i < 40; i++) {
+        time_new = (i + 1) * 1000 + 1000000;
+        if(H5O_msg_create(&oh_loc, H5O_MTIME_ID, 0, 0, &time_new, H5AC_ind_read_dxpl_id) < 0)
+            FAIL_STACK_ERROR
+        if(H5O_msg_create(&oh_locB, H5O_MTIME_ID, 0, 0, &time_new, H5AC_ind_read_dxpl_id) < 0)
+            FAIL_STACK_ERROR
+        if(H5AC_flush(f, H5AC_ind_read_dxpl_id) < 0)
+            FAIL_STACK_ERROR
+    } /* end for */
+    if(NULL == (oh = H5O_protect(&oh_loc, H5AC_ind_read_dxpl_id, H5AC__READ_ONLY_FLAG, FALSE)))
+        FAIL_STACK_ERROR
+    nchunks = oh->nchunks;
+    if(H5O_unprotect(&oh_loc, H5AC_ind_read_dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+        FAIL_STACK_ERROR
+    oh = NULL;
+    if(nchunks < 3)
+        TEST_ERROR
+    if(H5O_close(&oh_loc, NULL) < 0)
+        FAIL_STACK_ERROR
+    if(H5O_close(&oh_locB, NULL) < 0)
+        FAIL_STACK_ERROR
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    /* Re-open the file and load the object header */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(NULL == (f = (H5F_t *)H5I_object(file)))
+        FAIL_STACK_ERROR
+    if(H5AC_ignore_tags(f) < 0)
+        FAIL_STACK_ERROR
+    oh_loc.file = f;
+    if(NULL == (oh = H5O_protect(&oh_loc, H5AC_ind_read_dxpl_id, H5AC__READ_ONLY_FLAG, FALSE)))
+        FAIL_STACK_ERROR
+    if(oh->nchunks != nchunks)
+        TEST_ERROR
+
+    /* No prefetched entries should be left over */
+    for(entry_ptr = f->shared->cache->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(entry_ptr->prefetched)
+            TEST_ERROR
+    for(u = 1; u < oh->nchunks; u++) {
+        status = 0;
+        if(H5AC_get_entry_status(f, oh->chunk[u].addr, &status) < 0)
+            FAIL_STACK_ERROR
+        if(!(status & H5AC_ES__IN_CACHE))
+            TEST_ERROR
+    } /* end for */
+#if H5C_COLLECT_CACHE_STATS
+    if(f->shared->cache->prefetch_hits != f->shared->cache->prefetches)
+        TEST_ERROR
+#endif /* H5C_COLLECT_CACHE_STATS */
+    if(H5O_unprotect(&oh_loc, H5AC_ind_read_dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+        FAIL_STACK_ERROR
+    oh = NULL;
+
+    /* All the messages should be there */
+    if((nmesgs = H5O_msg_count(&oh_loc, H5O_MTIME_ID, H5AC_ind_read_dxpl_id)) < 0)
+        FAIL_STACK_ERROR
+    if(nmesgs != 40)
+        TEST_ERROR
+
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    /* Create a chunked dataset indexed with an extensible array, and give
+     *  its object header a continuation chunk by adding attributes after
+     *  the index and the raw data are allocated
+     */
+    if((my_fapl = H5Pcopy(fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_libver_bounds(my_fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        FAIL_STACK_ERROR
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(1, dims, max_dims)) < 0)
+        FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 1, chunk_dims) < 0)
+        FAIL_STACK_ERROR
+    if((dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < 8; i++)
+        wbuf[i] = i * 3;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        FAIL_STACK_ERROR
+    if(H5Fflush(file, H5F_SCOPE_GLOBAL) < 0)
+        FAIL_STACK_ERROR
+    if((asid = H5Screate_simple(1, adims, NULL)) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(abuf, 0, sizeof(abuf));
+    for(i = 0; i < 4; i++) {
+        char attrname[16];
+
+        HDsnprintf(attrname, sizeof(attrname), "attr%d", i);
+        if((attr = H5Acreate2(dset, attrname, H5T_NATIVE_INT, asid, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            FAIL_STACK_ERROR
+        if(H5Awrite(attr, H5T_NATIVE_INT, abuf) < 0)
+            FAIL_STACK_ERROR
+        if(H5Aclose(attr) < 0)
+            FAIL_STACK_ERROR
+        attr = -1;
+    } /* end for */
+    if(H5Oget_info(dset, &oinfo) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dclose(dset) < 0)
+        FAIL_STACK_ERROR
+    dset = -1;
+
+    /* Find the address of the chunk index */
+    if(NULL == (f = (H5F_t *)H5I_object(file)))
+        FAIL_STACK_ERROR
+    if(H5AC_ignore_tags(f) < 0)
+        FAIL_STACK_ERROR
+    oh_loc.file = f;
+    oh_loc.addr = oinfo.addr;
+    if(NULL == H5O_msg_read(&oh_loc, H5O_LAYOUT_ID, &layout, H5AC_ind_read_dxpl_id))
+        FAIL_STACK_ERROR
+    idx_addr = layout.storage.u.chunk.idx_addr;
+    if(layout.storage.u.chunk.idx_type != H5D_CHUNK_IDX_EARRAY)
+        TEST_ERROR
+    if(H5O_msg_reset(H5O_LAYOUT_ID, &layout) < 0)
+        FAIL_STACK_ERROR
+    if(!H5F_addr_defined(idx_addr))
+        TEST_ERROR
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+
+    /* Re-open the file and load the dataset's object header */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+        FAIL_STACK_ERROR
+    if(NULL == (f = (H5F_t *)H5I_object(file)))
+        FAIL_STACK_ERROR
+    if(H5AC_ignore_tags(f) < 0)
+        FAIL_STACK_ERROR
+    oh_loc.file = f;
+    if(NULL == (oh = H5O_protect(&oh_loc, H5AC_ind_read_dxpl_id, H5AC__READ_ONLY_FLAG, FALSE)))
+        FAIL_STACK_ERROR
+    if(oh->nchunks < 2)
+        TEST_ERROR
+    if(H5O_unprotect(&oh_loc, H5AC_ind_read_dxpl_id, oh, H5AC__NO_FLAGS_SET) < 0)
+        FAIL_STACK_ERROR
+    oh = NULL;
+
+    /* The index header should have been read with the chunk */
+    status = 0;
+    if(H5AC_get_entry_status(f, idx_addr, &status) < 0)
+        FAIL_STACK_ERROR
+    if(!(status & H5AC_ES__IN_CACHE))
+        TEST_ERROR
+
+    /* The data should be readable through the prefetched index header */
+    if((dset = H5Dopen2(file, "dset", H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        FAIL_STACK_ERROR
+    for(i = 0; i < 8; i++)
+        if(rbuf[i] != wbuf[i])
+            TEST_ERROR
+    for(entry_ptr = f->shared->cache->il_head; entry_ptr != NULL; entry_ptr = entry_ptr->il_next)
+        if(entry_ptr->prefetched)
+            TEST_ERROR
+#if H5C_COLLECT_CACHE_STATS
+    if(f->shared->cache->prefetches < 2 || f->shared->cache->prefetch_hits != f->shared->cache->prefetches)
+        TEST_ERROR
+#endif /* H5C_COLLECT_CACHE_STATS */
+    if(H5Dclose(dset) < 0)
+        FAIL_STACK_ERROR
+    dset = -1;
+
+    if(H5Fclose(file) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(asid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0)
+        FAIL_STACK_ERROR
+    if(H5Pclose(my_fapl) < 0)
+        FAIL_STACK_ERROR
+
+    PASSED();
+
+    return SUCCEED;
+
+error:
+    H5E_BEGIN_TRY {
+        if(oh)
+            H5O_unprotect(&oh_loc, H5AC_ind_read_dxpl_id, oh, H5AC__NO_FLAGS_SET);
+        H5Aclose(attr);
+        H5Dclose(dset);
+        H5Sclose(asid);
+        H5Sclose(sid);
+        H5Pclose(dcpl);
+        H5Pclose(my_fapl);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    return FAIL;
+} /* end test_prefetch() */
+
 /*
  *  Verify that object headers are held in the cache until they are linked
  *      to a location in the graph, or assigned an ID.  This is done by
@@ -787,6 +1059,10 @@ main(void)
         if(test_cont(filename, fapl) < 0)
             TEST_ERROR
 
+        /* test on prefetching object header continuation chunks */
+        if(test_prefetch(filename, fapl) < 0)
+            TEST_ERROR
+
         /* Create the file to operate on */
         if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
             FAIL_STACK_ERROR
@@ -0,0 +1,532 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the files COPYING and Copyright.html.  COPYING can be found at the root   *
+ * of the source code distribution tree; Copyright.html can be found at the  *
+ * root level of an installed copy of the electronic HDF5 document set and   *
+ * is linked from the top-level documents page.  It can also be found at     *
+ * http://hdfgroup.org/HDF5/doc/Copyright.html.  If you do not have          *
+ * access to either file, you may request a copy from help@hdfgroup.org.     *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ *		This file contains tests for the page buffer (see
+ *		H5Pset_page_buffer_size()).
+ */
+
+#include "h5test.h"
+
+const char *FILENAME[] = {
+    "page_buffer",
+    NULL
+};
+
+#define PB_PAGE_SIZE            4096
+#define PB_NPAGES               4
+#define PB_DSET_NAME            "dset"
+#define PB_NELMTS               8192    /* 32 KB of int, so 8 pages */
+#define PB_PIECE                16      /* Elements in a small access */
+#define PB_NGROUPS              50
+#define PB_ATTR_NAME            "attr"
+
+static int test_args(hid_t fapl);
+static int test_raw_and_meta(hid_t fapl);
+static int test_min_perc(hid_t fapl);
+static hid_t pb_fapl(hid_t fapl, size_t npages, unsigned min_meta_perc,
+    unsigned min_raw_perc);
+static herr_t read_piece(hid_t dset, hsize_t start, hsize_t count, int *buf);
+static herr_t write_piece(hid_t dset, hsize_t start, hsize_t count, const int *buf);
+
+
+/*-------------------------------------------------------------------------
+ * Function:    pb_fapl
+ *
+ * Purpose:     Make a copy of FAPL with a page buffer of NPAGES pages of
+ *              PB_PAGE_SIZE bytes, and no sieve buffer (so that small
+ *              raw data accesses reach the page buffer).
+ *
+ * Return:      Success:        the new file access property list
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static hid_t
+pb_fapl(hid_t fapl, size_t npages, unsigned min_meta_perc, unsigned min_raw_perc)
+{
+    hid_t my_fapl = -1;
+
+    if((my_fapl = H5Pcopy(fapl)) < 0)
+        goto error;
+    if(H5Pset_sieve_buf_size(my_fapl, (size_t)0) < 0)
+        goto error;
+    if(npages)
+        if(H5Pset_page_buffer_size(my_fapl, (size_t)PB_PAGE_SIZE, npages * PB_PAGE_SIZE,
+                min_meta_perc, min_raw_perc) < 0)
+            goto error;
+
+    return my_fapl;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(my_fapl);
+    } H5E_END_TRY;
+    return -1;
+} /* end pb_fapl() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    read_piece / write_piece
+ *
+ * Purpose:     Read or write COUNT elements of the one dimensional
+ *              dataset DSET, from element START.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+read_piece(hid_t dset, hsize_t start, hsize_t count, int *buf)
+{
+    hid_t fspace = -1, mspace = -1;
+
+    if((fspace = H5Dget_space(dset)) < 0)
+        goto error;
+    if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+        goto error;
+    if((mspace = H5Screate_simple(1, &count, NULL)) < 0)
+        goto error;
+    if(H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, buf) < 0)
+        goto error;
+    if(H5Sclose(mspace) < 0)
+        goto error;
+    if(H5Sclose(fspace) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+    } H5E_END_TRY;
+    return -1;
+} /* end read_piece() */
+
+static herr_t
+write_piece(hid_t dset, hsize_t start, hsize_t count, const int *buf)
+{
+    hid_t fspace = -1, mspace = -1;
+
+    if((fspace = H5Dget_space(dset)) < 0)
+        goto error;
+    if(H5Sselect_hyperslab(fspace, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0)
+        goto error;
+    if((mspace = H5Screate_simple(1, &count, NULL)) < 0)
+        goto error;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, buf) < 0)
+        goto error;
+    if(H5Sclose(mspace) < 0)
+        goto error;
+    if(H5Sclose(fspace) < 0)
+        goto error;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(mspace);
+        H5Sclose(fspace);
+    } H5E_END_TRY;
+    return -1;
+} /* end write_piece() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_args
+ *
+ * Purpose:     Test the page buffer properties, and the page buffer
+ *              statistics calls on a file without a page buffer.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_args(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       my_fapl = -1, file = -1;
+    size_t      page_size, buf_size;
+    unsigned    min_meta_perc, min_raw_perc;
+    unsigned    accesses[2];
+    herr_t      ret;
+
+    TESTING("page buffer properties");
+
+    if((my_fapl = H5Pcopy(fapl)) < 0)
+        TEST_ERROR
+
+    /* Page buffering is disabled by default */
+    if(H5Pget_page_buffer_size(my_fapl, &page_size, &buf_size, &min_meta_perc, &min_raw_perc) < 0)
+        TEST_ERROR
+    if(buf_size != 0 || page_size != 0 || min_meta_perc != 0 || min_raw_perc != 0)
+        TEST_ERROR
+
+    if(H5Pset_page_buffer_size(my_fapl, (size_t)1024, (size_t)(64 * 1024), 30, 20) < 0)
+        TEST_ERROR
+    if(H5Pget_page_buffer_size(my_fapl, &page_size, &buf_size, &min_meta_perc, &min_raw_perc) < 0)
+        TEST_ERROR
+    if(page_size != 1024 || buf_size != 64 * 1024 || min_meta_perc != 30 || min_raw_perc != 20)
+        TEST_ERROR
+
+    /* Bad values */
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_size(my_fapl, (size_t)1000, (size_t)(64 * 1024), 0, 0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("page size not a power of two accepted")
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_size(my_fapl, (size_t)256, (size_t)(64 * 1024), 0, 0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("page size too small accepted")
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_size(my_fapl, (size_t)4096, (size_t)2048, 0, 0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("page buffer smaller than a page accepted")
+    H5E_BEGIN_TRY {
+        ret = H5Pset_page_buffer_size(my_fapl, (size_t)0, (size_t)(64 * 1024), 60, 41);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("reservations over 100% accepted")
+
+    /* The statistics aren't available without a page buffer */
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Fget_page_buffering_stats(file, accesses, NULL, NULL, NULL, NULL);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("statistics retrieved without a page buffer")
+    H5E_BEGIN_TRY {
+        ret = H5Freset_page_buffering_stats(file);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("statistics reset without a page buffer")
+
+    if(H5Fclose(file) < 0)
+        TEST_ERROR
+    if(H5Pclose(my_fapl) < 0)
+        TEST_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Fclose(file);
+        H5Pclose(my_fapl);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_args() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_raw_and_meta
+ *
+ * Purpose:     Write metadata and raw data with small accesses through a
+ *              page buffer smaller than the data, and check that the
+ *              file is correct when read back with and without a page
+ *              buffer.  Large accesses, which bypass the page buffer,
+ *              are mixed with small ones to check that they see (and
+ *              update) the data held in pages.
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_raw_and_meta(hid_t fapl)
+{
+    char        filename[1024];
+    char        name[32];
+    hid_t       my_fapl = -1, plain_fapl = -1;
+    hid_t       file = -1, dset = -1, space = -1, scalar = -1, grp = -1, attr = -1;
+    hsize_t     dims = PB_NELMTS;
+    int         *wbuf = NULL, *rbuf = NULL;
+    unsigned    accesses[2], hits[2], misses[2], evictions[2], bypasses[2];
+    int         val;
+    int         i;
+
+    TESTING("page buffer with metadata and raw data");
+
+    if(NULL == (wbuf = (int *)HDmalloc(PB_NELMTS * sizeof(int))))
+        TEST_ERROR
+    if(NULL == (rbuf = (int *)HDmalloc(PB_NELMTS * sizeof(int))))
+        TEST_ERROR
+    for(i = 0; i < PB_NELMTS; i++)
+        wbuf[i] = i;
+
+    if((my_fapl = pb_fapl(fapl, (size_t)PB_NPAGES, 0, 0)) < 0)
+        TEST_ERROR
+    if((plain_fapl = pb_fapl(fapl, (size_t)0, 0, 0)) < 0)
+        TEST_ERROR
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    /* Create the file, writing the dataset in small pieces (in reverse
+     * order, so that pages are revisited after being evicted).
+     */
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, my_fapl)) < 0)
+        TEST_ERROR
+    if((space = H5Screate_simple(1, &dims, NULL)) < 0)
+        TEST_ERROR
+    if((dset = H5Dcreate2(file, PB_DSET_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR
+    for(i = PB_NELMTS - PB_PIECE; i >= 0; i -= PB_PIECE)
+        if(write_piece(dset, (hsize_t)i, (hsize_t)PB_PIECE, wbuf + i) < 0)
+            TEST_ERROR
+
+    /* A large read sees the data still held in dirty pages */
+    HDmemset(rbuf, 0, PB_NELMTS * sizeof(int));
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR
+    if(HDmemcmp(rbuf, wbuf, PB_NELMTS * sizeof(int)))
+        FAIL_PUTS_ERROR("large read doesn't match small writes")
+
+    /* Small reads see the data of a large write */
+    for(i = 0; i < PB_NELMTS; i++)
+        wbuf[i] = PB_NELMTS - i;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR
+    for(i = 0; i < PB_NELMTS; i += PB_PIECE) {
+        if(read_piece(dset, (hsize_t)i, (hsize_t)PB_PIECE, rbuf + i) < 0)
+            TEST_ERROR
+        if(HDmemcmp(rbuf + i, wbuf + i, PB_PIECE * sizeof(int)))
+            FAIL_PUTS_ERROR("small read doesn't match large write")
+    } /* end for */
+
+    /* Finish with small writes, left dirty in pages until the file is closed */
+    for(i = 0; i < PB_NELMTS; i += 2 * PB_PIECE) {
+        wbuf[i] = -i;
+        if(write_piece(dset, (hsize_t)i, (hsize_t)1, wbuf + i) < 0)
+            TEST_ERROR
+    } /* end for */
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR
+
+    /* Metadata: groups with an attribute each */
+    if((scalar = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR
+    for(i = 0; i < PB_NGROUPS; i++) {
+        HDsnprintf(name, sizeof(name), "group %d", i);
+        if((grp = H5Gcreate2(file, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if((attr = H5Acreate2(grp, PB_ATTR_NAME, H5T_NATIVE_INT, scalar, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        if(H5Awrite(attr, H5T_NATIVE_INT, &i) < 0)
+            TEST_ERROR
+        if(H5Aclose(attr) < 0)
+            TEST_ERROR
+        if(H5Gclose(grp) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    /* Pages are evicted, since the data doesn't fit */
+    if(H5Fget_page_buffering_stats(file, accesses, hits, misses, evictions, bypasses) < 0)
+        TEST_ERROR
+    if(accesses[0] == 0 || accesses[1] == 0 || hits[1] == 0 || misses[1] == 0
+            || evictions[1] == 0 || bypasses[1] == 0)
+        FAIL_PUTS_ERROR("unexpected page buffer statistics")
+
+    if(H5Fclose(file) < 0)
+        TEST_ERROR
+
+    /* Check the file without a page buffer, then with one */
+    for(i = 0; i < 2; i++) {
+        int j;
+
+        if((file = H5Fopen(filename, H5F_ACC_RDONLY, i ? my_fapl : plain_fapl)) < 0)
+            TEST_ERROR
+        if(i && H5Freset_page_buffering_stats(file) < 0)
+            TEST_ERROR
+
+        if((dset = H5Dopen2(file, PB_DSET_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+        for(j = 0; j < PB_NELMTS; j += PB_PIECE) {
+            if(read_piece(dset, (hsize_t)j, (hsize_t)PB_PIECE, rbuf + j) < 0)
+                TEST_ERROR
+            if(HDmemcmp(rbuf + j, wbuf + j, PB_PIECE * sizeof(int)))
+                FAIL_PUTS_ERROR("wrong data read back")
+        } /* end for */
+        if(H5Dclose(dset) < 0)
+            TEST_ERROR
+
+        for(j = 0; j < PB_NGROUPS; j++) {
+            HDsnprintf(name, sizeof(name), "group %d", j);
+            if((attr = H5Aopen_by_name(file, name, PB_ATTR_NAME, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                TEST_ERROR
+            if(H5Aread(attr, H5T_NATIVE_INT, &val) < 0)
+                TEST_ERROR
+            if(val != j)
+                FAIL_PUTS_ERROR("wrong attribute value read back")
+            if(H5Aclose(attr) < 0)
+                TEST_ERROR
+        } /* end for */
+
+        if(i) {
+            if(H5Fget_page_buffering_stats(file, accesses, hits, misses, evictions, bypasses) < 0)
+                TEST_ERROR
+            if(accesses[0] == 0 || hits[1] == 0 || misses[1] == 0 || evictions[1] == 0)
+                FAIL_PUTS_ERROR("unexpected page buffer statistics")
+        } /* end if */
+
+        if(H5Fclose(file) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    if(H5Sclose(scalar) < 0)
+        TEST_ERROR
+    if(H5Sclose(space) < 0)
+        TEST_ERROR
+    if(H5Pclose(my_fapl) < 0)
+        TEST_ERROR
+    if(H5Pclose(plain_fapl) < 0)
+        TEST_ERROR
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Aclose(attr);
+        H5Gclose(grp);
+        H5Dclose(dset);
+        H5Sclose(scalar);
+        H5Sclose(space);
+        H5Fclose(file);
+        H5Pclose(my_fapl);
+        H5Pclose(plain_fapl);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return 1;
+} /* end test_raw_and_meta() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_min_perc
+ *
+ * Purpose:     Check that pages reserved for metadata aren't evicted to
+ *              make room for raw data, and that they are when none are
+ *              reserved.  Uses the file written by test_raw_and_meta().
+ *
+ * Return:      Success:        0
+ *              Failure:        1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+test_min_perc(hid_t fapl)
+{
+    char        filename[1024];
+    hid_t       my_fapl = -1, file = -1, dset = -1;
+    unsigned    accesses[2], evictions[2];
+    int         val;
+    int         i, j;
+
+    TESTING("page buffer space reserved for metadata");
+
+    h5_fixname(FILENAME[0], fapl, filename, sizeof filename);
+
+    for(i = 0; i < 2; i++) {
+        /* Two pages, all or none of them reserved for metadata */
+        if((my_fapl = pb_fapl(fapl, (size_t)2, i ? 0 : 100, i ? 100 : 0)) < 0)
+            TEST_ERROR
+        if((file = H5Fopen(filename, H5F_ACC_RDONLY, my_fapl)) < 0)
+            TEST_ERROR
+        if((dset = H5Dopen2(file, PB_DSET_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR
+
+        /* Read one element from each page in the middle of the dataset */
+        if(H5Freset_page_buffering_stats(file) < 0)
+            TEST_ERROR
+        for(j = 1; j < (PB_NELMTS * (int)sizeof(int)) / PB_PAGE_SIZE - 1; j++)
+            if(read_piece(dset, (hsize_t)(j * (PB_PAGE_SIZE / (int)sizeof(int))), (hsize_t)1, &val) < 0)
+                TEST_ERROR
+
+        if(H5Fget_page_buffering_stats(file, accesses, NULL, NULL, evictions, NULL) < 0)
+            TEST_ERROR
+        if(accesses[1] == 0)
+            FAIL_PUTS_ERROR("raw data not read through the page buffer")
+        if(i == 0 && evictions[0] != 0)
+            FAIL_PUTS_ERROR("reserved metadata page evicted")
+        if(i == 1 && evictions[0] == 0)
+            FAIL_PUTS_ERROR("metadata page not evicted")
+
+        if(H5Dclose(dset) < 0)
+            TEST_ERROR
+        if(H5Fclose(file) < 0)
+            TEST_ERROR
+        if(H5Pclose(my_fapl) < 0)
+            TEST_ERROR
+    } /* end for */
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Dclose(dset);
+        H5Fclose(file);
+        H5Pclose(my_fapl);
+    } H5E_END_TRY;
+    return 1;
+} /* end test_min_perc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    main
+ *
+ * Purpose:     Run the page buffer tests.
+ *
+ * Return:      EXIT_SUCCESS/EXIT_FAILURE
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    hid_t       fapl = -1;
+    int         nerrors = 0;
+
+    h5_reset();
+    fapl = h5_fileaccess();
+
+    printf("Testing the page buffer.\n");
+
+    nerrors += test_args(fapl);
+    nerrors += test_raw_and_meta(fapl);
+    nerrors += test_min_perc(fapl);
+
+    if(nerrors) {
+        printf("***** %d page buffer TEST%s FAILED! *****\n",
+               nerrors, nerrors > 1 ? "S" : "");
+        return EXIT_FAILURE;
+    } /* end if */
+
+    h5_cleanup(FILENAME, fapl);
+    printf("All page buffer tests passed.\n");
+    return EXIT_SUCCESS;
+} /* end main() */
+
@@ -44,6 +44,13 @@
 #define SPACE4_DIM_SMALL     128
 #define SPACE4_DIM_LARGE     (H5D_TEMP_BUF_SIZE / 64)
 
+/* 1-D dataset spanning several batches of VL reads */
+#define SPACE5_RANK	1
+#define SPACE5_DIM1     2500
+#define SPACE5_LARGE_LEN 40000
+#define SPACE5_HUGE_ELMT 1503
+#define SPACE5_HUGE_LEN 300000
+
 void *test_vltypes_alloc_custom(size_t size, void *info);
 void test_vltypes_free_custom(void *mem, void *info);
 
@@ -3160,6 +3167,130 @@ test_vltypes_fill_value(void)
     HDfree(rbuf);
 } /* end test_vltypes_fill_value() */
 
+/****************************************************************
+**
+**  test_vltypes_vlen_batch(): Test reading many VL sequences,
+**      spread over several global heap collections and mixed
+**      with "nil" sequences, with and without conversion of the
+**      base type.  Some sequences are large, so that batches end
+**      at the limit on the bytes staged at once, and one is
+**      larger than the limit by itself.
+**
+****************************************************************/
+static void
+test_vltypes_vlen_batch(void)
+{
+    hvl_t *wdata;               /* Information to write */
+    hvl_t *rdata;               /* Information read in */
+    hid_t fid1;		/* HDF5 File IDs		*/
+    hid_t dataset;	/* Dataset ID			*/
+    hid_t sid1;         /* Dataspace ID			*/
+    hid_t tid1;         /* Datatype ID			*/
+    hid_t tid2;         /* Datatype ID for conversion   */
+    hsize_t dims1[] = {SPACE5_DIM1};
+    unsigned i,j;       /* counting variables */
+    herr_t ret;		/* Generic return value		*/
+
+    /* Output message about test being performed */
+    MESSAGE(5, ("Testing Batched Reads of VL Datatypes\n"));
+
+    wdata = (hvl_t *)HDmalloc(SPACE5_DIM1 * sizeof(hvl_t));
+    CHECK(wdata, NULL, "HDmalloc");
+    rdata = (hvl_t *)HDmalloc(SPACE5_DIM1 * sizeof(hvl_t));
+    CHECK(rdata, NULL, "HDmalloc");
+
+    /* Allocate and initialize VL data to write, every 7th sequence is "nil"
+     * and every 100th is large */
+    for(i=0; i<SPACE5_DIM1; i++) {
+        if(i == SPACE5_HUGE_ELMT)
+            wdata[i].len=SPACE5_HUGE_LEN;
+        else if((i % 100) == 3)
+            wdata[i].len=(i % 7) ? SPACE5_LARGE_LEN : 0;
+        else
+            wdata[i].len=(i % 7) ? (i % 23) + 1 : 0;
+        wdata[i].p=wdata[i].len ? HDmalloc(wdata[i].len*sizeof(unsigned int)) : NULL;
+        for(j=0; j<wdata[i].len; j++)
+            ((unsigned int *)wdata[i].p)[j]=i*100+j;
+    } /* end for */
+
+    /* Create file */
+    fid1 = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(fid1, FAIL, "H5Fcreate");
+
+    /* Create dataspace for datasets */
+    sid1 = H5Screate_simple(SPACE5_RANK, dims1, NULL);
+    CHECK(sid1, FAIL, "H5Screate_simple");
+
+    /* Create the datatypes */
+    tid1 = H5Tvlen_create(H5T_NATIVE_UINT);
+    CHECK(tid1, FAIL, "H5Tvlen_create");
+    tid2 = H5Tvlen_create(H5T_NATIVE_ULLONG);
+    CHECK(tid2, FAIL, "H5Tvlen_create");
+
+    /* Create a dataset */
+    dataset = H5Dcreate2(fid1, "Dataset1", tid1, sid1, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    CHECK(dataset, FAIL, "H5Dcreate2");
+
+    /* Write dataset to disk */
+    ret = H5Dwrite(dataset, tid1, H5S_ALL, H5S_ALL, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dwrite");
+
+    /* Read the data back without conversion */
+    ret = H5Dread(dataset, tid1, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+
+    for(i=0; i<SPACE5_DIM1; i++) {
+        if(wdata[i].len!=rdata[i].len) {
+            TestErrPrintf("%d: VL data lengths don't match!, wdata[%d].len=%d, rdata[%d].len=%d\n",__LINE__,(int)i,(int)wdata[i].len,(int)i,(int)rdata[i].len);
+            continue;
+        } /* end if */
+        for(j=0; j<rdata[i].len; j++)
+            if(((unsigned int *)wdata[i].p)[j] != ((unsigned int *)rdata[i].p)[j]) {
+                TestErrPrintf("VL data values don't match!, wdata[%d].p[%d]=%d, rdata[%d].p[%d]=%d\n",(int)i,(int)j, (int)((unsigned int *)wdata[i].p)[j], (int)i,(int)j, (int)((unsigned int *)rdata[i].p)[j]);
+                break;
+            } /* end if */
+    } /* end for */
+
+    ret = H5Dvlen_reclaim(tid1, sid1, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+    /* Read the data back, converting the base type */
+    ret = H5Dread(dataset, tid2, H5S_ALL, H5S_ALL, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dread");
+
+    for(i=0; i<SPACE5_DIM1; i++) {
+        if(wdata[i].len!=rdata[i].len) {
+            TestErrPrintf("%d: VL data lengths don't match!, wdata[%d].len=%d, rdata[%d].len=%d\n",__LINE__,(int)i,(int)wdata[i].len,(int)i,(int)rdata[i].len);
+            continue;
+        } /* end if */
+        for(j=0; j<rdata[i].len; j++)
+            if((unsigned long long)((unsigned int *)wdata[i].p)[j] != ((unsigned long long *)rdata[i].p)[j]) {
+                TestErrPrintf("VL data values don't match!, wdata[%d].p[%d]=%d, rdata[%d].p[%d]=%d\n",(int)i,(int)j, (int)((unsigned int *)wdata[i].p)[j], (int)i,(int)j, (int)((unsigned long long *)rdata[i].p)[j]);
+                break;
+            } /* end if */
+    } /* end for */
+
+    ret = H5Dvlen_reclaim(tid2, sid1, H5P_DEFAULT, rdata);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+    ret = H5Dvlen_reclaim(tid1, sid1, H5P_DEFAULT, wdata);
+    CHECK(ret, FAIL, "H5Dvlen_reclaim");
+
+    /* Close everything */
+    ret = H5Dclose(dataset);
+    CHECK(ret, FAIL, "H5Dclose");
+    ret = H5Tclose(tid2);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Tclose(tid1);
+    CHECK(ret, FAIL, "H5Tclose");
+    ret = H5Sclose(sid1);
+    CHECK(ret, FAIL, "H5Sclose");
+    ret = H5Fclose(fid1);
+    CHECK(ret, FAIL, "H5Fclose");
+
+    HDfree(wdata);
+    HDfree(rdata);
+} /* end test_vltypes_vlen_batch() */
+
 /****************************************************************
 **
 **  test_vltypes(): Main VL datatype testing routine.
@@ -3187,6 +3318,7 @@ test_vltypes(void)
     test_vltypes_compound_vlen_vlen();/* Test compound datatypes with VL atomic components */
     test_vltypes_compound_vlstr();    /* Test data rewritten of nested VL data */
     test_vltypes_fill_value();        /* Test fill value for VL data */
+    test_vltypes_vlen_batch();        /* Test batched reads of VL data */
 }   /* test_vltypes() */
 
 
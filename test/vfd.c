@@ -22,6 +22,10 @@
 
 #include "h5test.h"
 
+#define H5FD_FRIEND     /*suppress error about including H5FDpkg */
+#define H5FD_TESTING
+#include "H5FDpkg.h"
+
 #define KB              1024U
 #define FAMILY_NUMBER   4
 #define FAMILY_SIZE     (1*KB)
@@ -39,6 +43,17 @@
 #define DSET1_DIM2   32
 #define DSET3_NAME   "dset3"
 
+/* Macros for vector I/O */
+#define VECTOR_NEXTENTS     6
+#define VECTOR_MAX_EXTENT   400
+#define VECTOR_EOA          (8*KB)
+#define VECTOR_IMAGE_SIZE   (2*KB)
+
+/* Macros for striped FAMILY files */
+#define STRIPE_SIZE         (4*KB)
+#define STRIPE_COUNT        3
+#define STRIPE_SMALL_SIZE   256
+
 /* Macros for Direct VFD */
 #ifdef H5_HAVE_DIRECT
 #define MBOUNDARY    512
@@ -49,6 +64,28 @@
 #define DSET2_DIM    4
 #endif /* H5_HAVE_DIRECT */
 
+/* Macros for io_uring VFD */
+#ifdef H5_HAVE_IOURING
+#define IOURING_DEPTH       4
+#define IOURING_ALIGN       (4*KB)
+#define IOURING_BIG_SIZE    (2*1024*KB + IOURING_ALIGN)
+#define IOURING_ODD_ADDR    (IOURING_BIG_SIZE + 13)
+#define IOURING_ODD_SIZE    (300*KB + 7)
+#define IOURING_FILE_SIZE   (IOURING_ODD_ADDR + IOURING_ODD_SIZE + 100)
+#define IOURING_NEXTENTS    (2*IOURING_DEPTH)
+#define IOURING_EXTENT_SIZE (4*KB)
+#define IOURING_EXTENT_GAP  (64*KB)
+#endif /* H5_HAVE_IOURING */
+
+/* Macros for mmap VFD */
+#ifdef H5_HAVE_MMAP
+#define MMAP_WINDOW         (4*KB)
+#define MMAP_GROUP_NAME     "grp"
+#define MMAP_NLINKS         20
+#define MMAP_SIGNATURE      "\211HDF\r\n\032\n"
+#define MMAP_SIG_SIZE       8
+#endif /* H5_HAVE_MMAP */
+
 const char *FILENAME[] = {
     "sec2_file",         /*0*/
     "core_file",         /*1*/
@@ -60,6 +97,10 @@ const char *FILENAME[] = {
     "stdio_file",        /*7*/
     "windows_file",      /*8*/
     "new_multi_file_v16",/*9*/
+    "vector_file",       /*10*/
+    "iouring_file",      /*11*/
+    "mmap_file",         /*12*/
+    "striped_family_file",/*13*/
     NULL
 };
 
@@ -486,6 +527,202 @@ error:
     return -1;
 } /* end test_core() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_core_mmap
+ *
+ * Purpose:     Tests opening existing files with the CORE driver mapping
+ *              them into memory, with changes written back on flush and
+ *              with a mapping shared with the file.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_core_mmap(void)
+{
+#ifdef H5_HAVE_MMAP
+    hid_t       fid = -1;                   /* file ID                      */
+    hid_t       fapl_id = -1;               /* core file access plist ID    */
+    hid_t       sec2_fapl_id = -1;          /* sec2 file access plist ID    */
+    hid_t       did = -1;                   /* dataset ID                   */
+    hid_t       sid = -1;                   /* dataspace ID                 */
+    char        filename[1024];             /* filename                     */
+    hbool_t     use_mmap;                   /* mmap flag                    */
+    hbool_t     write_back;                 /* write-back flag              */
+    hsize_t     dims[2];                    /* dataspace dimensions         */
+    int         *data_w = NULL;             /* data written to the datasets */
+    int         *data_r = NULL;             /* data read from the datasets  */
+    herr_t      ret;                        /* generic return value         */
+    int         i;                          /* iterator                     */
+    unsigned    u;                          /* iterator                     */
+#endif /* H5_HAVE_MMAP */
+
+    TESTING("CORE file driver with mapped files");
+
+#ifndef H5_HAVE_MMAP
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_MMAP */
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, TRUE) < 0)
+        TEST_ERROR;
+
+    /* Check the mmap properties, and that write-back needs mmap */
+    if(H5Pget_core_mmap(fapl_id, &use_mmap, &write_back) < 0)
+        TEST_ERROR;
+    if(FALSE != use_mmap || FALSE != write_back)
+        FAIL_PUTS_ERROR("mmap should be off by default");
+    H5E_BEGIN_TRY {
+        ret = H5Pset_core_mmap(fapl_id, FALSE, TRUE);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("write-back set without mmap");
+    if(H5Pset_core_mmap(fapl_id, TRUE, TRUE) < 0)
+        TEST_ERROR;
+    if(H5Pget_core_mmap(fapl_id, &use_mmap, &write_back) < 0)
+        TEST_ERROR;
+    if(TRUE != use_mmap || TRUE != write_back)
+        FAIL_PUTS_ERROR("incorrect mmap flags from fapl");
+
+    if((sec2_fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_sec2(sec2_fapl_id) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[1], fapl_id, filename, sizeof(filename));
+
+    if(NULL == (data_w = (int *)HDmalloc(CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int))))
+        FAIL_PUTS_ERROR("unable to allocate memory for input array");
+    if(NULL == (data_r = (int *)HDmalloc(CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int))))
+        FAIL_PUTS_ERROR("unable to allocate memory for output array");
+    dims[0] = CORE_DSET_DIM1;
+    dims[1] = CORE_DSET_DIM2;
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+
+    /* Map the file with changes written back on flush, then with the
+     * mapping shared with the file
+     */
+    for(u = 0; u < 2; u++) {
+        /* Create a file with one dataset */
+        for(i = 0; i < CORE_DSET_DIM1 * CORE_DSET_DIM2; i++)
+            data_w[i] = i;
+        if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, sec2_fapl_id)) < 0)
+            TEST_ERROR;
+        if((did = H5Dcreate2(fid, DSET1_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_w) < 0)
+            TEST_ERROR;
+        if(H5Dclose(did) < 0)
+            TEST_ERROR;
+        if(H5Fclose(fid) < 0)
+            TEST_ERROR;
+
+        /* Map it, read the dataset, change it and add another one, which
+         * extends the file
+         */
+        if(H5Pset_core_mmap(fapl_id, TRUE, (hbool_t)(u > 0)) < 0)
+            TEST_ERROR;
+        if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl_id)) < 0)
+            TEST_ERROR;
+        if((did = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(data_r, 0, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int));
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(data_r, data_w, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int)))
+            FAIL_PUTS_ERROR("read different values than written from mapped file");
+        for(i = 0; i < CORE_DSET_DIM1 * CORE_DSET_DIM2; i++)
+            data_w[i] = -i;
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_w) < 0)
+            TEST_ERROR;
+        if(H5Dclose(did) < 0)
+            TEST_ERROR;
+        if((did = H5Dcreate2(fid, CORE_DSET_NAME, H5T_NATIVE_INT, sid, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if(H5Dwrite(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_w) < 0)
+            TEST_ERROR;
+        if(H5Dclose(did) < 0)
+            TEST_ERROR;
+        if(H5Fclose(fid) < 0)
+            TEST_ERROR;
+
+        /* Check that the changes reached the file */
+        if((fid = H5Fopen(filename, H5F_ACC_RDONLY, sec2_fapl_id)) < 0)
+            TEST_ERROR;
+        if((did = H5Dopen2(fid, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(data_r, 0, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int));
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(data_r, data_w, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int)))
+            FAIL_PUTS_ERROR("changes to mapped file not saved");
+        if(H5Dclose(did) < 0)
+            TEST_ERROR;
+        if((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(data_r, 0, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int));
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(data_r, data_w, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int)))
+            FAIL_PUTS_ERROR("dataset added to mapped file not saved");
+        if(H5Dclose(did) < 0)
+            TEST_ERROR;
+        if(H5Fclose(fid) < 0)
+            TEST_ERROR;
+
+        /* Map it read-only */
+        if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl_id)) < 0)
+            TEST_ERROR;
+        if((did = H5Dopen2(fid, CORE_DSET_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(data_r, 0, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int));
+        if(H5Dread(did, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data_r) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(data_r, data_w, CORE_DSET_DIM1 * CORE_DSET_DIM2 * sizeof(int)))
+            FAIL_PUTS_ERROR("read different values than written from read-only mapped file");
+        if(H5Dclose(did) < 0)
+            TEST_ERROR;
+        if(H5Fclose(fid) < 0)
+            TEST_ERROR;
+    } /* end for */
+
+    h5_delete_test_file(FILENAME[1], sec2_fapl_id);
+
+    if(H5Sclose(sid) < 0)
+        TEST_ERROR;
+    if(H5Pclose(sec2_fapl_id) < 0)
+        TEST_ERROR;
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+    HDfree(data_w);
+    HDfree(data_r);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(sid);
+        H5Dclose(did);
+        H5Pclose(sec2_fapl_id);
+        H5Pclose(fapl_id);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+
+    if(data_w)
+        HDfree(data_w);
+    if(data_r)
+        HDfree(data_r);
+
+    return -1;
+#endif /* H5_HAVE_MMAP */
+} /* end test_core_mmap() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_direct
@@ -505,11 +742,13 @@ test_direct(void)
 {
 #ifdef H5_HAVE_DIRECT
     hid_t       file=-1, fapl=-1, access_fapl = -1;
-    hid_t  dset1=-1, dset2=-1, space1=-1, space2=-1;
+    hid_t  dset1=-1, dset2=-1, space1=-1, space2=-1, mspace1=-1;
     char        filename[1024];
     int         *fhandle=NULL;
     hsize_t     file_size;
     hsize_t  dims1[2], dims2[1];
+    hsize_t     start1[2], count1[2];
+    long long   *lcheck = NULL;
     size_t  mbound;
     size_t  fbsize;
     size_t  cbsize;
@@ -663,6 +902,53 @@ test_direct(void)
             TEST_ERROR;
         } /* end if */
 
+    /* Write and read all but the first and last rows of data set 1.  Neither
+     * the file address nor the memory address is aligned, but the memory for
+     * the whole file blocks in between is, so those blocks are transferred
+     * without copying. */
+    start1[0] = 1;
+    start1[1] = 0;
+    count1[0] = DSET1_DIM1 - 2;
+    count1[1] = DSET1_DIM2;
+    if((mspace1 = H5Screate_simple(2, count1, NULL)) < 0)
+        TEST_ERROR;
+    if(H5Sselect_hyperslab(space1, H5S_SELECT_SET, start1, NULL, count1, NULL) < 0)
+        TEST_ERROR;
+
+    for(i = DSET1_DIM2; i < (DSET1_DIM1 - 1) * DSET1_DIM2; i++)
+        points[i] = -points[i];
+    if(H5Dwrite(dset1, H5T_NATIVE_INT, mspace1, space1, H5P_DEFAULT, points + DSET1_DIM2) < 0)
+        TEST_ERROR;
+
+    HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+    if(H5Dread(dset1, H5T_NATIVE_INT, mspace1, space1, H5P_DEFAULT, check + DSET1_DIM2) < 0)
+        TEST_ERROR;
+    for(i = DSET1_DIM2; i < (DSET1_DIM1 - 1) * DSET1_DIM2; i++)
+        if(points[i] != check[i]) {
+            H5_FAILED();
+            printf("    Read different values than written in data set 1 rows.\n");
+            printf("    At index %d\n", i);
+            TEST_ERROR;
+        } /* end if */
+
+    /* Read the whole data set with a type conversion, which goes through
+     * the (aligned) type conversion buffer */
+    if(NULL == (lcheck = (long long *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(long long))))
+        TEST_ERROR;
+    if(H5Dread(dset1, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, lcheck) < 0)
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        if((long long)points[i] != lcheck[i]) {
+            H5_FAILED();
+            printf("    Read different values than written in data set 1 with conversion.\n");
+            printf("    At index %d\n", i);
+            TEST_ERROR;
+        } /* end if */
+    HDfree(lcheck);
+    lcheck = NULL;
+
+    if(H5Sclose(mspace1) < 0)
+        TEST_ERROR;
     if(H5Sclose(space1) < 0)
         TEST_ERROR;
     if(H5Dclose(dset1) < 0)
@@ -690,6 +976,7 @@ test_direct(void)
 error:
     H5E_BEGIN_TRY {
         H5Pclose(fapl);
+        H5Sclose(mspace1);
         H5Sclose(space1);
         H5Dclose(dset1);
         H5Sclose(space2);
@@ -701,6 +988,8 @@ error:
         HDfree(points);
     if(check)
         HDfree(check);
+    if(lcheck)
+        HDfree(lcheck);
 
     return -1;
 #endif /*H5_HAVE_DIRECT*/
@@ -1046,6 +1335,225 @@ error:
 } /* end test_family_compat() */
 
 
+/*-------------------------------------------------------------------------
+ * Function:    count_memb_failures_cb
+ *
+ * Purpose:     H5Ewalk2() callback for test_family_striped(), which
+ *              counts the simulated member file I/O failures on the
+ *              error stack.
+ *
+ * Return:      0
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+count_memb_failures_cb(unsigned H5_ATTR_UNUSED n, const H5E_error2_t *err_desc,
+    void *client_data)
+{
+    unsigned *nfailures = (unsigned *)client_data;
+
+    if(err_desc->desc && !HDstrcmp(err_desc->desc, "simulated member file I/O failure"))
+        (*nfailures)++;
+
+    return 0;
+} /* end count_memb_failures_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_family_striped
+ *
+ * Purpose:     Tests FAMILY files striped over a fixed number of members,
+ *              written and read with member I/O threads.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_family_striped(void)
+{
+    hid_t       file = -1, fapl = -1, fapl2 = -1, dxpl = -1, space = -1, dset = -1;
+    hid_t       access_fapl = -1, memb_fapl = -1;
+    char        filename[1024];
+    hsize_t     dims[2] = {DSET1_DIM1, DSET1_DIM2};
+    hsize_t     stripe_size;
+    unsigned    stripe_count;
+    unsigned    nthreads;
+    unsigned    nfailures;
+    size_t      min_size;
+    hbool_t     is_ts;
+    int         *points = NULL, *check = NULL;
+    herr_t      ret;
+    int         i;
+
+    TESTING("striped FAMILY file driver");
+
+    /* Check the property list routines */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_fapl_family_striped(fapl, (hsize_t)0, STRIPE_COUNT, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("zero stripe size accepted");
+    H5E_BEGIN_TRY {
+        ret = H5Pset_fapl_family_striped(fapl, (hsize_t)STRIPE_SIZE, 0, H5P_DEFAULT);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("zero stripe count accepted");
+    if(H5Pset_fapl_family_striped(fapl, (hsize_t)STRIPE_SIZE, STRIPE_COUNT, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if(H5Pget_fapl_family_striped(fapl, &stripe_size, &stripe_count, &memb_fapl) < 0)
+        TEST_ERROR;
+    if(stripe_size != STRIPE_SIZE || stripe_count != STRIPE_COUNT)
+        TEST_ERROR;
+    if(H5Pclose(memb_fapl) < 0)
+        TEST_ERROR;
+    memb_fapl = -1;
+
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0)
+        TEST_ERROR;
+    if(H5Pget_member_io_threads(dxpl, &nthreads, &min_size) < 0)
+        TEST_ERROR;
+    if(nthreads != 1)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_member_io_threads(dxpl, 0, (size_t)KB);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("zero threads accepted");
+    if(H5Pset_member_io_threads(dxpl, 4, (size_t)KB) < 0)
+        TEST_ERROR;
+    if(H5Pget_member_io_threads(dxpl, &nthreads, &min_size) < 0)
+        TEST_ERROR;
+    if(nthreads != 4 || min_size != KB)
+        TEST_ERROR;
+
+    /* Write a dataset that spans many stripes */
+    h5_fixname(FILENAME[13], fapl, filename, sizeof(filename));
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if(H5FD_FAMILY != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+
+    if(NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if(NULL == (check = (int *)HDcalloc((size_t)1, DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, points) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* The file can't be opened as a classic FAMILY file, or with a
+     * different stripe count
+     */
+    if((fapl2 = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_family(fapl2, (hsize_t)STRIPE_SIZE, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        file = H5Fopen(filename, H5F_ACC_RDONLY, fapl2);
+    } H5E_END_TRY;
+    if(file >= 0)
+        FAIL_PUTS_ERROR("striped file opened as a classic family file");
+    if(H5Pset_fapl_family_striped(fapl2, (hsize_t)STRIPE_SIZE, STRIPE_COUNT + 1, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        file = H5Fopen(filename, H5F_ACC_RDONLY, fapl2);
+    } H5E_END_TRY;
+    if(file >= 0)
+        FAIL_PUTS_ERROR("striped file opened with the wrong stripe count");
+
+    /* Reopen it and read the dataset back */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, check) < 0)
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        if(points[i] != check[i]) {
+            H5_FAILED();
+            printf("    Read different values than written at index %d\n", i);
+            TEST_ERROR;
+        } /* end if */
+
+    /* The failures of all the member I/O threads are reported on the
+     * error stack of the application's thread.  (Without thread-safety,
+     * the members are accessed in turn, and the first failure ends the
+     * request.)
+     */
+    if(H5is_library_threadsafe(&is_ts) < 0)
+        TEST_ERROR;
+    H5FD_members_fail_io_test(TRUE);
+    H5E_BEGIN_TRY {
+        ret = H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, check);
+    } H5E_END_TRY;
+    H5FD_members_fail_io_test(FALSE);
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("member file I/O failure not reported");
+    nfailures = 0;
+    if(H5Ewalk2(H5E_DEFAULT, H5E_WALK_UPWARD, count_memb_failures_cb, &nfailures) < 0)
+        TEST_ERROR;
+    if(nfailures != (is_ts ? STRIPE_COUNT : 1))
+        FAIL_PUTS_ERROR("member file I/O failures not on the error stack");
+
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    h5_delete_test_file(FILENAME[13], fapl);
+
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Pclose(dxpl) < 0)
+        TEST_ERROR;
+    if(H5Pclose(fapl2) < 0)
+        TEST_ERROR;
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    HDfree(points);
+    HDfree(check);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Pclose(dxpl);
+        H5Pclose(memb_fapl);
+        H5Pclose(fapl2);
+        H5Pclose(fapl);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    H5FD_members_fail_io_test(FALSE);
+    if(points)
+        HDfree(points);
+    if(check)
+        HDfree(check);
+    return -1;
+} /* end test_family_striped() */
+
+
 /*-------------------------------------------------------------------------
  * Function:    test_multi_opens
  *
@@ -1736,6 +2244,1012 @@ error:
 } /* end test_windows() */
 
 
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_driver
+ *
+ * Purpose:     Writes extents to a file with H5FDwrite_vector() and
+ *              reads them back with H5FDread_vector(), using a different
+ *              split of the file's address space, through the driver
+ *              set in FAPL_ID.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_driver(const char *drv_name, hid_t fapl_id)
+{
+    /* Extents to write, out of address order, some adjacent in the file */
+    haddr_t     waddrs[VECTOR_NEXTENTS] = {1000, 0, 1100, 100, 2000, 300};
+    size_t      wsizes[VECTOR_NEXTENTS] = {100, 100, 400, 200, 7, 50};
+    /* Extents to read: the image in three pieces, and a piece beyond the
+     * end of the file, which reads as zeros
+     */
+    haddr_t     raddrs[4] = {1500, 0, VECTOR_EOA - 100, 1024};
+    size_t      rsizes[4] = {VECTOR_IMAGE_SIZE - 1500, 1024, 100, 1500 - 1024};
+    H5FD_mem_t  types[VECTOR_NEXTENTS];
+    unsigned char wbufs[VECTOR_NEXTENTS][VECTOR_MAX_EXTENT];
+    const void  *wbuf_ptrs[VECTOR_NEXTENTS];
+    unsigned char *expected = NULL;         /* Expected image of the file  */
+    unsigned char *rbuf = NULL;             /* Buffer read back            */
+    void        *rbuf_ptrs[4];
+    H5FD_t      *file = NULL;               /* VFD file struct             */
+    char        filename[1024];             /* filename                    */
+    char        title[80];                  /* test title                  */
+    herr_t      ret;                        /* generic return value        */
+    unsigned    u, v;
+
+    HDsnprintf(title, sizeof(title), "vector I/O with %s file driver", drv_name);
+    TESTING(title);
+
+    h5_fixname(FILENAME[10], fapl_id, filename, sizeof(filename));
+
+    if(NULL == (expected = (unsigned char *)HDcalloc((size_t)1, (size_t)VECTOR_EOA)))
+        TEST_ERROR;
+    if(NULL == (rbuf = (unsigned char *)HDmalloc((size_t)VECTOR_EOA)))
+        TEST_ERROR;
+
+    /* Fill the extents with distinct bytes, and build the expected image */
+    for(u = 0; u < VECTOR_NEXTENTS; u++) {
+        types[u] = H5FD_MEM_DRAW;
+        for(v = 0; v < wsizes[u]; v++) {
+            wbufs[u][v] = (unsigned char)(u * 31 + v + 1);
+            expected[waddrs[u] + v] = wbufs[u][v];
+        } /* end for */
+        wbuf_ptrs[u] = wbufs[u];
+    } /* end for */
+    HDmemset(rbuf, 0xff, (size_t)VECTOR_EOA);
+    for(u = 0; u < 4; u++)
+        rbuf_ptrs[u] = rbuf + raddrs[u];
+
+    /* Write the extents */
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, (haddr_t)VECTOR_EOA) < 0)
+        TEST_ERROR;
+    if(H5FDwrite_vector(file, H5P_DEFAULT, (uint32_t)VECTOR_NEXTENTS, types, waddrs, wsizes, wbuf_ptrs) < 0)
+        TEST_ERROR;
+
+    /* An empty vector is a no-op */
+    if(H5FDwrite_vector(file, H5P_DEFAULT, (uint32_t)0, NULL, NULL, NULL, NULL) < 0)
+        TEST_ERROR;
+
+    /* Read them back, split differently */
+    if(H5FDread_vector(file, H5P_DEFAULT, (uint32_t)4, types, raddrs, rsizes, rbuf_ptrs) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(rbuf, expected, (size_t)VECTOR_IMAGE_SIZE))
+        FAIL_PUTS_ERROR("data read back doesn't match data written");
+    if(HDmemcmp(rbuf + VECTOR_EOA - 100, expected + VECTOR_EOA - 100, (size_t)100))
+        FAIL_PUTS_ERROR("data past the end of the file isn't zero");
+
+    /* Extents past the EOA fail */
+    raddrs[0] = VECTOR_EOA;
+    H5E_BEGIN_TRY {
+        ret = H5FDread_vector(file, H5P_DEFAULT, (uint32_t)4, types, raddrs, rsizes, rbuf_ptrs);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("read past the EOA succeeded");
+
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+    h5_delete_test_file(FILENAME[10], fapl_id);
+
+    HDfree(expected);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+    } H5E_END_TRY;
+    if(expected)
+        HDfree(expected);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+} /* end test_vector_io_driver() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io_multi
+ *
+ * Purpose:     Writes extents in several members of a MULTI file with
+ *              H5FDwrite_vector(), and reads them back with
+ *              H5FDread_vector() and H5FDread().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io_multi(void)
+{
+    /* Extents of the super block, B-tree and raw data members, mixed */
+    H5FD_mem_t  types[VECTOR_NEXTENTS] = {H5FD_MEM_DRAW, H5FD_MEM_SUPER, H5FD_MEM_BTREE,
+                                          H5FD_MEM_DRAW, H5FD_MEM_SUPER, H5FD_MEM_BTREE};
+    haddr_t     addrs[VECTOR_NEXTENTS] = {4*KB + 500, 100, 2*KB + 10, 4*KB, 0, 2*KB + 400};
+    size_t      sizes[VECTOR_NEXTENTS] = {100, 200, 300, 400, 50, 7};
+    hid_t       fapl = -1;                  /* file access property list ID */
+    H5FD_mem_t  mt, memb_map[H5FD_MEM_NTYPES];
+    hid_t       memb_fapl[H5FD_MEM_NTYPES];
+    haddr_t     memb_addr[H5FD_MEM_NTYPES];
+    const char  *memb_name[H5FD_MEM_NTYPES];
+    unsigned char wbufs[VECTOR_NEXTENTS][VECTOR_MAX_EXTENT];
+    unsigned char rbufs[VECTOR_NEXTENTS][VECTOR_MAX_EXTENT];
+    const void  *wbuf_ptrs[VECTOR_NEXTENTS];
+    void        *rbuf_ptrs[VECTOR_NEXTENTS];
+    H5FD_t      *file = NULL;               /* VFD file struct             */
+    char        filename[1024];             /* filename                    */
+    unsigned    u, v;
+
+    TESTING("vector I/O with MULTI file driver");
+
+    /* The super block, B-tree and raw data members start 2KB apart */
+    for(mt = H5FD_MEM_DEFAULT; mt < H5FD_MEM_NTYPES; H5_INC_ENUM(H5FD_mem_t, mt)) {
+        memb_fapl[mt] = H5P_DEFAULT;
+        memb_map[mt] = H5FD_MEM_SUPER;
+        memb_name[mt] = NULL;
+        memb_addr[mt] = 0;
+    } /* end for */
+    memb_map[H5FD_MEM_BTREE] = H5FD_MEM_BTREE;
+    memb_map[H5FD_MEM_DRAW] = H5FD_MEM_DRAW;
+    memb_name[H5FD_MEM_SUPER] = "%s-s.h5";
+    memb_name[H5FD_MEM_BTREE] = "%s-b.h5";
+    memb_addr[H5FD_MEM_BTREE] = 2*KB;
+    memb_name[H5FD_MEM_DRAW] = "%s-r.h5";
+    memb_addr[H5FD_MEM_DRAW] = 4*KB;
+
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_multi(fapl, memb_map, memb_fapl, memb_name, memb_addr, TRUE) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[10], fapl, filename, sizeof(filename));
+
+    for(u = 0; u < VECTOR_NEXTENTS; u++) {
+        for(v = 0; v < sizes[u]; v++)
+            wbufs[u][v] = (unsigned char)(u * 31 + v + 1);
+        wbuf_ptrs[u] = wbufs[u];
+        rbuf_ptrs[u] = rbufs[u];
+    } /* end for */
+    HDmemset(rbufs, 0, sizeof(rbufs));
+
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF)))
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_SUPER, (haddr_t)KB) < 0)
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_BTREE, (haddr_t)(3*KB)) < 0)
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_DRAW, (haddr_t)(5*KB)) < 0)
+        TEST_ERROR;
+
+    if(H5FDwrite_vector(file, H5P_DEFAULT, (uint32_t)VECTOR_NEXTENTS, types, addrs, sizes, wbuf_ptrs) < 0)
+        TEST_ERROR;
+    if(H5FDread_vector(file, H5P_DEFAULT, (uint32_t)VECTOR_NEXTENTS, types, addrs, sizes, rbuf_ptrs) < 0)
+        TEST_ERROR;
+    for(u = 0; u < VECTOR_NEXTENTS; u++)
+        if(HDmemcmp(rbufs[u], wbufs[u], sizes[u]))
+            FAIL_PUTS_ERROR("data read back doesn't match data written");
+
+    /* The extents were written at the right place in each member */
+    HDmemset(rbufs, 0, sizeof(rbufs));
+    for(u = 0; u < VECTOR_NEXTENTS; u++) {
+        if(H5FDread(file, types[u], H5P_DEFAULT, addrs[u], sizes[u], rbufs[u]) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(rbufs[u], wbufs[u], sizes[u]))
+            FAIL_PUTS_ERROR("data read back doesn't match data written");
+    } /* end for */
+
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+    h5_delete_test_file(FILENAME[10], fapl);
+
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+        H5Pclose(fapl);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_vector_io_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_vector_io
+ *
+ * Purpose:     Tests vector I/O through drivers with and without vector
+ *              callbacks.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_vector_io(void)
+{
+    hid_t       fapl_id = -1;               /* file access property list ID */
+    int         nerrors = 0;
+
+    /* SEC2, which has vector callbacks */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_sec2(fapl_id) < 0)
+        TEST_ERROR;
+    nerrors += test_vector_io_driver("SEC2", fapl_id) < 0 ? 1 : 0;
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    /* FAMILY, with extents that span members, and striped */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_family(fapl_id, (hsize_t)FAMILY_SIZE, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    nerrors += test_vector_io_driver("FAMILY", fapl_id) < 0 ? 1 : 0;
+    if(H5Pset_fapl_family_striped(fapl_id, (hsize_t)STRIPE_SMALL_SIZE, STRIPE_COUNT, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    nerrors += test_vector_io_driver("FAMILY (striped)", fapl_id) < 0 ? 1 : 0;
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    /* MULTI, with extents in several members */
+    nerrors += test_vector_io_multi() < 0 ? 1 : 0;
+
+    /* CORE and STDIO, which fall back to single extent I/O */
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_core(fapl_id, (size_t)CORE_INCREMENT, TRUE) < 0)
+        TEST_ERROR;
+    nerrors += test_vector_io_driver("CORE", fapl_id) < 0 ? 1 : 0;
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    if((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_stdio(fapl_id) < 0)
+        TEST_ERROR;
+    nerrors += test_vector_io_driver("STDIO", fapl_id) < 0 ? 1 : 0;
+    if(H5Pclose(fapl_id) < 0)
+        TEST_ERROR;
+
+    return nerrors ? -1 : 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl_id);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_vector_io() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring_extents
+ *
+ * Purpose:     Writes a large aligned extent and an unaligned one through
+ *              the io_uring driver set in FAPL_ID, so that they are split
+ *              into more pieces than the queue holds, and reads them back
+ *              (with a little past the end of the file) in one read.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#ifdef H5_HAVE_IOURING
+static herr_t
+test_iouring_extents(const char *drv_name, hid_t fapl_id)
+{
+    haddr_t     addrs[2] = {0, IOURING_ODD_ADDR};
+    size_t      sizes[2] = {IOURING_BIG_SIZE, IOURING_ODD_SIZE};
+    H5FD_mem_t  types[2] = {H5FD_MEM_DRAW, H5FD_MEM_DRAW};
+    const void  *wbuf_ptrs[2];
+    unsigned char *wbuf = NULL;             /* Data to write (aligned)     */
+    unsigned char *rbuf = NULL;             /* Buffer read back (aligned)  */
+    H5FD_t      *file = NULL;               /* VFD file struct             */
+    char        filename[1024];             /* filename                    */
+    char        title[80];                  /* test title                  */
+    size_t      u;
+
+    HDsnprintf(title, sizeof(title), "large extents with %s file driver", drv_name);
+    TESTING(title);
+
+    h5_fixname(FILENAME[11], fapl_id, filename, sizeof(filename));
+
+    if(0 != HDposix_memalign((void **)&wbuf, (size_t)IOURING_ALIGN, (size_t)IOURING_FILE_SIZE))
+        TEST_ERROR;
+    if(0 != HDposix_memalign((void **)&rbuf, (size_t)IOURING_ALIGN, (size_t)IOURING_FILE_SIZE))
+        TEST_ERROR;
+    HDmemset(wbuf, 0, (size_t)IOURING_FILE_SIZE);
+    for(u = 0; u < IOURING_BIG_SIZE; u++)
+        wbuf[u] = (unsigned char)(u % 251);
+    for(u = 0; u < IOURING_ODD_SIZE; u++)
+        wbuf[IOURING_ODD_ADDR + u] = (unsigned char)(u % 241 + 1);
+    HDmemset(rbuf, 0xff, (size_t)IOURING_FILE_SIZE);
+    wbuf_ptrs[0] = wbuf;
+    wbuf_ptrs[1] = wbuf + IOURING_ODD_ADDR;
+
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, (haddr_t)IOURING_FILE_SIZE) < 0)
+        TEST_ERROR;
+    if(H5FDwrite_vector(file, H5P_DEFAULT, (uint32_t)2, types, addrs, sizes, wbuf_ptrs) < 0)
+        TEST_ERROR;
+    if(H5FDget_eof(file, H5FD_MEM_DEFAULT) != (haddr_t)(IOURING_ODD_ADDR + IOURING_ODD_SIZE))
+        FAIL_PUTS_ERROR("wrong end of file after writing");
+
+    /* Read everything back at once, including the gap and past the EOF */
+    if(H5FDread(file, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)IOURING_FILE_SIZE, rbuf) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(rbuf, wbuf, (size_t)IOURING_FILE_SIZE))
+        FAIL_PUTS_ERROR("data read back doesn't match data written");
+
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+    h5_delete_test_file(FILENAME[11], fapl_id);
+
+    HDfree(wbuf);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+} /* end test_iouring_extents() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring_submit_fail
+ *
+ * Purpose:     Makes submissions to io_uring fail partway through vector
+ *              writes and reads with the driver set in FAPL_ID, both with
+ *              entries in flight and without, and checks that the failed
+ *              transfers leave nothing behind in the ring, and that later
+ *              I/O on the same file still works and sees the right data.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring_submit_fail(const char *drv_name, hid_t fapl_id)
+{
+    haddr_t     addrs[IOURING_NEXTENTS];
+    size_t      sizes[IOURING_NEXTENTS];
+    H5FD_mem_t  types[IOURING_NEXTENTS];
+    const void  *wbuf_ptrs[IOURING_NEXTENTS];
+    const void  *wbuf2_ptrs[IOURING_NEXTENTS];
+    void        *rbuf_ptrs[IOURING_NEXTENTS];
+    unsigned char *wbuf = NULL;             /* Data to write (aligned)     */
+    unsigned char *wbuf2 = NULL;            /* Data written after failures */
+    unsigned char *rbuf = NULL;             /* Buffer read back (aligned)  */
+    H5FD_t      *file = NULL;               /* VFD file struct             */
+    char        filename[1024];             /* filename                    */
+    char        title[80];                  /* test title                  */
+    herr_t      ret;
+    size_t      u;
+
+    HDsnprintf(title, sizeof(title), "failed submissions with %s file driver", drv_name);
+    TESTING(title);
+
+    h5_fixname(FILENAME[11], fapl_id, filename, sizeof(filename));
+
+    /* More extents than the queue holds, so they take several submissions */
+    if(0 != HDposix_memalign((void **)&wbuf, (size_t)IOURING_ALIGN, (size_t)(IOURING_NEXTENTS * IOURING_EXTENT_SIZE)))
+        TEST_ERROR;
+    if(0 != HDposix_memalign((void **)&wbuf2, (size_t)IOURING_ALIGN, (size_t)(IOURING_NEXTENTS * IOURING_EXTENT_SIZE)))
+        TEST_ERROR;
+    if(0 != HDposix_memalign((void **)&rbuf, (size_t)IOURING_ALIGN, (size_t)(IOURING_NEXTENTS * IOURING_EXTENT_SIZE)))
+        TEST_ERROR;
+    for(u = 0; u < IOURING_NEXTENTS * IOURING_EXTENT_SIZE; u++) {
+        wbuf[u] = (unsigned char)(u % 239 + 3);
+        wbuf2[u] = (unsigned char)(u % 233 + 5);
+    } /* end for */
+    for(u = 0; u < IOURING_NEXTENTS; u++) {
+        addrs[u] = (haddr_t)(u * IOURING_EXTENT_GAP);
+        sizes[u] = IOURING_EXTENT_SIZE;
+        types[u] = H5FD_MEM_DRAW;
+        wbuf_ptrs[u] = wbuf + u * IOURING_EXTENT_SIZE;
+        wbuf2_ptrs[u] = wbuf2 + u * IOURING_EXTENT_SIZE;
+        rbuf_ptrs[u] = rbuf + u * IOURING_EXTENT_SIZE;
+    } /* end for */
+
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, (haddr_t)(IOURING_NEXTENTS * IOURING_EXTENT_GAP)) < 0)
+        TEST_ERROR;
+
+    /* Fail the second submission, with entries in flight */
+    H5FD_iouring_fail_submit_test(2, EIO);
+    H5E_BEGIN_TRY {
+        ret = H5FDwrite_vector(file, H5P_DEFAULT, (uint32_t)IOURING_NEXTENTS, types, addrs, sizes, wbuf_ptrs);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("write succeeded with a failed submission");
+    if(!H5FD_iouring_idle_test(file))
+        FAIL_PUTS_ERROR("failed write left entries in the ring");
+
+    /* Fail the first submission, with nothing in flight */
+    H5FD_iouring_fail_submit_test(1, EBUSY);
+    H5E_BEGIN_TRY {
+        ret = H5FDwrite_vector(file, H5P_DEFAULT, (uint32_t)IOURING_NEXTENTS, types, addrs, sizes, wbuf_ptrs);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("write succeeded with a failed submission");
+    if(!H5FD_iouring_idle_test(file))
+        FAIL_PUTS_ERROR("failed write left entries in the ring");
+
+    /* The file is still usable, and only the new data reaches it (by the
+     * time it's closed)
+     */
+    H5FD_iouring_fail_submit_test(0, 0);
+    if(H5FDwrite_vector(file, H5P_DEFAULT, (uint32_t)IOURING_NEXTENTS, types, addrs, sizes, wbuf2_ptrs) < 0)
+        TEST_ERROR;
+    if(!H5FD_iouring_idle_test(file))
+        FAIL_PUTS_ERROR("write left entries in the ring");
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+    if(NULL == (file = H5FDopen(filename, H5F_ACC_RDWR, fapl_id, HADDR_UNDEF)))
+        TEST_ERROR;
+    if(H5FDset_eoa(file, H5FD_MEM_DEFAULT, (haddr_t)(IOURING_NEXTENTS * IOURING_EXTENT_GAP)) < 0)
+        TEST_ERROR;
+
+    /* Fail a read partway through, then read everything back */
+    H5FD_iouring_fail_submit_test(2, EIO);
+    H5E_BEGIN_TRY {
+        ret = H5FDread_vector(file, H5P_DEFAULT, (uint32_t)IOURING_NEXTENTS, types, addrs, sizes, rbuf_ptrs);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("read succeeded with a failed submission");
+    if(!H5FD_iouring_idle_test(file))
+        FAIL_PUTS_ERROR("failed read left entries in the ring");
+    H5FD_iouring_fail_submit_test(0, 0);
+    HDmemset(rbuf, 0, (size_t)(IOURING_NEXTENTS * IOURING_EXTENT_SIZE));
+    if(H5FDread_vector(file, H5P_DEFAULT, (uint32_t)IOURING_NEXTENTS, types, addrs, sizes, rbuf_ptrs) < 0)
+        TEST_ERROR;
+    if(HDmemcmp(rbuf, wbuf2, (size_t)(IOURING_NEXTENTS * IOURING_EXTENT_SIZE)))
+        FAIL_PUTS_ERROR("data read back doesn't match data written");
+
+    if(H5FDclose(file) < 0)
+        TEST_ERROR;
+    file = NULL;
+    h5_delete_test_file(FILENAME[11], fapl_id);
+
+    HDfree(wbuf);
+    HDfree(wbuf2);
+    HDfree(rbuf);
+
+    PASSED();
+    return 0;
+
+error:
+    H5FD_iouring_fail_submit_test(0, 0);
+    H5E_BEGIN_TRY {
+        if(file)
+            H5FDclose(file);
+    } H5E_END_TRY;
+    if(wbuf)
+        HDfree(wbuf);
+    if(wbuf2)
+        HDfree(wbuf2);
+    if(rbuf)
+        HDfree(rbuf);
+    return -1;
+} /* end test_iouring_submit_fail() */
+#endif /* H5_HAVE_IOURING */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_iouring
+ *
+ * Purpose:     Tests the io_uring file driver, with and without direct
+ *              I/O and registered buffers.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_iouring(void)
+{
+#ifdef H5_HAVE_IOURING
+    const unsigned  flag_sets[4] = {0, H5FD_IOURING_FIXED_BUFFERS, H5FD_IOURING_DIRECT_IO,
+                                    H5FD_IOURING_DIRECT_IO | H5FD_IOURING_FIXED_BUFFERS};
+    const char      *flag_names[4] = {"IOURING", "IOURING (fixed buffers)", "IOURING (direct)",
+                                    "IOURING (direct, fixed buffers)"};
+    hid_t       file = -1, fapl = -1, access_fapl = -1;
+    hid_t       dset = -1, space = -1;
+    char        filename[1024];
+    int         *fhandle = NULL;
+    hsize_t     dims[2];
+    unsigned    depth, flags;
+    int         *points = NULL, *check = NULL;
+    herr_t      ret;
+    int         nerrors = 0;
+    int         i;
+    unsigned    u;
+#endif /* H5_HAVE_IOURING */
+
+    TESTING("io_uring file driver");
+
+#ifndef H5_HAVE_IOURING
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_IOURING */
+
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+
+    /* Verify the file access properties, and the defaults */
+    if(H5Pset_fapl_iouring(fapl, 0, 0) < 0)
+        TEST_ERROR;
+    if(H5Pget_fapl_iouring(fapl, &depth, &flags) < 0)
+        TEST_ERROR;
+    if(depth != H5FD_IOURING_QUEUE_DEPTH_DEF || flags != 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY {
+        ret = H5Pset_fapl_iouring(fapl, IOURING_DEPTH, 0x8000u);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("unknown flags accepted");
+    if(H5Pset_fapl_iouring(fapl, IOURING_DEPTH, H5FD_IOURING_FIXED_BUFFERS) < 0)
+        TEST_ERROR;
+    if(H5Pget_fapl_iouring(fapl, &depth, &flags) < 0)
+        TEST_ERROR;
+    if(depth != IOURING_DEPTH || flags != H5FD_IOURING_FIXED_BUFFERS)
+        TEST_ERROR;
+    h5_fixname(FILENAME[11], fapl, filename, sizeof filename);
+
+    H5E_BEGIN_TRY {
+        file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    } H5E_END_TRY;
+    if(file < 0) {
+        H5Pclose(fapl);
+        SKIPPED();
+        printf("  Probably the kernel doesn't support io_uring\n");
+        return 0;
+    } /* end if */
+
+    /* Check the driver and the file handle */
+    if((access_fapl = H5Fget_access_plist(file)) < 0)
+        TEST_ERROR;
+    if(H5FD_IOURING != H5Pget_driver(access_fapl))
+        TEST_ERROR;
+    if(H5Pclose(access_fapl) < 0)
+        TEST_ERROR;
+    if(H5Fget_vfd_handle(file, H5P_DEFAULT, (void **)&fhandle) < 0)
+        TEST_ERROR;
+    if(*fhandle < 0)
+        TEST_ERROR;
+
+    /* Write a dataset large enough to need several staging buffers */
+    if(NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if(NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+    dims[0] = DSET1_DIM1;
+    dims[1] = DSET1_DIM2;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    /* Reopen the file and read the data back */
+    if((file = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        if(points[i] != check[i]) {
+            H5_FAILED();
+            printf("    Read different values than written at index %d\n", i);
+            TEST_ERROR;
+        } /* end if */
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+    h5_delete_test_file(FILENAME[11], fapl);
+
+    HDfree(points);
+    points = NULL;
+    HDfree(check);
+    check = NULL;
+
+    PASSED();
+
+    /* Vector and large extent I/O, with each combination of flags */
+    for(u = 0; u < 4; u++) {
+        if(H5Pset_fapl_iouring(fapl, IOURING_DEPTH, flag_sets[u]) < 0)
+            TEST_ERROR;
+
+        /* The file system may not support direct I/O */
+        if(flag_sets[u] & H5FD_IOURING_DIRECT_IO) {
+            H5FD_t *probe;
+
+            H5E_BEGIN_TRY {
+                probe = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl, HADDR_UNDEF);
+            } H5E_END_TRY;
+            if(NULL == probe) {
+                TESTING(flag_names[u]);
+                SKIPPED();
+                printf("  Probably the file system doesn't support Direct I/O\n");
+                continue;
+            } /* end if */
+            if(H5FDclose(probe) < 0)
+                TEST_ERROR;
+            h5_delete_test_file(FILENAME[11], fapl);
+        } /* end if */
+
+        nerrors += test_vector_io_driver(flag_names[u], fapl) < 0 ? 1 : 0;
+        nerrors += test_iouring_extents(flag_names[u], fapl) < 0 ? 1 : 0;
+        nerrors += test_iouring_submit_fail(flag_names[u], fapl) < 0 ? 1 : 0;
+    } /* end for */
+
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+
+    return nerrors ? -1 : 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+
+    if(points)
+        HDfree(points);
+    if(check)
+        HDfree(check);
+
+    return -1;
+#endif /* H5_HAVE_IOURING */
+} /* end test_iouring() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    test_mmap
+ *
+ * Purpose:     Tests the read-only mmap file driver, with the whole file
+ *              mapped and with small windows, also with only two windows
+ *              kept mapped at once, and the mapping of file regions with
+ *              H5FDmap().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_mmap(void)
+{
+#ifdef H5_HAVE_MMAP
+    const size_t windows[3] = {0, MMAP_WINDOW, MMAP_WINDOW};
+    hid_t       file = -1, fapl = -1, mmap_fapl = -1, access_fapl = -1;
+    hid_t       gcpl = -1, grp = -1, dset = -1, space = -1, mspace = -1;
+    H5FD_t      *lf = NULL;
+    char        filename[1024];
+    char        name[32];
+    hsize_t     dims[2], start[2], count[2];
+    haddr_t     eof;
+    size_t      window;
+    const void  *ptr;
+    unsigned char sig[MMAP_SIG_SIZE];
+    int         *points = NULL, *check = NULL;
+    unsigned char *whole = NULL;
+    herr_t      ret;
+    int         i, j;
+    unsigned    u;
+#endif /* H5_HAVE_MMAP */
+
+    TESTING("mmap file driver");
+
+#ifndef H5_HAVE_MMAP
+    SKIPPED();
+    return 0;
+#else /* H5_HAVE_MMAP */
+
+    /* Verify the file access properties */
+    if((mmap_fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_mmap(mmap_fapl, MMAP_WINDOW) < 0)
+        TEST_ERROR;
+    if(H5Pget_fapl_mmap(mmap_fapl, &window) < 0)
+        TEST_ERROR;
+    if(window != MMAP_WINDOW)
+        TEST_ERROR;
+
+    /* The driver is read-only, so create the file with sec2.  Use the
+     * latest format with dense link storage, so that speculatively loaded
+     * and fractal heap metadata are read back.
+     */
+    if((fapl = H5Pcreate(H5P_FILE_ACCESS)) < 0)
+        TEST_ERROR;
+    if(H5Pset_fapl_sec2(fapl) < 0)
+        TEST_ERROR;
+    if(H5Pset_libver_bounds(fapl, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST) < 0)
+        TEST_ERROR;
+    h5_fixname(FILENAME[12], fapl, filename, sizeof filename);
+
+    if((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0)
+        TEST_ERROR;
+
+    if(NULL == (points = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    if(NULL == (check = (int *)HDmalloc(DSET1_DIM1 * DSET1_DIM2 * sizeof(int))))
+        TEST_ERROR;
+    for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+        points[i] = i;
+    dims[0] = DSET1_DIM1;
+    dims[1] = DSET1_DIM2;
+    if((space = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if((dset = H5Dcreate2(file, DSET1_NAME, H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, points) < 0)
+        TEST_ERROR;
+    if(H5Dclose(dset) < 0)
+        TEST_ERROR;
+
+    if((gcpl = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        TEST_ERROR;
+    if(H5Pset_link_phase_change(gcpl, 4, 2) < 0)
+        TEST_ERROR;
+    if((grp = H5Gcreate2(file, MMAP_GROUP_NAME, H5P_DEFAULT, gcpl, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for(u = 0; u < MMAP_NLINKS; u++) {
+        HDsnprintf(name, sizeof(name), "link %u", u);
+        if(H5Lcreate_hard(file, DSET1_NAME, grp, name, H5P_DEFAULT, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if(H5Gclose(grp) < 0)
+        TEST_ERROR;
+    if(H5Pclose(gcpl) < 0)
+        TEST_ERROR;
+    if(H5Fclose(file) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    for(u = 0; u < 3; u++) {
+        if(2 == u) {
+            TESTING("mmap file driver (two windows mapped)");
+        } /* end if */
+        else if(windows[u]) {
+            TESTING("mmap file driver (small windows)");
+        } /* end if */
+        else {
+            TESTING("mmap file driver (whole file)");
+        } /* end else */
+
+        /* In the last pass, only keep two windows mapped at once, so that
+         * windows are unmapped and mapped again as the file is read.
+         */
+        if(2 == u)
+            H5FD_mmap_max_mapped_test((size_t)(2 * MMAP_WINDOW));
+
+        if(H5Pset_fapl_mmap(mmap_fapl, windows[u]) < 0)
+            TEST_ERROR;
+
+        /* The file can't be opened for writing */
+        H5E_BEGIN_TRY {
+            file = H5Fopen(filename, H5F_ACC_RDWR, mmap_fapl);
+        } H5E_END_TRY;
+        if(file >= 0)
+            FAIL_PUTS_ERROR("file opened for writing");
+
+        if((file = H5Fopen(filename, H5F_ACC_RDONLY, mmap_fapl)) < 0)
+            TEST_ERROR;
+
+        /* Check the driver */
+        if((access_fapl = H5Fget_access_plist(file)) < 0)
+            TEST_ERROR;
+        if(H5FD_MMAP != H5Pget_driver(access_fapl))
+            TEST_ERROR;
+        if(H5Pclose(access_fapl) < 0)
+            TEST_ERROR;
+
+        /* Read the whole dataset, and a hyperslab of it */
+        if((dset = H5Dopen2(file, DSET1_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        HDmemset(check, 0, DSET1_DIM1 * DSET1_DIM2 * sizeof(int));
+        if(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for(i = 0; i < DSET1_DIM1 * DSET1_DIM2; i++)
+            if(points[i] != check[i]) {
+                H5_FAILED();
+                printf("    Read different values than written at index %d\n", i);
+                TEST_ERROR;
+            } /* end if */
+
+        start[0] = 10;
+        start[1] = 3;
+        count[0] = 20;
+        count[1] = 5;
+        if(H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if((mspace = H5Screate_simple(2, count, NULL)) < 0)
+            TEST_ERROR;
+        if(H5Dread(dset, H5T_NATIVE_INT, mspace, space, H5P_DEFAULT, check) < 0)
+            TEST_ERROR;
+        for(i = 0; i < (int)count[0]; i++)
+            for(j = 0; j < (int)count[1]; j++)
+                if(check[i * (int)count[1] + j] != points[(i + (int)start[0]) * DSET1_DIM2 + j + (int)start[1]])
+                    FAIL_PUTS_ERROR("hyperslab read different values than written");
+        if(H5Sclose(mspace) < 0)
+            TEST_ERROR;
+        if(H5Dclose(dset) < 0)
+            TEST_ERROR;
+
+        /* Look up the links in the group's fractal heap */
+        if((grp = H5Gopen2(file, MMAP_GROUP_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        for(j = MMAP_NLINKS - 1; j >= 0; j--) {
+            HDsnprintf(name, sizeof(name), "link %d", j);
+            if(H5Lexists(grp, name, H5P_DEFAULT) != TRUE)
+                FAIL_PUTS_ERROR("link not found");
+        } /* end for */
+        if(H5Gclose(grp) < 0)
+            TEST_ERROR;
+
+        if(H5Fclose(file) < 0)
+            TEST_ERROR;
+
+        /* Map regions of the file directly */
+        if(NULL == (lf = H5FDopen(filename, H5F_ACC_RDONLY, mmap_fapl, HADDR_UNDEF)))
+            TEST_ERROR;
+        eof = H5FDget_eof(lf, H5FD_MEM_DEFAULT);
+        if(HADDR_UNDEF == eof || eof < MMAP_SIG_SIZE)
+            TEST_ERROR;
+        if(H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eof) < 0)
+            TEST_ERROR;
+
+        if(H5FDread(lf, H5FD_MEM_SUPER, H5P_DEFAULT, (haddr_t)0, (size_t)MMAP_SIG_SIZE, sig) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(sig, MMAP_SIGNATURE, (size_t)MMAP_SIG_SIZE))
+            TEST_ERROR;
+        if(H5FDmap(lf, H5FD_MEM_SUPER, (haddr_t)0, (size_t)MMAP_SIG_SIZE, &ptr) < 0)
+            TEST_ERROR;
+        if(NULL == ptr || HDmemcmp(ptr, sig, (size_t)MMAP_SIG_SIZE))
+            FAIL_PUTS_ERROR("file signature not mapped");
+
+        /* Read the whole file, which touches every window, and map the
+         * signature again: with the cap, the first window has been unmapped
+         * in between.
+         */
+        if(NULL == (whole = (unsigned char *)HDmalloc((size_t)eof)))
+            TEST_ERROR;
+        if(H5FDread(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)eof, whole) < 0)
+            TEST_ERROR;
+        if(HDmemcmp(whole, sig, (size_t)MMAP_SIG_SIZE))
+            FAIL_PUTS_ERROR("file read different data than mapped");
+        if(2 == u) {
+            if(eof <= 2 * MMAP_WINDOW)
+                FAIL_PUTS_ERROR("file too small to unmap windows");
+            if(H5FD_mmap_nmapped_test(lf) > 2)
+                FAIL_PUTS_ERROR("too many windows mapped");
+        } /* end if */
+        if(H5FDmap(lf, H5FD_MEM_SUPER, (haddr_t)0, (size_t)MMAP_SIG_SIZE, &ptr) < 0)
+            TEST_ERROR;
+        if(NULL == ptr || HDmemcmp(ptr, sig, (size_t)MMAP_SIG_SIZE))
+            FAIL_PUTS_ERROR("file signature not mapped again");
+        if(H5FDmap(lf, H5FD_MEM_DRAW, (haddr_t)(eof - MMAP_SIG_SIZE), (size_t)MMAP_SIG_SIZE, &ptr) < 0)
+            TEST_ERROR;
+        if(NULL == ptr || HDmemcmp(ptr, whole + eof - MMAP_SIG_SIZE, (size_t)MMAP_SIG_SIZE))
+            FAIL_PUTS_ERROR("end of file not mapped");
+        if(2 == u && H5FD_mmap_nmapped_test(lf) > 2)
+            FAIL_PUTS_ERROR("too many windows mapped");
+        HDfree(whole);
+        whole = NULL;
+
+        /* Only the whole file mapping holds the file in one window */
+        if(H5FDmap(lf, H5FD_MEM_DRAW, (haddr_t)0, (size_t)eof, &ptr) < 0)
+            TEST_ERROR;
+        if((NULL == ptr) != (windows[u] != 0))
+            FAIL_PUTS_ERROR("wrong mapping of the whole file");
+
+        /* Regions past the end of the file are never mapped */
+        if(H5FDset_eoa(lf, H5FD_MEM_DEFAULT, eof + MMAP_WINDOW) < 0)
+            TEST_ERROR;
+        if(H5FDmap(lf, H5FD_MEM_DRAW, eof, (size_t)16, &ptr) < 0)
+            TEST_ERROR;
+        if(NULL != ptr)
+            FAIL_PUTS_ERROR("region past EOF mapped");
+
+        /* Writes fail */
+        H5E_BEGIN_TRY {
+            ret = H5FDwrite(lf, H5FD_MEM_DRAW, H5P_DEFAULT, (haddr_t)0, (size_t)MMAP_SIG_SIZE, sig);
+        } H5E_END_TRY;
+        if(ret >= 0)
+            FAIL_PUTS_ERROR("write succeeded");
+
+        if(H5FDclose(lf) < 0)
+            TEST_ERROR;
+        lf = NULL;
+
+        if(2 == u)
+            H5FD_mmap_max_mapped_test((size_t)0);
+
+        PASSED();
+    } /* end for */
+
+    h5_delete_test_file(FILENAME[12], fapl);
+
+    if(H5Sclose(space) < 0)
+        TEST_ERROR;
+    if(H5Pclose(mmap_fapl) < 0)
+        TEST_ERROR;
+    if(H5Pclose(fapl) < 0)
+        TEST_ERROR;
+    HDfree(points);
+    HDfree(check);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl);
+        H5Pclose(mmap_fapl);
+        H5Pclose(gcpl);
+        H5Gclose(grp);
+        H5Sclose(mspace);
+        H5Sclose(space);
+        H5Dclose(dset);
+        H5Fclose(file);
+    } H5E_END_TRY;
+    if(lf)
+        H5FDclose(lf);
+    H5FD_mmap_max_mapped_test((size_t)0);
+
+    if(points)
+        HDfree(points);
+    if(check)
+        HDfree(check);
+    if(whole)
+        HDfree(whole);
+
+    return -1;
+#endif /* H5_HAVE_MMAP */
+} /* end test_mmap() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    main
@@ -1761,14 +3275,19 @@ main(void)
 
     nerrors += test_sec2() < 0           ? 1 : 0;
     nerrors += test_core() < 0           ? 1 : 0;
+    nerrors += test_core_mmap() < 0      ? 1 : 0;
     nerrors += test_direct() < 0         ? 1 : 0;
     nerrors += test_family() < 0         ? 1 : 0;
     nerrors += test_family_compat() < 0  ? 1 : 0;
+    nerrors += test_family_striped() < 0 ? 1 : 0;
     nerrors += test_multi() < 0          ? 1 : 0;
     nerrors += test_multi_compat() < 0   ? 1 : 0;
     nerrors += test_log() < 0            ? 1 : 0;
     nerrors += test_stdio() < 0          ? 1 : 0;
     nerrors += test_windows() < 0        ? 1 : 0;
+    nerrors += test_vector_io() < 0      ? 1 : 0;
+    nerrors += test_iouring() < 0        ? 1 : 0;
+    nerrors += test_mmap() < 0           ? 1 : 0;
 
     if(nerrors) {
         HDprintf("***** %d Virtual File Driver TEST%s FAILED! *****\n",
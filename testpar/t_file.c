@@ -211,3 +211,121 @@ test_file_properties(void)
     VRFY((ret >= 0), "H5Pclose succeeded");
 } /* end test_file_properties() */
 
+
+/*
+ * Test vector I/O with the MPI-IO driver.  Each process owns a region of
+ * the file, and transfers four extents of it in one vector request: three
+ * that are adjacent in the file and one after a gap, given out of address
+ * order.  Only some of the processes take part in the independent
+ * transfers, which must not hang the others; the collective transfers
+ * include processes with no extents and with overlapping extents.
+ */
+#define VEC_NEXTENTS    4       /* Number of extents in a request */
+#define VEC_EXTENT      16      /* Size of an extent */
+#define VEC_REGION      128     /* Size of the file region of a process */
+
+void
+test_file_vector_io(void)
+{
+    H5FD_t *file;               /* File driver handle */
+    hid_t fapl_id;              /* File access plist */
+    hid_t dxpl_ind, dxpl_coll;  /* Independent and collective transfer plists */
+    H5FD_mem_t types[VEC_NEXTENTS];
+    haddr_t addrs[VEC_NEXTENTS];
+    size_t sizes[VEC_NEXTENTS];
+    void *bufs[VEC_NEXTENTS];
+    unsigned char wbuf[VEC_NEXTENTS][VEC_EXTENT];       /* Data written */
+    unsigned char rbuf[VEC_NEXTENTS][VEC_EXTENT];       /* Data read */
+    const haddr_t offsets[VEC_NEXTENTS] = {64, 0, 32, 16};     /* Extent offsets in a region */
+    const char *filename;
+    int mpi_size, mpi_rank;
+    int u, v;
+    herr_t ret;                 /* Generic return value */
+
+    filename = (const char *)GetTestParameters();
+    if(VERBOSE_MED)
+	printf("Vector I/O test on file %s\n", filename);
+
+    /* set up MPI parameters */
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    fapl_id = create_faccess_plist(MPI_COMM_WORLD, MPI_INFO_NULL, FACC_MPIO);
+    VRFY((fapl_id >= 0), "create_faccess_plist succeeded");
+    dxpl_ind = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl_ind >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl_ind, H5FD_MPIO_INDEPENDENT);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+    dxpl_coll = H5Pcreate(H5P_DATASET_XFER);
+    VRFY((dxpl_coll >= 0), "H5Pcreate succeeded");
+    ret = H5Pset_dxpl_mpio(dxpl_coll, H5FD_MPIO_COLLECTIVE);
+    VRFY((ret >= 0), "H5Pset_dxpl_mpio succeeded");
+
+    file = H5FDopen(filename, H5F_ACC_RDWR | H5F_ACC_CREAT | H5F_ACC_TRUNC, fapl_id, HADDR_UNDEF);
+    VRFY((file != NULL), "H5FDopen succeeded");
+    ret = H5FDset_eoa(file, H5FD_MEM_DRAW, (haddr_t)(mpi_size * VEC_REGION));
+    VRFY((ret >= 0), "H5FDset_eoa succeeded");
+
+    for(u = 0; u < VEC_NEXTENTS; u++) {
+        for(v = 0; v < VEC_EXTENT; v++)
+            wbuf[u][v] = (unsigned char)(mpi_rank * 64 + u * VEC_EXTENT + v);
+        types[u] = H5FD_MEM_DRAW;
+        addrs[u] = (haddr_t)(mpi_rank * VEC_REGION) + offsets[u];
+        sizes[u] = VEC_EXTENT;
+        bufs[u] = wbuf[u];
+    } /* end for */
+
+    /* Even ranks write independently, odd ranks collectively */
+    if(mpi_rank % 2 == 0) {
+        ret = H5FDwrite_vector(file, dxpl_ind, VEC_NEXTENTS, types, addrs, sizes, (const void **)bufs);
+        VRFY((ret >= 0), "H5FDwrite_vector succeeded");
+    } /* end if */
+    ret = H5FDwrite_vector(file, dxpl_coll, (uint32_t)(mpi_rank % 2 ? VEC_NEXTENTS : 0), types, addrs, sizes, (const void **)bufs);
+    VRFY((ret >= 0), "H5FDwrite_vector succeeded");
+
+    /* Make the writes visible to all processes */
+    ret = H5FDflush(file, dxpl_coll, FALSE);
+    VRFY((ret >= 0), "H5FDflush succeeded");
+    MPI_Barrier(MPI_COMM_WORLD);
+    ret = H5FDflush(file, dxpl_coll, FALSE);
+    VRFY((ret >= 0), "H5FDflush succeeded");
+
+    /* Read back collectively, rank 0 with an overlapping extent */
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    for(u = 0; u < VEC_NEXTENTS; u++)
+        bufs[u] = rbuf[u];
+    if(mpi_rank == 0)
+        addrs[0] = (haddr_t)(mpi_rank * VEC_REGION) + offsets[1] + VEC_EXTENT / 2;
+    ret = H5FDread_vector(file, dxpl_coll, VEC_NEXTENTS, types, addrs, sizes, bufs);
+    VRFY((ret >= 0), "H5FDread_vector succeeded");
+    for(u = 0; u < VEC_NEXTENTS; u++)
+        for(v = 0; v < VEC_EXTENT; v++)
+            if(mpi_rank == 0 && u == 0) {
+                int w = v + VEC_EXTENT / 2;     /* Offset from the start of extent 1 */
+
+                VRFY((rbuf[u][v] == wbuf[w / VEC_EXTENT == 0 ? 1 : 3][w % VEC_EXTENT]), "overlapping data read correctly");
+            } /* end if */
+            else
+                VRFY((rbuf[u][v] == wbuf[u][v]), "data read correctly");
+
+    /* The last rank reads the region of rank 0 independently */
+    if(mpi_rank == mpi_size - 1) {
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        for(u = 0; u < VEC_NEXTENTS; u++)
+            addrs[u] = offsets[u];
+        ret = H5FDread_vector(file, dxpl_ind, VEC_NEXTENTS, types, addrs, sizes, bufs);
+        VRFY((ret >= 0), "H5FDread_vector succeeded");
+        for(u = 0; u < VEC_NEXTENTS; u++)
+            for(v = 0; v < VEC_EXTENT; v++)
+                VRFY((rbuf[u][v] == (unsigned char)(u * VEC_EXTENT + v)), "data read correctly");
+    } /* end if */
+
+    ret = H5FDclose(file);
+    VRFY((ret >= 0), "H5FDclose succeeded");
+    ret = H5Pclose(dxpl_coll);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(dxpl_ind);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+    ret = H5Pclose(fapl_id);
+    VRFY((ret >= 0), "H5Pclose succeeded");
+} /* end test_file_vector_io() */
@@ -354,6 +354,9 @@ int main(int argc, char **argv)
     AddTest("props", test_file_properties, NULL,
 	    "Coll Metadata file property settings", PARATESTFILE);
 
+    AddTest("vecio", test_file_vector_io, NULL,
+	    "vector I/O with the MPI-IO driver", PARATESTFILE);
+
     AddTest("idsetw", dataset_writeInd, NULL,
 	    "dataset independent write", PARATESTFILE);
     AddTest("idsetr", dataset_readInd, NULL,
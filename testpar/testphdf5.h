@@ -239,6 +239,7 @@ extern int dxfer_coll_type;
 void test_plist_ed(void);
 void zero_dim_dset(void);
 void test_file_properties(void);
+void test_file_vector_io(void);
 void multiple_dset_write(void);
 void multiple_group_write(void);
 void multiple_group_read(void);
@@ -45,6 +45,7 @@ const char *FS_STRATEGY_NAME[] = {
     "H5F_FILE_SPACE_ALL",
     "H5F_FILE_SPACE_AGGR_VFD",
     "H5F_FILE_SPACE_VFD",
+    "H5F_FILE_SPACE_PAGE",
     NULL
 };
 